@@ -7,22 +7,29 @@
     APIs: gl=3.3
     Profile: compatibility
     Extensions:
-        
+        GL_ARB_buffer_storage
+        GL_ARB_get_program_binary
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="compatibility" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="compatibility" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_get_program_binary,GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_buffer_storage,GL_ARB_get_program_binary,GL_KHR_parallel_shader_compile
 */
 
 
 #ifndef __glad_h_
 #define __glad_h_
 
+/* GLAD_PER_CONTEXT keeps one GLAD_CORE_ONLY dispatch struct per context */
+#if defined(GLAD_PER_CONTEXT) && !defined(GLAD_CORE_ONLY)
+#define GLAD_CORE_ONLY
+#endif
+
 #ifdef __gl_h_
 #error OpenGL header already included, remove this include, glad already provides it
 #endif
@@ -86,6 +93,48 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* Like gladLoadGLLoader, but each function is only looked up the first time it is called */
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+
+/* O(1) check against the extensions found by the last load; usable for the life of the context */
+GLAPI int gladHasExtension(const char *name);
+
+/* Number of entry points glad knows, in load order; sizes per-function tables */
+#define GLAD_GL_FUNCTION_COUNT 729
+
+#ifdef GLAD_CALL_HOOKS
+/* Call hooks (build with GLAD_CALL_HOOKS): wrap every loaded function, for tracing and profiling */
+#define GLAD_CALL_MAX_ARGS 11
+struct gladGLcall {
+    int index;                  /* load-order position, below GLAD_GL_FUNCTION_COUNT */
+    const char *name;
+    const char *argTypes;       /* one letter per argument: i signed, u unsigned, e enum, x bitfield, f floating point, p pointer */
+    const char *argNames;       /* comma separated */
+    unsigned long long args[GLAD_CALL_MAX_ARGS];  /* raw values; an f argument holds the bits of a double */
+    char resultType;            /* type letter of the return value, v for void */
+    unsigned long long result;  /* raw return value, set before post */
+    unsigned long long user;    /* for the hooks to carry something from pre to post, zero before pre */
+};
+typedef void (*GLADcallhook)(struct gladGLcall *call);
+/* pre or post may be NULL; with GLAD_PER_CONTEXT only the current context's table is wrapped */
+GLAPI int gladInstallCallHooks(GLADcallhook pre, GLADcallhook post);
+GLAPI void gladRemoveCallHooks(void);
+/* The other direction, for replaying calls: look a function up by name (-1 if unknown), fill in
+   everything but args for an index, and call call->args through the current pointer (0 if not loaded) */
+GLAPI int gladFindFunction(const char *name);
+GLAPI int gladDescribeCall(int index, struct gladGLcall *call);
+GLAPI int gladInvokeCall(struct gladGLcall *call);
+#endif
+
+#ifdef GLAD_PER_CONTEXT
+/* Per-context dispatch: each thread calls through the table it made current (see the end of this file) */
+struct gladGLcontext;
+GLAPI struct gladGLcontext *gladCreateContext(void);
+GLAPI void gladDestroyContext(struct gladGLcontext *context);
+GLAPI void gladMakeContextCurrent(struct gladGLcontext *context);
+GLAPI struct gladGLcontext *gladGetCurrentContext(void);
+#endif
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -1383,6 +1432,19 @@ typedef void (APIENTRY *GLVULKANPROCNV)(void);
 #define GL_TIME_ELAPSED 0x88BF
 #define GL_TIMESTAMP 0x8E28
 #define GL_INT_2_10_10_10_REV 0x8D9F
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#define GL_PROGRAM_BINARY_FORMATS 0x87FF
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#define GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT 0x00004000
+#define GL_BUFFER_IMMUTABLE_STORAGE 0x821F
+#define GL_BUFFER_STORAGE_FLAGS 0x8220
 #ifndef GL_VERSION_1_0
 #define GL_VERSION_1_0 1
 GLAPI int GLAD_GL_VERSION_1_0;
@@ -3603,6 +3665,1185 @@ typedef void (APIENTRYP PFNGLSECONDARYCOLORP3UIVPROC)(GLenum type, const GLuint
 GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
 #define glSecondaryColorP3uiv glad_glSecondaryColorP3uiv
 #endif
+#ifndef GL_ARB_get_program_binary
+#define GL_ARB_get_program_binary 1
+GLAPI int GLAD_GL_ARB_get_program_binary;
+typedef void (APIENTRYP PFNGLGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+GLAPI PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary;
+#define glGetProgramBinary glad_glGetProgramBinary
+typedef void (APIENTRYP PFNGLPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+GLAPI PFNGLPROGRAMBINARYPROC glad_glProgramBinary;
+#define glProgramBinary glad_glProgramBinary
+typedef void (APIENTRYP PFNGLPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+GLAPI PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri;
+#define glProgramParameteri glad_glProgramParameteri
+#endif
+#ifndef GL_KHR_parallel_shader_compile
+#define GL_KHR_parallel_shader_compile 1
+GLAPI int GLAD_GL_KHR_parallel_shader_compile;
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+GLAPI PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR;
+#define glMaxShaderCompilerThreadsKHR glad_glMaxShaderCompilerThreadsKHR
+#endif
+#ifndef GL_ARB_buffer_storage
+#define GL_ARB_buffer_storage 1
+GLAPI int GLAD_GL_ARB_buffer_storage;
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+GLAPI PFNGLBUFFERSTORAGEPROC glad_glBufferStorage;
+#define glBufferStorage glad_glBufferStorage
+#endif
+
+#ifdef GLAD_CORE_ONLY
+/* Core profile only: the entry points a core context provides live next to each other in
+   one struct, in load order, and the fixed-function ones removed from core are not declared. */
+struct gladGLdispatchStruct {
+	PFNGLCULLFACEPROC CullFace;
+	PFNGLFRONTFACEPROC FrontFace;
+	PFNGLHINTPROC Hint;
+	PFNGLLINEWIDTHPROC LineWidth;
+	PFNGLPOINTSIZEPROC PointSize;
+	PFNGLPOLYGONMODEPROC PolygonMode;
+	PFNGLSCISSORPROC Scissor;
+	PFNGLTEXPARAMETERFPROC TexParameterf;
+	PFNGLTEXPARAMETERFVPROC TexParameterfv;
+	PFNGLTEXPARAMETERIPROC TexParameteri;
+	PFNGLTEXPARAMETERIVPROC TexParameteriv;
+	PFNGLTEXIMAGE1DPROC TexImage1D;
+	PFNGLTEXIMAGE2DPROC TexImage2D;
+	PFNGLDRAWBUFFERPROC DrawBuffer;
+	PFNGLCLEARPROC Clear;
+	PFNGLCLEARCOLORPROC ClearColor;
+	PFNGLCLEARSTENCILPROC ClearStencil;
+	PFNGLCLEARDEPTHPROC ClearDepth;
+	PFNGLSTENCILMASKPROC StencilMask;
+	PFNGLCOLORMASKPROC ColorMask;
+	PFNGLDEPTHMASKPROC DepthMask;
+	PFNGLDISABLEPROC Disable;
+	PFNGLENABLEPROC Enable;
+	PFNGLFINISHPROC Finish;
+	PFNGLFLUSHPROC Flush;
+	PFNGLBLENDFUNCPROC BlendFunc;
+	PFNGLLOGICOPPROC LogicOp;
+	PFNGLSTENCILFUNCPROC StencilFunc;
+	PFNGLSTENCILOPPROC StencilOp;
+	PFNGLDEPTHFUNCPROC DepthFunc;
+	PFNGLPIXELSTOREFPROC PixelStoref;
+	PFNGLPIXELSTOREIPROC PixelStorei;
+	PFNGLREADBUFFERPROC ReadBuffer;
+	PFNGLREADPIXELSPROC ReadPixels;
+	PFNGLGETBOOLEANVPROC GetBooleanv;
+	PFNGLGETDOUBLEVPROC GetDoublev;
+	PFNGLGETERRORPROC GetError;
+	PFNGLGETFLOATVPROC GetFloatv;
+	PFNGLGETINTEGERVPROC GetIntegerv;
+	PFNGLGETSTRINGPROC GetString;
+	PFNGLGETTEXIMAGEPROC GetTexImage;
+	PFNGLGETTEXPARAMETERFVPROC GetTexParameterfv;
+	PFNGLGETTEXPARAMETERIVPROC GetTexParameteriv;
+	PFNGLGETTEXLEVELPARAMETERFVPROC GetTexLevelParameterfv;
+	PFNGLGETTEXLEVELPARAMETERIVPROC GetTexLevelParameteriv;
+	PFNGLISENABLEDPROC IsEnabled;
+	PFNGLDEPTHRANGEPROC DepthRange;
+	PFNGLVIEWPORTPROC Viewport;
+	PFNGLDRAWARRAYSPROC DrawArrays;
+	PFNGLDRAWELEMENTSPROC DrawElements;
+	PFNGLGETPOINTERVPROC GetPointerv;
+	PFNGLPOLYGONOFFSETPROC PolygonOffset;
+	PFNGLCOPYTEXIMAGE1DPROC CopyTexImage1D;
+	PFNGLCOPYTEXIMAGE2DPROC CopyTexImage2D;
+	PFNGLCOPYTEXSUBIMAGE1DPROC CopyTexSubImage1D;
+	PFNGLCOPYTEXSUBIMAGE2DPROC CopyTexSubImage2D;
+	PFNGLTEXSUBIMAGE1DPROC TexSubImage1D;
+	PFNGLTEXSUBIMAGE2DPROC TexSubImage2D;
+	PFNGLBINDTEXTUREPROC BindTexture;
+	PFNGLDELETETEXTURESPROC DeleteTextures;
+	PFNGLGENTEXTURESPROC GenTextures;
+	PFNGLISTEXTUREPROC IsTexture;
+	PFNGLDRAWRANGEELEMENTSPROC DrawRangeElements;
+	PFNGLTEXIMAGE3DPROC TexImage3D;
+	PFNGLTEXSUBIMAGE3DPROC TexSubImage3D;
+	PFNGLCOPYTEXSUBIMAGE3DPROC CopyTexSubImage3D;
+	PFNGLACTIVETEXTUREPROC ActiveTexture;
+	PFNGLSAMPLECOVERAGEPROC SampleCoverage;
+	PFNGLCOMPRESSEDTEXIMAGE3DPROC CompressedTexImage3D;
+	PFNGLCOMPRESSEDTEXIMAGE2DPROC CompressedTexImage2D;
+	PFNGLCOMPRESSEDTEXIMAGE1DPROC CompressedTexImage1D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC CompressedTexSubImage3D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC CompressedTexSubImage2D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC CompressedTexSubImage1D;
+	PFNGLGETCOMPRESSEDTEXIMAGEPROC GetCompressedTexImage;
+	PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+	PFNGLMULTIDRAWARRAYSPROC MultiDrawArrays;
+	PFNGLMULTIDRAWELEMENTSPROC MultiDrawElements;
+	PFNGLPOINTPARAMETERFPROC PointParameterf;
+	PFNGLPOINTPARAMETERFVPROC PointParameterfv;
+	PFNGLPOINTPARAMETERIPROC PointParameteri;
+	PFNGLPOINTPARAMETERIVPROC PointParameteriv;
+	PFNGLBLENDCOLORPROC BlendColor;
+	PFNGLBLENDEQUATIONPROC BlendEquation;
+	PFNGLGENQUERIESPROC GenQueries;
+	PFNGLDELETEQUERIESPROC DeleteQueries;
+	PFNGLISQUERYPROC IsQuery;
+	PFNGLBEGINQUERYPROC BeginQuery;
+	PFNGLENDQUERYPROC EndQuery;
+	PFNGLGETQUERYIVPROC GetQueryiv;
+	PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+	PFNGLGETQUERYOBJECTUIVPROC GetQueryObjectuiv;
+	PFNGLBINDBUFFERPROC BindBuffer;
+	PFNGLDELETEBUFFERSPROC DeleteBuffers;
+	PFNGLGENBUFFERSPROC GenBuffers;
+	PFNGLISBUFFERPROC IsBuffer;
+	PFNGLBUFFERDATAPROC BufferData;
+	PFNGLBUFFERSUBDATAPROC BufferSubData;
+	PFNGLGETBUFFERSUBDATAPROC GetBufferSubData;
+	PFNGLMAPBUFFERPROC MapBuffer;
+	PFNGLUNMAPBUFFERPROC UnmapBuffer;
+	PFNGLGETBUFFERPARAMETERIVPROC GetBufferParameteriv;
+	PFNGLGETBUFFERPOINTERVPROC GetBufferPointerv;
+	PFNGLBLENDEQUATIONSEPARATEPROC BlendEquationSeparate;
+	PFNGLDRAWBUFFERSPROC DrawBuffers;
+	PFNGLSTENCILOPSEPARATEPROC StencilOpSeparate;
+	PFNGLSTENCILFUNCSEPARATEPROC StencilFuncSeparate;
+	PFNGLSTENCILMASKSEPARATEPROC StencilMaskSeparate;
+	PFNGLATTACHSHADERPROC AttachShader;
+	PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+	PFNGLCOMPILESHADERPROC CompileShader;
+	PFNGLCREATEPROGRAMPROC CreateProgram;
+	PFNGLCREATESHADERPROC CreateShader;
+	PFNGLDELETEPROGRAMPROC DeleteProgram;
+	PFNGLDELETESHADERPROC DeleteShader;
+	PFNGLDETACHSHADERPROC DetachShader;
+	PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+	PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+	PFNGLGETACTIVEATTRIBPROC GetActiveAttrib;
+	PFNGLGETACTIVEUNIFORMPROC GetActiveUniform;
+	PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+	PFNGLGETATTRIBLOCATIONPROC GetAttribLocation;
+	PFNGLGETPROGRAMIVPROC GetProgramiv;
+	PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+	PFNGLGETSHADERIVPROC GetShaderiv;
+	PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+	PFNGLGETSHADERSOURCEPROC GetShaderSource;
+	PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+	PFNGLGETUNIFORMFVPROC GetUniformfv;
+	PFNGLGETUNIFORMIVPROC GetUniformiv;
+	PFNGLGETVERTEXATTRIBDVPROC GetVertexAttribdv;
+	PFNGLGETVERTEXATTRIBFVPROC GetVertexAttribfv;
+	PFNGLGETVERTEXATTRIBIVPROC GetVertexAttribiv;
+	PFNGLGETVERTEXATTRIBPOINTERVPROC GetVertexAttribPointerv;
+	PFNGLISPROGRAMPROC IsProgram;
+	PFNGLISSHADERPROC IsShader;
+	PFNGLLINKPROGRAMPROC LinkProgram;
+	PFNGLSHADERSOURCEPROC ShaderSource;
+	PFNGLUSEPROGRAMPROC UseProgram;
+	PFNGLUNIFORM1FPROC Uniform1f;
+	PFNGLUNIFORM2FPROC Uniform2f;
+	PFNGLUNIFORM3FPROC Uniform3f;
+	PFNGLUNIFORM4FPROC Uniform4f;
+	PFNGLUNIFORM1IPROC Uniform1i;
+	PFNGLUNIFORM2IPROC Uniform2i;
+	PFNGLUNIFORM3IPROC Uniform3i;
+	PFNGLUNIFORM4IPROC Uniform4i;
+	PFNGLUNIFORM1FVPROC Uniform1fv;
+	PFNGLUNIFORM2FVPROC Uniform2fv;
+	PFNGLUNIFORM3FVPROC Uniform3fv;
+	PFNGLUNIFORM4FVPROC Uniform4fv;
+	PFNGLUNIFORM1IVPROC Uniform1iv;
+	PFNGLUNIFORM2IVPROC Uniform2iv;
+	PFNGLUNIFORM3IVPROC Uniform3iv;
+	PFNGLUNIFORM4IVPROC Uniform4iv;
+	PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+	PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+	PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+	PFNGLVALIDATEPROGRAMPROC ValidateProgram;
+	PFNGLVERTEXATTRIB1DPROC VertexAttrib1d;
+	PFNGLVERTEXATTRIB1DVPROC VertexAttrib1dv;
+	PFNGLVERTEXATTRIB1FPROC VertexAttrib1f;
+	PFNGLVERTEXATTRIB1FVPROC VertexAttrib1fv;
+	PFNGLVERTEXATTRIB1SPROC VertexAttrib1s;
+	PFNGLVERTEXATTRIB1SVPROC VertexAttrib1sv;
+	PFNGLVERTEXATTRIB2DPROC VertexAttrib2d;
+	PFNGLVERTEXATTRIB2DVPROC VertexAttrib2dv;
+	PFNGLVERTEXATTRIB2FPROC VertexAttrib2f;
+	PFNGLVERTEXATTRIB2FVPROC VertexAttrib2fv;
+	PFNGLVERTEXATTRIB2SPROC VertexAttrib2s;
+	PFNGLVERTEXATTRIB2SVPROC VertexAttrib2sv;
+	PFNGLVERTEXATTRIB3DPROC VertexAttrib3d;
+	PFNGLVERTEXATTRIB3DVPROC VertexAttrib3dv;
+	PFNGLVERTEXATTRIB3FPROC VertexAttrib3f;
+	PFNGLVERTEXATTRIB3FVPROC VertexAttrib3fv;
+	PFNGLVERTEXATTRIB3SPROC VertexAttrib3s;
+	PFNGLVERTEXATTRIB3SVPROC VertexAttrib3sv;
+	PFNGLVERTEXATTRIB4NBVPROC VertexAttrib4Nbv;
+	PFNGLVERTEXATTRIB4NIVPROC VertexAttrib4Niv;
+	PFNGLVERTEXATTRIB4NSVPROC VertexAttrib4Nsv;
+	PFNGLVERTEXATTRIB4NUBPROC VertexAttrib4Nub;
+	PFNGLVERTEXATTRIB4NUBVPROC VertexAttrib4Nubv;
+	PFNGLVERTEXATTRIB4NUIVPROC VertexAttrib4Nuiv;
+	PFNGLVERTEXATTRIB4NUSVPROC VertexAttrib4Nusv;
+	PFNGLVERTEXATTRIB4BVPROC VertexAttrib4bv;
+	PFNGLVERTEXATTRIB4DPROC VertexAttrib4d;
+	PFNGLVERTEXATTRIB4DVPROC VertexAttrib4dv;
+	PFNGLVERTEXATTRIB4FPROC VertexAttrib4f;
+	PFNGLVERTEXATTRIB4FVPROC VertexAttrib4fv;
+	PFNGLVERTEXATTRIB4IVPROC VertexAttrib4iv;
+	PFNGLVERTEXATTRIB4SPROC VertexAttrib4s;
+	PFNGLVERTEXATTRIB4SVPROC VertexAttrib4sv;
+	PFNGLVERTEXATTRIB4UBVPROC VertexAttrib4ubv;
+	PFNGLVERTEXATTRIB4UIVPROC VertexAttrib4uiv;
+	PFNGLVERTEXATTRIB4USVPROC VertexAttrib4usv;
+	PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+	PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+	PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+	PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+	PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+	PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+	PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+	PFNGLCOLORMASKIPROC ColorMaski;
+	PFNGLGETBOOLEANI_VPROC GetBooleani_v;
+	PFNGLGETINTEGERI_VPROC GetIntegeri_v;
+	PFNGLENABLEIPROC Enablei;
+	PFNGLDISABLEIPROC Disablei;
+	PFNGLISENABLEDIPROC IsEnabledi;
+	PFNGLBEGINTRANSFORMFEEDBACKPROC BeginTransformFeedback;
+	PFNGLENDTRANSFORMFEEDBACKPROC EndTransformFeedback;
+	PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+	PFNGLBINDBUFFERBASEPROC BindBufferBase;
+	PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+	PFNGLGETTRANSFORMFEEDBACKVARYINGPROC GetTransformFeedbackVarying;
+	PFNGLCLAMPCOLORPROC ClampColor;
+	PFNGLBEGINCONDITIONALRENDERPROC BeginConditionalRender;
+	PFNGLENDCONDITIONALRENDERPROC EndConditionalRender;
+	PFNGLVERTEXATTRIBIPOINTERPROC VertexAttribIPointer;
+	PFNGLGETVERTEXATTRIBIIVPROC GetVertexAttribIiv;
+	PFNGLGETVERTEXATTRIBIUIVPROC GetVertexAttribIuiv;
+	PFNGLVERTEXATTRIBI1IPROC VertexAttribI1i;
+	PFNGLVERTEXATTRIBI2IPROC VertexAttribI2i;
+	PFNGLVERTEXATTRIBI3IPROC VertexAttribI3i;
+	PFNGLVERTEXATTRIBI4IPROC VertexAttribI4i;
+	PFNGLVERTEXATTRIBI1UIPROC VertexAttribI1ui;
+	PFNGLVERTEXATTRIBI2UIPROC VertexAttribI2ui;
+	PFNGLVERTEXATTRIBI3UIPROC VertexAttribI3ui;
+	PFNGLVERTEXATTRIBI4UIPROC VertexAttribI4ui;
+	PFNGLVERTEXATTRIBI1IVPROC VertexAttribI1iv;
+	PFNGLVERTEXATTRIBI2IVPROC VertexAttribI2iv;
+	PFNGLVERTEXATTRIBI3IVPROC VertexAttribI3iv;
+	PFNGLVERTEXATTRIBI4IVPROC VertexAttribI4iv;
+	PFNGLVERTEXATTRIBI1UIVPROC VertexAttribI1uiv;
+	PFNGLVERTEXATTRIBI2UIVPROC VertexAttribI2uiv;
+	PFNGLVERTEXATTRIBI3UIVPROC VertexAttribI3uiv;
+	PFNGLVERTEXATTRIBI4UIVPROC VertexAttribI4uiv;
+	PFNGLVERTEXATTRIBI4BVPROC VertexAttribI4bv;
+	PFNGLVERTEXATTRIBI4SVPROC VertexAttribI4sv;
+	PFNGLVERTEXATTRIBI4UBVPROC VertexAttribI4ubv;
+	PFNGLVERTEXATTRIBI4USVPROC VertexAttribI4usv;
+	PFNGLGETUNIFORMUIVPROC GetUniformuiv;
+	PFNGLBINDFRAGDATALOCATIONPROC BindFragDataLocation;
+	PFNGLGETFRAGDATALOCATIONPROC GetFragDataLocation;
+	PFNGLUNIFORM1UIPROC Uniform1ui;
+	PFNGLUNIFORM2UIPROC Uniform2ui;
+	PFNGLUNIFORM3UIPROC Uniform3ui;
+	PFNGLUNIFORM4UIPROC Uniform4ui;
+	PFNGLUNIFORM1UIVPROC Uniform1uiv;
+	PFNGLUNIFORM2UIVPROC Uniform2uiv;
+	PFNGLUNIFORM3UIVPROC Uniform3uiv;
+	PFNGLUNIFORM4UIVPROC Uniform4uiv;
+	PFNGLTEXPARAMETERIIVPROC TexParameterIiv;
+	PFNGLTEXPARAMETERIUIVPROC TexParameterIuiv;
+	PFNGLGETTEXPARAMETERIIVPROC GetTexParameterIiv;
+	PFNGLGETTEXPARAMETERIUIVPROC GetTexParameterIuiv;
+	PFNGLCLEARBUFFERIVPROC ClearBufferiv;
+	PFNGLCLEARBUFFERUIVPROC ClearBufferuiv;
+	PFNGLCLEARBUFFERFVPROC ClearBufferfv;
+	PFNGLCLEARBUFFERFIPROC ClearBufferfi;
+	PFNGLGETSTRINGIPROC GetStringi;
+	PFNGLISRENDERBUFFERPROC IsRenderbuffer;
+	PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+	PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+	PFNGLGENRENDERBUFFERSPROC GenRenderbuffers;
+	PFNGLRENDERBUFFERSTORAGEPROC RenderbufferStorage;
+	PFNGLGETRENDERBUFFERPARAMETERIVPROC GetRenderbufferParameteriv;
+	PFNGLISFRAMEBUFFERPROC IsFramebuffer;
+	PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+	PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+	PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+	PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+	PFNGLFRAMEBUFFERTEXTURE1DPROC FramebufferTexture1D;
+	PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+	PFNGLFRAMEBUFFERTEXTURE3DPROC FramebufferTexture3D;
+	PFNGLFRAMEBUFFERRENDERBUFFERPROC FramebufferRenderbuffer;
+	PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetFramebufferAttachmentParameteriv;
+	PFNGLGENERATEMIPMAPPROC GenerateMipmap;
+	PFNGLBLITFRAMEBUFFERPROC BlitFramebuffer;
+	PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC RenderbufferStorageMultisample;
+	PFNGLFRAMEBUFFERTEXTURELAYERPROC FramebufferTextureLayer;
+	PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+	PFNGLFLUSHMAPPEDBUFFERRANGEPROC FlushMappedBufferRange;
+	PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+	PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+	PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+	PFNGLISVERTEXARRAYPROC IsVertexArray;
+	PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+	PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+	PFNGLTEXBUFFERPROC TexBuffer;
+	PFNGLPRIMITIVERESTARTINDEXPROC PrimitiveRestartIndex;
+	PFNGLCOPYBUFFERSUBDATAPROC CopyBufferSubData;
+	PFNGLGETUNIFORMINDICESPROC GetUniformIndices;
+	PFNGLGETACTIVEUNIFORMSIVPROC GetActiveUniformsiv;
+	PFNGLGETACTIVEUNIFORMNAMEPROC GetActiveUniformName;
+	PFNGLGETUNIFORMBLOCKINDEXPROC GetUniformBlockIndex;
+	PFNGLGETACTIVEUNIFORMBLOCKIVPROC GetActiveUniformBlockiv;
+	PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC GetActiveUniformBlockName;
+	PFNGLUNIFORMBLOCKBINDINGPROC UniformBlockBinding;
+	PFNGLDRAWELEMENTSBASEVERTEXPROC DrawElementsBaseVertex;
+	PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC DrawRangeElementsBaseVertex;
+	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC DrawElementsInstancedBaseVertex;
+	PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC MultiDrawElementsBaseVertex;
+	PFNGLPROVOKINGVERTEXPROC ProvokingVertex;
+	PFNGLFENCESYNCPROC FenceSync;
+	PFNGLISSYNCPROC IsSync;
+	PFNGLDELETESYNCPROC DeleteSync;
+	PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+	PFNGLWAITSYNCPROC WaitSync;
+	PFNGLGETINTEGER64VPROC GetInteger64v;
+	PFNGLGETSYNCIVPROC GetSynciv;
+	PFNGLGETINTEGER64I_VPROC GetInteger64i_v;
+	PFNGLGETBUFFERPARAMETERI64VPROC GetBufferParameteri64v;
+	PFNGLFRAMEBUFFERTEXTUREPROC FramebufferTexture;
+	PFNGLTEXIMAGE2DMULTISAMPLEPROC TexImage2DMultisample;
+	PFNGLTEXIMAGE3DMULTISAMPLEPROC TexImage3DMultisample;
+	PFNGLGETMULTISAMPLEFVPROC GetMultisamplefv;
+	PFNGLSAMPLEMASKIPROC SampleMaski;
+	PFNGLBINDFRAGDATALOCATIONINDEXEDPROC BindFragDataLocationIndexed;
+	PFNGLGETFRAGDATAINDEXPROC GetFragDataIndex;
+	PFNGLGENSAMPLERSPROC GenSamplers;
+	PFNGLDELETESAMPLERSPROC DeleteSamplers;
+	PFNGLISSAMPLERPROC IsSampler;
+	PFNGLBINDSAMPLERPROC BindSampler;
+	PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+	PFNGLSAMPLERPARAMETERIVPROC SamplerParameteriv;
+	PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+	PFNGLSAMPLERPARAMETERFVPROC SamplerParameterfv;
+	PFNGLSAMPLERPARAMETERIIVPROC SamplerParameterIiv;
+	PFNGLSAMPLERPARAMETERIUIVPROC SamplerParameterIuiv;
+	PFNGLGETSAMPLERPARAMETERIVPROC GetSamplerParameteriv;
+	PFNGLGETSAMPLERPARAMETERIIVPROC GetSamplerParameterIiv;
+	PFNGLGETSAMPLERPARAMETERFVPROC GetSamplerParameterfv;
+	PFNGLGETSAMPLERPARAMETERIUIVPROC GetSamplerParameterIuiv;
+	PFNGLQUERYCOUNTERPROC QueryCounter;
+	PFNGLGETQUERYOBJECTI64VPROC GetQueryObjecti64v;
+	PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+	PFNGLVERTEXATTRIBDIVISORPROC VertexAttribDivisor;
+	PFNGLVERTEXATTRIBP1UIPROC VertexAttribP1ui;
+	PFNGLVERTEXATTRIBP1UIVPROC VertexAttribP1uiv;
+	PFNGLVERTEXATTRIBP2UIPROC VertexAttribP2ui;
+	PFNGLVERTEXATTRIBP2UIVPROC VertexAttribP2uiv;
+	PFNGLVERTEXATTRIBP3UIPROC VertexAttribP3ui;
+	PFNGLVERTEXATTRIBP3UIVPROC VertexAttribP3uiv;
+	PFNGLVERTEXATTRIBP4UIPROC VertexAttribP4ui;
+	PFNGLVERTEXATTRIBP4UIVPROC VertexAttribP4uiv;
+	PFNGLGETPROGRAMBINARYPROC GetProgramBinary;
+	PFNGLPROGRAMBINARYPROC ProgramBinary;
+	PFNGLPROGRAMPARAMETERIPROC ProgramParameteri;
+	PFNGLMAXSHADERCOMPILERTHREADSKHRPROC MaxShaderCompilerThreadsKHR;
+	PFNGLBUFFERSTORAGEPROC BufferStorage;
+};
+#ifdef GLAD_PER_CONTEXT
+/* One table per GL context, together with the version, extension flags and loader state that
+   belong to it. glad_gl_context is thread-local: a thread makes its table current alongside its
+   GL context, and every gl* call on that thread goes through it, so contexts on different
+   threads (or different drivers) never share function pointers. gladLoadGLLoader fills the
+   current table, creating one first if the thread has none. */
+#if defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define GLAD_THREAD_LOCAL __thread
+#elif defined(__cplusplus)
+#define GLAD_THREAD_LOCAL thread_local
+#else
+#define GLAD_THREAD_LOCAL _Thread_local
+#endif
+struct gladGLcontext {
+	struct gladGLdispatchStruct gl;
+	struct gladGLversionStruct version;
+	int VERSION_1_0;
+	int VERSION_1_1;
+	int VERSION_1_2;
+	int VERSION_1_3;
+	int VERSION_1_4;
+	int VERSION_1_5;
+	int VERSION_2_0;
+	int VERSION_2_1;
+	int VERSION_3_0;
+	int VERSION_3_1;
+	int VERSION_3_2;
+	int VERSION_3_3;
+	int ARB_get_program_binary;
+	int KHR_parallel_shader_compile;
+	int ARB_buffer_storage;
+	/* Loader state, only used by glad.c */
+	int max_loaded_major;
+	int max_loaded_minor;
+	char *exts_arena;
+	unsigned int *exts_table;
+	unsigned int exts_mask;
+	GLADloadproc lazy_loader;
+	void *lazy_resolved[GLAD_GL_FUNCTION_COUNT];
+#ifdef GLAD_CALL_HOOKS
+	void *hook_real[GLAD_GL_FUNCTION_COUNT];
+#endif
+};
+GLAPI GLAD_THREAD_LOCAL struct gladGLcontext *glad_gl_context;
+#define glad_gl (glad_gl_context->gl)
+#define GLVersion (glad_gl_context->version)
+#define GLAD_GL_VERSION_1_0 (glad_gl_context->VERSION_1_0)
+#define GLAD_GL_VERSION_1_1 (glad_gl_context->VERSION_1_1)
+#define GLAD_GL_VERSION_1_2 (glad_gl_context->VERSION_1_2)
+#define GLAD_GL_VERSION_1_3 (glad_gl_context->VERSION_1_3)
+#define GLAD_GL_VERSION_1_4 (glad_gl_context->VERSION_1_4)
+#define GLAD_GL_VERSION_1_5 (glad_gl_context->VERSION_1_5)
+#define GLAD_GL_VERSION_2_0 (glad_gl_context->VERSION_2_0)
+#define GLAD_GL_VERSION_2_1 (glad_gl_context->VERSION_2_1)
+#define GLAD_GL_VERSION_3_0 (glad_gl_context->VERSION_3_0)
+#define GLAD_GL_VERSION_3_1 (glad_gl_context->VERSION_3_1)
+#define GLAD_GL_VERSION_3_2 (glad_gl_context->VERSION_3_2)
+#define GLAD_GL_VERSION_3_3 (glad_gl_context->VERSION_3_3)
+#define GLAD_GL_ARB_get_program_binary (glad_gl_context->ARB_get_program_binary)
+#define GLAD_GL_KHR_parallel_shader_compile (glad_gl_context->KHR_parallel_shader_compile)
+#define GLAD_GL_ARB_buffer_storage (glad_gl_context->ARB_buffer_storage)
+#else
+GLAPI struct gladGLdispatchStruct glad_gl;
+#endif
+#define glad_glCullFace glad_gl.CullFace
+#define glad_glFrontFace glad_gl.FrontFace
+#define glad_glHint glad_gl.Hint
+#define glad_glLineWidth glad_gl.LineWidth
+#define glad_glPointSize glad_gl.PointSize
+#define glad_glPolygonMode glad_gl.PolygonMode
+#define glad_glScissor glad_gl.Scissor
+#define glad_glTexParameterf glad_gl.TexParameterf
+#define glad_glTexParameterfv glad_gl.TexParameterfv
+#define glad_glTexParameteri glad_gl.TexParameteri
+#define glad_glTexParameteriv glad_gl.TexParameteriv
+#define glad_glTexImage1D glad_gl.TexImage1D
+#define glad_glTexImage2D glad_gl.TexImage2D
+#define glad_glDrawBuffer glad_gl.DrawBuffer
+#define glad_glClear glad_gl.Clear
+#define glad_glClearColor glad_gl.ClearColor
+#define glad_glClearStencil glad_gl.ClearStencil
+#define glad_glClearDepth glad_gl.ClearDepth
+#define glad_glStencilMask glad_gl.StencilMask
+#define glad_glColorMask glad_gl.ColorMask
+#define glad_glDepthMask glad_gl.DepthMask
+#define glad_glDisable glad_gl.Disable
+#define glad_glEnable glad_gl.Enable
+#define glad_glFinish glad_gl.Finish
+#define glad_glFlush glad_gl.Flush
+#define glad_glBlendFunc glad_gl.BlendFunc
+#define glad_glLogicOp glad_gl.LogicOp
+#define glad_glStencilFunc glad_gl.StencilFunc
+#define glad_glStencilOp glad_gl.StencilOp
+#define glad_glDepthFunc glad_gl.DepthFunc
+#define glad_glPixelStoref glad_gl.PixelStoref
+#define glad_glPixelStorei glad_gl.PixelStorei
+#define glad_glReadBuffer glad_gl.ReadBuffer
+#define glad_glReadPixels glad_gl.ReadPixels
+#define glad_glGetBooleanv glad_gl.GetBooleanv
+#define glad_glGetDoublev glad_gl.GetDoublev
+#define glad_glGetError glad_gl.GetError
+#define glad_glGetFloatv glad_gl.GetFloatv
+#define glad_glGetIntegerv glad_gl.GetIntegerv
+#define glad_glGetString glad_gl.GetString
+#define glad_glGetTexImage glad_gl.GetTexImage
+#define glad_glGetTexParameterfv glad_gl.GetTexParameterfv
+#define glad_glGetTexParameteriv glad_gl.GetTexParameteriv
+#define glad_glGetTexLevelParameterfv glad_gl.GetTexLevelParameterfv
+#define glad_glGetTexLevelParameteriv glad_gl.GetTexLevelParameteriv
+#define glad_glIsEnabled glad_gl.IsEnabled
+#define glad_glDepthRange glad_gl.DepthRange
+#define glad_glViewport glad_gl.Viewport
+#define glad_glDrawArrays glad_gl.DrawArrays
+#define glad_glDrawElements glad_gl.DrawElements
+#define glad_glGetPointerv glad_gl.GetPointerv
+#define glad_glPolygonOffset glad_gl.PolygonOffset
+#define glad_glCopyTexImage1D glad_gl.CopyTexImage1D
+#define glad_glCopyTexImage2D glad_gl.CopyTexImage2D
+#define glad_glCopyTexSubImage1D glad_gl.CopyTexSubImage1D
+#define glad_glCopyTexSubImage2D glad_gl.CopyTexSubImage2D
+#define glad_glTexSubImage1D glad_gl.TexSubImage1D
+#define glad_glTexSubImage2D glad_gl.TexSubImage2D
+#define glad_glBindTexture glad_gl.BindTexture
+#define glad_glDeleteTextures glad_gl.DeleteTextures
+#define glad_glGenTextures glad_gl.GenTextures
+#define glad_glIsTexture glad_gl.IsTexture
+#define glad_glDrawRangeElements glad_gl.DrawRangeElements
+#define glad_glTexImage3D glad_gl.TexImage3D
+#define glad_glTexSubImage3D glad_gl.TexSubImage3D
+#define glad_glCopyTexSubImage3D glad_gl.CopyTexSubImage3D
+#define glad_glActiveTexture glad_gl.ActiveTexture
+#define glad_glSampleCoverage glad_gl.SampleCoverage
+#define glad_glCompressedTexImage3D glad_gl.CompressedTexImage3D
+#define glad_glCompressedTexImage2D glad_gl.CompressedTexImage2D
+#define glad_glCompressedTexImage1D glad_gl.CompressedTexImage1D
+#define glad_glCompressedTexSubImage3D glad_gl.CompressedTexSubImage3D
+#define glad_glCompressedTexSubImage2D glad_gl.CompressedTexSubImage2D
+#define glad_glCompressedTexSubImage1D glad_gl.CompressedTexSubImage1D
+#define glad_glGetCompressedTexImage glad_gl.GetCompressedTexImage
+#define glad_glBlendFuncSeparate glad_gl.BlendFuncSeparate
+#define glad_glMultiDrawArrays glad_gl.MultiDrawArrays
+#define glad_glMultiDrawElements glad_gl.MultiDrawElements
+#define glad_glPointParameterf glad_gl.PointParameterf
+#define glad_glPointParameterfv glad_gl.PointParameterfv
+#define glad_glPointParameteri glad_gl.PointParameteri
+#define glad_glPointParameteriv glad_gl.PointParameteriv
+#define glad_glBlendColor glad_gl.BlendColor
+#define glad_glBlendEquation glad_gl.BlendEquation
+#define glad_glGenQueries glad_gl.GenQueries
+#define glad_glDeleteQueries glad_gl.DeleteQueries
+#define glad_glIsQuery glad_gl.IsQuery
+#define glad_glBeginQuery glad_gl.BeginQuery
+#define glad_glEndQuery glad_gl.EndQuery
+#define glad_glGetQueryiv glad_gl.GetQueryiv
+#define glad_glGetQueryObjectiv glad_gl.GetQueryObjectiv
+#define glad_glGetQueryObjectuiv glad_gl.GetQueryObjectuiv
+#define glad_glBindBuffer glad_gl.BindBuffer
+#define glad_glDeleteBuffers glad_gl.DeleteBuffers
+#define glad_glGenBuffers glad_gl.GenBuffers
+#define glad_glIsBuffer glad_gl.IsBuffer
+#define glad_glBufferData glad_gl.BufferData
+#define glad_glBufferSubData glad_gl.BufferSubData
+#define glad_glGetBufferSubData glad_gl.GetBufferSubData
+#define glad_glMapBuffer glad_gl.MapBuffer
+#define glad_glUnmapBuffer glad_gl.UnmapBuffer
+#define glad_glGetBufferParameteriv glad_gl.GetBufferParameteriv
+#define glad_glGetBufferPointerv glad_gl.GetBufferPointerv
+#define glad_glBlendEquationSeparate glad_gl.BlendEquationSeparate
+#define glad_glDrawBuffers glad_gl.DrawBuffers
+#define glad_glStencilOpSeparate glad_gl.StencilOpSeparate
+#define glad_glStencilFuncSeparate glad_gl.StencilFuncSeparate
+#define glad_glStencilMaskSeparate glad_gl.StencilMaskSeparate
+#define glad_glAttachShader glad_gl.AttachShader
+#define glad_glBindAttribLocation glad_gl.BindAttribLocation
+#define glad_glCompileShader glad_gl.CompileShader
+#define glad_glCreateProgram glad_gl.CreateProgram
+#define glad_glCreateShader glad_gl.CreateShader
+#define glad_glDeleteProgram glad_gl.DeleteProgram
+#define glad_glDeleteShader glad_gl.DeleteShader
+#define glad_glDetachShader glad_gl.DetachShader
+#define glad_glDisableVertexAttribArray glad_gl.DisableVertexAttribArray
+#define glad_glEnableVertexAttribArray glad_gl.EnableVertexAttribArray
+#define glad_glGetActiveAttrib glad_gl.GetActiveAttrib
+#define glad_glGetActiveUniform glad_gl.GetActiveUniform
+#define glad_glGetAttachedShaders glad_gl.GetAttachedShaders
+#define glad_glGetAttribLocation glad_gl.GetAttribLocation
+#define glad_glGetProgramiv glad_gl.GetProgramiv
+#define glad_glGetProgramInfoLog glad_gl.GetProgramInfoLog
+#define glad_glGetShaderiv glad_gl.GetShaderiv
+#define glad_glGetShaderInfoLog glad_gl.GetShaderInfoLog
+#define glad_glGetShaderSource glad_gl.GetShaderSource
+#define glad_glGetUniformLocation glad_gl.GetUniformLocation
+#define glad_glGetUniformfv glad_gl.GetUniformfv
+#define glad_glGetUniformiv glad_gl.GetUniformiv
+#define glad_glGetVertexAttribdv glad_gl.GetVertexAttribdv
+#define glad_glGetVertexAttribfv glad_gl.GetVertexAttribfv
+#define glad_glGetVertexAttribiv glad_gl.GetVertexAttribiv
+#define glad_glGetVertexAttribPointerv glad_gl.GetVertexAttribPointerv
+#define glad_glIsProgram glad_gl.IsProgram
+#define glad_glIsShader glad_gl.IsShader
+#define glad_glLinkProgram glad_gl.LinkProgram
+#define glad_glShaderSource glad_gl.ShaderSource
+#define glad_glUseProgram glad_gl.UseProgram
+#define glad_glUniform1f glad_gl.Uniform1f
+#define glad_glUniform2f glad_gl.Uniform2f
+#define glad_glUniform3f glad_gl.Uniform3f
+#define glad_glUniform4f glad_gl.Uniform4f
+#define glad_glUniform1i glad_gl.Uniform1i
+#define glad_glUniform2i glad_gl.Uniform2i
+#define glad_glUniform3i glad_gl.Uniform3i
+#define glad_glUniform4i glad_gl.Uniform4i
+#define glad_glUniform1fv glad_gl.Uniform1fv
+#define glad_glUniform2fv glad_gl.Uniform2fv
+#define glad_glUniform3fv glad_gl.Uniform3fv
+#define glad_glUniform4fv glad_gl.Uniform4fv
+#define glad_glUniform1iv glad_gl.Uniform1iv
+#define glad_glUniform2iv glad_gl.Uniform2iv
+#define glad_glUniform3iv glad_gl.Uniform3iv
+#define glad_glUniform4iv glad_gl.Uniform4iv
+#define glad_glUniformMatrix2fv glad_gl.UniformMatrix2fv
+#define glad_glUniformMatrix3fv glad_gl.UniformMatrix3fv
+#define glad_glUniformMatrix4fv glad_gl.UniformMatrix4fv
+#define glad_glValidateProgram glad_gl.ValidateProgram
+#define glad_glVertexAttrib1d glad_gl.VertexAttrib1d
+#define glad_glVertexAttrib1dv glad_gl.VertexAttrib1dv
+#define glad_glVertexAttrib1f glad_gl.VertexAttrib1f
+#define glad_glVertexAttrib1fv glad_gl.VertexAttrib1fv
+#define glad_glVertexAttrib1s glad_gl.VertexAttrib1s
+#define glad_glVertexAttrib1sv glad_gl.VertexAttrib1sv
+#define glad_glVertexAttrib2d glad_gl.VertexAttrib2d
+#define glad_glVertexAttrib2dv glad_gl.VertexAttrib2dv
+#define glad_glVertexAttrib2f glad_gl.VertexAttrib2f
+#define glad_glVertexAttrib2fv glad_gl.VertexAttrib2fv
+#define glad_glVertexAttrib2s glad_gl.VertexAttrib2s
+#define glad_glVertexAttrib2sv glad_gl.VertexAttrib2sv
+#define glad_glVertexAttrib3d glad_gl.VertexAttrib3d
+#define glad_glVertexAttrib3dv glad_gl.VertexAttrib3dv
+#define glad_glVertexAttrib3f glad_gl.VertexAttrib3f
+#define glad_glVertexAttrib3fv glad_gl.VertexAttrib3fv
+#define glad_glVertexAttrib3s glad_gl.VertexAttrib3s
+#define glad_glVertexAttrib3sv glad_gl.VertexAttrib3sv
+#define glad_glVertexAttrib4Nbv glad_gl.VertexAttrib4Nbv
+#define glad_glVertexAttrib4Niv glad_gl.VertexAttrib4Niv
+#define glad_glVertexAttrib4Nsv glad_gl.VertexAttrib4Nsv
+#define glad_glVertexAttrib4Nub glad_gl.VertexAttrib4Nub
+#define glad_glVertexAttrib4Nubv glad_gl.VertexAttrib4Nubv
+#define glad_glVertexAttrib4Nuiv glad_gl.VertexAttrib4Nuiv
+#define glad_glVertexAttrib4Nusv glad_gl.VertexAttrib4Nusv
+#define glad_glVertexAttrib4bv glad_gl.VertexAttrib4bv
+#define glad_glVertexAttrib4d glad_gl.VertexAttrib4d
+#define glad_glVertexAttrib4dv glad_gl.VertexAttrib4dv
+#define glad_glVertexAttrib4f glad_gl.VertexAttrib4f
+#define glad_glVertexAttrib4fv glad_gl.VertexAttrib4fv
+#define glad_glVertexAttrib4iv glad_gl.VertexAttrib4iv
+#define glad_glVertexAttrib4s glad_gl.VertexAttrib4s
+#define glad_glVertexAttrib4sv glad_gl.VertexAttrib4sv
+#define glad_glVertexAttrib4ubv glad_gl.VertexAttrib4ubv
+#define glad_glVertexAttrib4uiv glad_gl.VertexAttrib4uiv
+#define glad_glVertexAttrib4usv glad_gl.VertexAttrib4usv
+#define glad_glVertexAttribPointer glad_gl.VertexAttribPointer
+#define glad_glUniformMatrix2x3fv glad_gl.UniformMatrix2x3fv
+#define glad_glUniformMatrix3x2fv glad_gl.UniformMatrix3x2fv
+#define glad_glUniformMatrix2x4fv glad_gl.UniformMatrix2x4fv
+#define glad_glUniformMatrix4x2fv glad_gl.UniformMatrix4x2fv
+#define glad_glUniformMatrix3x4fv glad_gl.UniformMatrix3x4fv
+#define glad_glUniformMatrix4x3fv glad_gl.UniformMatrix4x3fv
+#define glad_glColorMaski glad_gl.ColorMaski
+#define glad_glGetBooleani_v glad_gl.GetBooleani_v
+#define glad_glGetIntegeri_v glad_gl.GetIntegeri_v
+#define glad_glEnablei glad_gl.Enablei
+#define glad_glDisablei glad_gl.Disablei
+#define glad_glIsEnabledi glad_gl.IsEnabledi
+#define glad_glBeginTransformFeedback glad_gl.BeginTransformFeedback
+#define glad_glEndTransformFeedback glad_gl.EndTransformFeedback
+#define glad_glBindBufferRange glad_gl.BindBufferRange
+#define glad_glBindBufferBase glad_gl.BindBufferBase
+#define glad_glTransformFeedbackVaryings glad_gl.TransformFeedbackVaryings
+#define glad_glGetTransformFeedbackVarying glad_gl.GetTransformFeedbackVarying
+#define glad_glClampColor glad_gl.ClampColor
+#define glad_glBeginConditionalRender glad_gl.BeginConditionalRender
+#define glad_glEndConditionalRender glad_gl.EndConditionalRender
+#define glad_glVertexAttribIPointer glad_gl.VertexAttribIPointer
+#define glad_glGetVertexAttribIiv glad_gl.GetVertexAttribIiv
+#define glad_glGetVertexAttribIuiv glad_gl.GetVertexAttribIuiv
+#define glad_glVertexAttribI1i glad_gl.VertexAttribI1i
+#define glad_glVertexAttribI2i glad_gl.VertexAttribI2i
+#define glad_glVertexAttribI3i glad_gl.VertexAttribI3i
+#define glad_glVertexAttribI4i glad_gl.VertexAttribI4i
+#define glad_glVertexAttribI1ui glad_gl.VertexAttribI1ui
+#define glad_glVertexAttribI2ui glad_gl.VertexAttribI2ui
+#define glad_glVertexAttribI3ui glad_gl.VertexAttribI3ui
+#define glad_glVertexAttribI4ui glad_gl.VertexAttribI4ui
+#define glad_glVertexAttribI1iv glad_gl.VertexAttribI1iv
+#define glad_glVertexAttribI2iv glad_gl.VertexAttribI2iv
+#define glad_glVertexAttribI3iv glad_gl.VertexAttribI3iv
+#define glad_glVertexAttribI4iv glad_gl.VertexAttribI4iv
+#define glad_glVertexAttribI1uiv glad_gl.VertexAttribI1uiv
+#define glad_glVertexAttribI2uiv glad_gl.VertexAttribI2uiv
+#define glad_glVertexAttribI3uiv glad_gl.VertexAttribI3uiv
+#define glad_glVertexAttribI4uiv glad_gl.VertexAttribI4uiv
+#define glad_glVertexAttribI4bv glad_gl.VertexAttribI4bv
+#define glad_glVertexAttribI4sv glad_gl.VertexAttribI4sv
+#define glad_glVertexAttribI4ubv glad_gl.VertexAttribI4ubv
+#define glad_glVertexAttribI4usv glad_gl.VertexAttribI4usv
+#define glad_glGetUniformuiv glad_gl.GetUniformuiv
+#define glad_glBindFragDataLocation glad_gl.BindFragDataLocation
+#define glad_glGetFragDataLocation glad_gl.GetFragDataLocation
+#define glad_glUniform1ui glad_gl.Uniform1ui
+#define glad_glUniform2ui glad_gl.Uniform2ui
+#define glad_glUniform3ui glad_gl.Uniform3ui
+#define glad_glUniform4ui glad_gl.Uniform4ui
+#define glad_glUniform1uiv glad_gl.Uniform1uiv
+#define glad_glUniform2uiv glad_gl.Uniform2uiv
+#define glad_glUniform3uiv glad_gl.Uniform3uiv
+#define glad_glUniform4uiv glad_gl.Uniform4uiv
+#define glad_glTexParameterIiv glad_gl.TexParameterIiv
+#define glad_glTexParameterIuiv glad_gl.TexParameterIuiv
+#define glad_glGetTexParameterIiv glad_gl.GetTexParameterIiv
+#define glad_glGetTexParameterIuiv glad_gl.GetTexParameterIuiv
+#define glad_glClearBufferiv glad_gl.ClearBufferiv
+#define glad_glClearBufferuiv glad_gl.ClearBufferuiv
+#define glad_glClearBufferfv glad_gl.ClearBufferfv
+#define glad_glClearBufferfi glad_gl.ClearBufferfi
+#define glad_glGetStringi glad_gl.GetStringi
+#define glad_glIsRenderbuffer glad_gl.IsRenderbuffer
+#define glad_glBindRenderbuffer glad_gl.BindRenderbuffer
+#define glad_glDeleteRenderbuffers glad_gl.DeleteRenderbuffers
+#define glad_glGenRenderbuffers glad_gl.GenRenderbuffers
+#define glad_glRenderbufferStorage glad_gl.RenderbufferStorage
+#define glad_glGetRenderbufferParameteriv glad_gl.GetRenderbufferParameteriv
+#define glad_glIsFramebuffer glad_gl.IsFramebuffer
+#define glad_glBindFramebuffer glad_gl.BindFramebuffer
+#define glad_glDeleteFramebuffers glad_gl.DeleteFramebuffers
+#define glad_glGenFramebuffers glad_gl.GenFramebuffers
+#define glad_glCheckFramebufferStatus glad_gl.CheckFramebufferStatus
+#define glad_glFramebufferTexture1D glad_gl.FramebufferTexture1D
+#define glad_glFramebufferTexture2D glad_gl.FramebufferTexture2D
+#define glad_glFramebufferTexture3D glad_gl.FramebufferTexture3D
+#define glad_glFramebufferRenderbuffer glad_gl.FramebufferRenderbuffer
+#define glad_glGetFramebufferAttachmentParameteriv glad_gl.GetFramebufferAttachmentParameteriv
+#define glad_glGenerateMipmap glad_gl.GenerateMipmap
+#define glad_glBlitFramebuffer glad_gl.BlitFramebuffer
+#define glad_glRenderbufferStorageMultisample glad_gl.RenderbufferStorageMultisample
+#define glad_glFramebufferTextureLayer glad_gl.FramebufferTextureLayer
+#define glad_glMapBufferRange glad_gl.MapBufferRange
+#define glad_glFlushMappedBufferRange glad_gl.FlushMappedBufferRange
+#define glad_glBindVertexArray glad_gl.BindVertexArray
+#define glad_glDeleteVertexArrays glad_gl.DeleteVertexArrays
+#define glad_glGenVertexArrays glad_gl.GenVertexArrays
+#define glad_glIsVertexArray glad_gl.IsVertexArray
+#define glad_glDrawArraysInstanced glad_gl.DrawArraysInstanced
+#define glad_glDrawElementsInstanced glad_gl.DrawElementsInstanced
+#define glad_glTexBuffer glad_gl.TexBuffer
+#define glad_glPrimitiveRestartIndex glad_gl.PrimitiveRestartIndex
+#define glad_glCopyBufferSubData glad_gl.CopyBufferSubData
+#define glad_glGetUniformIndices glad_gl.GetUniformIndices
+#define glad_glGetActiveUniformsiv glad_gl.GetActiveUniformsiv
+#define glad_glGetActiveUniformName glad_gl.GetActiveUniformName
+#define glad_glGetUniformBlockIndex glad_gl.GetUniformBlockIndex
+#define glad_glGetActiveUniformBlockiv glad_gl.GetActiveUniformBlockiv
+#define glad_glGetActiveUniformBlockName glad_gl.GetActiveUniformBlockName
+#define glad_glUniformBlockBinding glad_gl.UniformBlockBinding
+#define glad_glDrawElementsBaseVertex glad_gl.DrawElementsBaseVertex
+#define glad_glDrawRangeElementsBaseVertex glad_gl.DrawRangeElementsBaseVertex
+#define glad_glDrawElementsInstancedBaseVertex glad_gl.DrawElementsInstancedBaseVertex
+#define glad_glMultiDrawElementsBaseVertex glad_gl.MultiDrawElementsBaseVertex
+#define glad_glProvokingVertex glad_gl.ProvokingVertex
+#define glad_glFenceSync glad_gl.FenceSync
+#define glad_glIsSync glad_gl.IsSync
+#define glad_glDeleteSync glad_gl.DeleteSync
+#define glad_glClientWaitSync glad_gl.ClientWaitSync
+#define glad_glWaitSync glad_gl.WaitSync
+#define glad_glGetInteger64v glad_gl.GetInteger64v
+#define glad_glGetSynciv glad_gl.GetSynciv
+#define glad_glGetInteger64i_v glad_gl.GetInteger64i_v
+#define glad_glGetBufferParameteri64v glad_gl.GetBufferParameteri64v
+#define glad_glFramebufferTexture glad_gl.FramebufferTexture
+#define glad_glTexImage2DMultisample glad_gl.TexImage2DMultisample
+#define glad_glTexImage3DMultisample glad_gl.TexImage3DMultisample
+#define glad_glGetMultisamplefv glad_gl.GetMultisamplefv
+#define glad_glSampleMaski glad_gl.SampleMaski
+#define glad_glBindFragDataLocationIndexed glad_gl.BindFragDataLocationIndexed
+#define glad_glGetFragDataIndex glad_gl.GetFragDataIndex
+#define glad_glGenSamplers glad_gl.GenSamplers
+#define glad_glDeleteSamplers glad_gl.DeleteSamplers
+#define glad_glIsSampler glad_gl.IsSampler
+#define glad_glBindSampler glad_gl.BindSampler
+#define glad_glSamplerParameteri glad_gl.SamplerParameteri
+#define glad_glSamplerParameteriv glad_gl.SamplerParameteriv
+#define glad_glSamplerParameterf glad_gl.SamplerParameterf
+#define glad_glSamplerParameterfv glad_gl.SamplerParameterfv
+#define glad_glSamplerParameterIiv glad_gl.SamplerParameterIiv
+#define glad_glSamplerParameterIuiv glad_gl.SamplerParameterIuiv
+#define glad_glGetSamplerParameteriv glad_gl.GetSamplerParameteriv
+#define glad_glGetSamplerParameterIiv glad_gl.GetSamplerParameterIiv
+#define glad_glGetSamplerParameterfv glad_gl.GetSamplerParameterfv
+#define glad_glGetSamplerParameterIuiv glad_gl.GetSamplerParameterIuiv
+#define glad_glQueryCounter glad_gl.QueryCounter
+#define glad_glGetQueryObjecti64v glad_gl.GetQueryObjecti64v
+#define glad_glGetQueryObjectui64v glad_gl.GetQueryObjectui64v
+#define glad_glVertexAttribDivisor glad_gl.VertexAttribDivisor
+#define glad_glVertexAttribP1ui glad_gl.VertexAttribP1ui
+#define glad_glVertexAttribP1uiv glad_gl.VertexAttribP1uiv
+#define glad_glVertexAttribP2ui glad_gl.VertexAttribP2ui
+#define glad_glVertexAttribP2uiv glad_gl.VertexAttribP2uiv
+#define glad_glVertexAttribP3ui glad_gl.VertexAttribP3ui
+#define glad_glVertexAttribP3uiv glad_gl.VertexAttribP3uiv
+#define glad_glVertexAttribP4ui glad_gl.VertexAttribP4ui
+#define glad_glVertexAttribP4uiv glad_gl.VertexAttribP4uiv
+#define glad_glGetProgramBinary glad_gl.GetProgramBinary
+#define glad_glProgramBinary glad_gl.ProgramBinary
+#define glad_glProgramParameteri glad_gl.ProgramParameteri
+#define glad_glMaxShaderCompilerThreadsKHR glad_gl.MaxShaderCompilerThreadsKHR
+#define glad_glBufferStorage glad_gl.BufferStorage
+#undef glNewList
+#undef glEndList
+#undef glCallList
+#undef glCallLists
+#undef glDeleteLists
+#undef glGenLists
+#undef glListBase
+#undef glBegin
+#undef glBitmap
+#undef glColor3b
+#undef glColor3bv
+#undef glColor3d
+#undef glColor3dv
+#undef glColor3f
+#undef glColor3fv
+#undef glColor3i
+#undef glColor3iv
+#undef glColor3s
+#undef glColor3sv
+#undef glColor3ub
+#undef glColor3ubv
+#undef glColor3ui
+#undef glColor3uiv
+#undef glColor3us
+#undef glColor3usv
+#undef glColor4b
+#undef glColor4bv
+#undef glColor4d
+#undef glColor4dv
+#undef glColor4f
+#undef glColor4fv
+#undef glColor4i
+#undef glColor4iv
+#undef glColor4s
+#undef glColor4sv
+#undef glColor4ub
+#undef glColor4ubv
+#undef glColor4ui
+#undef glColor4uiv
+#undef glColor4us
+#undef glColor4usv
+#undef glEdgeFlag
+#undef glEdgeFlagv
+#undef glEnd
+#undef glIndexd
+#undef glIndexdv
+#undef glIndexf
+#undef glIndexfv
+#undef glIndexi
+#undef glIndexiv
+#undef glIndexs
+#undef glIndexsv
+#undef glNormal3b
+#undef glNormal3bv
+#undef glNormal3d
+#undef glNormal3dv
+#undef glNormal3f
+#undef glNormal3fv
+#undef glNormal3i
+#undef glNormal3iv
+#undef glNormal3s
+#undef glNormal3sv
+#undef glRasterPos2d
+#undef glRasterPos2dv
+#undef glRasterPos2f
+#undef glRasterPos2fv
+#undef glRasterPos2i
+#undef glRasterPos2iv
+#undef glRasterPos2s
+#undef glRasterPos2sv
+#undef glRasterPos3d
+#undef glRasterPos3dv
+#undef glRasterPos3f
+#undef glRasterPos3fv
+#undef glRasterPos3i
+#undef glRasterPos3iv
+#undef glRasterPos3s
+#undef glRasterPos3sv
+#undef glRasterPos4d
+#undef glRasterPos4dv
+#undef glRasterPos4f
+#undef glRasterPos4fv
+#undef glRasterPos4i
+#undef glRasterPos4iv
+#undef glRasterPos4s
+#undef glRasterPos4sv
+#undef glRectd
+#undef glRectdv
+#undef glRectf
+#undef glRectfv
+#undef glRecti
+#undef glRectiv
+#undef glRects
+#undef glRectsv
+#undef glTexCoord1d
+#undef glTexCoord1dv
+#undef glTexCoord1f
+#undef glTexCoord1fv
+#undef glTexCoord1i
+#undef glTexCoord1iv
+#undef glTexCoord1s
+#undef glTexCoord1sv
+#undef glTexCoord2d
+#undef glTexCoord2dv
+#undef glTexCoord2f
+#undef glTexCoord2fv
+#undef glTexCoord2i
+#undef glTexCoord2iv
+#undef glTexCoord2s
+#undef glTexCoord2sv
+#undef glTexCoord3d
+#undef glTexCoord3dv
+#undef glTexCoord3f
+#undef glTexCoord3fv
+#undef glTexCoord3i
+#undef glTexCoord3iv
+#undef glTexCoord3s
+#undef glTexCoord3sv
+#undef glTexCoord4d
+#undef glTexCoord4dv
+#undef glTexCoord4f
+#undef glTexCoord4fv
+#undef glTexCoord4i
+#undef glTexCoord4iv
+#undef glTexCoord4s
+#undef glTexCoord4sv
+#undef glVertex2d
+#undef glVertex2dv
+#undef glVertex2f
+#undef glVertex2fv
+#undef glVertex2i
+#undef glVertex2iv
+#undef glVertex2s
+#undef glVertex2sv
+#undef glVertex3d
+#undef glVertex3dv
+#undef glVertex3f
+#undef glVertex3fv
+#undef glVertex3i
+#undef glVertex3iv
+#undef glVertex3s
+#undef glVertex3sv
+#undef glVertex4d
+#undef glVertex4dv
+#undef glVertex4f
+#undef glVertex4fv
+#undef glVertex4i
+#undef glVertex4iv
+#undef glVertex4s
+#undef glVertex4sv
+#undef glClipPlane
+#undef glColorMaterial
+#undef glFogf
+#undef glFogfv
+#undef glFogi
+#undef glFogiv
+#undef glLightf
+#undef glLightfv
+#undef glLighti
+#undef glLightiv
+#undef glLightModelf
+#undef glLightModelfv
+#undef glLightModeli
+#undef glLightModeliv
+#undef glLineStipple
+#undef glMaterialf
+#undef glMaterialfv
+#undef glMateriali
+#undef glMaterialiv
+#undef glPolygonStipple
+#undef glShadeModel
+#undef glTexEnvf
+#undef glTexEnvfv
+#undef glTexEnvi
+#undef glTexEnviv
+#undef glTexGend
+#undef glTexGendv
+#undef glTexGenf
+#undef glTexGenfv
+#undef glTexGeni
+#undef glTexGeniv
+#undef glFeedbackBuffer
+#undef glSelectBuffer
+#undef glRenderMode
+#undef glInitNames
+#undef glLoadName
+#undef glPassThrough
+#undef glPopName
+#undef glPushName
+#undef glClearAccum
+#undef glClearIndex
+#undef glIndexMask
+#undef glAccum
+#undef glPopAttrib
+#undef glPushAttrib
+#undef glMap1d
+#undef glMap1f
+#undef glMap2d
+#undef glMap2f
+#undef glMapGrid1d
+#undef glMapGrid1f
+#undef glMapGrid2d
+#undef glMapGrid2f
+#undef glEvalCoord1d
+#undef glEvalCoord1dv
+#undef glEvalCoord1f
+#undef glEvalCoord1fv
+#undef glEvalCoord2d
+#undef glEvalCoord2dv
+#undef glEvalCoord2f
+#undef glEvalCoord2fv
+#undef glEvalMesh1
+#undef glEvalPoint1
+#undef glEvalMesh2
+#undef glEvalPoint2
+#undef glAlphaFunc
+#undef glPixelZoom
+#undef glPixelTransferf
+#undef glPixelTransferi
+#undef glPixelMapfv
+#undef glPixelMapuiv
+#undef glPixelMapusv
+#undef glCopyPixels
+#undef glDrawPixels
+#undef glGetClipPlane
+#undef glGetLightfv
+#undef glGetLightiv
+#undef glGetMapdv
+#undef glGetMapfv
+#undef glGetMapiv
+#undef glGetMaterialfv
+#undef glGetMaterialiv
+#undef glGetPixelMapfv
+#undef glGetPixelMapuiv
+#undef glGetPixelMapusv
+#undef glGetPolygonStipple
+#undef glGetTexEnvfv
+#undef glGetTexEnviv
+#undef glGetTexGendv
+#undef glGetTexGenfv
+#undef glGetTexGeniv
+#undef glIsList
+#undef glFrustum
+#undef glLoadIdentity
+#undef glLoadMatrixf
+#undef glLoadMatrixd
+#undef glMatrixMode
+#undef glMultMatrixf
+#undef glMultMatrixd
+#undef glOrtho
+#undef glPopMatrix
+#undef glPushMatrix
+#undef glRotated
+#undef glRotatef
+#undef glScaled
+#undef glScalef
+#undef glTranslated
+#undef glTranslatef
+#undef glArrayElement
+#undef glColorPointer
+#undef glDisableClientState
+#undef glEdgeFlagPointer
+#undef glEnableClientState
+#undef glIndexPointer
+#undef glInterleavedArrays
+#undef glNormalPointer
+#undef glTexCoordPointer
+#undef glVertexPointer
+#undef glAreTexturesResident
+#undef glPrioritizeTextures
+#undef glIndexub
+#undef glIndexubv
+#undef glPopClientAttrib
+#undef glPushClientAttrib
+#undef glClientActiveTexture
+#undef glMultiTexCoord1d
+#undef glMultiTexCoord1dv
+#undef glMultiTexCoord1f
+#undef glMultiTexCoord1fv
+#undef glMultiTexCoord1i
+#undef glMultiTexCoord1iv
+#undef glMultiTexCoord1s
+#undef glMultiTexCoord1sv
+#undef glMultiTexCoord2d
+#undef glMultiTexCoord2dv
+#undef glMultiTexCoord2f
+#undef glMultiTexCoord2fv
+#undef glMultiTexCoord2i
+#undef glMultiTexCoord2iv
+#undef glMultiTexCoord2s
+#undef glMultiTexCoord2sv
+#undef glMultiTexCoord3d
+#undef glMultiTexCoord3dv
+#undef glMultiTexCoord3f
+#undef glMultiTexCoord3fv
+#undef glMultiTexCoord3i
+#undef glMultiTexCoord3iv
+#undef glMultiTexCoord3s
+#undef glMultiTexCoord3sv
+#undef glMultiTexCoord4d
+#undef glMultiTexCoord4dv
+#undef glMultiTexCoord4f
+#undef glMultiTexCoord4fv
+#undef glMultiTexCoord4i
+#undef glMultiTexCoord4iv
+#undef glMultiTexCoord4s
+#undef glMultiTexCoord4sv
+#undef glLoadTransposeMatrixf
+#undef glLoadTransposeMatrixd
+#undef glMultTransposeMatrixf
+#undef glMultTransposeMatrixd
+#undef glFogCoordf
+#undef glFogCoordfv
+#undef glFogCoordd
+#undef glFogCoorddv
+#undef glFogCoordPointer
+#undef glSecondaryColor3b
+#undef glSecondaryColor3bv
+#undef glSecondaryColor3d
+#undef glSecondaryColor3dv
+#undef glSecondaryColor3f
+#undef glSecondaryColor3fv
+#undef glSecondaryColor3i
+#undef glSecondaryColor3iv
+#undef glSecondaryColor3s
+#undef glSecondaryColor3sv
+#undef glSecondaryColor3ub
+#undef glSecondaryColor3ubv
+#undef glSecondaryColor3ui
+#undef glSecondaryColor3uiv
+#undef glSecondaryColor3us
+#undef glSecondaryColor3usv
+#undef glSecondaryColorPointer
+#undef glWindowPos2d
+#undef glWindowPos2dv
+#undef glWindowPos2f
+#undef glWindowPos2fv
+#undef glWindowPos2i
+#undef glWindowPos2iv
+#undef glWindowPos2s
+#undef glWindowPos2sv
+#undef glWindowPos3d
+#undef glWindowPos3dv
+#undef glWindowPos3f
+#undef glWindowPos3fv
+#undef glWindowPos3i
+#undef glWindowPos3iv
+#undef glWindowPos3s
+#undef glWindowPos3sv
+#undef glVertexP2ui
+#undef glVertexP2uiv
+#undef glVertexP3ui
+#undef glVertexP3uiv
+#undef glVertexP4ui
+#undef glVertexP4uiv
+#undef glTexCoordP1ui
+#undef glTexCoordP1uiv
+#undef glTexCoordP2ui
+#undef glTexCoordP2uiv
+#undef glTexCoordP3ui
+#undef glTexCoordP3uiv
+#undef glTexCoordP4ui
+#undef glTexCoordP4uiv
+#undef glMultiTexCoordP1ui
+#undef glMultiTexCoordP1uiv
+#undef glMultiTexCoordP2ui
+#undef glMultiTexCoordP2uiv
+#undef glMultiTexCoordP3ui
+#undef glMultiTexCoordP3uiv
+#undef glMultiTexCoordP4ui
+#undef glMultiTexCoordP4uiv
+#undef glNormalP3ui
+#undef glNormalP3uiv
+#undef glColorP3ui
+#undef glColorP3uiv
+#undef glColorP4ui
+#undef glColorP4uiv
+#undef glSecondaryColorP3ui
+#undef glSecondaryColorP3uiv
+#endif
 
 #ifdef __cplusplus
 }
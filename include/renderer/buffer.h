@@ -0,0 +1,86 @@
+/*
+    A GL buffer object that deletes itself.
+
+    The constructor generates the buffer, binds it to its target and uploads
+    the data; the buffer stays bound, so an element buffer made while a VAO
+    is bound is recorded in that VAO (see renderer/mesh.h). It owns the
+    buffer: moving hands it over, the destructor (or reset()) deletes it.
+*/
+
+#ifndef RENDERER_BUFFER_H
+#define RENDERER_BUFFER_H
+
+#include <glad/glad.h>
+
+#include <cstddef>
+
+namespace renderer {
+
+class Buffer {
+public:
+    Buffer() = default;
+
+    Buffer(GLenum target, size_t size, const void *data, GLenum usage = GL_STATIC_DRAW)
+        : target(target), bufferSize(size)
+    {
+        glGenBuffers(1, &buffer);
+        glBindBuffer(target, buffer);
+        glBufferData(target, (GLsizeiptr)size, data, usage);
+    }
+
+    ~Buffer() { reset(); }
+
+    Buffer(const Buffer &) = delete;
+    Buffer &operator=(const Buffer &) = delete;
+
+    Buffer(Buffer &&other) noexcept
+        : buffer(other.buffer), target(other.target), bufferSize(other.bufferSize)
+    {
+        other.buffer = 0;
+        other.bufferSize = 0;
+    }
+
+    Buffer &operator=(Buffer &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            buffer = other.buffer;
+            target = other.target;
+            bufferSize = other.bufferSize;
+            other.buffer = 0;
+            other.bufferSize = 0;
+        }
+        return *this;
+    }
+
+    // Deletes the buffer now instead of at the end of the scope
+    void reset()
+    {
+        if (buffer != 0) {
+            glDeleteBuffers(1, &buffer);
+            buffer = 0;
+            bufferSize = 0;
+        }
+    }
+
+    void bind() const { glBindBuffer(target, buffer); }
+
+    // Replaces part of the contents; the buffer is left bound
+    void update(size_t offset, size_t size, const void *data) const
+    {
+        glBindBuffer(target, buffer);
+        glBufferSubData(target, (GLintptr)offset, (GLsizeiptr)size, data);
+    }
+
+    unsigned int id() const { return buffer; }
+    size_t size() const { return bufferSize; }
+
+private:
+    unsigned int buffer = 0;
+    GLenum target = GL_ARRAY_BUFFER;
+    size_t bufferSize = 0;
+};
+
+} // namespace renderer
+
+#endif
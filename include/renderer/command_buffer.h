@@ -0,0 +1,268 @@
+/*
+    Sortable draw command buffer.
+
+    Draws are recorded as small POD structs tagged with a 64-bit sort key, then
+    radix-sorted once per frame and submitted in key order, so draws sharing a
+    program and a VAO end up next to each other and the state only changes
+    between groups. Key layout, most significant bit first:
+
+        opaque:       0 | program (12) | VAO (16) | depth (24) | unused (11)
+        translucent:  1 | far-to-near depth (24) | program (12) | VAO (16) | unused (11)
+
+    Opaque draws come first, grouped by state and front to back inside a group;
+    translucent ones follow back to front, which blending needs. Program and VAO
+    names above 4095 / 65535 only share key bits, so grouping gets worse but the
+    output stays correct: submit() always binds the real names.
+
+    submit() works with any backend that has GL-style useProgram,
+    bindVertexArray, drawArrays and drawElements plus blend(bool):
+    GLCommandBackend goes to the glad entry points, DeviceBackend adapts
+    objects like SoftwareRasterizer that have no blending stage and
+    RecordingBackend only remembers the calls.
+*/
+
+#ifndef RENDERER_COMMAND_BUFFER_H
+#define RENDERER_COMMAND_BUFFER_H
+
+#include <glad/glad.h>
+
+#include "hash.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace renderer {
+
+// 32 bytes, no pointers, so the buffer can be sorted and copied freely
+struct DrawCommand {
+    uint64_t key;
+    unsigned int program;
+    unsigned int vertexArray;
+    GLenum mode;
+    GLenum indexType;   // 0 for glDrawArrays
+    int first;          // first vertex, or byte offset into the element buffer
+    int count;
+};
+
+struct CommandStats {
+    unsigned int draws;
+    unsigned int programChanges;
+    unsigned int vertexArrayChanges;
+    unsigned int blendChanges;
+};
+
+class CommandBuffer {
+public:
+    static const int PROGRAM_BITS = 12;
+    static const int VERTEX_ARRAY_BITS = 16;
+    static const int DEPTH_BITS = 24;
+
+    // depth is in [0, 1], 0 nearest; values outside are clamped
+    static uint64_t makeKey(unsigned int program, unsigned int vertexArray, float depth, bool blend)
+    {
+        const uint64_t programMask = (1u << PROGRAM_BITS) - 1;
+        const uint64_t vertexArrayMask = (1u << VERTEX_ARRAY_BITS) - 1;
+        const uint64_t depthMax = (1u << DEPTH_BITS) - 1;
+
+        float clamped = depth < 0.0f ? 0.0f : (depth > 1.0f ? 1.0f : depth);
+        // In double: float rounds 1.0 * (2^24 - 1) + 0.5 up to 2^24, one past the depth field
+        uint64_t quantized = (uint64_t)(clamped * (double)depthMax + 0.5);
+
+        if (!blend) {
+            return ((program & programMask) << 51) | ((vertexArray & vertexArrayMask) << 35) | (quantized << 11);
+        }
+        return (1ull << 63) | ((depthMax - quantized) << 39) | ((program & programMask) << 27) | ((vertexArray & vertexArrayMask) << 11);
+    }
+
+    void clear() { commands.clear(); }
+
+    void reserve(size_t count) { commands.reserve(count); }
+
+    size_t size() const { return commands.size(); }
+
+    const DrawCommand *data() const { return commands.data(); }
+
+    void drawArrays(unsigned int program, unsigned int vertexArray, GLenum mode, int first, int count, float depth = 0.0f, bool blend = false)
+    {
+        DrawCommand command = {makeKey(program, vertexArray, depth, blend), program, vertexArray, mode, 0, first, count};
+        commands.push_back(command);
+    }
+
+    // offset is the byte offset into the VAO's element buffer, as with glDrawElements
+    void drawElements(unsigned int program, unsigned int vertexArray, GLenum mode, int count, GLenum indexType, size_t offset, float depth = 0.0f, bool blend = false)
+    {
+        DrawCommand command = {makeKey(program, vertexArray, depth, blend), program, vertexArray, mode, indexType, (int)offset, count};
+        commands.push_back(command);
+    }
+
+    // Appends already built commands (their keys are kept)
+    void append(const DrawCommand *source, size_t count)
+    {
+        commands.insert(commands.end(), source, source + count);
+    }
+
+    // Stable LSD radix sort on the key, one byte per pass; passes where every key has the same byte are skipped
+    void sort()
+    {
+        size_t count = commands.size();
+        if (count < 2) {
+            return;
+        }
+
+        // All eight histograms in a single pass over the keys
+        uint32_t histograms[8][256];
+        memset(histograms, 0, sizeof(histograms));
+        for (const DrawCommand &command : commands) {
+            for (int digit = 0; digit < 8; digit++) {
+                histograms[digit][(command.key >> (digit * 8)) & 0xFF]++;
+            }
+        }
+
+        scratch.resize(count);
+        DrawCommand *source = commands.data();
+        DrawCommand *destination = scratch.data();
+
+        for (int digit = 0; digit < 8; digit++) {
+            uint32_t *histogram = histograms[digit];
+            if (histogram[(source[0].key >> (digit * 8)) & 0xFF] == count) {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (int bucket = 0; bucket < 256; bucket++) {
+                uint32_t bucketCount = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += bucketCount;
+            }
+
+            for (size_t i = 0; i < count; i++) {
+                destination[histogram[(source[i].key >> (digit * 8)) & 0xFF]++] = source[i];
+            }
+
+            DrawCommand *swap = source;
+            source = destination;
+            destination = swap;
+        }
+
+        if (source != commands.data()) {
+            commands.swap(scratch);
+        }
+    }
+
+    // Issues the commands in their current order, skipping program/VAO/blend changes that aren't needed
+    template <typename Backend>
+    CommandStats submit(Backend &backend) const
+    {
+        CommandStats stats = {0, 0, 0, 0};
+        bool first = true;
+        unsigned int program = 0, vertexArray = 0;
+        bool blend = false;
+
+        for (const DrawCommand &command : commands) {
+            bool commandBlend = (command.key >> 63) != 0;
+            if (first || commandBlend != blend) {
+                backend.blend(commandBlend);
+                blend = commandBlend;
+                stats.blendChanges++;
+            }
+            if (first || command.program != program) {
+                backend.useProgram(command.program);
+                program = command.program;
+                stats.programChanges++;
+            }
+            if (first || command.vertexArray != vertexArray) {
+                backend.bindVertexArray(command.vertexArray);
+                vertexArray = command.vertexArray;
+                stats.vertexArrayChanges++;
+            }
+            first = false;
+
+            if (command.indexType == 0) {
+                backend.drawArrays(command.mode, command.first, command.count);
+            } else {
+                backend.drawElements(command.mode, command.count, command.indexType, (const void *)(size_t)command.first);
+            }
+            stats.draws++;
+        }
+        return stats;
+    }
+
+private:
+    std::vector<DrawCommand> commands;
+    std::vector<DrawCommand> scratch;
+};
+
+/* BACKENDS START HERE */
+
+// Straight to the driver through glad
+struct GLCommandBackend {
+    void blend(bool enabled)
+    {
+        if (enabled) {
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        } else {
+            glDisable(GL_BLEND);
+        }
+    }
+
+    void useProgram(unsigned int program) { glUseProgram(program); }
+    void bindVertexArray(unsigned int vertexArray) { glBindVertexArray(vertexArray); }
+    void drawArrays(GLenum mode, int first, int count) { glDrawArrays(mode, first, count); }
+    void drawElements(GLenum mode, int count, GLenum type, const void *indices) { glDrawElements(mode, count, type, indices); }
+};
+
+// Any device with the GL-style draw calls but no blending stage, e.g. SoftwareRasterizer
+template <typename Device>
+struct DeviceBackend {
+    Device &device;
+
+    void blend(bool) {}
+    void useProgram(unsigned int program) { device.useProgram(program); }
+    void bindVertexArray(unsigned int vertexArray) { device.bindVertexArray(vertexArray); }
+    void drawArrays(GLenum mode, int first, int count) { device.drawArrays(mode, first, count); }
+    void drawElements(GLenum mode, int count, GLenum type, const void *indices) { device.drawElements(mode, count, type, indices); }
+};
+
+// Remembers the call stream instead of drawing, to check that two ways of building a frame agree
+struct RecordingBackend {
+    enum Operation {
+        BLEND,
+        USE_PROGRAM,
+        BIND_VERTEX_ARRAY,
+        DRAW_ARRAYS,
+        DRAW_ELEMENTS
+    };
+
+    struct Call {
+        uint32_t operation;
+        uint32_t arguments[4];
+    };
+
+    std::vector<Call> calls;
+
+    void clear() { calls.clear(); }
+
+    // FNV-1a over the whole stream; equal hashes mean (practically) identical frames
+    uint64_t hash() const { return hashBytes(calls.data(), calls.size() * sizeof(Call)); }
+
+    void blend(bool enabled) { push(BLEND, enabled ? 1 : 0); }
+    void useProgram(unsigned int program) { push(USE_PROGRAM, program); }
+    void bindVertexArray(unsigned int vertexArray) { push(BIND_VERTEX_ARRAY, vertexArray); }
+    void drawArrays(GLenum mode, int first, int count) { push(DRAW_ARRAYS, mode, (uint32_t)first, (uint32_t)count); }
+    void drawElements(GLenum mode, int count, GLenum type, const void *indices) { push(DRAW_ELEMENTS, mode, (uint32_t)count, type, (uint32_t)(size_t)indices); }
+
+private:
+    void push(Operation operation, uint32_t a, uint32_t b = 0, uint32_t c = 0, uint32_t d = 0)
+    {
+        Call call = {(uint32_t)operation, {a, b, c, d}};
+        calls.push_back(call);
+    }
+};
+
+/* BACKENDS END HERE */
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,377 @@
+/*
+    Frame-time profiler for the render loops.
+
+    beginFrame() starts a frame and its first stage, stage() switches to the
+    next one (input, update, submit, swap) and endFrame() closes it. That gives
+    the CPU time of every stage, the CPU frame time (beginFrame() to the next
+    beginFrame(), so it includes waiting for vsync) and, through a GL_TIME_ELAPSED
+    query around the frame, the GPU time. Query results are collected a few
+    frames later, once GL_QUERY_RESULT_AVAILABLE says so, so profiling never
+    waits for the GPU; a result that isn't in by the time its query comes round
+    again is dropped and counted.
+
+    Every value goes into a LatencyHistogram: log-linear buckets of atomic
+    counters (16 per power of two, so a percentile is off by at most ~6%). It
+    is recorded into without locks and can be read from another thread while
+    the loop runs. printSummary() prints p50/p95/p99 per metric, writeCsv()
+    and writeJson() export the same numbers with the bucket counts.
+    One profiler per process, like renderer/state_cache.h; call release()
+    while the context is still current.
+*/
+
+#ifndef RENDERER_FRAME_PROFILER_H
+#define RENDERER_FRAME_PROFILER_H
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace renderer {
+
+// Log-linear histogram of nanosecond values
+class LatencyHistogram {
+public:
+    static const int SUB_BUCKET_BITS = 4;
+    static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static const int BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    void record(unsigned long long nanoseconds)
+    {
+        buckets[bucketOf(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+        total.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+        unsigned long long seen = largest.load(std::memory_order_relaxed);
+        while (nanoseconds > seen && !largest.compare_exchange_weak(seen, nanoseconds, std::memory_order_relaxed)) {
+        }
+    }
+
+    void reset()
+    {
+        for (std::atomic<unsigned long long> &bucket : buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        total.store(0, std::memory_order_relaxed);
+        sum.store(0, std::memory_order_relaxed);
+        largest.store(0, std::memory_order_relaxed);
+    }
+
+    unsigned long long count() const { return total.load(std::memory_order_relaxed); }
+    unsigned long long maximum() const { return largest.load(std::memory_order_relaxed); }
+    unsigned long long bucketCount(int bucket) const { return buckets[bucket].load(std::memory_order_relaxed); }
+
+    double mean() const
+    {
+        unsigned long long samples = count();
+        return samples > 0 ? (double)sum.load(std::memory_order_relaxed) / samples : 0.0;
+    }
+
+    // Upper bound of the bucket holding the p-th fraction of the samples, capped at the largest value
+    unsigned long long percentile(double p) const
+    {
+        unsigned long long samples = count();
+        if (samples == 0) {
+            return 0;
+        }
+        unsigned long long rank = (unsigned long long)(p * samples + 0.5);
+        rank = std::max(1ULL, std::min(rank, samples));
+        unsigned long long seen = 0;
+        for (int bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+            seen += bucketCount(bucket);
+            if (seen >= rank) {
+                return std::min(bucketUpperBound(bucket), maximum());
+            }
+        }
+        return maximum();
+    }
+
+    static int bucketOf(unsigned long long value)
+    {
+        if (value < (unsigned long long)SUB_BUCKETS) {
+            return (int)value;
+        }
+        int exponent = 63 - __builtin_clzll(value);
+        int shift = exponent - SUB_BUCKET_BITS;
+        return (shift + 1) * SUB_BUCKETS + (int)((value >> shift) & (SUB_BUCKETS - 1));
+    }
+
+    // Largest value that lands in bucket
+    static unsigned long long bucketUpperBound(int bucket)
+    {
+        if (bucket < SUB_BUCKETS) {
+            return (unsigned long long)bucket;
+        }
+        int shift = bucket / SUB_BUCKETS - 1;
+        unsigned long long mantissa = (unsigned long long)(SUB_BUCKETS + bucket % SUB_BUCKETS);
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+private:
+    std::atomic<unsigned long long> buckets[BUCKET_COUNT] = {};
+    std::atomic<unsigned long long> total{0};
+    std::atomic<unsigned long long> sum{0};
+    std::atomic<unsigned long long> largest{0};
+};
+
+enum FrameStage {
+    FRAME_STAGE_INPUT = 0,
+    FRAME_STAGE_UPDATE,
+    FRAME_STAGE_SUBMIT,
+    FRAME_STAGE_SWAP,
+    FRAME_STAGE_COUNT
+};
+
+// The histograms the profiler keeps
+enum FrameMetric {
+    FRAME_METRIC_CPU_FRAME = 0,
+    FRAME_METRIC_INPUT,
+    FRAME_METRIC_UPDATE,
+    FRAME_METRIC_SUBMIT,
+    FRAME_METRIC_SWAP,
+    FRAME_METRIC_GPU,
+    FRAME_METRIC_COUNT
+};
+
+class FrameProfiler {
+public:
+    // Starts a frame, in stage first
+    static void beginFrame(FrameStage first = FRAME_STAGE_INPUT)
+    {
+        State &state = get();
+        unsigned long long now = clock();
+        if (state.frameStart != 0) {
+            state.metrics[FRAME_METRIC_CPU_FRAME].record(now - state.frameStart);
+        }
+        state.frameStart = now;
+        state.stage = first;
+        state.stageStart = now;
+
+        collectQueries(false);
+        if (state.gpuTiming) {
+            Query &query = state.queries[state.nextQuery];
+            if (query.pending) {
+                // Still not available after QUERY_RING frames; reading it would stall
+                state.droppedQueries++;
+                query.pending = false;
+            }
+            glBeginQuery(GL_TIME_ELAPSED, query.id);
+            query.pending = true;
+            state.queryOpen = true;
+        }
+    }
+
+    // Ends the current stage and starts stage
+    static void stage(FrameStage next)
+    {
+        State &state = get();
+        unsigned long long now = clock();
+        state.metrics[FRAME_METRIC_INPUT + state.stage].record(now - state.stageStart);
+        state.stage = next;
+        state.stageStart = now;
+    }
+
+    static void endFrame()
+    {
+        State &state = get();
+        state.metrics[FRAME_METRIC_INPUT + state.stage].record(clock() - state.stageStart);
+        if (state.queryOpen) {
+            glEndQuery(GL_TIME_ELAPSED);
+            state.queryOpen = false;
+            state.nextQuery = (state.nextQuery + 1) % QUERY_RING;
+        }
+        state.frames++;
+    }
+
+    // GPU timing is on by default; turn it off before the first frame on contexts without
+    // timer queries, or to leave the query objects out of a capture
+    static void setGpuTiming(bool enabled)
+    {
+        get().gpuTimingWanted = enabled;
+    }
+
+    static const LatencyHistogram &metric(FrameMetric which) { return get().metrics[which]; }
+
+    static const char *metricName(FrameMetric which)
+    {
+        static const char *const NAMES[FRAME_METRIC_COUNT] = {"cpu_frame", "input", "update", "submit", "swap", "gpu"};
+        return NAMES[which];
+    }
+
+    // Waits for the queries still in flight and deletes them; call before the context goes away
+    static void release()
+    {
+        State &state = get();
+        if (!state.queriesCreated) {
+            return;
+        }
+        if (state.queryOpen) {
+            glEndQuery(GL_TIME_ELAPSED);
+            state.queryOpen = false;
+        }
+        collectQueries(true);
+        for (Query &query : state.queries) {
+            glDeleteQueries(1, &query.id);
+            query = Query();
+        }
+        state.queriesCreated = false;
+        state.gpuTiming = false;
+    }
+
+    static void printSummary()
+    {
+        State &state = get();
+        std::cout << "Frame profile over " << state.frames << " frames (ms):" << std::endl;
+        char line[160];
+        snprintf(line, sizeof(line), "  %-10s %10s %10s %10s %10s %10s", "", "mean", "p50", "p95", "p99", "max");
+        std::cout << line << std::endl;
+        for (int i = 0; i < FRAME_METRIC_COUNT; i++) {
+            const LatencyHistogram &histogram = state.metrics[i];
+            if (histogram.count() == 0) {
+                continue;
+            }
+            snprintf(line, sizeof(line), "  %-10s %10.3f %10.3f %10.3f %10.3f %10.3f", metricName((FrameMetric)i), histogram.mean() / 1e6,
+                     histogram.percentile(0.50) / 1e6, histogram.percentile(0.95) / 1e6, histogram.percentile(0.99) / 1e6, histogram.maximum() / 1e6);
+            std::cout << line << std::endl;
+        }
+        if (state.droppedQueries > 0) {
+            std::cout << "  " << state.droppedQueries << " GPU timings dropped (results not ready in time)" << std::endl;
+        }
+    }
+
+    // One row per non-empty bucket: metric,bucket_upper_ms,count
+    static bool writeCsv(const std::string &path)
+    {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            std::cout << "ERROR::FRAME_PROFILER::FILE_NOT_WRITTEN " << path << std::endl;
+            return false;
+        }
+        file << "metric,bucket_upper_ms,count\n";
+        char value[64];
+        for (int i = 0; i < FRAME_METRIC_COUNT; i++) {
+            const LatencyHistogram &histogram = get().metrics[i];
+            for (int bucket = 0; bucket < LatencyHistogram::BUCKET_COUNT; bucket++) {
+                unsigned long long count = histogram.bucketCount(bucket);
+                if (count > 0) {
+                    snprintf(value, sizeof(value), "%.6f", LatencyHistogram::bucketUpperBound(bucket) / 1e6);
+                    file << metricName((FrameMetric)i) << "," << value << "," << count << "\n";
+                }
+            }
+        }
+        return (bool)file;
+    }
+
+    // {"frames":N,"metrics":{"cpu_frame":{"count":..,"mean_ms":..,"p50_ms":..,...,"histogram":[[upper_ms,count],...]},...}}
+    static bool writeJson(const std::string &path)
+    {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            std::cout << "ERROR::FRAME_PROFILER::FILE_NOT_WRITTEN " << path << std::endl;
+            return false;
+        }
+        State &state = get();
+        char value[256];
+        file << "{\"frames\":" << state.frames << ",\"dropped_gpu_queries\":" << state.droppedQueries << ",\"metrics\":{";
+        bool firstMetric = true;
+        for (int i = 0; i < FRAME_METRIC_COUNT; i++) {
+            const LatencyHistogram &histogram = state.metrics[i];
+            snprintf(value, sizeof(value), "\"count\":%llu,\"mean_ms\":%.6f,\"p50_ms\":%.6f,\"p95_ms\":%.6f,\"p99_ms\":%.6f,\"max_ms\":%.6f",
+                     histogram.count(), histogram.mean() / 1e6, histogram.percentile(0.50) / 1e6, histogram.percentile(0.95) / 1e6,
+                     histogram.percentile(0.99) / 1e6, histogram.maximum() / 1e6);
+            file << (firstMetric ? "\n" : ",\n") << "\"" << metricName((FrameMetric)i) << "\":{" << value << ",\"histogram\":[";
+            firstMetric = false;
+
+            bool firstBucket = true;
+            for (int bucket = 0; bucket < LatencyHistogram::BUCKET_COUNT; bucket++) {
+                unsigned long long count = histogram.bucketCount(bucket);
+                if (count > 0) {
+                    snprintf(value, sizeof(value), "[%.6f,%llu]", LatencyHistogram::bucketUpperBound(bucket) / 1e6, count);
+                    file << (firstBucket ? "" : ",") << value;
+                    firstBucket = false;
+                }
+            }
+            file << "]}";
+        }
+        file << "\n}}\n";
+        return (bool)file;
+    }
+
+private:
+    // Queries in flight; a result gets this many frames to show up
+    static const int QUERY_RING = 4;
+
+    struct Query {
+        unsigned int id = 0;
+        bool pending = false;
+    };
+
+    struct State {
+        LatencyHistogram metrics[FRAME_METRIC_COUNT];
+        unsigned long long frames = 0;
+        unsigned long long frameStart = 0;
+        unsigned long long stageStart = 0;
+        int stage = FRAME_STAGE_INPUT;
+
+        bool gpuTimingWanted = true;
+        bool gpuTiming = false;
+        bool queriesCreated = false;
+        bool queryOpen = false;
+        Query queries[QUERY_RING];
+        int nextQuery = 0;
+        unsigned long long droppedQueries = 0;
+    };
+
+    static State &get()
+    {
+        static State state;
+        return state;
+    }
+
+    static unsigned long long clock()
+    {
+        return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Records every finished query; with wait, waits for the ones still running
+    static void collectQueries(bool wait)
+    {
+        State &state = get();
+        if (!state.queriesCreated) {
+            // Created on the first frame, when the context is known to be current
+            if (!state.gpuTimingWanted) {
+                return;
+            }
+            for (Query &query : state.queries) {
+                glGenQueries(1, &query.id);
+            }
+            state.queriesCreated = true;
+            state.gpuTiming = true;
+        }
+
+        for (int i = 0; i < QUERY_RING; i++) {
+            Query &query = state.queries[(state.nextQuery + i) % QUERY_RING];
+            if (!query.pending) {
+                continue;
+            }
+            GLint available = 0;
+            if (!wait) {
+                glGetQueryObjectiv(query.id, GL_QUERY_RESULT_AVAILABLE, &available);
+            }
+            if (wait || available) {
+                GLuint64 nanoseconds = 0;
+                glGetQueryObjectui64v(query.id, GL_QUERY_RESULT, &nanoseconds);
+                state.metrics[FRAME_METRIC_GPU].record(nanoseconds);
+                query.pending = false;
+            }
+        }
+    }
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,199 @@
+/*
+    Writes RGBA8 frames, as glReadPixels returns them (bottom row first), to disk.
+
+    FRAME_RAW appends every frame to one file, top row first, ready for
+    "ffmpeg -f rawvideo -pix_fmt rgba -s WxH -i frames.rgba out.mp4".
+    FRAME_PNG writes one PNG per frame, named <path>_<frame>.png. The encoder
+    is self-contained: the image data goes in uncompressed (stored deflate
+    blocks), which keeps it fast and free of dependencies at the cost of size.
+*/
+
+#ifndef RENDERER_FRAME_WRITER_H
+#define RENDERER_FRAME_WRITER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace renderer {
+
+enum FrameFormat {
+    FRAME_RAW = 0,
+    FRAME_PNG = 1
+};
+
+class FrameWriter {
+public:
+    FrameWriter(const std::string &path, FrameFormat format, int width, int height)
+        : path(path), format(format), frameWidth(width), frameHeight(height)
+    {
+        if (format == FRAME_RAW) {
+            raw.open(path, std::ios::binary | std::ios::trunc);
+            if (!raw) {
+                std::cout << "ERROR::FRAME_WRITER::FILE_NOT_WRITTEN " << path << std::endl;
+            }
+        }
+    }
+
+    // pixels: width * height RGBA8, bottom row first, rows packed
+    bool write(const unsigned char *pixels, unsigned long long frame)
+    {
+        size_t rowSize = (size_t)frameWidth * 4;
+        if (format == FRAME_RAW) {
+            for (int y = frameHeight - 1; y >= 0; y--) {
+                raw.write((const char *)pixels + (size_t)y * rowSize, (std::streamsize)rowSize);
+            }
+            written++;
+            return (bool)raw;
+        }
+
+        char name[32];
+        snprintf(name, sizeof(name), "_%05llu.png", frame);
+        std::string file = path + name;
+        encodePng(pixels, png);
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        out.write((const char *)png.data(), (std::streamsize)png.size());
+        if (!out) {
+            std::cout << "ERROR::FRAME_WRITER::FILE_NOT_WRITTEN " << file << std::endl;
+            return false;
+        }
+        written++;
+        return true;
+    }
+
+    unsigned long long frames() const { return written; }
+
+    // Encodes a bottom-up RGBA8 image as a PNG into out
+    void encodePng(const unsigned char *pixels, std::vector<unsigned char> &out)
+    {
+        size_t rowSize = (size_t)frameWidth * 4;
+
+        // Scanlines top row first, each behind filter type 0 (none)
+        scanlines.resize((rowSize + 1) * frameHeight);
+        for (int y = 0; y < frameHeight; y++) {
+            unsigned char *line = &scanlines[(rowSize + 1) * y];
+            line[0] = 0;
+            memcpy(line + 1, pixels + (size_t)(frameHeight - 1 - y) * rowSize, rowSize);
+        }
+
+        out.clear();
+        static const unsigned char SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        out.insert(out.end(), SIGNATURE, SIGNATURE + 8);
+
+        unsigned char header[13];
+        putU32(header, (uint32_t)frameWidth);
+        putU32(header + 4, (uint32_t)frameHeight);
+        header[8] = 8;      // bits per channel
+        header[9] = 6;      // RGBA
+        header[10] = 0;     // deflate
+        header[11] = 0;     // adaptive filtering
+        header[12] = 0;     // not interlaced
+        appendChunk(out, "IHDR", header, sizeof(header));
+
+        // zlib stream of stored blocks, at most 65535 bytes each
+        std::vector<unsigned char> &zlib = compressed;
+        zlib.clear();
+        zlib.push_back(0x78);
+        zlib.push_back(0x01);
+        size_t offset = 0;
+        do {
+            size_t length = std::min<size_t>(scanlines.size() - offset, 65535);
+            bool last = offset + length == scanlines.size();
+            zlib.push_back(last ? 1 : 0);
+            zlib.push_back((unsigned char)length);
+            zlib.push_back((unsigned char)(length >> 8));
+            zlib.push_back((unsigned char)~length);
+            zlib.push_back((unsigned char)(~length >> 8));
+            zlib.insert(zlib.end(), scanlines.begin() + offset, scanlines.begin() + offset + length);
+            offset += length;
+        } while (offset < scanlines.size());
+        unsigned char checksum[4];
+        putU32(checksum, adler32(scanlines.data(), scanlines.size()));
+        zlib.insert(zlib.end(), checksum, checksum + 4);
+        appendChunk(out, "IDAT", zlib.data(), zlib.size());
+
+        appendChunk(out, "IEND", nullptr, 0);
+    }
+
+private:
+    static void putU32(unsigned char *out, uint32_t value)
+    {
+        out[0] = (unsigned char)(value >> 24);
+        out[1] = (unsigned char)(value >> 16);
+        out[2] = (unsigned char)(value >> 8);
+        out[3] = (unsigned char)value;
+    }
+
+    static uint32_t crc32(const unsigned char *data, size_t size, uint32_t crc)
+    {
+        static uint32_t table[256];
+        static bool ready = false;
+        if (!ready) {
+            for (uint32_t n = 0; n < 256; n++) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; k++) {
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                }
+                table[n] = c;
+            }
+            ready = true;
+        }
+        for (size_t i = 0; i < size; i++) {
+            crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return crc;
+    }
+
+    static uint32_t adler32(const unsigned char *data, size_t size)
+    {
+        uint32_t a = 1, b = 0;
+        while (size > 0) {
+            // 5552 bytes is the most that can be summed before b may overflow
+            size_t block = std::min<size_t>(size, 5552);
+            for (size_t i = 0; i < block; i++) {
+                a += data[i];
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+            data += block;
+            size -= block;
+        }
+        return (b << 16) | a;
+    }
+
+    static void appendChunk(std::vector<unsigned char> &out, const char type[4], const unsigned char *data, size_t size)
+    {
+        unsigned char length[4];
+        putU32(length, (uint32_t)size);
+        out.insert(out.end(), length, length + 4);
+        size_t start = out.size();
+        out.insert(out.end(), type, type + 4);
+        if (size > 0) {
+            out.insert(out.end(), data, data + size);
+        }
+        unsigned char crc[4];
+        putU32(crc, crc32(&out[start], out.size() - start, 0xFFFFFFFFu) ^ 0xFFFFFFFFu);
+        out.insert(out.end(), crc, crc + 4);
+    }
+
+    std::string path;
+    FrameFormat format;
+    int frameWidth, frameHeight;
+    std::ofstream raw;
+    unsigned long long written = 0;
+
+    // Reused between frames
+    std::vector<unsigned char> png;
+    std::vector<unsigned char> scanlines;
+    std::vector<unsigned char> compressed;
+};
+
+} // namespace renderer
+
+#endif
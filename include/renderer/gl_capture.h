@@ -0,0 +1,461 @@
+/*
+    Captures the GL call stream of a run into a compact binary file that
+    renderer/gl_replay.h can play back (build with GLAD_CALL_HOOKS, "make trace=1").
+
+    begin() installs glad's call hooks; from then on every call the capturing
+    thread makes is appended to the file with its arguments and result, and the
+    memory its pointer arguments refer to is copied in where the size can be
+    worked out: glBufferData/glBufferSubData payloads, shader sources, uniform
+    arrays, the names glGen* hands out and glDelete* takes, texture uploads and so on.
+    Offsets (glVertexAttribPointer, glDrawElements) and sync objects are kept
+    as plain values. Any other pointer is taken to be an output and replays
+    into scratch memory, so glGet* calls cost what they cost but return nothing.
+    Writes through glMapBuffer/glMapBufferRange pointers are not seen.
+
+    File layout, all integers little-endian:
+        "GLCP", u32 version, u32 width, u32 height
+        then records, each starting with a varint opcode:
+          GL_CAPTURE_FRAME     end of a frame (endFrame())
+          GL_CAPTURE_FUNCTION  varint id, name, argument type letters, result letter
+          GL_CAPTURE_END       end of the stream
+          GL_CAPTURE_CALL + id a call to a function defined earlier
+    A call is followed by its arguments by type letter (see glad.h): i as a
+    zigzag varint, u/e/x as a varint, f as the 8 bytes of the double, p as a
+    tag byte (GL_CAPTURE_POINTER_*) and its value, payload or output size.
+    Then the result the same way, unless the function returns void.
+    Strings are a varint length and the bytes.
+
+    Hooks are shared with renderer/gl_trace.h, so only one of them can be installed.
+*/
+
+#ifndef RENDERER_GL_CAPTURE_H
+#define RENDERER_GL_CAPTURE_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace renderer {
+
+const uint32_t GL_CAPTURE_VERSION = 1;
+
+// Record opcodes
+const unsigned int GL_CAPTURE_FRAME = 0;
+const unsigned int GL_CAPTURE_FUNCTION = 1;
+const unsigned int GL_CAPTURE_END = 2;
+const unsigned int GL_CAPTURE_CALL = 16;
+
+// Tags in front of a pointer argument
+const unsigned char GL_CAPTURE_POINTER_NULL = 0;
+const unsigned char GL_CAPTURE_POINTER_VALUE = 1;     // varint: an offset or a handle
+const unsigned char GL_CAPTURE_POINTER_PAYLOAD = 2;   // varint size, then the bytes
+const unsigned char GL_CAPTURE_POINTER_OUTPUT = 3;    // varint size the call may write, 0 if unknown
+
+// What a function's pointer arguments point at, worked out from its name
+enum GLCaptureKind {
+    GL_CAPTURE_PLAIN = 0,           // pointers are outputs
+    GL_CAPTURE_BUFFER_DATA,         // payload of sizeArg bytes
+    GL_CAPTURE_SHADER_SOURCE,       // strings, stored concatenated as one
+    GL_CAPTURE_UNIFORM_ARRAY,       // count (sizeArg) * elementSize bytes
+    GL_CAPTURE_GEN_NAMES,           // n names written by the call
+    GL_CAPTURE_DELETE_NAMES,        // n names read by the call
+    GL_CAPTURE_NAME_STRING,         // a NUL-terminated name
+    GL_CAPTURE_OFFSET,              // an offset into a bound buffer
+    GL_CAPTURE_SYNC,                // first argument is a GLsync handle
+    GL_CAPTURE_IMAGE_UPLOAD,        // pixels of widthArg x widthArg + 1 in formatArg/formatArg + 1
+    GL_CAPTURE_IMAGE_READ           // same, written by the call
+};
+
+struct GLCaptureFunction {
+    GLCaptureKind kind;
+    int pointerArg;     // the argument the kind is about
+    int sizeArg;        // byte count or element count, -1 if fixed
+    int elementSize;    // bytes per element for sizeArg
+    int widthArg;       // images only
+    int formatArg;      // images only
+};
+
+class GLCapture {
+public:
+    // Opens path and starts recording the calling thread's GL calls; width and height are
+    // the default framebuffer size the replay should create
+    static bool begin(const std::string &path, int width, int height)
+    {
+#ifndef GLAD_CALL_HOOKS
+        (void)path;
+        (void)width;
+        (void)height;
+        std::cout << "ERROR::GL_CAPTURE::NOT_BUILT rebuild with -DGLAD_CALL_HOOKS (make trace=1)" << std::endl;
+        return false;
+#else
+        State &state = get();
+        if (state.recording) {
+            return true;
+        }
+
+        state.file.open(path, std::ios::binary | std::ios::trunc);
+        if (!state.file) {
+            std::cout << "ERROR::GL_CAPTURE::FILE_NOT_WRITTEN " << path << std::endl;
+            return false;
+        }
+        state.path = path;
+        state.buffer.clear();
+        state.frames = 0;
+        state.calls = 0;
+        state.bytes = 0;
+        for (int index = 0; index < GLAD_GL_FUNCTION_COUNT; index++) {
+            state.defined[index] = false;
+        }
+
+        state.buffer.insert(state.buffer.end(), {'G', 'L', 'C', 'P'});
+        writeU32(state.buffer, GL_CAPTURE_VERSION);
+        writeU32(state.buffer, (uint32_t)width);
+        writeU32(state.buffer, (uint32_t)height);
+
+        state.thread = std::this_thread::get_id();
+        state.recording = true;
+        if (!gladInstallCallHooks(NULL, &after)) {
+            state.recording = false;
+            state.file.close();
+            return false;
+        }
+        return true;
+#endif
+    }
+
+    // Marks the end of a frame, where the replay swaps; call after glfwSwapBuffers
+    static void endFrame()
+    {
+        State &state = get();
+        if (!state.recording) {
+            return;
+        }
+        writeVarint(state.buffer, GL_CAPTURE_FRAME);
+        state.frames++;
+        if (state.buffer.size() >= FLUSH_BYTES) {
+            flush();
+        }
+    }
+
+    // Removes the hooks, closes the file and prints what went into it
+    static void end()
+    {
+        State &state = get();
+        if (!state.recording) {
+            return;
+        }
+#ifdef GLAD_CALL_HOOKS
+        gladRemoveCallHooks();
+#endif
+        state.recording = false;
+        writeVarint(state.buffer, GL_CAPTURE_END);
+        flush();
+        state.file.close();
+        if (!state.file) {
+            std::cout << "ERROR::GL_CAPTURE::FILE_NOT_WRITTEN " << state.path << std::endl;
+            return;
+        }
+        std::cout << "GL capture: " << state.calls << " calls in " << state.frames << " frames, " << state.bytes << " bytes to "
+                  << state.path << std::endl;
+    }
+
+    static bool recording() { return get().recording; }
+
+    // Shared with the replay, which has to read the pointers back the same way
+    static GLCaptureFunction classify(const char *name, const char *argTypes)
+    {
+        GLCaptureFunction function = {GL_CAPTURE_PLAIN, -1, -1, 1, -1, -1};
+        size_t length = strlen(name);
+
+        if (strcmp(name, "glBufferData") == 0) {
+            function = {GL_CAPTURE_BUFFER_DATA, 2, 1, 1, -1, -1};
+        } else if (strcmp(name, "glBufferSubData") == 0) {
+            function = {GL_CAPTURE_BUFFER_DATA, 3, 2, 1, -1, -1};
+        } else if (strcmp(name, "glShaderSource") == 0) {
+            function = {GL_CAPTURE_SHADER_SOURCE, 2, 1, 1, -1, -1};
+        } else if (strcmp(name, "glDrawBuffers") == 0) {
+            function = {GL_CAPTURE_BUFFER_DATA, 1, 0, 4, -1, -1};
+        } else if (strcmp(name, "glClearBufferiv") == 0 || strcmp(name, "glClearBufferuiv") == 0 || strcmp(name, "glClearBufferfv") == 0) {
+            function = {GL_CAPTURE_BUFFER_DATA, 2, -1, 16, -1, -1};
+        } else if (strncmp(name, "glUniformMatrix", 15) == 0 && length >= 18) {
+            // glUniformMatrix4fv, glUniformMatrix2x3fv, ...: count matrices of N x M
+            int columns = name[15] - '0';
+            int rows = name[16] == 'x' ? name[17] - '0' : columns;
+            function = {GL_CAPTURE_UNIFORM_ARRAY, 3, 1, columns * rows * (name[length - 2] == 'd' ? 8 : 4), -1, -1};
+        } else if (strncmp(name, "glUniform", 9) == 0 && name[9] >= '1' && name[9] <= '4' && name[length - 1] == 'v') {
+            // glUniform3fv, glUniform4iv, glUniform2uiv, ...
+            function = {GL_CAPTURE_UNIFORM_ARRAY, 2, 1, (name[9] - '0') * (name[length - 2] == 'd' ? 8 : 4), -1, -1};
+        } else if (strncmp(name, "glGen", 5) == 0 && strncmp(name, "glGenerate", 10) != 0 && strcmp(argTypes, "ip") == 0) {
+            function = {GL_CAPTURE_GEN_NAMES, 1, 0, 4, -1, -1};
+        } else if (strncmp(name, "glDelete", 8) == 0 && strcmp(argTypes, "ip") == 0) {
+            function = {GL_CAPTURE_DELETE_NAMES, 1, 0, 4, -1, -1};
+        } else if (strcmp(name, "glGetUniformLocation") == 0 || strcmp(name, "glGetAttribLocation") == 0 ||
+                   strcmp(name, "glGetUniformBlockIndex") == 0 || strcmp(name, "glGetFragDataLocation") == 0) {
+            function = {GL_CAPTURE_NAME_STRING, 1, -1, 1, -1, -1};
+        } else if (strcmp(name, "glBindAttribLocation") == 0 || strcmp(name, "glBindFragDataLocation") == 0) {
+            function = {GL_CAPTURE_NAME_STRING, 2, -1, 1, -1, -1};
+        } else if (strcmp(name, "glVertexAttribPointer") == 0) {
+            function = {GL_CAPTURE_OFFSET, 5, -1, 1, -1, -1};
+        } else if (strcmp(name, "glVertexAttribIPointer") == 0 || strcmp(name, "glDrawRangeElements") == 0 ||
+                   strcmp(name, "glDrawRangeElementsBaseVertex") == 0) {
+            function = {GL_CAPTURE_OFFSET, strcmp(name, "glVertexAttribIPointer") == 0 ? 4 : 5, -1, 1, -1, -1};
+        } else if (strncmp(name, "glDrawElements", 14) == 0) {
+            // glDrawElements, glDrawElementsInstanced, glDrawElementsBaseVertex, ...
+            function = {GL_CAPTURE_OFFSET, 3, -1, 1, -1, -1};
+        } else if (strcmp(name, "glFenceSync") == 0 || strcmp(name, "glIsSync") == 0 || strcmp(name, "glDeleteSync") == 0 ||
+                   strcmp(name, "glClientWaitSync") == 0 || strcmp(name, "glWaitSync") == 0 || strcmp(name, "glGetSynciv") == 0) {
+            function = {GL_CAPTURE_SYNC, 0, -1, 1, -1, -1};
+        } else if (strcmp(name, "glTexImage2D") == 0) {
+            function = {GL_CAPTURE_IMAGE_UPLOAD, 8, -1, 1, 3, 6};
+        } else if (strcmp(name, "glTexSubImage2D") == 0) {
+            function = {GL_CAPTURE_IMAGE_UPLOAD, 8, -1, 1, 4, 6};
+        } else if (strcmp(name, "glReadPixels") == 0) {
+            function = {GL_CAPTURE_IMAGE_READ, 6, -1, 1, 2, 4};
+        }
+        return function;
+    }
+
+    // Bytes of a width x height image with rows padded to 4 bytes, the default GL_(UN)PACK_ALIGNMENT
+    static size_t imageSize(long long width, long long height, GLenum format, GLenum type)
+    {
+        if (width <= 0 || height <= 0) {
+            return 0;
+        }
+
+        size_t components = 4;
+        switch (format) {
+        case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX: case GL_DEPTH_STENCIL:
+            components = 1;
+            break;
+        case GL_RG: case GL_RG_INTEGER:
+            components = 2;
+            break;
+        case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+            components = 3;
+            break;
+        }
+
+        size_t pixel;
+        switch (type) {
+        case GL_UNSIGNED_BYTE: case GL_BYTE:
+            pixel = components;
+            break;
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+            pixel = components * 2;
+            break;
+        case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+            pixel = components * 4;
+            break;
+        case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+            pixel = 1;
+            break;
+        case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV: case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_4_4_4_4_REV: case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+            pixel = 2;
+            break;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+            pixel = 8;
+            break;
+        default:    // the packed 32-bit types
+            pixel = 4;
+            break;
+        }
+
+        size_t row = ((size_t)width * pixel + 3) & ~(size_t)3;
+        return row * (size_t)height;
+    }
+
+    static void writeVarint(std::vector<unsigned char> &out, unsigned long long value)
+    {
+        while (value >= 0x80) {
+            out.push_back((unsigned char)(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back((unsigned char)value);
+    }
+
+    static void writeU32(std::vector<unsigned char> &out, uint32_t value)
+    {
+        for (int shift = 0; shift < 32; shift += 8) {
+            out.push_back((unsigned char)(value >> shift));
+        }
+    }
+
+private:
+    // Bytes buffered before they go to the file
+    static const size_t FLUSH_BYTES = 1 << 20;
+
+    struct State {
+        bool recording = false;
+        std::thread::id thread;
+        std::string path;
+        std::ofstream file;
+        std::vector<unsigned char> buffer;
+        unsigned long long frames = 0;
+        unsigned long long calls = 0;
+        unsigned long long bytes = 0;
+        bool defined[GLAD_GL_FUNCTION_COUNT] = {};
+        GLCaptureFunction functions[GLAD_GL_FUNCTION_COUNT];
+    };
+
+    static State &get()
+    {
+        static State state;
+        return state;
+    }
+
+    static void flush()
+    {
+        State &state = get();
+        state.file.write((const char *)state.buffer.data(), (std::streamsize)state.buffer.size());
+        state.bytes += state.buffer.size();
+        state.buffer.clear();
+    }
+
+    static void writeString(std::vector<unsigned char> &out, const char *text, size_t length)
+    {
+        writeVarint(out, length);
+        out.insert(out.end(), text, text + length);
+    }
+
+#ifdef GLAD_CALL_HOOKS
+    static void writeValue(std::vector<unsigned char> &out, char type, unsigned long long raw)
+    {
+        switch (type) {
+        case 'i':
+            writeVarint(out, (raw << 1) ^ (unsigned long long)((long long)raw >> 63));
+            break;
+        case 'f':
+            for (int shift = 0; shift < 64; shift += 8) {
+                out.push_back((unsigned char)(raw >> shift));
+            }
+            break;
+        case 'p':
+            out.push_back(raw != 0 ? GL_CAPTURE_POINTER_VALUE : GL_CAPTURE_POINTER_NULL);
+            if (raw != 0) {
+                writeVarint(out, raw);
+            }
+            break;
+        default:
+            writeVarint(out, raw);
+            break;
+        }
+    }
+
+    static void writePayload(std::vector<unsigned char> &out, const void *data, size_t size)
+    {
+        out.push_back(GL_CAPTURE_POINTER_PAYLOAD);
+        writeVarint(out, size);
+        out.insert(out.end(), (const unsigned char *)data, (const unsigned char *)data + size);
+    }
+
+    static void writePointer(std::vector<unsigned char> &out, const GLCaptureFunction &function, const struct gladGLcall *call, int arg)
+    {
+        const unsigned long long *args = call->args;
+        const void *pointer = (const void *)(size_t)args[arg];
+        if (pointer == nullptr) {
+            out.push_back(GL_CAPTURE_POINTER_NULL);
+            return;
+        }
+        if (arg != function.pointerArg) {
+            out.push_back(GL_CAPTURE_POINTER_OUTPUT);
+            writeVarint(out, 0);
+            return;
+        }
+
+        size_t count = function.sizeArg >= 0 ? (size_t)(long long)args[function.sizeArg] : 1;
+        switch (function.kind) {
+        case GL_CAPTURE_BUFFER_DATA:
+        case GL_CAPTURE_UNIFORM_ARRAY:
+        case GL_CAPTURE_GEN_NAMES:
+        case GL_CAPTURE_DELETE_NAMES:
+            writePayload(out, pointer, count * function.elementSize);
+            break;
+        case GL_CAPTURE_SHADER_SOURCE: {
+            const char *const *strings = (const char *const *)pointer;
+            const GLint *lengths = (const GLint *)(size_t)args[3];
+            std::string source;
+            for (size_t i = 0; i < count; i++) {
+                if (lengths != nullptr && lengths[i] >= 0) {
+                    source.append(strings[i], lengths[i]);
+                } else {
+                    source.append(strings[i]);
+                }
+            }
+            writePayload(out, source.c_str(), source.size() + 1);
+            break;
+        }
+        case GL_CAPTURE_NAME_STRING:
+            writePayload(out, pointer, strlen((const char *)pointer) + 1);
+            break;
+        case GL_CAPTURE_OFFSET:
+        case GL_CAPTURE_SYNC:
+            out.push_back(GL_CAPTURE_POINTER_VALUE);
+            writeVarint(out, args[arg]);
+            break;
+        case GL_CAPTURE_IMAGE_UPLOAD:
+            writePayload(out, pointer, imageSize((long long)args[function.widthArg], (long long)args[function.widthArg + 1],
+                                                 (GLenum)args[function.formatArg], (GLenum)args[function.formatArg + 1]));
+            break;
+        case GL_CAPTURE_IMAGE_READ:
+            out.push_back(GL_CAPTURE_POINTER_OUTPUT);
+            writeVarint(out, imageSize((long long)args[function.widthArg], (long long)args[function.widthArg + 1],
+                                       (GLenum)args[function.formatArg], (GLenum)args[function.formatArg + 1]));
+            break;
+        default:
+            out.push_back(GL_CAPTURE_POINTER_OUTPUT);
+            writeVarint(out, 0);
+            break;
+        }
+    }
+
+    // Runs after the real call, so glGen* names and results are there to record
+    static void after(struct gladGLcall *call)
+    {
+        State &state = get();
+        if (!state.recording || std::this_thread::get_id() != state.thread) {
+            return;
+        }
+
+        std::vector<unsigned char> &out = state.buffer;
+        if (!state.defined[call->index]) {
+            state.defined[call->index] = true;
+            state.functions[call->index] = classify(call->name, call->argTypes);
+            writeVarint(out, GL_CAPTURE_FUNCTION);
+            writeVarint(out, (unsigned long long)call->index);
+            writeString(out, call->name, strlen(call->name));
+            writeString(out, call->argTypes, strlen(call->argTypes));
+            out.push_back((unsigned char)call->resultType);
+        }
+
+        const GLCaptureFunction &function = state.functions[call->index];
+        writeVarint(out, GL_CAPTURE_CALL + (unsigned long long)call->index);
+        for (int arg = 0; call->argTypes[arg] != 0; arg++) {
+            if (function.kind == GL_CAPTURE_SHADER_SOURCE && arg == 1) {
+                // The sources go in as one string
+                writeValue(out, 'i', 1);
+            } else if (function.kind == GL_CAPTURE_SHADER_SOURCE && arg == 3) {
+                out.push_back(GL_CAPTURE_POINTER_NULL);
+            } else if (call->argTypes[arg] == 'p') {
+                writePointer(out, function, call, arg);
+            } else {
+                writeValue(out, call->argTypes[arg], call->args[arg]);
+            }
+        }
+        if (call->resultType != 'v') {
+            writeValue(out, call->resultType, call->result);
+        }
+        state.calls++;
+    }
+#endif
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,794 @@
+/*
+    Plays back a GL call stream written by renderer/gl_capture.h (build with GLAD_CALL_HOOKS).
+
+    load() decodes the whole file once into a flat array of commands, with every
+    payload copied into one 8-byte aligned arena, so run() does nothing but
+    turn commands back into calls. A run goes to a ReplayBackend:
+      GLReplayBackend        the current GL context, through gladInvokeCall();
+                             the stream's framebuffer 0 becomes an offscreen
+                             framebuffer object, so no window has to be shown
+      SoftwareReplayBackend  renderer/software_rasterizer.h; the GLSL programs
+                             are matched by source to C++ stand-ins registered
+                             with addProgram()
+
+    Object names are not assumed to come out the same: names the stream got
+    from glGen*, glCreateShader/glCreateProgram, glGetUniformLocation and
+    glFenceSync are mapped to whatever the backend returns, and every argument
+    known to hold such a name (see objectKinds()) is translated on the way in.
+    Output pointers get scratch memory. Each run() starts with empty maps, so a
+    capture that deletes what it created can be looped for a throughput number.
+*/
+
+#ifndef RENDERER_GL_REPLAY_H
+#define RENDERER_GL_REPLAY_H
+
+#include <glad/glad.h>
+
+#include "gl_capture.h"
+#include "hash.h"
+#include "software_rasterizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifndef GLAD_CALL_HOOKS
+#error "renderer/gl_replay.h replays through gladGLcall; build with -DGLAD_CALL_HOOKS (make trace=1)"
+#endif
+
+namespace renderer {
+
+class ReplayBackend {
+public:
+    virtual ~ReplayBackend() {}
+
+    virtual const char *name() const = 0;
+
+    // Called once per function in the stream before a run; -1 skips its calls
+    virtual int resolve(const char *function) = 0;
+
+    // call->args hold the translated arguments; functions that return something set call->result
+    virtual void invoke(int function, struct gladGLcall *call) = 0;
+
+    // What the stream's framebuffer 0 turns into
+    virtual unsigned int defaultFramebuffer() { return 0; }
+
+    // Where the capture swapped buffers
+    virtual void endFrame() {}
+
+    // Waits for everything submitted and hashes the color buffer
+    virtual uint64_t finish() = 0;
+};
+
+struct GLReplayStats {
+    unsigned long long frames;
+    unsigned long long calls;       // calls the backend ran
+    unsigned long long skipped;     // calls to functions the backend doesn't have
+    double milliseconds;
+    uint64_t checksum;
+};
+
+class GLReplay {
+public:
+    bool load(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            std::cout << "ERROR::GL_REPLAY::FILE_NOT_READ " << path << std::endl;
+            return false;
+        }
+        std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        functions.clear();
+        commands.clear();
+        arena.clear();
+        frames = 0;
+        Reader reader = {bytes.data(), bytes.data() + bytes.size(), true};
+        if (bytes.size() < 16 || memcmp(bytes.data(), "GLCP", 4) != 0) {
+            std::cout << "ERROR::GL_REPLAY::NOT_A_CAPTURE " << path << std::endl;
+            return false;
+        }
+        reader.position += 4;
+        uint32_t version = reader.u32();
+        targetWidth = (int)reader.u32();
+        targetHeight = (int)reader.u32();
+        if (version != GL_CAPTURE_VERSION) {
+            std::cout << "ERROR::GL_REPLAY::UNSUPPORTED_VERSION " << version << std::endl;
+            return false;
+        }
+
+        // Ids in the file are glad indices of the capturing build; map them to functions here
+        std::vector<int> ids;
+        bool ended = false;
+        while (reader.ok && !ended && reader.position < reader.end) {
+            unsigned long long opcode = reader.varint();
+            if (opcode == GL_CAPTURE_FRAME) {
+                Command command = {};
+                command.function = -1;
+                commands.push_back(command);
+                frames++;
+            } else if (opcode == GL_CAPTURE_END) {
+                ended = true;
+            } else if (opcode == GL_CAPTURE_FUNCTION) {
+                unsigned long long id = reader.varint();
+                Function function;
+                function.name = reader.string();
+                function.argTypes = reader.string();
+                function.resultType = (char)reader.byte();
+                if (id >= 65536 || function.argTypes.size() > GLAD_CALL_MAX_ARGS) {
+                    reader.ok = false;
+                    break;
+                }
+                function.capture = GLCapture::classify(function.name.c_str(), function.argTypes.c_str());
+                objectKinds(function.name.c_str(), function.argTypes.size(), function.objects, function.resultObject);
+                function.usesProgram = function.name == "glUseProgram";
+                if (ids.size() <= id) {
+                    ids.resize(id + 1, -1);
+                }
+                ids[id] = (int)functions.size();
+                functions.push_back(function);
+            } else if (opcode >= GL_CAPTURE_CALL && opcode - GL_CAPTURE_CALL < ids.size() && ids[opcode - GL_CAPTURE_CALL] >= 0) {
+                readCommand(reader, ids[opcode - GL_CAPTURE_CALL]);
+            } else {
+                reader.ok = false;
+            }
+        }
+
+        if (!reader.ok) {
+            std::cout << "ERROR::GL_REPLAY::CORRUPT_FILE " << path << " at byte " << (reader.position - bytes.data()) << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    int width() const { return targetWidth; }
+    int height() const { return targetHeight; }
+    unsigned long long frameCount() const { return frames; }
+    size_t callCount() const { return commands.size() - frames; }
+
+    // Runs the whole stream once against backend
+    GLReplayStats run(ReplayBackend &backend)
+    {
+        GLReplayStats stats = {0, 0, 0, 0.0, 0};
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<int> resolved(functions.size());
+        for (size_t i = 0; i < functions.size(); i++) {
+            resolved[i] = backend.resolve(functions[i].name.c_str());
+        }
+        for (std::unordered_map<unsigned long long, unsigned long long> &names : objects) {
+            names.clear();
+        }
+        locations.clear();
+        objects[objectSlot('F')][0] = backend.defaultFramebuffer();
+        currentProgram = 0;
+
+        for (const Command &command : commands) {
+            if (command.function < 0) {
+                backend.endFrame();
+                stats.frames++;
+                continue;
+            }
+            int target = resolved[command.function];
+            if (target < 0) {
+                stats.skipped++;
+                continue;
+            }
+            execute(backend, target, functions[command.function], command);
+            stats.calls++;
+        }
+
+        stats.checksum = backend.finish();
+        stats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return stats;
+    }
+
+    // Which arguments (and result) of a function hold object names: B buffer, V vertex array,
+    // T texture, F framebuffer, R renderbuffer, P program or shader, Q query, S sampler,
+    // X transform feedback, Y sync, L uniform location, '.' anything else
+    static void objectKinds(const char *name, size_t argCount, std::string &arguments, char &result)
+    {
+        static const char *const TABLE[][2] = {
+            {"glBindBuffer", ".B"}, {"glBindBufferBase", "..B"}, {"glBindBufferRange", "..B.."}, {"glIsBuffer", "B"},
+            {"glBindVertexArray", "V"}, {"glIsVertexArray", "V"},
+            {"glBindTexture", ".T"}, {"glIsTexture", "T"}, {"glFramebufferTexture", "..T."},
+            {"glFramebufferTexture1D", "...T."}, {"glFramebufferTexture2D", "...T."}, {"glFramebufferTexture3D", "...T.."},
+            {"glFramebufferTextureLayer", "..T.."},
+            {"glBindFramebuffer", ".F"}, {"glIsFramebuffer", "F"},
+            {"glBindRenderbuffer", ".R"}, {"glIsRenderbuffer", "R"}, {"glFramebufferRenderbuffer", "...R"},
+            {"glShaderSource", "P"}, {"glCompileShader", "P"}, {"glGetShaderiv", "P"}, {"glGetShaderInfoLog", "P"},
+            {"glGetShaderSource", "P"}, {"glDeleteShader", "P"}, {"glIsShader", "P"}, {"glAttachShader", "PP"},
+            {"glDetachShader", "PP"}, {"glLinkProgram", "P"}, {"glValidateProgram", "P"}, {"glGetProgramiv", "P"},
+            {"glGetProgramInfoLog", "P"}, {"glUseProgram", "P"}, {"glDeleteProgram", "P"}, {"glIsProgram", "P"},
+            {"glGetAttachedShaders", "P"}, {"glGetUniformLocation", "P"}, {"glGetAttribLocation", "P"},
+            {"glBindAttribLocation", "P"}, {"glBindFragDataLocation", "P"}, {"glGetFragDataLocation", "P"},
+            {"glGetActiveUniform", "P"}, {"glGetActiveAttrib", "P"}, {"glGetActiveUniformsiv", "P"},
+            {"glGetActiveUniformName", "P"}, {"glGetUniformIndices", "P"}, {"glGetUniformBlockIndex", "P"},
+            {"glGetActiveUniformBlockiv", "P"}, {"glGetActiveUniformBlockName", "P"}, {"glUniformBlockBinding", "P"},
+            {"glGetUniformfv", "PL"}, {"glGetUniformiv", "PL"}, {"glGetUniformuiv", "PL"},
+            {"glProgramParameteri", "P"}, {"glGetProgramBinary", "P"}, {"glProgramBinary", "P"},
+            {"glTransformFeedbackVaryings", "P"}, {"glGetTransformFeedbackVarying", "P"},
+            {"glBeginQuery", ".Q"}, {"glQueryCounter", "Q"}, {"glIsQuery", "Q"}, {"glBeginConditionalRender", "Q"},
+            {"glGetQueryObjectiv", "Q"}, {"glGetQueryObjectuiv", "Q"}, {"glGetQueryObjecti64v", "Q"},
+            {"glGetQueryObjectui64v", "Q"},
+            {"glBindSampler", ".S"}, {"glIsSampler", "S"},
+            {"glBindTransformFeedback", ".X"}, {"glIsTransformFeedback", "X"},
+            {"glIsSync", "Y"}, {"glDeleteSync", "Y"}, {"glClientWaitSync", "Y"}, {"glWaitSync", "Y"}, {"glGetSynciv", "Y"}
+        };
+        static const char *const GEN_SUFFIXES[][2] = {
+            {"Buffers", "B"}, {"VertexArrays", "V"}, {"Textures", "T"}, {"Framebuffers", "F"}, {"Renderbuffers", "R"},
+            {"Queries", "Q"}, {"Samplers", "S"}, {"TransformFeedbacks", "X"}
+        };
+
+        arguments.assign(argCount, '.');
+        result = '.';
+
+        const char *kinds = nullptr;
+        for (const auto &entry : TABLE) {
+            if (strcmp(name, entry[0]) == 0) {
+                kinds = entry[1];
+                break;
+            }
+        }
+        if (strncmp(name, "glGen", 5) == 0 || strncmp(name, "glDelete", 8) == 0) {
+            const char *suffix = name + (name[2] == 'G' ? 5 : 8);
+            for (const auto &entry : GEN_SUFFIXES) {
+                if (strcmp(suffix, entry[0]) == 0) {
+                    kinds = entry[1];   // the names in the array, not the first argument
+                    result = entry[1][0];
+                    break;
+                }
+            }
+            if (kinds != nullptr && argCount == 2) {
+                return;
+            }
+        }
+        if (kinds == nullptr && strncmp(name, "glUniform", 9) == 0 && strcmp(name, "glUniformBlockBinding") != 0) {
+            kinds = "L";
+        } else if (kinds == nullptr && (strncmp(name, "glSamplerParameter", 18) == 0 || strncmp(name, "glGetSamplerParameter", 21) == 0)) {
+            kinds = "S";
+        }
+        for (size_t i = 0; kinds != nullptr && kinds[i] != 0 && i < argCount; i++) {
+            arguments[i] = kinds[i];
+        }
+
+        if (strcmp(name, "glCreateShader") == 0 || strcmp(name, "glCreateProgram") == 0) {
+            result = 'P';
+        } else if (strcmp(name, "glGetUniformLocation") == 0) {
+            result = 'L';
+        } else if (strcmp(name, "glFenceSync") == 0) {
+            result = 'Y';
+        }
+    }
+
+private:
+    struct Function {
+        std::string name;
+        std::string argTypes;
+        char resultType;
+        GLCaptureFunction capture;
+        std::string objects;    // object kind per argument, see objectKinds()
+        char resultObject;      // for glGen*/glDelete* the kind of the names in the array
+        bool usesProgram;
+    };
+
+    struct Command {
+        int function;               // index into functions, -1 for the end of a frame
+        unsigned short payloadMask; // arguments holding an offset into the arena
+        unsigned short outputMask;  // arguments holding the size of an output
+        unsigned long long args[GLAD_CALL_MAX_ARGS];
+        unsigned long long result;  // what the call returned at capture time
+    };
+
+    struct Reader {
+        const unsigned char *position;
+        const unsigned char *end;
+        bool ok;
+
+        unsigned char byte()
+        {
+            if (position >= end) {
+                ok = false;
+                return 0;
+            }
+            return *position++;
+        }
+
+        unsigned long long varint()
+        {
+            unsigned long long value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                unsigned char next = byte();
+                value |= (unsigned long long)(next & 0x7F) << shift;
+                if (!(next & 0x80)) {
+                    return value;
+                }
+            }
+            ok = false;
+            return 0;
+        }
+
+        uint32_t u32()
+        {
+            uint32_t value = 0;
+            for (int shift = 0; shift < 32; shift += 8) {
+                value |= (uint32_t)byte() << shift;
+            }
+            return value;
+        }
+
+        std::string string()
+        {
+            unsigned long long length = varint();
+            if (length > (unsigned long long)(end - position)) {
+                ok = false;
+                return std::string();
+            }
+            std::string text((const char *)position, (size_t)length);
+            position += length;
+            return text;
+        }
+
+        unsigned long long value(char type)
+        {
+            if (type == 'i') {
+                unsigned long long zigzag = varint();
+                return (zigzag >> 1) ^ (0 - (zigzag & 1));
+            }
+            if (type == 'f') {
+                unsigned long long raw = 0;
+                for (int shift = 0; shift < 64; shift += 8) {
+                    raw |= (unsigned long long)byte() << shift;
+                }
+                return raw;
+            }
+            if (type == 'p') {
+                return byte() == GL_CAPTURE_POINTER_VALUE ? varint() : 0;
+            }
+            return varint();
+        }
+    };
+
+    static const char *objectSlots() { return "BVTFRPQSXY"; }
+
+    static int objectSlot(char kind)
+    {
+        const char *slot = strchr(objectSlots(), kind);
+        return kind != 0 && slot != nullptr ? (int)(slot - objectSlots()) : -1;
+    }
+
+    void readCommand(Reader &reader, int index)
+    {
+        const Function &function = functions[index];
+        Command command = {};
+        command.function = index;
+
+        for (size_t arg = 0; arg < function.argTypes.size(); arg++) {
+            if (function.argTypes[arg] != 'p') {
+                command.args[arg] = reader.value(function.argTypes[arg]);
+                continue;
+            }
+            unsigned char tag = reader.byte();
+            if (tag == GL_CAPTURE_POINTER_VALUE) {
+                command.args[arg] = reader.varint();
+            } else if (tag == GL_CAPTURE_POINTER_OUTPUT) {
+                command.args[arg] = reader.varint();
+                command.outputMask |= 1 << arg;
+            } else if (tag == GL_CAPTURE_POINTER_PAYLOAD) {
+                unsigned long long size = reader.varint();
+                if (size > (unsigned long long)(reader.end - reader.position)) {
+                    reader.ok = false;
+                    return;
+                }
+                // Padded to 8 bytes, so uniform arrays and names are read aligned
+                size_t offset = arena.size() * sizeof(unsigned long long);
+                arena.resize(arena.size() + (size_t)(size + 7) / 8);
+                memcpy((unsigned char *)arena.data() + offset, reader.position, (size_t)size);
+                reader.position += size;
+                command.args[arg] = offset;
+                command.payloadMask |= 1 << arg;
+            } else if (tag != GL_CAPTURE_POINTER_NULL) {
+                reader.ok = false;
+                return;
+            }
+        }
+        if (function.resultType != 'v') {
+            command.result = reader.value(function.resultType);
+        }
+        commands.push_back(command);
+    }
+
+    // Output memory for argument arg, at least size bytes
+    void *scratchFor(int arg, unsigned long long size)
+    {
+        std::vector<unsigned long long> &memory = scratch[arg];
+        size_t words = (size_t)std::max<unsigned long long>(size, 4096) / 8 + 1;
+        if (memory.size() < words) {
+            memory.resize(words);
+        }
+        return memory.data();
+    }
+
+    unsigned long long translate(char kind, unsigned long long name, unsigned long long program) const
+    {
+        if (kind == 'L') {
+            auto location = locations.find((program << 32) | (name & 0xFFFFFFFFull));
+            return location != locations.end() ? location->second : name;
+        }
+        int slot = objectSlot(kind);
+        if (slot < 0 || (name == 0 && kind != 'F')) {
+            return name;
+        }
+        auto found = objects[slot].find(name);
+        return found != objects[slot].end() ? found->second : name;
+    }
+
+    void execute(ReplayBackend &backend, int target, const Function &function, const Command &command)
+    {
+        struct gladGLcall call;
+        call.result = 0;
+        size_t argCount = function.argTypes.size();
+        for (size_t arg = 0; arg < argCount; arg++) {
+            unsigned long long raw = command.args[arg];
+            if (command.payloadMask & (1 << arg)) {
+                raw = (unsigned long long)(size_t)((const unsigned char *)arena.data() + raw);
+            } else if (command.outputMask & (1 << arg)) {
+                raw = (unsigned long long)(size_t)scratchFor((int)arg, raw);
+            } else if (function.objects[arg] != '.') {
+                // A location belongs to the program passed along, or else to the one in use
+                unsigned long long program = function.objects[0] == 'P' ? command.args[0] : currentProgram;
+                raw = translate(function.objects[arg], raw, program);
+            }
+            call.args[arg] = raw;
+        }
+
+        const GLCaptureFunction &capture = function.capture;
+        GLsizei count = capture.sizeArg >= 0 ? (GLsizei)command.args[capture.sizeArg] : 0;
+        const GLuint *capturedNames = (const GLuint *)(size_t)call.args[1];
+        int slot = objectSlot(function.resultObject);
+        if (capture.kind == GL_CAPTURE_SHADER_SOURCE) {
+            // glShaderSource wants an array of strings
+            sourcePointer = (const char *)(size_t)call.args[2];
+            call.args[2] = (unsigned long long)(size_t)&sourcePointer;
+        } else if (capture.kind == GL_CAPTURE_GEN_NAMES && (command.payloadMask & 2)) {
+            call.args[1] = (unsigned long long)(size_t)scratchFor(1, (unsigned long long)count * 4);
+        } else if (capture.kind == GL_CAPTURE_DELETE_NAMES && (command.payloadMask & 2) && slot >= 0) {
+            GLuint *names = (GLuint *)scratchFor(1, (unsigned long long)count * 4);
+            for (GLsizei i = 0; i < count; i++) {
+                names[i] = capturedNames[i] != 0 ? (GLuint)translate(function.resultObject, capturedNames[i], 0) : 0;
+                objects[slot].erase(capturedNames[i]);
+            }
+            call.args[1] = (unsigned long long)(size_t)names;
+        }
+
+        backend.invoke(target, &call);
+
+        if (function.usesProgram) {
+            currentProgram = command.args[0];
+        }
+        if (capture.kind == GL_CAPTURE_GEN_NAMES && (command.payloadMask & 2) && slot >= 0) {
+            const GLuint *names = (const GLuint *)(size_t)call.args[1];
+            for (GLsizei i = 0; i < count; i++) {
+                objects[slot][capturedNames[i]] = names[i];
+            }
+        } else if (function.resultObject == 'L') {
+            if ((long long)command.result >= 0) {
+                locations[(command.args[0] << 32) | (command.result & 0xFFFFFFFFull)] = call.result;
+            }
+        } else if (slot >= 0 && function.resultType != 'v') {
+            objects[slot][command.result] = call.result;
+        }
+    }
+
+    std::vector<Function> functions;
+    std::vector<Command> commands;
+    std::vector<unsigned long long> arena;
+    unsigned long long frames = 0;
+    int targetWidth = 0;
+    int targetHeight = 0;
+
+    // Run state: captured name -> backend name per object kind, (program, location) -> location
+    std::unordered_map<unsigned long long, unsigned long long> objects[10];
+    std::unordered_map<unsigned long long, unsigned long long> locations;
+    unsigned long long currentProgram = 0;
+    std::vector<unsigned long long> scratch[GLAD_CALL_MAX_ARGS];
+    const char *sourcePointer = nullptr;
+};
+
+/* BACKENDS */
+
+// The current GL context; renders into a framebuffer object of the capture's size
+class GLReplayBackend : public ReplayBackend {
+public:
+    GLReplayBackend(int width, int height)
+        : targetWidth(width), targetHeight(height)
+    {
+        glGenRenderbuffers(1, &colorBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            std::cout << "ERROR::GL_REPLAY::FRAMEBUFFER_INCOMPLETE" << std::endl;
+        }
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    }
+
+    ~GLReplayBackend() override
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &framebuffer);
+        glDeleteRenderbuffers(1, &colorBuffer);
+    }
+
+    const char *name() const override { return "gl"; }
+
+    int resolve(const char *function) override
+    {
+        return gladFindFunction(function);
+    }
+
+    void invoke(int function, struct gladGLcall *call) override
+    {
+        call->index = function;
+        gladInvokeCall(call);
+    }
+
+    unsigned int defaultFramebuffer() override { return framebuffer; }
+
+    void endFrame() override
+    {
+        glFlush();
+    }
+
+    uint64_t finish() override
+    {
+        std::vector<unsigned char> pixels((size_t)targetWidth * targetHeight * 4);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glReadPixels(0, 0, targetWidth, targetHeight, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        return hashBytes(pixels.data(), pixels.size());
+    }
+
+private:
+    int targetWidth, targetHeight;
+    unsigned int framebuffer = 0;
+    unsigned int colorBuffer = 0;
+};
+
+// A C++ stand-in for one GLSL program; uniforms are vec4 slots, in this order, handed to the stages
+struct SoftwareReplayProgram {
+    const char *vertexSource;
+    const char *fragmentSource;
+    SwProgram stages;
+    std::vector<std::string> uniforms;
+};
+
+// renderer/software_rasterizer.h; runs the calls it has an equivalent for and skips the rest
+class SoftwareReplayBackend : public ReplayBackend {
+public:
+    SoftwareReplayBackend(int width, int height, unsigned int threadCount = 0)
+        : raster(width, height, threadCount)
+    {
+        objects.emplace_back();
+    }
+
+    void addProgram(const SoftwareReplayProgram &program)
+    {
+        registered[programKey(program.vertexSource, program.fragmentSource)] = program;
+    }
+
+    SoftwareRasterizer &rasterizer() { return raster; }
+
+    const char *name() const override { return "software"; }
+
+    int resolve(const char *function) override
+    {
+        static const char *const NAMES[] = {
+            "glViewport", "glClearColor", "glClear", "glGenBuffers", "glDeleteBuffers", "glBindBuffer", "glBufferData",
+            "glBufferSubData", "glGenVertexArrays", "glDeleteVertexArrays", "glBindVertexArray", "glVertexAttribPointer",
+            "glEnableVertexAttribArray", "glDisableVertexAttribArray", "glVertexAttribDivisor", "glCreateShader",
+            "glShaderSource", "glCreateProgram", "glAttachShader", "glLinkProgram", "glUseProgram", "glDeleteProgram",
+            "glGetUniformLocation", "glUniform1f", "glUniform2f", "glUniform3f", "glUniform4f", "glUniform1i",
+            "glUniform1fv", "glUniform2fv", "glUniform3fv", "glUniform4fv", "glUniformMatrix4fv", "glDrawArrays",
+            "glDrawElements", "glDrawArraysInstanced", "glDrawElementsInstanced", "glEnable", "glDisable",
+            "glPrimitiveRestartIndex"
+        };
+        for (size_t i = 0; i < sizeof(NAMES) / sizeof(NAMES[0]); i++) {
+            if (strcmp(function, NAMES[i]) == 0) {
+                return (int)i;
+            }
+        }
+        return -1;
+    }
+
+    void invoke(int function, struct gladGLcall *call) override
+    {
+        const unsigned long long *a = call->args;
+        switch (function) {
+        case VIEWPORT: raster.viewport((int)a[0], (int)a[1], (int)a[2], (int)a[3]); break;
+        case CLEAR_COLOR: raster.clearColor(real(a[0]), real(a[1]), real(a[2]), real(a[3])); break;
+        case CLEAR: raster.clear((GLbitfield)a[0]); break;
+        case GEN_BUFFERS: raster.genBuffers((int)a[0], (unsigned int *)pointer(a[1])); break;
+        case DELETE_BUFFERS: raster.deleteBuffers((int)a[0], (const unsigned int *)pointer(a[1])); break;
+        case BIND_BUFFER: raster.bindBuffer((GLenum)a[0], (unsigned int)a[1]); break;
+        case BUFFER_DATA: raster.bufferData((GLenum)a[0], (size_t)a[1], pointer(a[2]), (GLenum)a[3]); break;
+        case BUFFER_SUB_DATA: raster.bufferSubData((GLenum)a[0], (size_t)a[1], (size_t)a[2], pointer(a[3])); break;
+        case GEN_VERTEX_ARRAYS: raster.genVertexArrays((int)a[0], (unsigned int *)pointer(a[1])); break;
+        case DELETE_VERTEX_ARRAYS: raster.deleteVertexArrays((int)a[0], (const unsigned int *)pointer(a[1])); break;
+        case BIND_VERTEX_ARRAY: raster.bindVertexArray((unsigned int)a[0]); break;
+        case VERTEX_ATTRIB_POINTER:
+            raster.vertexAttribPointer((unsigned int)a[0], (int)a[1], (GLenum)a[2], (GLboolean)a[3], (int)a[4], pointer(a[5]));
+            break;
+        case ENABLE_VERTEX_ATTRIB_ARRAY: raster.enableVertexAttribArray((unsigned int)a[0]); break;
+        case DISABLE_VERTEX_ATTRIB_ARRAY: raster.disableVertexAttribArray((unsigned int)a[0]); break;
+        case VERTEX_ATTRIB_DIVISOR: raster.vertexAttribDivisor((unsigned int)a[0], (unsigned int)a[1]); break;
+        case CREATE_SHADER:
+        case CREATE_PROGRAM:
+            objects.emplace_back();
+            objects.back().shaderType = function == CREATE_SHADER ? (GLenum)a[0] : 0;
+            call->result = objects.size() - 1;
+            break;
+        case SHADER_SOURCE:
+            if (valid(a[0])) {
+                objects[a[0]].source = *(const char *const *)pointer(a[2]);
+            }
+            break;
+        case ATTACH_SHADER:
+            if (valid(a[0]) && valid(a[1])) {
+                objects[a[0]].attached.push_back((unsigned int)a[1]);
+            }
+            break;
+        case LINK_PROGRAM: linkProgram(a[0]); break;
+        case USE_PROGRAM:
+            current = valid(a[0]) ? (unsigned int)a[0] : 0;
+            raster.useProgram(objects[current].raster);
+            break;
+        case DELETE_PROGRAM:
+            if (valid(a[0])) {
+                raster.deleteProgram(objects[a[0]].raster);
+                objects[a[0]] = Object();
+            }
+            break;
+        case GET_UNIFORM_LOCATION: call->result = (unsigned long long)(long long)uniformLocation(a[0], (const char *)pointer(a[1])); break;
+        case UNIFORM_1F: case UNIFORM_2F: case UNIFORM_3F: case UNIFORM_4F: {
+            float values[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            for (int i = 0; i <= function - UNIFORM_1F; i++) {
+                values[i] = real(a[1 + i]);
+            }
+            setUniform((int)(long long)a[0], values, function - UNIFORM_1F + 1, 1);
+            break;
+        }
+        case UNIFORM_1I: {
+            float value = (float)(int)(long long)a[1];
+            setUniform((int)(long long)a[0], &value, 1, 1);
+            break;
+        }
+        case UNIFORM_1FV: case UNIFORM_2FV: case UNIFORM_3FV: case UNIFORM_4FV:
+            setUniform((int)(long long)a[0], (const float *)pointer(a[2]), function - UNIFORM_1FV + 1, (int)a[1]);
+            break;
+        case UNIFORM_MATRIX_4FV: setUniform((int)(long long)a[0], (const float *)pointer(a[3]), 4, (int)a[1] * 4); break;
+        case DRAW_ARRAYS: raster.drawArrays((GLenum)a[0], (int)a[1], (int)a[2]); break;
+        case DRAW_ELEMENTS: raster.drawElements((GLenum)a[0], (int)a[1], (GLenum)a[2], pointer(a[3])); break;
+        case DRAW_ARRAYS_INSTANCED: raster.drawArraysInstanced((GLenum)a[0], (int)a[1], (int)a[2], (int)a[3]); break;
+        case DRAW_ELEMENTS_INSTANCED:
+            raster.drawElementsInstanced((GLenum)a[0], (int)a[1], (GLenum)a[2], pointer(a[3]), (int)a[4]);
+            break;
+        case ENABLE: raster.enable((GLenum)a[0]); break;
+        case DISABLE: raster.disable((GLenum)a[0]); break;
+        case PRIMITIVE_RESTART_INDEX: raster.primitiveRestartIndex((unsigned int)a[0]); break;
+        }
+    }
+
+    void endFrame() override
+    {
+        raster.finish();
+    }
+
+    uint64_t finish() override
+    {
+        return hashBytes(raster.pixels(), (size_t)raster.width() * raster.height() * 4);
+    }
+
+private:
+    // Same order as the names in resolve()
+    enum Operation {
+        VIEWPORT, CLEAR_COLOR, CLEAR, GEN_BUFFERS, DELETE_BUFFERS, BIND_BUFFER, BUFFER_DATA,
+        BUFFER_SUB_DATA, GEN_VERTEX_ARRAYS, DELETE_VERTEX_ARRAYS, BIND_VERTEX_ARRAY, VERTEX_ATTRIB_POINTER,
+        ENABLE_VERTEX_ATTRIB_ARRAY, DISABLE_VERTEX_ATTRIB_ARRAY, VERTEX_ATTRIB_DIVISOR, CREATE_SHADER,
+        SHADER_SOURCE, CREATE_PROGRAM, ATTACH_SHADER, LINK_PROGRAM, USE_PROGRAM, DELETE_PROGRAM,
+        GET_UNIFORM_LOCATION, UNIFORM_1F, UNIFORM_2F, UNIFORM_3F, UNIFORM_4F, UNIFORM_1I,
+        UNIFORM_1FV, UNIFORM_2FV, UNIFORM_3FV, UNIFORM_4FV, UNIFORM_MATRIX_4FV, DRAW_ARRAYS,
+        DRAW_ELEMENTS, DRAW_ARRAYS_INSTANCED, DRAW_ELEMENTS_INSTANCED, ENABLE, DISABLE,
+        PRIMITIVE_RESTART_INDEX
+    };
+
+    // Shaders and programs share one namespace, as in GL
+    struct Object {
+        GLenum shaderType = 0;              // 0 for a program
+        std::string source;
+        std::vector<unsigned int> attached;
+        const SoftwareReplayProgram *program = nullptr;
+        unsigned int raster = 0;
+        std::vector<float> uniforms;
+    };
+
+    static float real(unsigned long long raw)
+    {
+        double value;
+        memcpy(&value, &raw, sizeof(value));
+        return (float)value;
+    }
+
+    static const void *pointer(unsigned long long raw) { return (const void *)(size_t)raw; }
+
+    static uint64_t programKey(const char *vertexSource, const char *fragmentSource)
+    {
+        return hashString(fragmentSource, hashString(vertexSource));
+    }
+
+    bool valid(unsigned long long id) const { return id != 0 && id < objects.size(); }
+
+    void linkProgram(unsigned long long id)
+    {
+        if (!valid(id)) {
+            return;
+        }
+        Object &object = objects[id];
+        std::string vertexSource, fragmentSource;
+        for (unsigned int shader : object.attached) {
+            if (valid(shader)) {
+                (objects[shader].shaderType == GL_VERTEX_SHADER ? vertexSource : fragmentSource) += objects[shader].source;
+            }
+        }
+
+        auto found = registered.find(programKey(vertexSource.c_str(), fragmentSource.c_str()));
+        if (found == registered.end()) {
+            std::cout << "ERROR::GL_REPLAY::NO_SOFTWARE_PROGRAM program " << id << " draws nothing" << std::endl;
+            return;
+        }
+        raster.deleteProgram(object.raster);
+        object.program = &found->second;
+        object.raster = raster.createProgram(found->second.stages);
+        object.uniforms.assign(found->second.uniforms.size() * 4, 0.0f);
+    }
+
+    int uniformLocation(unsigned long long id, const char *name) const
+    {
+        if (!valid(id) || objects[id].program == nullptr || name == nullptr) {
+            return -1;
+        }
+        const std::vector<std::string> &uniforms = objects[id].program->uniforms;
+        auto found = std::find(uniforms.begin(), uniforms.end(), name);
+        return found != uniforms.end() ? (int)(found - uniforms.begin()) : -1;
+    }
+
+    // count slots of components floats each, starting at location
+    void setUniform(int location, const float *values, int components, int count)
+    {
+        Object &object = objects[current];
+        if (location < 0 || values == nullptr || current == 0) {
+            return;
+        }
+        for (int i = 0; i < count && (size_t)(location + i) * 4 + 4 <= object.uniforms.size(); i++) {
+            memcpy(&object.uniforms[(size_t)(location + i) * 4], values + i * components, components * sizeof(float));
+        }
+        raster.setUniforms(object.uniforms.data(), object.uniforms.size() * sizeof(float));
+    }
+
+    SoftwareRasterizer raster;
+    std::unordered_map<uint64_t, SoftwareReplayProgram> registered;
+    std::vector<Object> objects;
+    unsigned int current = 0;
+};
+
+} // namespace renderer
+
+#endif
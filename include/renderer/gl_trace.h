@@ -0,0 +1,319 @@
+/*
+    GL call tracing on top of glad's call hooks (build with GLAD_CALL_HOOKS, "make trace=1").
+
+    install() wraps every loaded glad_gl* pointer; each call then records its
+    start time, duration and first few arguments into a ring buffer owned by
+    the calling thread, and bumps that thread's per-entry-point call count and
+    CPU time. Recording takes no locks: a thread's ring and counters are only
+    written by that thread, and the mutex is taken once per thread, to register
+    its ring. Until install() (and again after uninstall()) the pointers lead
+    straight to the driver, so an idle tracer costs nothing.
+
+    The durations are CPU time spent inside the driver call, not GPU time.
+    functionStats()/printSummary() report the per-entry-point totals, and
+    writeChromeTrace() exports the rings as Chrome trace JSON (chrome://tracing,
+    ui.perfetto.dev). Read results after uninstall(), or from the thread that
+    records, since a running ring may be overwritten while it is being read.
+    With GLAD_PER_CONTEXT install() wraps the current context's table only, so
+    each rendering thread calls it after loading glad.
+*/
+
+#ifndef RENDERER_GL_TRACE_H
+#define RENDERER_GL_TRACE_H
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace renderer {
+
+struct GLTraceFunctionStats {
+    const char *name;
+    unsigned long long calls;
+    double milliseconds;    // CPU time inside the calls, all threads together
+};
+
+class GLTrace {
+public:
+    // Arguments kept per recorded call; later ones are dropped
+    static const int RECORDED_ARGS = 6;
+
+    // Starts recording; eventsPerThread (rounded up to a power of two) is how many of the
+    // most recent calls each thread's ring keeps for the Chrome trace
+    static bool install(size_t eventsPerThread = 1 << 16)
+    {
+#ifndef GLAD_CALL_HOOKS
+        (void)eventsPerThread;
+        std::cout << "ERROR::GL_TRACE::NOT_BUILT rebuild with -DGLAD_CALL_HOOKS (make trace=1)" << std::endl;
+        return false;
+#else
+        State &state = get();
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (!state.installed) {
+                size_t capacity = 1;
+                while (capacity < eventsPerThread) {
+                    capacity *= 2;
+                }
+                state.capacity = capacity;
+                state.epoch = std::chrono::steady_clock::now();
+                for (std::unique_ptr<ThreadLog> &log : state.threads) {
+                    log->reset();
+                }
+                state.installed = true;
+            }
+        }
+        return gladInstallCallHooks(&before, &after) != 0;
+#endif
+    }
+
+    // Puts the driver's pointers back; what was recorded stays until the next install()
+    static void uninstall()
+    {
+#ifdef GLAD_CALL_HOOKS
+        gladRemoveCallHooks();
+        State &state = get();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.installed = false;
+#endif
+    }
+
+    // Per-entry-point totals over every thread, most expensive first
+    static std::vector<GLTraceFunctionStats> functionStats()
+    {
+        State &state = get();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        std::vector<GLTraceFunctionStats> stats;
+        for (int index = 0; index < GLAD_GL_FUNCTION_COUNT; index++) {
+            const char *name = state.names[index].load(std::memory_order_acquire);
+            if (name == nullptr) {
+                continue;
+            }
+            unsigned long long calls = 0, nanoseconds = 0;
+            for (const std::unique_ptr<ThreadLog> &log : state.threads) {
+                calls += log->counters[index].calls.load(std::memory_order_relaxed);
+                nanoseconds += log->counters[index].nanoseconds.load(std::memory_order_relaxed);
+            }
+            if (calls > 0) {
+                stats.push_back(GLTraceFunctionStats{name, calls, nanoseconds / 1e6});
+            }
+        }
+        std::sort(stats.begin(), stats.end(), [](const GLTraceFunctionStats &a, const GLTraceFunctionStats &b) {
+            return a.milliseconds > b.milliseconds;
+        });
+        return stats;
+    }
+
+    static void printSummary(size_t top = 10)
+    {
+        std::vector<GLTraceFunctionStats> stats = functionStats();
+        unsigned long long calls = 0;
+        double milliseconds = 0.0;
+        for (const GLTraceFunctionStats &function : stats) {
+            calls += function.calls;
+            milliseconds += function.milliseconds;
+        }
+
+        std::cout << "GL trace: " << calls << " calls, " << milliseconds << " ms inside GL" << std::endl;
+        for (size_t i = 0; i < stats.size() && i < top; i++) {
+            const GLTraceFunctionStats &function = stats[i];
+            char line[160];
+            snprintf(line, sizeof(line), "  %-32s %10llu calls %10.3f ms %8.3f us/call", function.name, function.calls,
+                     function.milliseconds, function.milliseconds * 1000.0 / function.calls);
+            std::cout << line << std::endl;
+        }
+    }
+
+    // Chrome trace JSON: one complete ("X") event per recorded call, one track per thread
+    static bool writeChromeTrace(const std::string &path)
+    {
+        State &state = get();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            std::cout << "ERROR::GL_TRACE::FILE_NOT_WRITTEN " << path << std::endl;
+            return false;
+        }
+
+        file << "{\"traceEvents\":[";
+        bool first = true;
+        char number[64];
+        for (const std::unique_ptr<ThreadLog> &log : state.threads) {
+            file << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << log->id
+                 << ",\"args\":{\"name\":\"GL thread " << log->id << "\"}}";
+            first = false;
+
+            unsigned long long written = log->written.load(std::memory_order_acquire);
+            unsigned long long kept = std::min<unsigned long long>(written, log->events.size());
+            for (unsigned long long i = written - kept; i < written; i++) {
+                const Event &event = log->events[i & (log->events.size() - 1)];
+                snprintf(number, sizeof(number), "%.3f,\"dur\":%.3f", event.start / 1000.0, event.duration / 1000.0);
+                file << ",\n{\"name\":\"" << state.names[event.index].load(std::memory_order_acquire)
+                     << "\",\"cat\":\"gl\",\"ph\":\"X\",\"pid\":1,\"tid\":" << log->id << ",\"ts\":" << number << ",\"args\":{";
+                writeArgs(file, state, event);
+                file << "}}";
+            }
+        }
+        file << "\n],\"displayTimeUnit\":\"ns\"}\n";
+        return (bool)file;
+    }
+
+private:
+    struct Event {
+        unsigned long long start;       // nanoseconds since install()
+        unsigned int duration;          // nanoseconds
+        unsigned short index;           // glad load-order index
+        unsigned char argCount;
+        unsigned long long args[RECORDED_ARGS];
+    };
+
+    struct Counter {
+        std::atomic<unsigned long long> calls{0};
+        std::atomic<unsigned long long> nanoseconds{0};
+    };
+
+    // Written by its thread only; the atomics let the reports read it without a lock
+    struct ThreadLog {
+        int id;
+        std::vector<Event> events;
+        std::atomic<unsigned long long> written{0};
+        Counter counters[GLAD_GL_FUNCTION_COUNT];
+
+        void reset()
+        {
+            written.store(0, std::memory_order_relaxed);
+            for (Counter &counter : counters) {
+                counter.calls.store(0, std::memory_order_relaxed);
+                counter.nanoseconds.store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    struct State {
+        std::mutex mutex;
+        bool installed = false;
+        size_t capacity = 1 << 16;
+        std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+        std::vector<std::unique_ptr<ThreadLog>> threads;    // kept for the life of the process
+        std::atomic<const char *> names[GLAD_GL_FUNCTION_COUNT] = {};
+        std::atomic<const char *> argTypes[GLAD_GL_FUNCTION_COUNT] = {};
+        std::atomic<const char *> argNames[GLAD_GL_FUNCTION_COUNT] = {};
+    };
+
+    static State &get()
+    {
+        static State state;
+        return state;
+    }
+
+    static unsigned long long now()
+    {
+        return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - get().epoch).count();
+    }
+
+    // The calling thread's log, registered on its first traced call
+    static ThreadLog &threadLog()
+    {
+        thread_local ThreadLog *log = nullptr;
+        if (log == nullptr) {
+            State &state = get();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.threads.emplace_back(new ThreadLog());
+            log = state.threads.back().get();
+            log->id = (int)state.threads.size();
+            log->events.resize(state.capacity);
+        }
+        return *log;
+    }
+
+#ifdef GLAD_CALL_HOOKS
+    static void before(struct gladGLcall *call)
+    {
+        call->user = now();
+    }
+
+    static void after(struct gladGLcall *call)
+    {
+        unsigned long long end = now();
+        unsigned long long duration = end - call->user;
+        ThreadLog &log = threadLog();
+        State &state = get();
+
+        // The strings are static in glad.c; publish them the first time an entry point shows up
+        if (state.names[call->index].load(std::memory_order_relaxed) == nullptr) {
+            state.argTypes[call->index].store(call->argTypes, std::memory_order_relaxed);
+            state.argNames[call->index].store(call->argNames, std::memory_order_relaxed);
+            state.names[call->index].store(call->name, std::memory_order_release);
+        }
+
+        // Only this thread writes these, so load + store is enough
+        Counter &counter = log.counters[call->index];
+        counter.calls.store(counter.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        counter.nanoseconds.store(counter.nanoseconds.load(std::memory_order_relaxed) + duration, std::memory_order_relaxed);
+
+        unsigned long long written = log.written.load(std::memory_order_relaxed);
+        Event &event = log.events[written & (log.events.size() - 1)];
+        event.start = call->user;
+        event.duration = (unsigned int)std::min<unsigned long long>(duration, 0xFFFFFFFFull);
+        event.index = (unsigned short)call->index;
+        event.argCount = (unsigned char)std::min<size_t>(strlen(call->argTypes), RECORDED_ARGS);
+        memcpy(event.args, call->args, event.argCount * sizeof(event.args[0]));
+        log.written.store(written + 1, std::memory_order_release);
+    }
+#endif
+
+    // "name":value pairs, formatted by the argument's type letter
+    static void writeArgs(std::ofstream &file, State &state, const Event &event)
+    {
+        const char *types = state.argTypes[event.index].load(std::memory_order_relaxed);
+        const char *names = state.argNames[event.index].load(std::memory_order_relaxed);
+        char value[64];
+
+        for (int i = 0; i < event.argCount; i++) {
+            const char *end = strchr(names, ',');
+            size_t length = end != nullptr ? (size_t)(end - names) : strlen(names);
+            unsigned long long raw = event.args[i];
+
+            switch (types[i]) {
+            case 'i':
+                snprintf(value, sizeof(value), "%lld", (long long)raw);
+                break;
+            case 'f': {
+                double number;
+                memcpy(&number, &raw, sizeof(number));
+                // JSON has no NaN or infinity
+                snprintf(value, sizeof(value), std::isfinite(number) ? "%.9g" : "\"%g\"", number);
+                break;
+            }
+            case 'e':
+            case 'x':
+            case 'p':
+                snprintf(value, sizeof(value), "\"0x%llX\"", raw);
+                break;
+            default:
+                snprintf(value, sizeof(value), "%llu", raw);
+                break;
+            }
+
+            file << (i > 0 ? "," : "") << "\"" << std::string(names, length) << "\":" << value;
+            names = end != nullptr ? end + 1 : names + length;
+        }
+    }
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,40 @@
+/*
+    Small non-cryptographic hashes shared by the renderer's caches and lookup tables.
+*/
+
+#ifndef RENDERER_HASH_H
+#define RENDERER_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace renderer {
+
+const uint64_t FNV_OFFSET_BASIS = 1469598103934665603ULL;
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+// 64-bit FNV-1a, chained through seed so several strings can be hashed as one key
+inline uint64_t hashString(const char *text, uint64_t seed = FNV_OFFSET_BASIS)
+{
+    uint64_t hash = seed;
+    for (const unsigned char *c = (const unsigned char *)text; text != NULL && *c != 0; c++) {
+        hash = (hash ^ *c) * FNV_PRIME;
+    }
+    // Separator so ("ab", "c") and ("a", "bc") hash differently
+    return (hash ^ 0xFF) * FNV_PRIME;
+}
+
+// 64-bit FNV-1a over raw bytes
+inline uint64_t hashBytes(const void *data, size_t size, uint64_t seed = FNV_OFFSET_BASIS)
+{
+    uint64_t hash = seed;
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,221 @@
+/*
+    Vertex data ready to draw: a VAO with its vertex buffer and, for indexed
+    meshes, its element buffer.
+
+    The constructor uploads the vertices (and indices), describes the layout
+    to the VAO once and unbinds everything again, which is the setup every
+    sample repeated by hand. draw() binds the VAO and issues glDrawArrays, or
+    glDrawElements with the mesh's index type (GL_UNSIGNED_INT unless told
+    otherwise; renderer/mesh_builder.h picks 16-bit when it can). Meshes of
+    triangle strips (setPrimitive()) can separate the strips with a
+    primitive restart index, the largest value of the index type, which
+    draw() turns on around its glDrawElements only. setInstances() adds a
+    second vertex buffer whose attributes advance per instance, and
+    drawInstanced() draws every instance in one call. The mesh owns the VAO
+    and its buffers: moving hands them over, the destructor (or reset())
+    deletes them.
+*/
+
+#ifndef RENDERER_MESH_H
+#define RENDERER_MESH_H
+
+#include <glad/glad.h>
+
+#include "buffer.h"
+#include "vertex_attribute.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace renderer {
+
+class Mesh {
+public:
+    Mesh() = default;
+
+    // stride is the size of one vertex in bytes; indices are optional
+    Mesh(const void *vertices, size_t vertexBytes, int stride, std::initializer_list<VertexAttribute> attributes,
+         const unsigned int *indices = nullptr, size_t indexBytes = 0)
+        : Mesh(vertices, vertexBytes, stride, attributes.begin(), attributes.size(), indices, indexBytes)
+    {
+    }
+
+    // For layouts built at run time (see renderer/vertex_format.h)
+    Mesh(const void *vertices, size_t vertexBytes, int stride, const std::vector<VertexAttribute> &attributes,
+         const unsigned int *indices = nullptr, size_t indexBytes = 0)
+        : Mesh(vertices, vertexBytes, stride, attributes.data(), attributes.size(), indices, indexBytes)
+    {
+    }
+
+    // indexType is GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+    Mesh(const void *vertices, size_t vertexBytes, int stride, const VertexAttribute *attributes, size_t attributeCount,
+         const void *indices = nullptr, size_t indexBytes = 0, GLenum indexType = GL_UNSIGNED_INT)
+        : vertexCount((int)(vertexBytes / stride)), indexCount((int)(indexBytes / indexSize(indexType))), indexType(indexType)
+    {
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+
+        vertexBuffer = Buffer(GL_ARRAY_BUFFER, vertexBytes, vertices);
+        if (indices != nullptr) {
+            elementBuffer = Buffer(GL_ELEMENT_ARRAY_BUFFER, indexBytes, indices);
+        }
+
+        for (size_t i = 0; i < attributeCount; i++) {
+            const VertexAttribute &attribute = attributes[i];
+            glVertexAttribPointer(attribute.location, attribute.size, attribute.type, attribute.normalized, stride, (void*)attribute.offset);
+            glEnableVertexAttribArray(attribute.location);
+            if (attribute.divisor != 0) {
+                glVertexAttribDivisor(attribute.location, attribute.divisor);
+            }
+        }
+
+        // Unbind the VAO first, so it keeps its element buffer
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    ~Mesh() { reset(); }
+
+    Mesh(const Mesh &) = delete;
+    Mesh &operator=(const Mesh &) = delete;
+
+    Mesh(Mesh &&other) noexcept
+        : vao(other.vao), vertexBuffer(std::move(other.vertexBuffer)),
+          elementBuffer(std::move(other.elementBuffer)), instanceBuffer(std::move(other.instanceBuffer)), vertexCount(other.vertexCount), indexCount(other.indexCount),
+          indexType(other.indexType), primitiveMode(other.primitiveMode), primitiveRestart(other.primitiveRestart)
+    {
+        other.vao = 0;
+        other.vertexCount = 0;
+        other.indexCount = 0;
+    }
+
+    Mesh &operator=(Mesh &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            vao = other.vao;
+            vertexBuffer = std::move(other.vertexBuffer);
+            elementBuffer = std::move(other.elementBuffer);
+            instanceBuffer = std::move(other.instanceBuffer);
+            vertexCount = other.vertexCount;
+            indexCount = other.indexCount;
+            indexType = other.indexType;
+            primitiveMode = other.primitiveMode;
+            primitiveRestart = other.primitiveRestart;
+            other.vao = 0;
+            other.vertexCount = 0;
+            other.indexCount = 0;
+        }
+        return *this;
+    }
+
+    // Deletes the VAO and its buffers now instead of at the end of the scope
+    void reset()
+    {
+        if (vao != 0) {
+            glDeleteVertexArrays(1, &vao);
+            vao = 0;
+        }
+        vertexBuffer.reset();
+        elementBuffer.reset();
+        instanceBuffer.reset();
+        vertexCount = 0;
+        indexCount = 0;
+    }
+
+    // Per-instance data in its own buffer; attributes with divisor 0 advance once per instance.
+    // Calling it again replaces the data (update it in place through instances())
+    void setInstances(const void *data, size_t bytes, int stride, std::initializer_list<VertexAttribute> attributes)
+    {
+        setInstances(data, bytes, stride, attributes.begin(), attributes.size());
+    }
+
+    void setInstances(const void *data, size_t bytes, int stride, const VertexAttribute *attributes, size_t attributeCount)
+    {
+        glBindVertexArray(vao);
+        instanceBuffer = Buffer(GL_ARRAY_BUFFER, bytes, data);
+        for (size_t i = 0; i < attributeCount; i++) {
+            const VertexAttribute &attribute = attributes[i];
+            glVertexAttribPointer(attribute.location, attribute.size, attribute.type, attribute.normalized, stride, (void*)attribute.offset);
+            glEnableVertexAttribArray(attribute.location);
+            glVertexAttribDivisor(attribute.location, attribute.divisor != 0 ? attribute.divisor : 1);
+        }
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // What draw() draws; restart only applies to indexed meshes
+    void setPrimitive(GLenum mode, bool restart = false)
+    {
+        primitiveMode = mode;
+        primitiveRestart = restart;
+    }
+
+    // Draws the whole mesh
+    void draw() const { draw(primitiveMode); }
+
+    void draw(GLenum mode) const
+    {
+        glBindVertexArray(vao);
+        if (indexCount > 0 && primitiveRestart) {
+            glEnable(GL_PRIMITIVE_RESTART);
+            glPrimitiveRestartIndex(restartIndex());
+            glDrawElements(mode, indexCount, indexType, 0);
+            glDisable(GL_PRIMITIVE_RESTART);
+        } else if (indexCount > 0) {
+            glDrawElements(mode, indexCount, indexType, 0);
+        } else {
+            glDrawArrays(mode, 0, vertexCount);
+        }
+    }
+
+    // Draws the whole mesh instanceCount times in one call
+    void drawInstanced(int instanceCount) const { drawInstanced(primitiveMode, instanceCount); }
+
+    void drawInstanced(GLenum mode, int instanceCount) const
+    {
+        glBindVertexArray(vao);
+        if (indexCount > 0 && primitiveRestart) {
+            glEnable(GL_PRIMITIVE_RESTART);
+            glPrimitiveRestartIndex(restartIndex());
+            glDrawElementsInstanced(mode, indexCount, indexType, 0, instanceCount);
+            glDisable(GL_PRIMITIVE_RESTART);
+        } else if (indexCount > 0) {
+            glDrawElementsInstanced(mode, indexCount, indexType, 0, instanceCount);
+        } else {
+            glDrawArraysInstanced(mode, 0, vertexCount, instanceCount);
+        }
+    }
+
+    unsigned int id() const { return vao; }
+    const Buffer &instances() const { return instanceBuffer; }
+    bool indexed() const { return indexCount > 0; }
+    int vertices() const { return vertexCount; }
+    int indices() const { return indexCount; }
+    GLenum indexFormat() const { return indexType; }
+    GLenum primitive() const { return primitiveMode; }
+    bool restarts() const { return primitiveRestart; }
+    unsigned int restartIndex() const { return indexType == GL_UNSIGNED_BYTE ? 0xFF : indexType == GL_UNSIGNED_SHORT ? 0xFFFF : 0xFFFFFFFF; }
+
+private:
+    static size_t indexSize(GLenum type)
+    {
+        return type == GL_UNSIGNED_BYTE ? 1 : type == GL_UNSIGNED_SHORT ? 2 : 4;
+    }
+
+    unsigned int vao = 0;
+    Buffer vertexBuffer;
+    Buffer elementBuffer;
+    Buffer instanceBuffer;
+    int vertexCount = 0;
+    int indexCount = 0;
+    GLenum indexType = GL_UNSIGNED_INT;
+    GLenum primitiveMode = GL_TRIANGLES;
+    bool primitiveRestart = false;
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,218 @@
+/*
+    Turns triangle soup into an indexed mesh.
+
+    Vertices are appended one by one or as whole arrays, in drawing order.
+    A vertex equal to one already added (byte for byte, so 0.0 and -0.0
+    differ) isn't stored again; its index is emitted instead. The lookup is
+    an open-addressing hash table of vertex indices keyed by hashBytes() of
+    the vertex, so nothing but the vertex data itself is kept per vertex.
+    Indices are 16-bit while the vertices fit (65536 or fewer) and 32-bit
+    otherwise; build() uploads the result as a Mesh drawn with
+    glDrawElements. The attribute layout is the caller's, exactly as for
+    Mesh: the builder only sees vertices of `stride` bytes. optimize()
+    reorders the result for the GPU with renderer/mesh_optimizer.h, and
+    buildStrips() uploads it as triangle strips with primitive restart
+    instead; those keep 16-bit indices up to 65535 vertices, since 0xFFFF
+    is the restart index.
+*/
+
+#ifndef RENDERER_MESH_BUILDER_H
+#define RENDERER_MESH_BUILDER_H
+
+#include <glad/glad.h>
+
+#include "hash.h"
+#include "mesh.h"
+#include "mesh_optimizer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+
+namespace renderer {
+
+class MeshBuilder {
+public:
+    static const uint32_t MAX_SHORT_INDEXED_VERTICES = 65536;
+
+    explicit MeshBuilder(int stride, size_t expectedVertices = 0)
+        : vertexStride(stride)
+    {
+        reserve(expectedVertices);
+    }
+
+    // Room for this many unique vertices and indices without rehashing
+    void reserve(size_t count)
+    {
+        vertexData.reserve(count * vertexStride);
+        indexList.reserve(count);
+        if (count * 2 > table.size()) {
+            rehash(count * 2);
+        }
+    }
+
+    void clear()
+    {
+        vertexData.clear();
+        indexList.clear();
+        std::fill(table.begin(), table.end(), EMPTY);
+    }
+
+    // Appends one vertex and returns the index it was given
+    uint32_t addVertex(const void *vertex)
+    {
+        // Keep the load factor at or below one half
+        uint32_t count = vertexCount();
+        if ((size_t)(count + 1) * 2 > table.size()) {
+            rehash(table.empty() ? 64 : table.size() * 2);
+        }
+
+        size_t mask = table.size() - 1;
+        size_t slot = (size_t)hashBytes(vertex, vertexStride) & mask;
+        for (; table[slot] != EMPTY; slot = (slot + 1) & mask) {
+            if (memcmp(vertexData.data() + (size_t)table[slot] * vertexStride, vertex, vertexStride) == 0) {
+                indexList.push_back(table[slot]);
+                return table[slot];
+            }
+        }
+
+        table[slot] = count;
+        const unsigned char *bytes = (const unsigned char *)vertex;
+        vertexData.insert(vertexData.end(), bytes, bytes + vertexStride);
+        indexList.push_back(count);
+        return count;
+    }
+
+    // Appends a whole array of vertices, e.g. the vertices glDrawArrays(GL_TRIANGLES) would draw
+    void addVertices(const void *vertices, size_t vertexBytes)
+    {
+        const unsigned char *bytes = (const unsigned char *)vertices;
+        size_t count = vertexBytes / vertexStride;
+        for (size_t i = 0; i < count; i++) {
+            addVertex(bytes + i * vertexStride);
+        }
+    }
+
+    // Reorders the triangles for the vertex cache and overdraw, then the vertices for fetch locality.
+    // Positions are three floats at positionOffset. Renumbers the vertices: indices returned before are stale
+    void optimize(size_t positionOffset, float overdrawThreshold = 1.05f)
+    {
+        optimizeVertexCache(indexList);
+        optimizeOverdraw(indexList, vertexData.data(), vertexStride, positionOffset, overdrawThreshold);
+        optimizeVertexFetch(indexList, vertexData, vertexStride);
+        rehash(table.size());
+    }
+
+    int stride() const { return vertexStride; }
+    uint32_t vertexCount() const { return (uint32_t)(vertexData.size() / vertexStride); }
+    size_t indexCount() const { return indexList.size(); }
+    const unsigned char *vertices() const { return vertexData.data(); }
+    size_t vertexBytes() const { return vertexData.size(); }
+    const std::vector<uint32_t> &indices() const { return indexList; }
+
+    GLenum indexType() const { return vertexCount() <= MAX_SHORT_INDEXED_VERTICES ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT; }
+    size_t indexSize() const { return indexType() == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t); }
+
+    // The index buffer in indexType()
+    std::vector<unsigned char> indexBuffer() const
+    {
+        return packIndices(indexList, indexType());
+    }
+
+    GLenum stripIndexType() const { return vertexCount() < MAX_SHORT_INDEXED_VERTICES ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT; }
+    uint32_t stripRestartIndex() const { return stripIndexType() == GL_UNSIGNED_SHORT ? 0xFFFF : 0xFFFFFFFF; }
+
+    // The triangles as strips separated by stripRestartIndex()
+    std::vector<uint32_t> stripIndices() const
+    {
+        return stripify(indexList, stripRestartIndex());
+    }
+
+    // The strip index buffer in stripIndexType()
+    std::vector<unsigned char> stripIndexBuffer() const
+    {
+        return packIndices(stripIndices(), stripIndexType());
+    }
+
+    Mesh build(std::initializer_list<VertexAttribute> attributes) const
+    {
+        return build(attributes.begin(), attributes.size());
+    }
+
+    Mesh build(const std::vector<VertexAttribute> &attributes) const
+    {
+        return build(attributes.data(), attributes.size());
+    }
+
+    Mesh build(const VertexAttribute *attributes, size_t attributeCount) const
+    {
+        std::vector<unsigned char> buffer = indexBuffer();
+        return Mesh(vertexData.data(), vertexData.size(), vertexStride, attributes, attributeCount, buffer.data(), buffer.size(), indexType());
+    }
+
+    // The same mesh drawn as GL_TRIANGLE_STRIP with primitive restart
+    Mesh buildStrips(std::initializer_list<VertexAttribute> attributes) const
+    {
+        return buildStrips(attributes.begin(), attributes.size());
+    }
+
+    Mesh buildStrips(const std::vector<VertexAttribute> &attributes) const
+    {
+        return buildStrips(attributes.data(), attributes.size());
+    }
+
+    Mesh buildStrips(const VertexAttribute *attributes, size_t attributeCount) const
+    {
+        std::vector<unsigned char> buffer = stripIndexBuffer();
+        Mesh mesh(vertexData.data(), vertexData.size(), vertexStride, attributes, attributeCount, buffer.data(), buffer.size(), stripIndexType());
+        mesh.setPrimitive(GL_TRIANGLE_STRIP, true);
+        return mesh;
+    }
+
+private:
+    static constexpr uint32_t EMPTY = 0xFFFFFFFF;
+
+    static std::vector<unsigned char> packIndices(const std::vector<uint32_t> &indices, GLenum type)
+    {
+        std::vector<unsigned char> buffer(indices.size() * (type == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t)));
+        if (type == GL_UNSIGNED_INT) {
+            memcpy(buffer.data(), indices.data(), buffer.size());
+        } else {
+            for (size_t i = 0; i < indices.size(); i++) {
+                uint16_t index = (uint16_t)indices[i];
+                memcpy(buffer.data() + i * sizeof(index), &index, sizeof(index));
+            }
+        }
+        return buffer;
+    }
+
+    void rehash(size_t capacity)
+    {
+        size_t size = 64;
+        while (size < capacity) {
+            size *= 2;
+        }
+        table.assign(size, EMPTY);
+
+        size_t mask = size - 1;
+        uint32_t count = vertexCount();
+        for (uint32_t index = 0; index < count; index++) {
+            size_t slot = (size_t)hashBytes(vertexData.data() + (size_t)index * vertexStride, vertexStride) & mask;
+            while (table[slot] != EMPTY) {
+                slot = (slot + 1) & mask;
+            }
+            table[slot] = index;
+        }
+    }
+
+    int vertexStride;
+    std::vector<unsigned char> vertexData;
+    std::vector<uint32_t> indexList;
+    std::vector<uint32_t> table;
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,591 @@
+/*
+    Index buffer optimization for the post-transform vertex cache, overdraw
+    and vertex fetch, with the matching analyses.
+
+    Run the passes in this order, on a triangle list:
+      optimizeVertexCache  reorders triangles with Tipsify (Sander, Nehab
+                           and Barczak, "Fast Triangle Reordering for Vertex
+                           Locality and Reduced Overdraw", 2007): fan around
+                           a vertex, then move to the freshest neighbour that
+                           still has triangles left, linear in the mesh size
+      optimizeOverdraw     cuts that order into clusters where the cache
+                           restarts anyway (plus wherever a cut costs less
+                           than `threshold` times the cluster's ACMR) and
+                           draws the outward-facing clusters first, so depth
+                           testing rejects more of what's behind them
+      optimizeVertexFetch  renumbers the vertices in first-use order and
+                           moves their data to match, so the fetches walk
+                           the vertex buffer forwards
+    The analyses simulate the hardware:
+      analyzeVertexCache   a FIFO post-transform cache; ACMR is vertex
+                           shader runs per triangle (0.5 at best on a
+                           regular grid, 3 at worst), ATVR runs per vertex
+                           (1 at best)
+      analyzeVertexFetch   a direct-mapped 16 KB cache of 64-byte lines;
+                           overfetch is bytes read per vertex byte used
+      analyzeOverdraw      rasterizes the mesh from the six axis directions
+                           into a 256 x 256 depth buffer with early-z;
+                           overdraw is fragments shaded per pixel covered
+    stripify() turns the optimized list into triangle strips joined by a
+    primitive restart index, about one index per triangle instead of three
+    on a well connected mesh; unstripify() gives the list back.
+    Indices are 32-bit here whatever the mesh is drawn with (see
+    renderer/mesh_builder.h, which runs all three passes in optimize()).
+*/
+
+#ifndef RENDERER_MESH_OPTIMIZER_H
+#define RENDERER_MESH_OPTIMIZER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace renderer {
+
+const int MESH_OPTIMIZER_CACHE_SIZE = 16;
+
+struct VertexCacheStats {
+    double acmr;    // average cache miss ratio: vertex shader runs per triangle
+    double atvr;    // average transform to vertex ratio: vertex shader runs per vertex used
+};
+
+struct VertexFetchStats {
+    double overfetch;   // bytes fetched from memory per byte of vertex data used
+};
+
+struct OverdrawStats {
+    unsigned long long covered;     // pixels covered, over all six views
+    unsigned long long shaded;      // fragments that passed the depth test
+    double overdraw;                // shaded / covered, 1 at best
+};
+
+namespace detail {
+
+// FIFO cache by time stamps: a vertex is cached while fewer than cacheSize misses happened since its own
+struct FifoCache {
+    std::vector<uint32_t> stamps;
+    uint32_t time;
+    uint32_t size;
+
+    FifoCache(size_t vertexCount, int cacheSize)
+        : stamps(vertexCount, 0), time((uint32_t)cacheSize + 1), size((uint32_t)cacheSize)
+    {
+    }
+
+    // True on a miss, which loads the vertex
+    bool access(uint32_t vertex)
+    {
+        if (time - stamps[vertex] > size) {
+            stamps[vertex] = time++;
+            return true;
+        }
+        return false;
+    }
+
+    // Evicts everything
+    void flush() { time += size + 1; }
+};
+
+inline size_t maxIndex(const std::vector<uint32_t> &indices)
+{
+    uint32_t highest = 0;
+    for (uint32_t index : indices) {
+        highest = std::max(highest, index);
+    }
+    return indices.empty() ? 0 : (size_t)highest + 1;
+}
+
+// The triangles using each vertex: triangles[offsets[v]] to triangles[offsets[v + 1] - 1]
+struct TriangleAdjacency {
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> triangles;
+
+    TriangleAdjacency(const std::vector<uint32_t> &indices, size_t vertexCount)
+        : offsets(vertexCount + 1, 0), triangles(indices.size() / 3 * 3)
+    {
+        for (size_t i = 0; i < triangles.size(); i++) {
+            offsets[indices[i] + 1]++;
+        }
+        for (size_t v = 0; v < vertexCount; v++) {
+            offsets[v + 1] += offsets[v];
+        }
+        std::vector<uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < triangles.size(); i++) {
+            triangles[cursors[indices[i]]++] = (uint32_t)(i / 3);
+        }
+    }
+};
+
+inline void readPosition(const unsigned char *vertices, int stride, size_t positionOffset, uint32_t vertex, float position[3])
+{
+    memcpy(position, vertices + (size_t)vertex * stride + positionOffset, 3 * sizeof(float));
+}
+
+} // namespace detail
+
+/* ANALYSIS STARTS HERE */
+
+inline VertexCacheStats analyzeVertexCache(const std::vector<uint32_t> &indices, int cacheSize = MESH_OPTIMIZER_CACHE_SIZE)
+{
+    size_t vertexCount = detail::maxIndex(indices);
+    detail::FifoCache cache(vertexCount, cacheSize);
+    std::vector<char> used(vertexCount, 0);
+    unsigned long long misses = 0, unique = 0;
+    for (uint32_t index : indices) {
+        misses += cache.access(index);
+        unique += used[index] == 0;
+        used[index] = 1;
+    }
+
+    VertexCacheStats stats = {0.0, 0.0};
+    if (indices.size() >= 3) {
+        stats.acmr = (double)misses / (indices.size() / 3);
+        stats.atvr = (double)misses / unique;
+    }
+    return stats;
+}
+
+inline VertexFetchStats analyzeVertexFetch(const std::vector<uint32_t> &indices, int stride)
+{
+    const size_t LINE = 64, LINES = 256;
+    std::vector<size_t> tags(LINES, (size_t)-1);
+    std::vector<char> used(detail::maxIndex(indices), 0);
+    unsigned long long fetched = 0, unique = 0;
+    for (uint32_t index : indices) {
+        unique += used[index] == 0;
+        used[index] = 1;
+        size_t first = (size_t)index * stride / LINE, last = ((size_t)index * stride + stride - 1) / LINE;
+        for (size_t line = first; line <= last; line++) {
+            if (tags[line % LINES] != line) {
+                tags[line % LINES] = line;
+                fetched += LINE;
+            }
+        }
+    }
+
+    VertexFetchStats stats = {0.0};
+    if (unique > 0) {
+        stats.overfetch = (double)fetched / (unique * stride);
+    }
+    return stats;
+}
+
+// Positions are three floats at positionOffset in each vertex of `stride` bytes
+inline OverdrawStats analyzeOverdraw(const std::vector<uint32_t> &indices, const void *vertices, int stride, size_t positionOffset)
+{
+    const int GRID = 256;
+    const unsigned char *data = (const unsigned char *)vertices;
+    OverdrawStats stats = {0, 0, 0.0};
+    size_t vertexCount = detail::maxIndex(indices);
+    if (vertexCount == 0) {
+        return stats;
+    }
+
+    // One scale for all axes, so the mesh keeps its proportions in every view
+    float lowest[3] = {INFINITY, INFINITY, INFINITY}, highest[3] = {-INFINITY, -INFINITY, -INFINITY};
+    for (uint32_t v = 0; v < vertexCount; v++) {
+        float position[3];
+        detail::readPosition(data, stride, positionOffset, v, position);
+        for (int c = 0; c < 3; c++) {
+            lowest[c] = std::min(lowest[c], position[c]);
+            highest[c] = std::max(highest[c], position[c]);
+        }
+    }
+    float extent = std::max(std::max(highest[0] - lowest[0], highest[1] - lowest[1]), highest[2] - lowest[2]);
+    float scale = extent > 0.0f ? (GRID - 1) / extent : 1.0f;
+
+    std::vector<float> depth(GRID * GRID);
+    for (int axis = 0; axis < 3; axis++) {
+        for (int direction = -1; direction <= 1; direction += 2) {
+            std::fill(depth.begin(), depth.end(), INFINITY);
+            int uAxis = (axis + 1) % 3, vAxis = (axis + 2) % 3;
+
+            for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+                float x[3], y[3], z[3];
+                for (int c = 0; c < 3; c++) {
+                    float position[3];
+                    detail::readPosition(data, stride, positionOffset, indices[t + c], position);
+                    x[c] = (position[uAxis] - lowest[uAxis]) * scale;
+                    y[c] = (position[vAxis] - lowest[vAxis]) * scale;
+                    z[c] = direction * position[axis];
+                }
+
+                // Looking down the other way mirrors the image, so the front faces flip too
+                float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+                if (area * direction >= 0.0f) {
+                    continue;
+                }
+
+                int x0 = std::max((int)floorf(std::min(std::min(x[0], x[1]), x[2])), 0);
+                int x1 = std::min((int)ceilf(std::max(std::max(x[0], x[1]), x[2])), GRID - 1);
+                int y0 = std::max((int)floorf(std::min(std::min(y[0], y[1]), y[2])), 0);
+                int y1 = std::min((int)ceilf(std::max(std::max(y[0], y[1]), y[2])), GRID - 1);
+                for (int py = y0; py <= y1; py++) {
+                    for (int px = x0; px <= x1; px++) {
+                        // Barycentrics of the pixel centre, positive inside whatever the winding
+                        float sx = px + 0.5f, sy = py + 0.5f;
+                        float w0 = ((x[1] - sx) * (y[2] - sy) - (x[2] - sx) * (y[1] - sy)) / area;
+                        float w1 = ((x[2] - sx) * (y[0] - sy) - (x[0] - sx) * (y[2] - sy)) / area;
+                        float w2 = 1.0f - w0 - w1;
+                        if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) {
+                            continue;
+                        }
+                        float fragmentDepth = w0 * z[0] + w1 * z[1] + w2 * z[2];
+                        float &stored = depth[py * GRID + px];
+                        if (fragmentDepth < stored) {
+                            stored = fragmentDepth;
+                            stats.shaded++;
+                        }
+                    }
+                }
+            }
+
+            for (float value : depth) {
+                stats.covered += value != INFINITY;
+            }
+        }
+    }
+
+    stats.overdraw = stats.covered > 0 ? (double)stats.shaded / stats.covered : 0.0;
+    return stats;
+}
+
+/* ANALYSIS ENDS HERE */
+/* OPTIMIZATION STARTS HERE */
+
+inline void optimizeVertexCache(std::vector<uint32_t> &indices, int cacheSize = MESH_OPTIMIZER_CACHE_SIZE)
+{
+    size_t vertexCount = detail::maxIndex(indices);
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) {
+        return;
+    }
+
+    // Triangles around each vertex, and how many of them are still to be emitted
+    detail::TriangleAdjacency adjacency(indices, vertexCount);
+    std::vector<uint32_t> live(vertexCount);
+    for (size_t v = 0; v < vertexCount; v++) {
+        live[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+    }
+
+    detail::FifoCache cache(vertexCount, cacheSize);
+    std::vector<char> emitted(triangleCount, 0);
+    std::vector<uint32_t> deadEnds, candidates, result;
+    deadEnds.reserve(triangleCount * 3);
+    result.reserve(triangleCount * 3);
+
+    size_t scan = 0;
+    long long fanning = 0;
+    while (fanning >= 0) {
+        // Emit every triangle left around the fanning vertex
+        candidates.clear();
+        for (uint32_t a = adjacency.offsets[fanning]; a < adjacency.offsets[fanning + 1]; a++) {
+            uint32_t triangle = adjacency.triangles[a];
+            if (emitted[triangle]) {
+                continue;
+            }
+            emitted[triangle] = 1;
+            for (int c = 0; c < 3; c++) {
+                uint32_t vertex = indices[triangle * 3 + c];
+                result.push_back(vertex);
+                deadEnds.push_back(vertex);
+                candidates.push_back(vertex);
+                live[vertex]--;
+                cache.access(vertex);
+            }
+        }
+
+        // Next: the neighbour that will still be cached after fanning around it, the oldest such one
+        fanning = -1;
+        long long bestPriority = -1;
+        for (uint32_t vertex : candidates) {
+            if (live[vertex] == 0) {
+                continue;
+            }
+            long long age = cache.time - cache.stamps[vertex];
+            long long priority = age + 2 * (long long)live[vertex] <= cacheSize ? age : 0;
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                fanning = vertex;
+            }
+        }
+
+        // Dead end: back to the most recent vertex with triangles left, else the next one in index order
+        while (fanning < 0 && !deadEnds.empty()) {
+            uint32_t vertex = deadEnds.back();
+            deadEnds.pop_back();
+            if (live[vertex] > 0) {
+                fanning = vertex;
+            }
+        }
+        while (fanning < 0 && scan < vertexCount) {
+            if (live[scan] > 0) {
+                fanning = (long long)scan;
+            }
+            scan++;
+        }
+    }
+
+    // A trailing partial triangle isn't drawn anyway
+    indices.swap(result);
+}
+
+// Reorders clusters of an optimizeVertexCache()d index buffer front-to-back on average.
+// threshold bounds how much worse than a cluster's own ACMR a split-off run may be
+inline void optimizeOverdraw(std::vector<uint32_t> &indices, const void *vertices, int stride, size_t positionOffset,
+                             float threshold = 1.05f, int cacheSize = MESH_OPTIMIZER_CACHE_SIZE)
+{
+    const unsigned char *data = (const unsigned char *)vertices;
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount < 2) {
+        return;
+    }
+
+    // Hard boundaries: triangles that miss on all three vertices, where the cache restarted anyway
+    detail::FifoCache cache(detail::maxIndex(indices), cacheSize);
+    std::vector<size_t> hard;
+    for (size_t t = 0; t < triangleCount; t++) {
+        int misses = cache.access(indices[t * 3]) + cache.access(indices[t * 3 + 1]) + cache.access(indices[t * 3 + 2]);
+        if (t == 0 || misses == 3) {
+            hard.push_back(t);
+        }
+    }
+    hard.push_back(triangleCount);
+
+    // Soft boundaries: split a cluster wherever the run since the last split is already about as
+    // cache friendly as the whole cluster
+    std::vector<size_t> clusters;
+    for (size_t h = 0; h + 1 < hard.size(); h++) {
+        size_t begin = hard[h], end = hard[h + 1];
+        cache.flush();
+        unsigned long long clusterMisses = 0;
+        for (size_t i = begin * 3; i < end * 3; i++) {
+            clusterMisses += cache.access(indices[i]);
+        }
+        double clusterAcmr = (double)clusterMisses / (end - begin);
+
+        cache.flush();
+        clusters.push_back(begin);
+        unsigned long long misses = 0, triangles = 0;
+        for (size_t t = begin; t < end; t++) {
+            misses += cache.access(indices[t * 3]) + cache.access(indices[t * 3 + 1]) + cache.access(indices[t * 3 + 2]);
+            triangles++;
+            if (t + 1 < end && (double)misses / triangles <= threshold * clusterAcmr) {
+                clusters.push_back(t + 1);
+                cache.flush();
+                misses = 0;
+                triangles = 0;
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+
+    // Area-weighted centroid and normal of every cluster, and of the mesh
+    size_t clusterCount = clusters.size() - 1;
+    std::vector<float> centroids(clusterCount * 3, 0.0f), normals(clusterCount * 3, 0.0f);
+    double meshCentroid[3] = {0.0, 0.0, 0.0}, meshArea = 0.0;
+    for (size_t k = 0; k < clusterCount; k++) {
+        double area = 0.0, centroid[3] = {0.0, 0.0, 0.0};
+        for (size_t t = clusters[k]; t < clusters[k + 1]; t++) {
+            float p[3][3];
+            for (int c = 0; c < 3; c++) {
+                detail::readPosition(data, stride, positionOffset, indices[t * 3 + c], p[c]);
+            }
+            float e1[3] = {p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]};
+            float e2[3] = {p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2]};
+            float normal[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+            double triangleArea = 0.5 * sqrt((double)normal[0] * normal[0] + (double)normal[1] * normal[1] + (double)normal[2] * normal[2]);
+            for (int c = 0; c < 3; c++) {
+                centroid[c] += triangleArea * (p[0][c] + p[1][c] + p[2][c]) / 3.0;
+                normals[k * 3 + c] += normal[c];
+            }
+            area += triangleArea;
+        }
+        for (int c = 0; c < 3; c++) {
+            meshCentroid[c] += centroid[c];
+            centroids[k * 3 + c] = area > 0.0 ? (float)(centroid[c] / area) : 0.0f;
+        }
+        meshArea += area;
+    }
+    for (int c = 0; c < 3; c++) {
+        meshCentroid[c] = meshArea > 0.0 ? meshCentroid[c] / meshArea : 0.0;
+    }
+
+    // Clusters facing away from the middle occlude the most: draw them first
+    std::vector<float> keys(clusterCount);
+    std::vector<uint32_t> order(clusterCount);
+    for (size_t k = 0; k < clusterCount; k++) {
+        const float *n = &normals[k * 3];
+        float length = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        float key = 0.0f;
+        for (int c = 0; c < 3 && length > 0.0f; c++) {
+            key += (float)(centroids[k * 3 + c] - meshCentroid[c]) * n[c] / length;
+        }
+        keys[k] = key;
+        order[k] = (uint32_t)k;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keys[a] > keys[b]; });
+
+    std::vector<uint32_t> result;
+    result.reserve(triangleCount * 3);
+    for (uint32_t k : order) {
+        result.insert(result.end(), indices.begin() + clusters[k] * 3, indices.begin() + clusters[k + 1] * 3);
+    }
+    indices.swap(result);
+}
+
+// Renumbers vertices in first-use order and moves their data to match; vertices no index uses are
+// dropped. Returns the new vertex count
+inline size_t optimizeVertexFetch(std::vector<uint32_t> &indices, std::vector<unsigned char> &vertices, int stride)
+{
+    const uint32_t UNUSED = 0xFFFFFFFF;
+    size_t vertexCount = vertices.size() / stride;
+    std::vector<uint32_t> remap(vertexCount, UNUSED);
+    std::vector<unsigned char> result;
+    result.reserve(vertices.size());
+
+    uint32_t next = 0;
+    for (uint32_t &index : indices) {
+        if (remap[index] == UNUSED) {
+            remap[index] = next++;
+            result.insert(result.end(), vertices.begin() + (size_t)index * stride, vertices.begin() + ((size_t)index + 1) * stride);
+        }
+        index = remap[index];
+    }
+    vertices.swap(result);
+    return next;
+}
+
+/* OPTIMIZATION ENDS HERE */
+/* STRIPS START HERE */
+
+const uint32_t MESH_OPTIMIZER_RESTART_INDEX = 0xFFFFFFFF;
+
+// Turns a triangle list into triangle strips separated by restartIndex, to draw as GL_TRIANGLE_STRIP with
+// GL_PRIMITIVE_RESTART on. Windings are kept. restartIndex must be a value no vertex has, in the index type
+// the strips are drawn with (0xFFFF for 16-bit indices). Strips start in list order and grow along shared
+// edges, so run optimizeVertexCache() first. Returns nothing if a vertex has the restart index
+inline std::vector<uint32_t> stripify(const std::vector<uint32_t> &indices, uint32_t restartIndex = MESH_OPTIMIZER_RESTART_INDEX)
+{
+    size_t vertexCount = detail::maxIndex(indices);
+    size_t triangleCount = indices.size() / 3;
+    if (restartIndex < vertexCount) {
+        std::cout << "ERROR::MESH_OPTIMIZER::RESTART_INDEX_IN_USE vertex " << restartIndex << " exists" << std::endl;
+        return std::vector<uint32_t>();
+    }
+    detail::TriangleAdjacency adjacency(indices, vertexCount);
+
+    // Triangles are marked EMITTED once in a strip, or with the number of the trial walk that reached them
+    const uint32_t EMITTED = 0xFFFFFFFF;
+    std::vector<uint32_t> marks(triangleCount, 0);
+    uint32_t walk = 0;
+
+    // The triangle not yet marked with mark (or EMITTED) that has the edge from -> to, and its third vertex
+    auto across = [&](uint32_t from, uint32_t to, uint32_t mark, uint32_t &third) -> long long {
+        for (uint32_t a = adjacency.offsets[from]; a < adjacency.offsets[from + 1]; a++) {
+            uint32_t triangle = adjacency.triangles[a];
+            if (marks[triangle] == EMITTED || marks[triangle] == mark) {
+                continue;
+            }
+            const uint32_t *v = &indices[triangle * 3];
+            for (int c = 0; c < 3; c++) {
+                if (v[c] == from && v[(c + 1) % 3] == to) {
+                    third = v[(c + 2) % 3];
+                    return triangle;
+                }
+            }
+        }
+        return -1;
+    };
+
+    // Grows a strip from one rotation of the start triangle, marking what it takes, and returns its length.
+    // GL draws strip triangle n from the last two vertices p, q and the next one as (p, q, next) when n is
+    // even and (q, p, next) when odd, so the next triangle is the one across that edge in that direction
+    auto follow = [&](uint32_t start, int rotation, uint32_t mark, std::vector<uint32_t> *out) -> size_t {
+        const uint32_t *v = &indices[start * 3];
+        uint32_t p = v[(rotation + 1) % 3], q = v[(rotation + 2) % 3];
+        marks[start] = mark;
+        if (out != nullptr) {
+            out->push_back(v[rotation]);
+            out->push_back(p);
+            out->push_back(q);
+        }
+
+        size_t length = 1;
+        for (;;) {
+            uint32_t third;
+            long long triangle = length & 1 ? across(q, p, mark, third) : across(p, q, mark, third);
+            if (triangle < 0) {
+                return length;
+            }
+            marks[triangle] = mark;
+            if (out != nullptr) {
+                out->push_back(third);
+            }
+            p = q;
+            q = third;
+            length++;
+        }
+    };
+
+    std::vector<uint32_t> strips;
+    strips.reserve(indices.size());
+    for (size_t start = 0; start < triangleCount; start++) {
+        if (marks[start] == EMITTED) {
+            continue;
+        }
+
+        // Which edge a strip leaves its first triangle by decides how far it gets: try all three
+        int bestRotation = 0;
+        size_t bestLength = 0;
+        for (int rotation = 0; rotation < 3; rotation++) {
+            size_t length = follow((uint32_t)start, rotation, ++walk, nullptr);
+            if (length > bestLength) {
+                bestLength = length;
+                bestRotation = rotation;
+            }
+        }
+
+        if (!strips.empty()) {
+            strips.push_back(restartIndex);
+        }
+        follow((uint32_t)start, bestRotation, EMITTED, &strips);
+    }
+    return strips;
+}
+
+// The triangle list GL draws from strips separated by restartIndex; degenerate triangles are dropped
+inline std::vector<uint32_t> unstripify(const std::vector<uint32_t> &strips, uint32_t restartIndex = MESH_OPTIMIZER_RESTART_INDEX)
+{
+    std::vector<uint32_t> indices;
+    indices.reserve(strips.size() * 3);
+    size_t stripStart = 0;
+    for (size_t i = 0; i + 2 < strips.size(); i++) {
+        uint32_t a = strips[i], b = strips[i + 1], c = strips[i + 2];
+        if (a == restartIndex) {
+            stripStart = i + 1;
+            continue;
+        }
+        if (b == restartIndex || c == restartIndex) {
+            continue;
+        }
+        if ((i - stripStart) & 1) {
+            std::swap(a, b);
+        }
+        if (a != b && b != c && a != c) {
+            indices.push_back(a);
+            indices.push_back(b);
+            indices.push_back(c);
+        }
+    }
+    return indices;
+}
+
+/* STRIPS END HERE */
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,1611 @@
+/*
+    A fake GL driver for measuring the CPU side of the renderer without a GPU.
+
+    MockGL::getProcAddress is a GLADloadproc: gladLoadGLLoader(MockGL::getProcAddress)
+    makes every glXxx call land here instead of in a driver. No window or
+    context is needed. The mock
+      - tracks the objects GL would (buffers with their contents, VAOs and
+        their attribute bindings, shaders, programs, queries, syncs,
+        framebuffers, renderbuffers, textures) and the bindings that use them;
+      - validates arguments the way a core profile context does and sets the
+        same error glGetError() would return; every failure is counted and
+        the first few are printed as ERROR::MOCK_GL::<error>;
+      - counts calls, draws, submitted vertices, state changes and uploaded
+        bytes (stats());
+      - can charge a fixed cost per call and per draw (setCallCost(),
+        setDrawCost()) by spinning, to model a driver's CPU overhead.
+    Shader "compilation" only checks for #version and main(); linking needs
+    both stages. A program's active uniforms and attributes are the ones its
+    sources declare, so ProgramReflection works against it.
+    GL_TIME_ELAPSED queries measure wall time between begin and end, and
+    syncs are always signalled. Entry points the mock doesn't implement
+    resolve to a stub that only counts (stats().unimplemented); any value
+    such a call returns is meaningless.
+    One mock per process, like glad's pointers; it is not thread safe.
+*/
+
+#ifndef RENDERER_MOCK_GL_H
+#define RENDERER_MOCK_GL_H
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace renderer {
+
+struct MockGLStats {
+    unsigned long long calls;           // every call into the mock
+    unsigned long long draws;           // glDraw* calls that passed validation
+    unsigned long long vertices;        // vertices (or indices) those draws submitted, times instances
+    unsigned long long stateChanges;    // binds, program switches and fixed-function state
+    unsigned long long uploadedBytes;   // glBufferData and glBufferSubData
+    unsigned long long objectsCreated;
+    unsigned long long errors;          // calls that failed validation
+    unsigned long long unimplemented;   // calls to entry points the mock doesn't implement
+};
+
+class MockGL {
+public:
+    static const int MAX_VERTEX_ATTRIBS = 16;
+
+    // The GLADloadproc
+    static void *getProcAddress(const char *name)
+    {
+        const std::unordered_map<std::string, void *> &table = entryPoints();
+        auto entry = table.find(name);
+        return entry != table.end() ? entry->second : (void *)&unimplemented;
+    }
+
+    // Nanoseconds every call, and every draw on top of that, spins for
+    static void setCallCost(long long nanoseconds) { get().callCost = nanoseconds; }
+    static void setDrawCost(long long nanoseconds) { get().drawCost = nanoseconds; }
+
+    // How many validation errors are printed before the rest are only counted
+    static void setPrintedErrors(int count) { get().printedErrors = count; }
+
+    static MockGLStats stats() { return get().stats; }
+    static void resetStats() { get().stats = MockGLStats{}; }
+
+    // Objects created and not deleted yet; non-zero at exit is a leak
+    static size_t liveObjects()
+    {
+        State &state = get();
+        return state.buffers.size() + state.vertexArrays.size() + state.shaders.size() + state.programs.size() + state.queries.size()
+               + state.syncs.size() + state.framebuffers.size() + state.renderbuffers.size() + state.textures.size();
+    }
+
+    // Drops every object and binding, like a fresh context; the statistics stay
+    static void reset()
+    {
+        State &state = get();
+        MockGLStats stats = state.stats;
+        long long callCost = state.callCost, drawCost = state.drawCost;
+        int printedErrors = state.printedErrors;
+        state = State();
+        state.stats = stats;
+        state.callCost = callCost;
+        state.drawCost = drawCost;
+        state.printedErrors = printedErrors;
+    }
+
+    static void printSummary()
+    {
+        const MockGLStats &stats = get().stats;
+        std::cout << "Mock GL: " << stats.calls << " calls, " << stats.draws << " draws (" << stats.vertices << " vertices), "
+                  << stats.stateChanges << " state changes, " << stats.uploadedBytes << " bytes uploaded, "
+                  << stats.objectsCreated << " objects created, " << liveObjects() << " still alive, "
+                  << stats.errors << " errors, " << stats.unimplemented << " calls to unimplemented entry points" << std::endl;
+    }
+
+private:
+    struct Buffer {
+        std::vector<unsigned char> data;
+        bool mapped = false;
+    };
+
+    struct Attribute {
+        bool enabled = false;
+        unsigned int buffer = 0;
+        int size = 4;
+        GLenum type = GL_FLOAT;
+        int stride = 0;
+        size_t offset = 0;
+        unsigned int divisor = 0;
+    };
+
+    struct VertexArray {
+        unsigned int elementBuffer = 0;
+        Attribute attributes[MAX_VERTEX_ATTRIBS];
+    };
+
+    struct Shader {
+        GLenum type;
+        std::string source;
+        bool compiled = false;
+        std::string infoLog;
+    };
+
+    struct Variable {
+        std::string name;
+        GLenum type;
+        int size;
+        int location;
+    };
+
+    struct Program {
+        std::vector<unsigned int> attached;
+        bool linked = false;
+        std::string infoLog;
+        std::vector<Variable> uniforms;
+        std::vector<Variable> attributes;
+    };
+
+    struct Query {
+        GLenum target = 0;
+        bool active = false;
+        std::chrono::steady_clock::time_point begin;
+        unsigned long long result = 0;
+    };
+
+    struct State {
+        MockGLStats stats = {};
+        long long callCost = 0;
+        long long drawCost = 0;
+        int printedErrors = 16;
+        GLenum error = GL_NO_ERROR;
+
+        // Buffers, VAOs, queries, framebuffers, renderbuffers and textures each have their
+        // own names; shaders and programs share one pool
+        unsigned int nextName = 1;
+        unsigned int nextShaderName = 1;
+        uintptr_t nextSync = 1;
+
+        std::unordered_map<unsigned int, Buffer> buffers;
+        std::unordered_map<unsigned int, VertexArray> vertexArrays;
+        std::unordered_map<unsigned int, Shader> shaders;
+        std::unordered_map<unsigned int, Program> programs;
+        std::unordered_map<unsigned int, Query> queries;
+        std::unordered_set<uintptr_t> syncs;
+        std::unordered_set<unsigned int> framebuffers;
+        std::unordered_set<unsigned int> renderbuffers;
+        std::unordered_set<unsigned int> textures;
+
+        // Buffer bindings other than GL_ELEMENT_ARRAY_BUFFER, which belongs to the VAO
+        std::unordered_map<GLenum, unsigned int> boundBuffers;
+        unsigned int vertexArray = 0;
+        unsigned int program = 0;
+        unsigned int framebuffer = 0;
+        unsigned int renderbuffer = 0;
+        GLint viewport[4] = {0, 0, 0, 0};
+        bool primitiveRestart = false;
+        unsigned int restartIndex = 0;
+    };
+
+    static State &get()
+    {
+        static State state;
+        return state;
+    }
+
+    /* BOOKKEEPING STARTS HERE */
+
+    static void spin(long long nanoseconds)
+    {
+        auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(nanoseconds);
+        while (std::chrono::steady_clock::now() < until) {
+        }
+    }
+
+    // Every entry point starts here
+    static State &enter()
+    {
+        State &state = get();
+        state.stats.calls++;
+        if (state.callCost > 0) {
+            spin(state.callCost);
+        }
+        return state;
+    }
+
+    static const char *errorName(GLenum error)
+    {
+        switch (error) {
+        case GL_INVALID_ENUM: return "INVALID_ENUM";
+        case GL_INVALID_VALUE: return "INVALID_VALUE";
+        case GL_INVALID_OPERATION: return "INVALID_OPERATION";
+        case GL_INVALID_FRAMEBUFFER_OPERATION: return "INVALID_FRAMEBUFFER_OPERATION";
+        case GL_OUT_OF_MEMORY: return "OUT_OF_MEMORY";
+        default: return "UNKNOWN";
+        }
+    }
+
+    // Records a validation failure; like GL, the first error sticks until glGetError()
+    static void fail(State &state, GLenum error, const char *function, const char *message)
+    {
+        if (state.error == GL_NO_ERROR) {
+            state.error = error;
+        }
+        if (state.stats.errors < (unsigned long long)state.printedErrors) {
+            std::cout << "ERROR::MOCK_GL::" << errorName(error) << " " << function << ": " << message << std::endl;
+        }
+        state.stats.errors++;
+    }
+
+    static bool isBufferTarget(GLenum target)
+    {
+        switch (target) {
+        case GL_ARRAY_BUFFER:
+        case GL_ELEMENT_ARRAY_BUFFER:
+        case GL_PIXEL_PACK_BUFFER:
+        case GL_PIXEL_UNPACK_BUFFER:
+        case GL_UNIFORM_BUFFER:
+        case GL_COPY_READ_BUFFER:
+        case GL_COPY_WRITE_BUFFER:
+        case GL_TEXTURE_BUFFER:
+        case GL_TRANSFORM_FEEDBACK_BUFFER:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // The buffer bound to target, or 0
+    static unsigned int boundBuffer(State &state, GLenum target)
+    {
+        if (target == GL_ELEMENT_ARRAY_BUFFER) {
+            auto vertexArray = state.vertexArrays.find(state.vertexArray);
+            return vertexArray != state.vertexArrays.end() ? vertexArray->second.elementBuffer : 0;
+        }
+        auto binding = state.boundBuffers.find(target);
+        return binding != state.boundBuffers.end() ? binding->second : 0;
+    }
+
+    // The buffer object bound to target, after the checks every buffer call makes
+    static Buffer *targetBuffer(State &state, GLenum target, const char *function)
+    {
+        if (!isBufferTarget(target)) {
+            fail(state, GL_INVALID_ENUM, function, "unknown buffer target");
+            return nullptr;
+        }
+        unsigned int name = boundBuffer(state, target);
+        if (name == 0) {
+            fail(state, GL_INVALID_OPERATION, function, "no buffer bound to the target");
+            return nullptr;
+        }
+        return &state.buffers[name];
+    }
+
+    static void genNames(State &state, GLsizei n, GLuint *names, const char *function)
+    {
+        if (n < 0) {
+            fail(state, GL_INVALID_VALUE, function, "negative count");
+            return;
+        }
+        for (GLsizei i = 0; i < n; i++) {
+            names[i] = state.nextName++;
+        }
+        state.stats.objectsCreated += n;
+    }
+
+    static size_t typeSize(GLenum type)
+    {
+        switch (type) {
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE:
+            return 1;
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT:
+            return 2;
+        case GL_DOUBLE:
+            return 8;
+        default:
+            return 4;
+        }
+    }
+
+    // One element of an attribute; the packed formats hold all four components in 4 bytes
+    static size_t attributeBytes(int size, GLenum type)
+    {
+        if (type == GL_INT_2_10_10_10_REV || type == GL_UNSIGNED_INT_2_10_10_10_REV) {
+            return 4;
+        }
+        return size * typeSize(type);
+    }
+
+    /* BOOKKEEPING ENDS HERE */
+    /* REFLECTION STARTS HERE */
+
+    static GLenum glslType(const std::string &type, int &components)
+    {
+        static const struct { const char *name; GLenum type; int components; } TYPES[] = {
+            {"float", GL_FLOAT, 1}, {"vec2", GL_FLOAT_VEC2, 2}, {"vec3", GL_FLOAT_VEC3, 3}, {"vec4", GL_FLOAT_VEC4, 4},
+            {"int", GL_INT, 1}, {"ivec2", GL_INT_VEC2, 2}, {"ivec3", GL_INT_VEC3, 3}, {"ivec4", GL_INT_VEC4, 4},
+            {"uint", GL_UNSIGNED_INT, 1}, {"bool", GL_BOOL, 1}, {"mat2", GL_FLOAT_MAT2, 4}, {"mat3", GL_FLOAT_MAT3, 9},
+            {"mat4", GL_FLOAT_MAT4, 16}, {"sampler2D", GL_SAMPLER_2D, 1}, {"samplerCube", GL_SAMPLER_CUBE, 1}
+        };
+        for (const auto &entry : TYPES) {
+            if (type == entry.name) {
+                components = entry.components;
+                return entry.type;
+            }
+        }
+        components = 1;
+        return GL_FLOAT;
+    }
+
+    // Collects "uniform T name[N];" (or "in T name;" with an optional layout location) declarations
+    static void declarations(const std::string &source, const char *qualifier, std::vector<Variable> &out, int &nextLocation)
+    {
+        size_t start = 0;
+        while (start < source.size()) {
+            size_t end = source.find_first_of(";{}", start);
+            if (end == std::string::npos) {
+                end = source.size();
+            }
+            std::string statement = source.substr(start, end - start);
+            start = end + 1;
+
+            // Drop preprocessor lines, then split on whitespace and layout punctuation
+            std::vector<std::string> tokens;
+            int explicitLocation = -1;
+            size_t position = 0;
+            while (position < statement.size()) {
+                if (statement[position] == '#') {
+                    position = statement.find('\n', position);
+                    if (position == std::string::npos) {
+                        break;
+                    }
+                    continue;
+                }
+                if (isspace((unsigned char)statement[position]) || strchr("(),=", statement[position]) != nullptr) {
+                    position++;
+                    continue;
+                }
+                size_t tokenEnd = position;
+                while (tokenEnd < statement.size() && !isspace((unsigned char)statement[tokenEnd]) && strchr("(),=", statement[tokenEnd]) == nullptr) {
+                    tokenEnd++;
+                }
+                tokens.push_back(statement.substr(position, tokenEnd - position));
+                position = tokenEnd;
+            }
+
+            size_t i = 0;
+            if (i < tokens.size() && tokens[i] == "layout") {
+                for (i = 1; i + 1 < tokens.size() && tokens[i] != qualifier; i++) {
+                    if (tokens[i] == "location") {
+                        explicitLocation = atoi(tokens[i + 1].c_str());
+                    }
+                }
+            }
+            if (i + 2 >= tokens.size() || tokens[i] != qualifier) {
+                continue;
+            }
+            // Skip precision qualifiers
+            i++;
+            while (i + 1 < tokens.size() && (tokens[i] == "highp" || tokens[i] == "mediump" || tokens[i] == "lowp" || tokens[i] == "flat")) {
+                i++;
+            }
+
+            Variable variable;
+            int components;
+            variable.type = glslType(tokens[i], components);
+            variable.name = tokens[i + 1];
+            variable.size = 1;
+            size_t bracket = variable.name.find('[');
+            if (bracket != std::string::npos) {
+                variable.size = atoi(variable.name.c_str() + bracket + 1);
+                variable.name.resize(bracket);
+            }
+            variable.location = explicitLocation >= 0 ? explicitLocation : nextLocation;
+            nextLocation = variable.location + (components > 4 ? components / 4 : 1) * variable.size;
+            out.push_back(variable);
+        }
+    }
+
+    static const Variable *findVariable(const std::vector<Variable> &variables, const char *name)
+    {
+        std::string wanted = name;
+        size_t bracket = wanted.find('[');
+        if (bracket != std::string::npos) {
+            wanted.resize(bracket);
+        }
+        for (const Variable &variable : variables) {
+            if (variable.name == wanted) {
+                return &variable;
+            }
+        }
+        return nullptr;
+    }
+
+    /* REFLECTION ENDS HERE */
+    /* ENTRY POINTS START HERE */
+
+    static void APIENTRY unimplemented(void)
+    {
+        enter().stats.unimplemented++;
+    }
+
+    static const GLubyte *APIENTRY getString(GLenum name)
+    {
+        State &state = enter();
+        switch (name) {
+        case GL_VENDOR: return (const GLubyte *)"renderer";
+        case GL_RENDERER: return (const GLubyte *)"MockGL";
+        case GL_VERSION: return (const GLubyte *)"3.3.0 MockGL";
+        case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"3.30 MockGL";
+        default:
+            fail(state, GL_INVALID_ENUM, "glGetString", "unknown name");
+            return NULL;
+        }
+    }
+
+    // No extensions: callers take their core profile paths
+    static const GLubyte *APIENTRY getStringi(GLenum name, GLuint index)
+    {
+        fail(enter(), GL_INVALID_VALUE, "glGetStringi", "no extensions");
+        return NULL;
+    }
+
+    static void APIENTRY getIntegerv(GLenum pname, GLint *data)
+    {
+        State &state = enter();
+        switch (pname) {
+        case GL_MAJOR_VERSION: *data = 3; break;
+        case GL_MINOR_VERSION: *data = 3; break;
+        case GL_NUM_EXTENSIONS: *data = 0; break;
+        case GL_NUM_PROGRAM_BINARY_FORMATS: *data = 0; break;
+        case GL_MAX_VERTEX_ATTRIBS: *data = MAX_VERTEX_ATTRIBS; break;
+        case GL_CURRENT_PROGRAM: *data = (GLint)state.program; break;
+        case GL_VERTEX_ARRAY_BINDING: *data = (GLint)state.vertexArray; break;
+        case GL_ARRAY_BUFFER_BINDING: *data = (GLint)boundBuffer(state, GL_ARRAY_BUFFER); break;
+        case GL_ELEMENT_ARRAY_BUFFER_BINDING: *data = (GLint)boundBuffer(state, GL_ELEMENT_ARRAY_BUFFER); break;
+        case GL_FRAMEBUFFER_BINDING: *data = (GLint)state.framebuffer; break;
+        case GL_VIEWPORT: memcpy(data, state.viewport, sizeof(state.viewport)); break;
+        default:
+            *data = 0;
+            break;
+        }
+    }
+
+    static GLenum APIENTRY getError(void)
+    {
+        State &state = enter();
+        GLenum error = state.error;
+        state.error = GL_NO_ERROR;
+        return error;
+    }
+
+    // Fixed-function state: only counted
+    static void APIENTRY viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        State &state = enter();
+        if (width < 0 || height < 0) {
+            fail(state, GL_INVALID_VALUE, "glViewport", "negative size");
+            return;
+        }
+        state.viewport[0] = x;
+        state.viewport[1] = y;
+        state.viewport[2] = width;
+        state.viewport[3] = height;
+        state.stats.stateChanges++;
+    }
+
+    static void APIENTRY clearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) { enter().stats.stateChanges++; }
+    static void APIENTRY enable(GLenum cap) { setCapability(cap, true); }
+    static void APIENTRY disable(GLenum cap) { setCapability(cap, false); }
+
+    // Only primitive restart changes what the mock does
+    static void setCapability(GLenum cap, bool enabled)
+    {
+        State &state = enter();
+        if (cap == GL_PRIMITIVE_RESTART) {
+            state.primitiveRestart = enabled;
+        }
+        state.stats.stateChanges++;
+    }
+
+    static void APIENTRY primitiveRestartIndex(GLuint index)
+    {
+        State &state = enter();
+        state.restartIndex = index;
+        state.stats.stateChanges++;
+    }
+    static void APIENTRY blendFunc(GLenum sfactor, GLenum dfactor) { enter().stats.stateChanges++; }
+    static void APIENTRY polygonMode(GLenum face, GLenum mode) { enter().stats.stateChanges++; }
+    static void APIENTRY pixelStorei(GLenum pname, GLint param) { enter().stats.stateChanges++; }
+    static void APIENTRY finish(void) { enter(); }
+    static void APIENTRY flush(void) { enter(); }
+
+    static void APIENTRY clear(GLbitfield mask)
+    {
+        State &state = enter();
+        if (mask & ~(GLbitfield)(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT)) {
+            fail(state, GL_INVALID_VALUE, "glClear", "unknown bits in the mask");
+        }
+    }
+
+    /* BUFFERS */
+
+    static void APIENTRY genBuffers(GLsizei n, GLuint *buffers)
+    {
+        State &state = enter();
+        genNames(state, n, buffers, "glGenBuffers");
+        for (GLsizei i = 0; i < n; i++) {
+            state.buffers[buffers[i]];
+        }
+    }
+
+    static void APIENTRY deleteBuffers(GLsizei n, const GLuint *buffers)
+    {
+        State &state = enter();
+        if (n < 0) {
+            fail(state, GL_INVALID_VALUE, "glDeleteBuffers", "negative count");
+            return;
+        }
+        for (GLsizei i = 0; i < n; i++) {
+            if (buffers[i] == 0 || state.buffers.erase(buffers[i]) == 0) {
+                continue;
+            }
+            // Deleting a bound buffer unbinds it, from the current VAO too
+            for (auto &binding : state.boundBuffers) {
+                if (binding.second == buffers[i]) {
+                    binding.second = 0;
+                }
+            }
+            auto vertexArray = state.vertexArrays.find(state.vertexArray);
+            if (vertexArray != state.vertexArrays.end()) {
+                if (vertexArray->second.elementBuffer == buffers[i]) {
+                    vertexArray->second.elementBuffer = 0;
+                }
+                for (Attribute &attribute : vertexArray->second.attributes) {
+                    if (attribute.buffer == buffers[i]) {
+                        attribute.buffer = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    static void APIENTRY bindBuffer(GLenum target, GLuint buffer)
+    {
+        State &state = enter();
+        if (!isBufferTarget(target)) {
+            fail(state, GL_INVALID_ENUM, "glBindBuffer", "unknown buffer target");
+            return;
+        }
+        if (buffer != 0 && state.buffers.count(buffer) == 0) {
+            fail(state, GL_INVALID_OPERATION, "glBindBuffer", "name not from glGenBuffers");
+            return;
+        }
+        if (target == GL_ELEMENT_ARRAY_BUFFER) {
+            auto vertexArray = state.vertexArrays.find(state.vertexArray);
+            if (vertexArray == state.vertexArrays.end()) {
+                // Core profile: no VAO, nowhere to keep the binding
+                if (buffer != 0) {
+                    fail(state, GL_INVALID_OPERATION, "glBindBuffer", "GL_ELEMENT_ARRAY_BUFFER with no vertex array bound");
+                }
+                return;
+            }
+            vertexArray->second.elementBuffer = buffer;
+        } else {
+            state.boundBuffers[target] = buffer;
+        }
+        state.stats.stateChanges++;
+    }
+
+    static void APIENTRY bufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+    {
+        State &state = enter();
+        if (size < 0) {
+            fail(state, GL_INVALID_VALUE, "glBufferData", "negative size");
+            return;
+        }
+        Buffer *buffer = targetBuffer(state, target, "glBufferData");
+        if (buffer == nullptr) {
+            return;
+        }
+        if (buffer->mapped) {
+            fail(state, GL_INVALID_OPERATION, "glBufferData", "buffer is mapped");
+            return;
+        }
+        buffer->data.assign((size_t)size, 0);
+        if (data != NULL) {
+            memcpy(buffer->data.data(), data, (size_t)size);
+        }
+        state.stats.uploadedBytes += (unsigned long long)size;
+    }
+
+    static void APIENTRY bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+    {
+        State &state = enter();
+        Buffer *buffer = targetBuffer(state, target, "glBufferSubData");
+        if (buffer == nullptr) {
+            return;
+        }
+        if (offset < 0 || size < 0 || (size_t)(offset + size) > buffer->data.size()) {
+            fail(state, GL_INVALID_VALUE, "glBufferSubData", "range outside the buffer");
+            return;
+        }
+        if (data != NULL) {
+            memcpy(buffer->data.data() + offset, data, (size_t)size);
+        }
+        state.stats.uploadedBytes += (unsigned long long)size;
+    }
+
+    static void *APIENTRY mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+    {
+        State &state = enter();
+        Buffer *buffer = targetBuffer(state, target, "glMapBufferRange");
+        if (buffer == nullptr) {
+            return NULL;
+        }
+        if (offset < 0 || length <= 0 || (size_t)(offset + length) > buffer->data.size() || buffer->mapped) {
+            fail(state, buffer->mapped ? GL_INVALID_OPERATION : GL_INVALID_VALUE, "glMapBufferRange", "bad range or already mapped");
+            return NULL;
+        }
+        buffer->mapped = true;
+        return buffer->data.data() + offset;
+    }
+
+    static GLboolean APIENTRY unmapBuffer(GLenum target)
+    {
+        State &state = enter();
+        Buffer *buffer = targetBuffer(state, target, "glUnmapBuffer");
+        if (buffer == nullptr) {
+            return GL_FALSE;
+        }
+        if (!buffer->mapped) {
+            fail(state, GL_INVALID_OPERATION, "glUnmapBuffer", "buffer is not mapped");
+            return GL_FALSE;
+        }
+        buffer->mapped = false;
+        return GL_TRUE;
+    }
+
+    /* VERTEX ARRAYS */
+
+    static void APIENTRY genVertexArrays(GLsizei n, GLuint *arrays)
+    {
+        State &state = enter();
+        genNames(state, n, arrays, "glGenVertexArrays");
+        for (GLsizei i = 0; i < n; i++) {
+            state.vertexArrays[arrays[i]];
+        }
+    }
+
+    static void APIENTRY deleteVertexArrays(GLsizei n, const GLuint *arrays)
+    {
+        State &state = enter();
+        if (n < 0) {
+            fail(state, GL_INVALID_VALUE, "glDeleteVertexArrays", "negative count");
+            return;
+        }
+        for (GLsizei i = 0; i < n; i++) {
+            if (arrays[i] != 0 && state.vertexArrays.erase(arrays[i]) != 0 && state.vertexArray == arrays[i]) {
+                state.vertexArray = 0;
+            }
+        }
+    }
+
+    static void APIENTRY bindVertexArray(GLuint array)
+    {
+        State &state = enter();
+        if (array != 0 && state.vertexArrays.count(array) == 0) {
+            fail(state, GL_INVALID_OPERATION, "glBindVertexArray", "name not from glGenVertexArrays");
+            return;
+        }
+        state.vertexArray = array;
+        state.stats.stateChanges++;
+    }
+
+    // The attribute slot of the bound VAO, after the checks every attribute call makes
+    static Attribute *attribute(State &state, GLuint index, const char *function)
+    {
+        if (index >= (GLuint)MAX_VERTEX_ATTRIBS) {
+            fail(state, GL_INVALID_VALUE, function, "index past GL_MAX_VERTEX_ATTRIBS");
+            return nullptr;
+        }
+        auto vertexArray = state.vertexArrays.find(state.vertexArray);
+        if (vertexArray == state.vertexArrays.end()) {
+            fail(state, GL_INVALID_OPERATION, function, "no vertex array bound");
+            return nullptr;
+        }
+        return &vertexArray->second.attributes[index];
+    }
+
+    static void APIENTRY vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+    {
+        State &state = enter();
+        Attribute *slot = attribute(state, index, "glVertexAttribPointer");
+        if (slot == nullptr) {
+            return;
+        }
+        if (size < 1 || size > 4 || stride < 0) {
+            fail(state, GL_INVALID_VALUE, "glVertexAttribPointer", "size must be 1 to 4 and stride non-negative");
+            return;
+        }
+        unsigned int buffer = boundBuffer(state, GL_ARRAY_BUFFER);
+        if (buffer == 0 && pointer != NULL) {
+            fail(state, GL_INVALID_OPERATION, "glVertexAttribPointer", "client-side arrays need a GL_ARRAY_BUFFER in core profile");
+            return;
+        }
+        slot->buffer = buffer;
+        slot->size = size;
+        slot->type = type;
+        slot->stride = stride != 0 ? stride : (int)attributeBytes(size, type);
+        slot->offset = (size_t)pointer;
+        state.stats.stateChanges++;
+    }
+
+    static void APIENTRY enableVertexAttribArray(GLuint index)
+    {
+        State &state = enter();
+        Attribute *slot = attribute(state, index, "glEnableVertexAttribArray");
+        if (slot != nullptr) {
+            slot->enabled = true;
+            state.stats.stateChanges++;
+        }
+    }
+
+    static void APIENTRY disableVertexAttribArray(GLuint index)
+    {
+        State &state = enter();
+        Attribute *slot = attribute(state, index, "glDisableVertexAttribArray");
+        if (slot != nullptr) {
+            slot->enabled = false;
+            state.stats.stateChanges++;
+        }
+    }
+
+    static void APIENTRY vertexAttribDivisor(GLuint index, GLuint divisor)
+    {
+        State &state = enter();
+        Attribute *slot = attribute(state, index, "glVertexAttribDivisor");
+        if (slot != nullptr) {
+            slot->divisor = divisor;
+            state.stats.stateChanges++;
+        }
+    }
+
+    /* SHADERS AND PROGRAMS */
+
+    static GLuint APIENTRY createShader(GLenum type)
+    {
+        State &state = enter();
+        if (type != GL_VERTEX_SHADER && type != GL_FRAGMENT_SHADER && type != GL_GEOMETRY_SHADER) {
+            fail(state, GL_INVALID_ENUM, "glCreateShader", "unknown shader type");
+            return 0;
+        }
+        GLuint name = state.nextShaderName++;
+        state.shaders[name].type = type;
+        state.stats.objectsCreated++;
+        return name;
+    }
+
+    static void APIENTRY deleteShader(GLuint shader)
+    {
+        State &state = enter();
+        if (shader != 0 && state.shaders.erase(shader) == 0) {
+            fail(state, GL_INVALID_VALUE, "glDeleteShader", "not a shader");
+        }
+    }
+
+    static Shader *findShader(State &state, GLuint shader, const char *function)
+    {
+        auto found = state.shaders.find(shader);
+        if (found == state.shaders.end()) {
+            fail(state, state.programs.count(shader) != 0 ? GL_INVALID_OPERATION : GL_INVALID_VALUE, function, "not a shader");
+            return nullptr;
+        }
+        return &found->second;
+    }
+
+    static Program *findProgram(State &state, GLuint program, const char *function)
+    {
+        auto found = state.programs.find(program);
+        if (found == state.programs.end()) {
+            fail(state, state.shaders.count(program) != 0 ? GL_INVALID_OPERATION : GL_INVALID_VALUE, function, "not a program");
+            return nullptr;
+        }
+        return &found->second;
+    }
+
+    static void APIENTRY shaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length)
+    {
+        State &state = enter();
+        Shader *target = findShader(state, shader, "glShaderSource");
+        if (target == nullptr) {
+            return;
+        }
+        if (count < 0) {
+            fail(state, GL_INVALID_VALUE, "glShaderSource", "negative count");
+            return;
+        }
+        target->source.clear();
+        for (GLsizei i = 0; i < count; i++) {
+            if (length != NULL && length[i] >= 0) {
+                target->source.append(string[i], (size_t)length[i]);
+            } else {
+                target->source.append(string[i]);
+            }
+        }
+    }
+
+    static void APIENTRY compileShader(GLuint shader)
+    {
+        State &state = enter();
+        Shader *target = findShader(state, shader, "glCompileShader");
+        if (target == nullptr) {
+            return;
+        }
+        target->compiled = target->source.find("#version") != std::string::npos && target->source.find("main") != std::string::npos;
+        target->infoLog = target->compiled ? "" : "0:1(1): error: MockGL needs #version and main()\n";
+    }
+
+    static void APIENTRY getShaderiv(GLuint shader, GLenum pname, GLint *params)
+    {
+        State &state = enter();
+        Shader *target = findShader(state, shader, "glGetShaderiv");
+        if (target == nullptr) {
+            return;
+        }
+        switch (pname) {
+        case GL_SHADER_TYPE: *params = (GLint)target->type; break;
+        case GL_COMPILE_STATUS: *params = target->compiled; break;
+        case GL_COMPLETION_STATUS_KHR: *params = GL_TRUE; break;
+        case GL_DELETE_STATUS: *params = GL_FALSE; break;
+        case GL_INFO_LOG_LENGTH: *params = target->infoLog.empty() ? 0 : (GLint)target->infoLog.size() + 1; break;
+        case GL_SHADER_SOURCE_LENGTH: *params = target->source.empty() ? 0 : (GLint)target->source.size() + 1; break;
+        default:
+            fail(state, GL_INVALID_ENUM, "glGetShaderiv", "unknown parameter");
+        }
+    }
+
+    static void copyLog(const std::string &log, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+    {
+        GLsizei written = bufSize > 0 ? (GLsizei)std::min(log.size(), (size_t)bufSize - 1) : 0;
+        if (bufSize > 0) {
+            memcpy(infoLog, log.data(), (size_t)written);
+            infoLog[written] = '\0';
+        }
+        if (length != NULL) {
+            *length = written;
+        }
+    }
+
+    static void APIENTRY getShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+    {
+        State &state = enter();
+        Shader *target = findShader(state, shader, "glGetShaderInfoLog");
+        if (target != nullptr) {
+            copyLog(target->infoLog, bufSize, length, infoLog);
+        }
+    }
+
+    static GLuint APIENTRY createProgram(void)
+    {
+        State &state = enter();
+        GLuint name = state.nextShaderName++;
+        state.programs[name];
+        state.stats.objectsCreated++;
+        return name;
+    }
+
+    static void APIENTRY deleteProgram(GLuint program)
+    {
+        State &state = enter();
+        if (program == 0) {
+            return;
+        }
+        if (state.programs.erase(program) == 0) {
+            fail(state, GL_INVALID_VALUE, "glDeleteProgram", "not a program");
+            return;
+        }
+        if (state.program == program) {
+            state.program = 0;
+        }
+    }
+
+    static void APIENTRY attachShader(GLuint program, GLuint shader)
+    {
+        State &state = enter();
+        Program *target = findProgram(state, program, "glAttachShader");
+        if (target == nullptr || findShader(state, shader, "glAttachShader") == nullptr) {
+            return;
+        }
+        for (GLuint attached : target->attached) {
+            if (attached == shader) {
+                fail(state, GL_INVALID_OPERATION, "glAttachShader", "shader already attached");
+                return;
+            }
+        }
+        target->attached.push_back(shader);
+    }
+
+    static void APIENTRY detachShader(GLuint program, GLuint shader)
+    {
+        State &state = enter();
+        Program *target = findProgram(state, program, "glDetachShader");
+        if (target == nullptr) {
+            return;
+        }
+        for (size_t i = 0; i < target->attached.size(); i++) {
+            if (target->attached[i] == shader) {
+                target->attached.erase(target->attached.begin() + i);
+                return;
+            }
+        }
+        fail(state, GL_INVALID_OPERATION, "glDetachShader", "shader not attached");
+    }
+
+    static void APIENTRY linkProgram(GLuint program)
+    {
+        State &state = enter();
+        Program *target = findProgram(state, program, "glLinkProgram");
+        if (target == nullptr) {
+            return;
+        }
+
+        // Shaders deleted while attached are gone here already, so only the live ones count
+        const Shader *vertex = nullptr;
+        const Shader *fragment = nullptr;
+        for (GLuint attached : target->attached) {
+            auto shader = state.shaders.find(attached);
+            if (shader != state.shaders.end() && shader->second.compiled) {
+                if (shader->second.type == GL_VERTEX_SHADER) {
+                    vertex = &shader->second;
+                } else if (shader->second.type == GL_FRAGMENT_SHADER) {
+                    fragment = &shader->second;
+                }
+            }
+        }
+        target->uniforms.clear();
+        target->attributes.clear();
+        target->linked = vertex != nullptr && fragment != nullptr;
+        if (!target->linked) {
+            target->infoLog = "error: MockGL links a compiled vertex and fragment shader\n";
+            return;
+        }
+        target->infoLog.clear();
+
+        int nextUniform = 0, nextAttribute = 0;
+        declarations(vertex->source, "uniform", target->uniforms, nextUniform);
+        declarations(fragment->source, "uniform", target->uniforms, nextUniform);
+        declarations(vertex->source, "in", target->attributes, nextAttribute);
+
+        // A uniform both stages declare is one uniform
+        for (size_t i = 0; i < target->uniforms.size(); i++) {
+            for (size_t j = i + 1; j < target->uniforms.size(); j++) {
+                if (target->uniforms[j].name == target->uniforms[i].name) {
+                    target->uniforms.erase(target->uniforms.begin() + j--);
+                }
+            }
+        }
+    }
+
+    // Linked from the cached binary: the mock has no binary formats, so this always fails
+    static void APIENTRY programBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+    {
+        fail(enter(), GL_INVALID_ENUM, "glProgramBinary", "no binary formats");
+    }
+
+    static void APIENTRY programParameteri(GLuint program, GLenum pname, GLint value)
+    {
+        State &state = enter();
+        findProgram(state, program, "glProgramParameteri");
+    }
+
+    static GLint maxNameLength(const std::vector<Variable> &variables)
+    {
+        size_t longest = 0;
+        for (const Variable &variable : variables) {
+            longest = std::max(longest, variable.name.size() + 1);
+        }
+        return (GLint)longest;
+    }
+
+    static void APIENTRY getProgramiv(GLuint program, GLenum pname, GLint *params)
+    {
+        State &state = enter();
+        Program *target = findProgram(state, program, "glGetProgramiv");
+        if (target == nullptr) {
+            return;
+        }
+        switch (pname) {
+        case GL_LINK_STATUS: *params = target->linked; break;
+        case GL_COMPLETION_STATUS_KHR: *params = GL_TRUE; break;
+        case GL_DELETE_STATUS: *params = GL_FALSE; break;
+        case GL_VALIDATE_STATUS: *params = target->linked; break;
+        case GL_INFO_LOG_LENGTH: *params = target->infoLog.empty() ? 0 : (GLint)target->infoLog.size() + 1; break;
+        case GL_ATTACHED_SHADERS: *params = (GLint)target->attached.size(); break;
+        case GL_ACTIVE_UNIFORMS: *params = (GLint)target->uniforms.size(); break;
+        case GL_ACTIVE_UNIFORM_MAX_LENGTH: *params = maxNameLength(target->uniforms); break;
+        case GL_ACTIVE_ATTRIBUTES: *params = (GLint)target->attributes.size(); break;
+        case GL_ACTIVE_ATTRIBUTE_MAX_LENGTH: *params = maxNameLength(target->attributes); break;
+        case GL_PROGRAM_BINARY_LENGTH: *params = 0; break;
+        default:
+            fail(state, GL_INVALID_ENUM, "glGetProgramiv", "unknown parameter");
+        }
+    }
+
+    static void APIENTRY getProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+    {
+        State &state = enter();
+        Program *target = findProgram(state, program, "glGetProgramInfoLog");
+        if (target != nullptr) {
+            copyLog(target->infoLog, bufSize, length, infoLog);
+        }
+    }
+
+    static void APIENTRY useProgram(GLuint program)
+    {
+        State &state = enter();
+        if (program != 0) {
+            Program *target = findProgram(state, program, "glUseProgram");
+            if (target == nullptr) {
+                return;
+            }
+            if (!target->linked) {
+                fail(state, GL_INVALID_OPERATION, "glUseProgram", "program is not linked");
+                return;
+            }
+        }
+        state.program = program;
+        state.stats.stateChanges++;
+    }
+
+    static void activeVariable(const std::vector<Variable> &variables, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+    {
+        const Variable &variable = variables[index];
+        copyLog(variable.name, bufSize, length, name);
+        *size = variable.size;
+        *type = variable.type;
+    }
+
+    static void APIENTRY getActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+    {
+        State &state = enter();
+        Program *target = findProgram(state, program, "glGetActiveUniform");
+        if (target == nullptr) {
+            return;
+        }
+        if (index >= target->uniforms.size()) {
+            fail(state, GL_INVALID_VALUE, "glGetActiveUniform", "index past GL_ACTIVE_UNIFORMS");
+            return;
+        }
+        activeVariable(target->uniforms, index, bufSize, length, size, type, name);
+    }
+
+    static void APIENTRY getActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+    {
+        State &state = enter();
+        Program *target = findProgram(state, program, "glGetActiveAttrib");
+        if (target == nullptr) {
+            return;
+        }
+        if (index >= target->attributes.size()) {
+            fail(state, GL_INVALID_VALUE, "glGetActiveAttrib", "index past GL_ACTIVE_ATTRIBUTES");
+            return;
+        }
+        activeVariable(target->attributes, index, bufSize, length, size, type, name);
+    }
+
+    static GLint variableLocation(GLuint program, const GLchar *name, bool uniform, const char *function)
+    {
+        State &state = enter();
+        Program *target = findProgram(state, program, function);
+        if (target == nullptr) {
+            return -1;
+        }
+        if (!target->linked) {
+            fail(state, GL_INVALID_OPERATION, function, "program is not linked");
+            return -1;
+        }
+        const Variable *variable = findVariable(uniform ? target->uniforms : target->attributes, name);
+        if (variable == nullptr) {
+            return -1;
+        }
+        const char *bracket = strchr(name, '[');
+        return variable->location + (bracket != nullptr ? atoi(bracket + 1) : 0);
+    }
+
+    static GLint APIENTRY getUniformLocation(GLuint program, const GLchar *name)
+    {
+        return variableLocation(program, name, true, "glGetUniformLocation");
+    }
+
+    static GLint APIENTRY getAttribLocation(GLuint program, const GLchar *name)
+    {
+        return variableLocation(program, name, false, "glGetAttribLocation");
+    }
+
+    // Every glUniform* needs a program in use; location -1 is silently ignored
+    static void uniform(const char *function)
+    {
+        State &state = enter();
+        if (state.program == 0) {
+            fail(state, GL_INVALID_OPERATION, function, "no program in use");
+            return;
+        }
+        state.stats.stateChanges++;
+    }
+
+    static void APIENTRY uniform1i(GLint location, GLint v0) { uniform("glUniform1i"); }
+    static void APIENTRY uniform1f(GLint location, GLfloat v0) { uniform("glUniform1f"); }
+    static void APIENTRY uniform2f(GLint location, GLfloat v0, GLfloat v1) { uniform("glUniform2f"); }
+    static void APIENTRY uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { uniform("glUniform3f"); }
+    static void APIENTRY uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { uniform("glUniform4f"); }
+    static void APIENTRY uniform4fv(GLint location, GLsizei count, const GLfloat *value) { uniform("glUniform4fv"); }
+    static void APIENTRY uniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { uniform("glUniformMatrix4fv"); }
+
+    /* DRAWS */
+
+    // What every draw checks: a VAO, its enabled attributes backed by buffers big enough for
+    // vertexCount vertices (and instanceCount instances)
+    static bool validateDraw(State &state, GLenum mode, GLsizei count, GLsizei instanceCount, long long vertexCount, const char *function)
+    {
+        if (mode > GL_TRIANGLE_FAN && !(mode >= GL_LINES_ADJACENCY && mode <= GL_TRIANGLE_STRIP_ADJACENCY)) {
+            fail(state, GL_INVALID_ENUM, function, "unknown primitive mode");
+            return false;
+        }
+        if (count < 0 || instanceCount < 0) {
+            fail(state, GL_INVALID_VALUE, function, "negative count");
+            return false;
+        }
+        auto vertexArray = state.vertexArrays.find(state.vertexArray);
+        if (vertexArray == state.vertexArrays.end()) {
+            fail(state, GL_INVALID_OPERATION, function, "no vertex array bound");
+            return false;
+        }
+        for (const Attribute &attribute : vertexArray->second.attributes) {
+            if (!attribute.enabled) {
+                continue;
+            }
+            auto buffer = state.buffers.find(attribute.buffer);
+            if (buffer == state.buffers.end()) {
+                fail(state, GL_INVALID_OPERATION, function, "enabled attribute without a buffer");
+                return false;
+            }
+            if (buffer->second.mapped) {
+                fail(state, GL_INVALID_OPERATION, function, "attribute buffer is mapped");
+                return false;
+            }
+            long long elements = attribute.divisor == 0 ? vertexCount : (instanceCount + attribute.divisor - 1) / attribute.divisor;
+            size_t needed = elements > 0 ? attribute.offset + (size_t)(elements - 1) * attribute.stride + attributeBytes(attribute.size, attribute.type) : 0;
+            if (needed > buffer->second.data.size()) {
+                fail(state, GL_INVALID_OPERATION, function, "draw reads past the end of an attribute buffer");
+                return false;
+            }
+        }
+        if (state.program == 0) {
+            fail(state, GL_INVALID_OPERATION, function, "no program in use");
+            return false;
+        }
+        return true;
+    }
+
+    static void draw(State &state, GLsizei count, GLsizei instanceCount)
+    {
+        state.stats.draws++;
+        state.stats.vertices += (unsigned long long)count * instanceCount;
+        if (state.drawCost > 0) {
+            spin(state.drawCost);
+        }
+    }
+
+    static void arrays(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount, const char *function)
+    {
+        State &state = enter();
+        if (first < 0) {
+            fail(state, GL_INVALID_VALUE, function, "negative first");
+            return;
+        }
+        if (validateDraw(state, mode, count, instanceCount, count > 0 ? (long long)first + count : 0, function)) {
+            draw(state, count, instanceCount);
+        }
+    }
+
+    static void elements(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instanceCount, const char *function)
+    {
+        State &state = enter();
+        if (type != GL_UNSIGNED_BYTE && type != GL_UNSIGNED_SHORT && type != GL_UNSIGNED_INT) {
+            fail(state, GL_INVALID_ENUM, function, "index type must be unsigned");
+            return;
+        }
+        unsigned int elementBuffer = boundBuffer(state, GL_ELEMENT_ARRAY_BUFFER);
+        if (elementBuffer == 0) {
+            fail(state, GL_INVALID_OPERATION, function, "no element buffer in the vertex array");
+            return;
+        }
+
+        // The highest index decides how much of the vertex buffers the draw reads; restart indices read nothing
+        const Buffer &buffer = state.buffers[elementBuffer];
+        size_t size = typeSize(type), offset = (size_t)indices;
+        if (count > 0 && offset + (size_t)count * size > buffer.data.size()) {
+            fail(state, GL_INVALID_OPERATION, function, "indices past the end of the element buffer");
+            return;
+        }
+        long long highest = -1;
+        for (GLsizei i = 0; i < count; i++) {
+            const unsigned char *index = buffer.data.data() + offset + (size_t)i * size;
+            long long value = size == 1 ? *index : size == 2 ? *(const uint16_t *)index : *(const uint32_t *)index;
+            if (state.primitiveRestart && value == state.restartIndex) {
+                continue;
+            }
+            highest = std::max(highest, value);
+        }
+        if (validateDraw(state, mode, count, instanceCount, highest + 1, function)) {
+            draw(state, count, instanceCount);
+        }
+    }
+
+    static void APIENTRY drawArrays(GLenum mode, GLint first, GLsizei count)
+    {
+        arrays(mode, first, count, 1, "glDrawArrays");
+    }
+
+    static void APIENTRY drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+    {
+        arrays(mode, first, count, instancecount, "glDrawArraysInstanced");
+    }
+
+    static void APIENTRY drawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+    {
+        elements(mode, count, type, indices, 1, "glDrawElements");
+    }
+
+    static void APIENTRY drawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+    {
+        elements(mode, count, type, indices, instancecount, "glDrawElementsInstanced");
+    }
+
+    /* QUERIES AND SYNCS */
+
+    static void APIENTRY genQueries(GLsizei n, GLuint *ids)
+    {
+        State &state = enter();
+        genNames(state, n, ids, "glGenQueries");
+        for (GLsizei i = 0; i < n; i++) {
+            state.queries[ids[i]];
+        }
+    }
+
+    static void APIENTRY deleteQueries(GLsizei n, const GLuint *ids)
+    {
+        State &state = enter();
+        for (GLsizei i = 0; i < n; i++) {
+            state.queries.erase(ids[i]);
+        }
+    }
+
+    static void APIENTRY beginQuery(GLenum target, GLuint id)
+    {
+        State &state = enter();
+        auto query = state.queries.find(id);
+        if (query == state.queries.end() || query->second.active) {
+            fail(state, GL_INVALID_OPERATION, "glBeginQuery", "unknown or active query");
+            return;
+        }
+        for (const auto &other : state.queries) {
+            if (other.second.active && other.second.target == target) {
+                fail(state, GL_INVALID_OPERATION, "glBeginQuery", "a query on this target is active");
+                return;
+            }
+        }
+        query->second.target = target;
+        query->second.active = true;
+        query->second.begin = std::chrono::steady_clock::now();
+    }
+
+    static void APIENTRY endQuery(GLenum target)
+    {
+        State &state = enter();
+        for (auto &query : state.queries) {
+            if (query.second.active && query.second.target == target) {
+                query.second.active = false;
+                query.second.result = target == GL_TIME_ELAPSED
+                    ? (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - query.second.begin).count()
+                    : 0;
+                return;
+            }
+        }
+        fail(state, GL_INVALID_OPERATION, "glEndQuery", "no active query on this target");
+    }
+
+    // Results are always available
+    static bool queryResult(GLuint id, GLenum pname, unsigned long long &value, const char *function)
+    {
+        State &state = enter();
+        auto query = state.queries.find(id);
+        if (query == state.queries.end() || query->second.active) {
+            fail(state, GL_INVALID_OPERATION, function, "unknown or active query");
+            return false;
+        }
+        value = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : query->second.result;
+        return true;
+    }
+
+    static void APIENTRY getQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+    {
+        unsigned long long value;
+        if (queryResult(id, pname, value, "glGetQueryObjectiv")) {
+            *params = (GLint)value;
+        }
+    }
+
+    static void APIENTRY getQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+    {
+        unsigned long long value;
+        if (queryResult(id, pname, value, "glGetQueryObjectuiv")) {
+            *params = (GLuint)value;
+        }
+    }
+
+    static void APIENTRY getQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+    {
+        unsigned long long value;
+        if (queryResult(id, pname, value, "glGetQueryObjectui64v")) {
+            *params = value;
+        }
+    }
+
+    static GLsync APIENTRY fenceSync(GLenum condition, GLbitfield flags)
+    {
+        State &state = enter();
+        uintptr_t sync = state.nextSync++;
+        state.syncs.insert(sync);
+        state.stats.objectsCreated++;
+        return (GLsync)sync;
+    }
+
+    static GLenum APIENTRY clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        State &state = enter();
+        if (state.syncs.count((uintptr_t)sync) == 0) {
+            fail(state, GL_INVALID_VALUE, "glClientWaitSync", "not a sync");
+            return GL_WAIT_FAILED;
+        }
+        return GL_ALREADY_SIGNALED;
+    }
+
+    static void APIENTRY deleteSync(GLsync sync)
+    {
+        State &state = enter();
+        if (sync != NULL && state.syncs.erase((uintptr_t)sync) == 0) {
+            fail(state, GL_INVALID_VALUE, "glDeleteSync", "not a sync");
+        }
+    }
+
+    /* FRAMEBUFFERS AND TEXTURES */
+
+    static void APIENTRY genFramebuffers(GLsizei n, GLuint *framebuffers)
+    {
+        State &state = enter();
+        genNames(state, n, framebuffers, "glGenFramebuffers");
+        for (GLsizei i = 0; i < n; i++) {
+            state.framebuffers.insert(framebuffers[i]);
+        }
+    }
+
+    static void APIENTRY deleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+    {
+        State &state = enter();
+        for (GLsizei i = 0; i < n; i++) {
+            if (state.framebuffers.erase(framebuffers[i]) != 0 && state.framebuffer == framebuffers[i]) {
+                state.framebuffer = 0;
+            }
+        }
+    }
+
+    static void APIENTRY bindFramebuffer(GLenum target, GLuint framebuffer)
+    {
+        State &state = enter();
+        if (framebuffer != 0 && state.framebuffers.count(framebuffer) == 0) {
+            fail(state, GL_INVALID_OPERATION, "glBindFramebuffer", "name not from glGenFramebuffers");
+            return;
+        }
+        state.framebuffer = framebuffer;
+        state.stats.stateChanges++;
+    }
+
+    static GLenum APIENTRY checkFramebufferStatus(GLenum target)
+    {
+        enter();
+        return GL_FRAMEBUFFER_COMPLETE;
+    }
+
+    static void APIENTRY genRenderbuffers(GLsizei n, GLuint *renderbuffers)
+    {
+        State &state = enter();
+        genNames(state, n, renderbuffers, "glGenRenderbuffers");
+        for (GLsizei i = 0; i < n; i++) {
+            state.renderbuffers.insert(renderbuffers[i]);
+        }
+    }
+
+    static void APIENTRY deleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+    {
+        State &state = enter();
+        for (GLsizei i = 0; i < n; i++) {
+            state.renderbuffers.erase(renderbuffers[i]);
+        }
+    }
+
+    static void APIENTRY bindRenderbuffer(GLenum target, GLuint renderbuffer)
+    {
+        State &state = enter();
+        if (renderbuffer != 0 && state.renderbuffers.count(renderbuffer) == 0) {
+            fail(state, GL_INVALID_OPERATION, "glBindRenderbuffer", "name not from glGenRenderbuffers");
+            return;
+        }
+        state.renderbuffer = renderbuffer;
+    }
+
+    static void APIENTRY renderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+    {
+        State &state = enter();
+        if (state.renderbuffer == 0) {
+            fail(state, GL_INVALID_OPERATION, "glRenderbufferStorage", "no renderbuffer bound");
+        }
+    }
+
+    static void APIENTRY framebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+    {
+        State &state = enter();
+        if (state.framebuffer == 0) {
+            fail(state, GL_INVALID_OPERATION, "glFramebufferRenderbuffer", "the default framebuffer has no attachments to change");
+        }
+    }
+
+    // Reads black, into the bound pixel pack buffer or client memory
+    static void APIENTRY readPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+    {
+        State &state = enter();
+        size_t size = (size_t)width * height * 4;
+        unsigned int packBuffer = boundBuffer(state, GL_PIXEL_PACK_BUFFER);
+        if (packBuffer != 0) {
+            Buffer &buffer = state.buffers[packBuffer];
+            if ((size_t)pixels + size > buffer.data.size()) {
+                fail(state, GL_INVALID_OPERATION, "glReadPixels", "pixel pack buffer too small");
+                return;
+            }
+            memset(buffer.data.data() + (size_t)pixels, 0, size);
+        } else if (pixels != NULL) {
+            memset(pixels, 0, size);
+        }
+    }
+
+    static void APIENTRY genTextures(GLsizei n, GLuint *textures)
+    {
+        State &state = enter();
+        genNames(state, n, textures, "glGenTextures");
+        for (GLsizei i = 0; i < n; i++) {
+            state.textures.insert(textures[i]);
+        }
+    }
+
+    static void APIENTRY deleteTextures(GLsizei n, const GLuint *textures)
+    {
+        State &state = enter();
+        for (GLsizei i = 0; i < n; i++) {
+            state.textures.erase(textures[i]);
+        }
+    }
+
+    static void APIENTRY bindTexture(GLenum target, GLuint texture)
+    {
+        State &state = enter();
+        if (texture != 0 && state.textures.count(texture) == 0) {
+            fail(state, GL_INVALID_OPERATION, "glBindTexture", "name not from glGenTextures");
+            return;
+        }
+        state.stats.stateChanges++;
+    }
+
+    static void APIENTRY activeTexture(GLenum texture) { enter().stats.stateChanges++; }
+
+    /* ENTRY POINTS END HERE */
+
+    static const std::unordered_map<std::string, void *> &entryPoints()
+    {
+        static const std::unordered_map<std::string, void *> table = {
+            {"glGetString", (void *)&getString},
+            {"glGetStringi", (void *)&getStringi},
+            {"glGetIntegerv", (void *)&getIntegerv},
+            {"glGetError", (void *)&getError},
+            {"glViewport", (void *)&viewport},
+            {"glClearColor", (void *)&clearColor},
+            {"glClear", (void *)&clear},
+            {"glEnable", (void *)&enable},
+            {"glDisable", (void *)&disable},
+            {"glPrimitiveRestartIndex", (void *)&primitiveRestartIndex},
+            {"glBlendFunc", (void *)&blendFunc},
+            {"glPolygonMode", (void *)&polygonMode},
+            {"glPixelStorei", (void *)&pixelStorei},
+            {"glFinish", (void *)&finish},
+            {"glFlush", (void *)&flush},
+            {"glGenBuffers", (void *)&genBuffers},
+            {"glDeleteBuffers", (void *)&deleteBuffers},
+            {"glBindBuffer", (void *)&bindBuffer},
+            {"glBufferData", (void *)&bufferData},
+            {"glBufferSubData", (void *)&bufferSubData},
+            {"glMapBufferRange", (void *)&mapBufferRange},
+            {"glUnmapBuffer", (void *)&unmapBuffer},
+            {"glGenVertexArrays", (void *)&genVertexArrays},
+            {"glDeleteVertexArrays", (void *)&deleteVertexArrays},
+            {"glBindVertexArray", (void *)&bindVertexArray},
+            {"glVertexAttribPointer", (void *)&vertexAttribPointer},
+            {"glEnableVertexAttribArray", (void *)&enableVertexAttribArray},
+            {"glDisableVertexAttribArray", (void *)&disableVertexAttribArray},
+            {"glVertexAttribDivisor", (void *)&vertexAttribDivisor},
+            {"glCreateShader", (void *)&createShader},
+            {"glDeleteShader", (void *)&deleteShader},
+            {"glShaderSource", (void *)&shaderSource},
+            {"glCompileShader", (void *)&compileShader},
+            {"glGetShaderiv", (void *)&getShaderiv},
+            {"glGetShaderInfoLog", (void *)&getShaderInfoLog},
+            {"glCreateProgram", (void *)&createProgram},
+            {"glDeleteProgram", (void *)&deleteProgram},
+            {"glAttachShader", (void *)&attachShader},
+            {"glDetachShader", (void *)&detachShader},
+            {"glLinkProgram", (void *)&linkProgram},
+            {"glProgramBinary", (void *)&programBinary},
+            {"glProgramParameteri", (void *)&programParameteri},
+            {"glGetProgramiv", (void *)&getProgramiv},
+            {"glGetProgramInfoLog", (void *)&getProgramInfoLog},
+            {"glUseProgram", (void *)&useProgram},
+            {"glGetActiveUniform", (void *)&getActiveUniform},
+            {"glGetActiveAttrib", (void *)&getActiveAttrib},
+            {"glGetUniformLocation", (void *)&getUniformLocation},
+            {"glGetAttribLocation", (void *)&getAttribLocation},
+            {"glUniform1i", (void *)&uniform1i},
+            {"glUniform1f", (void *)&uniform1f},
+            {"glUniform2f", (void *)&uniform2f},
+            {"glUniform3f", (void *)&uniform3f},
+            {"glUniform4f", (void *)&uniform4f},
+            {"glUniform4fv", (void *)&uniform4fv},
+            {"glUniformMatrix4fv", (void *)&uniformMatrix4fv},
+            {"glDrawArrays", (void *)&drawArrays},
+            {"glDrawArraysInstanced", (void *)&drawArraysInstanced},
+            {"glDrawElements", (void *)&drawElements},
+            {"glDrawElementsInstanced", (void *)&drawElementsInstanced},
+            {"glGenQueries", (void *)&genQueries},
+            {"glDeleteQueries", (void *)&deleteQueries},
+            {"glBeginQuery", (void *)&beginQuery},
+            {"glEndQuery", (void *)&endQuery},
+            {"glGetQueryObjectiv", (void *)&getQueryObjectiv},
+            {"glGetQueryObjectuiv", (void *)&getQueryObjectuiv},
+            {"glGetQueryObjectui64v", (void *)&getQueryObjectui64v},
+            {"glFenceSync", (void *)&fenceSync},
+            {"glClientWaitSync", (void *)&clientWaitSync},
+            {"glDeleteSync", (void *)&deleteSync},
+            {"glGenFramebuffers", (void *)&genFramebuffers},
+            {"glDeleteFramebuffers", (void *)&deleteFramebuffers},
+            {"glBindFramebuffer", (void *)&bindFramebuffer},
+            {"glCheckFramebufferStatus", (void *)&checkFramebufferStatus},
+            {"glGenRenderbuffers", (void *)&genRenderbuffers},
+            {"glDeleteRenderbuffers", (void *)&deleteRenderbuffers},
+            {"glBindRenderbuffer", (void *)&bindRenderbuffer},
+            {"glRenderbufferStorage", (void *)&renderbufferStorage},
+            {"glFramebufferRenderbuffer", (void *)&framebufferRenderbuffer},
+            {"glReadPixels", (void *)&readPixels},
+            {"glGenTextures", (void *)&genTextures},
+            {"glDeleteTextures", (void *)&deleteTextures},
+            {"glBindTexture", (void *)&bindTexture},
+            {"glActiveTexture", (void *)&activeTexture}
+        };
+        return table;
+    }
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,182 @@
+/*
+    Rendering without showing anything: an offscreen framebuffer object to draw
+    into, and asynchronous readback of what was drawn.
+
+    OffscreenTarget is a framebuffer object with an RGBA8 color and a depth/stencil
+    renderbuffer. Binding it in place of framebuffer 0 is all a program has to
+    change; the context itself can come from a hidden GLFW window (or EGL
+    surfaceless, OSMesa, ...).
+
+    AsyncReadback copies frames out through a ring of pixel pack buffers.
+    readFrame() only queues glReadPixels into the next buffer, which returns
+    right away, and maps the buffer queued slots - 1 frames earlier, by which
+    time the GPU has usually finished with it. So a frame is handed over one
+    frame late (with the default two buffers) instead of stalling the pipeline
+    every frame the way glReadPixels into client memory does. A fence per
+    buffer tells whether mapping it still had to wait; stalls() counts those.
+*/
+
+#ifndef RENDERER_OFFSCREEN_H
+#define RENDERER_OFFSCREEN_H
+
+#include <glad/glad.h>
+
+#include <iostream>
+#include <vector>
+
+namespace renderer {
+
+class OffscreenTarget {
+public:
+    OffscreenTarget(int width, int height)
+        : targetWidth(width), targetHeight(height)
+    {
+        glGenRenderbuffers(2, renderbuffers);
+        glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, renderbuffers[1]);
+        complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        if (!complete) {
+            std::cout << "ERROR::OFFSCREEN::FRAMEBUFFER_INCOMPLETE" << std::endl;
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    ~OffscreenTarget()
+    {
+        glDeleteFramebuffers(1, &framebuffer);
+        glDeleteRenderbuffers(2, renderbuffers);
+    }
+
+    OffscreenTarget(const OffscreenTarget &) = delete;
+    OffscreenTarget &operator=(const OffscreenTarget &) = delete;
+
+    // Draws and reads go here from now on, with the viewport covering the target
+    void bind() const
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glViewport(0, 0, targetWidth, targetHeight);
+    }
+
+    bool ok() const { return complete; }
+    unsigned int id() const { return framebuffer; }
+    int width() const { return targetWidth; }
+    int height() const { return targetHeight; }
+
+private:
+    int targetWidth, targetHeight;
+    unsigned int framebuffer = 0;
+    unsigned int renderbuffers[2] = {0, 0};
+    bool complete = false;
+};
+
+class AsyncReadback {
+public:
+    // slots pixel pack buffers, so frames come out slots - 1 calls to readFrame() late
+    AsyncReadback(int width, int height, int slots = 2)
+        : frameWidth(width), frameHeight(height), pending(slots < 1 ? 1 : slots)
+    {
+        frameSize = (size_t)width * height * 4;
+        for (Slot &slot : pending) {
+            glGenBuffers(1, &slot.buffer);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+            glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)frameSize, NULL, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    ~AsyncReadback()
+    {
+        for (Slot &slot : pending) {
+            if (slot.fence != NULL) {
+                glDeleteSync(slot.fence);
+            }
+            glDeleteBuffers(1, &slot.buffer);
+        }
+    }
+
+    AsyncReadback(const AsyncReadback &) = delete;
+    AsyncReadback &operator=(const AsyncReadback &) = delete;
+
+    // Queues a copy of the bound read framebuffer and hands the oldest queued frame, if its
+    // turn has come, to consume(const unsigned char *pixels, unsigned long long frame).
+    // The pixels are RGBA8, bottom row first, and only valid during the call.
+    template <typename Consume>
+    void readFrame(Consume consume)
+    {
+        Slot &slot = pending[queued % pending.size()];
+        if (slot.busy) {
+            deliver(slot, consume);
+        }
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glReadPixels(0, 0, frameWidth, frameHeight, GL_RGBA, GL_UNSIGNED_BYTE, (void *)0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.frame = queued++;
+        slot.busy = true;
+    }
+
+    // Hands over every frame still in flight, oldest first
+    template <typename Consume>
+    void drain(Consume consume)
+    {
+        for (size_t i = 0; i < pending.size(); i++) {
+            Slot &slot = pending[(queued + i) % pending.size()];
+            if (slot.busy) {
+                deliver(slot, consume);
+            }
+        }
+    }
+
+    // Frames whose buffer wasn't ready yet when it was mapped
+    unsigned long long stalls() const { return stallCount; }
+    unsigned long long frames() const { return queued; }
+
+private:
+    struct Slot {
+        unsigned int buffer = 0;
+        GLsync fence = NULL;
+        unsigned long long frame = 0;
+        bool busy = false;
+    };
+
+    template <typename Consume>
+    void deliver(Slot &slot, Consume &consume)
+    {
+        if (glClientWaitSync(slot.fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+            stallCount++;
+        }
+        glDeleteSync(slot.fence);
+        slot.fence = NULL;
+        slot.busy = false;
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        const unsigned char *pixels = (const unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)frameSize, GL_MAP_READ_BIT);
+        if (pixels != NULL) {
+            consume(pixels, slot.frame);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        } else {
+            std::cout << "ERROR::OFFSCREEN::MAP_FAILED frame " << slot.frame << std::endl;
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    int frameWidth, frameHeight;
+    size_t frameSize;
+    std::vector<Slot> pending;
+    unsigned long long queued = 0;
+    unsigned long long stallCount = 0;
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,88 @@
+/*
+    Multi-threaded draw recording into per-thread command buffers.
+
+    record() splits a frame's draw generation into jobs and runs them on a
+    WorkerPool. Each worker appends to its own CommandBuffer, so recording
+    takes no locks and makes no GL calls; it only notes which range of its
+    buffer every job produced. merged() then concatenates the ranges in job
+    order, which makes the result independent of how the jobs were scheduled:
+    with the same jobs, one thread or sixteen give the same command stream.
+    The merged buffer is submitted on the context thread as usual.
+*/
+
+#ifndef RENDERER_PARALLEL_RECORDER_H
+#define RENDERER_PARALLEL_RECORDER_H
+
+#include "command_buffer.h"
+#include "worker_pool.h"
+
+#include <vector>
+
+namespace renderer {
+
+class ParallelRecorder {
+public:
+    explicit ParallelRecorder(WorkerPool &pool)
+        : pool(pool), workerBuffers(pool.size())
+    {
+    }
+
+    ParallelRecorder(const ParallelRecorder &) = delete;
+    ParallelRecorder &operator=(const ParallelRecorder &) = delete;
+
+    // Calls fn(job, buffer) for every job in [0, jobCount) across the pool, then merges in job order.
+    // fn must only record into the buffer it is given: it runs off the context thread
+    template<class Function>
+    CommandBuffer &record(unsigned int jobCount, Function &&fn)
+    {
+        for (CommandBuffer &buffer : workerBuffers) {
+            buffer.clear();
+        }
+        ranges.resize(jobCount);
+
+        pool.parallelFor(jobCount, [&](unsigned int job, unsigned int worker) {
+            CommandBuffer &buffer = workerBuffers[worker];
+            size_t begin = buffer.size();
+            fn(job, buffer);
+            ranges[job] = Range{worker, begin, buffer.size()};
+        });
+
+        merge();
+        return commands;
+    }
+
+    CommandBuffer &merged() { return commands; }
+
+    unsigned int threadCount() const { return pool.size(); }
+
+private:
+    // Where one job's commands ended up
+    struct Range {
+        unsigned int worker;
+        size_t begin;
+        size_t end;
+    };
+
+    void merge()
+    {
+        size_t total = 0;
+        for (const Range &range : ranges) {
+            total += range.end - range.begin;
+        }
+
+        commands.clear();
+        commands.reserve(total);
+        for (const Range &range : ranges) {
+            commands.append(workerBuffers[range.worker].data() + range.begin, range.end - range.begin);
+        }
+    }
+
+    WorkerPool &pool;
+    std::vector<CommandBuffer> workerBuffers;
+    std::vector<Range> ranges;
+    CommandBuffer commands;
+};
+
+} // namespace renderer
+
+#endif
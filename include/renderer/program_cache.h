@@ -0,0 +1,227 @@
+/*
+    On-disk cache of linked shader programs (GL_ARB_get_program_binary / GL 4.1).
+
+    Programs are keyed by a 64-bit FNV-1a hash of the driver strings (vendor,
+    renderer, version) and the shader sources, so a driver update or an edited
+    shader simply misses. A hit creates the program straight from the stored
+    binary and skips glCompileShader/glLinkProgram altogether; a miss, or a
+    binary the driver rejects, compiles from source and rewrites the entry.
+    Without the extension the cache just compiles every time.
+*/
+
+#ifndef RENDERER_PROGRAM_CACHE_H
+#define RENDERER_PROGRAM_CACHE_H
+
+#include <glad/glad.h>
+
+#include "hash.h"
+#include "shader.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace renderer {
+
+struct ProgramCacheStats {
+    unsigned int hits;
+    unsigned int misses;
+    unsigned int rejected;      // binaries the driver refused (usually after a driver update)
+    double milliseconds;        // time spent loading, storing and (in program()) compiling
+};
+
+class ProgramCache {
+public:
+    explicit ProgramCache(const std::string &directory = "shader_cache")
+        : directory(directory)
+    {
+        stats = {0, 0, 0, 0.0};
+
+        // Binaries are only useful when the driver exposes at least one format
+        GLint formats = 0;
+        if (GLAD_GL_ARB_get_program_binary && glGetProgramBinary != NULL) {
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        }
+        supported = formats > 0;
+
+        // Everything that invalidates a binary goes into the key prefix
+        driverHash = hashString((const char *)glGetString(GL_VENDOR));
+        driverHash = hashString((const char *)glGetString(GL_RENDERER), driverHash);
+        driverHash = hashString((const char *)glGetString(GL_VERSION), driverHash);
+
+        if (supported) {
+            std::error_code error;
+            std::filesystem::create_directories(directory, error);
+        }
+    }
+
+    // True when programs are actually stored on disk
+    bool enabled() const { return supported; }
+
+    // Returns a linked program for the two sources, or 0 if compiling or linking failed
+    unsigned int program(const char *vertexSource, const char *fragmentSource)
+    {
+        unsigned int shaderProgram = load(vertexSource, fragmentSource);
+        if (shaderProgram == 0) {
+            auto start = std::chrono::steady_clock::now();
+            shaderProgram = ShaderProgram::build(vertexSource, fragmentSource, supported);
+            stats.milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            if (shaderProgram != 0) {
+                store(shaderProgram, vertexSource, fragmentSource);
+            }
+        }
+        return shaderProgram;
+    }
+
+    // Creates the program from a stored binary; 0 (counted as a miss) when there is none
+    unsigned int load(const char *vertexSource, const char *fragmentSource)
+    {
+        auto start = std::chrono::steady_clock::now();
+        unsigned int shaderProgram = supported ? loadBinary(entryPath(key(vertexSource, fragmentSource))) : 0;
+        if (shaderProgram != 0) {
+            stats.hits++;
+        } else {
+            stats.misses++;
+        }
+        stats.milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return shaderProgram;
+    }
+
+    // Call between glCreateProgram and glLinkProgram for programs that will be stored
+    void prepareForLink(unsigned int shaderProgram) const
+    {
+        if (supported) {
+            // Ask the driver to keep the binary around so glGetProgramBinary can return it
+            glProgramParameteri(shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+    }
+
+    // Saves a successfully linked program under its sources
+    void store(unsigned int shaderProgram, const char *vertexSource, const char *fragmentSource)
+    {
+        if (supported) {
+            auto start = std::chrono::steady_clock::now();
+            storeBinary(shaderProgram, entryPath(key(vertexSource, fragmentSource)));
+            stats.milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+
+    const ProgramCacheStats &statistics() const { return stats; }
+
+    // One line for the startup log, e.g. "shader cache: 2 hits, 0 misses, 0.41 ms"
+    void printStatistics() const
+    {
+        std::cout << "shader cache" << (supported ? "" : " (no binary formats, compiling)") << ": " << stats.hits << " hits, "
+                  << stats.misses << " misses, " << stats.rejected << " rejected, " << stats.milliseconds << " ms" << std::endl;
+    }
+
+private:
+    struct EntryHeader {
+        char magic[4];
+        uint32_t binaryFormat;
+        uint32_t length;
+    };
+
+    uint64_t key(const char *vertexSource, const char *fragmentSource) const
+    {
+        return hashString(fragmentSource, hashString(vertexSource, driverHash));
+    }
+
+    std::string entryPath(uint64_t key) const
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+        return (std::filesystem::path(directory) / name).string();
+    }
+
+    unsigned int loadBinary(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return 0;
+        }
+
+        EntryHeader header;
+        if (!file.read((char *)&header, sizeof(header)) || std::string(header.magic, 4) != "GLPB" || header.length == 0) {
+            return 0;
+        }
+
+        // A truncated or corrupt entry must not size the allocation: the binary is the rest of the file
+        std::streamoff offset = file.tellg();
+        file.seekg(0, std::ios::end);
+        std::streamoff remaining = file.tellg() - offset;
+        if (offset < 0 || remaining != (std::streamoff)header.length) {
+            return 0;
+        }
+        file.seekg(offset);
+
+        std::vector<char> binary(header.length);
+        if (!file.read(binary.data(), binary.size())) {
+            return 0;
+        }
+
+        unsigned int shaderProgram = glCreateProgram();
+        glProgramBinary(shaderProgram, header.binaryFormat, binary.data(), (GLsizei)binary.size());
+
+        int success;
+        glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+        if (!success) {
+            // Stale entry; fall back to compiling and overwrite it
+            glDeleteProgram(shaderProgram);
+            stats.rejected++;
+            return 0;
+        }
+        return shaderProgram;
+    }
+
+    void storeBinary(unsigned int shaderProgram, const std::string &path)
+    {
+        GLint length = 0;
+        glGetProgramiv(shaderProgram, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0) {
+            return;
+        }
+
+        std::vector<char> binary(length);
+        GLenum binaryFormat = 0;
+        GLsizei written = 0;
+        glGetProgramBinary(shaderProgram, length, &written, &binaryFormat, binary.data());
+        if (written <= 0) {
+            return;
+        }
+
+        EntryHeader header = {{'G', 'L', 'P', 'B'}, binaryFormat, (uint32_t)written};
+
+        // Write next to the entry and rename, so a crash never leaves half a binary behind
+        std::string temporary = path + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            file.write((const char *)&header, sizeof(header));
+            file.write(binary.data(), written);
+            if (!file) {
+                return;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary, path, error);
+        if (error) {
+            std::filesystem::remove(temporary, error);
+        }
+    }
+
+    std::string directory;
+    bool supported = false;
+    uint64_t driverHash = 0;
+    ProgramCacheStats stats;
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,285 @@
+/*
+    Reflection of a linked program's active uniforms and attributes.
+
+    Everything is enumerated once, right after linking, with glGetActiveUniform
+    and glGetActiveAttrib and stored in a flat open-addressing hash table, so
+    looking a name up never goes to the driver. Lookups return handles meant
+    to be resolved once at setup; the per-frame set() calls then go straight to
+    glUniform* with the precomputed location, and a handle for a uniform the
+    program doesn't have turns set() into a no-op instead of a driver call.
+
+    With RENDERER_DEBUG (on unless NDEBUG is defined) lookups of names the
+    program doesn't declare, and set() calls whose type doesn't match the
+    declaration, print a warning.
+*/
+
+#ifndef RENDERER_PROGRAM_REFLECTION_H
+#define RENDERER_PROGRAM_REFLECTION_H
+
+#include <glad/glad.h>
+
+#include "hash.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef RENDERER_DEBUG
+#ifdef NDEBUG
+#define RENDERER_DEBUG 0
+#else
+#define RENDERER_DEBUG 1
+#endif
+#endif
+
+namespace renderer {
+
+// Precomputed reference to one uniform of one program; location -1 means "not in the program"
+struct UniformHandle {
+    int location;
+    GLenum type;
+    int size;
+};
+
+struct ProgramVariable {
+    const char *name;
+    int location;
+    GLenum type;
+    int size;       // array length, 1 for non-arrays
+};
+
+class ProgramReflection {
+public:
+    ProgramReflection() = default;
+
+    explicit ProgramReflection(unsigned int program)
+    {
+        reflect(program);
+    }
+
+    // Enumerates the program's active uniforms and attributes, replacing anything reflected before
+    void reflect(unsigned int program)
+    {
+        shaderProgram = program;
+        names.clear();
+        uniforms.clear();
+        attributes.clear();
+
+        int count = 0, maxLength = 0;
+        glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+        std::vector<char> name(maxLength > 0 ? maxLength : 1);
+
+        std::vector<Record> uniformRecords;
+        for (int i = 0; i < count; i++) {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(program, (GLuint)i, (GLsizei)name.size(), &length, &size, &type, name.data());
+
+            int location = glGetUniformLocation(program, name.data());
+            if (location < 0) {
+                // Members of uniform blocks have no location
+                continue;
+            }
+            uniformRecords.push_back(makeRecord(std::string(name.data(), length), location, type, size));
+
+            // Arrays are reported as "name[0]"; make plain "name" find them too
+            if (length > 3 && strcmp(name.data() + length - 3, "[0]") == 0) {
+                uniformRecords.push_back(makeRecord(std::string(name.data(), length - 3), location, type, size));
+            }
+        }
+
+        glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &count);
+        glGetProgramiv(program, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength);
+        name.assign(maxLength > 0 ? maxLength : 1, '\0');
+
+        std::vector<Record> attributeRecords;
+        for (int i = 0; i < count; i++) {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveAttrib(program, (GLuint)i, (GLsizei)name.size(), &length, &size, &type, name.data());
+
+            int location = glGetAttribLocation(program, name.data());
+            if (location >= 0) {
+                attributeRecords.push_back(makeRecord(std::string(name.data(), length), location, type, size));
+            }
+        }
+
+        buildTable(uniformRecords, uniforms);
+        buildTable(attributeRecords, attributes);
+    }
+
+    unsigned int program() const { return shaderProgram; }
+
+    // Resolve once at setup, not per frame
+    UniformHandle uniform(const char *name) const
+    {
+        const Record *record = find(uniforms, name);
+        if (record == nullptr) {
+#if RENDERER_DEBUG
+            std::cout << "WARNING::UNIFORM::NOT_FOUND '" << name << "' is not an active uniform of program " << shaderProgram << std::endl;
+#endif
+            return UniformHandle{-1, 0, 0};
+        }
+        return UniformHandle{record->location, record->type, record->size};
+    }
+
+    // Location of an active vertex attribute, or -1
+    int attribute(const char *name) const
+    {
+        const Record *record = find(attributes, name);
+        if (record == nullptr) {
+#if RENDERER_DEBUG
+            std::cout << "WARNING::ATTRIBUTE::NOT_FOUND '" << name << "' is not an active attribute of program " << shaderProgram << std::endl;
+#endif
+            return -1;
+        }
+        return record->location;
+    }
+
+    std::vector<ProgramVariable> activeUniforms() const { return listVariables(uniforms); }
+    std::vector<ProgramVariable> activeAttributes() const { return listVariables(attributes); }
+
+    /* UNIFORM SETTERS: like glUniform*, they apply to the program currently in use */
+
+    void set(UniformHandle handle, float x) const
+    {
+        if (accept(handle, GL_FLOAT)) {
+            glUniform1f(handle.location, x);
+        }
+    }
+
+    void set(UniformHandle handle, float x, float y) const
+    {
+        if (accept(handle, GL_FLOAT_VEC2)) {
+            glUniform2f(handle.location, x, y);
+        }
+    }
+
+    void set(UniformHandle handle, float x, float y, float z) const
+    {
+        if (accept(handle, GL_FLOAT_VEC3)) {
+            glUniform3f(handle.location, x, y, z);
+        }
+    }
+
+    void set(UniformHandle handle, float x, float y, float z, float w) const
+    {
+        if (accept(handle, GL_FLOAT_VEC4)) {
+            glUniform4f(handle.location, x, y, z, w);
+        }
+    }
+
+    // Also used for sampler and bool uniforms, as with glUniform1i
+    void set(UniformHandle handle, int x) const
+    {
+        if (accept(handle, GL_INT)) {
+            glUniform1i(handle.location, x);
+        }
+    }
+
+    void setMatrix4(UniformHandle handle, const float *columnMajor, int count = 1) const
+    {
+        if (accept(handle, GL_FLOAT_MAT4)) {
+            glUniformMatrix4fv(handle.location, count, GL_FALSE, columnMajor);
+        }
+    }
+
+private:
+    struct Record {
+        uint64_t hash;
+        size_t nameOffset;  // into names, NUL terminated
+        int location;
+        GLenum type;
+        int size;
+    };
+
+    // Power-of-two sized, linear probing; empty slots have nameOffset == EMPTY
+    static const size_t EMPTY = (size_t)-1;
+
+    Record makeRecord(const std::string &name, int location, GLenum type, int size)
+    {
+        Record record;
+        record.hash = hashString(name.c_str());
+        record.nameOffset = names.size();
+        record.location = location;
+        record.type = type;
+        record.size = size;
+        names.insert(names.end(), name.c_str(), name.c_str() + name.size() + 1);
+        return record;
+    }
+
+    static void buildTable(const std::vector<Record> &records, std::vector<Record> &table)
+    {
+        // Keep the load factor at or below one half
+        size_t capacity = 4;
+        while (capacity < records.size() * 2) {
+            capacity *= 2;
+        }
+
+        Record empty = {0, EMPTY, -1, 0, 0};
+        table.assign(capacity, empty);
+        for (const Record &record : records) {
+            size_t slot = (size_t)record.hash & (capacity - 1);
+            while (table[slot].nameOffset != EMPTY) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            table[slot] = record;
+        }
+    }
+
+    const Record *find(const std::vector<Record> &table, const char *name) const
+    {
+        if (table.empty()) {
+            return nullptr;
+        }
+
+        uint64_t hash = hashString(name);
+        size_t mask = table.size() - 1;
+        for (size_t slot = (size_t)hash & mask; table[slot].nameOffset != EMPTY; slot = (slot + 1) & mask) {
+            if (table[slot].hash == hash && strcmp(names.data() + table[slot].nameOffset, name) == 0) {
+                return &table[slot];
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<ProgramVariable> listVariables(const std::vector<Record> &table) const
+    {
+        std::vector<ProgramVariable> variables;
+        for (const Record &record : table) {
+            if (record.nameOffset != EMPTY) {
+                variables.push_back(ProgramVariable{names.data() + record.nameOffset, record.location, record.type, record.size});
+            }
+        }
+        return variables;
+    }
+
+    bool accept(UniformHandle handle, GLenum expected) const
+    {
+        if (handle.location < 0) {
+            return false;
+        }
+#if RENDERER_DEBUG
+        // Samplers and bools are set through the int setter as well
+        bool integerLike = expected == GL_INT && (handle.type == GL_BOOL || handle.type == GL_SAMPLER_1D || handle.type == GL_SAMPLER_2D || handle.type == GL_SAMPLER_3D || handle.type == GL_SAMPLER_CUBE);
+        if (handle.type != expected && !integerLike) {
+            std::cout << "WARNING::UNIFORM::TYPE_MISMATCH location " << handle.location << " of program " << shaderProgram
+                      << " is declared as 0x" << std::hex << handle.type << ", set as 0x" << expected << std::dec << std::endl;
+        }
+#endif
+        return true;
+    }
+
+    unsigned int shaderProgram = 0;
+    std::vector<char> names;
+    std::vector<Record> uniforms;
+    std::vector<Record> attributes;
+};
+
+} // namespace renderer
+
+#endif
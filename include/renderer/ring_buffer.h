@@ -0,0 +1,201 @@
+/*
+    Ring allocator for vertex (or index, or uniform) data that changes every frame.
+
+    One buffer object is split into frameCount regions (3 by default, so the CPU
+    can write frame N while the GPU still reads N - 1 and N - 2). Each frame
+    hands out sub-allocations from its region between beginFrame() and
+    finishWrites(), then draws from them; endFrame() drops a fence behind the
+    frame's draws and beginFrame() waits on the fence of the region it is
+    about to reuse, which normally signalled long ago.
+
+    With GL_ARB_buffer_storage (core in 4.4) the buffer is mapped once,
+    persistently and coherently: allocations point straight into GPU-visible
+    memory, nothing is copied and nothing is ever unmapped. Otherwise the
+    frame's region is mapped with GL_MAP_UNSYNCHRONIZED_BIT each frame, which
+    skips the driver's implicit sync; the fences make that safe. GL refuses
+    to draw from a buffer mapped that way, so finishWrites() has to unmap it
+    before the first draw. Neither path
+    reallocates the buffer the way glBufferData orphaning does.
+*/
+
+#ifndef RENDERER_RING_BUFFER_H
+#define RENDERER_RING_BUFFER_H
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace renderer {
+
+// data is where to write; offset is what GL needs (attribute pointer offset, index offset, first vertex * stride)
+struct RingAllocation {
+    void *data;
+    size_t offset;
+    size_t size;
+};
+
+struct RingBufferStats {
+    unsigned long long frames;
+    unsigned long long bytes;
+    unsigned long long waits;       // times beginFrame() found the GPU still using the region
+    unsigned long long overflows;   // allocations that didn't fit in the frame's region
+    double waitMilliseconds;
+};
+
+class StreamRingBuffer {
+public:
+    StreamRingBuffer(GLenum target, size_t bytesPerFrame, int frameCount = 3)
+        : target(target), regionSize(bytesPerFrame), frameCount(frameCount), fences(frameCount, nullptr)
+    {
+        stats = {0, 0, 0, 0, 0.0};
+        size_t totalSize = regionSize * frameCount;
+
+        glGenBuffers(1, &bufferObject);
+        glBindBuffer(target, bufferObject);
+
+        persistentMapping = GLAD_GL_ARB_buffer_storage && glBufferStorage != NULL;
+        if (persistentMapping) {
+            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(target, (GLsizeiptr)totalSize, NULL, flags);
+            mapped = (unsigned char *)glMapBufferRange(target, 0, (GLsizeiptr)totalSize, flags);
+            if (mapped == NULL) {
+                std::cout << "ERROR::RING_BUFFER::PERSISTENT_MAP_FAILED falling back to per-frame mapping" << std::endl;
+                // Immutable storage can't be respecified; start over with a fresh buffer
+                glDeleteBuffers(1, &bufferObject);
+                glGenBuffers(1, &bufferObject);
+                glBindBuffer(target, bufferObject);
+                persistentMapping = false;
+            }
+        }
+        if (!persistentMapping) {
+            glBufferData(target, (GLsizeiptr)totalSize, NULL, GL_STREAM_DRAW);
+        }
+    }
+
+    ~StreamRingBuffer()
+    {
+        for (GLsync fence : fences) {
+            if (fence != nullptr) {
+                glDeleteSync(fence);
+            }
+        }
+        if (mapped != nullptr || frameMapped) {
+            glBindBuffer(target, bufferObject);
+            glUnmapBuffer(target);
+        }
+        glDeleteBuffers(1, &bufferObject);
+    }
+
+    StreamRingBuffer(const StreamRingBuffer &) = delete;
+    StreamRingBuffer &operator=(const StreamRingBuffer &) = delete;
+
+    unsigned int buffer() const { return bufferObject; }
+
+    // True when the whole buffer stays mapped (GL_ARB_buffer_storage)
+    bool persistent() const { return persistentMapping; }
+
+    size_t bytesPerFrame() const { return regionSize; }
+
+    const RingBufferStats &statistics() const { return stats; }
+
+    // Waits until the GPU is done with the next region and makes it writable
+    void beginFrame()
+    {
+        region = (region + 1) % frameCount;
+        used = 0;
+
+        GLsync &fence = fences[region];
+        if (fence != nullptr) {
+            // Nearly always signalled already; only count the times we actually block
+            GLenum result = glClientWaitSync(fence, 0, 0);
+            if (result == GL_TIMEOUT_EXPIRED) {
+                auto start = std::chrono::steady_clock::now();
+                do {
+                    result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+                } while (result == GL_TIMEOUT_EXPIRED);
+                stats.waits++;
+                stats.waitMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            }
+            if (result == GL_WAIT_FAILED) {
+                std::cout << "ERROR::RING_BUFFER::WAIT_FAILED" << std::endl;
+            }
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        if (persistentMapping) {
+            frameData = mapped + region * regionSize;
+        } else {
+            // The fence guarantees the GPU is done with this range, so the driver needn't check
+            glBindBuffer(target, bufferObject);
+            GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+            frameData = (unsigned char *)glMapBufferRange(target, (GLintptr)(region * regionSize), (GLsizeiptr)regionSize, access);
+            frameMapped = frameData != nullptr;
+            if (!frameMapped) {
+                std::cout << "ERROR::RING_BUFFER::MAP_FAILED" << std::endl;
+            }
+        }
+    }
+
+    // Space for this frame; data is nullptr when the region is full (counted as an overflow).
+    // The alignment applies to the offset in the whole buffer, so alignment == vertex stride
+    // makes offset / stride a valid first vertex
+    RingAllocation allocate(size_t size, size_t alignment = 16)
+    {
+        if (alignment == 0) {
+            std::cout << "ERROR::RING_BUFFER::ZERO_ALIGNMENT" << std::endl;
+            return RingAllocation{nullptr, 0, 0};
+        }
+
+        size_t base = region * regionSize;
+        size_t offset = (base + used + alignment - 1) / alignment * alignment;
+        size_t start = offset - base;
+        if (frameData == nullptr || start + size > regionSize) {
+            stats.overflows++;
+            return RingAllocation{nullptr, 0, 0};
+        }
+
+        used = start + size;
+        stats.bytes += size;
+        return RingAllocation{frameData + start, offset, size};
+    }
+
+    // Call after the last allocate() and before the first draw that reads this frame's data;
+    // the allocations' data pointers are invalid from here on
+    void finishWrites()
+    {
+        if (!persistentMapping && frameMapped) {
+            glBindBuffer(target, bufferObject);
+            glUnmapBuffer(target);
+            frameMapped = false;
+        }
+        frameData = nullptr;
+    }
+
+    // Call after the last draw that reads this frame's data
+    void endFrame()
+    {
+        fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        stats.frames++;
+    }
+
+private:
+    GLenum target;
+    size_t regionSize;
+    int frameCount;
+    unsigned int bufferObject = 0;
+    bool persistentMapping = false;
+    unsigned char *mapped = nullptr;       // whole buffer, persistent path only
+    unsigned char *frameData = nullptr;    // current region while a frame is open
+    bool frameMapped = false;
+    int region = -1;
+    size_t used = 0;
+    std::vector<GLsync> fences;
+    RingBufferStats stats;
+};
+
+} // namespace renderer
+
+#endif
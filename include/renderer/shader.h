@@ -0,0 +1,180 @@
+/*
+    A linked shader program that deletes itself.
+
+    ShaderProgram compiles a vertex and a fragment shader, links them and
+    deletes the shader objects, reporting failures the way the samples always
+    did. It owns the program: moving hands it over, the destructor (or
+    reset()) deletes it. A program that failed to build has id() 0, which GL
+    treats as "no program", so drawing with it is harmless.
+    Programs built elsewhere (ShaderBuilder, ProgramCache) can be adopted to
+    get the same cleanup. Those build through the statics here too (build(),
+    or its steps for deferred checks), so there is one compile-and-link path.
+*/
+
+#ifndef RENDERER_SHADER_H
+#define RENDERER_SHADER_H
+
+#include <glad/glad.h>
+
+#include <iostream>
+#include <string>
+
+namespace renderer {
+
+class ShaderProgram {
+public:
+    ShaderProgram() = default;
+
+    ShaderProgram(const char *vertexSource, const char *fragmentSource)
+        : program(build(vertexSource, fragmentSource))
+    {
+    }
+
+    // Takes ownership of a program linked elsewhere
+    explicit ShaderProgram(unsigned int program)
+        : program(program)
+    {
+    }
+
+    ~ShaderProgram() { reset(); }
+
+    ShaderProgram(const ShaderProgram &) = delete;
+    ShaderProgram &operator=(const ShaderProgram &) = delete;
+
+    ShaderProgram(ShaderProgram &&other) noexcept
+        : program(other.program)
+    {
+        other.program = 0;
+    }
+
+    ShaderProgram &operator=(ShaderProgram &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            program = other.program;
+            other.program = 0;
+        }
+        return *this;
+    }
+
+    // Deletes the program now instead of at the end of the scope
+    void reset()
+    {
+        if (program != 0) {
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    void use() const { glUseProgram(program); }
+
+    bool ok() const { return program != 0; }
+    unsigned int id() const { return program; }
+
+    // Compiles and links the two sources and deletes the shader objects; 0 (reported) on failure.
+    // retrievableBinary asks the driver to keep the binary for glGetProgramBinary (renderer/program_cache.h)
+    static unsigned int build(const char *vertexSource, const char *fragmentSource, bool retrievableBinary = false)
+    {
+        unsigned int vertexShader = startCompile(GL_VERTEX_SHADER, vertexSource);
+        unsigned int fragmentShader = startCompile(GL_FRAGMENT_SHADER, fragmentSource);
+        bool vertexCompiled = compiled(GL_VERTEX_SHADER, vertexShader);
+        bool fragmentCompiled = compiled(GL_FRAGMENT_SHADER, fragmentShader);
+        if (!vertexCompiled || !fragmentCompiled) {
+            glDeleteShader(vertexShader);
+            glDeleteShader(fragmentShader);
+            return 0;
+        }
+
+        unsigned int linkedProgram = glCreateProgram();
+        if (retrievableBinary) {
+            glProgramParameteri(linkedProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+        startLink(linkedProgram, vertexShader, fragmentShader);
+
+        // The program keeps what it needs, the shader objects can go
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+
+        if (!linked(linkedProgram)) {
+            glDeleteProgram(linkedProgram);
+            return 0;
+        }
+        return linkedProgram;
+    }
+
+    // The steps of build() without status queries in between, for builders that check later
+    // (renderer/shader_builder.h)
+    static unsigned int startCompile(GLenum type, const char *source)
+    {
+        unsigned int shader = glCreateShader(type);
+        glShaderSource(shader, 1, &source, NULL);
+        glCompileShader(shader);
+        return shader;
+    }
+
+    static void startLink(unsigned int program, unsigned int vertexShader, unsigned int fragmentShader)
+    {
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+    }
+
+    // Reports a failed compile with its full log
+    static bool compiled(GLenum type, unsigned int shader)
+    {
+        int success;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if (!success) {
+            std::cout << "ERROR::SHADER::" << (type == GL_VERTEX_SHADER ? "VERTEX" : "FRAGMENT") << "::COMPILATION_FAILED\n" << shaderLog(shader) << std::endl;
+        }
+        return success != 0;
+    }
+
+    // Reports a failed link with its full log, after the compile errors of the shaders
+    // when they are given (a deferred check only learns about those from the link)
+    static bool linked(unsigned int program, unsigned int vertexShader = 0, unsigned int fragmentShader = 0)
+    {
+        int success;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        if (!success) {
+            if (vertexShader != 0) {
+                compiled(GL_VERTEX_SHADER, vertexShader);
+            }
+            if (fragmentShader != 0) {
+                compiled(GL_FRAGMENT_SHADER, fragmentShader);
+            }
+            std::cout << "ERROR::SHADER_PROGRAM::LINKING_FAILED\n" << programLog(program) << std::endl;
+        }
+        return success != 0;
+    }
+
+private:
+    // Reads the full info log, however long it is
+    static std::string shaderLog(unsigned int shader)
+    {
+        int length = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+        std::string log(length > 0 ? length : 1, '\0');
+        GLsizei written = 0;
+        glGetShaderInfoLog(shader, (GLsizei)log.size(), &written, &log[0]);
+        log.resize(written > 0 ? written : 0);
+        return log;
+    }
+
+    static std::string programLog(unsigned int program)
+    {
+        int length = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+        std::string log(length > 0 ? length : 1, '\0');
+        GLsizei written = 0;
+        glGetProgramInfoLog(program, (GLsizei)log.size(), &written, &log[0]);
+        log.resize(written > 0 ? written : 0);
+        return log;
+    }
+
+    unsigned int program = 0;
+};
+
+} // namespace renderer
+
+#endif
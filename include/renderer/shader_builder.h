@@ -0,0 +1,196 @@
+/*
+    Batched shader program builds with deferred status checks.
+
+    add() only records the sources. submit() then issues every glCompileShader
+    and every glLinkProgram back to back without asking for a status, so a
+    driver that compiles on background threads gets all the work at once.
+    Status is queried later, per program, through ready():
+      - with GL_KHR_parallel_shader_compile it polls GL_COMPLETION_STATUS_KHR
+        and never blocks, so the render loop can draw the programs that are
+        done while the rest keep compiling;
+      - without it the first ready() on a program waits for that program only.
+    An optional ProgramCache serves binaries for programs it has seen before
+    and stores the ones built here.
+*/
+
+#ifndef RENDERER_SHADER_BUILDER_H
+#define RENDERER_SHADER_BUILDER_H
+
+#include <glad/glad.h>
+
+#include "program_cache.h"
+#include "shader.h"
+
+#include <string>
+#include <vector>
+
+namespace renderer {
+
+class ShaderBuilder {
+public:
+    explicit ShaderBuilder(ProgramCache *cache = nullptr)
+        : cache(cache)
+    {
+        parallel = GLAD_GL_KHR_parallel_shader_compile && glMaxShaderCompilerThreadsKHR != NULL;
+        if (parallel) {
+            // Let the driver use as many compiler threads as it wants
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+        }
+    }
+
+    ShaderBuilder(const ShaderBuilder &) = delete;
+    ShaderBuilder &operator=(const ShaderBuilder &) = delete;
+
+    // Programs that finished building belong to the caller, the rest are cleaned up
+    ~ShaderBuilder()
+    {
+        for (Entry &entry : entries) {
+            if (entry.state == SUBMITTED) {
+                glDeleteShader(entry.vertexShader);
+                glDeleteShader(entry.fragmentShader);
+                glDeleteProgram(entry.program);
+            }
+        }
+    }
+
+    // Queues a program and returns its handle; nothing reaches the driver until submit()
+    int add(const char *vertexSource, const char *fragmentSource)
+    {
+        Entry entry;
+        entry.vertexSource = vertexSource;
+        entry.fragmentSource = fragmentSource;
+        entries.push_back(entry);
+        return (int)entries.size() - 1;
+    }
+
+    // Starts building everything queued so far
+    void submit()
+    {
+        // Cache hits are complete programs already
+        for (Entry &entry : entries) {
+            if (entry.state == QUEUED && cache != nullptr) {
+                entry.program = cache->load(entry.vertexSource.c_str(), entry.fragmentSource.c_str());
+                if (entry.program != 0) {
+                    entry.state = READY;
+                }
+            }
+        }
+
+        // All compiles first...
+        for (Entry &entry : entries) {
+            if (entry.state == QUEUED) {
+                entry.vertexShader = ShaderProgram::startCompile(GL_VERTEX_SHADER, entry.vertexSource.c_str());
+                entry.fragmentShader = ShaderProgram::startCompile(GL_FRAGMENT_SHADER, entry.fragmentSource.c_str());
+            }
+        }
+
+        // ...then all links, still without a single status query in between
+        for (Entry &entry : entries) {
+            if (entry.state == QUEUED) {
+                entry.program = glCreateProgram();
+                if (cache != nullptr) {
+                    cache->prepareForLink(entry.program);
+                }
+                ShaderProgram::startLink(entry.program, entry.vertexShader, entry.fragmentShader);
+                entry.state = SUBMITTED;
+            }
+        }
+    }
+
+    // The linked program once it is usable, otherwise 0 (still building or failed)
+    unsigned int ready(int handle)
+    {
+        if (handle < 0 || handle >= (int)entries.size()) {
+            return 0;
+        }
+
+        Entry &entry = entries[handle];
+        if (entry.state == SUBMITTED) {
+            if (parallel) {
+                int complete = 0;
+                glGetProgramiv(entry.program, GL_COMPLETION_STATUS_KHR, &complete);
+                if (!complete) {
+                    return 0;
+                }
+            }
+            finishEntry(entry);
+        }
+        return entry.state == READY ? entry.program : 0;
+    }
+
+    bool failed(int handle) const
+    {
+        return handle >= 0 && handle < (int)entries.size() && entries[handle].state == FAILED;
+    }
+
+    // Checks every submitted program without blocking (when the extension is present) and returns how many are still building
+    unsigned int poll()
+    {
+        unsigned int building = 0;
+        for (int handle = 0; handle < (int)entries.size(); handle++) {
+            if (entries[handle].state == SUBMITTED && ready(handle) == 0 && entries[handle].state == SUBMITTED) {
+                building++;
+            }
+        }
+        return building;
+    }
+
+    // Blocks until every submitted program is either ready or failed
+    void wait()
+    {
+        for (Entry &entry : entries) {
+            if (entry.state == SUBMITTED) {
+                finishEntry(entry);
+            }
+        }
+    }
+
+    // True when the driver reports completion without blocking
+    bool asynchronous() const { return parallel; }
+
+private:
+    enum State {
+        QUEUED,
+        SUBMITTED,
+        READY,
+        FAILED
+    };
+
+    struct Entry {
+        std::string vertexSource;
+        std::string fragmentSource;
+        unsigned int vertexShader = 0;
+        unsigned int fragmentShader = 0;
+        unsigned int program = 0;
+        State state = QUEUED;
+    };
+
+    // The deferred status checks; only the failure path reads compile logs
+    void finishEntry(Entry &entry)
+    {
+        if (!ShaderProgram::linked(entry.program, entry.vertexShader, entry.fragmentShader)) {
+            glDeleteProgram(entry.program);
+            entry.program = 0;
+            entry.state = FAILED;
+        } else {
+            if (cache != nullptr) {
+                cache->store(entry.program, entry.vertexSource.c_str(), entry.fragmentSource.c_str());
+            }
+            entry.state = READY;
+        }
+
+        // Linked programs keep working after their shaders are gone
+        glDeleteShader(entry.vertexShader);
+        glDeleteShader(entry.fragmentShader);
+        entry.vertexShader = 0;
+        entry.fragmentShader = 0;
+    }
+
+    ProgramCache *cache;
+    bool parallel = false;
+    std::vector<Entry> entries;
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,1059 @@
+/*
+    Headless CPU rasterizer that mirrors the small slice of OpenGL the sample
+    programs use: buffers, vertex arrays, element buffers, programs made of a
+    vertex and a fragment stage, glClear and glDrawArrays/glDrawElements,
+    including the instanced variants and glVertexAttribDivisor. Draws are
+    GL_TRIANGLES or GL_TRIANGLE_STRIP, indexed strips with
+    GL_PRIMITIVE_RESTART and glPrimitiveRestartIndex.
+
+    The pipeline is sort-middle:
+      1. Draw calls run the vertex stage, clip and set up triangles right away
+         and bin them into 64x64 pixel tiles (in parallel for big draws).
+      2. finish() rasterizes every tile on the worker pool. Coverage uses
+         28.4 fixed-point edge functions with a top-left fill rule, varyings
+         are interpolated perspective-correctly from float plane equations.
+    Each tile walks its triangles in submission order, so the output does not
+    depend on the number of threads.
+    Attributes are fetched with GL's conversion rules, so the compact formats
+    of renderer/vertex_format.h (half floats, normalized bytes, packed
+    2_10_10_10) work as they do on a GPU.
+
+    GL enums (GL_TRIANGLES, GL_FLOAT, ...) are reused for the parameters, but
+    nothing here calls into a GL driver.
+*/
+
+#ifndef RENDERER_SOFTWARE_RASTERIZER_H
+#define RENDERER_SOFTWARE_RASTERIZER_H
+
+#include <glad/glad.h>
+
+#include "software_span.h"
+#include "vertex_attribute.h"
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace renderer {
+
+const int SW_MAX_ATTRIBS = 8;
+const int SW_TILE_SIZE = 64;
+const int SW_SUBPIXEL_BITS = 4;
+const int SW_SUBPIXEL_ONE = 1 << SW_SUBPIXEL_BITS;
+
+struct SwVec4 {
+    float x, y, z, w;
+};
+
+// What the vertex stage sees: every attribute expanded to 4 floats like GL does
+struct SwVertexInput {
+    float attribs[SW_MAX_ATTRIBS][4];
+    int vertexID;
+    int instanceID;
+};
+
+// What the vertex stage writes: gl_Position plus the "out" variables
+struct SwVertexOutput {
+    SwVec4 position;
+    float varyings[SW_MAX_VARYINGS];
+};
+
+typedef void (*SwVertexShader)(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms);
+
+// The software equivalent of a linked vertex + fragment shader program.
+// spanShader is an optional 8-pixel version of fragmentShader the SIMD kernels call once per span.
+struct SwProgram {
+    SwVertexShader vertexShader;
+    SwFragmentShader fragmentShader;
+    int varyingCount;
+    SwSpanShader spanShader;
+};
+
+// Counters for the work done since the last resetStats()
+struct SwStats {
+    unsigned long long drawCalls;
+    unsigned long long vertices;
+    unsigned long long triangles;
+    unsigned long long pixels;
+};
+
+class SoftwareRasterizer {
+public:
+    // threadCount == 0 uses every hardware thread
+    SoftwareRasterizer(int width, int height, unsigned int threadCount = 0)
+        : pool(threadCount)
+    {
+        setSimdLevel(detectSimdLevel());
+        resize(width, height);
+        buffers.emplace_back();
+        vertexArrays.emplace_back();
+        programs.emplace_back();
+        resetStats();
+    }
+
+    SoftwareRasterizer(const SoftwareRasterizer &) = delete;
+    SoftwareRasterizer &operator=(const SoftwareRasterizer &) = delete;
+
+    /* FRAMEBUFFER */
+
+    // Resizes the color buffer and resets the viewport to cover it
+    void resize(int width, int height)
+    {
+        finish();
+        fbWidth = width;
+        fbHeight = height;
+        colorBuffer.assign((size_t)width * height, 0);
+        tilesX = (width + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+        tilesY = (height + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+        tileClear.assign((size_t)tilesX * tilesY, 0);
+        viewport(0, 0, width, height);
+    }
+
+    // Picks the fragment row kernel; levels the CPU can't run fall back to the best one it can
+    void setSimdLevel(SwSimdLevel level)
+    {
+        finish();
+        SwSimdLevel supported = detectSimdLevel();
+        simdLevel = level > supported ? supported : level;
+        rowKernelFunction = rowKernel(simdLevel);
+    }
+
+    SwSimdLevel activeSimdLevel() const { return simdLevel; }
+
+    int width() const { return fbWidth; }
+    int height() const { return fbHeight; }
+    unsigned int threadCount() const { return pool.size(); }
+
+    void viewport(int x, int y, int width, int height)
+    {
+        finish();
+        viewportX = x;
+        viewportY = y;
+        viewportWidth = width;
+        viewportHeight = height;
+    }
+
+    void clearColor(float r, float g, float b, float a)
+    {
+        clearValue = packColor(r, g, b, a);
+    }
+
+    // Only GL_COLOR_BUFFER_BIT exists; the clear itself happens per tile in finish()
+    void clear(GLbitfield mask)
+    {
+        if (!(mask & GL_COLOR_BUFFER_BIT)) {
+            return;
+        }
+        finish();
+        std::fill(tileClear.begin(), tileClear.end(), (unsigned char)1);
+        clearPending = true;
+    }
+
+    // Rasterizes everything recorded so far; must run before reading the color buffer
+    void finish()
+    {
+        if (!clearPending && frameTriangles == 0) {
+            return;
+        }
+
+        pool.parallelFor((unsigned int)(tilesX * tilesY), [this](unsigned int tile, unsigned int) {
+            rasterizeTile((int)tile);
+        });
+
+        for (size_t i = 0; i < batchCount; i++) {
+            batches[i]->reset(tilesX * tilesY);
+        }
+        batchCount = 0;
+        drawStates.clear();
+        uniformArena.clear();
+        frameTriangles = 0;
+        clearPending = false;
+    }
+
+    // RGBA8 pixels, bottom row first (the glReadPixels layout)
+    const uint32_t *pixels()
+    {
+        finish();
+        return colorBuffer.data();
+    }
+
+    /* BUFFERS */
+
+    void genBuffers(int n, unsigned int *ids)
+    {
+        for (int i = 0; i < n; i++) {
+            ids[i] = (unsigned int)buffers.size();
+            buffers.emplace_back();
+        }
+    }
+
+    void deleteBuffers(int n, const unsigned int *ids)
+    {
+        finish();
+        for (int i = 0; i < n; i++) {
+            if (ids[i] != 0 && ids[i] < buffers.size()) {
+                buffers[ids[i]].clear();
+                buffers[ids[i]].shrink_to_fit();
+            }
+            // Like GL, deleting a bound buffer unbinds it from the context and the bound VAO
+            if (ids[i] != 0 && arrayBuffer == ids[i]) {
+                arrayBuffer = 0;
+            }
+            if (ids[i] != 0 && vertexArrays[boundVertexArray].elementBuffer == ids[i]) {
+                vertexArrays[boundVertexArray].elementBuffer = 0;
+            }
+        }
+    }
+
+    // GL_ARRAY_BUFFER is global state, GL_ELEMENT_ARRAY_BUFFER belongs to the bound VAO
+    void bindBuffer(GLenum target, unsigned int id)
+    {
+        if (target == GL_ARRAY_BUFFER) {
+            arrayBuffer = id;
+        } else if (target == GL_ELEMENT_ARRAY_BUFFER) {
+            vertexArrays[boundVertexArray].elementBuffer = id;
+        }
+    }
+
+    void bufferData(GLenum target, size_t size, const void *data, GLenum usage)
+    {
+        (void)usage;
+        unsigned int id = boundBuffer(target);
+        if (id == 0) {
+            return;
+        }
+
+        // Draws already binned may still read the old contents
+        finish();
+        std::vector<unsigned char> &storage = buffers[id];
+        storage.resize(size);
+        if (data != nullptr && size > 0) {
+            memcpy(storage.data(), data, size);
+        }
+    }
+
+    void bufferSubData(GLenum target, size_t offset, size_t size, const void *data)
+    {
+        unsigned int id = boundBuffer(target);
+        if (id == 0 || offset + size > buffers[id].size()) {
+            return;
+        }
+        finish();
+        memcpy(buffers[id].data() + offset, data, size);
+    }
+
+    /* VERTEX ARRAYS */
+
+    void genVertexArrays(int n, unsigned int *ids)
+    {
+        for (int i = 0; i < n; i++) {
+            ids[i] = (unsigned int)vertexArrays.size();
+            vertexArrays.emplace_back();
+        }
+    }
+
+    void deleteVertexArrays(int n, const unsigned int *ids)
+    {
+        for (int i = 0; i < n; i++) {
+            if (ids[i] != 0 && ids[i] < vertexArrays.size()) {
+                vertexArrays[ids[i]] = VertexArray();
+                if (boundVertexArray == ids[i]) {
+                    boundVertexArray = 0;
+                }
+            }
+        }
+    }
+
+    void bindVertexArray(unsigned int id)
+    {
+        boundVertexArray = id < vertexArrays.size() ? id : 0;
+    }
+
+    // Captures the bound GL_ARRAY_BUFFER exactly like glVertexAttribPointer
+    void vertexAttribPointer(unsigned int index, int size, GLenum type, GLboolean normalized, int stride, const void *pointer)
+    {
+        if (index >= (unsigned int)SW_MAX_ATTRIBS) {
+            return;
+        }
+
+        VertexAttrib &attrib = vertexArrays[boundVertexArray].attribs[index];
+        attrib.buffer = arrayBuffer;
+        attrib.size = size;
+        attrib.type = type;
+        attrib.normalized = normalized == GL_TRUE;
+        attrib.offset = (size_t)pointer;
+        attrib.stride = stride != 0 ? stride : (int)attribBytes(size, type);
+    }
+
+    void enableVertexAttribArray(unsigned int index)
+    {
+        if (index < (unsigned int)SW_MAX_ATTRIBS) {
+            vertexArrays[boundVertexArray].attribs[index].enabled = true;
+        }
+    }
+
+    void disableVertexAttribArray(unsigned int index)
+    {
+        if (index < (unsigned int)SW_MAX_ATTRIBS) {
+            vertexArrays[boundVertexArray].attribs[index].enabled = false;
+        }
+    }
+
+    // 0 advances the attribute per vertex, N every N instances
+    void vertexAttribDivisor(unsigned int index, unsigned int divisor)
+    {
+        if (index < (unsigned int)SW_MAX_ATTRIBS) {
+            vertexArrays[boundVertexArray].attribs[index].divisor = divisor;
+        }
+    }
+
+    /* PROGRAMS */
+
+    unsigned int createProgram(const SwProgram &program)
+    {
+        programs.emplace_back();
+        programs.back().stages = program;
+        programs.back().stages.varyingCount = std::min(std::max(program.varyingCount, 0), SW_MAX_VARYINGS);
+        return (unsigned int)programs.size() - 1;
+    }
+
+    void deleteProgram(unsigned int id)
+    {
+        if (id != 0 && id < programs.size()) {
+            programs[id] = Program();
+            if (currentProgram == id) {
+                currentProgram = 0;
+            }
+        }
+    }
+
+    void useProgram(unsigned int id)
+    {
+        currentProgram = id < programs.size() ? id : 0;
+    }
+
+    // Stands in for glUniform*: the bytes are handed to both stages of the current program
+    void setUniforms(const void *data, size_t size)
+    {
+        if (currentProgram == 0) {
+            return;
+        }
+        std::vector<unsigned char> &uniforms = programs[currentProgram].uniforms;
+        uniforms.assign((const unsigned char *)data, (const unsigned char *)data + size);
+    }
+
+    /* DRAWING */
+
+    // Only GL_PRIMITIVE_RESTART is a capability here
+    void enable(GLenum cap)
+    {
+        if (cap == GL_PRIMITIVE_RESTART) {
+            primitiveRestart = true;
+        }
+    }
+
+    void disable(GLenum cap)
+    {
+        if (cap == GL_PRIMITIVE_RESTART) {
+            primitiveRestart = false;
+        }
+    }
+
+    void primitiveRestartIndex(unsigned int index)
+    {
+        restartIndex = index;
+    }
+
+    void drawArrays(GLenum mode, int first, int count)
+    {
+        submitDraw(mode, count, nullptr, 0, first, 1);
+    }
+
+    // indices is a byte offset into the element buffer of the bound VAO
+    void drawElements(GLenum mode, int count, GLenum type, const void *indices)
+    {
+        drawElementsInstanced(mode, count, type, indices, 1);
+    }
+
+    void drawArraysInstanced(GLenum mode, int first, int count, int instanceCount)
+    {
+        submitDraw(mode, count, nullptr, 0, first, instanceCount);
+    }
+
+    void drawElementsInstanced(GLenum mode, int count, GLenum type, const void *indices, int instanceCount)
+    {
+        unsigned int ebo = vertexArrays[boundVertexArray].elementBuffer;
+        if (ebo == 0) {
+            return;
+        }
+
+        size_t offset = (size_t)indices;
+        size_t indexSize = type == GL_UNSIGNED_BYTE ? 1 : type == GL_UNSIGNED_SHORT ? 2 : 4;
+        const std::vector<unsigned char> &storage = buffers[ebo];
+        if (offset + (size_t)count * indexSize > storage.size()) {
+            return;
+        }
+        submitDraw(mode, count, storage.data() + offset, type, 0, instanceCount);
+    }
+
+    SwStats stats() const
+    {
+        SwStats stats;
+        stats.drawCalls = drawCounter;
+        stats.vertices = vertexCounter.load(std::memory_order_relaxed);
+        stats.triangles = triangleCounter;
+        stats.pixels = pixelCounter.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void resetStats()
+    {
+        drawCounter = 0;
+        triangleCounter = 0;
+        vertexCounter.store(0, std::memory_order_relaxed);
+        pixelCounter.store(0, std::memory_order_relaxed);
+    }
+
+    static uint32_t packColor(float r, float g, float b, float a)
+    {
+        float color[4] = {r, g, b, a};
+        return detail::packColor(&color[0], &color[1], &color[2], &color[3], 0);
+    }
+
+private:
+    struct VertexAttrib {
+        bool enabled = false;
+        bool normalized = false;
+        int size = 4;
+        GLenum type = GL_FLOAT;
+        int stride = 0;
+        size_t offset = 0;
+        unsigned int buffer = 0;
+        unsigned int divisor = 0;
+    };
+
+    struct VertexArray {
+        VertexAttrib attribs[SW_MAX_ATTRIBS];
+        unsigned int elementBuffer = 0;
+    };
+
+    struct Program {
+        SwProgram stages = {nullptr, nullptr, 0, nullptr};
+        std::vector<unsigned char> uniforms;
+    };
+
+    // Snapshot of the state a draw call was recorded with
+    struct DrawState {
+        SwFragmentShader fragmentShader;
+        SwSpanShader spanShader;
+        int varyingCount;
+        size_t uniformOffset;
+        size_t uniformSize;
+    };
+
+    struct Triangle {
+        int minX, minY, maxX, maxY;         // pixel bounds, max exclusive
+        int32_t edgeA[3], edgeB[3];         // edge steps in subpixel units
+        int64_t edgeC[3];                   // includes the fill rule bias
+        unsigned int draw;
+        SwPlane invW;                       // 1 / w
+        SwPlane varyings[SW_MAX_VARYINGS];  // varying / w
+    };
+
+    // Triangles and per-tile bins produced by one chunk of setup work
+    struct Batch {
+        std::vector<Triangle> triangles;
+        std::vector<std::vector<uint32_t>> bins;
+
+        void reset(int tileCount)
+        {
+            triangles.clear();
+            if ((int)bins.size() != tileCount) {
+                bins.assign(tileCount, std::vector<uint32_t>());
+            }
+            for (std::vector<uint32_t> &bin : bins) {
+                bin.clear();
+            }
+        }
+    };
+
+    struct ClipVertex {
+        float position[4];
+        float varyings[SW_MAX_VARYINGS];
+    };
+
+    // Post-transform cache used while walking indices; direct mapped like the small caches on GPUs
+    static const int VERTEX_CACHE_SIZE = 64;
+
+    struct VertexCache {
+        int tags[VERTEX_CACHE_SIZE];
+        SwVertexOutput entries[VERTEX_CACHE_SIZE];
+
+        void reset()
+        {
+            for (int i = 0; i < VERTEX_CACHE_SIZE; i++) {
+                tags[i] = -1;
+            }
+        }
+    };
+
+    struct DrawContext {
+        const Program *program;
+        const VertexArray *vertexArray;
+        const void *uniforms;
+        const unsigned char *indices;
+        GLenum indexType;
+        GLenum mode;
+        bool restart;
+        uint32_t restartIndex;
+        int first;
+        int instance;
+        unsigned int drawIndex;
+    };
+
+    // One element of an attribute; the packed formats hold all four components in 4 bytes
+    static size_t attribBytes(int size, GLenum type)
+    {
+        if (type == GL_INT_2_10_10_10_REV || type == GL_UNSIGNED_INT_2_10_10_10_REV) {
+            return 4;
+        }
+        return size * vertexTypeSize(type);
+    }
+
+    unsigned int boundBuffer(GLenum target) const
+    {
+        if (target == GL_ARRAY_BUFFER) {
+            return arrayBuffer;
+        }
+        if (target == GL_ELEMENT_ARRAY_BUFFER) {
+            return vertexArrays[boundVertexArray].elementBuffer;
+        }
+        return 0;
+    }
+
+    Batch &openBatch()
+    {
+        if (batchCount == batches.size()) {
+            batches.emplace_back(new Batch());
+            batches.back()->reset(tilesX * tilesY);
+        }
+        return *batches[batchCount++];
+    }
+
+    void runVertexShader(const DrawContext &draw, int vertex, SwVertexOutput &out) const
+    {
+        SwVertexInput in;
+        in.vertexID = vertex;
+        in.instanceID = draw.instance;
+
+        for (int i = 0; i < SW_MAX_ATTRIBS; i++) {
+            const VertexAttrib &attrib = draw.vertexArray->attribs[i];
+            float *value = in.attribs[i];
+            if (!attrib.enabled || attrib.buffer == 0) {
+                value[0] = 0.0f;
+                value[1] = 0.0f;
+                value[2] = 0.0f;
+                value[3] = 1.0f;
+                continue;
+            }
+
+            const std::vector<unsigned char> &storage = buffers[attrib.buffer];
+            size_t element = attrib.divisor == 0 ? (size_t)vertex : (size_t)(draw.instance / attrib.divisor);
+            size_t start = attrib.offset + element * attrib.stride;
+            if (start + attribBytes(attrib.size, attrib.type) > storage.size()) {
+                value[0] = 0.0f;
+                value[1] = 0.0f;
+                value[2] = 0.0f;
+                value[3] = 1.0f;
+                continue;
+            }
+
+            readAttribute(storage.data() + start, attrib.size, attrib.type, attrib.normalized, value);
+        }
+
+        memset(out.varyings, 0, sizeof(out.varyings));
+        draw.program->stages.vertexShader(in, out, draw.uniforms);
+    }
+
+    int fetchIndex(const DrawContext &draw, int i) const
+    {
+        if (draw.indices == nullptr) {
+            return draw.first + i;
+        }
+        switch (draw.indexType) {
+        case GL_UNSIGNED_BYTE:
+            return draw.indices[i];
+        case GL_UNSIGNED_SHORT: {
+            uint16_t index;
+            memcpy(&index, draw.indices + i * 2, sizeof(index));
+            return index;
+        }
+        default: {
+            uint32_t index;
+            memcpy(&index, draw.indices + i * 4, sizeof(index));
+            return (int)index;
+        }
+        }
+    }
+
+    const SwVertexOutput &shadeVertex(const DrawContext &draw, VertexCache &cache, int vertex) const
+    {
+        int slot = vertex & (VERTEX_CACHE_SIZE - 1);
+        if (cache.tags[slot] != vertex) {
+            cache.tags[slot] = vertex;
+            runVertexShader(draw, vertex, cache.entries[slot]);
+        }
+        return cache.entries[slot];
+    }
+
+    void submitDraw(GLenum mode, int count, const unsigned char *indices, GLenum indexType, int first, int instanceCount)
+    {
+        const Program &program = programs[currentProgram];
+        if ((mode != GL_TRIANGLES && mode != GL_TRIANGLE_STRIP) || count < 3 || instanceCount < 1 || currentProgram == 0 || program.stages.vertexShader == nullptr || program.stages.fragmentShader == nullptr) {
+            return;
+        }
+
+        // Later glUniform-style updates must not leak into this draw
+        DrawState state;
+        state.fragmentShader = program.stages.fragmentShader;
+        state.spanShader = program.stages.spanShader;
+        state.varyingCount = program.stages.varyingCount;
+        state.uniformOffset = uniformArena.size();
+        state.uniformSize = program.uniforms.size();
+        uniformArena.insert(uniformArena.end(), program.uniforms.begin(), program.uniforms.end());
+        drawStates.push_back(state);
+
+        DrawContext draw;
+        draw.program = &program;
+        draw.vertexArray = &vertexArrays[boundVertexArray];
+        draw.uniforms = program.uniforms.empty() ? nullptr : program.uniforms.data();
+        draw.indices = indices;
+        draw.indexType = indexType;
+        draw.mode = mode;
+        draw.restart = primitiveRestart && indices != nullptr;
+        draw.restartIndex = restartIndex;
+        draw.first = first;
+        draw.instance = 0;
+        draw.drawIndex = (unsigned int)drawStates.size() - 1;
+
+        // Instances are laid out one after the other: triangle t belongs to instance t / trianglesPerInstance.
+        // A strip has a triangle per element after the second; those touching a restart are skipped in setup
+        int trianglesPerInstance = mode == GL_TRIANGLE_STRIP ? count - 2 : count / 3;
+        long long triangleCount = (long long)trianglesPerInstance * instanceCount;
+        drawCounter++;
+        triangleCounter += triangleCount;
+
+        // Small draws run on this thread; big ones are split into chunks that each fill their own batch
+        const long long trianglesPerChunk = 4096;
+        unsigned int chunkCount = (unsigned int)((triangleCount + trianglesPerChunk - 1) / trianglesPerChunk);
+        if (chunkCount <= 1 || pool.size() == 1) {
+            setupTriangles(draw, trianglesPerInstance, 0, triangleCount, openBatch());
+        } else {
+            size_t firstBatch = batchCount;
+            for (unsigned int i = 0; i < chunkCount; i++) {
+                openBatch();
+            }
+            pool.parallelFor(chunkCount, [&](unsigned int chunk, unsigned int) {
+                long long begin = (long long)chunk * trianglesPerChunk;
+                long long end = std::min(begin + trianglesPerChunk, triangleCount);
+                setupTriangles(draw, trianglesPerInstance, begin, end, *batches[firstBatch + chunk]);
+            });
+        }
+
+        frameTriangles += triangleCount;
+    }
+
+    void setupTriangles(const DrawContext &instanceDraw, int trianglesPerInstance, long long begin, long long end, Batch &batch)
+    {
+        VertexCache &cache = *vertexCache();
+        DrawContext draw = instanceDraw;
+        draw.instance = -1;
+        int varyingCount = draw.program->stages.varyingCount;
+        bool strip = draw.mode == GL_TRIANGLE_STRIP;
+        unsigned long long shaded = 0;
+
+        // Element the current strip started at: odd triangles from there swap their first two vertices, as in GL
+        int stripStart = 0;
+        for (long long global = begin; global < end; global++) {
+            int instance = (int)(global / trianglesPerInstance);
+            int t = (int)(global - (long long)instance * trianglesPerInstance);
+            if (instance != draw.instance) {
+                // Cached vertices are only valid for the instance they were shaded for
+                draw.instance = instance;
+                cache.reset();
+                stripStart = strip ? findStripStart(draw, t) : 0;
+            }
+
+            int elements[3] = {t * 3, t * 3 + 1, t * 3 + 2};
+            if (strip) {
+                bool restarted = false;
+                for (int i = 0; i < 3 && draw.restart; i++) {
+                    if ((uint32_t)fetchIndex(draw, t + i) == draw.restartIndex) {
+                        stripStart = t + i + 1;
+                        restarted = true;
+                    }
+                }
+                if (restarted) {
+                    continue;
+                }
+                bool odd = ((t - stripStart) & 1) != 0;
+                elements[0] = odd ? t + 1 : t;
+                elements[1] = odd ? t : t + 1;
+                elements[2] = t + 2;
+            }
+
+            ClipVertex v[3];
+            for (int i = 0; i < 3; i++) {
+                int index = fetchIndex(draw, elements[i]);
+                int slot = index & (VERTEX_CACHE_SIZE - 1);
+                shaded += cache.tags[slot] != index;
+
+                const SwVertexOutput &out = shadeVertex(draw, cache, index);
+                v[i].position[0] = out.position.x;
+                v[i].position[1] = out.position.y;
+                v[i].position[2] = out.position.z;
+                v[i].position[3] = out.position.w;
+                memcpy(v[i].varyings, out.varyings, sizeof(float) * varyingCount);
+            }
+            clipAndSetup(v, varyingCount, draw.drawIndex, batch);
+        }
+
+        vertexCounter.fetch_add(shaded, std::memory_order_relaxed);
+    }
+
+    // A chunk can begin mid-strip: look back for the restart before element t
+    int findStripStart(const DrawContext &draw, int t) const
+    {
+        for (int i = t - 1; i >= 0 && draw.restart; i--) {
+            if ((uint32_t)fetchIndex(draw, i) == draw.restartIndex) {
+                return i + 1;
+            }
+        }
+        return 0;
+    }
+
+    // Per-thread scratch so chunks never share a vertex cache
+    static VertexCache *vertexCache()
+    {
+        static thread_local std::unique_ptr<VertexCache> cache(new VertexCache());
+        return cache.get();
+    }
+
+    /* CLIPPING */
+
+    // Distance to the clip planes GL requires (near and far) plus a guard band keeping the fixed-point math in range
+    static float planeDistance(const ClipVertex &v, int plane, float guardBand)
+    {
+        const float *p = v.position;
+        switch (plane) {
+        case 0: return p[3] + p[2];             // near
+        case 1: return p[3] - p[2];             // far
+        case 2: return guardBand * p[3] + p[0]; // left
+        case 3: return guardBand * p[3] - p[0]; // right
+        case 4: return guardBand * p[3] + p[1]; // bottom
+        default: return guardBand * p[3] - p[1]; // top
+        }
+    }
+
+    void clipAndSetup(const ClipVertex v[3], int varyingCount, unsigned int draw, Batch &batch)
+    {
+        // Keep window coordinates inside +-16384 pixels so 28.4 products stay within 64 bits
+        float guardBand = 16384.0f / (0.5f * (float)std::max(std::max(viewportWidth, viewportHeight), 1));
+
+        int outside[3] = {0, 0, 0};
+        for (int plane = 0; plane < 6; plane++) {
+            int count = 0;
+            for (int i = 0; i < 3; i++) {
+                if (planeDistance(v[i], plane, guardBand) < 0.0f) {
+                    outside[i] |= 1 << plane;
+                    count++;
+                }
+            }
+            // Entirely on the wrong side of one plane: nothing to draw
+            if (count == 3) {
+                return;
+            }
+        }
+
+        if ((outside[0] | outside[1] | outside[2]) == 0) {
+            setupTriangle(v[0], v[1], v[2], varyingCount, draw, batch);
+            return;
+        }
+
+        // Sutherland-Hodgman against the planes the triangle straddles
+        ClipVertex polygon[2][9];
+        int count = 3;
+        int current = 0;
+        polygon[0][0] = v[0];
+        polygon[0][1] = v[1];
+        polygon[0][2] = v[2];
+
+        for (int plane = 0; plane < 6 && count >= 3; plane++) {
+            if (!((outside[0] | outside[1] | outside[2]) & (1 << plane))) {
+                continue;
+            }
+
+            const ClipVertex *in = polygon[current];
+            ClipVertex *out = polygon[current ^ 1];
+            int outCount = 0;
+
+            for (int i = 0; i < count; i++) {
+                const ClipVertex &a = in[i];
+                const ClipVertex &b = in[(i + 1) % count];
+                float da = planeDistance(a, plane, guardBand);
+                float db = planeDistance(b, plane, guardBand);
+
+                if (da >= 0.0f) {
+                    out[outCount++] = a;
+                }
+                if ((da >= 0.0f) != (db >= 0.0f)) {
+                    float t = da / (da - db);
+                    ClipVertex &mid = out[outCount++];
+                    for (int c = 0; c < 4; c++) {
+                        mid.position[c] = a.position[c] + (b.position[c] - a.position[c]) * t;
+                    }
+                    for (int c = 0; c < varyingCount; c++) {
+                        mid.varyings[c] = a.varyings[c] + (b.varyings[c] - a.varyings[c]) * t;
+                    }
+                }
+            }
+
+            count = outCount;
+            current ^= 1;
+        }
+
+        for (int i = 1; i + 1 < count; i++) {
+            setupTriangle(polygon[current][0], polygon[current][i], polygon[current][i + 1], varyingCount, draw, batch);
+        }
+    }
+
+    /* TRIANGLE SETUP */
+
+    void setupTriangle(const ClipVertex &v0, const ClipVertex &v1, const ClipVertex &v2, int varyingCount, unsigned int draw, Batch &batch)
+    {
+        const ClipVertex *v[3] = {&v0, &v1, &v2};
+
+        // Viewport transform, snapped to 28.4 fixed point
+        float windowX[3], windowY[3], invW[3];
+        int32_t fixedX[3], fixedY[3];
+        for (int i = 0; i < 3; i++) {
+            invW[i] = 1.0f / v[i]->position[3];
+            windowX[i] = (v[i]->position[0] * invW[i] + 1.0f) * 0.5f * viewportWidth + viewportX;
+            windowY[i] = (v[i]->position[1] * invW[i] + 1.0f) * 0.5f * viewportHeight + viewportY;
+            fixedX[i] = (int32_t)std::lround(windowX[i] * SW_SUBPIXEL_ONE);
+            fixedY[i] = (int32_t)std::lround(windowY[i] * SW_SUBPIXEL_ONE);
+        }
+
+        int64_t area = (int64_t)(fixedX[1] - fixedX[0]) * (fixedY[2] - fixedY[0]) - (int64_t)(fixedY[1] - fixedY[0]) * (fixedX[2] - fixedX[0]);
+        if (area == 0) {
+            return;
+        }
+
+        // No face culling in the samples: flip clockwise triangles so "inside" is always E >= 0
+        int order[3] = {0, 1, 2};
+        if (area < 0) {
+            order[1] = 2;
+            order[2] = 1;
+        }
+
+        Triangle tri;
+        tri.draw = draw;
+
+        int minFixedX = std::min(std::min(fixedX[0], fixedX[1]), fixedX[2]);
+        int minFixedY = std::min(std::min(fixedY[0], fixedY[1]), fixedY[2]);
+        int maxFixedX = std::max(std::max(fixedX[0], fixedX[1]), fixedX[2]);
+        int maxFixedY = std::max(std::max(fixedY[0], fixedY[1]), fixedY[2]);
+
+        // Pixels whose centers can lie inside, clamped to the viewport and the framebuffer
+        tri.minX = std::max((minFixedX - SW_SUBPIXEL_ONE / 2 + SW_SUBPIXEL_ONE - 1) >> SW_SUBPIXEL_BITS, std::max(viewportX, 0));
+        tri.minY = std::max((minFixedY - SW_SUBPIXEL_ONE / 2 + SW_SUBPIXEL_ONE - 1) >> SW_SUBPIXEL_BITS, std::max(viewportY, 0));
+        tri.maxX = std::min(((maxFixedX - SW_SUBPIXEL_ONE / 2) >> SW_SUBPIXEL_BITS) + 1, std::min(viewportX + viewportWidth, fbWidth));
+        tri.maxY = std::min(((maxFixedY - SW_SUBPIXEL_ONE / 2) >> SW_SUBPIXEL_BITS) + 1, std::min(viewportY + viewportHeight, fbHeight));
+        if (tri.minX >= tri.maxX || tri.minY >= tri.maxY) {
+            return;
+        }
+
+        for (int e = 0; e < 3; e++) {
+            int a = order[e];
+            int b = order[(e + 1) % 3];
+            int32_t edgeA = fixedY[a] - fixedY[b];
+            int32_t edgeB = fixedX[b] - fixedX[a];
+            int64_t edgeC = -((int64_t)edgeA * fixedX[a] + (int64_t)edgeB * fixedY[a]);
+
+            // Top-left rule: pixel centers exactly on a right or bottom edge belong to the neighbour
+            bool topLeft = edgeA > 0 || (edgeA == 0 && edgeB < 0);
+            if (!topLeft) {
+                edgeC -= 1;
+            }
+
+            tri.edgeA[e] = edgeA;
+            tri.edgeB[e] = edgeB;
+            tri.edgeC[e] = edgeC;
+        }
+
+        // Attribute planes from the float window positions; d(value)/dx and d(value)/dy
+        float x10 = windowX[1] - windowX[0], y10 = windowY[1] - windowY[0];
+        float x20 = windowX[2] - windowX[0], y20 = windowY[2] - windowY[0];
+        float det = x10 * y20 - x20 * y10;
+        if (det == 0.0f) {
+            return;
+        }
+        float invDet = 1.0f / det;
+
+        auto makePlane = [&](float f0, float f1, float f2) {
+            float d10 = f1 - f0;
+            float d20 = f2 - f0;
+            SwPlane plane;
+            plane.a = (d10 * y20 - d20 * y10) * invDet;
+            plane.b = (d20 * x10 - d10 * x20) * invDet;
+            plane.c = f0 - plane.a * windowX[0] - plane.b * windowY[0];
+            return plane;
+        };
+
+        tri.invW = makePlane(invW[0], invW[1], invW[2]);
+        for (int c = 0; c < varyingCount; c++) {
+            tri.varyings[c] = makePlane(v0.varyings[c] * invW[0], v1.varyings[c] * invW[1], v2.varyings[c] * invW[2]);
+        }
+
+        // Bin into every tile the bounds touch; the rasterizer rejects the empty ones cheaply
+        uint32_t index = (uint32_t)batch.triangles.size();
+        batch.triangles.push_back(tri);
+
+        int tileMinX = tri.minX / SW_TILE_SIZE, tileMaxX = (tri.maxX - 1) / SW_TILE_SIZE;
+        int tileMinY = tri.minY / SW_TILE_SIZE, tileMaxY = (tri.maxY - 1) / SW_TILE_SIZE;
+        for (int ty = tileMinY; ty <= tileMaxY; ty++) {
+            for (int tx = tileMinX; tx <= tileMaxX; tx++) {
+                batch.bins[ty * tilesX + tx].push_back(index);
+            }
+        }
+    }
+
+    /* RASTERIZATION */
+
+    void rasterizeTile(int tile)
+    {
+        int tileX0 = (tile % tilesX) * SW_TILE_SIZE;
+        int tileY0 = (tile / tilesX) * SW_TILE_SIZE;
+        int tileX1 = std::min(tileX0 + SW_TILE_SIZE, fbWidth);
+        int tileY1 = std::min(tileY0 + SW_TILE_SIZE, fbHeight);
+
+        if (tileClear[tile]) {
+            for (int y = tileY0; y < tileY1; y++) {
+                uint32_t *row = colorBuffer.data() + (size_t)y * fbWidth;
+                std::fill(row + tileX0, row + tileX1, clearValue);
+            }
+            tileClear[tile] = 0;
+        }
+
+        unsigned long long shaded = 0;
+        for (size_t b = 0; b < batchCount; b++) {
+            const Batch &batch = *batches[b];
+            for (uint32_t index : batch.bins[tile]) {
+                shaded += rasterizeTriangle(batch.triangles[index], tileX0, tileY0, tileX1, tileY1);
+            }
+        }
+        pixelCounter.fetch_add(shaded, std::memory_order_relaxed);
+    }
+
+    unsigned long long rasterizeTriangle(const Triangle &tri, int tileX0, int tileY0, int tileX1, int tileY1)
+    {
+        int x0 = std::max(tri.minX, tileX0), x1 = std::min(tri.maxX, tileX1);
+        int y0 = std::max(tri.minY, tileY0), y1 = std::min(tri.maxY, tileY1);
+        if (x0 >= x1 || y0 >= y1) {
+            return 0;
+        }
+
+        const DrawState &state = drawStates[tri.draw];
+
+        SwRowJob job;
+        job.edgeCount = 0;
+        job.invW = tri.invW;
+        job.varyings = tri.varyings;
+        job.varyingCount = state.varyingCount;
+        job.fragmentShader = state.fragmentShader;
+        job.spanShader = state.spanShader;
+        job.uniforms = state.uniformSize > 0 ? uniformArena.data() + state.uniformOffset : nullptr;
+
+        // Classify each edge against the rectangle using its corners, where a linear function peaks
+        int64_t rowStart[3];
+        int64_t stepY[3];
+        for (int e = 0; e < 3; e++) {
+            int64_t stepX = (int64_t)tri.edgeA[e] << SW_SUBPIXEL_BITS;
+            int64_t edgeStepY = (int64_t)tri.edgeB[e] << SW_SUBPIXEL_BITS;
+            int64_t px = ((int64_t)x0 << SW_SUBPIXEL_BITS) + SW_SUBPIXEL_ONE / 2;
+            int64_t py = ((int64_t)y0 << SW_SUBPIXEL_BITS) + SW_SUBPIXEL_ONE / 2;
+            int64_t origin = tri.edgeA[e] * px + tri.edgeB[e] * py + tri.edgeC[e];
+
+            int64_t spanX = stepX * (x1 - x0 - 1), spanY = edgeStepY * (y1 - y0 - 1);
+            int64_t maximum = origin + std::max<int64_t>(0, spanX) + std::max<int64_t>(0, spanY);
+            int64_t minimum = origin + std::min<int64_t>(0, spanX) + std::min<int64_t>(0, spanY);
+            if (maximum < 0) {
+                return 0;
+            }
+            if (minimum >= 0) {
+                continue;
+            }
+
+            // This edge crosses the rectangle, so its values stay well inside 32 bits (see the guard band)
+            rowStart[job.edgeCount] = origin;
+            stepY[job.edgeCount] = edgeStepY;
+            job.edgeStep[job.edgeCount] = (int32_t)stepX;
+            job.edgeCount++;
+        }
+
+        unsigned long long shaded = 0;
+        for (int y = y0; y < y1; y++) {
+            for (int e = 0; e < job.edgeCount; e++) {
+                job.edgeStart[e] = (int32_t)rowStart[e];
+                rowStart[e] += stepY[e];
+            }
+            job.centerY = (float)y + 0.5f;
+            shaded += rowKernelFunction(job, colorBuffer.data() + (size_t)y * fbWidth, x0, x1);
+        }
+
+        return shaded;
+    }
+
+    WorkerPool pool;
+    SwSimdLevel simdLevel = SW_SIMD_SCALAR;
+    SwRowKernel rowKernelFunction = nullptr;
+
+    int fbWidth = 0, fbHeight = 0;
+    int tilesX = 0, tilesY = 0;
+    int viewportX = 0, viewportY = 0, viewportWidth = 0, viewportHeight = 0;
+    std::vector<uint32_t> colorBuffer;
+    std::vector<unsigned char> tileClear;
+    uint32_t clearValue = 0;
+    bool clearPending = false;
+
+    std::vector<std::vector<unsigned char>> buffers;
+    std::vector<VertexArray> vertexArrays;
+    std::vector<Program> programs;
+    unsigned int arrayBuffer = 0;
+    unsigned int boundVertexArray = 0;
+    unsigned int currentProgram = 0;
+    bool primitiveRestart = false;
+    uint32_t restartIndex = 0;
+
+    // Work recorded for the current frame, consumed by finish()
+    std::vector<std::unique_ptr<Batch>> batches;
+    size_t batchCount = 0;
+    std::vector<DrawState> drawStates;
+    std::vector<unsigned char> uniformArena;
+    unsigned long long frameTriangles = 0;
+
+    // Updated from the worker threads during setup and rasterization
+    unsigned long long drawCounter = 0;
+    unsigned long long triangleCounter = 0;
+    std::atomic<unsigned long long> vertexCounter{0};
+    std::atomic<unsigned long long> pixelCounter{0};
+};
+
+} // namespace renderer
+
+#endif
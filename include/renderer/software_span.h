@@ -0,0 +1,377 @@
+/*
+    Row kernels for the software rasterizer's fragment stage.
+
+    A row kernel walks one row of a triangle's pixels in spans of 8: it tests
+    coverage with the 32-bit edge values, interpolates 1/w and every varying
+    for the covered pixels, runs the fragment stage and packs the result to
+    RGBA8. The scalar, SSE2 and AVX2 kernels do the same arithmetic in the
+    same order (no FMA contraction, true division), so they produce identical
+    pixels and the fastest one the CPU supports is picked at runtime.
+*/
+
+#ifndef RENDERER_SOFTWARE_SPAN_H
+#define RENDERER_SOFTWARE_SPAN_H
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RENDERER_SW_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang only emit AVX2 instructions inside functions that ask for them
+#if defined(RENDERER_SW_X86) && (defined(__GNUC__) || defined(__clang__))
+#define RENDERER_SW_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define RENDERER_SW_TARGET_AVX2
+#endif
+
+namespace renderer {
+
+const int SW_MAX_VARYINGS = 8;
+const int SW_SPAN_WIDTH = 8;
+
+// Plane equation value = a * x + b * y + c, evaluated at pixel centers
+struct SwPlane {
+    float a, b, c;
+};
+
+// Structure-of-arrays block the span fragment stage reads varyings from and writes colors to
+struct SwFragmentSpan {
+    float varyings[SW_MAX_VARYINGS][SW_SPAN_WIDTH];
+    float color[4][SW_SPAN_WIDTH];
+};
+
+typedef void (*SwFragmentShader)(const float *varyings, float color[4], const void *uniforms);
+typedef void (*SwSpanShader)(SwFragmentSpan &span, const void *uniforms);
+
+enum SwSimdLevel {
+    SW_SIMD_SCALAR = 0,
+    SW_SIMD_SSE2 = 1,
+    SW_SIMD_AVX2 = 2
+};
+
+inline const char *simdLevelName(SwSimdLevel level)
+{
+    switch (level) {
+    case SW_SIMD_AVX2: return "avx2";
+    case SW_SIMD_SSE2: return "sse2";
+    default: return "scalar";
+    }
+}
+
+// Best level both the compiler and the CPU running us can do
+inline SwSimdLevel detectSimdLevel()
+{
+#if defined(RENDERER_SW_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SW_SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SW_SIMD_SSE2;
+    }
+#elif defined(RENDERER_SW_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5)) {
+            return SW_SIMD_AVX2;
+        }
+    }
+    __cpuid(info, 1);
+    if (info[3] & (1 << 26)) {
+        return SW_SIMD_SSE2;
+    }
+#endif
+    return SW_SIMD_SCALAR;
+}
+
+// Everything a row kernel needs about one triangle on one row
+struct SwRowJob {
+    int edgeCount;              // edges that cross the rectangle; the rest cover it fully
+    int32_t edgeStart[3];       // edge values at the first pixel of the row
+    int32_t edgeStep[3];        // change per pixel in x
+    float centerY;
+    SwPlane invW;
+    const SwPlane *varyings;
+    int varyingCount;
+    SwFragmentShader fragmentShader;
+    SwSpanShader spanShader;    // optional, used instead of fragmentShader when set
+    const void *uniforms;
+};
+
+// Shades the covered pixels in [x0, x1) of row and returns how many there were
+typedef unsigned long long (*SwRowKernel)(const SwRowJob &job, uint32_t *row, int x0, int x1);
+
+namespace detail {
+
+inline unsigned char toByte(float value)
+{
+    value = value < 0.0f ? 0.0f : value > 1.0f ? 1.0f : value;
+    return (unsigned char)(value * 255.0f + 0.5f);
+}
+
+inline uint32_t packColor(const float *r, const float *g, const float *b, const float *a, int lane)
+{
+    return (uint32_t)toByte(r[lane]) | ((uint32_t)toByte(g[lane]) << 8) | ((uint32_t)toByte(b[lane]) << 16) | ((uint32_t)toByte(a[lane]) << 24);
+}
+
+// Population count of an 8-lane coverage mask
+inline unsigned int countLanes(unsigned int mask)
+{
+    mask = mask - ((mask >> 1) & 0x55u);
+    mask = (mask & 0x33u) + ((mask >> 2) & 0x33u);
+    return (mask + (mask >> 4)) & 0x0Fu;
+}
+
+// Runs the fragment stage over the covered lanes of a span whose varyings are already interpolated
+inline void shadeSpan(const SwRowJob &job, SwFragmentSpan &span, unsigned int mask)
+{
+    if (job.spanShader != nullptr) {
+        job.spanShader(span, job.uniforms);
+        return;
+    }
+
+    float varyings[SW_MAX_VARYINGS];
+    float color[4];
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        if (!(mask & (1u << lane))) {
+            continue;
+        }
+        for (int c = 0; c < job.varyingCount; c++) {
+            varyings[c] = span.varyings[c][lane];
+        }
+        job.fragmentShader(varyings, color, job.uniforms);
+        for (int c = 0; c < 4; c++) {
+            span.color[c][lane] = color[c];
+        }
+    }
+}
+
+inline unsigned long long rowScalar(const SwRowJob &job, uint32_t *row, int x0, int x1)
+{
+    SwFragmentSpan span;
+    unsigned long long shaded = 0;
+    int32_t edges[3] = {job.edgeStart[0], job.edgeStart[1], job.edgeStart[2]};
+
+    for (int x = x0; x < x1; x += SW_SPAN_WIDTH) {
+        unsigned int mask = 0;
+        for (int lane = 0; lane < SW_SPAN_WIDTH && x + lane < x1; lane++) {
+            bool inside = true;
+            for (int e = 0; e < job.edgeCount; e++) {
+                inside = inside && edges[e] + lane * job.edgeStep[e] >= 0;
+            }
+            mask |= (unsigned int)inside << lane;
+        }
+        for (int e = 0; e < job.edgeCount; e++) {
+            edges[e] += SW_SPAN_WIDTH * job.edgeStep[e];
+        }
+        if (mask == 0) {
+            continue;
+        }
+
+        for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+            float centerX = (float)(x + lane) + 0.5f;
+            float w = 1.0f / (job.invW.a * centerX + job.invW.b * job.centerY + job.invW.c);
+            for (int c = 0; c < job.varyingCount; c++) {
+                const SwPlane &plane = job.varyings[c];
+                span.varyings[c][lane] = (plane.a * centerX + plane.b * job.centerY + plane.c) * w;
+            }
+        }
+
+        shadeSpan(job, span, mask);
+
+        for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+            if (mask & (1u << lane)) {
+                row[x + lane] = packColor(span.color[0], span.color[1], span.color[2], span.color[3], lane);
+                shaded++;
+            }
+        }
+    }
+
+    return shaded;
+}
+
+#ifdef RENDERER_SW_X86
+
+inline __m128i packColorSSE2(const SwFragmentSpan &span, int half)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 bias = _mm_set1_ps(0.5f);
+
+    __m128i packed = _mm_setzero_si128();
+    for (int c = 0; c < 4; c++) {
+        __m128 value = _mm_loadu_ps(span.color[c] + half * 4);
+        value = _mm_min_ps(_mm_max_ps(value, zero), one);
+        __m128i byte = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, scale), bias));
+        packed = _mm_or_si128(packed, _mm_sll_epi32(byte, _mm_cvtsi32_si128(c * 8)));
+    }
+    return packed;
+}
+
+inline unsigned long long rowSSE2(const SwRowJob &job, uint32_t *row, int x0, int x1)
+{
+    SwFragmentSpan span;
+    unsigned long long shaded = 0;
+
+    // Two 4-wide halves per 8-pixel span
+    const __m128i laneIndex[2] = {_mm_setr_epi32(0, 1, 2, 3), _mm_setr_epi32(4, 5, 6, 7)};
+    const __m128 laneOffset[2] = {_mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f), _mm_setr_ps(4.5f, 5.5f, 6.5f, 7.5f)};
+    __m128i edges[3][2];
+    __m128i spanStep[3];
+    for (int e = 0; e < job.edgeCount; e++) {
+        __m128i step = _mm_set1_epi32(job.edgeStep[e]);
+        for (int h = 0; h < 2; h++) {
+            // lane * step without SSE4.1's mullo: multiply the even and odd lanes separately
+            __m128i even = _mm_mul_epu32(laneIndex[h], step);
+            __m128i odd = _mm_mul_epu32(_mm_srli_epi64(laneIndex[h], 32), step);
+            __m128i product = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+            edges[e][h] = _mm_add_epi32(_mm_set1_epi32(job.edgeStart[e]), product);
+        }
+        spanStep[e] = _mm_set1_epi32(job.edgeStep[e] * SW_SPAN_WIDTH);
+    }
+
+    const __m128 centerY = _mm_set1_ps(job.centerY);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    for (int x = x0; x < x1; x += SW_SPAN_WIDTH) {
+        unsigned int mask = 0;
+        for (int h = 0; h < 2; h++) {
+            __m128i outside = _mm_cmplt_epi32(_mm_set1_epi32(x1 - x - 1), laneIndex[h]);
+            for (int e = 0; e < job.edgeCount; e++) {
+                outside = _mm_or_si128(outside, _mm_cmplt_epi32(edges[e][h], _mm_setzero_si128()));
+                edges[e][h] = _mm_add_epi32(edges[e][h], spanStep[e]);
+            }
+            mask |= (unsigned int)(~_mm_movemask_ps(_mm_castsi128_ps(outside)) & 0xF) << (h * 4);
+        }
+        if (mask == 0) {
+            continue;
+        }
+
+        for (int h = 0; h < 2; h++) {
+            __m128 centerX = _mm_add_ps(_mm_set1_ps((float)x), laneOffset[h]);
+            __m128 invW = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(job.invW.a), centerX), _mm_mul_ps(_mm_set1_ps(job.invW.b), centerY)), _mm_set1_ps(job.invW.c));
+            __m128 w = _mm_div_ps(one, invW);
+            for (int c = 0; c < job.varyingCount; c++) {
+                const SwPlane &plane = job.varyings[c];
+                __m128 value = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.a), centerX), _mm_mul_ps(_mm_set1_ps(plane.b), centerY)), _mm_set1_ps(plane.c));
+                _mm_storeu_ps(span.varyings[c] + h * 4, _mm_mul_ps(value, w));
+            }
+        }
+
+        shadeSpan(job, span, mask);
+
+        if (x + SW_SPAN_WIDTH <= x1) {
+            // Whole span inside the row: blend the covered lanes into the existing pixels
+            for (int h = 0; h < 2; h++) {
+                unsigned int halfMask = (mask >> (h * 4)) & 0xF;
+                if (halfMask == 0) {
+                    continue;
+                }
+                __m128i *target = (__m128i *)(row + x + h * 4);
+                __m128i packed = packColorSSE2(span, h);
+                __m128i select = _mm_cmpgt_epi32(_mm_and_si128(_mm_set1_epi32((int)halfMask), _mm_setr_epi32(1, 2, 4, 8)), _mm_setzero_si128());
+                __m128i old = _mm_loadu_si128(target);
+                _mm_storeu_si128(target, _mm_or_si128(_mm_and_si128(select, packed), _mm_andnot_si128(select, old)));
+            }
+        } else {
+            for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+                if (mask & (1u << lane)) {
+                    row[x + lane] = packColor(span.color[0], span.color[1], span.color[2], span.color[3], lane);
+                }
+            }
+        }
+
+        shaded += countLanes(mask);
+    }
+
+    return shaded;
+}
+
+RENDERER_SW_TARGET_AVX2
+inline unsigned long long rowAVX2(const SwRowJob &job, uint32_t *row, int x0, int x1)
+{
+    SwFragmentSpan span;
+    unsigned long long shaded = 0;
+
+    const __m256i laneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256 laneOffset = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+    __m256i edges[3];
+    __m256i spanStep[3];
+    for (int e = 0; e < job.edgeCount; e++) {
+        edges[e] = _mm256_add_epi32(_mm256_set1_epi32(job.edgeStart[e]), _mm256_mullo_epi32(laneIndex, _mm256_set1_epi32(job.edgeStep[e])));
+        spanStep[e] = _mm256_set1_epi32(job.edgeStep[e] * SW_SPAN_WIDTH);
+    }
+
+    const __m256 centerY = _mm256_set1_ps(job.centerY);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 scale = _mm256_set1_ps(255.0f);
+    const __m256 bias = _mm256_set1_ps(0.5f);
+
+    for (int x = x0; x < x1; x += SW_SPAN_WIDTH) {
+        __m256i outside = _mm256_cmpgt_epi32(laneIndex, _mm256_set1_epi32(x1 - x - 1));
+        for (int e = 0; e < job.edgeCount; e++) {
+            outside = _mm256_or_si256(outside, _mm256_cmpgt_epi32(_mm256_setzero_si256(), edges[e]));
+            edges[e] = _mm256_add_epi32(edges[e], spanStep[e]);
+        }
+        unsigned int mask = (unsigned int)(~_mm256_movemask_ps(_mm256_castsi256_ps(outside)) & 0xFF);
+        if (mask == 0) {
+            continue;
+        }
+
+        __m256 centerX = _mm256_add_ps(_mm256_set1_ps((float)x), laneOffset);
+        __m256 invW = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(job.invW.a), centerX), _mm256_mul_ps(_mm256_set1_ps(job.invW.b), centerY)), _mm256_set1_ps(job.invW.c));
+        __m256 w = _mm256_div_ps(one, invW);
+        for (int c = 0; c < job.varyingCount; c++) {
+            const SwPlane &plane = job.varyings[c];
+            __m256 value = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.a), centerX), _mm256_mul_ps(_mm256_set1_ps(plane.b), centerY)), _mm256_set1_ps(plane.c));
+            _mm256_storeu_ps(span.varyings[c], _mm256_mul_ps(value, w));
+        }
+
+        shadeSpan(job, span, mask);
+
+        __m256i packed = _mm256_setzero_si256();
+        for (int c = 0; c < 4; c++) {
+            __m256 value = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(span.color[c]), zero), one);
+            __m256i byte = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(value, scale), bias));
+            packed = _mm256_or_si256(packed, _mm256_sll_epi32(byte, _mm_cvtsi32_si128(c * 8)));
+        }
+
+        // Masked lanes are never touched, so spans running past the row end are safe
+        _mm256_maskstore_epi32((int *)(row + x), _mm256_xor_si256(outside, _mm256_set1_epi32(-1)), packed);
+        shaded += countLanes(mask);
+    }
+
+    return shaded;
+}
+
+#endif
+
+} // namespace detail
+
+inline SwRowKernel rowKernel(SwSimdLevel level)
+{
+#ifdef RENDERER_SW_X86
+    if (level == SW_SIMD_AVX2) {
+        return &detail::rowAVX2;
+    }
+    if (level == SW_SIMD_SSE2) {
+        return &detail::rowSSE2;
+    }
+#endif
+    (void)level;
+    return &detail::rowScalar;
+}
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,467 @@
+/*
+    Shadow-state cache that filters redundant GL state changes.
+
+    install() swaps a handful of glad dispatch pointers (glad_glUseProgram,
+    glad_glBindVertexArray, glad_glBindBuffer, ...) for thunks that compare
+    the new value against a shadow copy and only forward real changes to the
+    driver. Because every glXxx macro goes through those pointers, existing
+    code picks the cache up without any change.
+
+    The shadow starts out "unknown" for every slot, so the first call always
+    reaches the driver. Code that changes GL state behind glad's back (another
+    library, a second context) must call invalidate() afterwards.
+    The shadow is global, like glad's pointers: one context at a time.
+*/
+
+#ifndef RENDERER_STATE_CACHE_H
+#define RENDERER_STATE_CACHE_H
+
+#include <glad/glad.h>
+
+#include <cstring>
+#include <iostream>
+
+namespace renderer {
+
+struct StateCacheStats {
+    unsigned long long issued;  // calls forwarded to the driver
+    unsigned long long elided;  // calls dropped because they changed nothing
+};
+
+class StateCache {
+public:
+    // Replaces the glad pointers with the caching thunks; call after gladLoadGLLoader
+    static void install()
+    {
+        State &state = get();
+        if (state.installed) {
+            return;
+        }
+
+        state.original.useProgram = glad_glUseProgram;
+        state.original.bindVertexArray = glad_glBindVertexArray;
+        state.original.bindBuffer = glad_glBindBuffer;
+        state.original.bindBufferBase = glad_glBindBufferBase;
+        state.original.bindBufferRange = glad_glBindBufferRange;
+        state.original.clearColor = glad_glClearColor;
+        state.original.viewport = glad_glViewport;
+        state.original.enable = glad_glEnable;
+        state.original.disable = glad_glDisable;
+        state.original.blendFunc = glad_glBlendFunc;
+        state.original.activeTexture = glad_glActiveTexture;
+        state.original.bindTexture = glad_glBindTexture;
+        state.original.deleteBuffers = glad_glDeleteBuffers;
+        state.original.deleteVertexArrays = glad_glDeleteVertexArrays;
+        state.original.deleteTextures = glad_glDeleteTextures;
+
+        glad_glUseProgram = &useProgram;
+        glad_glBindVertexArray = &bindVertexArray;
+        glad_glBindBuffer = &bindBuffer;
+        glad_glBindBufferBase = &bindBufferBase;
+        glad_glBindBufferRange = &bindBufferRange;
+        glad_glClearColor = &clearColor;
+        glad_glViewport = &viewport;
+        glad_glEnable = &enable;
+        glad_glDisable = &disable;
+        glad_glBlendFunc = &blendFunc;
+        glad_glActiveTexture = &activeTexture;
+        glad_glBindTexture = &bindTexture;
+        glad_glDeleteBuffers = &deleteBuffers;
+        glad_glDeleteVertexArrays = &deleteVertexArrays;
+        glad_glDeleteTextures = &deleteTextures;
+
+        state.installed = true;
+        invalidate();
+    }
+
+    // Puts the driver's pointers back
+    static void uninstall()
+    {
+        State &state = get();
+        if (!state.installed) {
+            return;
+        }
+
+        glad_glUseProgram = state.original.useProgram;
+        glad_glBindVertexArray = state.original.bindVertexArray;
+        glad_glBindBuffer = state.original.bindBuffer;
+        glad_glBindBufferBase = state.original.bindBufferBase;
+        glad_glBindBufferRange = state.original.bindBufferRange;
+        glad_glClearColor = state.original.clearColor;
+        glad_glViewport = state.original.viewport;
+        glad_glEnable = state.original.enable;
+        glad_glDisable = state.original.disable;
+        glad_glBlendFunc = state.original.blendFunc;
+        glad_glActiveTexture = state.original.activeTexture;
+        glad_glBindTexture = state.original.bindTexture;
+        glad_glDeleteBuffers = state.original.deleteBuffers;
+        glad_glDeleteVertexArrays = state.original.deleteVertexArrays;
+        glad_glDeleteTextures = state.original.deleteTextures;
+
+        state.installed = false;
+    }
+
+    // Forgets everything; the next call for every slot reaches the driver
+    static void invalidate()
+    {
+        Shadow &shadow = get().shadow;
+        memset(&shadow, 0, sizeof(shadow));
+    }
+
+    // Counts for the frame that just ended; resets them for the next one
+    static StateCacheStats endFrame()
+    {
+        State &state = get();
+        StateCacheStats frame = state.frame;
+        state.total.issued += frame.issued;
+        state.total.elided += frame.elided;
+        state.frames++;
+        state.last = frame;
+        state.frame = StateCacheStats{0, 0};
+        return frame;
+    }
+
+    static StateCacheStats lastFrame() { return get().last; }
+
+    // Totals over every frame ended so far
+    static StateCacheStats totals() { return get().total; }
+
+    static void printSummary()
+    {
+        State &state = get();
+        unsigned long long frames = state.frames > 0 ? state.frames : 1;
+        std::cout << "State cache: " << state.total.issued / (double)frames << " calls issued, "
+                  << state.total.elided / (double)frames << " elided per frame over " << state.frames << " frames" << std::endl;
+    }
+
+private:
+    static const int TRACKED_TEXTURE_UNITS = 16;
+
+    struct Original {
+        PFNGLUSEPROGRAMPROC useProgram;
+        PFNGLBINDVERTEXARRAYPROC bindVertexArray;
+        PFNGLBINDBUFFERPROC bindBuffer;
+        PFNGLBINDBUFFERBASEPROC bindBufferBase;
+        PFNGLBINDBUFFERRANGEPROC bindBufferRange;
+        PFNGLCLEARCOLORPROC clearColor;
+        PFNGLVIEWPORTPROC viewport;
+        PFNGLENABLEPROC enable;
+        PFNGLDISABLEPROC disable;
+        PFNGLBLENDFUNCPROC blendFunc;
+        PFNGLACTIVETEXTUREPROC activeTexture;
+        PFNGLBINDTEXTUREPROC bindTexture;
+        PFNGLDELETEBUFFERSPROC deleteBuffers;
+        PFNGLDELETEVERTEXARRAYSPROC deleteVertexArrays;
+        PFNGLDELETETEXTURESPROC deleteTextures;
+    };
+
+    // Each value has a "known" flag; zero-filled means nothing is known
+    enum BufferSlot {
+        ARRAY_BUFFER_SLOT,
+        ELEMENT_ARRAY_BUFFER_SLOT,  // part of the bound VAO
+        COPY_READ_BUFFER_SLOT,
+        COPY_WRITE_BUFFER_SLOT,
+        PIXEL_PACK_BUFFER_SLOT,
+        PIXEL_UNPACK_BUFFER_SLOT,
+        UNIFORM_BUFFER_SLOT,
+        BUFFER_SLOT_COUNT
+    };
+
+    enum CapabilitySlot {
+        BLEND_SLOT,
+        DEPTH_TEST_SLOT,
+        CULL_FACE_SLOT,
+        SCISSOR_TEST_SLOT,
+        STENCIL_TEST_SLOT,
+        PRIMITIVE_RESTART_SLOT,
+        CAPABILITY_SLOT_COUNT
+    };
+
+    struct Shadow {
+        bool programKnown;
+        GLuint program;
+        bool vertexArrayKnown;
+        GLuint vertexArray;
+        bool bufferKnown[BUFFER_SLOT_COUNT];
+        GLuint buffer[BUFFER_SLOT_COUNT];
+        bool clearColorKnown;
+        GLfloat clearColor[4];
+        bool viewportKnown;
+        GLint viewport[4];
+        bool capabilityKnown[CAPABILITY_SLOT_COUNT];
+        bool capability[CAPABILITY_SLOT_COUNT];
+        bool blendFuncKnown;
+        GLenum blendFunc[2];
+        bool activeTextureKnown;
+        GLenum activeTexture;
+        bool textureKnown[TRACKED_TEXTURE_UNITS];
+        GLuint texture2D[TRACKED_TEXTURE_UNITS];
+    };
+
+    struct State {
+        bool installed = false;
+        Original original;
+        Shadow shadow;
+        StateCacheStats frame = {0, 0};
+        StateCacheStats last = {0, 0};
+        StateCacheStats total = {0, 0};
+        unsigned long long frames = 0;
+    };
+
+    static State &get()
+    {
+        static State state;
+        return state;
+    }
+
+    static void issued() { get().frame.issued++; }
+    static void elided() { get().frame.elided++; }
+
+    static int bufferSlot(GLenum target)
+    {
+        switch (target) {
+        case GL_ARRAY_BUFFER: return ARRAY_BUFFER_SLOT;
+        case GL_ELEMENT_ARRAY_BUFFER: return ELEMENT_ARRAY_BUFFER_SLOT;
+        case GL_COPY_READ_BUFFER: return COPY_READ_BUFFER_SLOT;
+        case GL_COPY_WRITE_BUFFER: return COPY_WRITE_BUFFER_SLOT;
+        case GL_PIXEL_PACK_BUFFER: return PIXEL_PACK_BUFFER_SLOT;
+        case GL_PIXEL_UNPACK_BUFFER: return PIXEL_UNPACK_BUFFER_SLOT;
+        case GL_UNIFORM_BUFFER: return UNIFORM_BUFFER_SLOT;
+        default: return -1;
+        }
+    }
+
+    static int capabilitySlot(GLenum cap)
+    {
+        switch (cap) {
+        case GL_BLEND: return BLEND_SLOT;
+        case GL_DEPTH_TEST: return DEPTH_TEST_SLOT;
+        case GL_CULL_FACE: return CULL_FACE_SLOT;
+        case GL_SCISSOR_TEST: return SCISSOR_TEST_SLOT;
+        case GL_STENCIL_TEST: return STENCIL_TEST_SLOT;
+        case GL_PRIMITIVE_RESTART: return PRIMITIVE_RESTART_SLOT;
+        default: return -1;
+        }
+    }
+
+    /* THUNKS */
+
+    static void APIENTRY useProgram(GLuint program)
+    {
+        Shadow &shadow = get().shadow;
+        if (shadow.programKnown && shadow.program == program) {
+            elided();
+            return;
+        }
+        shadow.programKnown = true;
+        shadow.program = program;
+        issued();
+        get().original.useProgram(program);
+    }
+
+    static void APIENTRY bindVertexArray(GLuint array)
+    {
+        Shadow &shadow = get().shadow;
+        if (shadow.vertexArrayKnown && shadow.vertexArray == array) {
+            elided();
+            return;
+        }
+        shadow.vertexArrayKnown = true;
+        shadow.vertexArray = array;
+        // The element buffer binding comes with the VAO, and we don't know what that one holds
+        shadow.bufferKnown[ELEMENT_ARRAY_BUFFER_SLOT] = false;
+        issued();
+        get().original.bindVertexArray(array);
+    }
+
+    static void APIENTRY bindBuffer(GLenum target, GLuint buffer)
+    {
+        Shadow &shadow = get().shadow;
+        int slot = bufferSlot(target);
+        if (slot >= 0) {
+            if (shadow.bufferKnown[slot] && shadow.buffer[slot] == buffer) {
+                elided();
+                return;
+            }
+            shadow.bufferKnown[slot] = true;
+            shadow.buffer[slot] = buffer;
+        }
+        issued();
+        get().original.bindBuffer(target, buffer);
+    }
+
+    // The indexed binds also bind the generic target, unless the index is out of range,
+    // so the shadow forgets that slot rather than guessing; the indexed bindings aren't cached
+    static void APIENTRY bindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        int slot = bufferSlot(target);
+        if (slot >= 0) {
+            get().shadow.bufferKnown[slot] = false;
+        }
+        issued();
+        get().original.bindBufferBase(target, index, buffer);
+    }
+
+    static void APIENTRY bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        int slot = bufferSlot(target);
+        if (slot >= 0) {
+            get().shadow.bufferKnown[slot] = false;
+        }
+        issued();
+        get().original.bindBufferRange(target, index, buffer, offset, size);
+    }
+
+    static void APIENTRY clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        Shadow &shadow = get().shadow;
+        GLfloat color[4] = {red, green, blue, alpha};
+        if (shadow.clearColorKnown && memcmp(shadow.clearColor, color, sizeof(color)) == 0) {
+            elided();
+            return;
+        }
+        shadow.clearColorKnown = true;
+        memcpy(shadow.clearColor, color, sizeof(color));
+        issued();
+        get().original.clearColor(red, green, blue, alpha);
+    }
+
+    static void APIENTRY viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        Shadow &shadow = get().shadow;
+        GLint rect[4] = {x, y, width, height};
+        if (shadow.viewportKnown && memcmp(shadow.viewport, rect, sizeof(rect)) == 0) {
+            elided();
+            return;
+        }
+        shadow.viewportKnown = true;
+        memcpy(shadow.viewport, rect, sizeof(rect));
+        issued();
+        get().original.viewport(x, y, width, height);
+    }
+
+    static bool capabilityUnchanged(GLenum cap, bool enabled)
+    {
+        Shadow &shadow = get().shadow;
+        int slot = capabilitySlot(cap);
+        if (slot < 0) {
+            return false;
+        }
+        if (shadow.capabilityKnown[slot] && shadow.capability[slot] == enabled) {
+            return true;
+        }
+        shadow.capabilityKnown[slot] = true;
+        shadow.capability[slot] = enabled;
+        return false;
+    }
+
+    static void APIENTRY enable(GLenum cap)
+    {
+        if (capabilityUnchanged(cap, true)) {
+            elided();
+            return;
+        }
+        issued();
+        get().original.enable(cap);
+    }
+
+    static void APIENTRY disable(GLenum cap)
+    {
+        if (capabilityUnchanged(cap, false)) {
+            elided();
+            return;
+        }
+        issued();
+        get().original.disable(cap);
+    }
+
+    static void APIENTRY blendFunc(GLenum sfactor, GLenum dfactor)
+    {
+        Shadow &shadow = get().shadow;
+        if (shadow.blendFuncKnown && shadow.blendFunc[0] == sfactor && shadow.blendFunc[1] == dfactor) {
+            elided();
+            return;
+        }
+        shadow.blendFuncKnown = true;
+        shadow.blendFunc[0] = sfactor;
+        shadow.blendFunc[1] = dfactor;
+        issued();
+        get().original.blendFunc(sfactor, dfactor);
+    }
+
+    static void APIENTRY activeTexture(GLenum texture)
+    {
+        Shadow &shadow = get().shadow;
+        if (shadow.activeTextureKnown && shadow.activeTexture == texture) {
+            elided();
+            return;
+        }
+        shadow.activeTextureKnown = true;
+        shadow.activeTexture = texture;
+        issued();
+        get().original.activeTexture(texture);
+    }
+
+    static void APIENTRY bindTexture(GLenum target, GLuint texture)
+    {
+        Shadow &shadow = get().shadow;
+        // Only GL_TEXTURE_2D on the first units is tracked, and only once the active unit is known
+        int unit = shadow.activeTextureKnown ? (int)(shadow.activeTexture - GL_TEXTURE0) : -1;
+        if (target == GL_TEXTURE_2D && unit >= 0 && unit < TRACKED_TEXTURE_UNITS) {
+            if (shadow.textureKnown[unit] && shadow.texture2D[unit] == texture) {
+                elided();
+                return;
+            }
+            shadow.textureKnown[unit] = true;
+            shadow.texture2D[unit] = texture;
+        }
+        issued();
+        get().original.bindTexture(target, texture);
+    }
+
+    // Deleting a bound object silently rebinds 0, so the shadow has to follow
+    static void APIENTRY deleteBuffers(GLsizei n, const GLuint *buffers)
+    {
+        Shadow &shadow = get().shadow;
+        for (GLsizei i = 0; i < n; i++) {
+            for (int slot = 0; slot < BUFFER_SLOT_COUNT; slot++) {
+                if (shadow.bufferKnown[slot] && shadow.buffer[slot] == buffers[i]) {
+                    shadow.buffer[slot] = 0;
+                }
+            }
+        }
+        issued();
+        get().original.deleteBuffers(n, buffers);
+    }
+
+    static void APIENTRY deleteVertexArrays(GLsizei n, const GLuint *arrays)
+    {
+        Shadow &shadow = get().shadow;
+        for (GLsizei i = 0; i < n; i++) {
+            if (shadow.vertexArrayKnown && shadow.vertexArray == arrays[i]) {
+                shadow.vertexArray = 0;
+                shadow.bufferKnown[ELEMENT_ARRAY_BUFFER_SLOT] = false;
+            }
+        }
+        issued();
+        get().original.deleteVertexArrays(n, arrays);
+    }
+
+    static void APIENTRY deleteTextures(GLsizei n, const GLuint *textures)
+    {
+        Shadow &shadow = get().shadow;
+        for (GLsizei i = 0; i < n; i++) {
+            for (int unit = 0; unit < TRACKED_TEXTURE_UNITS; unit++) {
+                if (shadow.textureKnown[unit] && shadow.texture2D[unit] == textures[i]) {
+                    shadow.texture2D[unit] = 0;
+                }
+            }
+        }
+        issued();
+        get().original.deleteTextures(n, textures);
+    }
+};
+
+} // namespace renderer
+
+#endif
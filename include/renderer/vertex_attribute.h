@@ -0,0 +1,210 @@
+/*
+    A vertex attribute's layout and the per-value conversions behind it.
+
+    VertexAttribute is one glVertexAttribPointer. The conversions are the
+    ones GL applies to the formats of renderer/vertex_format.h: half floats
+    both ways, signed normalized 2_10_10_10 packing, and readAttribute(),
+    which fetches one attribute with GL's rules. Nothing here touches GL
+    objects, so the software rasterizer can fetch through it without
+    pulling in Mesh or Buffer.
+*/
+
+#ifndef RENDERER_VERTEX_ATTRIBUTE_H
+#define RENDERER_VERTEX_ATTRIBUTE_H
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace renderer {
+
+// One glVertexAttribPointer: location, component count and type, byte offset into a vertex;
+// a non-zero divisor advances the attribute every divisor instances (glVertexAttribDivisor)
+struct VertexAttribute {
+    unsigned int location;
+    int size;
+    GLenum type;
+    size_t offset;
+    GLboolean normalized = GL_FALSE;
+    GLuint divisor = 0;
+};
+
+/* SCALAR CONVERSIONS START HERE */
+
+// Round to nearest even, like the GPU; out of range becomes infinity
+inline uint16_t floatToHalf(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000;
+    uint32_t magnitude = bits & 0x7fffffff;
+
+    // Infinity and NaN (kept a NaN), then everything from 65520 up rounds to infinity
+    if (magnitude >= 0x7f800000) {
+        return (uint16_t)(sign | 0x7c00 | (magnitude > 0x7f800000 ? 0x200 : 0));
+    }
+    if (magnitude >= 0x477ff000) {
+        return (uint16_t)(sign | 0x7c00);
+    }
+
+    // Below 2^-14 the half is denormal: shift the mantissa, implicit bit included
+    if (magnitude < 0x38800000) {
+        if (magnitude < 0x33000000) {
+            return (uint16_t)sign;
+        }
+        uint32_t mantissa = (magnitude & 0x7fffff) | 0x800000;
+        int shift = 126 - (int)(magnitude >> 23);
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half & 1))) {
+            half++;
+        }
+        return (uint16_t)(sign | half);
+    }
+
+    // Rebias the exponent and drop 13 mantissa bits; a carry correctly bumps the exponent
+    uint32_t half = (magnitude - 0x38000000) >> 13;
+    uint32_t remainder = magnitude & 0x1fff;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) {
+        half++;
+    }
+    return (uint16_t)(sign | half);
+}
+
+inline float halfToFloat(uint16_t half)
+{
+    uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+    uint32_t exponent = (half >> 10) & 0x1f;
+    uint32_t mantissa = half & 0x3ff;
+
+    if (exponent == 0) {
+        float value = mantissa * (1.0f / 16777216.0f);
+        return sign != 0 ? -value : value;
+    }
+    uint32_t bits = exponent == 31 ? sign | 0x7f800000 | (mantissa << 13) : sign | ((exponent + 112) << 23) | (mantissa << 13);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// x, y and z in 10 bits each, w in the top 2, all signed normalized
+inline uint32_t packSnorm2101010(const float value[4])
+{
+    uint32_t packed = 0;
+    for (int c = 0; c < 4; c++) {
+        int bits = c < 3 ? 10 : 2;
+        float maximum = (float)((1 << (bits - 1)) - 1);
+        int quantized = (int)lroundf(std::min(std::max(value[c], -1.0f), 1.0f) * maximum);
+        packed |= ((uint32_t)quantized & ((1u << bits) - 1)) << (c * 10);
+    }
+    return packed;
+}
+
+// GL's rules for GL_INT_2_10_10_10_REV and GL_UNSIGNED_INT_2_10_10_10_REV
+inline void unpack2101010(uint32_t packed, bool isSigned, bool normalized, float value[4])
+{
+    for (int c = 0; c < 4; c++) {
+        int bits = c < 3 ? 10 : 2;
+        uint32_t field = (packed >> (c * 10)) & ((1u << bits) - 1);
+        if (isSigned) {
+            // Sign-extend the field
+            int signedField = (int)(field << (32 - bits)) >> (32 - bits);
+            float maximum = (float)((1 << (bits - 1)) - 1);
+            value[c] = normalized ? std::max(signedField / maximum, -1.0f) : (float)signedField;
+        } else {
+            value[c] = normalized ? field / (float)((1u << bits) - 1) : (float)field;
+        }
+    }
+}
+
+inline size_t vertexTypeSize(GLenum type)
+{
+    switch (type) {
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+        return 1;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+    case GL_HALF_FLOAT:
+        return 2;
+    default:
+        return 4;
+    }
+}
+
+// Reads one attribute the way GL's vertex fetch does: missing components are (0, 0, 0, 1)
+inline void readAttribute(const unsigned char *source, int size, GLenum type, bool normalized, float value[4])
+{
+    value[0] = 0.0f;
+    value[1] = 0.0f;
+    value[2] = 0.0f;
+    value[3] = 1.0f;
+
+    if (type == GL_INT_2_10_10_10_REV || type == GL_UNSIGNED_INT_2_10_10_10_REV) {
+        uint32_t packed;
+        memcpy(&packed, source, sizeof(packed));
+        unpack2101010(packed, type == GL_INT_2_10_10_10_REV, normalized, value);
+        return;
+    }
+
+    size_t componentSize = vertexTypeSize(type);
+    for (int c = 0; c < size && c < 4; c++) {
+        const unsigned char *component = source + c * componentSize;
+        switch (type) {
+        case GL_FLOAT:
+            memcpy(&value[c], component, sizeof(float));
+            break;
+        case GL_HALF_FLOAT: {
+            uint16_t half;
+            memcpy(&half, component, sizeof(half));
+            value[c] = halfToFloat(half);
+            break;
+        }
+        case GL_UNSIGNED_BYTE:
+            value[c] = normalized ? component[0] / 255.0f : (float)component[0];
+            break;
+        case GL_BYTE: {
+            float signedValue = (float)(signed char)component[0];
+            value[c] = normalized ? std::max(signedValue / 127.0f, -1.0f) : signedValue;
+            break;
+        }
+        case GL_UNSIGNED_SHORT: {
+            uint16_t unsignedValue;
+            memcpy(&unsignedValue, component, sizeof(unsignedValue));
+            value[c] = normalized ? unsignedValue / 65535.0f : (float)unsignedValue;
+            break;
+        }
+        case GL_SHORT: {
+            int16_t signedValue;
+            memcpy(&signedValue, component, sizeof(signedValue));
+            value[c] = normalized ? std::max(signedValue / 32767.0f, -1.0f) : (float)signedValue;
+            break;
+        }
+        case GL_UNSIGNED_INT: {
+            uint32_t unsignedValue;
+            memcpy(&unsignedValue, component, sizeof(unsignedValue));
+            value[c] = normalized ? (float)(unsignedValue / 4294967295.0) : (float)unsignedValue;
+            break;
+        }
+        case GL_INT: {
+            int32_t signedValue;
+            memcpy(&signedValue, component, sizeof(signedValue));
+            value[c] = normalized ? std::max((float)(signedValue / 2147483647.0), -1.0f) : (float)signedValue;
+            break;
+        }
+        default:
+            value[c] = 0.0f;
+        }
+    }
+}
+
+/* SCALAR CONVERSIONS END HERE */
+
+} // namespace renderer
+
+#endif
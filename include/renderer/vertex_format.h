@@ -0,0 +1,180 @@
+/*
+    Compact vertex formats and a converter from plain float layouts.
+
+    A vertex of 32-bit floats spends 12 bytes on a position and as much on a
+    colour that only ever needed 8 bits a channel. The formats here are the
+    ones GL 3.3 fetches natively, so shaders still see floats:
+      VERTEX_FORMAT_FLOAT            GL_FLOAT, unchanged
+      VERTEX_FORMAT_HALF             GL_HALF_FLOAT, 2 bytes a component
+      VERTEX_FORMAT_UNORM8           normalized GL_UNSIGNED_BYTE, for values in [0, 1]
+      VERTEX_FORMAT_SNORM_2_10_10_10 normalized GL_INT_2_10_10_10_REV, 4 bytes for
+                                     a unit vector (plus a 2-bit w, e.g. a tangent sign)
+    compactVertices() converts float vertices attribute by attribute. An
+    attribute can be quantized relative to the mesh's bounding box: the box
+    is mapped onto the format's range ([-1, 1], or [0, 1] for UNORM8) so the
+    precision goes where the mesh is, and the shader gets the value back as
+    stored * scale + bias, from the VertexDecode that comes with the result.
+    Every attribute starts on a 4-byte boundary, as GL prefers. The
+    scalar conversions, and readAttribute() for the way back, are in
+    renderer/vertex_attribute.h.
+*/
+
+#ifndef RENDERER_VERTEX_FORMAT_H
+#define RENDERER_VERTEX_FORMAT_H
+
+#include <glad/glad.h>
+
+#include "vertex_attribute.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+
+namespace renderer {
+
+enum VertexFormat {
+    VERTEX_FORMAT_FLOAT,
+    VERTEX_FORMAT_HALF,
+    VERTEX_FORMAT_UNORM8,
+    VERTEX_FORMAT_SNORM_2_10_10_10
+};
+
+// One float attribute of the source layout and the format it is stored in
+struct VertexConversion {
+    unsigned int location;
+    int size;                   // components, 1 to 4
+    size_t offset;              // byte offset into a source vertex
+    VertexFormat format;
+    bool quantizeToBounds = false;
+};
+
+// How a shader gets an attribute back: value = stored * scale + bias, per component
+struct VertexDecode {
+    float scale[4];
+    float bias[4];
+};
+
+struct CompactVertices {
+    std::vector<unsigned char> data;
+    int stride = 0;
+    std::vector<VertexAttribute> attributes;
+    std::vector<VertexDecode> decode;       // one per attribute, identity unless quantized to bounds
+
+    size_t vertexCount() const { return stride > 0 ? data.size() / stride : 0; }
+};
+
+// Bytes one attribute takes in a format, before padding to 4
+inline size_t vertexFormatSize(VertexFormat format, int size)
+{
+    switch (format) {
+    case VERTEX_FORMAT_HALF: return 2 * size;
+    case VERTEX_FORMAT_UNORM8: return size;
+    case VERTEX_FORMAT_SNORM_2_10_10_10: return 4;
+    default: return 4 * size;
+    }
+}
+
+// Converts float vertices of the given stride (bytes); attributes not listed are dropped
+inline CompactVertices compactVertices(const void *vertices, size_t vertexBytes, int stride, const VertexConversion *conversions, size_t conversionCount)
+{
+    CompactVertices result;
+    size_t vertexCount = vertexBytes / stride;
+    const unsigned char *source = (const unsigned char *)vertices;
+
+    // Lay the attributes out and work out each one's decode transform
+    std::vector<size_t> offsets;
+    for (size_t a = 0; a < conversionCount; a++) {
+        const VertexConversion &conversion = conversions[a];
+        offsets.push_back((size_t)result.stride);
+        result.stride += (int)((vertexFormatSize(conversion.format, conversion.size) + 3) & ~(size_t)3);
+
+        VertexDecode decode = {{1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f, 0.0f}};
+        if (conversion.quantizeToBounds && vertexCount > 0) {
+            for (int c = 0; c < conversion.size; c++) {
+                float lowest = INFINITY, highest = -INFINITY;
+                for (size_t v = 0; v < vertexCount; v++) {
+                    float value;
+                    memcpy(&value, source + v * stride + conversion.offset + c * sizeof(float), sizeof(value));
+                    lowest = std::min(lowest, value);
+                    highest = std::max(highest, value);
+                }
+                // [lowest, highest] onto [0, 1] for UNORM8, [-1, 1] otherwise; a flat box keeps scale 1
+                bool unsignedRange = conversion.format == VERTEX_FORMAT_UNORM8;
+                float extent = unsignedRange ? highest - lowest : (highest - lowest) / 2;
+                decode.scale[c] = extent > 0.0f ? extent : 1.0f;
+                decode.bias[c] = unsignedRange ? lowest : (lowest + highest) / 2;
+            }
+        }
+        result.decode.push_back(decode);
+
+        VertexAttribute attribute = {conversion.location, conversion.size, GL_FLOAT, offsets.back()};
+        switch (conversion.format) {
+        case VERTEX_FORMAT_HALF:
+            attribute.type = GL_HALF_FLOAT;
+            break;
+        case VERTEX_FORMAT_UNORM8:
+            attribute.type = GL_UNSIGNED_BYTE;
+            attribute.normalized = GL_TRUE;
+            break;
+        case VERTEX_FORMAT_SNORM_2_10_10_10:
+            // Packed formats are always 4 components
+            attribute.type = GL_INT_2_10_10_10_REV;
+            attribute.size = 4;
+            attribute.normalized = GL_TRUE;
+            break;
+        default:
+            break;
+        }
+        result.attributes.push_back(attribute);
+    }
+
+    result.data.assign(vertexCount * result.stride, 0);
+    for (size_t v = 0; v < vertexCount; v++) {
+        unsigned char *target = result.data.data() + v * result.stride;
+        for (size_t a = 0; a < conversionCount; a++) {
+            const VertexConversion &conversion = conversions[a];
+            const VertexDecode &decode = result.decode[a];
+            // Missing components default like GL's: (0, 0, 0, 1), so a packed w comes out as 1
+            float value[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+            memcpy(value, source + v * stride + conversion.offset, conversion.size * sizeof(float));
+            for (int c = 0; c < conversion.size; c++) {
+                value[c] = (value[c] - decode.bias[c]) / decode.scale[c];
+            }
+
+            unsigned char *out = target + offsets[a];
+            switch (conversion.format) {
+            case VERTEX_FORMAT_HALF:
+                for (int c = 0; c < conversion.size; c++) {
+                    uint16_t half = floatToHalf(value[c]);
+                    memcpy(out + c * sizeof(half), &half, sizeof(half));
+                }
+                break;
+            case VERTEX_FORMAT_UNORM8:
+                for (int c = 0; c < conversion.size; c++) {
+                    out[c] = (unsigned char)lroundf(std::min(std::max(value[c], 0.0f), 1.0f) * 255.0f);
+                }
+                break;
+            case VERTEX_FORMAT_SNORM_2_10_10_10: {
+                uint32_t packed = packSnorm2101010(value);
+                memcpy(out, &packed, sizeof(packed));
+                break;
+            }
+            default:
+                memcpy(out, value, conversion.size * sizeof(float));
+            }
+        }
+    }
+    return result;
+}
+
+inline CompactVertices compactVertices(const void *vertices, size_t vertexBytes, int stride, std::initializer_list<VertexConversion> conversions)
+{
+    return compactVertices(vertices, vertexBytes, stride, conversions.begin(), conversions.size());
+}
+
+} // namespace renderer
+
+#endif
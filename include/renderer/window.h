@@ -0,0 +1,114 @@
+/*
+    The GLFW window and GL context every sample starts with.
+
+    The constructor does what the samples used to spell out: glfwInit, a 3.3
+    core profile context, the window, glad, the viewport and a framebuffer
+    size callback that keeps the viewport in step. Check ok() before using
+    it. The destructor destroys the window and terminates GLFW, so a Window
+    has to outlive every GL object made in its context; declare it first.
+    Escape closes the window (processInput()), as in every sample.
+*/
+
+#ifndef RENDERER_WINDOW_H
+#define RENDERER_WINDOW_H
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+
+namespace renderer {
+
+class Window {
+public:
+    // A hidden window only carries the context, for offscreen and headless runs
+    Window(int width, int height, const char *title, bool visible = true)
+    {
+        glfwInit();
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+        if (!visible) {
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        }
+
+        window = glfwCreateWindow(width, height, title, NULL, NULL);
+        if (window == NULL) {
+            std::cout << "Failed to create GLFW window" << std::endl;
+            return;
+        }
+        glfwMakeContextCurrent(window);
+
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+            std::cout << "Failed to initialize GLAD" << std::endl;
+            return;
+        }
+        loaded = true;
+
+        // Set viewport and update it everytime the window is resized
+        glViewport(0, 0, width, height);
+        glfwSetFramebufferSizeCallback(window, framebufferSizeCallback);
+    }
+
+    ~Window()
+    {
+        if (owner) {
+            if (window != NULL) {
+                glfwDestroyWindow(window);
+            }
+            glfwTerminate();
+        }
+    }
+
+    Window(const Window &) = delete;
+    Window &operator=(const Window &) = delete;
+
+    Window(Window &&other) noexcept
+        : window(other.window), loaded(other.loaded), owner(other.owner)
+    {
+        other.window = NULL;
+        other.loaded = false;
+        other.owner = false;
+    }
+
+    // The context and GL functions are usable
+    bool ok() const { return loaded; }
+    GLFWwindow *handle() const { return window; }
+
+    bool shouldClose() const { return glfwWindowShouldClose(window); }
+    void close() { glfwSetWindowShouldClose(window, true); }
+
+    // Checks for escape and closes window
+    void processInput()
+    {
+        if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+            glfwSetWindowShouldClose(window, true);
+        }
+    }
+
+    void swapBuffers() { glfwSwapBuffers(window); }
+
+    // Poll IO events (keys pressed/released, mouse moved etc.)
+    void pollEvents() { glfwPollEvents(); }
+
+    // Seconds since glfwInit
+    double time() const { return glfwGetTime(); }
+
+private:
+    // Updates viewport after resizing window
+    static void framebufferSizeCallback(GLFWwindow *window, int width, int height)
+    {
+        glViewport(0, 0, width, height);
+    }
+
+    GLFWwindow *window = NULL;
+    bool loaded = false;
+    bool owner = true;
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,158 @@
+/*
+    Fixed-size pool of worker threads used by the CPU-side renderer code.
+
+    parallelFor() hands out job indices through an atomic counter and the
+    calling thread works alongside the pool, so a pool of N threads has N - 1
+    background workers. Jobs are picked up in any order: callers that need a
+    deterministic result must write each job's output to its own slot.
+*/
+
+#ifndef RENDERER_WORKER_POOL_H
+#define RENDERER_WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace renderer {
+
+class WorkerPool {
+public:
+    // threadCount == 0 uses every hardware thread
+    explicit WorkerPool(unsigned int threadCount = 0)
+    {
+        if (threadCount == 0) {
+            threadCount = std::thread::hardware_concurrency();
+        }
+        if (threadCount == 0) {
+            threadCount = 1;
+        }
+
+        // Worker 0 is always the thread calling parallelFor()
+        for (unsigned int i = 1; i < threadCount; i++) {
+            threads.emplace_back(&WorkerPool::workerLoop, this, i);
+        }
+    }
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        wake.notify_all();
+
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+    }
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // Number of threads taking part in parallelFor(), including the caller
+    unsigned int size() const
+    {
+        return (unsigned int)threads.size() + 1;
+    }
+
+    // Calls fn(job, worker) for every job in [0, jobCount) and returns once all of them are done
+    template<class Function>
+    void parallelFor(unsigned int jobCount, Function &&fn)
+    {
+        if (jobCount == 0) {
+            return;
+        }
+
+        // Nothing to gain from waking the pool for a single job
+        if (jobCount == 1 || threads.empty()) {
+            for (unsigned int job = 0; job < jobCount; job++) {
+                fn(job, 0u);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = &invokeTask<Function>;
+            taskContext = &fn;
+            taskJobCount = jobCount;
+            nextJob.store(0, std::memory_order_relaxed);
+            busyWorkers = (unsigned int)threads.size();
+            generation++;
+        }
+        wake.notify_all();
+
+        runJobs(0);
+
+        // Wait for the background workers to drain the remaining jobs
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return busyWorkers == 0; });
+        task = nullptr;
+        taskContext = nullptr;
+    }
+
+private:
+    typedef void (*TaskFunction)(void *context, unsigned int job, unsigned int worker);
+
+    template<class Function>
+    static void invokeTask(void *context, unsigned int job, unsigned int worker)
+    {
+        (*static_cast<typename std::remove_reference<Function>::type *>(context))(job, worker);
+    }
+
+    void runJobs(unsigned int worker)
+    {
+        for (;;) {
+            unsigned int job = nextJob.fetch_add(1, std::memory_order_relaxed);
+            if (job >= taskJobCount) {
+                break;
+            }
+            task(taskContext, job, worker);
+        }
+    }
+
+    void workerLoop(unsigned int worker)
+    {
+        unsigned long long seenGeneration = 0;
+
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return quit || generation != seenGeneration; });
+                if (quit) {
+                    return;
+                }
+                seenGeneration = generation;
+            }
+
+            runJobs(worker);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                busyWorkers--;
+            }
+            done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+
+    TaskFunction task = nullptr;
+    void *taskContext = nullptr;
+    unsigned int taskJobCount = 0;
+    std::atomic<unsigned int> nextJob{0};
+    unsigned int busyWorkers = 0;
+    unsigned long long generation = 0;
+    bool quit = false;
+};
+
+} // namespace renderer
+
+#endif
@@ -0,0 +1,216 @@
+/*
+    State changes per frame with and without sorting the command buffer.
+    Records a grid of small triangles (10000 by default) spread over 8 programs and 16 VAOs
+    in scattered order and submits it to the software rasterizer once as recorded and once
+    sorted by key. The triangles don't overlap, so both orders must give the same image.
+    First checks the keys of depths 0, 0.5 and 1 in both opaque and translucent mode.
+    Usage: bench_commands [draws] [frames] [threads]
+*/
+
+#include <renderer/command_buffer.h>
+#include <renderer/software_rasterizer.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace renderer;
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+const int PROGRAM_COUNT = 8;
+const int VAO_COUNT = 16;
+
+/* SHADERS START HERE */
+
+void gridVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    out.position = {in.attribs[0][0], in.attribs[0][1], 0.0f, 1.0f};
+}
+
+// One flat colour per program
+template <int N>
+void gridFragmentShader(const float *varyings, float color[4], const void *uniforms)
+{
+    color[0] = (N & 1) ? 1.0f : 0.2f;
+    color[1] = (N & 2) ? 1.0f : 0.2f;
+    color[2] = (N & 4) ? 1.0f : 0.2f;
+    color[3] = 1.0f;
+}
+
+template <int N>
+void gridFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = (N & 1) ? 1.0f : 0.2f;
+        span.color[1][lane] = (N & 2) ? 1.0f : 0.2f;
+        span.color[2][lane] = (N & 4) ? 1.0f : 0.2f;
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+template <int N>
+SwProgram gridProgram()
+{
+    return SwProgram{gridVertexShader, gridFragmentShader<N>, 0, gridFragmentShaderSpan<N>};
+}
+
+/* SHADERS END HERE */
+
+// What one frame cost, on average
+struct FrameResult {
+    CommandStats stats;
+    double recordMilliseconds;
+    double sortMilliseconds;
+    double submitMilliseconds;
+    unsigned long long checksum;
+};
+
+FrameResult run(SoftwareRasterizer &raster, CommandBuffer &commands, const std::vector<unsigned int> &programs,
+                const std::vector<unsigned int> &VAOs, int draws, int frames, bool sorted)
+{
+    FrameResult result = {{0, 0, 0, 0}, 0.0, 0.0, 0.0, 0};
+    DeviceBackend<SoftwareRasterizer> backend = {raster};
+
+    for (int frame = 0; frame < frames; frame++) {
+        raster.clear(GL_COLOR_BUFFER_BIT);
+
+        auto start = std::chrono::steady_clock::now();
+        commands.clear();
+        for (int cell = 0; cell < draws; cell++) {
+            // Scatter programs and VAOs so neighbouring draws rarely share state
+            unsigned int scramble = (unsigned int)cell * 2654435761u;
+            unsigned int program = programs[(scramble >> 13) % PROGRAM_COUNT];
+            unsigned int VAO = VAOs[(scramble >> 7) % VAO_COUNT];
+            commands.drawArrays(program, VAO, GL_TRIANGLES, cell * 3, 3, (float)cell / draws);
+        }
+        auto recorded = std::chrono::steady_clock::now();
+
+        if (sorted) {
+            commands.sort();
+        }
+        auto sortedAt = std::chrono::steady_clock::now();
+
+        result.stats = commands.submit(backend);
+        raster.finish();
+        auto submitted = std::chrono::steady_clock::now();
+
+        result.recordMilliseconds += std::chrono::duration<double, std::milli>(recorded - start).count();
+        result.sortMilliseconds += std::chrono::duration<double, std::milli>(sortedAt - recorded).count();
+        result.submitMilliseconds += std::chrono::duration<double, std::milli>(submitted - sortedAt).count();
+    }
+
+    result.recordMilliseconds /= frames;
+    result.sortMilliseconds /= frames;
+    result.submitMilliseconds /= frames;
+
+    const uint32_t *pixels = raster.pixels();
+    result.checksum = 1469598103934665603ULL;
+    for (unsigned int i = 0; i < SCR_WIDTH * SCR_HEIGHT; i++) {
+        result.checksum = (result.checksum ^ pixels[i]) * 1099511628211ULL;
+    }
+    return result;
+}
+
+// Depths 0, 0.5 and 1 must keep program and VAO intact and order front to back (opaque)
+// or back to front (translucent)
+bool checkKeys()
+{
+    const float depths[] = {0.0f, 0.5f, 1.0f};
+    bool ok = true;
+    for (int blend = 0; blend < 2; blend++) {
+        uint64_t previous = 0;
+        for (int i = 0; i < 3; i++) {
+            uint64_t key = CommandBuffer::makeKey(1, 1, depths[i], blend != 0);
+            unsigned int program = (unsigned int)(key >> (blend ? 27 : 51)) & ((1u << CommandBuffer::PROGRAM_BITS) - 1);
+            unsigned int vertexArray = (unsigned int)(key >> (blend ? 11 : 35)) & ((1u << CommandBuffer::VERTEX_ARRAY_BITS) - 1);
+            bool ordered = i == 0 || (blend ? key < previous : key > previous);
+            if (program != 1 || vertexArray != 1 || (key >> 63) != (uint64_t)blend || !ordered) {
+                std::cout << "ERROR::BENCH::BAD_KEY " << (blend ? "translucent" : "opaque") << " depth " << depths[i]
+                          << ": " << std::hex << key << std::dec << std::endl;
+                ok = false;
+            }
+            previous = key;
+        }
+    }
+    return ok;
+}
+
+void report(const char *name, const FrameResult &result)
+{
+    std::cout << name << ": " << result.stats.draws << " draws, " << result.stats.programChanges << " program changes, "
+              << result.stats.vertexArrayChanges << " VAO changes per frame; record " << result.recordMilliseconds << " ms, sort "
+              << result.sortMilliseconds << " ms, submit+raster " << result.submitMilliseconds << " ms" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    int draws = argc > 1 ? atoi(argv[1]) : 10000;
+    int frames = argc > 2 ? atoi(argv[2]) : 50;
+    unsigned int threads = argc > 3 ? (unsigned int)atoi(argv[3]) : 0;
+
+    if (!checkKeys()) {
+        return 1;
+    }
+
+    SoftwareRasterizer raster(SCR_WIDTH, SCR_HEIGHT, threads);
+    raster.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+
+    std::vector<unsigned int> programs = {
+        raster.createProgram(gridProgram<0>()), raster.createProgram(gridProgram<1>()),
+        raster.createProgram(gridProgram<2>()), raster.createProgram(gridProgram<3>()),
+        raster.createProgram(gridProgram<4>()), raster.createProgram(gridProgram<5>()),
+        raster.createProgram(gridProgram<6>()), raster.createProgram(gridProgram<7>())
+    };
+
+    /* GEOMETRY STARTS HERE */
+
+    // One triangle per grid cell, in NDC
+    int columns = 1;
+    while (columns * columns < draws) {
+        columns++;
+    }
+    std::vector<float> vertices;
+    vertices.reserve(draws * 6);
+    for (int cell = 0; cell < draws; cell++) {
+        float x0 = -1.0f + 2.0f * (cell % columns) / columns;
+        float y0 = -1.0f + 2.0f * (cell / columns) / columns;
+        float size = 1.8f / columns;
+        float triangle[] = {x0, y0, x0 + size, y0, x0, y0 + size};
+        vertices.insert(vertices.end(), triangle, triangle + 6);
+    }
+
+    // Every VAO sees the whole grid, so any VAO can draw any cell
+    std::vector<unsigned int> VAOs(VAO_COUNT), VBOs(VAO_COUNT);
+    raster.genVertexArrays(VAO_COUNT, VAOs.data());
+    raster.genBuffers(VAO_COUNT, VBOs.data());
+    for (int i = 0; i < VAO_COUNT; i++) {
+        raster.bindVertexArray(VAOs[i]);
+        raster.bindBuffer(GL_ARRAY_BUFFER, VBOs[i]);
+        raster.bufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+        raster.vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        raster.enableVertexAttribArray(0);
+    }
+    raster.bindVertexArray(0);
+
+    /* GEOMETRY ENDS HERE */
+
+    CommandBuffer commands;
+    commands.reserve(draws);
+
+    std::cout << "threads: " << raster.threadCount() << ", frames: " << frames << std::endl;
+    FrameResult unsorted = run(raster, commands, programs, VAOs, draws, frames, false);
+    FrameResult sorted = run(raster, commands, programs, VAOs, draws, frames, true);
+    report("submission order", unsorted);
+    report("sorted by key   ", sorted);
+    if (sorted.checksum != unsorted.checksum) {
+        std::cout << "ERROR::BENCH::OUTPUT_DIFFERS sorted and unsorted frames don't match" << std::endl;
+        return 1;
+    }
+
+    raster.deleteVertexArrays(VAO_COUNT, VAOs.data());
+    raster.deleteBuffers(VAO_COUNT, VBOs.data());
+    return 0;
+}
@@ -0,0 +1,193 @@
+/*
+    Instanced draws against the same geometry expanded into one vertex buffer.
+    Builds instancing.cpp's stress grid (one small triangle per cell, a per-instance offset and
+    colour) and draws it on the software rasterizer twice: once with drawArraysInstanced and
+    the offset and colour advancing per instance (glVertexAttribDivisor), once with every
+    instance's three vertices written out and a plain drawArrays. Reports ms/frame and the
+    vertex buffer bytes of both; the two images must be pixel-identical.
+    Usage: bench_instancing [instances] [frames] [threads]
+*/
+
+#include <renderer/hash.h>
+#include <renderer/software_rasterizer.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace renderer;
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+/* SHADERS START HERE */
+
+// instancing.cpp's shader: aPos.xy * scale + aOffset, colour passed through
+void instanceVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    float scale = *(const float *)uniforms;
+    out.position = {in.attribs[0][0] * scale + in.attribs[1][0], in.attribs[0][1] * scale + in.attribs[1][1], in.attribs[0][2], 1.0f};
+    out.varyings[0] = in.attribs[2][0];
+    out.varyings[1] = in.attribs[2][1];
+    out.varyings[2] = in.attribs[2][2];
+}
+
+void colorFragmentShader(const float *ourColor, float color[4], const void *uniforms)
+{
+    color[0] = ourColor[0];
+    color[1] = ourColor[1];
+    color[2] = ourColor[2];
+    color[3] = 1.0f;
+}
+
+void colorFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = span.varyings[0][lane];
+        span.color[1][lane] = span.varyings[1][lane];
+        span.color[2][lane] = span.varyings[2][lane];
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+/* SHADERS END HERE */
+
+struct RunResult {
+    double milliseconds;
+    unsigned long long checksum;
+};
+
+// Draws the bound VAO for the given number of frames; instances 0 means a plain drawArrays of count vertices
+RunResult run(SoftwareRasterizer &raster, int count, int instances, int frames)
+{
+    raster.clear(GL_COLOR_BUFFER_BIT);
+    raster.finish();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        raster.clear(GL_COLOR_BUFFER_BIT);
+        if (instances > 0) {
+            raster.drawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+        } else {
+            raster.drawArrays(GL_TRIANGLES, 0, count);
+        }
+        raster.finish();
+    }
+
+    RunResult result;
+    result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+    const uint32_t *pixels = raster.pixels();
+    result.checksum = FNV_OFFSET_BASIS;
+    for (unsigned int i = 0; i < SCR_WIDTH * SCR_HEIGHT; i++) {
+        result.checksum = (result.checksum ^ pixels[i]) * FNV_PRIME;
+    }
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    int instanceCount = argc > 1 ? atoi(argv[1]) : 1000000;
+    int frames = argc > 2 ? atoi(argv[2]) : 10;
+    unsigned int threads = argc > 3 ? (unsigned int)atoi(argv[3]) : 0;
+    if (instanceCount < 1) {
+        instanceCount = 1;
+    }
+    if (frames < 1) {
+        frames = 1;
+    }
+
+    /* GEOMETRY STARTS HERE */
+
+    // instancing.cpp's shape and stress grid: offset (x, y) and colour (r, g, b) per instance
+    const float triangle[] = {
+        -0.375f, -0.5f, 0.0f,
+         0.375f, -0.5f, 0.0f,
+         0.0f,    0.5f, 0.0f
+    };
+    int columns = 1;
+    while (columns * columns < instanceCount) {
+        columns++;
+    }
+    float scale = 1.0f / columns;
+    std::vector<float> instances;
+    instances.reserve((size_t)instanceCount * 5);
+    for (int i = 0; i < instanceCount; i++) {
+        int column = i % columns, row = i / columns;
+        instances.push_back(-1.0f + (2.0f * column + 1.0f) / columns);
+        instances.push_back(-1.0f + (2.0f * row + 1.0f) / columns);
+        instances.push_back((float)column / columns);
+        instances.push_back((float)row / columns);
+        instances.push_back(0.5f);
+    }
+
+    // Expanded: every vertex carries its instance's offset and colour
+    std::vector<float> expanded;
+    expanded.reserve((size_t)instanceCount * 3 * 8);
+    for (int i = 0; i < instanceCount; i++) {
+        for (int v = 0; v < 3; v++) {
+            expanded.insert(expanded.end(), triangle + v * 3, triangle + v * 3 + 3);
+            expanded.insert(expanded.end(), instances.begin() + i * 5, instances.begin() + i * 5 + 5);
+        }
+    }
+
+    /* GEOMETRY ENDS HERE */
+
+    SoftwareRasterizer raster(SCR_WIDTH, SCR_HEIGHT, threads);
+    raster.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    unsigned int program = raster.createProgram({instanceVertexShader, colorFragmentShader, 3, colorFragmentShaderSpan});
+    raster.useProgram(program);
+    raster.setUniforms(&scale, sizeof(scale));
+
+    unsigned int VAOs[2], VBOs[3];
+    raster.genVertexArrays(2, VAOs);
+    raster.genBuffers(3, VBOs);
+
+    // Instanced: the shape per vertex, offset and colour per instance
+    raster.bindVertexArray(VAOs[0]);
+    raster.bindBuffer(GL_ARRAY_BUFFER, VBOs[0]);
+    raster.bufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+    raster.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    raster.enableVertexAttribArray(0);
+    raster.bindBuffer(GL_ARRAY_BUFFER, VBOs[1]);
+    raster.bufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(float), instances.data(), GL_STATIC_DRAW);
+    raster.vertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    raster.enableVertexAttribArray(1);
+    raster.vertexAttribDivisor(1, 1);
+    raster.vertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(2 * sizeof(float)));
+    raster.enableVertexAttribArray(2);
+    raster.vertexAttribDivisor(2, 1);
+
+    // Expanded: all three attributes per vertex
+    raster.bindVertexArray(VAOs[1]);
+    raster.bindBuffer(GL_ARRAY_BUFFER, VBOs[2]);
+    raster.bufferData(GL_ARRAY_BUFFER, expanded.size() * sizeof(float), expanded.data(), GL_STATIC_DRAW);
+    raster.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+    raster.enableVertexAttribArray(0);
+    raster.vertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
+    raster.enableVertexAttribArray(1);
+    raster.vertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(5 * sizeof(float)));
+    raster.enableVertexAttribArray(2);
+
+    std::cout << "threads: " << raster.threadCount() << ", frames: " << frames << ", instances: " << instanceCount << std::endl;
+
+    raster.bindVertexArray(VAOs[0]);
+    RunResult instanced = run(raster, 3, instanceCount, frames);
+    raster.bindVertexArray(VAOs[1]);
+    RunResult plain = run(raster, instanceCount * 3, 0, frames);
+
+    std::cout << "instanced: " << instanced.milliseconds << " ms/frame, " << (sizeof(triangle) + instances.size() * sizeof(float)) / 1024.0 << " KB of vertex data" << std::endl;
+    std::cout << "expanded:  " << plain.milliseconds << " ms/frame, " << expanded.size() * sizeof(float) / 1024.0 << " KB of vertex data" << std::endl;
+
+    raster.bindVertexArray(0);
+    raster.deleteVertexArrays(2, VAOs);
+    raster.deleteBuffers(3, VBOs);
+    raster.deleteProgram(program);
+
+    if (instanced.checksum != plain.checksum) {
+        std::cout << "ERROR::BENCH::OUTPUT_DIFFERS instanced and expanded frames don't match" << std::endl;
+        return 1;
+    }
+    std::cout << "instanced and expanded frames are pixel-identical" << std::endl;
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+    gladLoadGLLoader (eager) vs gladLoadGLLoaderLazy startup cost, without a GL driver.
+    A stub loader stands in for glfwGetProcAddress: it reports a GL 3.3 context, looks every
+    name up in a hash table the way a driver's dispatch lookup does, and can add a fixed
+    delay per lookup to model slower platforms (wglGetProcAddress is in the microseconds).
+    The lazy run then calls the entry points a sample program actually uses, so the
+    first-call resolutions are part of its total. The stub also reports a few hundred
+    extensions, like a desktop driver, to time gladHasExtension against that table.
+    Usage: bench_loader [iterations] [lookup nanoseconds]
+*/
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* STUB DRIVER STARTS HERE */
+
+static unsigned long long lookups = 0;
+static long long lookupNanoseconds = 0;
+
+// The three glad checks for, padded with made-up names to a typical desktop count
+static const int STUB_EXTENSION_COUNT = 300;
+static std::vector<std::string> stubExtensions;
+
+static void createStubExtensions()
+{
+    stubExtensions = {"GL_ARB_buffer_storage", "GL_ARB_get_program_binary", "GL_KHR_parallel_shader_compile"};
+    for (int i = (int)stubExtensions.size(); i < STUB_EXTENSION_COUNT; i++) {
+        stubExtensions.push_back("GL_STUB_vendor_extension_" + std::to_string(i));
+    }
+}
+
+static const GLubyte *APIENTRY stubGetString(GLenum name)
+{
+    return (const GLubyte *)(name == GL_VERSION ? "3.3.0 stub" : "stub");
+}
+
+static const GLubyte *APIENTRY stubGetStringi(GLenum name, GLuint index)
+{
+    return (const GLubyte *)(index < stubExtensions.size() ? stubExtensions[index].c_str() : "");
+}
+
+static void APIENTRY stubGetIntegerv(GLenum pname, GLint *data)
+{
+    *data = pname == GL_NUM_EXTENSIONS ? (GLint)stubExtensions.size() : 0;
+}
+
+// The calls a sample's render loop makes; each has its real signature, since they get called
+static void APIENTRY stubClearColor(GLfloat, GLfloat, GLfloat, GLfloat) {}
+static void APIENTRY stubClear(GLbitfield) {}
+static void APIENTRY stubViewport(GLint, GLint, GLsizei, GLsizei) {}
+static void APIENTRY stubUseProgram(GLuint) {}
+static void APIENTRY stubBindVertexArray(GLuint) {}
+static void APIENTRY stubDrawArrays(GLenum, GLint, GLsizei) {}
+
+// Everything else resolves to this and is never called
+static void APIENTRY stubUnused(void) {}
+
+static void *stubGetProcAddress(const char *name)
+{
+    static const std::unordered_map<std::string, void *> entryPoints = {
+        {"glGetString", (void *)&stubGetString},
+        {"glGetStringi", (void *)&stubGetStringi},
+        {"glGetIntegerv", (void *)&stubGetIntegerv},
+        {"glClearColor", (void *)&stubClearColor},
+        {"glClear", (void *)&stubClear},
+        {"glViewport", (void *)&stubViewport},
+        {"glUseProgram", (void *)&stubUseProgram},
+        {"glBindVertexArray", (void *)&stubBindVertexArray},
+        {"glDrawArrays", (void *)&stubDrawArrays}
+    };
+
+    lookups++;
+    if (lookupNanoseconds > 0) {
+        auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(lookupNanoseconds);
+        while (std::chrono::steady_clock::now() < until) {
+        }
+    }
+
+    auto entry = entryPoints.find(name);
+    return entry != entryPoints.end() ? entry->second : (void *)&stubUnused;
+}
+
+/* STUB DRIVER ENDS HERE */
+
+// What main.cpp calls from startup to its first frame
+static void firstFrame()
+{
+    glViewport(0, 0, 800, 600);
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(1);
+    glBindVertexArray(1);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : 1000;
+    lookupNanoseconds = argc > 2 ? atoll(argv[2]) : 0;
+    if (iterations < 1) {
+        iterations = 1;
+    }
+    createStubExtensions();
+
+    const char *names[] = {"eager", "lazy"};
+    for (int lazy = 0; lazy < 2; lazy++) {
+        lookups = 0;
+        double loadMicroseconds = 0.0, firstFrameMicroseconds = 0.0;
+
+        for (int i = 0; i < iterations; i++) {
+            auto start = std::chrono::steady_clock::now();
+            int loaded = lazy ? gladLoadGLLoaderLazy((GLADloadproc)stubGetProcAddress) : gladLoadGLLoader((GLADloadproc)stubGetProcAddress);
+            auto afterLoad = std::chrono::steady_clock::now();
+            firstFrame();
+            auto afterFrame = std::chrono::steady_clock::now();
+
+            if (!loaded) {
+                std::cout << "Failed to initialize GLAD" << std::endl;
+                return 1;
+            }
+            loadMicroseconds += std::chrono::duration<double, std::micro>(afterLoad - start).count();
+            firstFrameMicroseconds += std::chrono::duration<double, std::micro>(afterFrame - afterLoad).count();
+        }
+
+        std::cout << names[lazy] << ": load " << loadMicroseconds / iterations << " us, first frame "
+                  << firstFrameMicroseconds / iterations << " us, " << lookups / iterations << " lookups per startup" << std::endl;
+    }
+
+    // Runtime feature checks: half hits, half misses
+    const char *queries[] = {"GL_ARB_buffer_storage", "GL_ARB_bindless_texture", "GL_STUB_vendor_extension_250", "GL_NV_mesh_shader"};
+    const int queryCount = 1000000;
+    int found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < queryCount; i++) {
+        found += gladHasExtension(queries[i & 3]);
+    }
+    double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / queryCount;
+    std::cout << "gladHasExtension over " << stubExtensions.size() << " extensions: " << nanoseconds << " ns per query ("
+              << found << " hits)" << std::endl;
+    return 0;
+}
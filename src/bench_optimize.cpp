@@ -0,0 +1,246 @@
+/*
+    Index buffer optimization (renderer/mesh_optimizer.h) on a mesh in imported order.
+    Builds a torus as triangle soup, shuffles the triangles the way an exporter without any
+    ordering might hand them over, and welds it (renderer/mesh_builder.h). The optimizer's
+    passes then run one after another: vertex cache, overdraw, vertex fetch. For each
+    stage, and for the torus in its authored row-by-row order, reports
+      - ACMR and ATVR of a 16 and a 32 entry FIFO post-transform cache
+      - vertex fetch overfetch through a 16 KB cache of 64-byte lines
+      - overdraw with early-z, seen from the six axis directions
+      - the software rasterizer's ms/frame and vertex shader runs per frame
+    The rasterizer has no depth test, so it shades every fragment whatever the order: its
+    frame time shows the vertex cache and fetch passes only, and the overdraw figure is
+    what a depth-tested GPU would save. It draws a silhouette, the same image in any
+    triangle order, which is checked across stages.
+    Usage: bench_optimize [torus segments] [frames] [threads]
+*/
+
+#include <renderer/mesh_builder.h>
+#include <renderer/mesh_optimizer.h>
+#include <renderer/software_rasterizer.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace renderer;
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+/* SHADERS START HERE */
+
+struct TorusUniforms {
+    float rotation[9];
+};
+
+// Rotated so the torus covers itself, lit by the normal
+void torusVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    const float *m = ((const TorusUniforms *)uniforms)->rotation;
+    const float *p = in.attribs[0], *n = in.attribs[1];
+    float x = m[0] * p[0] + m[1] * p[1] + m[2] * p[2];
+    float y = m[3] * p[0] + m[4] * p[1] + m[5] * p[2];
+    float z = m[6] * p[0] + m[7] * p[1] + m[8] * p[2];
+    out.position = {x * 0.5f, y * 0.66f, z * 0.25f, 1.0f};
+    out.varyings[0] = 0.2f + 0.8f * std::max(-(m[6] * n[0] + m[7] * n[1] + m[8] * n[2]), 0.0f);
+}
+
+// Flat, so overlapping triangles leave the same pixels in any order
+void silhouetteFragmentShader(const float *varyings, float color[4], const void *uniforms)
+{
+    color[0] = 1.0f;
+    color[1] = 0.8f;
+    color[2] = 0.6f;
+    color[3] = 1.0f;
+}
+
+void silhouetteFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = 1.0f;
+        span.color[1][lane] = 0.8f;
+        span.color[2][lane] = 0.6f;
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+/* SHADERS END HERE */
+
+struct TorusVertex {
+    float position[3];
+    float normal[3];
+};
+
+// A torus of radii 1 and 0.4 as triangle soup, row by row around the tube
+std::vector<TorusVertex> buildTorusSoup(int segments)
+{
+    int sides = segments / 2;
+    auto vertex = [&](int segment, int side) {
+        const float PI = 3.14159265358979f;
+        float u = 2.0f * PI * (segment % segments) / segments, v = 2.0f * PI * (side % sides) / sides;
+        TorusVertex t;
+        t.normal[0] = cosf(v) * cosf(u);
+        t.normal[1] = cosf(v) * sinf(u);
+        t.normal[2] = sinf(v);
+        t.position[0] = cosf(u) + 0.4f * t.normal[0];
+        t.position[1] = sinf(u) + 0.4f * t.normal[1];
+        t.position[2] = 0.4f * t.normal[2];
+        return t;
+    };
+
+    std::vector<TorusVertex> soup;
+    soup.reserve((size_t)segments * sides * 6);
+    for (int segment = 0; segment < segments; segment++) {
+        for (int side = 0; side < sides; side++) {
+            TorusVertex quad[] = {vertex(segment, side), vertex(segment + 1, side), vertex(segment + 1, side + 1), vertex(segment, side + 1)};
+            TorusVertex triangles[] = {quad[0], quad[1], quad[3], quad[1], quad[2], quad[3]};
+            soup.insert(soup.end(), triangles, triangles + 6);
+        }
+    }
+    return soup;
+}
+
+struct Stage {
+    const char *name;
+    std::vector<uint32_t> indices;
+    std::vector<unsigned char> vertices;
+    double optimizeMilliseconds;
+};
+
+Stage weld(const char *name, const std::vector<TorusVertex> &soup)
+{
+    MeshBuilder builder(sizeof(TorusVertex), soup.size() / 4);
+    builder.addVertices(soup.data(), soup.size() * sizeof(TorusVertex));
+    return Stage{name, builder.indices(), std::vector<unsigned char>(builder.vertices(), builder.vertices() + builder.vertexBytes()), 0.0};
+}
+
+// Runs one pass on a copy of the previous stage and times it
+template <typename Pass>
+Stage optimize(const char *name, const Stage &previous, Pass pass)
+{
+    Stage stage{name, previous.indices, previous.vertices, 0.0};
+    auto start = std::chrono::steady_clock::now();
+    pass(stage);
+    stage.optimizeMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return stage;
+}
+
+// Milliseconds per frame; shaded is the number of vertex shader runs per frame
+double run(SoftwareRasterizer &raster, const Stage &stage, int frames, unsigned long long &shaded, unsigned long long &checksum)
+{
+    unsigned int VAO, buffers[2];
+    raster.genVertexArrays(1, &VAO);
+    raster.genBuffers(2, buffers);
+    raster.bindVertexArray(VAO);
+    raster.bindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+    raster.bufferData(GL_ARRAY_BUFFER, stage.vertices.size(), stage.vertices.data(), GL_STATIC_DRAW);
+    raster.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+    raster.bufferData(GL_ELEMENT_ARRAY_BUFFER, stage.indices.size() * sizeof(uint32_t), stage.indices.data(), GL_STATIC_DRAW);
+    raster.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(TorusVertex), (void*)0);
+    raster.enableVertexAttribArray(0);
+    raster.vertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(TorusVertex), (void*)(3 * sizeof(float)));
+    raster.enableVertexAttribArray(1);
+
+    raster.clear(GL_COLOR_BUFFER_BIT);
+    raster.finish();
+    raster.resetStats();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        raster.clear(GL_COLOR_BUFFER_BIT);
+        raster.drawElements(GL_TRIANGLES, (int)stage.indices.size(), GL_UNSIGNED_INT, 0);
+        raster.finish();
+    }
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+    shaded = raster.stats().vertices / frames;
+
+    const uint32_t *pixels = raster.pixels();
+    checksum = FNV_OFFSET_BASIS;
+    for (unsigned int i = 0; i < SCR_WIDTH * SCR_HEIGHT; i++) {
+        checksum = (checksum ^ pixels[i]) * FNV_PRIME;
+    }
+
+    raster.bindVertexArray(0);
+    raster.deleteVertexArrays(1, &VAO);
+    raster.deleteBuffers(2, buffers);
+    return milliseconds;
+}
+
+int main(int argc, char **argv)
+{
+    int segments = argc > 1 ? atoi(argv[1]) : 1024;
+    int frames = argc > 2 ? atoi(argv[2]) : 10;
+    unsigned int threads = argc > 3 ? (unsigned int)atoi(argv[3]) : 0;
+
+    std::vector<TorusVertex> soup = buildTorusSoup(segments);
+    size_t triangleCount = soup.size() / 3;
+
+    // Fixed seed: the same "import" every run
+    std::vector<TorusVertex> shuffled(soup.size());
+    std::vector<size_t> order(triangleCount);
+    for (size_t t = 0; t < triangleCount; t++) {
+        order[t] = t;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(12345));
+    for (size_t t = 0; t < triangleCount; t++) {
+        std::copy(soup.begin() + order[t] * 3, soup.begin() + order[t] * 3 + 3, shuffled.begin() + t * 3);
+    }
+
+    std::vector<Stage> stages;
+    stages.push_back(weld("authored      ", soup));
+    stages.push_back(weld("shuffled      ", shuffled));
+    stages.push_back(optimize("+ vertex cache", stages.back(), [](Stage &stage) {
+        optimizeVertexCache(stage.indices);
+    }));
+    stages.push_back(optimize("+ overdraw    ", stages.back(), [](Stage &stage) {
+        optimizeOverdraw(stage.indices, stage.vertices.data(), sizeof(TorusVertex), 0);
+    }));
+    stages.push_back(optimize("+ vertex fetch", stages.back(), [](Stage &stage) {
+        optimizeVertexFetch(stage.indices, stage.vertices, sizeof(TorusVertex));
+    }));
+
+    SoftwareRasterizer raster(SCR_WIDTH, SCR_HEIGHT, threads);
+    raster.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    unsigned int program = raster.createProgram({torusVertexShader, silhouetteFragmentShader, 1, silhouetteFragmentShaderSpan});
+    raster.useProgram(program);
+    // Tilted 60 degrees about x, so the near side of the ring hides part of the far side
+    TorusUniforms uniforms = {{1.0f, 0.0f, 0.0f, 0.0f, 0.5f, -0.866f, 0.0f, 0.866f, 0.5f}};
+    raster.setUniforms(&uniforms, sizeof(uniforms));
+
+    std::cout << "torus, " << segments << " segments: " << triangleCount << " triangles, " << stages[0].vertices.size() / sizeof(TorusVertex)
+              << " vertices; threads: " << raster.threadCount() << ", frames: " << frames << std::endl;
+
+    bool matched = true;
+    unsigned long long firstChecksum = 0;
+    for (size_t s = 0; s < stages.size(); s++) {
+        const Stage &stage = stages[s];
+        VertexCacheStats cache16 = analyzeVertexCache(stage.indices, 16);
+        VertexCacheStats cache32 = analyzeVertexCache(stage.indices, 32);
+        VertexFetchStats fetch = analyzeVertexFetch(stage.indices, sizeof(TorusVertex));
+        OverdrawStats overdraw = analyzeOverdraw(stage.indices, stage.vertices.data(), sizeof(TorusVertex), 0);
+
+        unsigned long long shaded, checksum;
+        double milliseconds = run(raster, stage, frames, shaded, checksum);
+        std::cout << stage.name << ": ACMR " << cache16.acmr << " / " << cache32.acmr << ", ATVR " << cache16.atvr << " / " << cache32.atvr
+                  << " (16 / 32 entries), overfetch " << fetch.overfetch << ", overdraw " << overdraw.overdraw;
+        if (stage.optimizeMilliseconds > 0.0) {
+            std::cout << ", pass took " << stage.optimizeMilliseconds << " ms";
+        }
+        std::cout << std::endl << "                  rasterizer: " << milliseconds << " ms/frame, " << shaded << " vertex shader runs ("
+                  << (double)shaded / triangleCount << " per triangle)" << std::endl;
+
+        if (s == 0) {
+            firstChecksum = checksum;
+        } else if (checksum != firstChecksum) {
+            std::cout << "ERROR::BENCH::OUTPUT_DIFFERS " << stage.name << " doesn't draw the authored torus" << std::endl;
+            matched = false;
+        }
+    }
+
+    raster.deleteProgram(program);
+    return matched ? 0 : 1;
+}
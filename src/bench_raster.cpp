@@ -0,0 +1,195 @@
+/*
+    Fragment stage throughput of the software rasterizer for every SIMD level the CPU supports.
+    Draws the main.cpp colour triangle and the square.cpp quad without clearing in between,
+    so the timing is dominated by the row kernels.
+    Usage: bench_raster [frames] [threads]
+*/
+
+#include <renderer/software_rasterizer.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace renderer;
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+/* SHADERS START HERE */
+
+// main.cpp: position + colour in, colour out
+void colorVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    out.position = {in.attribs[0][0], in.attribs[0][1], in.attribs[0][2], 1.0f};
+    out.varyings[0] = in.attribs[1][0];
+    out.varyings[1] = in.attribs[1][1];
+    out.varyings[2] = in.attribs[1][2];
+}
+
+void colorFragmentShader(const float *ourColor, float color[4], const void *uniforms)
+{
+    color[0] = ourColor[0];
+    color[1] = ourColor[1];
+    color[2] = ourColor[2];
+    color[3] = 1.0f;
+}
+
+void colorFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = span.varyings[0][lane];
+        span.color[1][lane] = span.varyings[1][lane];
+        span.color[2][lane] = span.varyings[2][lane];
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+// square.cpp: position in, constant orange out
+void orangeVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    out.position = {in.attribs[0][0], in.attribs[0][1], in.attribs[0][2], 1.0f};
+}
+
+void orangeFragmentShader(const float *varyings, float color[4], const void *uniforms)
+{
+    color[0] = 1.0f;
+    color[1] = 0.5f;
+    color[2] = 0.2f;
+    color[3] = 1.0f;
+}
+
+void orangeFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = 1.0f;
+        span.color[1][lane] = 0.5f;
+        span.color[2][lane] = 0.2f;
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+/* SHADERS END HERE */
+
+struct Scene {
+    const char *name;
+    unsigned int program;
+    unsigned int VAO;
+    bool indexed;
+    int count;
+};
+
+// Renders the scene for the given number of frames and returns Mpixels/s
+double run(SoftwareRasterizer &raster, const Scene &scene, int frames, unsigned long long &checksum)
+{
+    raster.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    raster.clear(GL_COLOR_BUFFER_BIT);
+    raster.finish();
+    raster.resetStats();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        raster.useProgram(scene.program);
+        raster.bindVertexArray(scene.VAO);
+        if (scene.indexed) {
+            raster.drawElements(GL_TRIANGLES, scene.count, GL_UNSIGNED_INT, 0);
+        } else {
+            raster.drawArrays(GL_TRIANGLES, 0, scene.count);
+        }
+        raster.finish();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const uint32_t *pixels = raster.pixels();
+    checksum = 1469598103934665603ULL;
+    for (unsigned int i = 0; i < SCR_WIDTH * SCR_HEIGHT; i++) {
+        checksum = (checksum ^ pixels[i]) * 1099511628211ULL;
+    }
+
+    return raster.stats().pixels / seconds / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 2000;
+    unsigned int threads = argc > 2 ? (unsigned int)atoi(argv[2]) : 0;
+
+    SoftwareRasterizer raster(SCR_WIDTH, SCR_HEIGHT, threads);
+    unsigned int colorProgram = raster.createProgram({colorVertexShader, colorFragmentShader, 3, colorFragmentShaderSpan});
+    unsigned int orangeProgram = raster.createProgram({orangeVertexShader, orangeFragmentShader, 0, orangeFragmentShaderSpan});
+
+    /* GEOMETRY STARTS HERE */
+
+    // main.cpp triangle
+    float triangleVertices[] = {
+        // positions        // colors
+        -0.5f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f,
+         0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.0f,
+         0.0f,  0.5f, 0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    // square.cpp quad
+    float squareVertices[] = {
+         0.5f,  0.5f, 0.0f,
+         0.5f, -0.5f, 0.0f,
+        -0.5f, -0.5f, 0.0f,
+        -0.5f,  0.5f, 0.0f
+    };
+    unsigned int squareIndices[] = {
+        0, 1, 3,
+        1, 2, 3
+    };
+
+    unsigned int VAOs[2], VBOs[2], EBO;
+    raster.genVertexArrays(2, VAOs);
+    raster.genBuffers(2, VBOs);
+    raster.genBuffers(1, &EBO);
+
+    raster.bindVertexArray(VAOs[0]);
+    raster.bindBuffer(GL_ARRAY_BUFFER, VBOs[0]);
+    raster.bufferData(GL_ARRAY_BUFFER, sizeof(triangleVertices), triangleVertices, GL_STATIC_DRAW);
+    raster.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    raster.enableVertexAttribArray(0);
+    raster.vertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    raster.enableVertexAttribArray(1);
+
+    raster.bindVertexArray(VAOs[1]);
+    raster.bindBuffer(GL_ARRAY_BUFFER, VBOs[1]);
+    raster.bufferData(GL_ARRAY_BUFFER, sizeof(squareVertices), squareVertices, GL_STATIC_DRAW);
+    raster.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    raster.bufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(squareIndices), squareIndices, GL_STATIC_DRAW);
+    raster.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    raster.enableVertexAttribArray(0);
+    raster.bindVertexArray(0);
+
+    /* GEOMETRY ENDS HERE */
+
+    Scene scenes[] = {
+        {"main (colour triangle)", colorProgram, VAOs[0], false, 3},
+        {"square (indexed quad)", orangeProgram, VAOs[1], true, 6}
+    };
+
+    SwSimdLevel best = detectSimdLevel();
+    std::cout << "threads: " << raster.threadCount() << ", frames: " << frames << std::endl;
+
+    for (const Scene &scene : scenes) {
+        unsigned long long reference = 0;
+        for (int level = SW_SIMD_SCALAR; level <= best; level++) {
+            raster.setSimdLevel((SwSimdLevel)level);
+
+            unsigned long long checksum = 0;
+            double mpixels = run(raster, scene, frames, checksum);
+            if (level == SW_SIMD_SCALAR) {
+                reference = checksum;
+            }
+
+            std::cout << scene.name << " [" << simdLevelName((SwSimdLevel)level) << "]: " << mpixels << " Mpixels/s"
+                      << (checksum == reference ? "" : " (OUTPUT DIFFERS FROM SCALAR)") << std::endl;
+        }
+    }
+
+    raster.deleteVertexArrays(2, VAOs);
+    raster.deleteBuffers(2, VBOs);
+    raster.deleteBuffers(1, &EBO);
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+    Draw recording throughput with 1..N recording threads.
+    Every frame animates and culls a large set of objects (200000 by default) and records
+    a draw for each visible one, split into jobs over a ParallelRecorder. The merged
+    command stream of every thread count is checked against the single-threaded one
+    with a RecordingBackend, and one frame is rendered on the software rasterizer to
+    compare the pixels as well.
+    Usage: bench_record [objects] [frames] [max threads]
+*/
+
+#include <renderer/command_buffer.h>
+#include <renderer/parallel_recorder.h>
+#include <renderer/software_rasterizer.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace renderer;
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+const int GRID_CELLS = 10000;
+const unsigned int OBJECTS_PER_JOB = 1024;
+
+/* SHADERS START HERE */
+
+void gridVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    out.position = {in.attribs[0][0], in.attribs[0][1], 0.0f, 1.0f};
+}
+
+template <int N>
+void gridFragmentShader(const float *varyings, float color[4], const void *uniforms)
+{
+    color[0] = (N & 1) ? 1.0f : 0.2f;
+    color[1] = (N & 2) ? 1.0f : 0.2f;
+    color[2] = 0.5f;
+    color[3] = 1.0f;
+}
+
+/* SHADERS END HERE */
+
+struct Object {
+    float x, y, z;
+    float radius;
+    float speed;
+};
+
+// The per-object work a scene does before it can record a draw: animate, cull, compute depth
+void recordObjects(const std::vector<Object> &objects, unsigned int job, float time, const unsigned int programs[4],
+                   unsigned int VAO, CommandBuffer &buffer)
+{
+    size_t begin = (size_t)job * OBJECTS_PER_JOB;
+    size_t end = begin + OBJECTS_PER_JOB < objects.size() ? begin + OBJECTS_PER_JOB : objects.size();
+
+    for (size_t i = begin; i < end; i++) {
+        const Object &object = objects[i];
+        float angle = time * object.speed;
+        float x = object.x * cosf(angle) - object.z * sinf(angle);
+        float z = object.x * sinf(angle) + object.z * cosf(angle) + 2.0f;
+
+        // Sphere against the near/far planes and a 90 degree frustum
+        if (z + object.radius < 0.1f || z - object.radius > 4.0f) {
+            continue;
+        }
+        if (fabsf(x) - object.radius > z || fabsf(object.y) - object.radius > z) {
+            continue;
+        }
+
+        int cell = (int)(i % GRID_CELLS);
+        buffer.drawArrays(programs[i % 4], VAO, GL_TRIANGLES, cell * 3, 3, (z - 0.1f) / 3.9f);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int objectCount = argc > 1 ? atoi(argv[1]) : 200000;
+    int frames = argc > 2 ? atoi(argv[2]) : 50;
+    unsigned int maxThreads = argc > 3 ? (unsigned int)atoi(argv[3]) : std::thread::hardware_concurrency();
+    if (maxThreads < 4) {
+        // Always run a few threads, so the ordering is checked even on small machines
+        maxThreads = 4;
+    }
+
+    std::vector<Object> objects(objectCount);
+    unsigned int seed = 12345;
+    for (Object &object : objects) {
+        seed = seed * 1664525u + 1013904223u;
+        object.x = ((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f;
+        seed = seed * 1664525u + 1013904223u;
+        object.y = ((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f;
+        seed = seed * 1664525u + 1013904223u;
+        object.z = ((seed >> 8) & 0xFFFF) / 32768.0f - 1.0f;
+        object.radius = 0.05f;
+        object.speed = 0.5f + (seed & 0xFF) / 256.0f;
+    }
+    unsigned int jobCount = (unsigned int)((objects.size() + OBJECTS_PER_JOB - 1) / OBJECTS_PER_JOB);
+
+    /* RASTERIZER STARTS HERE */
+
+    SoftwareRasterizer raster(SCR_WIDTH, SCR_HEIGHT, 1);
+    raster.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    unsigned int programs[4] = {
+        raster.createProgram({gridVertexShader, gridFragmentShader<0>, 0, nullptr}),
+        raster.createProgram({gridVertexShader, gridFragmentShader<1>, 0, nullptr}),
+        raster.createProgram({gridVertexShader, gridFragmentShader<2>, 0, nullptr}),
+        raster.createProgram({gridVertexShader, gridFragmentShader<3>, 0, nullptr})
+    };
+
+    // One small triangle per grid cell
+    std::vector<float> vertices;
+    for (int cell = 0; cell < GRID_CELLS; cell++) {
+        float x0 = -1.0f + 2.0f * (cell % 100) / 100;
+        float y0 = -1.0f + 2.0f * (cell / 100) / 100;
+        float triangle[] = {x0, y0, x0 + 0.018f, y0, x0, y0 + 0.018f};
+        vertices.insert(vertices.end(), triangle, triangle + 6);
+    }
+    unsigned int VAO, VBO;
+    raster.genVertexArrays(1, &VAO);
+    raster.genBuffers(1, &VBO);
+    raster.bindVertexArray(VAO);
+    raster.bindBuffer(GL_ARRAY_BUFFER, VBO);
+    raster.bufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    raster.vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    raster.enableVertexAttribArray(0);
+    raster.bindVertexArray(0);
+
+    /* RASTERIZER ENDS HERE */
+
+    std::cout << "objects: " << objectCount << ", jobs: " << jobCount << ", frames: " << frames << std::endl;
+
+    uint64_t referenceStream = 0;
+    unsigned long long referencePixels = 0;
+    double singleThreadMilliseconds = 0.0;
+    bool matches = true;
+
+    for (unsigned int threads = 1; threads <= maxThreads; threads *= 2) {
+        WorkerPool pool(threads);
+        ParallelRecorder recorder(pool);
+
+        auto start = std::chrono::steady_clock::now();
+        size_t draws = 0;
+        for (int frame = 0; frame < frames; frame++) {
+            float time = frame / 60.0f;
+            CommandBuffer &commands = recorder.record(jobCount, [&](unsigned int job, CommandBuffer &buffer) {
+                recordObjects(objects, job, time, programs, VAO, buffer);
+            });
+            commands.sort();
+            draws = commands.size();
+        }
+        double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+        if (threads == 1) {
+            singleThreadMilliseconds = milliseconds;
+        }
+
+        // The last frame's stream, as calls and as pixels
+        RecordingBackend recording;
+        recorder.merged().submit(recording);
+
+        DeviceBackend<SoftwareRasterizer> device = {raster};
+        raster.clear(GL_COLOR_BUFFER_BIT);
+        recorder.merged().submit(device);
+        raster.finish();
+        const uint32_t *pixels = raster.pixels();
+        unsigned long long checksum = 1469598103934665603ULL;
+        for (unsigned int i = 0; i < SCR_WIDTH * SCR_HEIGHT; i++) {
+            checksum = (checksum ^ pixels[i]) * 1099511628211ULL;
+        }
+
+        if (threads == 1) {
+            referenceStream = recording.hash();
+            referencePixels = checksum;
+        }
+        bool same = recording.hash() == referenceStream && checksum == referencePixels;
+        matches = matches && same;
+
+        std::cout << threads << " thread(s): " << milliseconds << " ms per frame, " << draws << " draws, "
+                  << draws / milliseconds / 1000.0 << " Mdraws/s, speedup " << singleThreadMilliseconds / milliseconds
+                  << (same ? "" : " (STREAM DIFFERS FROM 1 THREAD)") << std::endl;
+    }
+
+    raster.deleteVertexArrays(1, &VAO);
+    raster.deleteBuffers(1, &VBO);
+    return matches ? 0 : 1;
+}
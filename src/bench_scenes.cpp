@@ -0,0 +1,486 @@
+/*
+    Runs one of the sample scenes (main, triangles, triangles2, triangles3, square) headlessly
+    for a fixed number of frames and prints one JSON line with what to track across commits:
+    startup time (main() until the first frame is done), frames/s, draw calls/s and peak
+    resident memory. The scenes use the vertex data and layouts, shaders and draw calls of
+    their sample programs.
+    "gl" draws into a hidden GLFW window with vsync off (LIBGL_ALWAYS_SOFTWARE=1 makes that
+    llvmpipe on Mesa); "software" draws with the software rasterizer and opens no window.
+    Startup and peak memory are per process: "all" reports startup for its first scene only
+    (null for the rest, which start warm), so run one scene per process to compare them
+    ("make bench" does).
+    Usage: bench_scenes <scene|all> [gl|software] [frames] [threads]
+*/
+
+#include <renderer/shader.h>
+#include <renderer/software_rasterizer.h>
+#include <renderer/vertex_format.h>
+#include <renderer/window.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#ifndef BENCH_COMMIT
+#define BENCH_COMMIT "unknown"
+#endif
+
+using namespace renderer;
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+/* SCENES START HERE */
+
+enum BenchProgram {
+    BENCH_PROGRAM_COLOR = 0,    // main.cpp: position + colour attributes
+    BENCH_PROGRAM_ORANGE = 1,   // everything else
+    BENCH_PROGRAM_YELLOW = 2,   // triangles3.cpp's second triangle
+    BENCH_PROGRAM_COUNT = 3
+};
+
+struct BenchDraw {
+    const float *vertices;
+    int vertexCount;
+    int components;                 // floats per vertex: 3 (position) or 6 (position, colour)
+    const VertexConversion *layout; // how the sample uploads them (renderer/vertex_format.h)
+    int layoutSize;
+    const unsigned int *indices;    // NULL for glDrawArrays
+    int indexCount;
+    BenchProgram program;
+};
+
+struct BenchScene {
+    const char *name;
+    BenchDraw draws[2];
+    int drawCount;
+};
+
+// main.cpp's compact layout: position as half floats, colour as normalized bytes
+const VertexConversion mainLayout[] = {
+    {0, 3, 0, VERTEX_FORMAT_HALF},
+    {1, 3, 3 * sizeof(float), VERTEX_FORMAT_UNORM8}
+};
+
+// The other samples upload plain float positions
+const VertexConversion positionLayout[] = {
+    {0, 3, 0, VERTEX_FORMAT_FLOAT}
+};
+
+const float mainVertices[] = {
+    -0.5f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f,
+     0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.0f,
+     0.0f,  0.5f, 0.0f, 0.0f, 0.0f, 1.0f
+};
+
+// triangles.cpp welds its shared corner (renderer/mesh_builder.h)
+const float trianglesVertices[] = {
+     0.0f,  -0.5f, 0.0f,
+     0.75f, -0.5f, 0.0f,
+     0.350f, 0.5f, 0.0f,
+    -0.75f, -0.5f, 0.0f,
+    -0.350f, 0.5f, 0.0f
+};
+
+const unsigned int trianglesIndices[] = {
+    0, 1, 2,
+    3, 0, 4
+};
+
+const float firstTriangle[] = {
+    -0.75f, -0.5f, 0.0f,
+     0.0f,  -0.5f, 0.0f,
+    -0.350f, 0.5f, 0.0f
+};
+
+const float secondTriangle[] = {
+    0.0f,  -0.5f, 0.0f,
+    0.75f, -0.5f, 0.0f,
+    0.350f, 0.5f, 0.0f
+};
+
+const float squareVertices[] = {
+     0.5f,  0.5f, 0.0f,
+     0.5f, -0.5f, 0.0f,
+    -0.5f, -0.5f, 0.0f,
+    -0.5f,  0.5f, 0.0f
+};
+
+const unsigned int squareIndices[] = {
+    0, 1, 3,
+    1, 2, 3
+};
+
+const BenchScene scenes[] = {
+    {"main", {{mainVertices, 3, 6, mainLayout, 2, NULL, 0, BENCH_PROGRAM_COLOR}}, 1},
+    {"triangles", {{trianglesVertices, 5, 3, positionLayout, 1, trianglesIndices, 6, BENCH_PROGRAM_ORANGE}}, 1},
+    {"triangles2", {{firstTriangle, 3, 3, positionLayout, 1, NULL, 0, BENCH_PROGRAM_ORANGE},
+                    {secondTriangle, 3, 3, positionLayout, 1, NULL, 0, BENCH_PROGRAM_ORANGE}}, 2},
+    {"triangles3", {{firstTriangle, 3, 3, positionLayout, 1, NULL, 0, BENCH_PROGRAM_ORANGE},
+                    {secondTriangle, 3, 3, positionLayout, 1, NULL, 0, BENCH_PROGRAM_YELLOW}}, 2},
+    {"square", {{squareVertices, 4, 3, positionLayout, 1, squareIndices, 6, BENCH_PROGRAM_ORANGE}}, 1}
+};
+const int SCENE_COUNT = sizeof(scenes) / sizeof(scenes[0]);
+
+/* SCENES END HERE */
+/* SHADERS START HERE */
+
+const char *colorVertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+    "out vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0f);\n"
+    "    ourColor = aColor;\n"
+    "}\0";
+
+const char *colorFragmentShaderSource = "#version 330 core\n"
+    "in vec3 ourColor;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(ourColor, 1.0);\n"
+    "}\0";
+
+const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0f);\n"
+    "}\0";
+
+const char *orangeFragmentShaderSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+    "}\0";
+
+const char *yellowFragmentShaderSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(1.0f, 1.0f, 0.0f, 1.0f);\n"
+    "}\0";
+
+// The same three programs as software rasterizer stages
+void colorVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    out.position = {in.attribs[0][0], in.attribs[0][1], in.attribs[0][2], 1.0f};
+    out.varyings[0] = in.attribs[1][0];
+    out.varyings[1] = in.attribs[1][1];
+    out.varyings[2] = in.attribs[1][2];
+}
+
+void colorFragmentShader(const float *ourColor, float color[4], const void *uniforms)
+{
+    color[0] = ourColor[0];
+    color[1] = ourColor[1];
+    color[2] = ourColor[2];
+    color[3] = 1.0f;
+}
+
+void colorFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = span.varyings[0][lane];
+        span.color[1][lane] = span.varyings[1][lane];
+        span.color[2][lane] = span.varyings[2][lane];
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+void positionVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    out.position = {in.attribs[0][0], in.attribs[0][1], in.attribs[0][2], 1.0f};
+}
+
+void orangeFragmentShader(const float *varyings, float color[4], const void *uniforms)
+{
+    color[0] = 1.0f;
+    color[1] = 0.5f;
+    color[2] = 0.2f;
+    color[3] = 1.0f;
+}
+
+void orangeFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = 1.0f;
+        span.color[1][lane] = 0.5f;
+        span.color[2][lane] = 0.2f;
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+void yellowFragmentShader(const float *varyings, float color[4], const void *uniforms)
+{
+    color[0] = 1.0f;
+    color[1] = 1.0f;
+    color[2] = 0.0f;
+    color[3] = 1.0f;
+}
+
+void yellowFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = 1.0f;
+        span.color[1][lane] = 1.0f;
+        span.color[2][lane] = 0.0f;
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+/* SHADERS END HERE */
+/* DEVICES START HERE */
+
+// Both devices take the GL calls the scenes need under the SoftwareRasterizer's names,
+// so runScene() is written once
+class GLDevice {
+public:
+    GLDevice(Window &window)
+        : window(window)
+    {
+        programs[BENCH_PROGRAM_COLOR] = ShaderProgram(colorVertexShaderSource, colorFragmentShaderSource);
+        programs[BENCH_PROGRAM_ORANGE] = ShaderProgram(vertexShaderSource, orangeFragmentShaderSource);
+        programs[BENCH_PROGRAM_YELLOW] = ShaderProgram(vertexShaderSource, yellowFragmentShaderSource);
+    }
+
+    unsigned int program(BenchProgram kind) const { return programs[kind].id(); }
+
+    void clearColor(float r, float g, float b, float a) { glClearColor(r, g, b, a); }
+    void clear(GLbitfield mask) { glClear(mask); }
+    void genBuffers(int n, unsigned int *ids) { glGenBuffers(n, ids); }
+    void deleteBuffers(int n, const unsigned int *ids) { glDeleteBuffers(n, ids); }
+    void bindBuffer(GLenum target, unsigned int id) { glBindBuffer(target, id); }
+    void bufferData(GLenum target, size_t size, const void *data, GLenum usage) { glBufferData(target, (GLsizeiptr)size, data, usage); }
+    void genVertexArrays(int n, unsigned int *ids) { glGenVertexArrays(n, ids); }
+    void deleteVertexArrays(int n, const unsigned int *ids) { glDeleteVertexArrays(n, ids); }
+    void bindVertexArray(unsigned int id) { glBindVertexArray(id); }
+    void enableVertexAttribArray(unsigned int index) { glEnableVertexAttribArray(index); }
+    void useProgram(unsigned int id) { glUseProgram(id); }
+    void drawArrays(GLenum mode, int first, int count) { glDrawArrays(mode, first, count); }
+    void drawElements(GLenum mode, int count, GLenum type, const void *indices) { glDrawElements(mode, count, type, indices); }
+
+    void vertexAttribPointer(unsigned int index, int size, GLenum type, GLboolean normalized, int stride, const void *pointer)
+    {
+        glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    }
+
+    // Waits for the frame like the software device does, so both measure whole frames
+    // (a hidden window's swap doesn't throttle on every platform)
+    void present()
+    {
+        window.swapBuffers();
+        glFinish();
+    }
+
+    std::string description() const { return (const char *)glGetString(GL_RENDERER); }
+
+private:
+    Window &window;
+    ShaderProgram programs[BENCH_PROGRAM_COUNT];
+};
+
+class SoftwareDevice : public SoftwareRasterizer {
+public:
+    SoftwareDevice(unsigned int threads)
+        : SoftwareRasterizer(SCR_WIDTH, SCR_HEIGHT, threads)
+    {
+        programs[BENCH_PROGRAM_COLOR] = createProgram({colorVertexShader, colorFragmentShader, 3, colorFragmentShaderSpan});
+        programs[BENCH_PROGRAM_ORANGE] = createProgram({positionVertexShader, orangeFragmentShader, 0, orangeFragmentShaderSpan});
+        programs[BENCH_PROGRAM_YELLOW] = createProgram({positionVertexShader, yellowFragmentShader, 0, yellowFragmentShaderSpan});
+    }
+
+    ~SoftwareDevice()
+    {
+        for (unsigned int program : programs) {
+            deleteProgram(program);
+        }
+    }
+
+    unsigned int program(BenchProgram kind) const { return programs[kind]; }
+
+    // Stands in for glfwSwapBuffers: the frame is complete after this
+    void present() { finish(); }
+
+    std::string description() const
+    {
+        return std::string("software rasterizer (") + simdLevelName(activeSimdLevel()) + ", " + std::to_string(threadCount()) + " threads)";
+    }
+
+private:
+    unsigned int programs[BENCH_PROGRAM_COUNT];
+};
+
+/* DEVICES END HERE */
+/* BENCHMARK STARTS HERE */
+
+struct SceneResult {
+    double startupMilliseconds;
+    double seconds;
+    unsigned long long drawCalls;
+};
+
+// Peak resident set size of the process so far, in KiB
+long long peakResidentKilobytes()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return -1;
+    }
+    return (long long)(counters.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#ifdef __APPLE__
+    return (long long)usage.ru_maxrss / 1024;   // bytes there
+#else
+    return (long long)usage.ru_maxrss;
+#endif
+#endif
+}
+
+template <typename Device>
+SceneResult runScene(Device &device, const BenchScene &scene, int frames, std::chrono::steady_clock::time_point startupBegin)
+{
+    // Upload the scene the way its sample program does: a VAO and VBO (and EBO) per draw
+    unsigned int VAOs[2], VBOs[2], EBOs[2] = {0, 0};
+    device.genVertexArrays(scene.drawCount, VAOs);
+    device.genBuffers(scene.drawCount, VBOs);
+    for (int i = 0; i < scene.drawCount; i++) {
+        const BenchDraw &draw = scene.draws[i];
+        int stride = draw.components * sizeof(float);
+        CompactVertices compact = compactVertices(draw.vertices, (size_t)draw.vertexCount * stride, stride, draw.layout, draw.layoutSize);
+        device.bindVertexArray(VAOs[i]);
+        device.bindBuffer(GL_ARRAY_BUFFER, VBOs[i]);
+        device.bufferData(GL_ARRAY_BUFFER, compact.data.size(), compact.data.data(), GL_STATIC_DRAW);
+        for (const VertexAttribute &attribute : compact.attributes) {
+            device.vertexAttribPointer(attribute.location, attribute.size, attribute.type, attribute.normalized, compact.stride, (void*)attribute.offset);
+            device.enableVertexAttribArray(attribute.location);
+        }
+        if (draw.indices != NULL) {
+            device.genBuffers(1, &EBOs[i]);
+            device.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBOs[i]);
+            device.bufferData(GL_ELEMENT_ARRAY_BUFFER, (size_t)draw.indexCount * sizeof(unsigned int), draw.indices, GL_STATIC_DRAW);
+        }
+    }
+    device.bindVertexArray(0);
+    device.bindBuffer(GL_ARRAY_BUFFER, 0);
+
+    SceneResult result = {0.0, 0.0, 0};
+    std::chrono::steady_clock::time_point start;
+    for (int frame = 0; frame < frames; frame++) {
+        device.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        device.clear(GL_COLOR_BUFFER_BIT);
+        for (int i = 0; i < scene.drawCount; i++) {
+            const BenchDraw &draw = scene.draws[i];
+            device.useProgram(device.program(draw.program));
+            device.bindVertexArray(VAOs[i]);
+            if (draw.indices != NULL) {
+                device.drawElements(GL_TRIANGLES, draw.indexCount, GL_UNSIGNED_INT, 0);
+            } else {
+                device.drawArrays(GL_TRIANGLES, 0, draw.vertexCount);
+            }
+        }
+        device.present();
+
+        // Startup ends with the first frame; the rest are the steady state
+        if (frame == 0) {
+            start = std::chrono::steady_clock::now();
+            result.startupMilliseconds = std::chrono::duration<double, std::milli>(start - startupBegin).count();
+        } else {
+            result.drawCalls += scene.drawCount;
+        }
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    device.deleteVertexArrays(scene.drawCount, VAOs);
+    device.deleteBuffers(scene.drawCount, VBOs);
+    device.deleteBuffers(scene.drawCount, EBOs);
+    return result;
+}
+
+// Only the first scene of a process has a cold start to report; later ones print null
+void printResult(const BenchScene &scene, const char *backend, const std::string &device, int frames, const SceneResult &result, bool coldStart)
+{
+    int timed = frames - 1;
+    std::cout << "{\"scene\": \"" << scene.name << "\", \"backend\": \"" << backend << "\", \"device\": \"" << device
+              << "\", \"commit\": \"" << BENCH_COMMIT << "\", \"frames\": " << timed << ", \"startup_ms\": ";
+    if (coldStart) {
+        std::cout << result.startupMilliseconds;
+    } else {
+        std::cout << "null";
+    }
+    std::cout << ", \"frames_per_s\": " << (result.seconds > 0.0 ? timed / result.seconds : 0.0)
+              << ", \"draw_calls_per_s\": " << (result.seconds > 0.0 ? result.drawCalls / result.seconds : 0.0)
+              << ", \"peak_rss_kb\": " << peakResidentKilobytes() << "}" << std::endl;
+}
+
+/* BENCHMARK ENDS HERE */
+
+int main(int argc, char **argv)
+{
+    auto startupBegin = std::chrono::steady_clock::now();
+
+    if (argc < 2) {
+        std::cout << "Usage: bench_scenes <scene|all> [gl|software] [frames] [threads]" << std::endl;
+        return -1;
+    }
+    bool all = strcmp(argv[1], "all") == 0;
+    bool software = argc > 2 && strcmp(argv[2], "software") == 0;
+    int frames = argc > 3 ? atoi(argv[3]) : 1000;
+    unsigned int threads = argc > 4 ? (unsigned int)atoi(argv[4]) : 0;
+    if (frames < 2) {
+        frames = 2;
+    }
+
+    int selected = -1;
+    for (int i = 0; i < SCENE_COUNT; i++) {
+        if (strcmp(argv[1], scenes[i].name) == 0) {
+            selected = i;
+        }
+    }
+    if (!all && selected < 0) {
+        std::cout << "ERROR::BENCH::UNKNOWN_SCENE " << argv[1] << std::endl;
+        return -1;
+    }
+    int first = all ? 0 : selected;
+    int last = all ? SCENE_COUNT - 1 : selected;
+
+    if (software) {
+        SoftwareDevice device(threads);
+        for (int i = first; i <= last; i++) {
+            SceneResult result = runScene(device, scenes[i], frames, startupBegin);
+            printResult(scenes[i], "software", device.description(), frames, result, i == first);
+        }
+        return 0;
+    }
+
+    // The window only carries the context and is never shown
+    Window window(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", false);
+    if (!window.ok()) {
+        return -1;
+    }
+    glfwSwapInterval(0);
+
+    GLDevice device(window);
+    for (int i = first; i <= last; i++) {
+        SceneResult result = runScene(device, scenes[i], frames, startupBegin);
+        printResult(scenes[i], "gl", device.description(), frames, result, i == first);
+    }
+    return 0;
+}
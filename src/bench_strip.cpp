@@ -0,0 +1,250 @@
+/*
+    Triangle strips with primitive restart against triangle lists.
+    Welds a terrain grid (position and normal, 24 bytes a vertex) with renderer/mesh_builder.h,
+    once small enough for 16-bit indices and once with 32-bit ones, and draws it on the
+    software rasterizer four ways:
+      list            as welded, row by row
+      list, optimized after MeshBuilder::optimize() (vertex cache, overdraw, vertex fetch)
+      strips          stripify() of the row-by-row list
+      strips, opt.    stripify() of the optimized list
+    For each, reports the index count and bytes, the number of strips, the stripify time,
+    ms/frame and vertex shader runs per frame. The strips are checked to draw the same
+    triangles as their list, both on the CPU (unstripify()) and by comparing the images; the
+    grid is flat-shaded so the image doesn't depend on triangle order.
+    Usage: bench_strip [big grid side in vertices] [frames] [threads]
+*/
+
+#include <renderer/mesh_builder.h>
+#include <renderer/mesh_optimizer.h>
+#include <renderer/software_rasterizer.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace renderer;
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+/* SHADERS START HERE */
+
+// Seen from above: x and z straight to NDC, the height only tints
+void terrainVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    out.position = {in.attribs[0][0] * 0.9f, in.attribs[0][2] * 0.9f, in.attribs[0][1] * 0.1f, 1.0f};
+    out.varyings[0] = in.attribs[1][1];
+}
+
+void flatFragmentShader(const float *varyings, float color[4], const void *uniforms)
+{
+    color[0] = 0.4f;
+    color[1] = 0.7f;
+    color[2] = 0.3f;
+    color[3] = 1.0f;
+}
+
+void flatFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = 0.4f;
+        span.color[1][lane] = 0.7f;
+        span.color[2][lane] = 0.3f;
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+/* SHADERS END HERE */
+
+struct TerrainVertex {
+    float position[3];
+    float normal[3];
+};
+
+// A columns x rows vertex heightfield over [-1, 1]^2 as triangle soup, two triangles per cell
+std::vector<TerrainVertex> buildTerrainSoup(int columns, int rows)
+{
+    auto vertex = [&](int x, int z) {
+        TerrainVertex v;
+        float u = -1.0f + 2.0f * x / (columns - 1), w = -1.0f + 2.0f * z / (rows - 1);
+        float height = 0.1f * sinf(7.0f * u) * cosf(5.0f * w);
+        float dx = 0.7f * cosf(7.0f * u) * cosf(5.0f * w), dz = -0.5f * sinf(7.0f * u) * sinf(5.0f * w);
+        float length = sqrtf(dx * dx + 1.0f + dz * dz);
+        v.position[0] = u;
+        v.position[1] = height;
+        v.position[2] = w;
+        v.normal[0] = -dx / length;
+        v.normal[1] = 1.0f / length;
+        v.normal[2] = -dz / length;
+        return v;
+    };
+
+    std::vector<TerrainVertex> soup;
+    soup.reserve((size_t)(columns - 1) * (rows - 1) * 6);
+    for (int z = 0; z + 1 < rows; z++) {
+        for (int x = 0; x + 1 < columns; x++) {
+            TerrainVertex cell[] = {vertex(x, z), vertex(x + 1, z), vertex(x + 1, z + 1), vertex(x, z + 1)};
+            TerrainVertex triangles[] = {cell[0], cell[1], cell[3], cell[1], cell[2], cell[3]};
+            soup.insert(soup.end(), triangles, triangles + 6);
+        }
+    }
+    return soup;
+}
+
+// Every triangle rotated to start at its smallest index, then sorted: equal for the same triangles in any order
+std::vector<uint32_t> canonicalTriangles(std::vector<uint32_t> indices)
+{
+    std::vector<std::array<uint32_t, 3>> triangles(indices.size() / 3);
+    for (size_t t = 0; t < triangles.size(); t++) {
+        uint32_t *v = &indices[t * 3];
+        int first = v[0] <= v[1] && v[0] <= v[2] ? 0 : v[1] <= v[2] ? 1 : 2;
+        triangles[t] = {v[first], v[(first + 1) % 3], v[(first + 2) % 3]};
+    }
+    std::sort(triangles.begin(), triangles.end());
+    for (size_t t = 0; t < triangles.size(); t++) {
+        std::copy(triangles[t].begin(), triangles[t].end(), indices.begin() + t * 3);
+    }
+    return indices;
+}
+
+struct Variant {
+    const char *name;
+    const MeshBuilder *mesh;
+    std::vector<unsigned char> indices;
+    GLenum indexType;
+    size_t indexCount;
+    GLenum mode;
+    uint32_t restartIndex;
+    size_t strips;
+    double stripifyMilliseconds;
+};
+
+Variant listVariant(const char *name, const MeshBuilder &mesh)
+{
+    return Variant{name, &mesh, mesh.indexBuffer(), mesh.indexType(), mesh.indexCount(), GL_TRIANGLES, 0, 0, 0.0};
+}
+
+// Returns false if the strips don't cover the same triangles as the list
+bool stripVariant(const char *name, const MeshBuilder &mesh, Variant &variant)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::vector<uint32_t> strips = mesh.stripIndices();
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    uint32_t restartIndex = mesh.stripRestartIndex();
+    variant = Variant{name, &mesh, mesh.stripIndexBuffer(), mesh.stripIndexType(), strips.size(), GL_TRIANGLE_STRIP, restartIndex,
+                      (size_t)std::count(strips.begin(), strips.end(), restartIndex) + 1, milliseconds};
+    return canonicalTriangles(unstripify(strips, restartIndex)) == canonicalTriangles(mesh.indices());
+}
+
+// Milliseconds per frame; shaded is the number of vertex shader runs per frame
+double run(SoftwareRasterizer &raster, const Variant &variant, int frames, unsigned long long &shaded, unsigned long long &checksum)
+{
+    unsigned int VAO, buffers[2];
+    raster.genVertexArrays(1, &VAO);
+    raster.genBuffers(2, buffers);
+    raster.bindVertexArray(VAO);
+    raster.bindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+    raster.bufferData(GL_ARRAY_BUFFER, variant.mesh->vertexBytes(), variant.mesh->vertices(), GL_STATIC_DRAW);
+    raster.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+    raster.bufferData(GL_ELEMENT_ARRAY_BUFFER, variant.indices.size(), variant.indices.data(), GL_STATIC_DRAW);
+    raster.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)0);
+    raster.enableVertexAttribArray(0);
+    raster.vertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(TerrainVertex), (void*)(3 * sizeof(float)));
+    raster.enableVertexAttribArray(1);
+    if (variant.mode == GL_TRIANGLE_STRIP) {
+        raster.enable(GL_PRIMITIVE_RESTART);
+        raster.primitiveRestartIndex(variant.restartIndex);
+    }
+
+    raster.clear(GL_COLOR_BUFFER_BIT);
+    raster.finish();
+    raster.resetStats();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        raster.clear(GL_COLOR_BUFFER_BIT);
+        raster.drawElements(variant.mode, (int)variant.indexCount, variant.indexType, 0);
+        raster.finish();
+    }
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+    shaded = raster.stats().vertices / frames;
+
+    const uint32_t *pixels = raster.pixels();
+    checksum = FNV_OFFSET_BASIS;
+    for (unsigned int i = 0; i < SCR_WIDTH * SCR_HEIGHT; i++) {
+        checksum = (checksum ^ pixels[i]) * FNV_PRIME;
+    }
+
+    raster.disable(GL_PRIMITIVE_RESTART);
+    raster.bindVertexArray(0);
+    raster.deleteVertexArrays(1, &VAO);
+    raster.deleteBuffers(2, buffers);
+    return milliseconds;
+}
+
+bool benchTerrain(SoftwareRasterizer &raster, int columns, int rows, int frames)
+{
+    std::vector<TerrainVertex> soup = buildTerrainSoup(columns, rows);
+    MeshBuilder rowOrder(sizeof(TerrainVertex), soup.size() / 4);
+    rowOrder.addVertices(soup.data(), soup.size() * sizeof(TerrainVertex));
+    MeshBuilder optimized = rowOrder;
+    optimized.optimize(0);
+
+    size_t triangleCount = rowOrder.indexCount() / 3;
+    std::cout << "terrain, " << columns << " x " << rows << " vertices: " << triangleCount << " triangles" << std::endl;
+
+    Variant variants[4] = {listVariant("list           ", rowOrder), listVariant("list, optimized", optimized)};
+    bool matched = stripVariant("strips         ", rowOrder, variants[2]) & stripVariant("strips, opt.   ", optimized, variants[3]);
+    if (!matched) {
+        std::cout << "ERROR::BENCH::STRIPS_DIFFER the strips don't hold the list's triangles" << std::endl;
+    }
+
+    unsigned long long listChecksum = 0;
+    for (int i = 0; i < 4; i++) {
+        const Variant &variant = variants[i];
+        unsigned long long shaded, checksum;
+        double milliseconds = run(raster, variant, frames, shaded, checksum);
+
+        std::cout << "  " << variant.name << ": " << variant.indexCount << " " << (variant.indexType == GL_UNSIGNED_SHORT ? "16" : "32")
+                  << "-bit indices (" << (double)variant.indexCount / triangleCount << " per triangle, " << variant.indices.size() / 1024.0 << " KB";
+        if (variant.mode == GL_TRIANGLE_STRIP) {
+            std::cout << ", " << 100.0 * (1.0 - (double)variant.indexCount / rowOrder.indexCount()) << "% fewer), " << variant.strips
+                      << " strips of " << (double)triangleCount / variant.strips << " triangles, stripified in " << variant.stripifyMilliseconds << " ms";
+        } else {
+            std::cout << ")";
+        }
+        std::cout << std::endl << "                     " << milliseconds << " ms/frame, " << shaded << " vertex shader runs" << std::endl;
+
+        if (i == 0) {
+            listChecksum = checksum;
+        } else if (checksum != listChecksum) {
+            std::cout << "ERROR::BENCH::OUTPUT_DIFFERS " << variant.name << " doesn't draw the list's image" << std::endl;
+            matched = false;
+        }
+    }
+    return matched;
+}
+
+int main(int argc, char **argv)
+{
+    int side = argc > 1 ? atoi(argv[1]) : 1024;
+    int frames = argc > 2 ? atoi(argv[2]) : 10;
+    unsigned int threads = argc > 3 ? (unsigned int)atoi(argv[3]) : 0;
+
+    SoftwareRasterizer raster(SCR_WIDTH, SCR_HEIGHT, threads);
+    raster.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    unsigned int program = raster.createProgram({terrainVertexShader, flatFragmentShader, 1, flatFragmentShaderSpan});
+    raster.useProgram(program);
+    std::cout << "threads: " << raster.threadCount() << ", frames: " << frames << std::endl;
+
+    // Just under 65535 vertices keeps 16-bit strip indices, then the big one
+    bool matched = benchTerrain(raster, 256, 255, frames) && benchTerrain(raster, side, side, frames);
+
+    raster.deleteProgram(program);
+    return matched ? 0 : 1;
+}
@@ -0,0 +1,262 @@
+/*
+    CPU cost of the renderer's submission path, without a GPU or a window.
+    glad is loaded from the mock driver (renderer/mock_gl.h), so every GL call only costs
+    the renderer's own work plus the mock's bookkeeping, and the mock counts what reached
+    "the driver". Three render loops run against it:
+      main       main.cpp's loop: ShaderProgram, Mesh and a ProgramReflection uniform,
+                 once straight and once through the state cache
+      triangles3 triangles3.cpp's loop: ShaderBuilder programs drawn via a CommandBuffer
+      grid       a larger scene, one triangle per draw over 8 programs and 16 VAOs,
+                 submitted in recorded order and sorted by key
+    A call and draw cost in nanoseconds can be charged to model a driver's overhead.
+    Usage: bench_submit [frames] [grid draws] [call nanoseconds] [draw nanoseconds]
+*/
+
+#include <renderer/command_buffer.h>
+#include <renderer/mesh.h>
+#include <renderer/mock_gl.h>
+#include <renderer/program_reflection.h>
+#include <renderer/shader.h>
+#include <renderer/shader_builder.h>
+#include <renderer/state_cache.h>
+#include <renderer/vertex_format.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <math.h>
+#include <vector>
+
+using namespace renderer;
+
+const int PROGRAM_COUNT = 8;
+const int VAO_COUNT = 16;
+
+// main.cpp's shaders
+const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+    "out vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0f);\n"
+    "    ourColor = aColor;\n"
+    "}\0";
+
+const char *fragmentShaderSource = "#version 330 core\n"
+    "in vec3 ourColor;\n"
+    "uniform vec4 tint;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(ourColor, 1.0) * tint;\n"
+    "}\0";
+
+// The grid's and triangles3.cpp's: position only, one colour per program
+const char *flatVertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0f);\n"
+    "}\0";
+
+const char *flatFragmentShaderSource = "#version 330 core\n"
+    "uniform vec4 color;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = color;\n"
+    "}\0";
+
+// What a run cost; the GL counts are per frame
+struct SubmitResult {
+    double milliseconds;
+    double calls;
+    double draws;
+    double stateChanges;
+    unsigned long long errors;
+};
+
+template <typename Frame>
+SubmitResult run(int frames, Frame frame)
+{
+    MockGL::resetStats();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        frame(i);
+        StateCache::endFrame();
+    }
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    MockGLStats stats = MockGL::stats();
+    return SubmitResult{milliseconds, stats.calls / (double)frames, stats.draws / (double)frames, stats.stateChanges / (double)frames, stats.errors};
+}
+
+void report(const char *name, const SubmitResult &result, int frames)
+{
+    double seconds = result.milliseconds / 1000.0;
+    std::cout << name << ": " << frames / seconds << " frames/s, " << result.draws * frames / seconds << " draws/s, "
+              << result.calls * frames / seconds << " GL calls/s; per frame " << result.calls << " calls, "
+              << result.draws << " draws, " << result.stateChanges << " state changes" << std::endl;
+    if (result.errors > 0) {
+        std::cout << "ERROR::BENCH::GL_ERRORS " << name << " made " << result.errors << " invalid GL calls" << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 2000;
+    int draws = argc > 2 ? atoi(argv[2]) : 10000;
+    if (argc > 3) {
+        MockGL::setCallCost(atoll(argv[3]));
+    }
+    if (argc > 4) {
+        MockGL::setDrawCost(atoll(argv[4]));
+    }
+
+    if (!gladLoadGLLoader((GLADloadproc)MockGL::getProcAddress)) {
+        std::cout << "ERROR::BENCH::GLAD_LOAD_FAILED" << std::endl;
+        return -1;
+    }
+    bool failed = false;
+
+    /* MAIN STARTS HERE */
+    {
+        ShaderProgram shaderProgram(vertexShaderSource, fragmentShaderSource);
+        ProgramReflection reflection(shaderProgram.id());
+        UniformHandle tint = reflection.uniform("tint");
+
+        float vertices[] = {
+            // positions        // colors
+            -0.5f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f,
+             0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.0f,
+             0.0f,  0.5f, 0.0f, 0.0f, 0.0f, 1.0f
+        };
+        CompactVertices compact = compactVertices(vertices, sizeof(vertices), 6 * sizeof(float), {
+            {0, 3, 0, VERTEX_FORMAT_HALF},
+            {1, 3, 3 * sizeof(float), VERTEX_FORMAT_UNORM8}
+        });
+        Mesh triangle(compact.data.data(), compact.data.size(), compact.stride, compact.attributes);
+
+        auto frame = [&](int i) {
+            glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            shaderProgram.use();
+            reflection.set(tint, 0.0f, (sinf(i * 0.01f) / 2) + 0.5f, 0.0f, 1.0f);
+            triangle.draw();
+        };
+
+        SubmitResult direct = run(frames, frame);
+        report("main             ", direct, frames);
+
+        StateCache::install();
+        SubmitResult cached = run(frames, frame);
+        StateCache::uninstall();
+        report("main, state cache", cached, frames);
+        failed |= direct.errors > 0 || cached.errors > 0;
+    }
+    /* MAIN ENDS HERE */
+    /* TRIANGLES3 STARTS HERE */
+    {
+        ShaderBuilder shaderBuilder;
+        int orangeProgramHandle = shaderBuilder.add(flatVertexShaderSource, flatFragmentShaderSource);
+        int yellowProgramHandle = shaderBuilder.add(flatVertexShaderSource, flatFragmentShaderSource);
+        shaderBuilder.submit();
+        ShaderProgram shaderProgramOrange;
+        ShaderProgram shaderProgramYellow;
+
+        float firstTriangle[] = {-0.75f, -0.5f, 0.0f, 0.0f, -0.5f, 0.0f, -0.350f, 0.5f, 0.0f};
+        float secondTriangle[] = {0.0f, -0.5f, 0.0f, 0.75f, -0.5f, 0.0f, 0.350f, 0.5f, 0.0f};
+        Mesh leftTriangle(firstTriangle, sizeof(firstTriangle), 3 * sizeof(float), {{0, 3, GL_FLOAT, 0}});
+        Mesh rightTriangle(secondTriangle, sizeof(secondTriangle), 3 * sizeof(float), {{0, 3, GL_FLOAT, 0}});
+
+        CommandBuffer commands;
+        GLCommandBackend glBackend;
+        SubmitResult result = run(frames, [&](int) {
+            glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            commands.clear();
+            if (!shaderProgramOrange.ok()) {
+                shaderProgramOrange = ShaderProgram(shaderBuilder.ready(orangeProgramHandle));
+            }
+            if (shaderProgramOrange.ok()) {
+                commands.drawArrays(shaderProgramOrange.id(), leftTriangle.id(), GL_TRIANGLES, 0, 3);
+            }
+            if (!shaderProgramYellow.ok()) {
+                shaderProgramYellow = ShaderProgram(shaderBuilder.ready(yellowProgramHandle));
+            }
+            if (shaderProgramYellow.ok()) {
+                commands.drawArrays(shaderProgramYellow.id(), rightTriangle.id(), GL_TRIANGLES, 0, 3);
+            }
+            commands.sort();
+            commands.submit(glBackend);
+        });
+        report("triangles3       ", result, frames);
+        failed |= result.errors > 0;
+    }
+    /* TRIANGLES3 ENDS HERE */
+    /* GRID STARTS HERE */
+    {
+        std::vector<ShaderProgram> programs;
+        for (int i = 0; i < PROGRAM_COUNT; i++) {
+            programs.emplace_back(flatVertexShaderSource, flatFragmentShaderSource);
+        }
+
+        // One triangle per grid cell, in NDC; every VAO sees the whole grid
+        int columns = 1;
+        while (columns * columns < draws) {
+            columns++;
+        }
+        std::vector<float> vertices;
+        vertices.reserve(draws * 9);
+        for (int cell = 0; cell < draws; cell++) {
+            float x0 = -1.0f + 2.0f * (cell % columns) / columns;
+            float y0 = -1.0f + 2.0f * (cell / columns) / columns;
+            float size = 1.8f / columns;
+            float triangle[] = {x0, y0, 0.0f, x0 + size, y0, 0.0f, x0, y0 + size, 0.0f};
+            vertices.insert(vertices.end(), triangle, triangle + 9);
+        }
+        std::vector<Mesh> meshes;
+        for (int i = 0; i < VAO_COUNT; i++) {
+            meshes.emplace_back(vertices.data(), vertices.size() * sizeof(float), 3 * sizeof(float), std::initializer_list<VertexAttribute>{{0, 3, GL_FLOAT, 0}});
+        }
+
+        // Scatter programs and VAOs so neighbouring draws rarely share state
+        CommandBuffer commands;
+        commands.reserve(draws);
+        GLCommandBackend glBackend;
+        auto grid = [&](bool sorted) {
+            return [&, sorted](int) {
+                glClear(GL_COLOR_BUFFER_BIT);
+                commands.clear();
+                for (int cell = 0; cell < draws; cell++) {
+                    unsigned int scramble = (unsigned int)cell * 2654435761u;
+                    unsigned int program = programs[(scramble >> 13) % PROGRAM_COUNT].id();
+                    unsigned int VAO = meshes[(scramble >> 7) % VAO_COUNT].id();
+                    commands.drawArrays(program, VAO, GL_TRIANGLES, cell * 3, 3, (float)cell / draws);
+                }
+                if (sorted) {
+                    commands.sort();
+                }
+                commands.submit(glBackend);
+            };
+        };
+
+        // Fewer frames: each one is draws times bigger
+        int gridFrames = frames / 20 > 0 ? frames / 20 : 1;
+        SubmitResult unsorted = run(gridFrames, grid(false));
+        SubmitResult sorted = run(gridFrames, grid(true));
+        report("grid, unsorted   ", unsorted, gridFrames);
+        report("grid, sorted     ", sorted, gridFrames);
+        failed |= unsorted.errors > 0 || sorted.errors > 0;
+    }
+    /* GRID ENDS HERE */
+
+    // Every object above was deleted when its scope closed
+    if (MockGL::liveObjects() != 0) {
+        std::cout << "ERROR::BENCH::LEAK " << MockGL::liveObjects() << " GL objects were never deleted" << std::endl;
+        failed = true;
+    }
+    MockGL::printSummary();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,275 @@
+/*
+    Memory and bandwidth saved by compact vertex formats (renderer/vertex_format.h) on a large mesh.
+    Builds a terrain grid (1024 x 1024 vertices by default) far from the origin, with a position,
+    normal and colour per vertex in 32-bit floats (40 bytes a vertex), and converts it to half-float
+    positions quantized to the bounding box, 2_10_10_10 normals and 8-bit colours (16 bytes).
+    Reports the size of both, the quantization error, and the software rasterizer drawing each
+    one, whose vertex stage reads every vertex once a frame. Half floats without the bounding
+    box are shown too: far from the origin their precision runs out.
+    Usage: bench_vertex [grid size] [frames] [threads]
+*/
+
+#include <renderer/software_rasterizer.h>
+#include <renderer/vertex_format.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace renderer;
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+// Terrain extent in world units and where it sits
+const float TERRAIN_SIZE = 1000.0f;
+const float TERRAIN_ORIGIN = 5000.0f;
+const float TERRAIN_HEIGHT = 50.0f;
+
+/* SHADERS START HERE */
+
+// Decodes the attributes, maps the terrain's x/z onto the screen and shades by the normal
+struct TerrainUniforms {
+    VertexDecode position;
+    VertexDecode normal;
+    VertexDecode color;
+};
+
+void terrainVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    const TerrainUniforms &u = *(const TerrainUniforms *)uniforms;
+    float x = in.attribs[0][0] * u.position.scale[0] + u.position.bias[0];
+    float z = in.attribs[0][2] * u.position.scale[2] + u.position.bias[2];
+    out.position = {(x - TERRAIN_ORIGIN) / TERRAIN_SIZE * 2.0f - 1.0f, (z - TERRAIN_ORIGIN) / TERRAIN_SIZE * 2.0f - 1.0f, 0.0f, 1.0f};
+
+    float normalY = in.attribs[1][1] * u.normal.scale[1] + u.normal.bias[1];
+    float light = 0.3f + 0.7f * std::max(normalY, 0.0f);
+    for (int c = 0; c < 3; c++) {
+        out.varyings[c] = (in.attribs[2][c] * u.color.scale[c] + u.color.bias[c]) * light;
+    }
+}
+
+void terrainFragmentShader(const float *varyings, float color[4], const void *uniforms)
+{
+    color[0] = varyings[0];
+    color[1] = varyings[1];
+    color[2] = varyings[2];
+    color[3] = 1.0f;
+}
+
+void terrainFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = span.varyings[0][lane];
+        span.color[1][lane] = span.varyings[1][lane];
+        span.color[2][lane] = span.varyings[2][lane];
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+/* SHADERS END HERE */
+
+// A float vertex as the converter reads it
+struct TerrainVertex {
+    float position[3];
+    float normal[3];
+    float color[4];
+};
+
+float terrainHeight(float x, float z)
+{
+    return TERRAIN_HEIGHT * (sinf(x * 0.02f) * cosf(z * 0.015f) + 0.3f * sinf(x * 0.11f + z * 0.07f));
+}
+
+std::vector<TerrainVertex> buildTerrain(int gridSize)
+{
+    std::vector<TerrainVertex> vertices(gridSize * gridSize);
+    float step = TERRAIN_SIZE / (gridSize - 1);
+    for (int row = 0; row < gridSize; row++) {
+        for (int column = 0; column < gridSize; column++) {
+            TerrainVertex &vertex = vertices[row * gridSize + column];
+            float x = TERRAIN_ORIGIN + column * step, z = TERRAIN_ORIGIN + row * step;
+            float y = terrainHeight(x, z);
+            vertex.position[0] = x;
+            vertex.position[1] = y;
+            vertex.position[2] = z;
+
+            // Central differences
+            float dx = terrainHeight(x + 0.5f, z) - terrainHeight(x - 0.5f, z);
+            float dz = terrainHeight(x, z + 0.5f) - terrainHeight(x, z - 0.5f);
+            float length = sqrtf(dx * dx + 1.0f + dz * dz);
+            vertex.normal[0] = -dx / length;
+            vertex.normal[1] = 1.0f / length;
+            vertex.normal[2] = -dz / length;
+
+            // Green valleys, brown slopes, white peaks
+            float t = (y / TERRAIN_HEIGHT + 1.3f) / 2.6f;
+            vertex.color[0] = 0.2f + 0.7f * t;
+            vertex.color[1] = 0.5f + 0.4f * t;
+            vertex.color[2] = 0.1f + 0.8f * t * t;
+            vertex.color[3] = 1.0f;
+        }
+    }
+    return vertices;
+}
+
+// Largest and mean difference of one attribute between the source and its compact copy
+struct QuantizationError {
+    double maximum;
+    double mean;
+};
+
+QuantizationError measureError(const std::vector<TerrainVertex> &source, const CompactVertices &compact, size_t attribute, size_t sourceOffset, int components)
+{
+    const VertexAttribute &layout = compact.attributes[attribute];
+    const VertexDecode &decode = compact.decode[attribute];
+    QuantizationError error = {0.0, 0.0};
+    for (size_t v = 0; v < source.size(); v++) {
+        float value[4];
+        readAttribute(compact.data.data() + v * compact.stride + layout.offset, layout.size, layout.type, layout.normalized == GL_TRUE, value);
+        const float *original = (const float *)((const unsigned char *)&source[v] + sourceOffset);
+        for (int c = 0; c < components; c++) {
+            double difference = fabs(value[c] * decode.scale[c] + decode.bias[c] - original[c]);
+            error.maximum = std::max(error.maximum, difference);
+            error.mean += difference;
+        }
+    }
+    error.mean /= (double)source.size() * components;
+    return error;
+}
+
+// Uploads a layout into a new VAO
+unsigned int createVertexArray(SoftwareRasterizer &raster, const CompactVertices &vertices, unsigned int buffers[2], const std::vector<unsigned int> &indices)
+{
+    unsigned int VAO;
+    raster.genVertexArrays(1, &VAO);
+    raster.genBuffers(2, buffers);
+    raster.bindVertexArray(VAO);
+    raster.bindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+    raster.bufferData(GL_ARRAY_BUFFER, vertices.data.size(), vertices.data.data(), GL_STATIC_DRAW);
+    raster.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+    raster.bufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+    for (const VertexAttribute &attribute : vertices.attributes) {
+        raster.vertexAttribPointer(attribute.location, attribute.size, attribute.type, attribute.normalized, vertices.stride, (void*)attribute.offset);
+        raster.enableVertexAttribArray(attribute.location);
+    }
+    raster.bindVertexArray(0);
+    return VAO;
+}
+
+// Draws the terrain for the given number of frames and returns milliseconds per frame
+double run(SoftwareRasterizer &raster, unsigned int program, unsigned int VAO, const CompactVertices &vertices, int indexCount, int frames, std::vector<uint32_t> &image)
+{
+    TerrainUniforms uniforms = {vertices.decode[0], vertices.decode[1], vertices.decode[2]};
+    raster.useProgram(program);
+    raster.setUniforms(&uniforms, sizeof(uniforms));
+    raster.bindVertexArray(VAO);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        raster.clear(GL_COLOR_BUFFER_BIT);
+        raster.drawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0);
+        raster.finish();
+    }
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+    image.assign(raster.pixels(), raster.pixels() + SCR_WIDTH * SCR_HEIGHT);
+    return milliseconds;
+}
+
+int main(int argc, char **argv)
+{
+    int gridSize = argc > 1 ? atoi(argv[1]) : 1024;
+    int frames = argc > 2 ? atoi(argv[2]) : 10;
+    unsigned int threads = argc > 3 ? (unsigned int)atoi(argv[3]) : 0;
+    if (gridSize < 2) {
+        gridSize = 2;
+    }
+
+    /* GEOMETRY STARTS HERE */
+
+    std::vector<TerrainVertex> terrain = buildTerrain(gridSize);
+    std::vector<unsigned int> indices;
+    indices.reserve((size_t)(gridSize - 1) * (gridSize - 1) * 6);
+    for (int row = 0; row + 1 < gridSize; row++) {
+        for (int column = 0; column + 1 < gridSize; column++) {
+            unsigned int corner = row * gridSize + column;
+            unsigned int quad[] = {corner, corner + 1, corner + gridSize, corner + 1, corner + gridSize + 1, corner + gridSize};
+            indices.insert(indices.end(), quad, quad + 6);
+        }
+    }
+
+    size_t terrainBytes = terrain.size() * sizeof(TerrainVertex);
+    const size_t POSITION = offsetof(TerrainVertex, position), NORMAL = offsetof(TerrainVertex, normal), COLOR = offsetof(TerrainVertex, color);
+
+    // The float layout goes through the converter unchanged, so both are set up the same way
+    CompactVertices floats = compactVertices(terrain.data(), terrainBytes, sizeof(TerrainVertex), {
+        {0, 3, POSITION, VERTEX_FORMAT_FLOAT}, {1, 3, NORMAL, VERTEX_FORMAT_FLOAT}, {2, 4, COLOR, VERTEX_FORMAT_FLOAT}
+    });
+
+    auto convertStart = std::chrono::steady_clock::now();
+    CompactVertices compact = compactVertices(terrain.data(), terrainBytes, sizeof(TerrainVertex), {
+        {0, 3, POSITION, VERTEX_FORMAT_HALF, true}, {1, 3, NORMAL, VERTEX_FORMAT_SNORM_2_10_10_10}, {2, 4, COLOR, VERTEX_FORMAT_UNORM8}
+    });
+    double convertMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - convertStart).count();
+
+    CompactVertices unbounded = compactVertices(terrain.data(), terrainBytes, sizeof(TerrainVertex), {
+        {0, 3, POSITION, VERTEX_FORMAT_HALF}, {1, 3, NORMAL, VERTEX_FORMAT_SNORM_2_10_10_10}, {2, 4, COLOR, VERTEX_FORMAT_UNORM8}
+    });
+
+    /* GEOMETRY ENDS HERE */
+
+    double floatMegabytes = floats.data.size() / 1048576.0, compactMegabytes = compact.data.size() / 1048576.0;
+    std::cout << terrain.size() << " vertices, " << indices.size() / 3 << " triangles" << std::endl;
+    std::cout << "float:   " << floats.stride << " bytes/vertex, " << floatMegabytes << " MB" << std::endl;
+    std::cout << "compact: " << compact.stride << " bytes/vertex, " << compactMegabytes << " MB ("
+              << 100.0 * (1.0 - compactMegabytes / floatMegabytes) << "% saved), converted in " << convertMilliseconds << " ms" << std::endl;
+
+    QuantizationError position = measureError(terrain, compact, 0, POSITION, 3);
+    QuantizationError unboundedPosition = measureError(terrain, unbounded, 0, POSITION, 3);
+    QuantizationError normal = measureError(terrain, compact, 1, NORMAL, 3);
+    QuantizationError color = measureError(terrain, compact, 2, COLOR, 4);
+    std::cout << "error: position " << position.maximum << " max / " << position.mean << " mean world units (without the bounding box "
+              << unboundedPosition.maximum << " / " << unboundedPosition.mean << "), normal " << normal.maximum << " / " << normal.mean
+              << ", colour " << color.maximum << " / " << color.mean << std::endl;
+
+    SoftwareRasterizer raster(SCR_WIDTH, SCR_HEIGHT, threads);
+    raster.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    unsigned int program = raster.createProgram({terrainVertexShader, terrainFragmentShader, 3, terrainFragmentShaderSpan});
+
+    unsigned int floatBuffers[2], compactBuffers[2];
+    unsigned int floatVAO = createVertexArray(raster, floats, floatBuffers, indices);
+    unsigned int compactVAO = createVertexArray(raster, compact, compactBuffers, indices);
+
+    std::vector<uint32_t> floatImage, compactImage;
+    double floatMilliseconds = run(raster, program, floatVAO, floats, (int)indices.size(), frames, floatImage);
+    double compactMilliseconds = run(raster, program, compactVAO, compact, (int)indices.size(), frames, compactImage);
+
+    // Vertex bandwidth: every vertex is read once a frame
+    std::cout << "threads: " << raster.threadCount() << ", frames: " << frames << std::endl;
+    std::cout << "float:   " << floatMilliseconds << " ms/frame, " << floatMegabytes << " MB of vertices read a frame (vertex data at "
+              << floatMegabytes / 1024.0 / (floatMilliseconds / 1000.0) << " GB/s)" << std::endl;
+    std::cout << "compact: " << compactMilliseconds << " ms/frame, " << compactMegabytes << " MB of vertices read a frame (vertex data at "
+              << compactMegabytes / 1024.0 / (compactMilliseconds / 1000.0) << " GB/s)" << std::endl;
+
+    // Quantization may move an edge or a colour step by a bit; count the pixels it changed and by how much
+    int differing = 0, largestStep = 0;
+    for (size_t i = 0; i < floatImage.size(); i++) {
+        differing += floatImage[i] != compactImage[i];
+        for (int shift = 0; shift < 32; shift += 8) {
+            int step = abs((int)((floatImage[i] >> shift) & 0xff) - (int)((compactImage[i] >> shift) & 0xff));
+            largestStep = std::max(largestStep, step);
+        }
+    }
+    std::cout << "pixels that differ: " << differing << " of " << floatImage.size() << ", by at most " << largestStep << "/255 a channel" << std::endl;
+
+    raster.deleteVertexArrays(1, &floatVAO);
+    raster.deleteVertexArrays(1, &compactVAO);
+    raster.deleteBuffers(2, floatBuffers);
+    raster.deleteBuffers(2, compactBuffers);
+    raster.deleteProgram(program);
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*
+    Vertex welding (renderer/mesh_builder.h) on imported-style triangle soup.
+    Builds a sphere as a plain triangle list, every triangle with its own three vertices (position
+    and normal, 24 bytes), the way non-indexed importers hand meshes over. Welding turns it into
+    unique vertices plus an index buffer; a small sphere gets 16-bit indices, a big one 32-bit.
+    Reports the memory before and after, the welding time, and the software rasterizer drawing
+    the soup with glDrawArrays against the welded mesh with glDrawElements, including how many
+    times the vertex stage ran.
+    Usage: bench_weld [segments of the big sphere] [frames] [threads]
+*/
+
+#include <renderer/mesh_builder.h>
+#include <renderer/software_rasterizer.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace renderer;
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+/* SHADERS START HERE */
+
+// Position straight to NDC, lit from the viewer by the normal
+void sphereVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    out.position = {in.attribs[0][0] * 0.75f, in.attribs[0][1], in.attribs[0][2] * 0.5f, 1.0f};
+    out.varyings[0] = 0.2f + 0.8f * std::max(-in.attribs[1][2], 0.0f);
+}
+
+void sphereFragmentShader(const float *varyings, float color[4], const void *uniforms)
+{
+    color[0] = varyings[0];
+    color[1] = varyings[0] * 0.8f;
+    color[2] = varyings[0] * 0.6f;
+    color[3] = 1.0f;
+}
+
+void sphereFragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = span.varyings[0][lane];
+        span.color[1][lane] = span.varyings[0][lane] * 0.8f;
+        span.color[2][lane] = span.varyings[0][lane] * 0.6f;
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+/* SHADERS END HERE */
+
+struct SphereVertex {
+    float position[3];
+    float normal[3];
+};
+
+// A unit sphere as triangle soup; the poles and the seam repeat positions exactly, as an export would
+std::vector<SphereVertex> buildSphereSoup(int segments)
+{
+    int rings = segments / 2;
+    auto vertex = [&](int ring, int segment) {
+        const float PI = 3.14159265358979f;
+        float theta = PI * ring / rings, phi = 2.0f * PI * (segment % segments) / segments;
+        // Pin the poles, so every triangle touching one shares that vertex
+        float sinTheta = ring == 0 || ring == rings ? 0.0f : sinf(theta);
+        float cosTheta = ring == 0 ? 1.0f : ring == rings ? -1.0f : cosf(theta);
+        SphereVertex v;
+        v.position[0] = v.normal[0] = sinTheta * cosf(phi);
+        v.position[1] = v.normal[1] = cosTheta;
+        v.position[2] = v.normal[2] = sinTheta * sinf(phi);
+        return v;
+    };
+
+    std::vector<SphereVertex> soup;
+    soup.reserve((size_t)rings * segments * 6);
+    for (int ring = 0; ring < rings; ring++) {
+        for (int segment = 0; segment < segments; segment++) {
+            SphereVertex quad[] = {vertex(ring, segment), vertex(ring + 1, segment), vertex(ring + 1, segment + 1), vertex(ring, segment + 1)};
+            if (ring != 0) {
+                soup.push_back(quad[0]);
+                soup.push_back(quad[1]);
+                soup.push_back(quad[3]);
+            }
+            if (ring != rings - 1) {
+                soup.push_back(quad[1]);
+                soup.push_back(quad[2]);
+                soup.push_back(quad[3]);
+            }
+        }
+    }
+    return soup;
+}
+
+// Sets up a VAO over one buffer of SphereVertex, plus an element buffer when indices are given
+unsigned int createVertexArray(SoftwareRasterizer &raster, const void *vertices, size_t vertexBytes,
+                               const std::vector<unsigned char> &indices, unsigned int buffers[2])
+{
+    unsigned int VAO;
+    raster.genVertexArrays(1, &VAO);
+    raster.genBuffers(2, buffers);
+    raster.bindVertexArray(VAO);
+    raster.bindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+    raster.bufferData(GL_ARRAY_BUFFER, vertexBytes, vertices, GL_STATIC_DRAW);
+    if (!indices.empty()) {
+        raster.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+        raster.bufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size(), indices.data(), GL_STATIC_DRAW);
+    }
+    raster.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(SphereVertex), (void*)0);
+    raster.enableVertexAttribArray(0);
+    raster.vertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(SphereVertex), (void*)(3 * sizeof(float)));
+    raster.enableVertexAttribArray(1);
+    raster.bindVertexArray(0);
+    return VAO;
+}
+
+// Milliseconds per frame; shaded is the number of vertex shader runs per frame
+double run(SoftwareRasterizer &raster, unsigned int VAO, int count, GLenum indexType, int frames, unsigned long long &shaded, unsigned long long &checksum)
+{
+    raster.bindVertexArray(VAO);
+    raster.clear(GL_COLOR_BUFFER_BIT);
+    raster.finish();
+    raster.resetStats();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        raster.clear(GL_COLOR_BUFFER_BIT);
+        if (indexType == GL_NONE) {
+            raster.drawArrays(GL_TRIANGLES, 0, count);
+        } else {
+            raster.drawElements(GL_TRIANGLES, count, indexType, 0);
+        }
+        raster.finish();
+    }
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+    shaded = raster.stats().vertices / frames;
+
+    const uint32_t *pixels = raster.pixels();
+    checksum = FNV_OFFSET_BASIS;
+    for (unsigned int i = 0; i < SCR_WIDTH * SCR_HEIGHT; i++) {
+        checksum = (checksum ^ pixels[i]) * FNV_PRIME;
+    }
+    return milliseconds;
+}
+
+bool benchSphere(SoftwareRasterizer &raster, int segments, int frames)
+{
+    std::vector<SphereVertex> soup = buildSphereSoup(segments);
+    size_t soupBytes = soup.size() * sizeof(SphereVertex);
+
+    auto weldStart = std::chrono::steady_clock::now();
+    MeshBuilder builder(sizeof(SphereVertex), soup.size() / 4);
+    builder.addVertices(soup.data(), soupBytes);
+    std::vector<unsigned char> indices = builder.indexBuffer();
+    double weldMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - weldStart).count();
+
+    size_t weldedBytes = builder.vertexBytes() + indices.size();
+    std::cout << "sphere, " << segments << " segments: " << soup.size() / 3 << " triangles" << std::endl;
+    std::cout << "  soup:   " << soup.size() << " vertices, " << soupBytes / 1024.0 << " KB" << std::endl;
+    std::cout << "  welded: " << builder.vertexCount() << " vertices + " << builder.indexCount() << " "
+              << (builder.indexType() == GL_UNSIGNED_SHORT ? "16" : "32") << "-bit indices, " << weldedBytes / 1024.0 << " KB ("
+              << 100.0 * (1.0 - (double)weldedBytes / soupBytes) << "% saved), welded in " << weldMilliseconds << " ms" << std::endl;
+
+    unsigned int soupBuffers[2], weldedBuffers[2];
+    unsigned int soupVAO = createVertexArray(raster, soup.data(), soupBytes, std::vector<unsigned char>(), soupBuffers);
+    unsigned int weldedVAO = createVertexArray(raster, builder.vertices(), builder.vertexBytes(), indices, weldedBuffers);
+
+    unsigned long long soupShaded, weldedShaded, soupChecksum, weldedChecksum;
+    double soupMilliseconds = run(raster, soupVAO, (int)soup.size(), GL_NONE, frames, soupShaded, soupChecksum);
+    double weldedMilliseconds = run(raster, weldedVAO, (int)builder.indexCount(), builder.indexType(), frames, weldedShaded, weldedChecksum);
+    std::cout << "  glDrawArrays:   " << soupMilliseconds << " ms/frame, " << soupShaded << " vertex shader runs" << std::endl;
+    std::cout << "  glDrawElements: " << weldedMilliseconds << " ms/frame, " << weldedShaded << " vertex shader runs" << std::endl;
+
+    raster.deleteVertexArrays(1, &soupVAO);
+    raster.deleteVertexArrays(1, &weldedVAO);
+    raster.deleteBuffers(2, soupBuffers);
+    raster.deleteBuffers(2, weldedBuffers);
+
+    // Same triangles, same vertices: the images must match
+    if (soupChecksum != weldedChecksum) {
+        std::cout << "ERROR::BENCH::OUTPUT_DIFFERS welded and soup frames don't match" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    int segments = argc > 1 ? atoi(argv[1]) : 1024;
+    int frames = argc > 2 ? atoi(argv[2]) : 10;
+    unsigned int threads = argc > 3 ? (unsigned int)atoi(argv[3]) : 0;
+
+    SoftwareRasterizer raster(SCR_WIDTH, SCR_HEIGHT, threads);
+    raster.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    unsigned int program = raster.createProgram({sphereVertexShader, sphereFragmentShader, 1, sphereFragmentShaderSpan});
+    raster.useProgram(program);
+    std::cout << "threads: " << raster.threadCount() << ", frames: " << frames << std::endl;
+
+    // Small enough for 16-bit indices, then the big one
+    bool matched = benchSphere(raster, 128, frames) && benchSphere(raster, segments, frames);
+
+    raster.deleteProgram(program);
+    return matched ? 0 : 1;
+}
@@ -0,0 +1,253 @@
+/*
+    One GL context per worker thread, each rendering offscreen through its own glad dispatch
+    table. GLFW only creates windows on the main thread, so main creates a hidden window (and
+    with it a context) per worker; each worker then makes that context current, loads glad
+    into a fresh gladGLcontext and renders frames of a spinning triangle into its own
+    framebuffer object. The last frame is read back and its checksum printed per worker.
+    Usage: contexts [threads] [frames]
+    Needs glad built with per-context tables: make f=contexts context=1
+*/
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <renderer/hash.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#ifndef GLAD_PER_CONTEXT
+#error "contexts.cpp calls GL from several threads at once; build with -DGLAD_PER_CONTEXT (make context=1)"
+#endif
+
+
+const unsigned int TARGET_WIDTH = 256;
+const unsigned int TARGET_HEIGHT = 256;
+
+// Vertex shader source code
+const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "uniform float angle;\n"
+    "void main()\n"
+    "{\n"
+    "    float c = cos(angle), s = sin(angle);\n"
+    "    gl_Position = vec4(c * aPos.x - s * aPos.y, s * aPos.x + c * aPos.y, aPos.z, 1.0f);\n"
+    "}\0";
+
+// Fragment shader source code
+const char *fragmentShaderSource = "#version 330 core\n"
+    "uniform vec3 color;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(color, 1.0f);\n"
+    "}\0";
+
+struct WorkerResult {
+    bool loaded;
+    int major, minor;
+    double milliseconds;
+    uint64_t checksum;
+};
+
+unsigned int buildProgram();
+void renderWorker(GLFWwindow *window, int worker, int frames, WorkerResult *result);
+
+int main(int argc, char **argv)
+{
+    int threadCount = argc > 1 ? atoi(argv[1]) : 4;
+    int frames = argc > 2 ? atoi(argv[2]) : 500;
+    if (threadCount < 1) {
+        threadCount = 1;
+    }
+    if (frames < 1) {
+        frames = 1;
+    }
+
+    /* GLFW STARTS HERE */
+
+    // Initialize GLFW and set it up
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+    // The windows only carry the contexts; everything is drawn into framebuffer objects
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    /* WINDOWS START HERE */
+
+    std::vector<GLFWwindow *> windows;
+    for (int i = 0; i < threadCount; i++) {
+        GLFWwindow *window = glfwCreateWindow(TARGET_WIDTH, TARGET_HEIGHT, "LearnOpenGL", NULL, NULL);
+        if (window == NULL) {
+            std::cout << "Failed to create GLFW window" << std::endl;
+            glfwTerminate();
+            return -1;
+        }
+        windows.push_back(window);
+    }
+
+    /* WINDOWS END HERE */
+    /* RENDERING STARTS HERE */
+
+    std::vector<WorkerResult> results(threadCount);
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < threadCount; i++) {
+        workers.emplace_back(renderWorker, windows[i], i, frames, &results[i]);
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    double totalMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    /* RENDERING ENDS HERE */
+
+    int failed = 0;
+    for (int i = 0; i < threadCount; i++) {
+        const WorkerResult &result = results[i];
+        if (!result.loaded) {
+            std::cout << "worker " << i << ": Failed to initialize GLAD" << std::endl;
+            failed++;
+            continue;
+        }
+        std::cout << "worker " << i << ": GL " << result.major << "." << result.minor << ", " << frames << " frames in "
+                  << result.milliseconds << " ms, checksum " << std::hex << result.checksum << std::dec << std::endl;
+    }
+    std::cout << threadCount << " contexts, " << (long long)frames * threadCount << " frames in " << totalMilliseconds << " ms" << std::endl;
+
+    // Close GLFW
+    for (GLFWwindow *window : windows) {
+        glfwDestroyWindow(window);
+    }
+    glfwTerminate();
+    return failed == 0 ? 0 : -1;
+
+    /* GLFW ENDS HERE */
+}
+
+// Everything here runs on the worker's thread, against the worker's own context and dispatch table
+void renderWorker(GLFWwindow *window, int worker, int frames, WorkerResult *result)
+{
+    *result = {false, 0, 0, 0.0, 0};
+    auto start = std::chrono::steady_clock::now();
+
+    glfwMakeContextCurrent(window);
+    struct gladGLcontext *table = gladCreateContext();
+    gladMakeContextCurrent(table);
+    if (table == NULL || !gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        gladDestroyContext(table);
+        glfwMakeContextCurrent(NULL);
+        return;
+    }
+    result->loaded = true;
+    result->major = GLVersion.major;
+    result->minor = GLVersion.minor;
+
+    // Offscreen colour target
+    unsigned int FBO, colorTexture;
+    glGenTextures(1, &colorTexture);
+    glBindTexture(GL_TEXTURE_2D, colorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, TARGET_WIDTH, TARGET_HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glGenFramebuffers(1, &FBO);
+    glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cout << "ERROR::FRAMEBUFFER::INCOMPLETE" << std::endl;
+    }
+    glViewport(0, 0, TARGET_WIDTH, TARGET_HEIGHT);
+
+    unsigned int shaderProgram = buildProgram();
+    glUseProgram(shaderProgram);
+    int angleLocation = glGetUniformLocation(shaderProgram, "angle");
+
+    // Every worker gets its own colour, so the checksums differ between workers but not between runs
+    float hue = (float)worker * 2.399963f;
+    glUniform3f(glGetUniformLocation(shaderProgram, "color"), 0.5f + 0.5f * cosf(hue), 0.5f + 0.5f * cosf(hue + 2.094f), 0.5f + 0.5f * cosf(hue + 4.189f));
+
+    float vertices[] = {
+        -0.5f, -0.5f, 0.0f,  // left-corner
+         0.5f, -0.5f, 0.0f,  // right-corner
+         0.0f,  0.5f, 0.0f   // top
+    };
+    unsigned int VBO, VAO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    for (int frame = 0; frame < frames; frame++) {
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUniform1f(angleLocation, frame * 0.01f);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    // Reading the last frame back also waits for all of them
+    std::vector<unsigned char> pixels((size_t)TARGET_WIDTH * TARGET_HEIGHT * 4);
+    glReadPixels(0, 0, TARGET_WIDTH, TARGET_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    result->checksum = renderer::hashBytes(pixels.data(), pixels.size());
+    result->milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // De-allocate all remaining resources
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    glDeleteProgram(shaderProgram);
+    glDeleteFramebuffers(1, &FBO);
+    glDeleteTextures(1, &colorTexture);
+
+    gladDestroyContext(table);
+    glfwMakeContextCurrent(NULL);
+}
+
+// Compiles and links the two shaders above
+unsigned int buildProgram()
+{
+    int success;
+    char infoLog[512];
+
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
+    glCompileShader(vertexShader);
+    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
+        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+    }
+
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fragmentShader);
+    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
+        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+    }
+
+    unsigned int shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, vertexShader);
+    glAttachShader(shaderProgram, fragmentShader);
+    glLinkProgram(shaderProgram);
+    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    if (!success) {
+        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
+        std::cout << "ERROR::SHADER_PROGRAM::COMPILATION_FAILED" << std::endl;
+    }
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    return shaderProgram;
+}
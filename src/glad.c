@@ -7,16 +7,18 @@
     APIs: gl=3.3
     Profile: compatibility
     Extensions:
-        
+        GL_ARB_buffer_storage
+        GL_ARB_get_program_binary
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="compatibility" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="compatibility" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_get_program_binary,GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_buffer_storage,GL_ARB_get_program_binary,GL_KHR_parallel_shader_compile
 */
 
 #include <stdio.h>
@@ -156,105 +158,221 @@ int gladLoadGL(void) {
     return status;
 }
 
+#ifdef GLAD_PER_CONTEXT
+GLAD_THREAD_LOCAL struct gladGLcontext *glad_gl_context = NULL;
+#else
 struct gladGLversionStruct GLVersion = { 0, 0 };
+#endif
 
 #if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
 #define _GLAD_IS_SOME_NEW_VERSION 1
 #endif
 
+#ifdef GLAD_PER_CONTEXT
+#define max_loaded_major (glad_gl_context->max_loaded_major)
+#define max_loaded_minor (glad_gl_context->max_loaded_minor)
+#else
 static int max_loaded_major;
 static int max_loaded_minor;
+#endif
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
-
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
+/* Extension names are interned once per load into a single arena and indexed by an
+   open-addressing FNV-1a hash table, so has_ext() and gladHasExtension() cost one hash
+   and usually one strcmp. The table stays alive until the next load. */
+#ifdef GLAD_PER_CONTEXT
+#define exts_arena (glad_gl_context->exts_arena)
+#define exts_table (glad_gl_context->exts_table)
+#define exts_mask (glad_gl_context->exts_mask)
+#else
+static char *exts_arena = NULL;
+static unsigned int *exts_table = NULL; /* offset into exts_arena + 1, 0 marks an empty slot */
+static unsigned int exts_mask = 0;
 #endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
 
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
+static unsigned int hash_ext(const char *name) {
+    unsigned int hash = 2166136261u;
+    while(*name) {
+        hash = (hash ^ (unsigned char)*name++) * 16777619u;
+    }
+    return hash;
+}
 
-        if (exts_i == NULL) {
-            return 0;
-        }
+static void free_exts(void) {
+    free((void *)exts_table);
+    free((void *)exts_arena);
+    exts_table = NULL;
+    exts_arena = NULL;
+    exts_mask = 0;
+}
 
-        for(index = 0; index < num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+static void insert_ext(unsigned int offset) {
+    const char *name = exts_arena + offset;
+    unsigned int slot = hash_ext(name) & exts_mask;
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
+    while(exts_table[slot] != 0) {
+        if(strcmp(exts_arena + exts_table[slot] - 1, name) == 0) {
+            return;
         }
+        slot = (slot + 1) & exts_mask;
     }
-#endif
-    return 1;
+    exts_table[slot] = offset + 1;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
+/* Sizes the table for count names (load factor at most 1/2) and inserts the first count names of the arena */
+static int build_exts_table(int count) {
+    unsigned int size = 16, offset = 0;
+    int index;
+
+    while(size < (unsigned int)count * 2) {
+        size *= 2;
+    }
+    exts_table = (unsigned int *)calloc(size, sizeof *exts_table);
+    if(exts_table == NULL) {
+        return 0;
+    }
+    exts_mask = size - 1;
+
+    for(index = 0; index < count; index++) {
+        insert_ext(offset);
+        offset += (unsigned int)strlen(exts_arena + offset) + 1;
     }
+    return 1;
 }
 
-static int has_ext(const char *ext) {
+static int get_exts(void) {
+    int count = 0;
+
+    free_exts();
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
+        /* One space separated string: copy it and cut it into names in place */
+        const char *extensions = (const char *)glGetString(GL_EXTENSIONS);
+        size_t length, read, write = 0;
+        if(extensions == NULL) {
             return 0;
         }
 
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
+        length = strlen(extensions);
+        exts_arena = (char *)malloc(length + 1);
+        if(exts_arena == NULL) {
+            return 0;
+        }
+        for(read = 0; read <= length; read++) {
+            char ch = extensions[read];
+            if(ch == ' ' || ch == '\0') {
+                if(write > 0 && exts_arena[write - 1] != '\0') {
+                    exts_arena[write++] = '\0';
+                    count++;
+                }
+            } else {
+                exts_arena[write++] = ch;
             }
-            extensions = terminator;
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
         int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+        size_t total = 0;
+        const char **names;
+
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        if(count < 0) {
+            count = 0;
+        }
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
+        /* Ask for every name once, then copy them all into a single allocation */
+        names = (const char **)malloc(((size_t)count + 1) * sizeof *names);
+        if(names == NULL) {
+            return 0;
+        }
+        for(index = 0; index < count; index++) {
+            names[index] = (const char *)glGetStringi(GL_EXTENSIONS, (GLuint)index);
+            if(names[index] == NULL) {
+                names[index] = "";
             }
+            total += strlen(names[index]) + 1;
         }
+
+        exts_arena = (char *)malloc(total + 1);
+        if(exts_arena == NULL) {
+            free((void *)names);
+            return 0;
+        }
+        total = 0;
+        for(index = 0; index < count; index++) {
+            size_t length = strlen(names[index]) + 1;
+            memcpy(exts_arena + total, names[index], length);
+            total += length;
+        }
+        free((void *)names);
     }
 #endif
 
+    if(!build_exts_table(count)) {
+        free_exts();
+        return 0;
+    }
+    return 1;
+}
+
+static int has_ext(const char *ext) {
+    unsigned int slot;
+
+    if(exts_table == NULL || ext == NULL) {
+        return 0;
+    }
+
+    for(slot = hash_ext(ext) & exts_mask; exts_table[slot] != 0; slot = (slot + 1) & exts_mask) {
+        if(strcmp(exts_arena + exts_table[slot] - 1, ext) == 0) {
+            return 1;
+        }
+    }
     return 0;
 }
+
+int gladHasExtension(const char *name) {
+#ifdef GLAD_PER_CONTEXT
+    if(glad_gl_context == NULL) {
+        return 0;
+    }
+#endif
+    return has_ext(name);
+}
+
+#ifdef GLAD_PER_CONTEXT
+struct gladGLcontext *gladCreateContext(void) {
+    return (struct gladGLcontext *)calloc(1, sizeof(struct gladGLcontext));
+}
+
+void gladDestroyContext(struct gladGLcontext *context) {
+    struct gladGLcontext *current = glad_gl_context;
+
+    if(context == NULL) {
+        return;
+    }
+    /* free_exts() works on the current context */
+    glad_gl_context = context;
+    free_exts();
+    glad_gl_context = current == context ? NULL : current;
+    free((void *)context);
+}
+
+void gladMakeContextCurrent(struct gladGLcontext *context) {
+    glad_gl_context = context;
+}
+
+struct gladGLcontext *gladGetCurrentContext(void) {
+    return glad_gl_context;
+}
+
+/* Loading needs a table to fill; a thread that never made one current gets its own */
+static int ensure_context(void) {
+    if(glad_gl_context == NULL) {
+        glad_gl_context = gladCreateContext();
+    }
+    return glad_gl_context != NULL;
+}
+#else
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -267,6 +385,11 @@ int GLAD_GL_VERSION_3_0 = 0;
 int GLAD_GL_VERSION_3_1 = 0;
 int GLAD_GL_VERSION_3_2 = 0;
 int GLAD_GL_VERSION_3_3 = 0;
+int GLAD_GL_ARB_get_program_binary = 0;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
+int GLAD_GL_ARB_buffer_storage = 0;
+#endif
+#ifndef GLAD_CORE_ONLY
 PFNGLACCUMPROC glad_glAccum = NULL;
 PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
 PFNGLALPHAFUNCPROC glad_glAlphaFunc = NULL;
@@ -991,6 +1114,14 @@ PFNGLWINDOWPOS3IPROC glad_glWindowPos3i = NULL;
 PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv = NULL;
 PFNGLWINDOWPOS3SPROC glad_glWindowPos3s = NULL;
 PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv = NULL;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
+#elif !defined(GLAD_PER_CONTEXT)
+struct gladGLdispatchStruct glad_gl;
+#endif
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1041,6 +1172,7 @@ static void load_GL_VERSION_1_0(GLADloadproc load) {
 	glad_glIsEnabled = (PFNGLISENABLEDPROC)load("glIsEnabled");
 	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)load("glDepthRange");
 	glad_glViewport = (PFNGLVIEWPORTPROC)load("glViewport");
+#ifndef GLAD_CORE_ONLY
 	glad_glNewList = (PFNGLNEWLISTPROC)load("glNewList");
 	glad_glEndList = (PFNGLENDLISTPROC)load("glEndList");
 	glad_glCallList = (PFNGLCALLLISTPROC)load("glCallList");
@@ -1299,6 +1431,7 @@ static void load_GL_VERSION_1_0(GLADloadproc load) {
 	glad_glScalef = (PFNGLSCALEFPROC)load("glScalef");
 	glad_glTranslated = (PFNGLTRANSLATEDPROC)load("glTranslated");
 	glad_glTranslatef = (PFNGLTRANSLATEFPROC)load("glTranslatef");
+#endif
 }
 static void load_GL_VERSION_1_1(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_1) return;
@@ -1316,6 +1449,7 @@ static void load_GL_VERSION_1_1(GLADloadproc load) {
 	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
 	glad_glGenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
 	glad_glIsTexture = (PFNGLISTEXTUREPROC)load("glIsTexture");
+#ifndef GLAD_CORE_ONLY
 	glad_glArrayElement = (PFNGLARRAYELEMENTPROC)load("glArrayElement");
 	glad_glColorPointer = (PFNGLCOLORPOINTERPROC)load("glColorPointer");
 	glad_glDisableClientState = (PFNGLDISABLECLIENTSTATEPROC)load("glDisableClientState");
@@ -1332,6 +1466,7 @@ static void load_GL_VERSION_1_1(GLADloadproc load) {
 	glad_glIndexubv = (PFNGLINDEXUBVPROC)load("glIndexubv");
 	glad_glPopClientAttrib = (PFNGLPOPCLIENTATTRIBPROC)load("glPopClientAttrib");
 	glad_glPushClientAttrib = (PFNGLPUSHCLIENTATTRIBPROC)load("glPushClientAttrib");
+#endif
 }
 static void load_GL_VERSION_1_2(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_2) return;
@@ -1351,6 +1486,7 @@ static void load_GL_VERSION_1_3(GLADloadproc load) {
 	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)load("glCompressedTexSubImage2D");
 	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)load("glCompressedTexSubImage1D");
 	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)load("glGetCompressedTexImage");
+#ifndef GLAD_CORE_ONLY
 	glad_glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)load("glClientActiveTexture");
 	glad_glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)load("glMultiTexCoord1d");
 	glad_glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)load("glMultiTexCoord1dv");
@@ -1388,6 +1524,7 @@ static void load_GL_VERSION_1_3(GLADloadproc load) {
 	glad_glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)load("glLoadTransposeMatrixd");
 	glad_glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)load("glMultTransposeMatrixf");
 	glad_glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)load("glMultTransposeMatrixd");
+#endif
 }
 static void load_GL_VERSION_1_4(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_4) return;
@@ -1398,6 +1535,7 @@ static void load_GL_VERSION_1_4(GLADloadproc load) {
 	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)load("glPointParameterfv");
 	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)load("glPointParameteri");
 	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)load("glPointParameteriv");
+#ifndef GLAD_CORE_ONLY
 	glad_glFogCoordf = (PFNGLFOGCOORDFPROC)load("glFogCoordf");
 	glad_glFogCoordfv = (PFNGLFOGCOORDFVPROC)load("glFogCoordfv");
 	glad_glFogCoordd = (PFNGLFOGCOORDDPROC)load("glFogCoordd");
@@ -1436,6 +1574,7 @@ static void load_GL_VERSION_1_4(GLADloadproc load) {
 	glad_glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)load("glWindowPos3iv");
 	glad_glWindowPos3s = (PFNGLWINDOWPOS3SPROC)load("glWindowPos3s");
 	glad_glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)load("glWindowPos3sv");
+#endif
 	glad_glBlendColor = (PFNGLBLENDCOLORPROC)load("glBlendColor");
 	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)load("glBlendEquation");
 }
@@ -1723,6 +1862,7 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)load("glVertexAttribP3uiv");
 	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)load("glVertexAttribP4ui");
 	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)load("glVertexAttribP4uiv");
+#ifndef GLAD_CORE_ONLY
 	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)load("glVertexP2ui");
 	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)load("glVertexP2uiv");
 	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)load("glVertexP3ui");
@@ -1753,11 +1893,27 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)load("glColorP4uiv");
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
+#endif
+}
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
 }
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
+	GLAD_GL_ARB_buffer_storage = has_ext("GL_ARB_buffer_storage");
+	GLAD_GL_KHR_parallel_shader_compile = has_ext("GL_KHR_parallel_shader_compile");
+	GLAD_GL_ARB_get_program_binary = has_ext("GL_ARB_get_program_binary");
 	return 1;
 }
 
@@ -1816,6 +1972,9 @@ static void find_coreGL(void) {
 }
 
 int gladLoadGLLoader(GLADloadproc load) {
+#ifdef GLAD_PER_CONTEXT
+	if(!ensure_context()) return 0;
+#endif
 	GLVersion.major = 0; GLVersion.minor = 0;
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
 	if(glGetString == NULL) return 0;
@@ -1835,6 +1994,4646 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_3(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_buffer_storage(load);
+	load_GL_KHR_parallel_shader_compile(load);
+	load_GL_ARB_get_program_binary(load);
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+/* Lazy loading: gladLoadGLLoaderLazy() points every function at a trampoline that resolves
+   the real entry point on its first call and patches the pointer, unless something (a wrapper
+   layer) replaced it in the meantime. The loader must stay valid after it returns. */
+#ifdef GLAD_PER_CONTEXT
+#define glad_lazy_loader (glad_gl_context->lazy_loader)
+#define glad_lazy_resolved (glad_gl_context->lazy_resolved)
+#else
+static GLADloadproc glad_lazy_loader = NULL;
+static void *glad_lazy_resolved[GLAD_GL_FUNCTION_COUNT];
+#endif
+
+#define GLAD_LAZY_RESOLVE(index, name, pfn) \
+	pfn resolved = (pfn)glad_lazy_resolved[index]; \
+	if(resolved == NULL) { \
+		resolved = (pfn)glad_lazy_loader(#name); \
+		glad_lazy_resolved[index] = (void*)resolved; \
+		if(glad_##name == glad_lazy_##name) glad_##name = resolved; \
+	}
+
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) { GLAD_LAZY_RESOLVE(0, glCullFace, PFNGLCULLFACEPROC) resolved(mode); }
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) { GLAD_LAZY_RESOLVE(1, glFrontFace, PFNGLFRONTFACEPROC) resolved(mode); }
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) { GLAD_LAZY_RESOLVE(2, glHint, PFNGLHINTPROC) resolved(target, mode); }
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) { GLAD_LAZY_RESOLVE(3, glLineWidth, PFNGLLINEWIDTHPROC) resolved(width); }
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) { GLAD_LAZY_RESOLVE(4, glPointSize, PFNGLPOINTSIZEPROC) resolved(size); }
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) { GLAD_LAZY_RESOLVE(5, glPolygonMode, PFNGLPOLYGONMODEPROC) resolved(face, mode); }
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { GLAD_LAZY_RESOLVE(6, glScissor, PFNGLSCISSORPROC) resolved(x, y, width, height); }
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(7, glTexParameterf, PFNGLTEXPARAMETERFPROC) resolved(target, pname, param); }
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) { GLAD_LAZY_RESOLVE(8, glTexParameterfv, PFNGLTEXPARAMETERFVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(9, glTexParameteri, PFNGLTEXPARAMETERIPROC) resolved(target, pname, param); }
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) { GLAD_LAZY_RESOLVE(10, glTexParameteriv, PFNGLTEXPARAMETERIVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { GLAD_LAZY_RESOLVE(11, glTexImage1D, PFNGLTEXIMAGE1DPROC) resolved(target, level, internalformat, width, border, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { GLAD_LAZY_RESOLVE(12, glTexImage2D, PFNGLTEXIMAGE2DPROC) resolved(target, level, internalformat, width, height, border, format, type, pixels); }
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) { GLAD_LAZY_RESOLVE(13, glDrawBuffer, PFNGLDRAWBUFFERPROC) resolved(buf); }
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) { GLAD_LAZY_RESOLVE(14, glClear, PFNGLCLEARPROC) resolved(mask); }
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { GLAD_LAZY_RESOLVE(15, glClearColor, PFNGLCLEARCOLORPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glClearStencil(GLint s) { GLAD_LAZY_RESOLVE(16, glClearStencil, PFNGLCLEARSTENCILPROC) resolved(s); }
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) { GLAD_LAZY_RESOLVE(17, glClearDepth, PFNGLCLEARDEPTHPROC) resolved(depth); }
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) { GLAD_LAZY_RESOLVE(18, glStencilMask, PFNGLSTENCILMASKPROC) resolved(mask); }
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { GLAD_LAZY_RESOLVE(19, glColorMask, PFNGLCOLORMASKPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) { GLAD_LAZY_RESOLVE(20, glDepthMask, PFNGLDEPTHMASKPROC) resolved(flag); }
+static void APIENTRY glad_lazy_glDisable(GLenum cap) { GLAD_LAZY_RESOLVE(21, glDisable, PFNGLDISABLEPROC) resolved(cap); }
+static void APIENTRY glad_lazy_glEnable(GLenum cap) { GLAD_LAZY_RESOLVE(22, glEnable, PFNGLENABLEPROC) resolved(cap); }
+static void APIENTRY glad_lazy_glFinish(void) { GLAD_LAZY_RESOLVE(23, glFinish, PFNGLFINISHPROC) resolved(); }
+static void APIENTRY glad_lazy_glFlush(void) { GLAD_LAZY_RESOLVE(24, glFlush, PFNGLFLUSHPROC) resolved(); }
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) { GLAD_LAZY_RESOLVE(25, glBlendFunc, PFNGLBLENDFUNCPROC) resolved(sfactor, dfactor); }
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) { GLAD_LAZY_RESOLVE(26, glLogicOp, PFNGLLOGICOPPROC) resolved(opcode); }
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) { GLAD_LAZY_RESOLVE(27, glStencilFunc, PFNGLSTENCILFUNCPROC) resolved(func, ref, mask); }
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) { GLAD_LAZY_RESOLVE(28, glStencilOp, PFNGLSTENCILOPPROC) resolved(fail, zfail, zpass); }
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) { GLAD_LAZY_RESOLVE(29, glDepthFunc, PFNGLDEPTHFUNCPROC) resolved(func); }
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(30, glPixelStoref, PFNGLPIXELSTOREFPROC) resolved(pname, param); }
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(31, glPixelStorei, PFNGLPIXELSTOREIPROC) resolved(pname, param); }
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) { GLAD_LAZY_RESOLVE(32, glReadBuffer, PFNGLREADBUFFERPROC) resolved(src); }
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { GLAD_LAZY_RESOLVE(33, glReadPixels, PFNGLREADPIXELSPROC) resolved(x, y, width, height, format, type, pixels); }
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) { GLAD_LAZY_RESOLVE(34, glGetBooleanv, PFNGLGETBOOLEANVPROC) resolved(pname, data); }
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) { GLAD_LAZY_RESOLVE(35, glGetDoublev, PFNGLGETDOUBLEVPROC) resolved(pname, data); }
+static GLenum APIENTRY glad_lazy_glGetError(void) { GLAD_LAZY_RESOLVE(36, glGetError, PFNGLGETERRORPROC) return resolved(); }
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) { GLAD_LAZY_RESOLVE(37, glGetFloatv, PFNGLGETFLOATVPROC) resolved(pname, data); }
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) { GLAD_LAZY_RESOLVE(38, glGetIntegerv, PFNGLGETINTEGERVPROC) resolved(pname, data); }
+static const GLubyte *APIENTRY glad_lazy_glGetString(GLenum name) { GLAD_LAZY_RESOLVE(39, glGetString, PFNGLGETSTRINGPROC) return resolved(name); }
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { GLAD_LAZY_RESOLVE(40, glGetTexImage, PFNGLGETTEXIMAGEPROC) resolved(target, level, format, type, pixels); }
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) { GLAD_LAZY_RESOLVE(41, glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(42, glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) { GLAD_LAZY_RESOLVE(43, glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC) resolved(target, level, pname, params); }
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(44, glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC) resolved(target, level, pname, params); }
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) { GLAD_LAZY_RESOLVE(45, glIsEnabled, PFNGLISENABLEDPROC) return resolved(cap); }
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) { GLAD_LAZY_RESOLVE(46, glDepthRange, PFNGLDEPTHRANGEPROC) resolved(n, f); }
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { GLAD_LAZY_RESOLVE(47, glViewport, PFNGLVIEWPORTPROC) resolved(x, y, width, height); }
+#ifndef GLAD_CORE_ONLY
+static void APIENTRY glad_lazy_glNewList(GLuint list, GLenum mode) { GLAD_LAZY_RESOLVE(48, glNewList, PFNGLNEWLISTPROC) resolved(list, mode); }
+static void APIENTRY glad_lazy_glEndList(void) { GLAD_LAZY_RESOLVE(49, glEndList, PFNGLENDLISTPROC) resolved(); }
+static void APIENTRY glad_lazy_glCallList(GLuint list) { GLAD_LAZY_RESOLVE(50, glCallList, PFNGLCALLLISTPROC) resolved(list); }
+static void APIENTRY glad_lazy_glCallLists(GLsizei n, GLenum type, const void *lists) { GLAD_LAZY_RESOLVE(51, glCallLists, PFNGLCALLLISTSPROC) resolved(n, type, lists); }
+static void APIENTRY glad_lazy_glDeleteLists(GLuint list, GLsizei range) { GLAD_LAZY_RESOLVE(52, glDeleteLists, PFNGLDELETELISTSPROC) resolved(list, range); }
+static GLuint APIENTRY glad_lazy_glGenLists(GLsizei range) { GLAD_LAZY_RESOLVE(53, glGenLists, PFNGLGENLISTSPROC) return resolved(range); }
+static void APIENTRY glad_lazy_glListBase(GLuint base) { GLAD_LAZY_RESOLVE(54, glListBase, PFNGLLISTBASEPROC) resolved(base); }
+static void APIENTRY glad_lazy_glBegin(GLenum mode) { GLAD_LAZY_RESOLVE(55, glBegin, PFNGLBEGINPROC) resolved(mode); }
+static void APIENTRY glad_lazy_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) { GLAD_LAZY_RESOLVE(56, glBitmap, PFNGLBITMAPPROC) resolved(width, height, xorig, yorig, xmove, ymove, bitmap); }
+static void APIENTRY glad_lazy_glColor3b(GLbyte red, GLbyte green, GLbyte blue) { GLAD_LAZY_RESOLVE(57, glColor3b, PFNGLCOLOR3BPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3bv(const GLbyte *v) { GLAD_LAZY_RESOLVE(58, glColor3bv, PFNGLCOLOR3BVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor3d(GLdouble red, GLdouble green, GLdouble blue) { GLAD_LAZY_RESOLVE(59, glColor3d, PFNGLCOLOR3DPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(60, glColor3dv, PFNGLCOLOR3DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor3f(GLfloat red, GLfloat green, GLfloat blue) { GLAD_LAZY_RESOLVE(61, glColor3f, PFNGLCOLOR3FPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(62, glColor3fv, PFNGLCOLOR3FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor3i(GLint red, GLint green, GLint blue) { GLAD_LAZY_RESOLVE(63, glColor3i, PFNGLCOLOR3IPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3iv(const GLint *v) { GLAD_LAZY_RESOLVE(64, glColor3iv, PFNGLCOLOR3IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor3s(GLshort red, GLshort green, GLshort blue) { GLAD_LAZY_RESOLVE(65, glColor3s, PFNGLCOLOR3SPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3sv(const GLshort *v) { GLAD_LAZY_RESOLVE(66, glColor3sv, PFNGLCOLOR3SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) { GLAD_LAZY_RESOLVE(67, glColor3ub, PFNGLCOLOR3UBPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3ubv(const GLubyte *v) { GLAD_LAZY_RESOLVE(68, glColor3ubv, PFNGLCOLOR3UBVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor3ui(GLuint red, GLuint green, GLuint blue) { GLAD_LAZY_RESOLVE(69, glColor3ui, PFNGLCOLOR3UIPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3uiv(const GLuint *v) { GLAD_LAZY_RESOLVE(70, glColor3uiv, PFNGLCOLOR3UIVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor3us(GLushort red, GLushort green, GLushort blue) { GLAD_LAZY_RESOLVE(71, glColor3us, PFNGLCOLOR3USPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glColor3usv(const GLushort *v) { GLAD_LAZY_RESOLVE(72, glColor3usv, PFNGLCOLOR3USVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) { GLAD_LAZY_RESOLVE(73, glColor4b, PFNGLCOLOR4BPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4bv(const GLbyte *v) { GLAD_LAZY_RESOLVE(74, glColor4bv, PFNGLCOLOR4BVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) { GLAD_LAZY_RESOLVE(75, glColor4d, PFNGLCOLOR4DPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(76, glColor4dv, PFNGLCOLOR4DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { GLAD_LAZY_RESOLVE(77, glColor4f, PFNGLCOLOR4FPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(78, glColor4fv, PFNGLCOLOR4FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) { GLAD_LAZY_RESOLVE(79, glColor4i, PFNGLCOLOR4IPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4iv(const GLint *v) { GLAD_LAZY_RESOLVE(80, glColor4iv, PFNGLCOLOR4IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) { GLAD_LAZY_RESOLVE(81, glColor4s, PFNGLCOLOR4SPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4sv(const GLshort *v) { GLAD_LAZY_RESOLVE(82, glColor4sv, PFNGLCOLOR4SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) { GLAD_LAZY_RESOLVE(83, glColor4ub, PFNGLCOLOR4UBPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4ubv(const GLubyte *v) { GLAD_LAZY_RESOLVE(84, glColor4ubv, PFNGLCOLOR4UBVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) { GLAD_LAZY_RESOLVE(85, glColor4ui, PFNGLCOLOR4UIPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4uiv(const GLuint *v) { GLAD_LAZY_RESOLVE(86, glColor4uiv, PFNGLCOLOR4UIVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) { GLAD_LAZY_RESOLVE(87, glColor4us, PFNGLCOLOR4USPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glColor4usv(const GLushort *v) { GLAD_LAZY_RESOLVE(88, glColor4usv, PFNGLCOLOR4USVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glEdgeFlag(GLboolean flag) { GLAD_LAZY_RESOLVE(89, glEdgeFlag, PFNGLEDGEFLAGPROC) resolved(flag); }
+static void APIENTRY glad_lazy_glEdgeFlagv(const GLboolean *flag) { GLAD_LAZY_RESOLVE(90, glEdgeFlagv, PFNGLEDGEFLAGVPROC) resolved(flag); }
+static void APIENTRY glad_lazy_glEnd(void) { GLAD_LAZY_RESOLVE(91, glEnd, PFNGLENDPROC) resolved(); }
+static void APIENTRY glad_lazy_glIndexd(GLdouble c) { GLAD_LAZY_RESOLVE(92, glIndexd, PFNGLINDEXDPROC) resolved(c); }
+static void APIENTRY glad_lazy_glIndexdv(const GLdouble *c) { GLAD_LAZY_RESOLVE(93, glIndexdv, PFNGLINDEXDVPROC) resolved(c); }
+static void APIENTRY glad_lazy_glIndexf(GLfloat c) { GLAD_LAZY_RESOLVE(94, glIndexf, PFNGLINDEXFPROC) resolved(c); }
+static void APIENTRY glad_lazy_glIndexfv(const GLfloat *c) { GLAD_LAZY_RESOLVE(95, glIndexfv, PFNGLINDEXFVPROC) resolved(c); }
+static void APIENTRY glad_lazy_glIndexi(GLint c) { GLAD_LAZY_RESOLVE(96, glIndexi, PFNGLINDEXIPROC) resolved(c); }
+static void APIENTRY glad_lazy_glIndexiv(const GLint *c) { GLAD_LAZY_RESOLVE(97, glIndexiv, PFNGLINDEXIVPROC) resolved(c); }
+static void APIENTRY glad_lazy_glIndexs(GLshort c) { GLAD_LAZY_RESOLVE(98, glIndexs, PFNGLINDEXSPROC) resolved(c); }
+static void APIENTRY glad_lazy_glIndexsv(const GLshort *c) { GLAD_LAZY_RESOLVE(99, glIndexsv, PFNGLINDEXSVPROC) resolved(c); }
+static void APIENTRY glad_lazy_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) { GLAD_LAZY_RESOLVE(100, glNormal3b, PFNGLNORMAL3BPROC) resolved(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3bv(const GLbyte *v) { GLAD_LAZY_RESOLVE(101, glNormal3bv, PFNGLNORMAL3BVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) { GLAD_LAZY_RESOLVE(102, glNormal3d, PFNGLNORMAL3DPROC) resolved(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(103, glNormal3dv, PFNGLNORMAL3DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) { GLAD_LAZY_RESOLVE(104, glNormal3f, PFNGLNORMAL3FPROC) resolved(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(105, glNormal3fv, PFNGLNORMAL3FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glNormal3i(GLint nx, GLint ny, GLint nz) { GLAD_LAZY_RESOLVE(106, glNormal3i, PFNGLNORMAL3IPROC) resolved(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3iv(const GLint *v) { GLAD_LAZY_RESOLVE(107, glNormal3iv, PFNGLNORMAL3IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glNormal3s(GLshort nx, GLshort ny, GLshort nz) { GLAD_LAZY_RESOLVE(108, glNormal3s, PFNGLNORMAL3SPROC) resolved(nx, ny, nz); }
+static void APIENTRY glad_lazy_glNormal3sv(const GLshort *v) { GLAD_LAZY_RESOLVE(109, glNormal3sv, PFNGLNORMAL3SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos2d(GLdouble x, GLdouble y) { GLAD_LAZY_RESOLVE(110, glRasterPos2d, PFNGLRASTERPOS2DPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(111, glRasterPos2dv, PFNGLRASTERPOS2DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos2f(GLfloat x, GLfloat y) { GLAD_LAZY_RESOLVE(112, glRasterPos2f, PFNGLRASTERPOS2FPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(113, glRasterPos2fv, PFNGLRASTERPOS2FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos2i(GLint x, GLint y) { GLAD_LAZY_RESOLVE(114, glRasterPos2i, PFNGLRASTERPOS2IPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2iv(const GLint *v) { GLAD_LAZY_RESOLVE(115, glRasterPos2iv, PFNGLRASTERPOS2IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos2s(GLshort x, GLshort y) { GLAD_LAZY_RESOLVE(116, glRasterPos2s, PFNGLRASTERPOS2SPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glRasterPos2sv(const GLshort *v) { GLAD_LAZY_RESOLVE(117, glRasterPos2sv, PFNGLRASTERPOS2SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) { GLAD_LAZY_RESOLVE(118, glRasterPos3d, PFNGLRASTERPOS3DPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(119, glRasterPos3dv, PFNGLRASTERPOS3DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) { GLAD_LAZY_RESOLVE(120, glRasterPos3f, PFNGLRASTERPOS3FPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(121, glRasterPos3fv, PFNGLRASTERPOS3FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos3i(GLint x, GLint y, GLint z) { GLAD_LAZY_RESOLVE(122, glRasterPos3i, PFNGLRASTERPOS3IPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3iv(const GLint *v) { GLAD_LAZY_RESOLVE(123, glRasterPos3iv, PFNGLRASTERPOS3IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos3s(GLshort x, GLshort y, GLshort z) { GLAD_LAZY_RESOLVE(124, glRasterPos3s, PFNGLRASTERPOS3SPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glRasterPos3sv(const GLshort *v) { GLAD_LAZY_RESOLVE(125, glRasterPos3sv, PFNGLRASTERPOS3SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) { GLAD_LAZY_RESOLVE(126, glRasterPos4d, PFNGLRASTERPOS4DPROC) resolved(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(127, glRasterPos4dv, PFNGLRASTERPOS4DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) { GLAD_LAZY_RESOLVE(128, glRasterPos4f, PFNGLRASTERPOS4FPROC) resolved(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(129, glRasterPos4fv, PFNGLRASTERPOS4FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) { GLAD_LAZY_RESOLVE(130, glRasterPos4i, PFNGLRASTERPOS4IPROC) resolved(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4iv(const GLint *v) { GLAD_LAZY_RESOLVE(131, glRasterPos4iv, PFNGLRASTERPOS4IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) { GLAD_LAZY_RESOLVE(132, glRasterPos4s, PFNGLRASTERPOS4SPROC) resolved(x, y, z, w); }
+static void APIENTRY glad_lazy_glRasterPos4sv(const GLshort *v) { GLAD_LAZY_RESOLVE(133, glRasterPos4sv, PFNGLRASTERPOS4SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) { GLAD_LAZY_RESOLVE(134, glRectd, PFNGLRECTDPROC) resolved(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectdv(const GLdouble *v1, const GLdouble *v2) { GLAD_LAZY_RESOLVE(135, glRectdv, PFNGLRECTDVPROC) resolved(v1, v2); }
+static void APIENTRY glad_lazy_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) { GLAD_LAZY_RESOLVE(136, glRectf, PFNGLRECTFPROC) resolved(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectfv(const GLfloat *v1, const GLfloat *v2) { GLAD_LAZY_RESOLVE(137, glRectfv, PFNGLRECTFVPROC) resolved(v1, v2); }
+static void APIENTRY glad_lazy_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) { GLAD_LAZY_RESOLVE(138, glRecti, PFNGLRECTIPROC) resolved(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectiv(const GLint *v1, const GLint *v2) { GLAD_LAZY_RESOLVE(139, glRectiv, PFNGLRECTIVPROC) resolved(v1, v2); }
+static void APIENTRY glad_lazy_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) { GLAD_LAZY_RESOLVE(140, glRects, PFNGLRECTSPROC) resolved(x1, y1, x2, y2); }
+static void APIENTRY glad_lazy_glRectsv(const GLshort *v1, const GLshort *v2) { GLAD_LAZY_RESOLVE(141, glRectsv, PFNGLRECTSVPROC) resolved(v1, v2); }
+static void APIENTRY glad_lazy_glTexCoord1d(GLdouble s) { GLAD_LAZY_RESOLVE(142, glTexCoord1d, PFNGLTEXCOORD1DPROC) resolved(s); }
+static void APIENTRY glad_lazy_glTexCoord1dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(143, glTexCoord1dv, PFNGLTEXCOORD1DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord1f(GLfloat s) { GLAD_LAZY_RESOLVE(144, glTexCoord1f, PFNGLTEXCOORD1FPROC) resolved(s); }
+static void APIENTRY glad_lazy_glTexCoord1fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(145, glTexCoord1fv, PFNGLTEXCOORD1FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord1i(GLint s) { GLAD_LAZY_RESOLVE(146, glTexCoord1i, PFNGLTEXCOORD1IPROC) resolved(s); }
+static void APIENTRY glad_lazy_glTexCoord1iv(const GLint *v) { GLAD_LAZY_RESOLVE(147, glTexCoord1iv, PFNGLTEXCOORD1IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord1s(GLshort s) { GLAD_LAZY_RESOLVE(148, glTexCoord1s, PFNGLTEXCOORD1SPROC) resolved(s); }
+static void APIENTRY glad_lazy_glTexCoord1sv(const GLshort *v) { GLAD_LAZY_RESOLVE(149, glTexCoord1sv, PFNGLTEXCOORD1SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord2d(GLdouble s, GLdouble t) { GLAD_LAZY_RESOLVE(150, glTexCoord2d, PFNGLTEXCOORD2DPROC) resolved(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(151, glTexCoord2dv, PFNGLTEXCOORD2DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord2f(GLfloat s, GLfloat t) { GLAD_LAZY_RESOLVE(152, glTexCoord2f, PFNGLTEXCOORD2FPROC) resolved(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(153, glTexCoord2fv, PFNGLTEXCOORD2FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord2i(GLint s, GLint t) { GLAD_LAZY_RESOLVE(154, glTexCoord2i, PFNGLTEXCOORD2IPROC) resolved(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2iv(const GLint *v) { GLAD_LAZY_RESOLVE(155, glTexCoord2iv, PFNGLTEXCOORD2IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord2s(GLshort s, GLshort t) { GLAD_LAZY_RESOLVE(156, glTexCoord2s, PFNGLTEXCOORD2SPROC) resolved(s, t); }
+static void APIENTRY glad_lazy_glTexCoord2sv(const GLshort *v) { GLAD_LAZY_RESOLVE(157, glTexCoord2sv, PFNGLTEXCOORD2SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) { GLAD_LAZY_RESOLVE(158, glTexCoord3d, PFNGLTEXCOORD3DPROC) resolved(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(159, glTexCoord3dv, PFNGLTEXCOORD3DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) { GLAD_LAZY_RESOLVE(160, glTexCoord3f, PFNGLTEXCOORD3FPROC) resolved(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(161, glTexCoord3fv, PFNGLTEXCOORD3FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord3i(GLint s, GLint t, GLint r) { GLAD_LAZY_RESOLVE(162, glTexCoord3i, PFNGLTEXCOORD3IPROC) resolved(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3iv(const GLint *v) { GLAD_LAZY_RESOLVE(163, glTexCoord3iv, PFNGLTEXCOORD3IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord3s(GLshort s, GLshort t, GLshort r) { GLAD_LAZY_RESOLVE(164, glTexCoord3s, PFNGLTEXCOORD3SPROC) resolved(s, t, r); }
+static void APIENTRY glad_lazy_glTexCoord3sv(const GLshort *v) { GLAD_LAZY_RESOLVE(165, glTexCoord3sv, PFNGLTEXCOORD3SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) { GLAD_LAZY_RESOLVE(166, glTexCoord4d, PFNGLTEXCOORD4DPROC) resolved(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(167, glTexCoord4dv, PFNGLTEXCOORD4DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) { GLAD_LAZY_RESOLVE(168, glTexCoord4f, PFNGLTEXCOORD4FPROC) resolved(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(169, glTexCoord4fv, PFNGLTEXCOORD4FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) { GLAD_LAZY_RESOLVE(170, glTexCoord4i, PFNGLTEXCOORD4IPROC) resolved(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4iv(const GLint *v) { GLAD_LAZY_RESOLVE(171, glTexCoord4iv, PFNGLTEXCOORD4IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) { GLAD_LAZY_RESOLVE(172, glTexCoord4s, PFNGLTEXCOORD4SPROC) resolved(s, t, r, q); }
+static void APIENTRY glad_lazy_glTexCoord4sv(const GLshort *v) { GLAD_LAZY_RESOLVE(173, glTexCoord4sv, PFNGLTEXCOORD4SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex2d(GLdouble x, GLdouble y) { GLAD_LAZY_RESOLVE(174, glVertex2d, PFNGLVERTEX2DPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glVertex2dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(175, glVertex2dv, PFNGLVERTEX2DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex2f(GLfloat x, GLfloat y) { GLAD_LAZY_RESOLVE(176, glVertex2f, PFNGLVERTEX2FPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glVertex2fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(177, glVertex2fv, PFNGLVERTEX2FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex2i(GLint x, GLint y) { GLAD_LAZY_RESOLVE(178, glVertex2i, PFNGLVERTEX2IPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glVertex2iv(const GLint *v) { GLAD_LAZY_RESOLVE(179, glVertex2iv, PFNGLVERTEX2IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex2s(GLshort x, GLshort y) { GLAD_LAZY_RESOLVE(180, glVertex2s, PFNGLVERTEX2SPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glVertex2sv(const GLshort *v) { GLAD_LAZY_RESOLVE(181, glVertex2sv, PFNGLVERTEX2SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex3d(GLdouble x, GLdouble y, GLdouble z) { GLAD_LAZY_RESOLVE(182, glVertex3d, PFNGLVERTEX3DPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(183, glVertex3dv, PFNGLVERTEX3DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex3f(GLfloat x, GLfloat y, GLfloat z) { GLAD_LAZY_RESOLVE(184, glVertex3f, PFNGLVERTEX3FPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(185, glVertex3fv, PFNGLVERTEX3FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex3i(GLint x, GLint y, GLint z) { GLAD_LAZY_RESOLVE(186, glVertex3i, PFNGLVERTEX3IPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3iv(const GLint *v) { GLAD_LAZY_RESOLVE(187, glVertex3iv, PFNGLVERTEX3IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex3s(GLshort x, GLshort y, GLshort z) { GLAD_LAZY_RESOLVE(188, glVertex3s, PFNGLVERTEX3SPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glVertex3sv(const GLshort *v) { GLAD_LAZY_RESOLVE(189, glVertex3sv, PFNGLVERTEX3SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) { GLAD_LAZY_RESOLVE(190, glVertex4d, PFNGLVERTEX4DPROC) resolved(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(191, glVertex4dv, PFNGLVERTEX4DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) { GLAD_LAZY_RESOLVE(192, glVertex4f, PFNGLVERTEX4FPROC) resolved(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(193, glVertex4fv, PFNGLVERTEX4FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex4i(GLint x, GLint y, GLint z, GLint w) { GLAD_LAZY_RESOLVE(194, glVertex4i, PFNGLVERTEX4IPROC) resolved(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4iv(const GLint *v) { GLAD_LAZY_RESOLVE(195, glVertex4iv, PFNGLVERTEX4IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) { GLAD_LAZY_RESOLVE(196, glVertex4s, PFNGLVERTEX4SPROC) resolved(x, y, z, w); }
+static void APIENTRY glad_lazy_glVertex4sv(const GLshort *v) { GLAD_LAZY_RESOLVE(197, glVertex4sv, PFNGLVERTEX4SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glClipPlane(GLenum plane, const GLdouble *equation) { GLAD_LAZY_RESOLVE(198, glClipPlane, PFNGLCLIPPLANEPROC) resolved(plane, equation); }
+static void APIENTRY glad_lazy_glColorMaterial(GLenum face, GLenum mode) { GLAD_LAZY_RESOLVE(199, glColorMaterial, PFNGLCOLORMATERIALPROC) resolved(face, mode); }
+static void APIENTRY glad_lazy_glFogf(GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(200, glFogf, PFNGLFOGFPROC) resolved(pname, param); }
+static void APIENTRY glad_lazy_glFogfv(GLenum pname, const GLfloat *params) { GLAD_LAZY_RESOLVE(201, glFogfv, PFNGLFOGFVPROC) resolved(pname, params); }
+static void APIENTRY glad_lazy_glFogi(GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(202, glFogi, PFNGLFOGIPROC) resolved(pname, param); }
+static void APIENTRY glad_lazy_glFogiv(GLenum pname, const GLint *params) { GLAD_LAZY_RESOLVE(203, glFogiv, PFNGLFOGIVPROC) resolved(pname, params); }
+static void APIENTRY glad_lazy_glLightf(GLenum light, GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(204, glLightf, PFNGLLIGHTFPROC) resolved(light, pname, param); }
+static void APIENTRY glad_lazy_glLightfv(GLenum light, GLenum pname, const GLfloat *params) { GLAD_LAZY_RESOLVE(205, glLightfv, PFNGLLIGHTFVPROC) resolved(light, pname, params); }
+static void APIENTRY glad_lazy_glLighti(GLenum light, GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(206, glLighti, PFNGLLIGHTIPROC) resolved(light, pname, param); }
+static void APIENTRY glad_lazy_glLightiv(GLenum light, GLenum pname, const GLint *params) { GLAD_LAZY_RESOLVE(207, glLightiv, PFNGLLIGHTIVPROC) resolved(light, pname, params); }
+static void APIENTRY glad_lazy_glLightModelf(GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(208, glLightModelf, PFNGLLIGHTMODELFPROC) resolved(pname, param); }
+static void APIENTRY glad_lazy_glLightModelfv(GLenum pname, const GLfloat *params) { GLAD_LAZY_RESOLVE(209, glLightModelfv, PFNGLLIGHTMODELFVPROC) resolved(pname, params); }
+static void APIENTRY glad_lazy_glLightModeli(GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(210, glLightModeli, PFNGLLIGHTMODELIPROC) resolved(pname, param); }
+static void APIENTRY glad_lazy_glLightModeliv(GLenum pname, const GLint *params) { GLAD_LAZY_RESOLVE(211, glLightModeliv, PFNGLLIGHTMODELIVPROC) resolved(pname, params); }
+static void APIENTRY glad_lazy_glLineStipple(GLint factor, GLushort pattern) { GLAD_LAZY_RESOLVE(212, glLineStipple, PFNGLLINESTIPPLEPROC) resolved(factor, pattern); }
+static void APIENTRY glad_lazy_glMaterialf(GLenum face, GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(213, glMaterialf, PFNGLMATERIALFPROC) resolved(face, pname, param); }
+static void APIENTRY glad_lazy_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) { GLAD_LAZY_RESOLVE(214, glMaterialfv, PFNGLMATERIALFVPROC) resolved(face, pname, params); }
+static void APIENTRY glad_lazy_glMateriali(GLenum face, GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(215, glMateriali, PFNGLMATERIALIPROC) resolved(face, pname, param); }
+static void APIENTRY glad_lazy_glMaterialiv(GLenum face, GLenum pname, const GLint *params) { GLAD_LAZY_RESOLVE(216, glMaterialiv, PFNGLMATERIALIVPROC) resolved(face, pname, params); }
+static void APIENTRY glad_lazy_glPolygonStipple(const GLubyte *mask) { GLAD_LAZY_RESOLVE(217, glPolygonStipple, PFNGLPOLYGONSTIPPLEPROC) resolved(mask); }
+static void APIENTRY glad_lazy_glShadeModel(GLenum mode) { GLAD_LAZY_RESOLVE(218, glShadeModel, PFNGLSHADEMODELPROC) resolved(mode); }
+static void APIENTRY glad_lazy_glTexEnvf(GLenum target, GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(219, glTexEnvf, PFNGLTEXENVFPROC) resolved(target, pname, param); }
+static void APIENTRY glad_lazy_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) { GLAD_LAZY_RESOLVE(220, glTexEnvfv, PFNGLTEXENVFVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glTexEnvi(GLenum target, GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(221, glTexEnvi, PFNGLTEXENVIPROC) resolved(target, pname, param); }
+static void APIENTRY glad_lazy_glTexEnviv(GLenum target, GLenum pname, const GLint *params) { GLAD_LAZY_RESOLVE(222, glTexEnviv, PFNGLTEXENVIVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glTexGend(GLenum coord, GLenum pname, GLdouble param) { GLAD_LAZY_RESOLVE(223, glTexGend, PFNGLTEXGENDPROC) resolved(coord, pname, param); }
+static void APIENTRY glad_lazy_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) { GLAD_LAZY_RESOLVE(224, glTexGendv, PFNGLTEXGENDVPROC) resolved(coord, pname, params); }
+static void APIENTRY glad_lazy_glTexGenf(GLenum coord, GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(225, glTexGenf, PFNGLTEXGENFPROC) resolved(coord, pname, param); }
+static void APIENTRY glad_lazy_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) { GLAD_LAZY_RESOLVE(226, glTexGenfv, PFNGLTEXGENFVPROC) resolved(coord, pname, params); }
+static void APIENTRY glad_lazy_glTexGeni(GLenum coord, GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(227, glTexGeni, PFNGLTEXGENIPROC) resolved(coord, pname, param); }
+static void APIENTRY glad_lazy_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) { GLAD_LAZY_RESOLVE(228, glTexGeniv, PFNGLTEXGENIVPROC) resolved(coord, pname, params); }
+static void APIENTRY glad_lazy_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) { GLAD_LAZY_RESOLVE(229, glFeedbackBuffer, PFNGLFEEDBACKBUFFERPROC) resolved(size, type, buffer); }
+static void APIENTRY glad_lazy_glSelectBuffer(GLsizei size, GLuint *buffer) { GLAD_LAZY_RESOLVE(230, glSelectBuffer, PFNGLSELECTBUFFERPROC) resolved(size, buffer); }
+static GLint APIENTRY glad_lazy_glRenderMode(GLenum mode) { GLAD_LAZY_RESOLVE(231, glRenderMode, PFNGLRENDERMODEPROC) return resolved(mode); }
+static void APIENTRY glad_lazy_glInitNames(void) { GLAD_LAZY_RESOLVE(232, glInitNames, PFNGLINITNAMESPROC) resolved(); }
+static void APIENTRY glad_lazy_glLoadName(GLuint name) { GLAD_LAZY_RESOLVE(233, glLoadName, PFNGLLOADNAMEPROC) resolved(name); }
+static void APIENTRY glad_lazy_glPassThrough(GLfloat token) { GLAD_LAZY_RESOLVE(234, glPassThrough, PFNGLPASSTHROUGHPROC) resolved(token); }
+static void APIENTRY glad_lazy_glPopName(void) { GLAD_LAZY_RESOLVE(235, glPopName, PFNGLPOPNAMEPROC) resolved(); }
+static void APIENTRY glad_lazy_glPushName(GLuint name) { GLAD_LAZY_RESOLVE(236, glPushName, PFNGLPUSHNAMEPROC) resolved(name); }
+static void APIENTRY glad_lazy_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { GLAD_LAZY_RESOLVE(237, glClearAccum, PFNGLCLEARACCUMPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glClearIndex(GLfloat c) { GLAD_LAZY_RESOLVE(238, glClearIndex, PFNGLCLEARINDEXPROC) resolved(c); }
+static void APIENTRY glad_lazy_glIndexMask(GLuint mask) { GLAD_LAZY_RESOLVE(239, glIndexMask, PFNGLINDEXMASKPROC) resolved(mask); }
+static void APIENTRY glad_lazy_glAccum(GLenum op, GLfloat value) { GLAD_LAZY_RESOLVE(240, glAccum, PFNGLACCUMPROC) resolved(op, value); }
+static void APIENTRY glad_lazy_glPopAttrib(void) { GLAD_LAZY_RESOLVE(241, glPopAttrib, PFNGLPOPATTRIBPROC) resolved(); }
+static void APIENTRY glad_lazy_glPushAttrib(GLbitfield mask) { GLAD_LAZY_RESOLVE(242, glPushAttrib, PFNGLPUSHATTRIBPROC) resolved(mask); }
+static void APIENTRY glad_lazy_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) { GLAD_LAZY_RESOLVE(243, glMap1d, PFNGLMAP1DPROC) resolved(target, u1, u2, stride, order, points); }
+static void APIENTRY glad_lazy_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) { GLAD_LAZY_RESOLVE(244, glMap1f, PFNGLMAP1FPROC) resolved(target, u1, u2, stride, order, points); }
+static void APIENTRY glad_lazy_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) { GLAD_LAZY_RESOLVE(245, glMap2d, PFNGLMAP2DPROC) resolved(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points); }
+static void APIENTRY glad_lazy_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) { GLAD_LAZY_RESOLVE(246, glMap2f, PFNGLMAP2FPROC) resolved(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points); }
+static void APIENTRY glad_lazy_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) { GLAD_LAZY_RESOLVE(247, glMapGrid1d, PFNGLMAPGRID1DPROC) resolved(un, u1, u2); }
+static void APIENTRY glad_lazy_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) { GLAD_LAZY_RESOLVE(248, glMapGrid1f, PFNGLMAPGRID1FPROC) resolved(un, u1, u2); }
+static void APIENTRY glad_lazy_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) { GLAD_LAZY_RESOLVE(249, glMapGrid2d, PFNGLMAPGRID2DPROC) resolved(un, u1, u2, vn, v1, v2); }
+static void APIENTRY glad_lazy_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) { GLAD_LAZY_RESOLVE(250, glMapGrid2f, PFNGLMAPGRID2FPROC) resolved(un, u1, u2, vn, v1, v2); }
+static void APIENTRY glad_lazy_glEvalCoord1d(GLdouble u) { GLAD_LAZY_RESOLVE(251, glEvalCoord1d, PFNGLEVALCOORD1DPROC) resolved(u); }
+static void APIENTRY glad_lazy_glEvalCoord1dv(const GLdouble *u) { GLAD_LAZY_RESOLVE(252, glEvalCoord1dv, PFNGLEVALCOORD1DVPROC) resolved(u); }
+static void APIENTRY glad_lazy_glEvalCoord1f(GLfloat u) { GLAD_LAZY_RESOLVE(253, glEvalCoord1f, PFNGLEVALCOORD1FPROC) resolved(u); }
+static void APIENTRY glad_lazy_glEvalCoord1fv(const GLfloat *u) { GLAD_LAZY_RESOLVE(254, glEvalCoord1fv, PFNGLEVALCOORD1FVPROC) resolved(u); }
+static void APIENTRY glad_lazy_glEvalCoord2d(GLdouble u, GLdouble v) { GLAD_LAZY_RESOLVE(255, glEvalCoord2d, PFNGLEVALCOORD2DPROC) resolved(u, v); }
+static void APIENTRY glad_lazy_glEvalCoord2dv(const GLdouble *u) { GLAD_LAZY_RESOLVE(256, glEvalCoord2dv, PFNGLEVALCOORD2DVPROC) resolved(u); }
+static void APIENTRY glad_lazy_glEvalCoord2f(GLfloat u, GLfloat v) { GLAD_LAZY_RESOLVE(257, glEvalCoord2f, PFNGLEVALCOORD2FPROC) resolved(u, v); }
+static void APIENTRY glad_lazy_glEvalCoord2fv(const GLfloat *u) { GLAD_LAZY_RESOLVE(258, glEvalCoord2fv, PFNGLEVALCOORD2FVPROC) resolved(u); }
+static void APIENTRY glad_lazy_glEvalMesh1(GLenum mode, GLint i1, GLint i2) { GLAD_LAZY_RESOLVE(259, glEvalMesh1, PFNGLEVALMESH1PROC) resolved(mode, i1, i2); }
+static void APIENTRY glad_lazy_glEvalPoint1(GLint i) { GLAD_LAZY_RESOLVE(260, glEvalPoint1, PFNGLEVALPOINT1PROC) resolved(i); }
+static void APIENTRY glad_lazy_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) { GLAD_LAZY_RESOLVE(261, glEvalMesh2, PFNGLEVALMESH2PROC) resolved(mode, i1, i2, j1, j2); }
+static void APIENTRY glad_lazy_glEvalPoint2(GLint i, GLint j) { GLAD_LAZY_RESOLVE(262, glEvalPoint2, PFNGLEVALPOINT2PROC) resolved(i, j); }
+static void APIENTRY glad_lazy_glAlphaFunc(GLenum func, GLfloat ref) { GLAD_LAZY_RESOLVE(263, glAlphaFunc, PFNGLALPHAFUNCPROC) resolved(func, ref); }
+static void APIENTRY glad_lazy_glPixelZoom(GLfloat xfactor, GLfloat yfactor) { GLAD_LAZY_RESOLVE(264, glPixelZoom, PFNGLPIXELZOOMPROC) resolved(xfactor, yfactor); }
+static void APIENTRY glad_lazy_glPixelTransferf(GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(265, glPixelTransferf, PFNGLPIXELTRANSFERFPROC) resolved(pname, param); }
+static void APIENTRY glad_lazy_glPixelTransferi(GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(266, glPixelTransferi, PFNGLPIXELTRANSFERIPROC) resolved(pname, param); }
+static void APIENTRY glad_lazy_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) { GLAD_LAZY_RESOLVE(267, glPixelMapfv, PFNGLPIXELMAPFVPROC) resolved(map, mapsize, values); }
+static void APIENTRY glad_lazy_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) { GLAD_LAZY_RESOLVE(268, glPixelMapuiv, PFNGLPIXELMAPUIVPROC) resolved(map, mapsize, values); }
+static void APIENTRY glad_lazy_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) { GLAD_LAZY_RESOLVE(269, glPixelMapusv, PFNGLPIXELMAPUSVPROC) resolved(map, mapsize, values); }
+static void APIENTRY glad_lazy_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) { GLAD_LAZY_RESOLVE(270, glCopyPixels, PFNGLCOPYPIXELSPROC) resolved(x, y, width, height, type); }
+static void APIENTRY glad_lazy_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { GLAD_LAZY_RESOLVE(271, glDrawPixels, PFNGLDRAWPIXELSPROC) resolved(width, height, format, type, pixels); }
+static void APIENTRY glad_lazy_glGetClipPlane(GLenum plane, GLdouble *equation) { GLAD_LAZY_RESOLVE(272, glGetClipPlane, PFNGLGETCLIPPLANEPROC) resolved(plane, equation); }
+static void APIENTRY glad_lazy_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) { GLAD_LAZY_RESOLVE(273, glGetLightfv, PFNGLGETLIGHTFVPROC) resolved(light, pname, params); }
+static void APIENTRY glad_lazy_glGetLightiv(GLenum light, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(274, glGetLightiv, PFNGLGETLIGHTIVPROC) resolved(light, pname, params); }
+static void APIENTRY glad_lazy_glGetMapdv(GLenum target, GLenum query, GLdouble *v) { GLAD_LAZY_RESOLVE(275, glGetMapdv, PFNGLGETMAPDVPROC) resolved(target, query, v); }
+static void APIENTRY glad_lazy_glGetMapfv(GLenum target, GLenum query, GLfloat *v) { GLAD_LAZY_RESOLVE(276, glGetMapfv, PFNGLGETMAPFVPROC) resolved(target, query, v); }
+static void APIENTRY glad_lazy_glGetMapiv(GLenum target, GLenum query, GLint *v) { GLAD_LAZY_RESOLVE(277, glGetMapiv, PFNGLGETMAPIVPROC) resolved(target, query, v); }
+static void APIENTRY glad_lazy_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) { GLAD_LAZY_RESOLVE(278, glGetMaterialfv, PFNGLGETMATERIALFVPROC) resolved(face, pname, params); }
+static void APIENTRY glad_lazy_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(279, glGetMaterialiv, PFNGLGETMATERIALIVPROC) resolved(face, pname, params); }
+static void APIENTRY glad_lazy_glGetPixelMapfv(GLenum map, GLfloat *values) { GLAD_LAZY_RESOLVE(280, glGetPixelMapfv, PFNGLGETPIXELMAPFVPROC) resolved(map, values); }
+static void APIENTRY glad_lazy_glGetPixelMapuiv(GLenum map, GLuint *values) { GLAD_LAZY_RESOLVE(281, glGetPixelMapuiv, PFNGLGETPIXELMAPUIVPROC) resolved(map, values); }
+static void APIENTRY glad_lazy_glGetPixelMapusv(GLenum map, GLushort *values) { GLAD_LAZY_RESOLVE(282, glGetPixelMapusv, PFNGLGETPIXELMAPUSVPROC) resolved(map, values); }
+static void APIENTRY glad_lazy_glGetPolygonStipple(GLubyte *mask) { GLAD_LAZY_RESOLVE(283, glGetPolygonStipple, PFNGLGETPOLYGONSTIPPLEPROC) resolved(mask); }
+static void APIENTRY glad_lazy_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) { GLAD_LAZY_RESOLVE(284, glGetTexEnvfv, PFNGLGETTEXENVFVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(285, glGetTexEnviv, PFNGLGETTEXENVIVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) { GLAD_LAZY_RESOLVE(286, glGetTexGendv, PFNGLGETTEXGENDVPROC) resolved(coord, pname, params); }
+static void APIENTRY glad_lazy_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) { GLAD_LAZY_RESOLVE(287, glGetTexGenfv, PFNGLGETTEXGENFVPROC) resolved(coord, pname, params); }
+static void APIENTRY glad_lazy_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(288, glGetTexGeniv, PFNGLGETTEXGENIVPROC) resolved(coord, pname, params); }
+static GLboolean APIENTRY glad_lazy_glIsList(GLuint list) { GLAD_LAZY_RESOLVE(289, glIsList, PFNGLISLISTPROC) return resolved(list); }
+static void APIENTRY glad_lazy_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) { GLAD_LAZY_RESOLVE(290, glFrustum, PFNGLFRUSTUMPROC) resolved(left, right, bottom, top, zNear, zFar); }
+static void APIENTRY glad_lazy_glLoadIdentity(void) { GLAD_LAZY_RESOLVE(291, glLoadIdentity, PFNGLLOADIDENTITYPROC) resolved(); }
+static void APIENTRY glad_lazy_glLoadMatrixf(const GLfloat *m) { GLAD_LAZY_RESOLVE(292, glLoadMatrixf, PFNGLLOADMATRIXFPROC) resolved(m); }
+static void APIENTRY glad_lazy_glLoadMatrixd(const GLdouble *m) { GLAD_LAZY_RESOLVE(293, glLoadMatrixd, PFNGLLOADMATRIXDPROC) resolved(m); }
+static void APIENTRY glad_lazy_glMatrixMode(GLenum mode) { GLAD_LAZY_RESOLVE(294, glMatrixMode, PFNGLMATRIXMODEPROC) resolved(mode); }
+static void APIENTRY glad_lazy_glMultMatrixf(const GLfloat *m) { GLAD_LAZY_RESOLVE(295, glMultMatrixf, PFNGLMULTMATRIXFPROC) resolved(m); }
+static void APIENTRY glad_lazy_glMultMatrixd(const GLdouble *m) { GLAD_LAZY_RESOLVE(296, glMultMatrixd, PFNGLMULTMATRIXDPROC) resolved(m); }
+static void APIENTRY glad_lazy_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) { GLAD_LAZY_RESOLVE(297, glOrtho, PFNGLORTHOPROC) resolved(left, right, bottom, top, zNear, zFar); }
+static void APIENTRY glad_lazy_glPopMatrix(void) { GLAD_LAZY_RESOLVE(298, glPopMatrix, PFNGLPOPMATRIXPROC) resolved(); }
+static void APIENTRY glad_lazy_glPushMatrix(void) { GLAD_LAZY_RESOLVE(299, glPushMatrix, PFNGLPUSHMATRIXPROC) resolved(); }
+static void APIENTRY glad_lazy_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) { GLAD_LAZY_RESOLVE(300, glRotated, PFNGLROTATEDPROC) resolved(angle, x, y, z); }
+static void APIENTRY glad_lazy_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) { GLAD_LAZY_RESOLVE(301, glRotatef, PFNGLROTATEFPROC) resolved(angle, x, y, z); }
+static void APIENTRY glad_lazy_glScaled(GLdouble x, GLdouble y, GLdouble z) { GLAD_LAZY_RESOLVE(302, glScaled, PFNGLSCALEDPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glScalef(GLfloat x, GLfloat y, GLfloat z) { GLAD_LAZY_RESOLVE(303, glScalef, PFNGLSCALEFPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glTranslated(GLdouble x, GLdouble y, GLdouble z) { GLAD_LAZY_RESOLVE(304, glTranslated, PFNGLTRANSLATEDPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glTranslatef(GLfloat x, GLfloat y, GLfloat z) { GLAD_LAZY_RESOLVE(305, glTranslatef, PFNGLTRANSLATEFPROC) resolved(x, y, z); }
+#endif
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) { GLAD_LAZY_RESOLVE(306, glDrawArrays, PFNGLDRAWARRAYSPROC) resolved(mode, first, count); }
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { GLAD_LAZY_RESOLVE(307, glDrawElements, PFNGLDRAWELEMENTSPROC) resolved(mode, count, type, indices); }
+static void APIENTRY glad_lazy_glGetPointerv(GLenum pname, void **params) { GLAD_LAZY_RESOLVE(308, glGetPointerv, PFNGLGETPOINTERVPROC) resolved(pname, params); }
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) { GLAD_LAZY_RESOLVE(309, glPolygonOffset, PFNGLPOLYGONOFFSETPROC) resolved(factor, units); }
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { GLAD_LAZY_RESOLVE(310, glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC) resolved(target, level, internalformat, x, y, width, border); }
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { GLAD_LAZY_RESOLVE(311, glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC) resolved(target, level, internalformat, x, y, width, height, border); }
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { GLAD_LAZY_RESOLVE(312, glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC) resolved(target, level, xoffset, x, y, width); }
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { GLAD_LAZY_RESOLVE(313, glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC) resolved(target, level, xoffset, yoffset, x, y, width, height); }
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { GLAD_LAZY_RESOLVE(314, glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC) resolved(target, level, xoffset, width, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { GLAD_LAZY_RESOLVE(315, glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC) resolved(target, level, xoffset, yoffset, width, height, format, type, pixels); }
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) { GLAD_LAZY_RESOLVE(316, glBindTexture, PFNGLBINDTEXTUREPROC) resolved(target, texture); }
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) { GLAD_LAZY_RESOLVE(317, glDeleteTextures, PFNGLDELETETEXTURESPROC) resolved(n, textures); }
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) { GLAD_LAZY_RESOLVE(318, glGenTextures, PFNGLGENTEXTURESPROC) resolved(n, textures); }
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) { GLAD_LAZY_RESOLVE(319, glIsTexture, PFNGLISTEXTUREPROC) return resolved(texture); }
+#ifndef GLAD_CORE_ONLY
+static void APIENTRY glad_lazy_glArrayElement(GLint i) { GLAD_LAZY_RESOLVE(320, glArrayElement, PFNGLARRAYELEMENTPROC) resolved(i); }
+static void APIENTRY glad_lazy_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(321, glColorPointer, PFNGLCOLORPOINTERPROC) resolved(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glDisableClientState(GLenum array) { GLAD_LAZY_RESOLVE(322, glDisableClientState, PFNGLDISABLECLIENTSTATEPROC) resolved(array); }
+static void APIENTRY glad_lazy_glEdgeFlagPointer(GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(323, glEdgeFlagPointer, PFNGLEDGEFLAGPOINTERPROC) resolved(stride, pointer); }
+static void APIENTRY glad_lazy_glEnableClientState(GLenum array) { GLAD_LAZY_RESOLVE(324, glEnableClientState, PFNGLENABLECLIENTSTATEPROC) resolved(array); }
+static void APIENTRY glad_lazy_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(325, glIndexPointer, PFNGLINDEXPOINTERPROC) resolved(type, stride, pointer); }
+static void APIENTRY glad_lazy_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(326, glInterleavedArrays, PFNGLINTERLEAVEDARRAYSPROC) resolved(format, stride, pointer); }
+static void APIENTRY glad_lazy_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(327, glNormalPointer, PFNGLNORMALPOINTERPROC) resolved(type, stride, pointer); }
+static void APIENTRY glad_lazy_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(328, glTexCoordPointer, PFNGLTEXCOORDPOINTERPROC) resolved(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(329, glVertexPointer, PFNGLVERTEXPOINTERPROC) resolved(size, type, stride, pointer); }
+static GLboolean APIENTRY glad_lazy_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) { GLAD_LAZY_RESOLVE(330, glAreTexturesResident, PFNGLARETEXTURESRESIDENTPROC) return resolved(n, textures, residences); }
+static void APIENTRY glad_lazy_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) { GLAD_LAZY_RESOLVE(331, glPrioritizeTextures, PFNGLPRIORITIZETEXTURESPROC) resolved(n, textures, priorities); }
+static void APIENTRY glad_lazy_glIndexub(GLubyte c) { GLAD_LAZY_RESOLVE(332, glIndexub, PFNGLINDEXUBPROC) resolved(c); }
+static void APIENTRY glad_lazy_glIndexubv(const GLubyte *c) { GLAD_LAZY_RESOLVE(333, glIndexubv, PFNGLINDEXUBVPROC) resolved(c); }
+static void APIENTRY glad_lazy_glPopClientAttrib(void) { GLAD_LAZY_RESOLVE(334, glPopClientAttrib, PFNGLPOPCLIENTATTRIBPROC) resolved(); }
+static void APIENTRY glad_lazy_glPushClientAttrib(GLbitfield mask) { GLAD_LAZY_RESOLVE(335, glPushClientAttrib, PFNGLPUSHCLIENTATTRIBPROC) resolved(mask); }
+#endif
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) { GLAD_LAZY_RESOLVE(336, glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC) resolved(mode, start, end, count, type, indices); }
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { GLAD_LAZY_RESOLVE(337, glTexImage3D, PFNGLTEXIMAGE3DPROC) resolved(target, level, internalformat, width, height, depth, border, format, type, pixels); }
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { GLAD_LAZY_RESOLVE(338, glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC) resolved(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); }
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { GLAD_LAZY_RESOLVE(339, glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC) resolved(target, level, xoffset, yoffset, zoffset, x, y, width, height); }
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) { GLAD_LAZY_RESOLVE(340, glActiveTexture, PFNGLACTIVETEXTUREPROC) resolved(texture); }
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) { GLAD_LAZY_RESOLVE(341, glSampleCoverage, PFNGLSAMPLECOVERAGEPROC) resolved(value, invert); }
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) { GLAD_LAZY_RESOLVE(342, glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC) resolved(target, level, internalformat, width, height, depth, border, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { GLAD_LAZY_RESOLVE(343, glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC) resolved(target, level, internalformat, width, height, border, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) { GLAD_LAZY_RESOLVE(344, glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC) resolved(target, level, internalformat, width, border, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { GLAD_LAZY_RESOLVE(345, glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) resolved(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { GLAD_LAZY_RESOLVE(346, glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) resolved(target, level, xoffset, yoffset, width, height, format, imageSize, data); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { GLAD_LAZY_RESOLVE(347, glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) resolved(target, level, xoffset, width, format, imageSize, data); }
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) { GLAD_LAZY_RESOLVE(348, glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC) resolved(target, level, img); }
+#ifndef GLAD_CORE_ONLY
+static void APIENTRY glad_lazy_glClientActiveTexture(GLenum texture) { GLAD_LAZY_RESOLVE(349, glClientActiveTexture, PFNGLCLIENTACTIVETEXTUREPROC) resolved(texture); }
+static void APIENTRY glad_lazy_glMultiTexCoord1d(GLenum target, GLdouble s) { GLAD_LAZY_RESOLVE(350, glMultiTexCoord1d, PFNGLMULTITEXCOORD1DPROC) resolved(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v) { GLAD_LAZY_RESOLVE(351, glMultiTexCoord1dv, PFNGLMULTITEXCOORD1DVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord1f(GLenum target, GLfloat s) { GLAD_LAZY_RESOLVE(352, glMultiTexCoord1f, PFNGLMULTITEXCOORD1FPROC) resolved(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v) { GLAD_LAZY_RESOLVE(353, glMultiTexCoord1fv, PFNGLMULTITEXCOORD1FVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord1i(GLenum target, GLint s) { GLAD_LAZY_RESOLVE(354, glMultiTexCoord1i, PFNGLMULTITEXCOORD1IPROC) resolved(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1iv(GLenum target, const GLint *v) { GLAD_LAZY_RESOLVE(355, glMultiTexCoord1iv, PFNGLMULTITEXCOORD1IVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord1s(GLenum target, GLshort s) { GLAD_LAZY_RESOLVE(356, glMultiTexCoord1s, PFNGLMULTITEXCOORD1SPROC) resolved(target, s); }
+static void APIENTRY glad_lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v) { GLAD_LAZY_RESOLVE(357, glMultiTexCoord1sv, PFNGLMULTITEXCOORD1SVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) { GLAD_LAZY_RESOLVE(358, glMultiTexCoord2d, PFNGLMULTITEXCOORD2DPROC) resolved(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v) { GLAD_LAZY_RESOLVE(359, glMultiTexCoord2dv, PFNGLMULTITEXCOORD2DVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) { GLAD_LAZY_RESOLVE(360, glMultiTexCoord2f, PFNGLMULTITEXCOORD2FPROC) resolved(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v) { GLAD_LAZY_RESOLVE(361, glMultiTexCoord2fv, PFNGLMULTITEXCOORD2FVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t) { GLAD_LAZY_RESOLVE(362, glMultiTexCoord2i, PFNGLMULTITEXCOORD2IPROC) resolved(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2iv(GLenum target, const GLint *v) { GLAD_LAZY_RESOLVE(363, glMultiTexCoord2iv, PFNGLMULTITEXCOORD2IVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) { GLAD_LAZY_RESOLVE(364, glMultiTexCoord2s, PFNGLMULTITEXCOORD2SPROC) resolved(target, s, t); }
+static void APIENTRY glad_lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v) { GLAD_LAZY_RESOLVE(365, glMultiTexCoord2sv, PFNGLMULTITEXCOORD2SVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) { GLAD_LAZY_RESOLVE(366, glMultiTexCoord3d, PFNGLMULTITEXCOORD3DPROC) resolved(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v) { GLAD_LAZY_RESOLVE(367, glMultiTexCoord3dv, PFNGLMULTITEXCOORD3DVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) { GLAD_LAZY_RESOLVE(368, glMultiTexCoord3f, PFNGLMULTITEXCOORD3FPROC) resolved(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v) { GLAD_LAZY_RESOLVE(369, glMultiTexCoord3fv, PFNGLMULTITEXCOORD3FVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) { GLAD_LAZY_RESOLVE(370, glMultiTexCoord3i, PFNGLMULTITEXCOORD3IPROC) resolved(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3iv(GLenum target, const GLint *v) { GLAD_LAZY_RESOLVE(371, glMultiTexCoord3iv, PFNGLMULTITEXCOORD3IVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) { GLAD_LAZY_RESOLVE(372, glMultiTexCoord3s, PFNGLMULTITEXCOORD3SPROC) resolved(target, s, t, r); }
+static void APIENTRY glad_lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v) { GLAD_LAZY_RESOLVE(373, glMultiTexCoord3sv, PFNGLMULTITEXCOORD3SVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) { GLAD_LAZY_RESOLVE(374, glMultiTexCoord4d, PFNGLMULTITEXCOORD4DPROC) resolved(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v) { GLAD_LAZY_RESOLVE(375, glMultiTexCoord4dv, PFNGLMULTITEXCOORD4DVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) { GLAD_LAZY_RESOLVE(376, glMultiTexCoord4f, PFNGLMULTITEXCOORD4FPROC) resolved(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v) { GLAD_LAZY_RESOLVE(377, glMultiTexCoord4fv, PFNGLMULTITEXCOORD4FVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) { GLAD_LAZY_RESOLVE(378, glMultiTexCoord4i, PFNGLMULTITEXCOORD4IPROC) resolved(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4iv(GLenum target, const GLint *v) { GLAD_LAZY_RESOLVE(379, glMultiTexCoord4iv, PFNGLMULTITEXCOORD4IVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) { GLAD_LAZY_RESOLVE(380, glMultiTexCoord4s, PFNGLMULTITEXCOORD4SPROC) resolved(target, s, t, r, q); }
+static void APIENTRY glad_lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v) { GLAD_LAZY_RESOLVE(381, glMultiTexCoord4sv, PFNGLMULTITEXCOORD4SVPROC) resolved(target, v); }
+static void APIENTRY glad_lazy_glLoadTransposeMatrixf(const GLfloat *m) { GLAD_LAZY_RESOLVE(382, glLoadTransposeMatrixf, PFNGLLOADTRANSPOSEMATRIXFPROC) resolved(m); }
+static void APIENTRY glad_lazy_glLoadTransposeMatrixd(const GLdouble *m) { GLAD_LAZY_RESOLVE(383, glLoadTransposeMatrixd, PFNGLLOADTRANSPOSEMATRIXDPROC) resolved(m); }
+static void APIENTRY glad_lazy_glMultTransposeMatrixf(const GLfloat *m) { GLAD_LAZY_RESOLVE(384, glMultTransposeMatrixf, PFNGLMULTTRANSPOSEMATRIXFPROC) resolved(m); }
+static void APIENTRY glad_lazy_glMultTransposeMatrixd(const GLdouble *m) { GLAD_LAZY_RESOLVE(385, glMultTransposeMatrixd, PFNGLMULTTRANSPOSEMATRIXDPROC) resolved(m); }
+#endif
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { GLAD_LAZY_RESOLVE(386, glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC) resolved(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha); }
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) { GLAD_LAZY_RESOLVE(387, glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC) resolved(mode, first, count, drawcount); }
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) { GLAD_LAZY_RESOLVE(388, glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC) resolved(mode, count, type, indices, drawcount); }
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(389, glPointParameterf, PFNGLPOINTPARAMETERFPROC) resolved(pname, param); }
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) { GLAD_LAZY_RESOLVE(390, glPointParameterfv, PFNGLPOINTPARAMETERFVPROC) resolved(pname, params); }
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(391, glPointParameteri, PFNGLPOINTPARAMETERIPROC) resolved(pname, param); }
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) { GLAD_LAZY_RESOLVE(392, glPointParameteriv, PFNGLPOINTPARAMETERIVPROC) resolved(pname, params); }
+#ifndef GLAD_CORE_ONLY
+static void APIENTRY glad_lazy_glFogCoordf(GLfloat coord) { GLAD_LAZY_RESOLVE(393, glFogCoordf, PFNGLFOGCOORDFPROC) resolved(coord); }
+static void APIENTRY glad_lazy_glFogCoordfv(const GLfloat *coord) { GLAD_LAZY_RESOLVE(394, glFogCoordfv, PFNGLFOGCOORDFVPROC) resolved(coord); }
+static void APIENTRY glad_lazy_glFogCoordd(GLdouble coord) { GLAD_LAZY_RESOLVE(395, glFogCoordd, PFNGLFOGCOORDDPROC) resolved(coord); }
+static void APIENTRY glad_lazy_glFogCoorddv(const GLdouble *coord) { GLAD_LAZY_RESOLVE(396, glFogCoorddv, PFNGLFOGCOORDDVPROC) resolved(coord); }
+static void APIENTRY glad_lazy_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(397, glFogCoordPointer, PFNGLFOGCOORDPOINTERPROC) resolved(type, stride, pointer); }
+static void APIENTRY glad_lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) { GLAD_LAZY_RESOLVE(398, glSecondaryColor3b, PFNGLSECONDARYCOLOR3BPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3bv(const GLbyte *v) { GLAD_LAZY_RESOLVE(399, glSecondaryColor3bv, PFNGLSECONDARYCOLOR3BVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) { GLAD_LAZY_RESOLVE(400, glSecondaryColor3d, PFNGLSECONDARYCOLOR3DPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(401, glSecondaryColor3dv, PFNGLSECONDARYCOLOR3DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) { GLAD_LAZY_RESOLVE(402, glSecondaryColor3f, PFNGLSECONDARYCOLOR3FPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(403, glSecondaryColor3fv, PFNGLSECONDARYCOLOR3FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue) { GLAD_LAZY_RESOLVE(404, glSecondaryColor3i, PFNGLSECONDARYCOLOR3IPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3iv(const GLint *v) { GLAD_LAZY_RESOLVE(405, glSecondaryColor3iv, PFNGLSECONDARYCOLOR3IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) { GLAD_LAZY_RESOLVE(406, glSecondaryColor3s, PFNGLSECONDARYCOLOR3SPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3sv(const GLshort *v) { GLAD_LAZY_RESOLVE(407, glSecondaryColor3sv, PFNGLSECONDARYCOLOR3SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) { GLAD_LAZY_RESOLVE(408, glSecondaryColor3ub, PFNGLSECONDARYCOLOR3UBPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3ubv(const GLubyte *v) { GLAD_LAZY_RESOLVE(409, glSecondaryColor3ubv, PFNGLSECONDARYCOLOR3UBVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) { GLAD_LAZY_RESOLVE(410, glSecondaryColor3ui, PFNGLSECONDARYCOLOR3UIPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3uiv(const GLuint *v) { GLAD_LAZY_RESOLVE(411, glSecondaryColor3uiv, PFNGLSECONDARYCOLOR3UIVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) { GLAD_LAZY_RESOLVE(412, glSecondaryColor3us, PFNGLSECONDARYCOLOR3USPROC) resolved(red, green, blue); }
+static void APIENTRY glad_lazy_glSecondaryColor3usv(const GLushort *v) { GLAD_LAZY_RESOLVE(413, glSecondaryColor3usv, PFNGLSECONDARYCOLOR3USVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(414, glSecondaryColorPointer, PFNGLSECONDARYCOLORPOINTERPROC) resolved(size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glWindowPos2d(GLdouble x, GLdouble y) { GLAD_LAZY_RESOLVE(415, glWindowPos2d, PFNGLWINDOWPOS2DPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(416, glWindowPos2dv, PFNGLWINDOWPOS2DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glWindowPos2f(GLfloat x, GLfloat y) { GLAD_LAZY_RESOLVE(417, glWindowPos2f, PFNGLWINDOWPOS2FPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(418, glWindowPos2fv, PFNGLWINDOWPOS2FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glWindowPos2i(GLint x, GLint y) { GLAD_LAZY_RESOLVE(419, glWindowPos2i, PFNGLWINDOWPOS2IPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2iv(const GLint *v) { GLAD_LAZY_RESOLVE(420, glWindowPos2iv, PFNGLWINDOWPOS2IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glWindowPos2s(GLshort x, GLshort y) { GLAD_LAZY_RESOLVE(421, glWindowPos2s, PFNGLWINDOWPOS2SPROC) resolved(x, y); }
+static void APIENTRY glad_lazy_glWindowPos2sv(const GLshort *v) { GLAD_LAZY_RESOLVE(422, glWindowPos2sv, PFNGLWINDOWPOS2SVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) { GLAD_LAZY_RESOLVE(423, glWindowPos3d, PFNGLWINDOWPOS3DPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3dv(const GLdouble *v) { GLAD_LAZY_RESOLVE(424, glWindowPos3dv, PFNGLWINDOWPOS3DVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) { GLAD_LAZY_RESOLVE(425, glWindowPos3f, PFNGLWINDOWPOS3FPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3fv(const GLfloat *v) { GLAD_LAZY_RESOLVE(426, glWindowPos3fv, PFNGLWINDOWPOS3FVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glWindowPos3i(GLint x, GLint y, GLint z) { GLAD_LAZY_RESOLVE(427, glWindowPos3i, PFNGLWINDOWPOS3IPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3iv(const GLint *v) { GLAD_LAZY_RESOLVE(428, glWindowPos3iv, PFNGLWINDOWPOS3IVPROC) resolved(v); }
+static void APIENTRY glad_lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z) { GLAD_LAZY_RESOLVE(429, glWindowPos3s, PFNGLWINDOWPOS3SPROC) resolved(x, y, z); }
+static void APIENTRY glad_lazy_glWindowPos3sv(const GLshort *v) { GLAD_LAZY_RESOLVE(430, glWindowPos3sv, PFNGLWINDOWPOS3SVPROC) resolved(v); }
+#endif
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { GLAD_LAZY_RESOLVE(431, glBlendColor, PFNGLBLENDCOLORPROC) resolved(red, green, blue, alpha); }
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) { GLAD_LAZY_RESOLVE(432, glBlendEquation, PFNGLBLENDEQUATIONPROC) resolved(mode); }
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) { GLAD_LAZY_RESOLVE(433, glGenQueries, PFNGLGENQUERIESPROC) resolved(n, ids); }
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) { GLAD_LAZY_RESOLVE(434, glDeleteQueries, PFNGLDELETEQUERIESPROC) resolved(n, ids); }
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) { GLAD_LAZY_RESOLVE(435, glIsQuery, PFNGLISQUERYPROC) return resolved(id); }
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) { GLAD_LAZY_RESOLVE(436, glBeginQuery, PFNGLBEGINQUERYPROC) resolved(target, id); }
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) { GLAD_LAZY_RESOLVE(437, glEndQuery, PFNGLENDQUERYPROC) resolved(target); }
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(438, glGetQueryiv, PFNGLGETQUERYIVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(439, glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC) resolved(id, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) { GLAD_LAZY_RESOLVE(440, glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC) resolved(id, pname, params); }
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) { GLAD_LAZY_RESOLVE(441, glBindBuffer, PFNGLBINDBUFFERPROC) resolved(target, buffer); }
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) { GLAD_LAZY_RESOLVE(442, glDeleteBuffers, PFNGLDELETEBUFFERSPROC) resolved(n, buffers); }
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) { GLAD_LAZY_RESOLVE(443, glGenBuffers, PFNGLGENBUFFERSPROC) resolved(n, buffers); }
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) { GLAD_LAZY_RESOLVE(444, glIsBuffer, PFNGLISBUFFERPROC) return resolved(buffer); }
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { GLAD_LAZY_RESOLVE(445, glBufferData, PFNGLBUFFERDATAPROC) resolved(target, size, data, usage); }
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { GLAD_LAZY_RESOLVE(446, glBufferSubData, PFNGLBUFFERSUBDATAPROC) resolved(target, offset, size, data); }
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { GLAD_LAZY_RESOLVE(447, glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC) resolved(target, offset, size, data); }
+static void *APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) { GLAD_LAZY_RESOLVE(448, glMapBuffer, PFNGLMAPBUFFERPROC) return resolved(target, access); }
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) { GLAD_LAZY_RESOLVE(449, glUnmapBuffer, PFNGLUNMAPBUFFERPROC) return resolved(target); }
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(450, glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) { GLAD_LAZY_RESOLVE(451, glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { GLAD_LAZY_RESOLVE(452, glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC) resolved(modeRGB, modeAlpha); }
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) { GLAD_LAZY_RESOLVE(453, glDrawBuffers, PFNGLDRAWBUFFERSPROC) resolved(n, bufs); }
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) { GLAD_LAZY_RESOLVE(454, glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC) resolved(face, sfail, dpfail, dppass); }
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) { GLAD_LAZY_RESOLVE(455, glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC) resolved(face, func, ref, mask); }
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) { GLAD_LAZY_RESOLVE(456, glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC) resolved(face, mask); }
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) { GLAD_LAZY_RESOLVE(457, glAttachShader, PFNGLATTACHSHADERPROC) resolved(program, shader); }
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { GLAD_LAZY_RESOLVE(458, glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC) resolved(program, index, name); }
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) { GLAD_LAZY_RESOLVE(459, glCompileShader, PFNGLCOMPILESHADERPROC) resolved(shader); }
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) { GLAD_LAZY_RESOLVE(460, glCreateProgram, PFNGLCREATEPROGRAMPROC) return resolved(); }
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) { GLAD_LAZY_RESOLVE(461, glCreateShader, PFNGLCREATESHADERPROC) return resolved(type); }
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) { GLAD_LAZY_RESOLVE(462, glDeleteProgram, PFNGLDELETEPROGRAMPROC) resolved(program); }
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) { GLAD_LAZY_RESOLVE(463, glDeleteShader, PFNGLDELETESHADERPROC) resolved(shader); }
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) { GLAD_LAZY_RESOLVE(464, glDetachShader, PFNGLDETACHSHADERPROC) resolved(program, shader); }
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) { GLAD_LAZY_RESOLVE(465, glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC) resolved(index); }
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) { GLAD_LAZY_RESOLVE(466, glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC) resolved(index); }
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { GLAD_LAZY_RESOLVE(467, glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC) resolved(program, index, bufSize, length, size, type, name); }
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { GLAD_LAZY_RESOLVE(468, glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC) resolved(program, index, bufSize, length, size, type, name); }
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { GLAD_LAZY_RESOLVE(469, glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC) resolved(program, maxCount, count, shaders); }
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) { GLAD_LAZY_RESOLVE(470, glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC) return resolved(program, name); }
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(471, glGetProgramiv, PFNGLGETPROGRAMIVPROC) resolved(program, pname, params); }
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { GLAD_LAZY_RESOLVE(472, glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC) resolved(program, bufSize, length, infoLog); }
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(473, glGetShaderiv, PFNGLGETSHADERIVPROC) resolved(shader, pname, params); }
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { GLAD_LAZY_RESOLVE(474, glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC) resolved(shader, bufSize, length, infoLog); }
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) { GLAD_LAZY_RESOLVE(475, glGetShaderSource, PFNGLGETSHADERSOURCEPROC) resolved(shader, bufSize, length, source); }
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) { GLAD_LAZY_RESOLVE(476, glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC) return resolved(program, name); }
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) { GLAD_LAZY_RESOLVE(477, glGetUniformfv, PFNGLGETUNIFORMFVPROC) resolved(program, location, params); }
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) { GLAD_LAZY_RESOLVE(478, glGetUniformiv, PFNGLGETUNIFORMIVPROC) resolved(program, location, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) { GLAD_LAZY_RESOLVE(479, glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC) resolved(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) { GLAD_LAZY_RESOLVE(480, glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC) resolved(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(481, glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC) resolved(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) { GLAD_LAZY_RESOLVE(482, glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC) resolved(index, pname, pointer); }
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) { GLAD_LAZY_RESOLVE(483, glIsProgram, PFNGLISPROGRAMPROC) return resolved(program); }
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) { GLAD_LAZY_RESOLVE(484, glIsShader, PFNGLISSHADERPROC) return resolved(shader); }
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) { GLAD_LAZY_RESOLVE(485, glLinkProgram, PFNGLLINKPROGRAMPROC) resolved(program); }
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) { GLAD_LAZY_RESOLVE(486, glShaderSource, PFNGLSHADERSOURCEPROC) resolved(shader, count, string, length); }
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) { GLAD_LAZY_RESOLVE(487, glUseProgram, PFNGLUSEPROGRAMPROC) resolved(program); }
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) { GLAD_LAZY_RESOLVE(488, glUniform1f, PFNGLUNIFORM1FPROC) resolved(location, v0); }
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) { GLAD_LAZY_RESOLVE(489, glUniform2f, PFNGLUNIFORM2FPROC) resolved(location, v0, v1); }
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { GLAD_LAZY_RESOLVE(490, glUniform3f, PFNGLUNIFORM3FPROC) resolved(location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { GLAD_LAZY_RESOLVE(491, glUniform4f, PFNGLUNIFORM4FPROC) resolved(location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) { GLAD_LAZY_RESOLVE(492, glUniform1i, PFNGLUNIFORM1IPROC) resolved(location, v0); }
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) { GLAD_LAZY_RESOLVE(493, glUniform2i, PFNGLUNIFORM2IPROC) resolved(location, v0, v1); }
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) { GLAD_LAZY_RESOLVE(494, glUniform3i, PFNGLUNIFORM3IPROC) resolved(location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { GLAD_LAZY_RESOLVE(495, glUniform4i, PFNGLUNIFORM4IPROC) resolved(location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { GLAD_LAZY_RESOLVE(496, glUniform1fv, PFNGLUNIFORM1FVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { GLAD_LAZY_RESOLVE(497, glUniform2fv, PFNGLUNIFORM2FVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { GLAD_LAZY_RESOLVE(498, glUniform3fv, PFNGLUNIFORM3FVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { GLAD_LAZY_RESOLVE(499, glUniform4fv, PFNGLUNIFORM4FVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) { GLAD_LAZY_RESOLVE(500, glUniform1iv, PFNGLUNIFORM1IVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) { GLAD_LAZY_RESOLVE(501, glUniform2iv, PFNGLUNIFORM2IVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) { GLAD_LAZY_RESOLVE(502, glUniform3iv, PFNGLUNIFORM3IVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) { GLAD_LAZY_RESOLVE(503, glUniform4iv, PFNGLUNIFORM4IVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_LAZY_RESOLVE(504, glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC) resolved(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_LAZY_RESOLVE(505, glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC) resolved(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_LAZY_RESOLVE(506, glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC) resolved(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) { GLAD_LAZY_RESOLVE(507, glValidateProgram, PFNGLVALIDATEPROGRAMPROC) resolved(program); }
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) { GLAD_LAZY_RESOLVE(508, glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC) resolved(index, x); }
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) { GLAD_LAZY_RESOLVE(509, glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) { GLAD_LAZY_RESOLVE(510, glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC) resolved(index, x); }
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) { GLAD_LAZY_RESOLVE(511, glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) { GLAD_LAZY_RESOLVE(512, glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC) resolved(index, x); }
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) { GLAD_LAZY_RESOLVE(513, glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) { GLAD_LAZY_RESOLVE(514, glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC) resolved(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) { GLAD_LAZY_RESOLVE(515, glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) { GLAD_LAZY_RESOLVE(516, glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC) resolved(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) { GLAD_LAZY_RESOLVE(517, glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) { GLAD_LAZY_RESOLVE(518, glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC) resolved(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) { GLAD_LAZY_RESOLVE(519, glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { GLAD_LAZY_RESOLVE(520, glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC) resolved(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) { GLAD_LAZY_RESOLVE(521, glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) { GLAD_LAZY_RESOLVE(522, glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC) resolved(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) { GLAD_LAZY_RESOLVE(523, glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) { GLAD_LAZY_RESOLVE(524, glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC) resolved(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) { GLAD_LAZY_RESOLVE(525, glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) { GLAD_LAZY_RESOLVE(526, glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) { GLAD_LAZY_RESOLVE(527, glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) { GLAD_LAZY_RESOLVE(528, glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) { GLAD_LAZY_RESOLVE(529, glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC) resolved(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) { GLAD_LAZY_RESOLVE(530, glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) { GLAD_LAZY_RESOLVE(531, glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) { GLAD_LAZY_RESOLVE(532, glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) { GLAD_LAZY_RESOLVE(533, glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { GLAD_LAZY_RESOLVE(534, glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC) resolved(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) { GLAD_LAZY_RESOLVE(535, glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { GLAD_LAZY_RESOLVE(536, glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC) resolved(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) { GLAD_LAZY_RESOLVE(537, glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) { GLAD_LAZY_RESOLVE(538, glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) { GLAD_LAZY_RESOLVE(539, glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC) resolved(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) { GLAD_LAZY_RESOLVE(540, glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) { GLAD_LAZY_RESOLVE(541, glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) { GLAD_LAZY_RESOLVE(542, glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) { GLAD_LAZY_RESOLVE(543, glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(544, glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC) resolved(index, size, type, normalized, stride, pointer); }
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_LAZY_RESOLVE(545, glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC) resolved(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_LAZY_RESOLVE(546, glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC) resolved(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_LAZY_RESOLVE(547, glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC) resolved(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_LAZY_RESOLVE(548, glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC) resolved(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_LAZY_RESOLVE(549, glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC) resolved(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_LAZY_RESOLVE(550, glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC) resolved(location, count, transpose, value); }
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) { GLAD_LAZY_RESOLVE(551, glColorMaski, PFNGLCOLORMASKIPROC) resolved(index, r, g, b, a); }
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) { GLAD_LAZY_RESOLVE(552, glGetBooleani_v, PFNGLGETBOOLEANI_VPROC) resolved(target, index, data); }
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) { GLAD_LAZY_RESOLVE(553, glGetIntegeri_v, PFNGLGETINTEGERI_VPROC) resolved(target, index, data); }
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) { GLAD_LAZY_RESOLVE(554, glEnablei, PFNGLENABLEIPROC) resolved(target, index); }
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) { GLAD_LAZY_RESOLVE(555, glDisablei, PFNGLDISABLEIPROC) resolved(target, index); }
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) { GLAD_LAZY_RESOLVE(556, glIsEnabledi, PFNGLISENABLEDIPROC) return resolved(target, index); }
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) { GLAD_LAZY_RESOLVE(557, glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC) resolved(primitiveMode); }
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) { GLAD_LAZY_RESOLVE(558, glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC) resolved(); }
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { GLAD_LAZY_RESOLVE(559, glBindBufferRange, PFNGLBINDBUFFERRANGEPROC) resolved(target, index, buffer, offset, size); }
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) { GLAD_LAZY_RESOLVE(560, glBindBufferBase, PFNGLBINDBUFFERBASEPROC) resolved(target, index, buffer); }
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) { GLAD_LAZY_RESOLVE(561, glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC) resolved(program, count, varyings, bufferMode); }
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) { GLAD_LAZY_RESOLVE(562, glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) resolved(program, index, bufSize, length, size, type, name); }
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) { GLAD_LAZY_RESOLVE(563, glClampColor, PFNGLCLAMPCOLORPROC) resolved(target, clamp); }
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) { GLAD_LAZY_RESOLVE(564, glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC) resolved(id, mode); }
+static void APIENTRY glad_lazy_glEndConditionalRender(void) { GLAD_LAZY_RESOLVE(565, glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC) resolved(); }
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { GLAD_LAZY_RESOLVE(566, glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC) resolved(index, size, type, stride, pointer); }
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(567, glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC) resolved(index, pname, params); }
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) { GLAD_LAZY_RESOLVE(568, glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC) resolved(index, pname, params); }
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) { GLAD_LAZY_RESOLVE(569, glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC) resolved(index, x); }
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) { GLAD_LAZY_RESOLVE(570, glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC) resolved(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) { GLAD_LAZY_RESOLVE(571, glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC) resolved(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) { GLAD_LAZY_RESOLVE(572, glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC) resolved(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) { GLAD_LAZY_RESOLVE(573, glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC) resolved(index, x); }
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) { GLAD_LAZY_RESOLVE(574, glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC) resolved(index, x, y); }
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) { GLAD_LAZY_RESOLVE(575, glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC) resolved(index, x, y, z); }
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { GLAD_LAZY_RESOLVE(576, glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC) resolved(index, x, y, z, w); }
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) { GLAD_LAZY_RESOLVE(577, glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) { GLAD_LAZY_RESOLVE(578, glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) { GLAD_LAZY_RESOLVE(579, glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) { GLAD_LAZY_RESOLVE(580, glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) { GLAD_LAZY_RESOLVE(581, glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) { GLAD_LAZY_RESOLVE(582, glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) { GLAD_LAZY_RESOLVE(583, glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) { GLAD_LAZY_RESOLVE(584, glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) { GLAD_LAZY_RESOLVE(585, glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) { GLAD_LAZY_RESOLVE(586, glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) { GLAD_LAZY_RESOLVE(587, glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) { GLAD_LAZY_RESOLVE(588, glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC) resolved(index, v); }
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) { GLAD_LAZY_RESOLVE(589, glGetUniformuiv, PFNGLGETUNIFORMUIVPROC) resolved(program, location, params); }
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) { GLAD_LAZY_RESOLVE(590, glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC) resolved(program, color, name); }
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) { GLAD_LAZY_RESOLVE(591, glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC) return resolved(program, name); }
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) { GLAD_LAZY_RESOLVE(592, glUniform1ui, PFNGLUNIFORM1UIPROC) resolved(location, v0); }
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) { GLAD_LAZY_RESOLVE(593, glUniform2ui, PFNGLUNIFORM2UIPROC) resolved(location, v0, v1); }
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) { GLAD_LAZY_RESOLVE(594, glUniform3ui, PFNGLUNIFORM3UIPROC) resolved(location, v0, v1, v2); }
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { GLAD_LAZY_RESOLVE(595, glUniform4ui, PFNGLUNIFORM4UIPROC) resolved(location, v0, v1, v2, v3); }
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) { GLAD_LAZY_RESOLVE(596, glUniform1uiv, PFNGLUNIFORM1UIVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) { GLAD_LAZY_RESOLVE(597, glUniform2uiv, PFNGLUNIFORM2UIVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) { GLAD_LAZY_RESOLVE(598, glUniform3uiv, PFNGLUNIFORM3UIVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) { GLAD_LAZY_RESOLVE(599, glUniform4uiv, PFNGLUNIFORM4UIVPROC) resolved(location, count, value); }
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) { GLAD_LAZY_RESOLVE(600, glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) { GLAD_LAZY_RESOLVE(601, glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(602, glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) { GLAD_LAZY_RESOLVE(603, glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) { GLAD_LAZY_RESOLVE(604, glClearBufferiv, PFNGLCLEARBUFFERIVPROC) resolved(buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) { GLAD_LAZY_RESOLVE(605, glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC) resolved(buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) { GLAD_LAZY_RESOLVE(606, glClearBufferfv, PFNGLCLEARBUFFERFVPROC) resolved(buffer, drawbuffer, value); }
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { GLAD_LAZY_RESOLVE(607, glClearBufferfi, PFNGLCLEARBUFFERFIPROC) resolved(buffer, drawbuffer, depth, stencil); }
+static const GLubyte *APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) { GLAD_LAZY_RESOLVE(608, glGetStringi, PFNGLGETSTRINGIPROC) return resolved(name, index); }
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) { GLAD_LAZY_RESOLVE(609, glIsRenderbuffer, PFNGLISRENDERBUFFERPROC) return resolved(renderbuffer); }
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) { GLAD_LAZY_RESOLVE(610, glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC) resolved(target, renderbuffer); }
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { GLAD_LAZY_RESOLVE(611, glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC) resolved(n, renderbuffers); }
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { GLAD_LAZY_RESOLVE(612, glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC) resolved(n, renderbuffers); }
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { GLAD_LAZY_RESOLVE(613, glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC) resolved(target, internalformat, width, height); }
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(614, glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC) resolved(target, pname, params); }
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) { GLAD_LAZY_RESOLVE(615, glIsFramebuffer, PFNGLISFRAMEBUFFERPROC) return resolved(framebuffer); }
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) { GLAD_LAZY_RESOLVE(616, glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC) resolved(target, framebuffer); }
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { GLAD_LAZY_RESOLVE(617, glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC) resolved(n, framebuffers); }
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) { GLAD_LAZY_RESOLVE(618, glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC) resolved(n, framebuffers); }
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) { GLAD_LAZY_RESOLVE(619, glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC) return resolved(target); }
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { GLAD_LAZY_RESOLVE(620, glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC) resolved(target, attachment, textarget, texture, level); }
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { GLAD_LAZY_RESOLVE(621, glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC) resolved(target, attachment, textarget, texture, level); }
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { GLAD_LAZY_RESOLVE(622, glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC) resolved(target, attachment, textarget, texture, level, zoffset); }
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { GLAD_LAZY_RESOLVE(623, glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC) resolved(target, attachment, renderbuffertarget, renderbuffer); }
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(624, glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) resolved(target, attachment, pname, params); }
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) { GLAD_LAZY_RESOLVE(625, glGenerateMipmap, PFNGLGENERATEMIPMAPPROC) resolved(target); }
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { GLAD_LAZY_RESOLVE(626, glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC) resolved(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { GLAD_LAZY_RESOLVE(627, glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) resolved(target, samples, internalformat, width, height); }
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { GLAD_LAZY_RESOLVE(628, glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC) resolved(target, attachment, texture, level, layer); }
+static void *APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { GLAD_LAZY_RESOLVE(629, glMapBufferRange, PFNGLMAPBUFFERRANGEPROC) return resolved(target, offset, length, access); }
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) { GLAD_LAZY_RESOLVE(630, glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC) resolved(target, offset, length); }
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) { GLAD_LAZY_RESOLVE(631, glBindVertexArray, PFNGLBINDVERTEXARRAYPROC) resolved(array); }
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) { GLAD_LAZY_RESOLVE(632, glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC) resolved(n, arrays); }
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) { GLAD_LAZY_RESOLVE(633, glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC) resolved(n, arrays); }
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) { GLAD_LAZY_RESOLVE(634, glIsVertexArray, PFNGLISVERTEXARRAYPROC) return resolved(array); }
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { GLAD_LAZY_RESOLVE(635, glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC) resolved(mode, first, count, instancecount); }
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { GLAD_LAZY_RESOLVE(636, glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC) resolved(mode, count, type, indices, instancecount); }
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) { GLAD_LAZY_RESOLVE(637, glTexBuffer, PFNGLTEXBUFFERPROC) resolved(target, internalformat, buffer); }
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) { GLAD_LAZY_RESOLVE(638, glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC) resolved(index); }
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { GLAD_LAZY_RESOLVE(639, glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC) resolved(readTarget, writeTarget, readOffset, writeOffset, size); }
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) { GLAD_LAZY_RESOLVE(640, glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC) resolved(program, uniformCount, uniformNames, uniformIndices); }
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(641, glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC) resolved(program, uniformCount, uniformIndices, pname, params); }
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) { GLAD_LAZY_RESOLVE(642, glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC) resolved(program, uniformIndex, bufSize, length, uniformName); }
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) { GLAD_LAZY_RESOLVE(643, glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC) return resolved(program, uniformBlockName); }
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(644, glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC) resolved(program, uniformBlockIndex, pname, params); }
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) { GLAD_LAZY_RESOLVE(645, glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) resolved(program, uniformBlockIndex, bufSize, length, uniformBlockName); }
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { GLAD_LAZY_RESOLVE(646, glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC) resolved(program, uniformBlockIndex, uniformBlockBinding); }
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { GLAD_LAZY_RESOLVE(647, glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC) resolved(mode, count, type, indices, basevertex); }
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) { GLAD_LAZY_RESOLVE(648, glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) resolved(mode, start, end, count, type, indices, basevertex); }
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) { GLAD_LAZY_RESOLVE(649, glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) resolved(mode, count, type, indices, instancecount, basevertex); }
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) { GLAD_LAZY_RESOLVE(650, glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) resolved(mode, count, type, indices, drawcount, basevertex); }
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) { GLAD_LAZY_RESOLVE(651, glProvokingVertex, PFNGLPROVOKINGVERTEXPROC) resolved(mode); }
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) { GLAD_LAZY_RESOLVE(652, glFenceSync, PFNGLFENCESYNCPROC) return resolved(condition, flags); }
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) { GLAD_LAZY_RESOLVE(653, glIsSync, PFNGLISSYNCPROC) return resolved(sync); }
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) { GLAD_LAZY_RESOLVE(654, glDeleteSync, PFNGLDELETESYNCPROC) resolved(sync); }
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { GLAD_LAZY_RESOLVE(655, glClientWaitSync, PFNGLCLIENTWAITSYNCPROC) return resolved(sync, flags, timeout); }
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { GLAD_LAZY_RESOLVE(656, glWaitSync, PFNGLWAITSYNCPROC) resolved(sync, flags, timeout); }
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) { GLAD_LAZY_RESOLVE(657, glGetInteger64v, PFNGLGETINTEGER64VPROC) resolved(pname, data); }
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) { GLAD_LAZY_RESOLVE(658, glGetSynciv, PFNGLGETSYNCIVPROC) resolved(sync, pname, count, length, values); }
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) { GLAD_LAZY_RESOLVE(659, glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC) resolved(target, index, data); }
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) { GLAD_LAZY_RESOLVE(660, glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC) resolved(target, pname, params); }
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) { GLAD_LAZY_RESOLVE(661, glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC) resolved(target, attachment, texture, level); }
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { GLAD_LAZY_RESOLVE(662, glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC) resolved(target, samples, internalformat, width, height, fixedsamplelocations); }
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { GLAD_LAZY_RESOLVE(663, glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC) resolved(target, samples, internalformat, width, height, depth, fixedsamplelocations); }
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) { GLAD_LAZY_RESOLVE(664, glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC) resolved(pname, index, val); }
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) { GLAD_LAZY_RESOLVE(665, glSampleMaski, PFNGLSAMPLEMASKIPROC) resolved(maskNumber, mask); }
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) { GLAD_LAZY_RESOLVE(666, glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) resolved(program, colorNumber, index, name); }
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) { GLAD_LAZY_RESOLVE(667, glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC) return resolved(program, name); }
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) { GLAD_LAZY_RESOLVE(668, glGenSamplers, PFNGLGENSAMPLERSPROC) resolved(count, samplers); }
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) { GLAD_LAZY_RESOLVE(669, glDeleteSamplers, PFNGLDELETESAMPLERSPROC) resolved(count, samplers); }
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) { GLAD_LAZY_RESOLVE(670, glIsSampler, PFNGLISSAMPLERPROC) return resolved(sampler); }
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) { GLAD_LAZY_RESOLVE(671, glBindSampler, PFNGLBINDSAMPLERPROC) resolved(unit, sampler); }
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) { GLAD_LAZY_RESOLVE(672, glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC) resolved(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) { GLAD_LAZY_RESOLVE(673, glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC) resolved(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) { GLAD_LAZY_RESOLVE(674, glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC) resolved(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) { GLAD_LAZY_RESOLVE(675, glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC) resolved(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) { GLAD_LAZY_RESOLVE(676, glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC) resolved(sampler, pname, param); }
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) { GLAD_LAZY_RESOLVE(677, glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC) resolved(sampler, pname, param); }
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(678, glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC) resolved(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) { GLAD_LAZY_RESOLVE(679, glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC) resolved(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) { GLAD_LAZY_RESOLVE(680, glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC) resolved(sampler, pname, params); }
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) { GLAD_LAZY_RESOLVE(681, glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC) resolved(sampler, pname, params); }
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) { GLAD_LAZY_RESOLVE(682, glQueryCounter, PFNGLQUERYCOUNTERPROC) resolved(id, target); }
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) { GLAD_LAZY_RESOLVE(683, glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC) resolved(id, pname, params); }
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) { GLAD_LAZY_RESOLVE(684, glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC) resolved(id, pname, params); }
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) { GLAD_LAZY_RESOLVE(685, glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC) resolved(index, divisor); }
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { GLAD_LAZY_RESOLVE(686, glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC) resolved(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { GLAD_LAZY_RESOLVE(687, glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC) resolved(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { GLAD_LAZY_RESOLVE(688, glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC) resolved(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { GLAD_LAZY_RESOLVE(689, glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC) resolved(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { GLAD_LAZY_RESOLVE(690, glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC) resolved(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { GLAD_LAZY_RESOLVE(691, glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC) resolved(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { GLAD_LAZY_RESOLVE(692, glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC) resolved(index, type, normalized, value); }
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { GLAD_LAZY_RESOLVE(693, glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC) resolved(index, type, normalized, value); }
+#ifndef GLAD_CORE_ONLY
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) { GLAD_LAZY_RESOLVE(694, glVertexP2ui, PFNGLVERTEXP2UIPROC) resolved(type, value); }
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) { GLAD_LAZY_RESOLVE(695, glVertexP2uiv, PFNGLVERTEXP2UIVPROC) resolved(type, value); }
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) { GLAD_LAZY_RESOLVE(696, glVertexP3ui, PFNGLVERTEXP3UIPROC) resolved(type, value); }
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) { GLAD_LAZY_RESOLVE(697, glVertexP3uiv, PFNGLVERTEXP3UIVPROC) resolved(type, value); }
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) { GLAD_LAZY_RESOLVE(698, glVertexP4ui, PFNGLVERTEXP4UIPROC) resolved(type, value); }
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) { GLAD_LAZY_RESOLVE(699, glVertexP4uiv, PFNGLVERTEXP4UIVPROC) resolved(type, value); }
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) { GLAD_LAZY_RESOLVE(700, glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC) resolved(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) { GLAD_LAZY_RESOLVE(701, glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC) resolved(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) { GLAD_LAZY_RESOLVE(702, glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC) resolved(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) { GLAD_LAZY_RESOLVE(703, glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC) resolved(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) { GLAD_LAZY_RESOLVE(704, glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC) resolved(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) { GLAD_LAZY_RESOLVE(705, glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC) resolved(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) { GLAD_LAZY_RESOLVE(706, glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC) resolved(type, coords); }
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) { GLAD_LAZY_RESOLVE(707, glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC) resolved(type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) { GLAD_LAZY_RESOLVE(708, glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC) resolved(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) { GLAD_LAZY_RESOLVE(709, glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC) resolved(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) { GLAD_LAZY_RESOLVE(710, glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC) resolved(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) { GLAD_LAZY_RESOLVE(711, glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC) resolved(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) { GLAD_LAZY_RESOLVE(712, glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC) resolved(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) { GLAD_LAZY_RESOLVE(713, glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC) resolved(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) { GLAD_LAZY_RESOLVE(714, glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC) resolved(texture, type, coords); }
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) { GLAD_LAZY_RESOLVE(715, glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC) resolved(texture, type, coords); }
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) { GLAD_LAZY_RESOLVE(716, glNormalP3ui, PFNGLNORMALP3UIPROC) resolved(type, coords); }
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) { GLAD_LAZY_RESOLVE(717, glNormalP3uiv, PFNGLNORMALP3UIVPROC) resolved(type, coords); }
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) { GLAD_LAZY_RESOLVE(718, glColorP3ui, PFNGLCOLORP3UIPROC) resolved(type, color); }
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) { GLAD_LAZY_RESOLVE(719, glColorP3uiv, PFNGLCOLORP3UIVPROC) resolved(type, color); }
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) { GLAD_LAZY_RESOLVE(720, glColorP4ui, PFNGLCOLORP4UIPROC) resolved(type, color); }
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) { GLAD_LAZY_RESOLVE(721, glColorP4uiv, PFNGLCOLORP4UIVPROC) resolved(type, color); }
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) { GLAD_LAZY_RESOLVE(722, glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC) resolved(type, color); }
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) { GLAD_LAZY_RESOLVE(723, glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC) resolved(type, color); }
+#endif
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) { GLAD_LAZY_RESOLVE(724, glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC) resolved(program, bufSize, length, binaryFormat, binary); }
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) { GLAD_LAZY_RESOLVE(725, glProgramBinary, PFNGLPROGRAMBINARYPROC) resolved(program, binaryFormat, binary, length); }
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) { GLAD_LAZY_RESOLVE(726, glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC) resolved(program, pname, value); }
+static void APIENTRY glad_lazy_glMaxShaderCompilerThreadsKHR(GLuint count) { GLAD_LAZY_RESOLVE(727, glMaxShaderCompilerThreadsKHR, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) resolved(count); }
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) { GLAD_LAZY_RESOLVE(728, glBufferStorage, PFNGLBUFFERSTORAGEPROC) resolved(target, size, data, flags); }
+
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetString = glad_lazy_glGetString;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+#ifndef GLAD_CORE_ONLY
+	glad_glNewList = glad_lazy_glNewList;
+	glad_glEndList = glad_lazy_glEndList;
+	glad_glCallList = glad_lazy_glCallList;
+	glad_glCallLists = glad_lazy_glCallLists;
+	glad_glDeleteLists = glad_lazy_glDeleteLists;
+	glad_glGenLists = glad_lazy_glGenLists;
+	glad_glListBase = glad_lazy_glListBase;
+	glad_glBegin = glad_lazy_glBegin;
+	glad_glBitmap = glad_lazy_glBitmap;
+	glad_glColor3b = glad_lazy_glColor3b;
+	glad_glColor3bv = glad_lazy_glColor3bv;
+	glad_glColor3d = glad_lazy_glColor3d;
+	glad_glColor3dv = glad_lazy_glColor3dv;
+	glad_glColor3f = glad_lazy_glColor3f;
+	glad_glColor3fv = glad_lazy_glColor3fv;
+	glad_glColor3i = glad_lazy_glColor3i;
+	glad_glColor3iv = glad_lazy_glColor3iv;
+	glad_glColor3s = glad_lazy_glColor3s;
+	glad_glColor3sv = glad_lazy_glColor3sv;
+	glad_glColor3ub = glad_lazy_glColor3ub;
+	glad_glColor3ubv = glad_lazy_glColor3ubv;
+	glad_glColor3ui = glad_lazy_glColor3ui;
+	glad_glColor3uiv = glad_lazy_glColor3uiv;
+	glad_glColor3us = glad_lazy_glColor3us;
+	glad_glColor3usv = glad_lazy_glColor3usv;
+	glad_glColor4b = glad_lazy_glColor4b;
+	glad_glColor4bv = glad_lazy_glColor4bv;
+	glad_glColor4d = glad_lazy_glColor4d;
+	glad_glColor4dv = glad_lazy_glColor4dv;
+	glad_glColor4f = glad_lazy_glColor4f;
+	glad_glColor4fv = glad_lazy_glColor4fv;
+	glad_glColor4i = glad_lazy_glColor4i;
+	glad_glColor4iv = glad_lazy_glColor4iv;
+	glad_glColor4s = glad_lazy_glColor4s;
+	glad_glColor4sv = glad_lazy_glColor4sv;
+	glad_glColor4ub = glad_lazy_glColor4ub;
+	glad_glColor4ubv = glad_lazy_glColor4ubv;
+	glad_glColor4ui = glad_lazy_glColor4ui;
+	glad_glColor4uiv = glad_lazy_glColor4uiv;
+	glad_glColor4us = glad_lazy_glColor4us;
+	glad_glColor4usv = glad_lazy_glColor4usv;
+	glad_glEdgeFlag = glad_lazy_glEdgeFlag;
+	glad_glEdgeFlagv = glad_lazy_glEdgeFlagv;
+	glad_glEnd = glad_lazy_glEnd;
+	glad_glIndexd = glad_lazy_glIndexd;
+	glad_glIndexdv = glad_lazy_glIndexdv;
+	glad_glIndexf = glad_lazy_glIndexf;
+	glad_glIndexfv = glad_lazy_glIndexfv;
+	glad_glIndexi = glad_lazy_glIndexi;
+	glad_glIndexiv = glad_lazy_glIndexiv;
+	glad_glIndexs = glad_lazy_glIndexs;
+	glad_glIndexsv = glad_lazy_glIndexsv;
+	glad_glNormal3b = glad_lazy_glNormal3b;
+	glad_glNormal3bv = glad_lazy_glNormal3bv;
+	glad_glNormal3d = glad_lazy_glNormal3d;
+	glad_glNormal3dv = glad_lazy_glNormal3dv;
+	glad_glNormal3f = glad_lazy_glNormal3f;
+	glad_glNormal3fv = glad_lazy_glNormal3fv;
+	glad_glNormal3i = glad_lazy_glNormal3i;
+	glad_glNormal3iv = glad_lazy_glNormal3iv;
+	glad_glNormal3s = glad_lazy_glNormal3s;
+	glad_glNormal3sv = glad_lazy_glNormal3sv;
+	glad_glRasterPos2d = glad_lazy_glRasterPos2d;
+	glad_glRasterPos2dv = glad_lazy_glRasterPos2dv;
+	glad_glRasterPos2f = glad_lazy_glRasterPos2f;
+	glad_glRasterPos2fv = glad_lazy_glRasterPos2fv;
+	glad_glRasterPos2i = glad_lazy_glRasterPos2i;
+	glad_glRasterPos2iv = glad_lazy_glRasterPos2iv;
+	glad_glRasterPos2s = glad_lazy_glRasterPos2s;
+	glad_glRasterPos2sv = glad_lazy_glRasterPos2sv;
+	glad_glRasterPos3d = glad_lazy_glRasterPos3d;
+	glad_glRasterPos3dv = glad_lazy_glRasterPos3dv;
+	glad_glRasterPos3f = glad_lazy_glRasterPos3f;
+	glad_glRasterPos3fv = glad_lazy_glRasterPos3fv;
+	glad_glRasterPos3i = glad_lazy_glRasterPos3i;
+	glad_glRasterPos3iv = glad_lazy_glRasterPos3iv;
+	glad_glRasterPos3s = glad_lazy_glRasterPos3s;
+	glad_glRasterPos3sv = glad_lazy_glRasterPos3sv;
+	glad_glRasterPos4d = glad_lazy_glRasterPos4d;
+	glad_glRasterPos4dv = glad_lazy_glRasterPos4dv;
+	glad_glRasterPos4f = glad_lazy_glRasterPos4f;
+	glad_glRasterPos4fv = glad_lazy_glRasterPos4fv;
+	glad_glRasterPos4i = glad_lazy_glRasterPos4i;
+	glad_glRasterPos4iv = glad_lazy_glRasterPos4iv;
+	glad_glRasterPos4s = glad_lazy_glRasterPos4s;
+	glad_glRasterPos4sv = glad_lazy_glRasterPos4sv;
+	glad_glRectd = glad_lazy_glRectd;
+	glad_glRectdv = glad_lazy_glRectdv;
+	glad_glRectf = glad_lazy_glRectf;
+	glad_glRectfv = glad_lazy_glRectfv;
+	glad_glRecti = glad_lazy_glRecti;
+	glad_glRectiv = glad_lazy_glRectiv;
+	glad_glRects = glad_lazy_glRects;
+	glad_glRectsv = glad_lazy_glRectsv;
+	glad_glTexCoord1d = glad_lazy_glTexCoord1d;
+	glad_glTexCoord1dv = glad_lazy_glTexCoord1dv;
+	glad_glTexCoord1f = glad_lazy_glTexCoord1f;
+	glad_glTexCoord1fv = glad_lazy_glTexCoord1fv;
+	glad_glTexCoord1i = glad_lazy_glTexCoord1i;
+	glad_glTexCoord1iv = glad_lazy_glTexCoord1iv;
+	glad_glTexCoord1s = glad_lazy_glTexCoord1s;
+	glad_glTexCoord1sv = glad_lazy_glTexCoord1sv;
+	glad_glTexCoord2d = glad_lazy_glTexCoord2d;
+	glad_glTexCoord2dv = glad_lazy_glTexCoord2dv;
+	glad_glTexCoord2f = glad_lazy_glTexCoord2f;
+	glad_glTexCoord2fv = glad_lazy_glTexCoord2fv;
+	glad_glTexCoord2i = glad_lazy_glTexCoord2i;
+	glad_glTexCoord2iv = glad_lazy_glTexCoord2iv;
+	glad_glTexCoord2s = glad_lazy_glTexCoord2s;
+	glad_glTexCoord2sv = glad_lazy_glTexCoord2sv;
+	glad_glTexCoord3d = glad_lazy_glTexCoord3d;
+	glad_glTexCoord3dv = glad_lazy_glTexCoord3dv;
+	glad_glTexCoord3f = glad_lazy_glTexCoord3f;
+	glad_glTexCoord3fv = glad_lazy_glTexCoord3fv;
+	glad_glTexCoord3i = glad_lazy_glTexCoord3i;
+	glad_glTexCoord3iv = glad_lazy_glTexCoord3iv;
+	glad_glTexCoord3s = glad_lazy_glTexCoord3s;
+	glad_glTexCoord3sv = glad_lazy_glTexCoord3sv;
+	glad_glTexCoord4d = glad_lazy_glTexCoord4d;
+	glad_glTexCoord4dv = glad_lazy_glTexCoord4dv;
+	glad_glTexCoord4f = glad_lazy_glTexCoord4f;
+	glad_glTexCoord4fv = glad_lazy_glTexCoord4fv;
+	glad_glTexCoord4i = glad_lazy_glTexCoord4i;
+	glad_glTexCoord4iv = glad_lazy_glTexCoord4iv;
+	glad_glTexCoord4s = glad_lazy_glTexCoord4s;
+	glad_glTexCoord4sv = glad_lazy_glTexCoord4sv;
+	glad_glVertex2d = glad_lazy_glVertex2d;
+	glad_glVertex2dv = glad_lazy_glVertex2dv;
+	glad_glVertex2f = glad_lazy_glVertex2f;
+	glad_glVertex2fv = glad_lazy_glVertex2fv;
+	glad_glVertex2i = glad_lazy_glVertex2i;
+	glad_glVertex2iv = glad_lazy_glVertex2iv;
+	glad_glVertex2s = glad_lazy_glVertex2s;
+	glad_glVertex2sv = glad_lazy_glVertex2sv;
+	glad_glVertex3d = glad_lazy_glVertex3d;
+	glad_glVertex3dv = glad_lazy_glVertex3dv;
+	glad_glVertex3f = glad_lazy_glVertex3f;
+	glad_glVertex3fv = glad_lazy_glVertex3fv;
+	glad_glVertex3i = glad_lazy_glVertex3i;
+	glad_glVertex3iv = glad_lazy_glVertex3iv;
+	glad_glVertex3s = glad_lazy_glVertex3s;
+	glad_glVertex3sv = glad_lazy_glVertex3sv;
+	glad_glVertex4d = glad_lazy_glVertex4d;
+	glad_glVertex4dv = glad_lazy_glVertex4dv;
+	glad_glVertex4f = glad_lazy_glVertex4f;
+	glad_glVertex4fv = glad_lazy_glVertex4fv;
+	glad_glVertex4i = glad_lazy_glVertex4i;
+	glad_glVertex4iv = glad_lazy_glVertex4iv;
+	glad_glVertex4s = glad_lazy_glVertex4s;
+	glad_glVertex4sv = glad_lazy_glVertex4sv;
+	glad_glClipPlane = glad_lazy_glClipPlane;
+	glad_glColorMaterial = glad_lazy_glColorMaterial;
+	glad_glFogf = glad_lazy_glFogf;
+	glad_glFogfv = glad_lazy_glFogfv;
+	glad_glFogi = glad_lazy_glFogi;
+	glad_glFogiv = glad_lazy_glFogiv;
+	glad_glLightf = glad_lazy_glLightf;
+	glad_glLightfv = glad_lazy_glLightfv;
+	glad_glLighti = glad_lazy_glLighti;
+	glad_glLightiv = glad_lazy_glLightiv;
+	glad_glLightModelf = glad_lazy_glLightModelf;
+	glad_glLightModelfv = glad_lazy_glLightModelfv;
+	glad_glLightModeli = glad_lazy_glLightModeli;
+	glad_glLightModeliv = glad_lazy_glLightModeliv;
+	glad_glLineStipple = glad_lazy_glLineStipple;
+	glad_glMaterialf = glad_lazy_glMaterialf;
+	glad_glMaterialfv = glad_lazy_glMaterialfv;
+	glad_glMateriali = glad_lazy_glMateriali;
+	glad_glMaterialiv = glad_lazy_glMaterialiv;
+	glad_glPolygonStipple = glad_lazy_glPolygonStipple;
+	glad_glShadeModel = glad_lazy_glShadeModel;
+	glad_glTexEnvf = glad_lazy_glTexEnvf;
+	glad_glTexEnvfv = glad_lazy_glTexEnvfv;
+	glad_glTexEnvi = glad_lazy_glTexEnvi;
+	glad_glTexEnviv = glad_lazy_glTexEnviv;
+	glad_glTexGend = glad_lazy_glTexGend;
+	glad_glTexGendv = glad_lazy_glTexGendv;
+	glad_glTexGenf = glad_lazy_glTexGenf;
+	glad_glTexGenfv = glad_lazy_glTexGenfv;
+	glad_glTexGeni = glad_lazy_glTexGeni;
+	glad_glTexGeniv = glad_lazy_glTexGeniv;
+	glad_glFeedbackBuffer = glad_lazy_glFeedbackBuffer;
+	glad_glSelectBuffer = glad_lazy_glSelectBuffer;
+	glad_glRenderMode = glad_lazy_glRenderMode;
+	glad_glInitNames = glad_lazy_glInitNames;
+	glad_glLoadName = glad_lazy_glLoadName;
+	glad_glPassThrough = glad_lazy_glPassThrough;
+	glad_glPopName = glad_lazy_glPopName;
+	glad_glPushName = glad_lazy_glPushName;
+	glad_glClearAccum = glad_lazy_glClearAccum;
+	glad_glClearIndex = glad_lazy_glClearIndex;
+	glad_glIndexMask = glad_lazy_glIndexMask;
+	glad_glAccum = glad_lazy_glAccum;
+	glad_glPopAttrib = glad_lazy_glPopAttrib;
+	glad_glPushAttrib = glad_lazy_glPushAttrib;
+	glad_glMap1d = glad_lazy_glMap1d;
+	glad_glMap1f = glad_lazy_glMap1f;
+	glad_glMap2d = glad_lazy_glMap2d;
+	glad_glMap2f = glad_lazy_glMap2f;
+	glad_glMapGrid1d = glad_lazy_glMapGrid1d;
+	glad_glMapGrid1f = glad_lazy_glMapGrid1f;
+	glad_glMapGrid2d = glad_lazy_glMapGrid2d;
+	glad_glMapGrid2f = glad_lazy_glMapGrid2f;
+	glad_glEvalCoord1d = glad_lazy_glEvalCoord1d;
+	glad_glEvalCoord1dv = glad_lazy_glEvalCoord1dv;
+	glad_glEvalCoord1f = glad_lazy_glEvalCoord1f;
+	glad_glEvalCoord1fv = glad_lazy_glEvalCoord1fv;
+	glad_glEvalCoord2d = glad_lazy_glEvalCoord2d;
+	glad_glEvalCoord2dv = glad_lazy_glEvalCoord2dv;
+	glad_glEvalCoord2f = glad_lazy_glEvalCoord2f;
+	glad_glEvalCoord2fv = glad_lazy_glEvalCoord2fv;
+	glad_glEvalMesh1 = glad_lazy_glEvalMesh1;
+	glad_glEvalPoint1 = glad_lazy_glEvalPoint1;
+	glad_glEvalMesh2 = glad_lazy_glEvalMesh2;
+	glad_glEvalPoint2 = glad_lazy_glEvalPoint2;
+	glad_glAlphaFunc = glad_lazy_glAlphaFunc;
+	glad_glPixelZoom = glad_lazy_glPixelZoom;
+	glad_glPixelTransferf = glad_lazy_glPixelTransferf;
+	glad_glPixelTransferi = glad_lazy_glPixelTransferi;
+	glad_glPixelMapfv = glad_lazy_glPixelMapfv;
+	glad_glPixelMapuiv = glad_lazy_glPixelMapuiv;
+	glad_glPixelMapusv = glad_lazy_glPixelMapusv;
+	glad_glCopyPixels = glad_lazy_glCopyPixels;
+	glad_glDrawPixels = glad_lazy_glDrawPixels;
+	glad_glGetClipPlane = glad_lazy_glGetClipPlane;
+	glad_glGetLightfv = glad_lazy_glGetLightfv;
+	glad_glGetLightiv = glad_lazy_glGetLightiv;
+	glad_glGetMapdv = glad_lazy_glGetMapdv;
+	glad_glGetMapfv = glad_lazy_glGetMapfv;
+	glad_glGetMapiv = glad_lazy_glGetMapiv;
+	glad_glGetMaterialfv = glad_lazy_glGetMaterialfv;
+	glad_glGetMaterialiv = glad_lazy_glGetMaterialiv;
+	glad_glGetPixelMapfv = glad_lazy_glGetPixelMapfv;
+	glad_glGetPixelMapuiv = glad_lazy_glGetPixelMapuiv;
+	glad_glGetPixelMapusv = glad_lazy_glGetPixelMapusv;
+	glad_glGetPolygonStipple = glad_lazy_glGetPolygonStipple;
+	glad_glGetTexEnvfv = glad_lazy_glGetTexEnvfv;
+	glad_glGetTexEnviv = glad_lazy_glGetTexEnviv;
+	glad_glGetTexGendv = glad_lazy_glGetTexGendv;
+	glad_glGetTexGenfv = glad_lazy_glGetTexGenfv;
+	glad_glGetTexGeniv = glad_lazy_glGetTexGeniv;
+	glad_glIsList = glad_lazy_glIsList;
+	glad_glFrustum = glad_lazy_glFrustum;
+	glad_glLoadIdentity = glad_lazy_glLoadIdentity;
+	glad_glLoadMatrixf = glad_lazy_glLoadMatrixf;
+	glad_glLoadMatrixd = glad_lazy_glLoadMatrixd;
+	glad_glMatrixMode = glad_lazy_glMatrixMode;
+	glad_glMultMatrixf = glad_lazy_glMultMatrixf;
+	glad_glMultMatrixd = glad_lazy_glMultMatrixd;
+	glad_glOrtho = glad_lazy_glOrtho;
+	glad_glPopMatrix = glad_lazy_glPopMatrix;
+	glad_glPushMatrix = glad_lazy_glPushMatrix;
+	glad_glRotated = glad_lazy_glRotated;
+	glad_glRotatef = glad_lazy_glRotatef;
+	glad_glScaled = glad_lazy_glScaled;
+	glad_glScalef = glad_lazy_glScalef;
+	glad_glTranslated = glad_lazy_glTranslated;
+	glad_glTranslatef = glad_lazy_glTranslatef;
+#endif
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+#ifndef GLAD_CORE_ONLY
+	glad_glArrayElement = glad_lazy_glArrayElement;
+	glad_glColorPointer = glad_lazy_glColorPointer;
+	glad_glDisableClientState = glad_lazy_glDisableClientState;
+	glad_glEdgeFlagPointer = glad_lazy_glEdgeFlagPointer;
+	glad_glEnableClientState = glad_lazy_glEnableClientState;
+	glad_glIndexPointer = glad_lazy_glIndexPointer;
+	glad_glInterleavedArrays = glad_lazy_glInterleavedArrays;
+	glad_glNormalPointer = glad_lazy_glNormalPointer;
+	glad_glTexCoordPointer = glad_lazy_glTexCoordPointer;
+	glad_glVertexPointer = glad_lazy_glVertexPointer;
+	glad_glAreTexturesResident = glad_lazy_glAreTexturesResident;
+	glad_glPrioritizeTextures = glad_lazy_glPrioritizeTextures;
+	glad_glIndexub = glad_lazy_glIndexub;
+	glad_glIndexubv = glad_lazy_glIndexubv;
+	glad_glPopClientAttrib = glad_lazy_glPopClientAttrib;
+	glad_glPushClientAttrib = glad_lazy_glPushClientAttrib;
+#endif
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+#ifndef GLAD_CORE_ONLY
+	glad_glClientActiveTexture = glad_lazy_glClientActiveTexture;
+	glad_glMultiTexCoord1d = glad_lazy_glMultiTexCoord1d;
+	glad_glMultiTexCoord1dv = glad_lazy_glMultiTexCoord1dv;
+	glad_glMultiTexCoord1f = glad_lazy_glMultiTexCoord1f;
+	glad_glMultiTexCoord1fv = glad_lazy_glMultiTexCoord1fv;
+	glad_glMultiTexCoord1i = glad_lazy_glMultiTexCoord1i;
+	glad_glMultiTexCoord1iv = glad_lazy_glMultiTexCoord1iv;
+	glad_glMultiTexCoord1s = glad_lazy_glMultiTexCoord1s;
+	glad_glMultiTexCoord1sv = glad_lazy_glMultiTexCoord1sv;
+	glad_glMultiTexCoord2d = glad_lazy_glMultiTexCoord2d;
+	glad_glMultiTexCoord2dv = glad_lazy_glMultiTexCoord2dv;
+	glad_glMultiTexCoord2f = glad_lazy_glMultiTexCoord2f;
+	glad_glMultiTexCoord2fv = glad_lazy_glMultiTexCoord2fv;
+	glad_glMultiTexCoord2i = glad_lazy_glMultiTexCoord2i;
+	glad_glMultiTexCoord2iv = glad_lazy_glMultiTexCoord2iv;
+	glad_glMultiTexCoord2s = glad_lazy_glMultiTexCoord2s;
+	glad_glMultiTexCoord2sv = glad_lazy_glMultiTexCoord2sv;
+	glad_glMultiTexCoord3d = glad_lazy_glMultiTexCoord3d;
+	glad_glMultiTexCoord3dv = glad_lazy_glMultiTexCoord3dv;
+	glad_glMultiTexCoord3f = glad_lazy_glMultiTexCoord3f;
+	glad_glMultiTexCoord3fv = glad_lazy_glMultiTexCoord3fv;
+	glad_glMultiTexCoord3i = glad_lazy_glMultiTexCoord3i;
+	glad_glMultiTexCoord3iv = glad_lazy_glMultiTexCoord3iv;
+	glad_glMultiTexCoord3s = glad_lazy_glMultiTexCoord3s;
+	glad_glMultiTexCoord3sv = glad_lazy_glMultiTexCoord3sv;
+	glad_glMultiTexCoord4d = glad_lazy_glMultiTexCoord4d;
+	glad_glMultiTexCoord4dv = glad_lazy_glMultiTexCoord4dv;
+	glad_glMultiTexCoord4f = glad_lazy_glMultiTexCoord4f;
+	glad_glMultiTexCoord4fv = glad_lazy_glMultiTexCoord4fv;
+	glad_glMultiTexCoord4i = glad_lazy_glMultiTexCoord4i;
+	glad_glMultiTexCoord4iv = glad_lazy_glMultiTexCoord4iv;
+	glad_glMultiTexCoord4s = glad_lazy_glMultiTexCoord4s;
+	glad_glMultiTexCoord4sv = glad_lazy_glMultiTexCoord4sv;
+	glad_glLoadTransposeMatrixf = glad_lazy_glLoadTransposeMatrixf;
+	glad_glLoadTransposeMatrixd = glad_lazy_glLoadTransposeMatrixd;
+	glad_glMultTransposeMatrixf = glad_lazy_glMultTransposeMatrixf;
+	glad_glMultTransposeMatrixd = glad_lazy_glMultTransposeMatrixd;
+#endif
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+#ifndef GLAD_CORE_ONLY
+	glad_glFogCoordf = glad_lazy_glFogCoordf;
+	glad_glFogCoordfv = glad_lazy_glFogCoordfv;
+	glad_glFogCoordd = glad_lazy_glFogCoordd;
+	glad_glFogCoorddv = glad_lazy_glFogCoorddv;
+	glad_glFogCoordPointer = glad_lazy_glFogCoordPointer;
+	glad_glSecondaryColor3b = glad_lazy_glSecondaryColor3b;
+	glad_glSecondaryColor3bv = glad_lazy_glSecondaryColor3bv;
+	glad_glSecondaryColor3d = glad_lazy_glSecondaryColor3d;
+	glad_glSecondaryColor3dv = glad_lazy_glSecondaryColor3dv;
+	glad_glSecondaryColor3f = glad_lazy_glSecondaryColor3f;
+	glad_glSecondaryColor3fv = glad_lazy_glSecondaryColor3fv;
+	glad_glSecondaryColor3i = glad_lazy_glSecondaryColor3i;
+	glad_glSecondaryColor3iv = glad_lazy_glSecondaryColor3iv;
+	glad_glSecondaryColor3s = glad_lazy_glSecondaryColor3s;
+	glad_glSecondaryColor3sv = glad_lazy_glSecondaryColor3sv;
+	glad_glSecondaryColor3ub = glad_lazy_glSecondaryColor3ub;
+	glad_glSecondaryColor3ubv = glad_lazy_glSecondaryColor3ubv;
+	glad_glSecondaryColor3ui = glad_lazy_glSecondaryColor3ui;
+	glad_glSecondaryColor3uiv = glad_lazy_glSecondaryColor3uiv;
+	glad_glSecondaryColor3us = glad_lazy_glSecondaryColor3us;
+	glad_glSecondaryColor3usv = glad_lazy_glSecondaryColor3usv;
+	glad_glSecondaryColorPointer = glad_lazy_glSecondaryColorPointer;
+	glad_glWindowPos2d = glad_lazy_glWindowPos2d;
+	glad_glWindowPos2dv = glad_lazy_glWindowPos2dv;
+	glad_glWindowPos2f = glad_lazy_glWindowPos2f;
+	glad_glWindowPos2fv = glad_lazy_glWindowPos2fv;
+	glad_glWindowPos2i = glad_lazy_glWindowPos2i;
+	glad_glWindowPos2iv = glad_lazy_glWindowPos2iv;
+	glad_glWindowPos2s = glad_lazy_glWindowPos2s;
+	glad_glWindowPos2sv = glad_lazy_glWindowPos2sv;
+	glad_glWindowPos3d = glad_lazy_glWindowPos3d;
+	glad_glWindowPos3dv = glad_lazy_glWindowPos3dv;
+	glad_glWindowPos3f = glad_lazy_glWindowPos3f;
+	glad_glWindowPos3fv = glad_lazy_glWindowPos3fv;
+	glad_glWindowPos3i = glad_lazy_glWindowPos3i;
+	glad_glWindowPos3iv = glad_lazy_glWindowPos3iv;
+	glad_glWindowPos3s = glad_lazy_glWindowPos3s;
+	glad_glWindowPos3sv = glad_lazy_glWindowPos3sv;
+#endif
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+#ifndef GLAD_CORE_ONLY
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+#endif
+}
+static void lazy_GL_ARB_get_program_binary(void) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+}
+static void lazy_GL_KHR_parallel_shader_compile(void) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = glad_lazy_glMaxShaderCompilerThreadsKHR;
+}
+static void lazy_GL_ARB_buffer_storage(void) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = glad_lazy_glBufferStorage;
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	PFNGLGETSTRINGPROC getString;
+#ifdef GLAD_PER_CONTEXT
+	if(!ensure_context()) return 0;
+#endif
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_lazy_loader = load;
+	memset(glad_lazy_resolved, 0, sizeof(glad_lazy_resolved));
+	getString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(getString == NULL) return 0;
+	glGetString = getString;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+
+	/* Keep the pointer resolved above instead of its trampoline */
+	glad_glGetString = getString;
+
+	if (!find_extensionsGL()) return 0;
+	lazy_GL_ARB_buffer_storage();
+	lazy_GL_KHR_parallel_shader_compile();
+	lazy_GL_ARB_get_program_binary();
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+#ifdef GLAD_CALL_HOOKS
+/* Call hooks: gladInstallCallHooks() points every loaded function at a wrapper that records its
+   arguments in a gladGLcall and calls pre and post around the real entry point. Nothing is
+   wrapped until then, and gladRemoveCallHooks() puts the real pointers back where they are still
+   the wrappers and clears pre and post, so a wrapper saved elsewhere (a layer installed on top,
+   like the state cache) just passes calls through from then on.
+   gladInvokeCall() goes the other way and calls a function from a gladGLcall. */
+#ifdef GLAD_PER_CONTEXT
+#define glad_hook_real (glad_gl_context->hook_real)
+#else
+static void *glad_hook_real[GLAD_GL_FUNCTION_COUNT];
+#endif
+static GLADcallhook glad_hook_pre = NULL;
+static GLADcallhook glad_hook_post = NULL;
+
+/* Name, argument type letters and argument names per load-order index */
+static const char *const glad_hook_info[GLAD_GL_FUNCTION_COUNT][3] = {
+	{"glCullFace", "e", "mode"},
+	{"glFrontFace", "e", "mode"},
+	{"glHint", "ee", "target,mode"},
+	{"glLineWidth", "f", "width"},
+	{"glPointSize", "f", "size"},
+	{"glPolygonMode", "ee", "face,mode"},
+	{"glScissor", "iiii", "x,y,width,height"},
+	{"glTexParameterf", "eef", "target,pname,param"},
+	{"glTexParameterfv", "eep", "target,pname,params"},
+	{"glTexParameteri", "eei", "target,pname,param"},
+	{"glTexParameteriv", "eep", "target,pname,params"},
+	{"glTexImage1D", "eiiiieep", "target,level,internalformat,width,border,format,type,pixels"},
+	{"glTexImage2D", "eiiiiieep", "target,level,internalformat,width,height,border,format,type,pixels"},
+	{"glDrawBuffer", "e", "buf"},
+	{"glClear", "x", "mask"},
+	{"glClearColor", "ffff", "red,green,blue,alpha"},
+	{"glClearStencil", "i", "s"},
+	{"glClearDepth", "f", "depth"},
+	{"glStencilMask", "u", "mask"},
+	{"glColorMask", "uuuu", "red,green,blue,alpha"},
+	{"glDepthMask", "u", "flag"},
+	{"glDisable", "e", "cap"},
+	{"glEnable", "e", "cap"},
+	{"glFinish", "", ""},
+	{"glFlush", "", ""},
+	{"glBlendFunc", "ee", "sfactor,dfactor"},
+	{"glLogicOp", "e", "opcode"},
+	{"glStencilFunc", "eiu", "func,ref,mask"},
+	{"glStencilOp", "eee", "fail,zfail,zpass"},
+	{"glDepthFunc", "e", "func"},
+	{"glPixelStoref", "ef", "pname,param"},
+	{"glPixelStorei", "ei", "pname,param"},
+	{"glReadBuffer", "e", "src"},
+	{"glReadPixels", "iiiieep", "x,y,width,height,format,type,pixels"},
+	{"glGetBooleanv", "ep", "pname,data"},
+	{"glGetDoublev", "ep", "pname,data"},
+	{"glGetError", "", ""},
+	{"glGetFloatv", "ep", "pname,data"},
+	{"glGetIntegerv", "ep", "pname,data"},
+	{"glGetString", "e", "name"},
+	{"glGetTexImage", "eieep", "target,level,format,type,pixels"},
+	{"glGetTexParameterfv", "eep", "target,pname,params"},
+	{"glGetTexParameteriv", "eep", "target,pname,params"},
+	{"glGetTexLevelParameterfv", "eiep", "target,level,pname,params"},
+	{"glGetTexLevelParameteriv", "eiep", "target,level,pname,params"},
+	{"glIsEnabled", "e", "cap"},
+	{"glDepthRange", "ff", "n,f"},
+	{"glViewport", "iiii", "x,y,width,height"},
+	{"glNewList", "ue", "list,mode"},
+	{"glEndList", "", ""},
+	{"glCallList", "u", "list"},
+	{"glCallLists", "iep", "n,type,lists"},
+	{"glDeleteLists", "ui", "list,range"},
+	{"glGenLists", "i", "range"},
+	{"glListBase", "u", "base"},
+	{"glBegin", "e", "mode"},
+	{"glBitmap", "iiffffp", "width,height,xorig,yorig,xmove,ymove,bitmap"},
+	{"glColor3b", "iii", "red,green,blue"},
+	{"glColor3bv", "p", "v"},
+	{"glColor3d", "fff", "red,green,blue"},
+	{"glColor3dv", "p", "v"},
+	{"glColor3f", "fff", "red,green,blue"},
+	{"glColor3fv", "p", "v"},
+	{"glColor3i", "iii", "red,green,blue"},
+	{"glColor3iv", "p", "v"},
+	{"glColor3s", "iii", "red,green,blue"},
+	{"glColor3sv", "p", "v"},
+	{"glColor3ub", "uuu", "red,green,blue"},
+	{"glColor3ubv", "p", "v"},
+	{"glColor3ui", "uuu", "red,green,blue"},
+	{"glColor3uiv", "p", "v"},
+	{"glColor3us", "uuu", "red,green,blue"},
+	{"glColor3usv", "p", "v"},
+	{"glColor4b", "iiii", "red,green,blue,alpha"},
+	{"glColor4bv", "p", "v"},
+	{"glColor4d", "ffff", "red,green,blue,alpha"},
+	{"glColor4dv", "p", "v"},
+	{"glColor4f", "ffff", "red,green,blue,alpha"},
+	{"glColor4fv", "p", "v"},
+	{"glColor4i", "iiii", "red,green,blue,alpha"},
+	{"glColor4iv", "p", "v"},
+	{"glColor4s", "iiii", "red,green,blue,alpha"},
+	{"glColor4sv", "p", "v"},
+	{"glColor4ub", "uuuu", "red,green,blue,alpha"},
+	{"glColor4ubv", "p", "v"},
+	{"glColor4ui", "uuuu", "red,green,blue,alpha"},
+	{"glColor4uiv", "p", "v"},
+	{"glColor4us", "uuuu", "red,green,blue,alpha"},
+	{"glColor4usv", "p", "v"},
+	{"glEdgeFlag", "u", "flag"},
+	{"glEdgeFlagv", "p", "flag"},
+	{"glEnd", "", ""},
+	{"glIndexd", "f", "c"},
+	{"glIndexdv", "p", "c"},
+	{"glIndexf", "f", "c"},
+	{"glIndexfv", "p", "c"},
+	{"glIndexi", "i", "c"},
+	{"glIndexiv", "p", "c"},
+	{"glIndexs", "i", "c"},
+	{"glIndexsv", "p", "c"},
+	{"glNormal3b", "iii", "nx,ny,nz"},
+	{"glNormal3bv", "p", "v"},
+	{"glNormal3d", "fff", "nx,ny,nz"},
+	{"glNormal3dv", "p", "v"},
+	{"glNormal3f", "fff", "nx,ny,nz"},
+	{"glNormal3fv", "p", "v"},
+	{"glNormal3i", "iii", "nx,ny,nz"},
+	{"glNormal3iv", "p", "v"},
+	{"glNormal3s", "iii", "nx,ny,nz"},
+	{"glNormal3sv", "p", "v"},
+	{"glRasterPos2d", "ff", "x,y"},
+	{"glRasterPos2dv", "p", "v"},
+	{"glRasterPos2f", "ff", "x,y"},
+	{"glRasterPos2fv", "p", "v"},
+	{"glRasterPos2i", "ii", "x,y"},
+	{"glRasterPos2iv", "p", "v"},
+	{"glRasterPos2s", "ii", "x,y"},
+	{"glRasterPos2sv", "p", "v"},
+	{"glRasterPos3d", "fff", "x,y,z"},
+	{"glRasterPos3dv", "p", "v"},
+	{"glRasterPos3f", "fff", "x,y,z"},
+	{"glRasterPos3fv", "p", "v"},
+	{"glRasterPos3i", "iii", "x,y,z"},
+	{"glRasterPos3iv", "p", "v"},
+	{"glRasterPos3s", "iii", "x,y,z"},
+	{"glRasterPos3sv", "p", "v"},
+	{"glRasterPos4d", "ffff", "x,y,z,w"},
+	{"glRasterPos4dv", "p", "v"},
+	{"glRasterPos4f", "ffff", "x,y,z,w"},
+	{"glRasterPos4fv", "p", "v"},
+	{"glRasterPos4i", "iiii", "x,y,z,w"},
+	{"glRasterPos4iv", "p", "v"},
+	{"glRasterPos4s", "iiii", "x,y,z,w"},
+	{"glRasterPos4sv", "p", "v"},
+	{"glRectd", "ffff", "x1,y1,x2,y2"},
+	{"glRectdv", "pp", "v1,v2"},
+	{"glRectf", "ffff", "x1,y1,x2,y2"},
+	{"glRectfv", "pp", "v1,v2"},
+	{"glRecti", "iiii", "x1,y1,x2,y2"},
+	{"glRectiv", "pp", "v1,v2"},
+	{"glRects", "iiii", "x1,y1,x2,y2"},
+	{"glRectsv", "pp", "v1,v2"},
+	{"glTexCoord1d", "f", "s"},
+	{"glTexCoord1dv", "p", "v"},
+	{"glTexCoord1f", "f", "s"},
+	{"glTexCoord1fv", "p", "v"},
+	{"glTexCoord1i", "i", "s"},
+	{"glTexCoord1iv", "p", "v"},
+	{"glTexCoord1s", "i", "s"},
+	{"glTexCoord1sv", "p", "v"},
+	{"glTexCoord2d", "ff", "s,t"},
+	{"glTexCoord2dv", "p", "v"},
+	{"glTexCoord2f", "ff", "s,t"},
+	{"glTexCoord2fv", "p", "v"},
+	{"glTexCoord2i", "ii", "s,t"},
+	{"glTexCoord2iv", "p", "v"},
+	{"glTexCoord2s", "ii", "s,t"},
+	{"glTexCoord2sv", "p", "v"},
+	{"glTexCoord3d", "fff", "s,t,r"},
+	{"glTexCoord3dv", "p", "v"},
+	{"glTexCoord3f", "fff", "s,t,r"},
+	{"glTexCoord3fv", "p", "v"},
+	{"glTexCoord3i", "iii", "s,t,r"},
+	{"glTexCoord3iv", "p", "v"},
+	{"glTexCoord3s", "iii", "s,t,r"},
+	{"glTexCoord3sv", "p", "v"},
+	{"glTexCoord4d", "ffff", "s,t,r,q"},
+	{"glTexCoord4dv", "p", "v"},
+	{"glTexCoord4f", "ffff", "s,t,r,q"},
+	{"glTexCoord4fv", "p", "v"},
+	{"glTexCoord4i", "iiii", "s,t,r,q"},
+	{"glTexCoord4iv", "p", "v"},
+	{"glTexCoord4s", "iiii", "s,t,r,q"},
+	{"glTexCoord4sv", "p", "v"},
+	{"glVertex2d", "ff", "x,y"},
+	{"glVertex2dv", "p", "v"},
+	{"glVertex2f", "ff", "x,y"},
+	{"glVertex2fv", "p", "v"},
+	{"glVertex2i", "ii", "x,y"},
+	{"glVertex2iv", "p", "v"},
+	{"glVertex2s", "ii", "x,y"},
+	{"glVertex2sv", "p", "v"},
+	{"glVertex3d", "fff", "x,y,z"},
+	{"glVertex3dv", "p", "v"},
+	{"glVertex3f", "fff", "x,y,z"},
+	{"glVertex3fv", "p", "v"},
+	{"glVertex3i", "iii", "x,y,z"},
+	{"glVertex3iv", "p", "v"},
+	{"glVertex3s", "iii", "x,y,z"},
+	{"glVertex3sv", "p", "v"},
+	{"glVertex4d", "ffff", "x,y,z,w"},
+	{"glVertex4dv", "p", "v"},
+	{"glVertex4f", "ffff", "x,y,z,w"},
+	{"glVertex4fv", "p", "v"},
+	{"glVertex4i", "iiii", "x,y,z,w"},
+	{"glVertex4iv", "p", "v"},
+	{"glVertex4s", "iiii", "x,y,z,w"},
+	{"glVertex4sv", "p", "v"},
+	{"glClipPlane", "ep", "plane,equation"},
+	{"glColorMaterial", "ee", "face,mode"},
+	{"glFogf", "ef", "pname,param"},
+	{"glFogfv", "ep", "pname,params"},
+	{"glFogi", "ei", "pname,param"},
+	{"glFogiv", "ep", "pname,params"},
+	{"glLightf", "eef", "light,pname,param"},
+	{"glLightfv", "eep", "light,pname,params"},
+	{"glLighti", "eei", "light,pname,param"},
+	{"glLightiv", "eep", "light,pname,params"},
+	{"glLightModelf", "ef", "pname,param"},
+	{"glLightModelfv", "ep", "pname,params"},
+	{"glLightModeli", "ei", "pname,param"},
+	{"glLightModeliv", "ep", "pname,params"},
+	{"glLineStipple", "iu", "factor,pattern"},
+	{"glMaterialf", "eef", "face,pname,param"},
+	{"glMaterialfv", "eep", "face,pname,params"},
+	{"glMateriali", "eei", "face,pname,param"},
+	{"glMaterialiv", "eep", "face,pname,params"},
+	{"glPolygonStipple", "p", "mask"},
+	{"glShadeModel", "e", "mode"},
+	{"glTexEnvf", "eef", "target,pname,param"},
+	{"glTexEnvfv", "eep", "target,pname,params"},
+	{"glTexEnvi", "eei", "target,pname,param"},
+	{"glTexEnviv", "eep", "target,pname,params"},
+	{"glTexGend", "eef", "coord,pname,param"},
+	{"glTexGendv", "eep", "coord,pname,params"},
+	{"glTexGenf", "eef", "coord,pname,param"},
+	{"glTexGenfv", "eep", "coord,pname,params"},
+	{"glTexGeni", "eei", "coord,pname,param"},
+	{"glTexGeniv", "eep", "coord,pname,params"},
+	{"glFeedbackBuffer", "iep", "size,type,buffer"},
+	{"glSelectBuffer", "ip", "size,buffer"},
+	{"glRenderMode", "e", "mode"},
+	{"glInitNames", "", ""},
+	{"glLoadName", "u", "name"},
+	{"glPassThrough", "f", "token"},
+	{"glPopName", "", ""},
+	{"glPushName", "u", "name"},
+	{"glClearAccum", "ffff", "red,green,blue,alpha"},
+	{"glClearIndex", "f", "c"},
+	{"glIndexMask", "u", "mask"},
+	{"glAccum", "ef", "op,value"},
+	{"glPopAttrib", "", ""},
+	{"glPushAttrib", "x", "mask"},
+	{"glMap1d", "effiip", "target,u1,u2,stride,order,points"},
+	{"glMap1f", "effiip", "target,u1,u2,stride,order,points"},
+	{"glMap2d", "effiiffiip", "target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points"},
+	{"glMap2f", "effiiffiip", "target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points"},
+	{"glMapGrid1d", "iff", "un,u1,u2"},
+	{"glMapGrid1f", "iff", "un,u1,u2"},
+	{"glMapGrid2d", "iffiff", "un,u1,u2,vn,v1,v2"},
+	{"glMapGrid2f", "iffiff", "un,u1,u2,vn,v1,v2"},
+	{"glEvalCoord1d", "f", "u"},
+	{"glEvalCoord1dv", "p", "u"},
+	{"glEvalCoord1f", "f", "u"},
+	{"glEvalCoord1fv", "p", "u"},
+	{"glEvalCoord2d", "ff", "u,v"},
+	{"glEvalCoord2dv", "p", "u"},
+	{"glEvalCoord2f", "ff", "u,v"},
+	{"glEvalCoord2fv", "p", "u"},
+	{"glEvalMesh1", "eii", "mode,i1,i2"},
+	{"glEvalPoint1", "i", "i"},
+	{"glEvalMesh2", "eiiii", "mode,i1,i2,j1,j2"},
+	{"glEvalPoint2", "ii", "i,j"},
+	{"glAlphaFunc", "ef", "func,ref"},
+	{"glPixelZoom", "ff", "xfactor,yfactor"},
+	{"glPixelTransferf", "ef", "pname,param"},
+	{"glPixelTransferi", "ei", "pname,param"},
+	{"glPixelMapfv", "eip", "map,mapsize,values"},
+	{"glPixelMapuiv", "eip", "map,mapsize,values"},
+	{"glPixelMapusv", "eip", "map,mapsize,values"},
+	{"glCopyPixels", "iiiie", "x,y,width,height,type"},
+	{"glDrawPixels", "iieep", "width,height,format,type,pixels"},
+	{"glGetClipPlane", "ep", "plane,equation"},
+	{"glGetLightfv", "eep", "light,pname,params"},
+	{"glGetLightiv", "eep", "light,pname,params"},
+	{"glGetMapdv", "eep", "target,query,v"},
+	{"glGetMapfv", "eep", "target,query,v"},
+	{"glGetMapiv", "eep", "target,query,v"},
+	{"glGetMaterialfv", "eep", "face,pname,params"},
+	{"glGetMaterialiv", "eep", "face,pname,params"},
+	{"glGetPixelMapfv", "ep", "map,values"},
+	{"glGetPixelMapuiv", "ep", "map,values"},
+	{"glGetPixelMapusv", "ep", "map,values"},
+	{"glGetPolygonStipple", "p", "mask"},
+	{"glGetTexEnvfv", "eep", "target,pname,params"},
+	{"glGetTexEnviv", "eep", "target,pname,params"},
+	{"glGetTexGendv", "eep", "coord,pname,params"},
+	{"glGetTexGenfv", "eep", "coord,pname,params"},
+	{"glGetTexGeniv", "eep", "coord,pname,params"},
+	{"glIsList", "u", "list"},
+	{"glFrustum", "ffffff", "left,right,bottom,top,zNear,zFar"},
+	{"glLoadIdentity", "", ""},
+	{"glLoadMatrixf", "p", "m"},
+	{"glLoadMatrixd", "p", "m"},
+	{"glMatrixMode", "e", "mode"},
+	{"glMultMatrixf", "p", "m"},
+	{"glMultMatrixd", "p", "m"},
+	{"glOrtho", "ffffff", "left,right,bottom,top,zNear,zFar"},
+	{"glPopMatrix", "", ""},
+	{"glPushMatrix", "", ""},
+	{"glRotated", "ffff", "angle,x,y,z"},
+	{"glRotatef", "ffff", "angle,x,y,z"},
+	{"glScaled", "fff", "x,y,z"},
+	{"glScalef", "fff", "x,y,z"},
+	{"glTranslated", "fff", "x,y,z"},
+	{"glTranslatef", "fff", "x,y,z"},
+	{"glDrawArrays", "eii", "mode,first,count"},
+	{"glDrawElements", "eiep", "mode,count,type,indices"},
+	{"glGetPointerv", "ep", "pname,params"},
+	{"glPolygonOffset", "ff", "factor,units"},
+	{"glCopyTexImage1D", "eieiiii", "target,level,internalformat,x,y,width,border"},
+	{"glCopyTexImage2D", "eieiiiii", "target,level,internalformat,x,y,width,height,border"},
+	{"glCopyTexSubImage1D", "eiiiii", "target,level,xoffset,x,y,width"},
+	{"glCopyTexSubImage2D", "eiiiiiii", "target,level,xoffset,yoffset,x,y,width,height"},
+	{"glTexSubImage1D", "eiiieep", "target,level,xoffset,width,format,type,pixels"},
+	{"glTexSubImage2D", "eiiiiieep", "target,level,xoffset,yoffset,width,height,format,type,pixels"},
+	{"glBindTexture", "eu", "target,texture"},
+	{"glDeleteTextures", "ip", "n,textures"},
+	{"glGenTextures", "ip", "n,textures"},
+	{"glIsTexture", "u", "texture"},
+	{"glArrayElement", "i", "i"},
+	{"glColorPointer", "ieip", "size,type,stride,pointer"},
+	{"glDisableClientState", "e", "array"},
+	{"glEdgeFlagPointer", "ip", "stride,pointer"},
+	{"glEnableClientState", "e", "array"},
+	{"glIndexPointer", "eip", "type,stride,pointer"},
+	{"glInterleavedArrays", "eip", "format,stride,pointer"},
+	{"glNormalPointer", "eip", "type,stride,pointer"},
+	{"glTexCoordPointer", "ieip", "size,type,stride,pointer"},
+	{"glVertexPointer", "ieip", "size,type,stride,pointer"},
+	{"glAreTexturesResident", "ipp", "n,textures,residences"},
+	{"glPrioritizeTextures", "ipp", "n,textures,priorities"},
+	{"glIndexub", "u", "c"},
+	{"glIndexubv", "p", "c"},
+	{"glPopClientAttrib", "", ""},
+	{"glPushClientAttrib", "x", "mask"},
+	{"glDrawRangeElements", "euuiep", "mode,start,end,count,type,indices"},
+	{"glTexImage3D", "eiiiiiieep", "target,level,internalformat,width,height,depth,border,format,type,pixels"},
+	{"glTexSubImage3D", "eiiiiiiieep", "target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels"},
+	{"glCopyTexSubImage3D", "eiiiiiiii", "target,level,xoffset,yoffset,zoffset,x,y,width,height"},
+	{"glActiveTexture", "e", "texture"},
+	{"glSampleCoverage", "fu", "value,invert"},
+	{"glCompressedTexImage3D", "eieiiiiip", "target,level,internalformat,width,height,depth,border,imageSize,data"},
+	{"glCompressedTexImage2D", "eieiiiip", "target,level,internalformat,width,height,border,imageSize,data"},
+	{"glCompressedTexImage1D", "eieiiip", "target,level,internalformat,width,border,imageSize,data"},
+	{"glCompressedTexSubImage3D", "eiiiiiiieip", "target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data"},
+	{"glCompressedTexSubImage2D", "eiiiiieip", "target,level,xoffset,yoffset,width,height,format,imageSize,data"},
+	{"glCompressedTexSubImage1D", "eiiieip", "target,level,xoffset,width,format,imageSize,data"},
+	{"glGetCompressedTexImage", "eip", "target,level,img"},
+	{"glClientActiveTexture", "e", "texture"},
+	{"glMultiTexCoord1d", "ef", "target,s"},
+	{"glMultiTexCoord1dv", "ep", "target,v"},
+	{"glMultiTexCoord1f", "ef", "target,s"},
+	{"glMultiTexCoord1fv", "ep", "target,v"},
+	{"glMultiTexCoord1i", "ei", "target,s"},
+	{"glMultiTexCoord1iv", "ep", "target,v"},
+	{"glMultiTexCoord1s", "ei", "target,s"},
+	{"glMultiTexCoord1sv", "ep", "target,v"},
+	{"glMultiTexCoord2d", "eff", "target,s,t"},
+	{"glMultiTexCoord2dv", "ep", "target,v"},
+	{"glMultiTexCoord2f", "eff", "target,s,t"},
+	{"glMultiTexCoord2fv", "ep", "target,v"},
+	{"glMultiTexCoord2i", "eii", "target,s,t"},
+	{"glMultiTexCoord2iv", "ep", "target,v"},
+	{"glMultiTexCoord2s", "eii", "target,s,t"},
+	{"glMultiTexCoord2sv", "ep", "target,v"},
+	{"glMultiTexCoord3d", "efff", "target,s,t,r"},
+	{"glMultiTexCoord3dv", "ep", "target,v"},
+	{"glMultiTexCoord3f", "efff", "target,s,t,r"},
+	{"glMultiTexCoord3fv", "ep", "target,v"},
+	{"glMultiTexCoord3i", "eiii", "target,s,t,r"},
+	{"glMultiTexCoord3iv", "ep", "target,v"},
+	{"glMultiTexCoord3s", "eiii", "target,s,t,r"},
+	{"glMultiTexCoord3sv", "ep", "target,v"},
+	{"glMultiTexCoord4d", "effff", "target,s,t,r,q"},
+	{"glMultiTexCoord4dv", "ep", "target,v"},
+	{"glMultiTexCoord4f", "effff", "target,s,t,r,q"},
+	{"glMultiTexCoord4fv", "ep", "target,v"},
+	{"glMultiTexCoord4i", "eiiii", "target,s,t,r,q"},
+	{"glMultiTexCoord4iv", "ep", "target,v"},
+	{"glMultiTexCoord4s", "eiiii", "target,s,t,r,q"},
+	{"glMultiTexCoord4sv", "ep", "target,v"},
+	{"glLoadTransposeMatrixf", "p", "m"},
+	{"glLoadTransposeMatrixd", "p", "m"},
+	{"glMultTransposeMatrixf", "p", "m"},
+	{"glMultTransposeMatrixd", "p", "m"},
+	{"glBlendFuncSeparate", "eeee", "sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha"},
+	{"glMultiDrawArrays", "eppi", "mode,first,count,drawcount"},
+	{"glMultiDrawElements", "epepi", "mode,count,type,indices,drawcount"},
+	{"glPointParameterf", "ef", "pname,param"},
+	{"glPointParameterfv", "ep", "pname,params"},
+	{"glPointParameteri", "ei", "pname,param"},
+	{"glPointParameteriv", "ep", "pname,params"},
+	{"glFogCoordf", "f", "coord"},
+	{"glFogCoordfv", "p", "coord"},
+	{"glFogCoordd", "f", "coord"},
+	{"glFogCoorddv", "p", "coord"},
+	{"glFogCoordPointer", "eip", "type,stride,pointer"},
+	{"glSecondaryColor3b", "iii", "red,green,blue"},
+	{"glSecondaryColor3bv", "p", "v"},
+	{"glSecondaryColor3d", "fff", "red,green,blue"},
+	{"glSecondaryColor3dv", "p", "v"},
+	{"glSecondaryColor3f", "fff", "red,green,blue"},
+	{"glSecondaryColor3fv", "p", "v"},
+	{"glSecondaryColor3i", "iii", "red,green,blue"},
+	{"glSecondaryColor3iv", "p", "v"},
+	{"glSecondaryColor3s", "iii", "red,green,blue"},
+	{"glSecondaryColor3sv", "p", "v"},
+	{"glSecondaryColor3ub", "uuu", "red,green,blue"},
+	{"glSecondaryColor3ubv", "p", "v"},
+	{"glSecondaryColor3ui", "uuu", "red,green,blue"},
+	{"glSecondaryColor3uiv", "p", "v"},
+	{"glSecondaryColor3us", "uuu", "red,green,blue"},
+	{"glSecondaryColor3usv", "p", "v"},
+	{"glSecondaryColorPointer", "ieip", "size,type,stride,pointer"},
+	{"glWindowPos2d", "ff", "x,y"},
+	{"glWindowPos2dv", "p", "v"},
+	{"glWindowPos2f", "ff", "x,y"},
+	{"glWindowPos2fv", "p", "v"},
+	{"glWindowPos2i", "ii", "x,y"},
+	{"glWindowPos2iv", "p", "v"},
+	{"glWindowPos2s", "ii", "x,y"},
+	{"glWindowPos2sv", "p", "v"},
+	{"glWindowPos3d", "fff", "x,y,z"},
+	{"glWindowPos3dv", "p", "v"},
+	{"glWindowPos3f", "fff", "x,y,z"},
+	{"glWindowPos3fv", "p", "v"},
+	{"glWindowPos3i", "iii", "x,y,z"},
+	{"glWindowPos3iv", "p", "v"},
+	{"glWindowPos3s", "iii", "x,y,z"},
+	{"glWindowPos3sv", "p", "v"},
+	{"glBlendColor", "ffff", "red,green,blue,alpha"},
+	{"glBlendEquation", "e", "mode"},
+	{"glGenQueries", "ip", "n,ids"},
+	{"glDeleteQueries", "ip", "n,ids"},
+	{"glIsQuery", "u", "id"},
+	{"glBeginQuery", "eu", "target,id"},
+	{"glEndQuery", "e", "target"},
+	{"glGetQueryiv", "eep", "target,pname,params"},
+	{"glGetQueryObjectiv", "uep", "id,pname,params"},
+	{"glGetQueryObjectuiv", "uep", "id,pname,params"},
+	{"glBindBuffer", "eu", "target,buffer"},
+	{"glDeleteBuffers", "ip", "n,buffers"},
+	{"glGenBuffers", "ip", "n,buffers"},
+	{"glIsBuffer", "u", "buffer"},
+	{"glBufferData", "eipe", "target,size,data,usage"},
+	{"glBufferSubData", "eiip", "target,offset,size,data"},
+	{"glGetBufferSubData", "eiip", "target,offset,size,data"},
+	{"glMapBuffer", "ee", "target,access"},
+	{"glUnmapBuffer", "e", "target"},
+	{"glGetBufferParameteriv", "eep", "target,pname,params"},
+	{"glGetBufferPointerv", "eep", "target,pname,params"},
+	{"glBlendEquationSeparate", "ee", "modeRGB,modeAlpha"},
+	{"glDrawBuffers", "ip", "n,bufs"},
+	{"glStencilOpSeparate", "eeee", "face,sfail,dpfail,dppass"},
+	{"glStencilFuncSeparate", "eeiu", "face,func,ref,mask"},
+	{"glStencilMaskSeparate", "eu", "face,mask"},
+	{"glAttachShader", "uu", "program,shader"},
+	{"glBindAttribLocation", "uup", "program,index,name"},
+	{"glCompileShader", "u", "shader"},
+	{"glCreateProgram", "", ""},
+	{"glCreateShader", "e", "type"},
+	{"glDeleteProgram", "u", "program"},
+	{"glDeleteShader", "u", "shader"},
+	{"glDetachShader", "uu", "program,shader"},
+	{"glDisableVertexAttribArray", "u", "index"},
+	{"glEnableVertexAttribArray", "u", "index"},
+	{"glGetActiveAttrib", "uuipppp", "program,index,bufSize,length,size,type,name"},
+	{"glGetActiveUniform", "uuipppp", "program,index,bufSize,length,size,type,name"},
+	{"glGetAttachedShaders", "uipp", "program,maxCount,count,shaders"},
+	{"glGetAttribLocation", "up", "program,name"},
+	{"glGetProgramiv", "uep", "program,pname,params"},
+	{"glGetProgramInfoLog", "uipp", "program,bufSize,length,infoLog"},
+	{"glGetShaderiv", "uep", "shader,pname,params"},
+	{"glGetShaderInfoLog", "uipp", "shader,bufSize,length,infoLog"},
+	{"glGetShaderSource", "uipp", "shader,bufSize,length,source"},
+	{"glGetUniformLocation", "up", "program,name"},
+	{"glGetUniformfv", "uip", "program,location,params"},
+	{"glGetUniformiv", "uip", "program,location,params"},
+	{"glGetVertexAttribdv", "uep", "index,pname,params"},
+	{"glGetVertexAttribfv", "uep", "index,pname,params"},
+	{"glGetVertexAttribiv", "uep", "index,pname,params"},
+	{"glGetVertexAttribPointerv", "uep", "index,pname,pointer"},
+	{"glIsProgram", "u", "program"},
+	{"glIsShader", "u", "shader"},
+	{"glLinkProgram", "u", "program"},
+	{"glShaderSource", "uipp", "shader,count,string,length"},
+	{"glUseProgram", "u", "program"},
+	{"glUniform1f", "if", "location,v0"},
+	{"glUniform2f", "iff", "location,v0,v1"},
+	{"glUniform3f", "ifff", "location,v0,v1,v2"},
+	{"glUniform4f", "iffff", "location,v0,v1,v2,v3"},
+	{"glUniform1i", "ii", "location,v0"},
+	{"glUniform2i", "iii", "location,v0,v1"},
+	{"glUniform3i", "iiii", "location,v0,v1,v2"},
+	{"glUniform4i", "iiiii", "location,v0,v1,v2,v3"},
+	{"glUniform1fv", "iip", "location,count,value"},
+	{"glUniform2fv", "iip", "location,count,value"},
+	{"glUniform3fv", "iip", "location,count,value"},
+	{"glUniform4fv", "iip", "location,count,value"},
+	{"glUniform1iv", "iip", "location,count,value"},
+	{"glUniform2iv", "iip", "location,count,value"},
+	{"glUniform3iv", "iip", "location,count,value"},
+	{"glUniform4iv", "iip", "location,count,value"},
+	{"glUniformMatrix2fv", "iiup", "location,count,transpose,value"},
+	{"glUniformMatrix3fv", "iiup", "location,count,transpose,value"},
+	{"glUniformMatrix4fv", "iiup", "location,count,transpose,value"},
+	{"glValidateProgram", "u", "program"},
+	{"glVertexAttrib1d", "uf", "index,x"},
+	{"glVertexAttrib1dv", "up", "index,v"},
+	{"glVertexAttrib1f", "uf", "index,x"},
+	{"glVertexAttrib1fv", "up", "index,v"},
+	{"glVertexAttrib1s", "ui", "index,x"},
+	{"glVertexAttrib1sv", "up", "index,v"},
+	{"glVertexAttrib2d", "uff", "index,x,y"},
+	{"glVertexAttrib2dv", "up", "index,v"},
+	{"glVertexAttrib2f", "uff", "index,x,y"},
+	{"glVertexAttrib2fv", "up", "index,v"},
+	{"glVertexAttrib2s", "uii", "index,x,y"},
+	{"glVertexAttrib2sv", "up", "index,v"},
+	{"glVertexAttrib3d", "ufff", "index,x,y,z"},
+	{"glVertexAttrib3dv", "up", "index,v"},
+	{"glVertexAttrib3f", "ufff", "index,x,y,z"},
+	{"glVertexAttrib3fv", "up", "index,v"},
+	{"glVertexAttrib3s", "uiii", "index,x,y,z"},
+	{"glVertexAttrib3sv", "up", "index,v"},
+	{"glVertexAttrib4Nbv", "up", "index,v"},
+	{"glVertexAttrib4Niv", "up", "index,v"},
+	{"glVertexAttrib4Nsv", "up", "index,v"},
+	{"glVertexAttrib4Nub", "uuuuu", "index,x,y,z,w"},
+	{"glVertexAttrib4Nubv", "up", "index,v"},
+	{"glVertexAttrib4Nuiv", "up", "index,v"},
+	{"glVertexAttrib4Nusv", "up", "index,v"},
+	{"glVertexAttrib4bv", "up", "index,v"},
+	{"glVertexAttrib4d", "uffff", "index,x,y,z,w"},
+	{"glVertexAttrib4dv", "up", "index,v"},
+	{"glVertexAttrib4f", "uffff", "index,x,y,z,w"},
+	{"glVertexAttrib4fv", "up", "index,v"},
+	{"glVertexAttrib4iv", "up", "index,v"},
+	{"glVertexAttrib4s", "uiiii", "index,x,y,z,w"},
+	{"glVertexAttrib4sv", "up", "index,v"},
+	{"glVertexAttrib4ubv", "up", "index,v"},
+	{"glVertexAttrib4uiv", "up", "index,v"},
+	{"glVertexAttrib4usv", "up", "index,v"},
+	{"glVertexAttribPointer", "uieuip", "index,size,type,normalized,stride,pointer"},
+	{"glUniformMatrix2x3fv", "iiup", "location,count,transpose,value"},
+	{"glUniformMatrix3x2fv", "iiup", "location,count,transpose,value"},
+	{"glUniformMatrix2x4fv", "iiup", "location,count,transpose,value"},
+	{"glUniformMatrix4x2fv", "iiup", "location,count,transpose,value"},
+	{"glUniformMatrix3x4fv", "iiup", "location,count,transpose,value"},
+	{"glUniformMatrix4x3fv", "iiup", "location,count,transpose,value"},
+	{"glColorMaski", "uuuuu", "index,r,g,b,a"},
+	{"glGetBooleani_v", "eup", "target,index,data"},
+	{"glGetIntegeri_v", "eup", "target,index,data"},
+	{"glEnablei", "eu", "target,index"},
+	{"glDisablei", "eu", "target,index"},
+	{"glIsEnabledi", "eu", "target,index"},
+	{"glBeginTransformFeedback", "e", "primitiveMode"},
+	{"glEndTransformFeedback", "", ""},
+	{"glBindBufferRange", "euuii", "target,index,buffer,offset,size"},
+	{"glBindBufferBase", "euu", "target,index,buffer"},
+	{"glTransformFeedbackVaryings", "uipe", "program,count,varyings,bufferMode"},
+	{"glGetTransformFeedbackVarying", "uuipppp", "program,index,bufSize,length,size,type,name"},
+	{"glClampColor", "ee", "target,clamp"},
+	{"glBeginConditionalRender", "ue", "id,mode"},
+	{"glEndConditionalRender", "", ""},
+	{"glVertexAttribIPointer", "uieip", "index,size,type,stride,pointer"},
+	{"glGetVertexAttribIiv", "uep", "index,pname,params"},
+	{"glGetVertexAttribIuiv", "uep", "index,pname,params"},
+	{"glVertexAttribI1i", "ui", "index,x"},
+	{"glVertexAttribI2i", "uii", "index,x,y"},
+	{"glVertexAttribI3i", "uiii", "index,x,y,z"},
+	{"glVertexAttribI4i", "uiiii", "index,x,y,z,w"},
+	{"glVertexAttribI1ui", "uu", "index,x"},
+	{"glVertexAttribI2ui", "uuu", "index,x,y"},
+	{"glVertexAttribI3ui", "uuuu", "index,x,y,z"},
+	{"glVertexAttribI4ui", "uuuuu", "index,x,y,z,w"},
+	{"glVertexAttribI1iv", "up", "index,v"},
+	{"glVertexAttribI2iv", "up", "index,v"},
+	{"glVertexAttribI3iv", "up", "index,v"},
+	{"glVertexAttribI4iv", "up", "index,v"},
+	{"glVertexAttribI1uiv", "up", "index,v"},
+	{"glVertexAttribI2uiv", "up", "index,v"},
+	{"glVertexAttribI3uiv", "up", "index,v"},
+	{"glVertexAttribI4uiv", "up", "index,v"},
+	{"glVertexAttribI4bv", "up", "index,v"},
+	{"glVertexAttribI4sv", "up", "index,v"},
+	{"glVertexAttribI4ubv", "up", "index,v"},
+	{"glVertexAttribI4usv", "up", "index,v"},
+	{"glGetUniformuiv", "uip", "program,location,params"},
+	{"glBindFragDataLocation", "uup", "program,color,name"},
+	{"glGetFragDataLocation", "up", "program,name"},
+	{"glUniform1ui", "iu", "location,v0"},
+	{"glUniform2ui", "iuu", "location,v0,v1"},
+	{"glUniform3ui", "iuuu", "location,v0,v1,v2"},
+	{"glUniform4ui", "iuuuu", "location,v0,v1,v2,v3"},
+	{"glUniform1uiv", "iip", "location,count,value"},
+	{"glUniform2uiv", "iip", "location,count,value"},
+	{"glUniform3uiv", "iip", "location,count,value"},
+	{"glUniform4uiv", "iip", "location,count,value"},
+	{"glTexParameterIiv", "eep", "target,pname,params"},
+	{"glTexParameterIuiv", "eep", "target,pname,params"},
+	{"glGetTexParameterIiv", "eep", "target,pname,params"},
+	{"glGetTexParameterIuiv", "eep", "target,pname,params"},
+	{"glClearBufferiv", "eip", "buffer,drawbuffer,value"},
+	{"glClearBufferuiv", "eip", "buffer,drawbuffer,value"},
+	{"glClearBufferfv", "eip", "buffer,drawbuffer,value"},
+	{"glClearBufferfi", "eifi", "buffer,drawbuffer,depth,stencil"},
+	{"glGetStringi", "eu", "name,index"},
+	{"glIsRenderbuffer", "u", "renderbuffer"},
+	{"glBindRenderbuffer", "eu", "target,renderbuffer"},
+	{"glDeleteRenderbuffers", "ip", "n,renderbuffers"},
+	{"glGenRenderbuffers", "ip", "n,renderbuffers"},
+	{"glRenderbufferStorage", "eeii", "target,internalformat,width,height"},
+	{"glGetRenderbufferParameteriv", "eep", "target,pname,params"},
+	{"glIsFramebuffer", "u", "framebuffer"},
+	{"glBindFramebuffer", "eu", "target,framebuffer"},
+	{"glDeleteFramebuffers", "ip", "n,framebuffers"},
+	{"glGenFramebuffers", "ip", "n,framebuffers"},
+	{"glCheckFramebufferStatus", "e", "target"},
+	{"glFramebufferTexture1D", "eeeui", "target,attachment,textarget,texture,level"},
+	{"glFramebufferTexture2D", "eeeui", "target,attachment,textarget,texture,level"},
+	{"glFramebufferTexture3D", "eeeuii", "target,attachment,textarget,texture,level,zoffset"},
+	{"glFramebufferRenderbuffer", "eeeu", "target,attachment,renderbuffertarget,renderbuffer"},
+	{"glGetFramebufferAttachmentParameteriv", "eeep", "target,attachment,pname,params"},
+	{"glGenerateMipmap", "e", "target"},
+	{"glBlitFramebuffer", "iiiiiiiixe", "srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter"},
+	{"glRenderbufferStorageMultisample", "eieii", "target,samples,internalformat,width,height"},
+	{"glFramebufferTextureLayer", "eeuii", "target,attachment,texture,level,layer"},
+	{"glMapBufferRange", "eiix", "target,offset,length,access"},
+	{"glFlushMappedBufferRange", "eii", "target,offset,length"},
+	{"glBindVertexArray", "u", "array"},
+	{"glDeleteVertexArrays", "ip", "n,arrays"},
+	{"glGenVertexArrays", "ip", "n,arrays"},
+	{"glIsVertexArray", "u", "array"},
+	{"glDrawArraysInstanced", "eiii", "mode,first,count,instancecount"},
+	{"glDrawElementsInstanced", "eiepi", "mode,count,type,indices,instancecount"},
+	{"glTexBuffer", "eeu", "target,internalformat,buffer"},
+	{"glPrimitiveRestartIndex", "u", "index"},
+	{"glCopyBufferSubData", "eeiii", "readTarget,writeTarget,readOffset,writeOffset,size"},
+	{"glGetUniformIndices", "uipp", "program,uniformCount,uniformNames,uniformIndices"},
+	{"glGetActiveUniformsiv", "uipep", "program,uniformCount,uniformIndices,pname,params"},
+	{"glGetActiveUniformName", "uuipp", "program,uniformIndex,bufSize,length,uniformName"},
+	{"glGetUniformBlockIndex", "up", "program,uniformBlockName"},
+	{"glGetActiveUniformBlockiv", "uuep", "program,uniformBlockIndex,pname,params"},
+	{"glGetActiveUniformBlockName", "uuipp", "program,uniformBlockIndex,bufSize,length,uniformBlockName"},
+	{"glUniformBlockBinding", "uuu", "program,uniformBlockIndex,uniformBlockBinding"},
+	{"glDrawElementsBaseVertex", "eiepi", "mode,count,type,indices,basevertex"},
+	{"glDrawRangeElementsBaseVertex", "euuiepi", "mode,start,end,count,type,indices,basevertex"},
+	{"glDrawElementsInstancedBaseVertex", "eiepii", "mode,count,type,indices,instancecount,basevertex"},
+	{"glMultiDrawElementsBaseVertex", "epepip", "mode,count,type,indices,drawcount,basevertex"},
+	{"glProvokingVertex", "e", "mode"},
+	{"glFenceSync", "ex", "condition,flags"},
+	{"glIsSync", "p", "sync"},
+	{"glDeleteSync", "p", "sync"},
+	{"glClientWaitSync", "pxu", "sync,flags,timeout"},
+	{"glWaitSync", "pxu", "sync,flags,timeout"},
+	{"glGetInteger64v", "ep", "pname,data"},
+	{"glGetSynciv", "peipp", "sync,pname,count,length,values"},
+	{"glGetInteger64i_v", "eup", "target,index,data"},
+	{"glGetBufferParameteri64v", "eep", "target,pname,params"},
+	{"glFramebufferTexture", "eeui", "target,attachment,texture,level"},
+	{"glTexImage2DMultisample", "eieiiu", "target,samples,internalformat,width,height,fixedsamplelocations"},
+	{"glTexImage3DMultisample", "eieiiiu", "target,samples,internalformat,width,height,depth,fixedsamplelocations"},
+	{"glGetMultisamplefv", "eup", "pname,index,val"},
+	{"glSampleMaski", "ux", "maskNumber,mask"},
+	{"glBindFragDataLocationIndexed", "uuup", "program,colorNumber,index,name"},
+	{"glGetFragDataIndex", "up", "program,name"},
+	{"glGenSamplers", "ip", "count,samplers"},
+	{"glDeleteSamplers", "ip", "count,samplers"},
+	{"glIsSampler", "u", "sampler"},
+	{"glBindSampler", "uu", "unit,sampler"},
+	{"glSamplerParameteri", "uei", "sampler,pname,param"},
+	{"glSamplerParameteriv", "uep", "sampler,pname,param"},
+	{"glSamplerParameterf", "uef", "sampler,pname,param"},
+	{"glSamplerParameterfv", "uep", "sampler,pname,param"},
+	{"glSamplerParameterIiv", "uep", "sampler,pname,param"},
+	{"glSamplerParameterIuiv", "uep", "sampler,pname,param"},
+	{"glGetSamplerParameteriv", "uep", "sampler,pname,params"},
+	{"glGetSamplerParameterIiv", "uep", "sampler,pname,params"},
+	{"glGetSamplerParameterfv", "uep", "sampler,pname,params"},
+	{"glGetSamplerParameterIuiv", "uep", "sampler,pname,params"},
+	{"glQueryCounter", "ue", "id,target"},
+	{"glGetQueryObjecti64v", "uep", "id,pname,params"},
+	{"glGetQueryObjectui64v", "uep", "id,pname,params"},
+	{"glVertexAttribDivisor", "uu", "index,divisor"},
+	{"glVertexAttribP1ui", "ueuu", "index,type,normalized,value"},
+	{"glVertexAttribP1uiv", "ueup", "index,type,normalized,value"},
+	{"glVertexAttribP2ui", "ueuu", "index,type,normalized,value"},
+	{"glVertexAttribP2uiv", "ueup", "index,type,normalized,value"},
+	{"glVertexAttribP3ui", "ueuu", "index,type,normalized,value"},
+	{"glVertexAttribP3uiv", "ueup", "index,type,normalized,value"},
+	{"glVertexAttribP4ui", "ueuu", "index,type,normalized,value"},
+	{"glVertexAttribP4uiv", "ueup", "index,type,normalized,value"},
+	{"glVertexP2ui", "eu", "type,value"},
+	{"glVertexP2uiv", "ep", "type,value"},
+	{"glVertexP3ui", "eu", "type,value"},
+	{"glVertexP3uiv", "ep", "type,value"},
+	{"glVertexP4ui", "eu", "type,value"},
+	{"glVertexP4uiv", "ep", "type,value"},
+	{"glTexCoordP1ui", "eu", "type,coords"},
+	{"glTexCoordP1uiv", "ep", "type,coords"},
+	{"glTexCoordP2ui", "eu", "type,coords"},
+	{"glTexCoordP2uiv", "ep", "type,coords"},
+	{"glTexCoordP3ui", "eu", "type,coords"},
+	{"glTexCoordP3uiv", "ep", "type,coords"},
+	{"glTexCoordP4ui", "eu", "type,coords"},
+	{"glTexCoordP4uiv", "ep", "type,coords"},
+	{"glMultiTexCoordP1ui", "eeu", "texture,type,coords"},
+	{"glMultiTexCoordP1uiv", "eep", "texture,type,coords"},
+	{"glMultiTexCoordP2ui", "eeu", "texture,type,coords"},
+	{"glMultiTexCoordP2uiv", "eep", "texture,type,coords"},
+	{"glMultiTexCoordP3ui", "eeu", "texture,type,coords"},
+	{"glMultiTexCoordP3uiv", "eep", "texture,type,coords"},
+	{"glMultiTexCoordP4ui", "eeu", "texture,type,coords"},
+	{"glMultiTexCoordP4uiv", "eep", "texture,type,coords"},
+	{"glNormalP3ui", "eu", "type,coords"},
+	{"glNormalP3uiv", "ep", "type,coords"},
+	{"glColorP3ui", "eu", "type,color"},
+	{"glColorP3uiv", "ep", "type,color"},
+	{"glColorP4ui", "eu", "type,color"},
+	{"glColorP4uiv", "ep", "type,color"},
+	{"glSecondaryColorP3ui", "eu", "type,color"},
+	{"glSecondaryColorP3uiv", "ep", "type,color"},
+	{"glGetProgramBinary", "uippp", "program,bufSize,length,binaryFormat,binary"},
+	{"glProgramBinary", "uepi", "program,binaryFormat,binary,length"},
+	{"glProgramParameteri", "uei", "program,pname,value"},
+	{"glMaxShaderCompilerThreadsKHR", "u", "count"},
+	{"glBufferStorage", "eipx", "target,size,data,flags"}
+};
+/* Result type letter per index, v for void */
+static const char glad_hook_results[GLAD_GL_FUNCTION_COUNT + 1] =
+	"vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvevvpvvvvvuvvvvvvvuvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv"
+	"vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv"
+	"vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvivvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv"
+	"vuvvvvvvvvvvvvvvvvvvvvvvvvvvvvvuvvvvvvvvvvuvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv"
+	"vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvuvvvvvvvvuvvvpuvvvvvvvvvvuuvvvvvvvvivvvvvivvv"
+	"vvvuuvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvuvvvvvvvvvvvvvvvvvvv"
+	"vvvvvvvvvvvvvvvivvvvvvvvvvvvvvvvpuvvvvvuvvvevvvvvvvvvpvvvvuvvvvvvvvuvvvvvvvvpuvevvvvvvvvvvvivvuv"
+	"vvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvvv";
+
+static unsigned long long glad_arg_i(long long value) { return (unsigned long long)value; }
+static unsigned long long glad_arg_u(unsigned long long value) { return value; }
+static unsigned long long glad_arg_f(double value) { unsigned long long bits; memcpy(&bits, &value, sizeof bits); return bits; }
+static unsigned long long glad_arg_p(const void *value) { return (unsigned long long)(size_t)value; }
+static double glad_raw_f(unsigned long long bits) { double value; memcpy(&value, &bits, sizeof value); return value; }
+
+#define GLAD_HOOK_BEGIN(hookIndex) \
+	struct gladGLcall call; \
+	call.index = hookIndex; call.name = glad_hook_info[hookIndex][0]; call.argTypes = glad_hook_info[hookIndex][1]; \
+	call.argNames = glad_hook_info[hookIndex][2]; call.resultType = glad_hook_results[hookIndex]; call.result = 0; call.user = 0;
+#define GLAD_HOOK_PRE if(glad_hook_pre != NULL) glad_hook_pre(&call);
+#define GLAD_HOOK_POST if(glad_hook_post != NULL) glad_hook_post(&call);
+
+static void APIENTRY glad_hook_glCullFace(GLenum mode) { GLAD_HOOK_BEGIN(0) call.args[0] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLCULLFACEPROC)glad_hook_real[0])(mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFrontFace(GLenum mode) { GLAD_HOOK_BEGIN(1) call.args[0] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLFRONTFACEPROC)glad_hook_real[1])(mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glHint(GLenum target, GLenum mode) { GLAD_HOOK_BEGIN(2) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLHINTPROC)glad_hook_real[2])(target, mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLineWidth(GLfloat width) { GLAD_HOOK_BEGIN(3) call.args[0] = glad_arg_f(width); GLAD_HOOK_PRE ((PFNGLLINEWIDTHPROC)glad_hook_real[3])(width); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPointSize(GLfloat size) { GLAD_HOOK_BEGIN(4) call.args[0] = glad_arg_f(size); GLAD_HOOK_PRE ((PFNGLPOINTSIZEPROC)glad_hook_real[4])(size); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPolygonMode(GLenum face, GLenum mode) { GLAD_HOOK_BEGIN(5) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLPOLYGONMODEPROC)glad_hook_real[5])(face, mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { GLAD_HOOK_BEGIN(6) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(width); call.args[3] = glad_arg_i(height); GLAD_HOOK_PRE ((PFNGLSCISSORPROC)glad_hook_real[6])(x, y, width, height); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexParameterf(GLenum target, GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(7) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLTEXPARAMETERFPROC)glad_hook_real[7])(target, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) { GLAD_HOOK_BEGIN(8) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLTEXPARAMETERFVPROC)glad_hook_real[8])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexParameteri(GLenum target, GLenum pname, GLint param) { GLAD_HOOK_BEGIN(9) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLTEXPARAMETERIPROC)glad_hook_real[9])(target, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) { GLAD_HOOK_BEGIN(10) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLTEXPARAMETERIVPROC)glad_hook_real[10])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { GLAD_HOOK_BEGIN(11) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(internalformat); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_i(border); call.args[5] = glad_arg_u(format); call.args[6] = glad_arg_u(type); call.args[7] = glad_arg_p(pixels); GLAD_HOOK_PRE ((PFNGLTEXIMAGE1DPROC)glad_hook_real[11])(target, level, internalformat, width, border, format, type, pixels); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { GLAD_HOOK_BEGIN(12) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(internalformat); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_i(height); call.args[5] = glad_arg_i(border); call.args[6] = glad_arg_u(format); call.args[7] = glad_arg_u(type); call.args[8] = glad_arg_p(pixels); GLAD_HOOK_PRE ((PFNGLTEXIMAGE2DPROC)glad_hook_real[12])(target, level, internalformat, width, height, border, format, type, pixels); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDrawBuffer(GLenum buf) { GLAD_HOOK_BEGIN(13) call.args[0] = glad_arg_u(buf); GLAD_HOOK_PRE ((PFNGLDRAWBUFFERPROC)glad_hook_real[13])(buf); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClear(GLbitfield mask) { GLAD_HOOK_BEGIN(14) call.args[0] = glad_arg_u(mask); GLAD_HOOK_PRE ((PFNGLCLEARPROC)glad_hook_real[14])(mask); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { GLAD_HOOK_BEGIN(15) call.args[0] = glad_arg_f(red); call.args[1] = glad_arg_f(green); call.args[2] = glad_arg_f(blue); call.args[3] = glad_arg_f(alpha); GLAD_HOOK_PRE ((PFNGLCLEARCOLORPROC)glad_hook_real[15])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClearStencil(GLint s) { GLAD_HOOK_BEGIN(16) call.args[0] = glad_arg_i(s); GLAD_HOOK_PRE ((PFNGLCLEARSTENCILPROC)glad_hook_real[16])(s); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClearDepth(GLdouble depth) { GLAD_HOOK_BEGIN(17) call.args[0] = glad_arg_f(depth); GLAD_HOOK_PRE ((PFNGLCLEARDEPTHPROC)glad_hook_real[17])(depth); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glStencilMask(GLuint mask) { GLAD_HOOK_BEGIN(18) call.args[0] = glad_arg_u(mask); GLAD_HOOK_PRE ((PFNGLSTENCILMASKPROC)glad_hook_real[18])(mask); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { GLAD_HOOK_BEGIN(19) call.args[0] = glad_arg_u(red); call.args[1] = glad_arg_u(green); call.args[2] = glad_arg_u(blue); call.args[3] = glad_arg_u(alpha); GLAD_HOOK_PRE ((PFNGLCOLORMASKPROC)glad_hook_real[19])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDepthMask(GLboolean flag) { GLAD_HOOK_BEGIN(20) call.args[0] = glad_arg_u(flag); GLAD_HOOK_PRE ((PFNGLDEPTHMASKPROC)glad_hook_real[20])(flag); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDisable(GLenum cap) { GLAD_HOOK_BEGIN(21) call.args[0] = glad_arg_u(cap); GLAD_HOOK_PRE ((PFNGLDISABLEPROC)glad_hook_real[21])(cap); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEnable(GLenum cap) { GLAD_HOOK_BEGIN(22) call.args[0] = glad_arg_u(cap); GLAD_HOOK_PRE ((PFNGLENABLEPROC)glad_hook_real[22])(cap); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFinish(void) { GLAD_HOOK_BEGIN(23) GLAD_HOOK_PRE ((PFNGLFINISHPROC)glad_hook_real[23])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFlush(void) { GLAD_HOOK_BEGIN(24) GLAD_HOOK_PRE ((PFNGLFLUSHPROC)glad_hook_real[24])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBlendFunc(GLenum sfactor, GLenum dfactor) { GLAD_HOOK_BEGIN(25) call.args[0] = glad_arg_u(sfactor); call.args[1] = glad_arg_u(dfactor); GLAD_HOOK_PRE ((PFNGLBLENDFUNCPROC)glad_hook_real[25])(sfactor, dfactor); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLogicOp(GLenum opcode) { GLAD_HOOK_BEGIN(26) call.args[0] = glad_arg_u(opcode); GLAD_HOOK_PRE ((PFNGLLOGICOPPROC)glad_hook_real[26])(opcode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glStencilFunc(GLenum func, GLint ref, GLuint mask) { GLAD_HOOK_BEGIN(27) call.args[0] = glad_arg_u(func); call.args[1] = glad_arg_i(ref); call.args[2] = glad_arg_u(mask); GLAD_HOOK_PRE ((PFNGLSTENCILFUNCPROC)glad_hook_real[27])(func, ref, mask); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) { GLAD_HOOK_BEGIN(28) call.args[0] = glad_arg_u(fail); call.args[1] = glad_arg_u(zfail); call.args[2] = glad_arg_u(zpass); GLAD_HOOK_PRE ((PFNGLSTENCILOPPROC)glad_hook_real[28])(fail, zfail, zpass); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDepthFunc(GLenum func) { GLAD_HOOK_BEGIN(29) call.args[0] = glad_arg_u(func); GLAD_HOOK_PRE ((PFNGLDEPTHFUNCPROC)glad_hook_real[29])(func); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPixelStoref(GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(30) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLPIXELSTOREFPROC)glad_hook_real[30])(pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPixelStorei(GLenum pname, GLint param) { GLAD_HOOK_BEGIN(31) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLPIXELSTOREIPROC)glad_hook_real[31])(pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glReadBuffer(GLenum src) { GLAD_HOOK_BEGIN(32) call.args[0] = glad_arg_u(src); GLAD_HOOK_PRE ((PFNGLREADBUFFERPROC)glad_hook_real[32])(src); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { GLAD_HOOK_BEGIN(33) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(width); call.args[3] = glad_arg_i(height); call.args[4] = glad_arg_u(format); call.args[5] = glad_arg_u(type); call.args[6] = glad_arg_p(pixels); GLAD_HOOK_PRE ((PFNGLREADPIXELSPROC)glad_hook_real[33])(x, y, width, height, format, type, pixels); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetBooleanv(GLenum pname, GLboolean *data) { GLAD_HOOK_BEGIN(34) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLGETBOOLEANVPROC)glad_hook_real[34])(pname, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetDoublev(GLenum pname, GLdouble *data) { GLAD_HOOK_BEGIN(35) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLGETDOUBLEVPROC)glad_hook_real[35])(pname, data); GLAD_HOOK_POST }
+static GLenum APIENTRY glad_hook_glGetError(void) { GLenum result; GLAD_HOOK_BEGIN(36) GLAD_HOOK_PRE result = ((PFNGLGETERRORPROC)glad_hook_real[36])(); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glGetFloatv(GLenum pname, GLfloat *data) { GLAD_HOOK_BEGIN(37) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLGETFLOATVPROC)glad_hook_real[37])(pname, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetIntegerv(GLenum pname, GLint *data) { GLAD_HOOK_BEGIN(38) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLGETINTEGERVPROC)glad_hook_real[38])(pname, data); GLAD_HOOK_POST }
+static const GLubyte *APIENTRY glad_hook_glGetString(GLenum name) { const GLubyte *result; GLAD_HOOK_BEGIN(39) call.args[0] = glad_arg_u(name); GLAD_HOOK_PRE result = ((PFNGLGETSTRINGPROC)glad_hook_real[39])(name); call.result = glad_arg_p(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { GLAD_HOOK_BEGIN(40) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_u(format); call.args[3] = glad_arg_u(type); call.args[4] = glad_arg_p(pixels); GLAD_HOOK_PRE ((PFNGLGETTEXIMAGEPROC)glad_hook_real[40])(target, level, format, type, pixels); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) { GLAD_HOOK_BEGIN(41) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXPARAMETERFVPROC)glad_hook_real[41])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(42) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXPARAMETERIVPROC)glad_hook_real[42])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) { GLAD_HOOK_BEGIN(43) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_u(pname); call.args[3] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXLEVELPARAMETERFVPROC)glad_hook_real[43])(target, level, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(44) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_u(pname); call.args[3] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXLEVELPARAMETERIVPROC)glad_hook_real[44])(target, level, pname, params); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glIsEnabled(GLenum cap) { GLboolean result; GLAD_HOOK_BEGIN(45) call.args[0] = glad_arg_u(cap); GLAD_HOOK_PRE result = ((PFNGLISENABLEDPROC)glad_hook_real[45])(cap); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glDepthRange(GLdouble n, GLdouble f) { GLAD_HOOK_BEGIN(46) call.args[0] = glad_arg_f(n); call.args[1] = glad_arg_f(f); GLAD_HOOK_PRE ((PFNGLDEPTHRANGEPROC)glad_hook_real[46])(n, f); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { GLAD_HOOK_BEGIN(47) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(width); call.args[3] = glad_arg_i(height); GLAD_HOOK_PRE ((PFNGLVIEWPORTPROC)glad_hook_real[47])(x, y, width, height); GLAD_HOOK_POST }
+#ifndef GLAD_CORE_ONLY
+static void APIENTRY glad_hook_glNewList(GLuint list, GLenum mode) { GLAD_HOOK_BEGIN(48) call.args[0] = glad_arg_u(list); call.args[1] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLNEWLISTPROC)glad_hook_real[48])(list, mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEndList(void) { GLAD_HOOK_BEGIN(49) GLAD_HOOK_PRE ((PFNGLENDLISTPROC)glad_hook_real[49])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCallList(GLuint list) { GLAD_HOOK_BEGIN(50) call.args[0] = glad_arg_u(list); GLAD_HOOK_PRE ((PFNGLCALLLISTPROC)glad_hook_real[50])(list); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCallLists(GLsizei n, GLenum type, const void *lists) { GLAD_HOOK_BEGIN(51) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_p(lists); GLAD_HOOK_PRE ((PFNGLCALLLISTSPROC)glad_hook_real[51])(n, type, lists); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDeleteLists(GLuint list, GLsizei range) { GLAD_HOOK_BEGIN(52) call.args[0] = glad_arg_u(list); call.args[1] = glad_arg_i(range); GLAD_HOOK_PRE ((PFNGLDELETELISTSPROC)glad_hook_real[52])(list, range); GLAD_HOOK_POST }
+static GLuint APIENTRY glad_hook_glGenLists(GLsizei range) { GLuint result; GLAD_HOOK_BEGIN(53) call.args[0] = glad_arg_i(range); GLAD_HOOK_PRE result = ((PFNGLGENLISTSPROC)glad_hook_real[53])(range); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glListBase(GLuint base) { GLAD_HOOK_BEGIN(54) call.args[0] = glad_arg_u(base); GLAD_HOOK_PRE ((PFNGLLISTBASEPROC)glad_hook_real[54])(base); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBegin(GLenum mode) { GLAD_HOOK_BEGIN(55) call.args[0] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLBEGINPROC)glad_hook_real[55])(mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) { GLAD_HOOK_BEGIN(56) call.args[0] = glad_arg_i(width); call.args[1] = glad_arg_i(height); call.args[2] = glad_arg_f(xorig); call.args[3] = glad_arg_f(yorig); call.args[4] = glad_arg_f(xmove); call.args[5] = glad_arg_f(ymove); call.args[6] = glad_arg_p(bitmap); GLAD_HOOK_PRE ((PFNGLBITMAPPROC)glad_hook_real[56])(width, height, xorig, yorig, xmove, ymove, bitmap); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3b(GLbyte red, GLbyte green, GLbyte blue) { GLAD_HOOK_BEGIN(57) call.args[0] = glad_arg_i(red); call.args[1] = glad_arg_i(green); call.args[2] = glad_arg_i(blue); GLAD_HOOK_PRE ((PFNGLCOLOR3BPROC)glad_hook_real[57])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3bv(const GLbyte *v) { GLAD_HOOK_BEGIN(58) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR3BVPROC)glad_hook_real[58])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3d(GLdouble red, GLdouble green, GLdouble blue) { GLAD_HOOK_BEGIN(59) call.args[0] = glad_arg_f(red); call.args[1] = glad_arg_f(green); call.args[2] = glad_arg_f(blue); GLAD_HOOK_PRE ((PFNGLCOLOR3DPROC)glad_hook_real[59])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3dv(const GLdouble *v) { GLAD_HOOK_BEGIN(60) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR3DVPROC)glad_hook_real[60])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3f(GLfloat red, GLfloat green, GLfloat blue) { GLAD_HOOK_BEGIN(61) call.args[0] = glad_arg_f(red); call.args[1] = glad_arg_f(green); call.args[2] = glad_arg_f(blue); GLAD_HOOK_PRE ((PFNGLCOLOR3FPROC)glad_hook_real[61])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3fv(const GLfloat *v) { GLAD_HOOK_BEGIN(62) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR3FVPROC)glad_hook_real[62])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3i(GLint red, GLint green, GLint blue) { GLAD_HOOK_BEGIN(63) call.args[0] = glad_arg_i(red); call.args[1] = glad_arg_i(green); call.args[2] = glad_arg_i(blue); GLAD_HOOK_PRE ((PFNGLCOLOR3IPROC)glad_hook_real[63])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3iv(const GLint *v) { GLAD_HOOK_BEGIN(64) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR3IVPROC)glad_hook_real[64])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3s(GLshort red, GLshort green, GLshort blue) { GLAD_HOOK_BEGIN(65) call.args[0] = glad_arg_i(red); call.args[1] = glad_arg_i(green); call.args[2] = glad_arg_i(blue); GLAD_HOOK_PRE ((PFNGLCOLOR3SPROC)glad_hook_real[65])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3sv(const GLshort *v) { GLAD_HOOK_BEGIN(66) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR3SVPROC)glad_hook_real[66])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) { GLAD_HOOK_BEGIN(67) call.args[0] = glad_arg_u(red); call.args[1] = glad_arg_u(green); call.args[2] = glad_arg_u(blue); GLAD_HOOK_PRE ((PFNGLCOLOR3UBPROC)glad_hook_real[67])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3ubv(const GLubyte *v) { GLAD_HOOK_BEGIN(68) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR3UBVPROC)glad_hook_real[68])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3ui(GLuint red, GLuint green, GLuint blue) { GLAD_HOOK_BEGIN(69) call.args[0] = glad_arg_u(red); call.args[1] = glad_arg_u(green); call.args[2] = glad_arg_u(blue); GLAD_HOOK_PRE ((PFNGLCOLOR3UIPROC)glad_hook_real[69])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3uiv(const GLuint *v) { GLAD_HOOK_BEGIN(70) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR3UIVPROC)glad_hook_real[70])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3us(GLushort red, GLushort green, GLushort blue) { GLAD_HOOK_BEGIN(71) call.args[0] = glad_arg_u(red); call.args[1] = glad_arg_u(green); call.args[2] = glad_arg_u(blue); GLAD_HOOK_PRE ((PFNGLCOLOR3USPROC)glad_hook_real[71])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor3usv(const GLushort *v) { GLAD_HOOK_BEGIN(72) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR3USVPROC)glad_hook_real[72])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) { GLAD_HOOK_BEGIN(73) call.args[0] = glad_arg_i(red); call.args[1] = glad_arg_i(green); call.args[2] = glad_arg_i(blue); call.args[3] = glad_arg_i(alpha); GLAD_HOOK_PRE ((PFNGLCOLOR4BPROC)glad_hook_real[73])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4bv(const GLbyte *v) { GLAD_HOOK_BEGIN(74) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR4BVPROC)glad_hook_real[74])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) { GLAD_HOOK_BEGIN(75) call.args[0] = glad_arg_f(red); call.args[1] = glad_arg_f(green); call.args[2] = glad_arg_f(blue); call.args[3] = glad_arg_f(alpha); GLAD_HOOK_PRE ((PFNGLCOLOR4DPROC)glad_hook_real[75])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4dv(const GLdouble *v) { GLAD_HOOK_BEGIN(76) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR4DVPROC)glad_hook_real[76])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { GLAD_HOOK_BEGIN(77) call.args[0] = glad_arg_f(red); call.args[1] = glad_arg_f(green); call.args[2] = glad_arg_f(blue); call.args[3] = glad_arg_f(alpha); GLAD_HOOK_PRE ((PFNGLCOLOR4FPROC)glad_hook_real[77])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4fv(const GLfloat *v) { GLAD_HOOK_BEGIN(78) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR4FVPROC)glad_hook_real[78])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) { GLAD_HOOK_BEGIN(79) call.args[0] = glad_arg_i(red); call.args[1] = glad_arg_i(green); call.args[2] = glad_arg_i(blue); call.args[3] = glad_arg_i(alpha); GLAD_HOOK_PRE ((PFNGLCOLOR4IPROC)glad_hook_real[79])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4iv(const GLint *v) { GLAD_HOOK_BEGIN(80) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR4IVPROC)glad_hook_real[80])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) { GLAD_HOOK_BEGIN(81) call.args[0] = glad_arg_i(red); call.args[1] = glad_arg_i(green); call.args[2] = glad_arg_i(blue); call.args[3] = glad_arg_i(alpha); GLAD_HOOK_PRE ((PFNGLCOLOR4SPROC)glad_hook_real[81])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4sv(const GLshort *v) { GLAD_HOOK_BEGIN(82) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR4SVPROC)glad_hook_real[82])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) { GLAD_HOOK_BEGIN(83) call.args[0] = glad_arg_u(red); call.args[1] = glad_arg_u(green); call.args[2] = glad_arg_u(blue); call.args[3] = glad_arg_u(alpha); GLAD_HOOK_PRE ((PFNGLCOLOR4UBPROC)glad_hook_real[83])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4ubv(const GLubyte *v) { GLAD_HOOK_BEGIN(84) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR4UBVPROC)glad_hook_real[84])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) { GLAD_HOOK_BEGIN(85) call.args[0] = glad_arg_u(red); call.args[1] = glad_arg_u(green); call.args[2] = glad_arg_u(blue); call.args[3] = glad_arg_u(alpha); GLAD_HOOK_PRE ((PFNGLCOLOR4UIPROC)glad_hook_real[85])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4uiv(const GLuint *v) { GLAD_HOOK_BEGIN(86) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR4UIVPROC)glad_hook_real[86])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) { GLAD_HOOK_BEGIN(87) call.args[0] = glad_arg_u(red); call.args[1] = glad_arg_u(green); call.args[2] = glad_arg_u(blue); call.args[3] = glad_arg_u(alpha); GLAD_HOOK_PRE ((PFNGLCOLOR4USPROC)glad_hook_real[87])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColor4usv(const GLushort *v) { GLAD_HOOK_BEGIN(88) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLCOLOR4USVPROC)glad_hook_real[88])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEdgeFlag(GLboolean flag) { GLAD_HOOK_BEGIN(89) call.args[0] = glad_arg_u(flag); GLAD_HOOK_PRE ((PFNGLEDGEFLAGPROC)glad_hook_real[89])(flag); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEdgeFlagv(const GLboolean *flag) { GLAD_HOOK_BEGIN(90) call.args[0] = glad_arg_p(flag); GLAD_HOOK_PRE ((PFNGLEDGEFLAGVPROC)glad_hook_real[90])(flag); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEnd(void) { GLAD_HOOK_BEGIN(91) GLAD_HOOK_PRE ((PFNGLENDPROC)glad_hook_real[91])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexd(GLdouble c) { GLAD_HOOK_BEGIN(92) call.args[0] = glad_arg_f(c); GLAD_HOOK_PRE ((PFNGLINDEXDPROC)glad_hook_real[92])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexdv(const GLdouble *c) { GLAD_HOOK_BEGIN(93) call.args[0] = glad_arg_p(c); GLAD_HOOK_PRE ((PFNGLINDEXDVPROC)glad_hook_real[93])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexf(GLfloat c) { GLAD_HOOK_BEGIN(94) call.args[0] = glad_arg_f(c); GLAD_HOOK_PRE ((PFNGLINDEXFPROC)glad_hook_real[94])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexfv(const GLfloat *c) { GLAD_HOOK_BEGIN(95) call.args[0] = glad_arg_p(c); GLAD_HOOK_PRE ((PFNGLINDEXFVPROC)glad_hook_real[95])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexi(GLint c) { GLAD_HOOK_BEGIN(96) call.args[0] = glad_arg_i(c); GLAD_HOOK_PRE ((PFNGLINDEXIPROC)glad_hook_real[96])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexiv(const GLint *c) { GLAD_HOOK_BEGIN(97) call.args[0] = glad_arg_p(c); GLAD_HOOK_PRE ((PFNGLINDEXIVPROC)glad_hook_real[97])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexs(GLshort c) { GLAD_HOOK_BEGIN(98) call.args[0] = glad_arg_i(c); GLAD_HOOK_PRE ((PFNGLINDEXSPROC)glad_hook_real[98])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexsv(const GLshort *c) { GLAD_HOOK_BEGIN(99) call.args[0] = glad_arg_p(c); GLAD_HOOK_PRE ((PFNGLINDEXSVPROC)glad_hook_real[99])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) { GLAD_HOOK_BEGIN(100) call.args[0] = glad_arg_i(nx); call.args[1] = glad_arg_i(ny); call.args[2] = glad_arg_i(nz); GLAD_HOOK_PRE ((PFNGLNORMAL3BPROC)glad_hook_real[100])(nx, ny, nz); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormal3bv(const GLbyte *v) { GLAD_HOOK_BEGIN(101) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLNORMAL3BVPROC)glad_hook_real[101])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) { GLAD_HOOK_BEGIN(102) call.args[0] = glad_arg_f(nx); call.args[1] = glad_arg_f(ny); call.args[2] = glad_arg_f(nz); GLAD_HOOK_PRE ((PFNGLNORMAL3DPROC)glad_hook_real[102])(nx, ny, nz); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormal3dv(const GLdouble *v) { GLAD_HOOK_BEGIN(103) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLNORMAL3DVPROC)glad_hook_real[103])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) { GLAD_HOOK_BEGIN(104) call.args[0] = glad_arg_f(nx); call.args[1] = glad_arg_f(ny); call.args[2] = glad_arg_f(nz); GLAD_HOOK_PRE ((PFNGLNORMAL3FPROC)glad_hook_real[104])(nx, ny, nz); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormal3fv(const GLfloat *v) { GLAD_HOOK_BEGIN(105) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLNORMAL3FVPROC)glad_hook_real[105])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormal3i(GLint nx, GLint ny, GLint nz) { GLAD_HOOK_BEGIN(106) call.args[0] = glad_arg_i(nx); call.args[1] = glad_arg_i(ny); call.args[2] = glad_arg_i(nz); GLAD_HOOK_PRE ((PFNGLNORMAL3IPROC)glad_hook_real[106])(nx, ny, nz); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormal3iv(const GLint *v) { GLAD_HOOK_BEGIN(107) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLNORMAL3IVPROC)glad_hook_real[107])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormal3s(GLshort nx, GLshort ny, GLshort nz) { GLAD_HOOK_BEGIN(108) call.args[0] = glad_arg_i(nx); call.args[1] = glad_arg_i(ny); call.args[2] = glad_arg_i(nz); GLAD_HOOK_PRE ((PFNGLNORMAL3SPROC)glad_hook_real[108])(nx, ny, nz); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormal3sv(const GLshort *v) { GLAD_HOOK_BEGIN(109) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLNORMAL3SVPROC)glad_hook_real[109])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos2d(GLdouble x, GLdouble y) { GLAD_HOOK_BEGIN(110) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); GLAD_HOOK_PRE ((PFNGLRASTERPOS2DPROC)glad_hook_real[110])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos2dv(const GLdouble *v) { GLAD_HOOK_BEGIN(111) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS2DVPROC)glad_hook_real[111])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos2f(GLfloat x, GLfloat y) { GLAD_HOOK_BEGIN(112) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); GLAD_HOOK_PRE ((PFNGLRASTERPOS2FPROC)glad_hook_real[112])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos2fv(const GLfloat *v) { GLAD_HOOK_BEGIN(113) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS2FVPROC)glad_hook_real[113])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos2i(GLint x, GLint y) { GLAD_HOOK_BEGIN(114) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); GLAD_HOOK_PRE ((PFNGLRASTERPOS2IPROC)glad_hook_real[114])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos2iv(const GLint *v) { GLAD_HOOK_BEGIN(115) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS2IVPROC)glad_hook_real[115])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos2s(GLshort x, GLshort y) { GLAD_HOOK_BEGIN(116) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); GLAD_HOOK_PRE ((PFNGLRASTERPOS2SPROC)glad_hook_real[116])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos2sv(const GLshort *v) { GLAD_HOOK_BEGIN(117) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS2SVPROC)glad_hook_real[117])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) { GLAD_HOOK_BEGIN(118) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLRASTERPOS3DPROC)glad_hook_real[118])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos3dv(const GLdouble *v) { GLAD_HOOK_BEGIN(119) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS3DVPROC)glad_hook_real[119])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) { GLAD_HOOK_BEGIN(120) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLRASTERPOS3FPROC)glad_hook_real[120])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos3fv(const GLfloat *v) { GLAD_HOOK_BEGIN(121) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS3FVPROC)glad_hook_real[121])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos3i(GLint x, GLint y, GLint z) { GLAD_HOOK_BEGIN(122) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(z); GLAD_HOOK_PRE ((PFNGLRASTERPOS3IPROC)glad_hook_real[122])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos3iv(const GLint *v) { GLAD_HOOK_BEGIN(123) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS3IVPROC)glad_hook_real[123])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos3s(GLshort x, GLshort y, GLshort z) { GLAD_HOOK_BEGIN(124) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(z); GLAD_HOOK_PRE ((PFNGLRASTERPOS3SPROC)glad_hook_real[124])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos3sv(const GLshort *v) { GLAD_HOOK_BEGIN(125) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS3SVPROC)glad_hook_real[125])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) { GLAD_HOOK_BEGIN(126) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); call.args[3] = glad_arg_f(w); GLAD_HOOK_PRE ((PFNGLRASTERPOS4DPROC)glad_hook_real[126])(x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos4dv(const GLdouble *v) { GLAD_HOOK_BEGIN(127) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS4DVPROC)glad_hook_real[127])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) { GLAD_HOOK_BEGIN(128) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); call.args[3] = glad_arg_f(w); GLAD_HOOK_PRE ((PFNGLRASTERPOS4FPROC)glad_hook_real[128])(x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos4fv(const GLfloat *v) { GLAD_HOOK_BEGIN(129) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS4FVPROC)glad_hook_real[129])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) { GLAD_HOOK_BEGIN(130) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(z); call.args[3] = glad_arg_i(w); GLAD_HOOK_PRE ((PFNGLRASTERPOS4IPROC)glad_hook_real[130])(x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos4iv(const GLint *v) { GLAD_HOOK_BEGIN(131) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS4IVPROC)glad_hook_real[131])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) { GLAD_HOOK_BEGIN(132) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(z); call.args[3] = glad_arg_i(w); GLAD_HOOK_PRE ((PFNGLRASTERPOS4SPROC)glad_hook_real[132])(x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRasterPos4sv(const GLshort *v) { GLAD_HOOK_BEGIN(133) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLRASTERPOS4SVPROC)glad_hook_real[133])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) { GLAD_HOOK_BEGIN(134) call.args[0] = glad_arg_f(x1); call.args[1] = glad_arg_f(y1); call.args[2] = glad_arg_f(x2); call.args[3] = glad_arg_f(y2); GLAD_HOOK_PRE ((PFNGLRECTDPROC)glad_hook_real[134])(x1, y1, x2, y2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRectdv(const GLdouble *v1, const GLdouble *v2) { GLAD_HOOK_BEGIN(135) call.args[0] = glad_arg_p(v1); call.args[1] = glad_arg_p(v2); GLAD_HOOK_PRE ((PFNGLRECTDVPROC)glad_hook_real[135])(v1, v2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) { GLAD_HOOK_BEGIN(136) call.args[0] = glad_arg_f(x1); call.args[1] = glad_arg_f(y1); call.args[2] = glad_arg_f(x2); call.args[3] = glad_arg_f(y2); GLAD_HOOK_PRE ((PFNGLRECTFPROC)glad_hook_real[136])(x1, y1, x2, y2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRectfv(const GLfloat *v1, const GLfloat *v2) { GLAD_HOOK_BEGIN(137) call.args[0] = glad_arg_p(v1); call.args[1] = glad_arg_p(v2); GLAD_HOOK_PRE ((PFNGLRECTFVPROC)glad_hook_real[137])(v1, v2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) { GLAD_HOOK_BEGIN(138) call.args[0] = glad_arg_i(x1); call.args[1] = glad_arg_i(y1); call.args[2] = glad_arg_i(x2); call.args[3] = glad_arg_i(y2); GLAD_HOOK_PRE ((PFNGLRECTIPROC)glad_hook_real[138])(x1, y1, x2, y2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRectiv(const GLint *v1, const GLint *v2) { GLAD_HOOK_BEGIN(139) call.args[0] = glad_arg_p(v1); call.args[1] = glad_arg_p(v2); GLAD_HOOK_PRE ((PFNGLRECTIVPROC)glad_hook_real[139])(v1, v2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) { GLAD_HOOK_BEGIN(140) call.args[0] = glad_arg_i(x1); call.args[1] = glad_arg_i(y1); call.args[2] = glad_arg_i(x2); call.args[3] = glad_arg_i(y2); GLAD_HOOK_PRE ((PFNGLRECTSPROC)glad_hook_real[140])(x1, y1, x2, y2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRectsv(const GLshort *v1, const GLshort *v2) { GLAD_HOOK_BEGIN(141) call.args[0] = glad_arg_p(v1); call.args[1] = glad_arg_p(v2); GLAD_HOOK_PRE ((PFNGLRECTSVPROC)glad_hook_real[141])(v1, v2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord1d(GLdouble s) { GLAD_HOOK_BEGIN(142) call.args[0] = glad_arg_f(s); GLAD_HOOK_PRE ((PFNGLTEXCOORD1DPROC)glad_hook_real[142])(s); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord1dv(const GLdouble *v) { GLAD_HOOK_BEGIN(143) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD1DVPROC)glad_hook_real[143])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord1f(GLfloat s) { GLAD_HOOK_BEGIN(144) call.args[0] = glad_arg_f(s); GLAD_HOOK_PRE ((PFNGLTEXCOORD1FPROC)glad_hook_real[144])(s); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord1fv(const GLfloat *v) { GLAD_HOOK_BEGIN(145) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD1FVPROC)glad_hook_real[145])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord1i(GLint s) { GLAD_HOOK_BEGIN(146) call.args[0] = glad_arg_i(s); GLAD_HOOK_PRE ((PFNGLTEXCOORD1IPROC)glad_hook_real[146])(s); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord1iv(const GLint *v) { GLAD_HOOK_BEGIN(147) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD1IVPROC)glad_hook_real[147])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord1s(GLshort s) { GLAD_HOOK_BEGIN(148) call.args[0] = glad_arg_i(s); GLAD_HOOK_PRE ((PFNGLTEXCOORD1SPROC)glad_hook_real[148])(s); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord1sv(const GLshort *v) { GLAD_HOOK_BEGIN(149) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD1SVPROC)glad_hook_real[149])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord2d(GLdouble s, GLdouble t) { GLAD_HOOK_BEGIN(150) call.args[0] = glad_arg_f(s); call.args[1] = glad_arg_f(t); GLAD_HOOK_PRE ((PFNGLTEXCOORD2DPROC)glad_hook_real[150])(s, t); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord2dv(const GLdouble *v) { GLAD_HOOK_BEGIN(151) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD2DVPROC)glad_hook_real[151])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord2f(GLfloat s, GLfloat t) { GLAD_HOOK_BEGIN(152) call.args[0] = glad_arg_f(s); call.args[1] = glad_arg_f(t); GLAD_HOOK_PRE ((PFNGLTEXCOORD2FPROC)glad_hook_real[152])(s, t); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord2fv(const GLfloat *v) { GLAD_HOOK_BEGIN(153) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD2FVPROC)glad_hook_real[153])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord2i(GLint s, GLint t) { GLAD_HOOK_BEGIN(154) call.args[0] = glad_arg_i(s); call.args[1] = glad_arg_i(t); GLAD_HOOK_PRE ((PFNGLTEXCOORD2IPROC)glad_hook_real[154])(s, t); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord2iv(const GLint *v) { GLAD_HOOK_BEGIN(155) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD2IVPROC)glad_hook_real[155])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord2s(GLshort s, GLshort t) { GLAD_HOOK_BEGIN(156) call.args[0] = glad_arg_i(s); call.args[1] = glad_arg_i(t); GLAD_HOOK_PRE ((PFNGLTEXCOORD2SPROC)glad_hook_real[156])(s, t); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord2sv(const GLshort *v) { GLAD_HOOK_BEGIN(157) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD2SVPROC)glad_hook_real[157])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) { GLAD_HOOK_BEGIN(158) call.args[0] = glad_arg_f(s); call.args[1] = glad_arg_f(t); call.args[2] = glad_arg_f(r); GLAD_HOOK_PRE ((PFNGLTEXCOORD3DPROC)glad_hook_real[158])(s, t, r); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord3dv(const GLdouble *v) { GLAD_HOOK_BEGIN(159) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD3DVPROC)glad_hook_real[159])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) { GLAD_HOOK_BEGIN(160) call.args[0] = glad_arg_f(s); call.args[1] = glad_arg_f(t); call.args[2] = glad_arg_f(r); GLAD_HOOK_PRE ((PFNGLTEXCOORD3FPROC)glad_hook_real[160])(s, t, r); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord3fv(const GLfloat *v) { GLAD_HOOK_BEGIN(161) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD3FVPROC)glad_hook_real[161])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord3i(GLint s, GLint t, GLint r) { GLAD_HOOK_BEGIN(162) call.args[0] = glad_arg_i(s); call.args[1] = glad_arg_i(t); call.args[2] = glad_arg_i(r); GLAD_HOOK_PRE ((PFNGLTEXCOORD3IPROC)glad_hook_real[162])(s, t, r); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord3iv(const GLint *v) { GLAD_HOOK_BEGIN(163) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD3IVPROC)glad_hook_real[163])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord3s(GLshort s, GLshort t, GLshort r) { GLAD_HOOK_BEGIN(164) call.args[0] = glad_arg_i(s); call.args[1] = glad_arg_i(t); call.args[2] = glad_arg_i(r); GLAD_HOOK_PRE ((PFNGLTEXCOORD3SPROC)glad_hook_real[164])(s, t, r); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord3sv(const GLshort *v) { GLAD_HOOK_BEGIN(165) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD3SVPROC)glad_hook_real[165])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) { GLAD_HOOK_BEGIN(166) call.args[0] = glad_arg_f(s); call.args[1] = glad_arg_f(t); call.args[2] = glad_arg_f(r); call.args[3] = glad_arg_f(q); GLAD_HOOK_PRE ((PFNGLTEXCOORD4DPROC)glad_hook_real[166])(s, t, r, q); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord4dv(const GLdouble *v) { GLAD_HOOK_BEGIN(167) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD4DVPROC)glad_hook_real[167])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) { GLAD_HOOK_BEGIN(168) call.args[0] = glad_arg_f(s); call.args[1] = glad_arg_f(t); call.args[2] = glad_arg_f(r); call.args[3] = glad_arg_f(q); GLAD_HOOK_PRE ((PFNGLTEXCOORD4FPROC)glad_hook_real[168])(s, t, r, q); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord4fv(const GLfloat *v) { GLAD_HOOK_BEGIN(169) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD4FVPROC)glad_hook_real[169])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) { GLAD_HOOK_BEGIN(170) call.args[0] = glad_arg_i(s); call.args[1] = glad_arg_i(t); call.args[2] = glad_arg_i(r); call.args[3] = glad_arg_i(q); GLAD_HOOK_PRE ((PFNGLTEXCOORD4IPROC)glad_hook_real[170])(s, t, r, q); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord4iv(const GLint *v) { GLAD_HOOK_BEGIN(171) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD4IVPROC)glad_hook_real[171])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) { GLAD_HOOK_BEGIN(172) call.args[0] = glad_arg_i(s); call.args[1] = glad_arg_i(t); call.args[2] = glad_arg_i(r); call.args[3] = glad_arg_i(q); GLAD_HOOK_PRE ((PFNGLTEXCOORD4SPROC)glad_hook_real[172])(s, t, r, q); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoord4sv(const GLshort *v) { GLAD_HOOK_BEGIN(173) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLTEXCOORD4SVPROC)glad_hook_real[173])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex2d(GLdouble x, GLdouble y) { GLAD_HOOK_BEGIN(174) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); GLAD_HOOK_PRE ((PFNGLVERTEX2DPROC)glad_hook_real[174])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex2dv(const GLdouble *v) { GLAD_HOOK_BEGIN(175) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX2DVPROC)glad_hook_real[175])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex2f(GLfloat x, GLfloat y) { GLAD_HOOK_BEGIN(176) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); GLAD_HOOK_PRE ((PFNGLVERTEX2FPROC)glad_hook_real[176])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex2fv(const GLfloat *v) { GLAD_HOOK_BEGIN(177) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX2FVPROC)glad_hook_real[177])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex2i(GLint x, GLint y) { GLAD_HOOK_BEGIN(178) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); GLAD_HOOK_PRE ((PFNGLVERTEX2IPROC)glad_hook_real[178])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex2iv(const GLint *v) { GLAD_HOOK_BEGIN(179) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX2IVPROC)glad_hook_real[179])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex2s(GLshort x, GLshort y) { GLAD_HOOK_BEGIN(180) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); GLAD_HOOK_PRE ((PFNGLVERTEX2SPROC)glad_hook_real[180])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex2sv(const GLshort *v) { GLAD_HOOK_BEGIN(181) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX2SVPROC)glad_hook_real[181])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex3d(GLdouble x, GLdouble y, GLdouble z) { GLAD_HOOK_BEGIN(182) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLVERTEX3DPROC)glad_hook_real[182])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex3dv(const GLdouble *v) { GLAD_HOOK_BEGIN(183) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX3DVPROC)glad_hook_real[183])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex3f(GLfloat x, GLfloat y, GLfloat z) { GLAD_HOOK_BEGIN(184) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLVERTEX3FPROC)glad_hook_real[184])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex3fv(const GLfloat *v) { GLAD_HOOK_BEGIN(185) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX3FVPROC)glad_hook_real[185])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex3i(GLint x, GLint y, GLint z) { GLAD_HOOK_BEGIN(186) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(z); GLAD_HOOK_PRE ((PFNGLVERTEX3IPROC)glad_hook_real[186])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex3iv(const GLint *v) { GLAD_HOOK_BEGIN(187) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX3IVPROC)glad_hook_real[187])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex3s(GLshort x, GLshort y, GLshort z) { GLAD_HOOK_BEGIN(188) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(z); GLAD_HOOK_PRE ((PFNGLVERTEX3SPROC)glad_hook_real[188])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex3sv(const GLshort *v) { GLAD_HOOK_BEGIN(189) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX3SVPROC)glad_hook_real[189])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) { GLAD_HOOK_BEGIN(190) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); call.args[3] = glad_arg_f(w); GLAD_HOOK_PRE ((PFNGLVERTEX4DPROC)glad_hook_real[190])(x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex4dv(const GLdouble *v) { GLAD_HOOK_BEGIN(191) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX4DVPROC)glad_hook_real[191])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) { GLAD_HOOK_BEGIN(192) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); call.args[3] = glad_arg_f(w); GLAD_HOOK_PRE ((PFNGLVERTEX4FPROC)glad_hook_real[192])(x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex4fv(const GLfloat *v) { GLAD_HOOK_BEGIN(193) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX4FVPROC)glad_hook_real[193])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex4i(GLint x, GLint y, GLint z, GLint w) { GLAD_HOOK_BEGIN(194) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(z); call.args[3] = glad_arg_i(w); GLAD_HOOK_PRE ((PFNGLVERTEX4IPROC)glad_hook_real[194])(x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex4iv(const GLint *v) { GLAD_HOOK_BEGIN(195) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX4IVPROC)glad_hook_real[195])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) { GLAD_HOOK_BEGIN(196) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(z); call.args[3] = glad_arg_i(w); GLAD_HOOK_PRE ((PFNGLVERTEX4SPROC)glad_hook_real[196])(x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertex4sv(const GLshort *v) { GLAD_HOOK_BEGIN(197) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEX4SVPROC)glad_hook_real[197])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClipPlane(GLenum plane, const GLdouble *equation) { GLAD_HOOK_BEGIN(198) call.args[0] = glad_arg_u(plane); call.args[1] = glad_arg_p(equation); GLAD_HOOK_PRE ((PFNGLCLIPPLANEPROC)glad_hook_real[198])(plane, equation); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColorMaterial(GLenum face, GLenum mode) { GLAD_HOOK_BEGIN(199) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLCOLORMATERIALPROC)glad_hook_real[199])(face, mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFogf(GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(200) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLFOGFPROC)glad_hook_real[200])(pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFogfv(GLenum pname, const GLfloat *params) { GLAD_HOOK_BEGIN(201) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLFOGFVPROC)glad_hook_real[201])(pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFogi(GLenum pname, GLint param) { GLAD_HOOK_BEGIN(202) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLFOGIPROC)glad_hook_real[202])(pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFogiv(GLenum pname, const GLint *params) { GLAD_HOOK_BEGIN(203) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLFOGIVPROC)glad_hook_real[203])(pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLightf(GLenum light, GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(204) call.args[0] = glad_arg_u(light); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLLIGHTFPROC)glad_hook_real[204])(light, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLightfv(GLenum light, GLenum pname, const GLfloat *params) { GLAD_HOOK_BEGIN(205) call.args[0] = glad_arg_u(light); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLLIGHTFVPROC)glad_hook_real[205])(light, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLighti(GLenum light, GLenum pname, GLint param) { GLAD_HOOK_BEGIN(206) call.args[0] = glad_arg_u(light); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLLIGHTIPROC)glad_hook_real[206])(light, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLightiv(GLenum light, GLenum pname, const GLint *params) { GLAD_HOOK_BEGIN(207) call.args[0] = glad_arg_u(light); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLLIGHTIVPROC)glad_hook_real[207])(light, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLightModelf(GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(208) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLLIGHTMODELFPROC)glad_hook_real[208])(pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLightModelfv(GLenum pname, const GLfloat *params) { GLAD_HOOK_BEGIN(209) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLLIGHTMODELFVPROC)glad_hook_real[209])(pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLightModeli(GLenum pname, GLint param) { GLAD_HOOK_BEGIN(210) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLLIGHTMODELIPROC)glad_hook_real[210])(pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLightModeliv(GLenum pname, const GLint *params) { GLAD_HOOK_BEGIN(211) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLLIGHTMODELIVPROC)glad_hook_real[211])(pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLineStipple(GLint factor, GLushort pattern) { GLAD_HOOK_BEGIN(212) call.args[0] = glad_arg_i(factor); call.args[1] = glad_arg_u(pattern); GLAD_HOOK_PRE ((PFNGLLINESTIPPLEPROC)glad_hook_real[212])(factor, pattern); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMaterialf(GLenum face, GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(213) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLMATERIALFPROC)glad_hook_real[213])(face, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) { GLAD_HOOK_BEGIN(214) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLMATERIALFVPROC)glad_hook_real[214])(face, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMateriali(GLenum face, GLenum pname, GLint param) { GLAD_HOOK_BEGIN(215) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLMATERIALIPROC)glad_hook_real[215])(face, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMaterialiv(GLenum face, GLenum pname, const GLint *params) { GLAD_HOOK_BEGIN(216) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLMATERIALIVPROC)glad_hook_real[216])(face, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPolygonStipple(const GLubyte *mask) { GLAD_HOOK_BEGIN(217) call.args[0] = glad_arg_p(mask); GLAD_HOOK_PRE ((PFNGLPOLYGONSTIPPLEPROC)glad_hook_real[217])(mask); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glShadeModel(GLenum mode) { GLAD_HOOK_BEGIN(218) call.args[0] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLSHADEMODELPROC)glad_hook_real[218])(mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexEnvf(GLenum target, GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(219) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLTEXENVFPROC)glad_hook_real[219])(target, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) { GLAD_HOOK_BEGIN(220) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLTEXENVFVPROC)glad_hook_real[220])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexEnvi(GLenum target, GLenum pname, GLint param) { GLAD_HOOK_BEGIN(221) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLTEXENVIPROC)glad_hook_real[221])(target, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexEnviv(GLenum target, GLenum pname, const GLint *params) { GLAD_HOOK_BEGIN(222) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLTEXENVIVPROC)glad_hook_real[222])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexGend(GLenum coord, GLenum pname, GLdouble param) { GLAD_HOOK_BEGIN(223) call.args[0] = glad_arg_u(coord); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLTEXGENDPROC)glad_hook_real[223])(coord, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) { GLAD_HOOK_BEGIN(224) call.args[0] = glad_arg_u(coord); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLTEXGENDVPROC)glad_hook_real[224])(coord, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexGenf(GLenum coord, GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(225) call.args[0] = glad_arg_u(coord); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLTEXGENFPROC)glad_hook_real[225])(coord, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) { GLAD_HOOK_BEGIN(226) call.args[0] = glad_arg_u(coord); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLTEXGENFVPROC)glad_hook_real[226])(coord, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexGeni(GLenum coord, GLenum pname, GLint param) { GLAD_HOOK_BEGIN(227) call.args[0] = glad_arg_u(coord); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLTEXGENIPROC)glad_hook_real[227])(coord, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) { GLAD_HOOK_BEGIN(228) call.args[0] = glad_arg_u(coord); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLTEXGENIVPROC)glad_hook_real[228])(coord, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) { GLAD_HOOK_BEGIN(229) call.args[0] = glad_arg_i(size); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_p(buffer); GLAD_HOOK_PRE ((PFNGLFEEDBACKBUFFERPROC)glad_hook_real[229])(size, type, buffer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSelectBuffer(GLsizei size, GLuint *buffer) { GLAD_HOOK_BEGIN(230) call.args[0] = glad_arg_i(size); call.args[1] = glad_arg_p(buffer); GLAD_HOOK_PRE ((PFNGLSELECTBUFFERPROC)glad_hook_real[230])(size, buffer); GLAD_HOOK_POST }
+static GLint APIENTRY glad_hook_glRenderMode(GLenum mode) { GLint result; GLAD_HOOK_BEGIN(231) call.args[0] = glad_arg_u(mode); GLAD_HOOK_PRE result = ((PFNGLRENDERMODEPROC)glad_hook_real[231])(mode); call.result = glad_arg_i(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glInitNames(void) { GLAD_HOOK_BEGIN(232) GLAD_HOOK_PRE ((PFNGLINITNAMESPROC)glad_hook_real[232])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLoadName(GLuint name) { GLAD_HOOK_BEGIN(233) call.args[0] = glad_arg_u(name); GLAD_HOOK_PRE ((PFNGLLOADNAMEPROC)glad_hook_real[233])(name); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPassThrough(GLfloat token) { GLAD_HOOK_BEGIN(234) call.args[0] = glad_arg_f(token); GLAD_HOOK_PRE ((PFNGLPASSTHROUGHPROC)glad_hook_real[234])(token); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPopName(void) { GLAD_HOOK_BEGIN(235) GLAD_HOOK_PRE ((PFNGLPOPNAMEPROC)glad_hook_real[235])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPushName(GLuint name) { GLAD_HOOK_BEGIN(236) call.args[0] = glad_arg_u(name); GLAD_HOOK_PRE ((PFNGLPUSHNAMEPROC)glad_hook_real[236])(name); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { GLAD_HOOK_BEGIN(237) call.args[0] = glad_arg_f(red); call.args[1] = glad_arg_f(green); call.args[2] = glad_arg_f(blue); call.args[3] = glad_arg_f(alpha); GLAD_HOOK_PRE ((PFNGLCLEARACCUMPROC)glad_hook_real[237])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClearIndex(GLfloat c) { GLAD_HOOK_BEGIN(238) call.args[0] = glad_arg_f(c); GLAD_HOOK_PRE ((PFNGLCLEARINDEXPROC)glad_hook_real[238])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexMask(GLuint mask) { GLAD_HOOK_BEGIN(239) call.args[0] = glad_arg_u(mask); GLAD_HOOK_PRE ((PFNGLINDEXMASKPROC)glad_hook_real[239])(mask); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glAccum(GLenum op, GLfloat value) { GLAD_HOOK_BEGIN(240) call.args[0] = glad_arg_u(op); call.args[1] = glad_arg_f(value); GLAD_HOOK_PRE ((PFNGLACCUMPROC)glad_hook_real[240])(op, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPopAttrib(void) { GLAD_HOOK_BEGIN(241) GLAD_HOOK_PRE ((PFNGLPOPATTRIBPROC)glad_hook_real[241])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPushAttrib(GLbitfield mask) { GLAD_HOOK_BEGIN(242) call.args[0] = glad_arg_u(mask); GLAD_HOOK_PRE ((PFNGLPUSHATTRIBPROC)glad_hook_real[242])(mask); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) { GLAD_HOOK_BEGIN(243) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(u1); call.args[2] = glad_arg_f(u2); call.args[3] = glad_arg_i(stride); call.args[4] = glad_arg_i(order); call.args[5] = glad_arg_p(points); GLAD_HOOK_PRE ((PFNGLMAP1DPROC)glad_hook_real[243])(target, u1, u2, stride, order, points); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) { GLAD_HOOK_BEGIN(244) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(u1); call.args[2] = glad_arg_f(u2); call.args[3] = glad_arg_i(stride); call.args[4] = glad_arg_i(order); call.args[5] = glad_arg_p(points); GLAD_HOOK_PRE ((PFNGLMAP1FPROC)glad_hook_real[244])(target, u1, u2, stride, order, points); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) { GLAD_HOOK_BEGIN(245) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(u1); call.args[2] = glad_arg_f(u2); call.args[3] = glad_arg_i(ustride); call.args[4] = glad_arg_i(uorder); call.args[5] = glad_arg_f(v1); call.args[6] = glad_arg_f(v2); call.args[7] = glad_arg_i(vstride); call.args[8] = glad_arg_i(vorder); call.args[9] = glad_arg_p(points); GLAD_HOOK_PRE ((PFNGLMAP2DPROC)glad_hook_real[245])(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) { GLAD_HOOK_BEGIN(246) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(u1); call.args[2] = glad_arg_f(u2); call.args[3] = glad_arg_i(ustride); call.args[4] = glad_arg_i(uorder); call.args[5] = glad_arg_f(v1); call.args[6] = glad_arg_f(v2); call.args[7] = glad_arg_i(vstride); call.args[8] = glad_arg_i(vorder); call.args[9] = glad_arg_p(points); GLAD_HOOK_PRE ((PFNGLMAP2FPROC)glad_hook_real[246])(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) { GLAD_HOOK_BEGIN(247) call.args[0] = glad_arg_i(un); call.args[1] = glad_arg_f(u1); call.args[2] = glad_arg_f(u2); GLAD_HOOK_PRE ((PFNGLMAPGRID1DPROC)glad_hook_real[247])(un, u1, u2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) { GLAD_HOOK_BEGIN(248) call.args[0] = glad_arg_i(un); call.args[1] = glad_arg_f(u1); call.args[2] = glad_arg_f(u2); GLAD_HOOK_PRE ((PFNGLMAPGRID1FPROC)glad_hook_real[248])(un, u1, u2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) { GLAD_HOOK_BEGIN(249) call.args[0] = glad_arg_i(un); call.args[1] = glad_arg_f(u1); call.args[2] = glad_arg_f(u2); call.args[3] = glad_arg_i(vn); call.args[4] = glad_arg_f(v1); call.args[5] = glad_arg_f(v2); GLAD_HOOK_PRE ((PFNGLMAPGRID2DPROC)glad_hook_real[249])(un, u1, u2, vn, v1, v2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) { GLAD_HOOK_BEGIN(250) call.args[0] = glad_arg_i(un); call.args[1] = glad_arg_f(u1); call.args[2] = glad_arg_f(u2); call.args[3] = glad_arg_i(vn); call.args[4] = glad_arg_f(v1); call.args[5] = glad_arg_f(v2); GLAD_HOOK_PRE ((PFNGLMAPGRID2FPROC)glad_hook_real[250])(un, u1, u2, vn, v1, v2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalCoord1d(GLdouble u) { GLAD_HOOK_BEGIN(251) call.args[0] = glad_arg_f(u); GLAD_HOOK_PRE ((PFNGLEVALCOORD1DPROC)glad_hook_real[251])(u); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalCoord1dv(const GLdouble *u) { GLAD_HOOK_BEGIN(252) call.args[0] = glad_arg_p(u); GLAD_HOOK_PRE ((PFNGLEVALCOORD1DVPROC)glad_hook_real[252])(u); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalCoord1f(GLfloat u) { GLAD_HOOK_BEGIN(253) call.args[0] = glad_arg_f(u); GLAD_HOOK_PRE ((PFNGLEVALCOORD1FPROC)glad_hook_real[253])(u); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalCoord1fv(const GLfloat *u) { GLAD_HOOK_BEGIN(254) call.args[0] = glad_arg_p(u); GLAD_HOOK_PRE ((PFNGLEVALCOORD1FVPROC)glad_hook_real[254])(u); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalCoord2d(GLdouble u, GLdouble v) { GLAD_HOOK_BEGIN(255) call.args[0] = glad_arg_f(u); call.args[1] = glad_arg_f(v); GLAD_HOOK_PRE ((PFNGLEVALCOORD2DPROC)glad_hook_real[255])(u, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalCoord2dv(const GLdouble *u) { GLAD_HOOK_BEGIN(256) call.args[0] = glad_arg_p(u); GLAD_HOOK_PRE ((PFNGLEVALCOORD2DVPROC)glad_hook_real[256])(u); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalCoord2f(GLfloat u, GLfloat v) { GLAD_HOOK_BEGIN(257) call.args[0] = glad_arg_f(u); call.args[1] = glad_arg_f(v); GLAD_HOOK_PRE ((PFNGLEVALCOORD2FPROC)glad_hook_real[257])(u, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalCoord2fv(const GLfloat *u) { GLAD_HOOK_BEGIN(258) call.args[0] = glad_arg_p(u); GLAD_HOOK_PRE ((PFNGLEVALCOORD2FVPROC)glad_hook_real[258])(u); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalMesh1(GLenum mode, GLint i1, GLint i2) { GLAD_HOOK_BEGIN(259) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_i(i1); call.args[2] = glad_arg_i(i2); GLAD_HOOK_PRE ((PFNGLEVALMESH1PROC)glad_hook_real[259])(mode, i1, i2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalPoint1(GLint i) { GLAD_HOOK_BEGIN(260) call.args[0] = glad_arg_i(i); GLAD_HOOK_PRE ((PFNGLEVALPOINT1PROC)glad_hook_real[260])(i); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) { GLAD_HOOK_BEGIN(261) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_i(i1); call.args[2] = glad_arg_i(i2); call.args[3] = glad_arg_i(j1); call.args[4] = glad_arg_i(j2); GLAD_HOOK_PRE ((PFNGLEVALMESH2PROC)glad_hook_real[261])(mode, i1, i2, j1, j2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEvalPoint2(GLint i, GLint j) { GLAD_HOOK_BEGIN(262) call.args[0] = glad_arg_i(i); call.args[1] = glad_arg_i(j); GLAD_HOOK_PRE ((PFNGLEVALPOINT2PROC)glad_hook_real[262])(i, j); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glAlphaFunc(GLenum func, GLfloat ref) { GLAD_HOOK_BEGIN(263) call.args[0] = glad_arg_u(func); call.args[1] = glad_arg_f(ref); GLAD_HOOK_PRE ((PFNGLALPHAFUNCPROC)glad_hook_real[263])(func, ref); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPixelZoom(GLfloat xfactor, GLfloat yfactor) { GLAD_HOOK_BEGIN(264) call.args[0] = glad_arg_f(xfactor); call.args[1] = glad_arg_f(yfactor); GLAD_HOOK_PRE ((PFNGLPIXELZOOMPROC)glad_hook_real[264])(xfactor, yfactor); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPixelTransferf(GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(265) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLPIXELTRANSFERFPROC)glad_hook_real[265])(pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPixelTransferi(GLenum pname, GLint param) { GLAD_HOOK_BEGIN(266) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLPIXELTRANSFERIPROC)glad_hook_real[266])(pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) { GLAD_HOOK_BEGIN(267) call.args[0] = glad_arg_u(map); call.args[1] = glad_arg_i(mapsize); call.args[2] = glad_arg_p(values); GLAD_HOOK_PRE ((PFNGLPIXELMAPFVPROC)glad_hook_real[267])(map, mapsize, values); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) { GLAD_HOOK_BEGIN(268) call.args[0] = glad_arg_u(map); call.args[1] = glad_arg_i(mapsize); call.args[2] = glad_arg_p(values); GLAD_HOOK_PRE ((PFNGLPIXELMAPUIVPROC)glad_hook_real[268])(map, mapsize, values); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) { GLAD_HOOK_BEGIN(269) call.args[0] = glad_arg_u(map); call.args[1] = glad_arg_i(mapsize); call.args[2] = glad_arg_p(values); GLAD_HOOK_PRE ((PFNGLPIXELMAPUSVPROC)glad_hook_real[269])(map, mapsize, values); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) { GLAD_HOOK_BEGIN(270) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(width); call.args[3] = glad_arg_i(height); call.args[4] = glad_arg_u(type); GLAD_HOOK_PRE ((PFNGLCOPYPIXELSPROC)glad_hook_real[270])(x, y, width, height, type); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { GLAD_HOOK_BEGIN(271) call.args[0] = glad_arg_i(width); call.args[1] = glad_arg_i(height); call.args[2] = glad_arg_u(format); call.args[3] = glad_arg_u(type); call.args[4] = glad_arg_p(pixels); GLAD_HOOK_PRE ((PFNGLDRAWPIXELSPROC)glad_hook_real[271])(width, height, format, type, pixels); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetClipPlane(GLenum plane, GLdouble *equation) { GLAD_HOOK_BEGIN(272) call.args[0] = glad_arg_u(plane); call.args[1] = glad_arg_p(equation); GLAD_HOOK_PRE ((PFNGLGETCLIPPLANEPROC)glad_hook_real[272])(plane, equation); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) { GLAD_HOOK_BEGIN(273) call.args[0] = glad_arg_u(light); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETLIGHTFVPROC)glad_hook_real[273])(light, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetLightiv(GLenum light, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(274) call.args[0] = glad_arg_u(light); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETLIGHTIVPROC)glad_hook_real[274])(light, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetMapdv(GLenum target, GLenum query, GLdouble *v) { GLAD_HOOK_BEGIN(275) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(query); call.args[2] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLGETMAPDVPROC)glad_hook_real[275])(target, query, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetMapfv(GLenum target, GLenum query, GLfloat *v) { GLAD_HOOK_BEGIN(276) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(query); call.args[2] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLGETMAPFVPROC)glad_hook_real[276])(target, query, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetMapiv(GLenum target, GLenum query, GLint *v) { GLAD_HOOK_BEGIN(277) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(query); call.args[2] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLGETMAPIVPROC)glad_hook_real[277])(target, query, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) { GLAD_HOOK_BEGIN(278) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETMATERIALFVPROC)glad_hook_real[278])(face, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(279) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETMATERIALIVPROC)glad_hook_real[279])(face, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetPixelMapfv(GLenum map, GLfloat *values) { GLAD_HOOK_BEGIN(280) call.args[0] = glad_arg_u(map); call.args[1] = glad_arg_p(values); GLAD_HOOK_PRE ((PFNGLGETPIXELMAPFVPROC)glad_hook_real[280])(map, values); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetPixelMapuiv(GLenum map, GLuint *values) { GLAD_HOOK_BEGIN(281) call.args[0] = glad_arg_u(map); call.args[1] = glad_arg_p(values); GLAD_HOOK_PRE ((PFNGLGETPIXELMAPUIVPROC)glad_hook_real[281])(map, values); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetPixelMapusv(GLenum map, GLushort *values) { GLAD_HOOK_BEGIN(282) call.args[0] = glad_arg_u(map); call.args[1] = glad_arg_p(values); GLAD_HOOK_PRE ((PFNGLGETPIXELMAPUSVPROC)glad_hook_real[282])(map, values); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetPolygonStipple(GLubyte *mask) { GLAD_HOOK_BEGIN(283) call.args[0] = glad_arg_p(mask); GLAD_HOOK_PRE ((PFNGLGETPOLYGONSTIPPLEPROC)glad_hook_real[283])(mask); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) { GLAD_HOOK_BEGIN(284) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXENVFVPROC)glad_hook_real[284])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(285) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXENVIVPROC)glad_hook_real[285])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) { GLAD_HOOK_BEGIN(286) call.args[0] = glad_arg_u(coord); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXGENDVPROC)glad_hook_real[286])(coord, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) { GLAD_HOOK_BEGIN(287) call.args[0] = glad_arg_u(coord); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXGENFVPROC)glad_hook_real[287])(coord, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(288) call.args[0] = glad_arg_u(coord); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXGENIVPROC)glad_hook_real[288])(coord, pname, params); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glIsList(GLuint list) { GLboolean result; GLAD_HOOK_BEGIN(289) call.args[0] = glad_arg_u(list); GLAD_HOOK_PRE result = ((PFNGLISLISTPROC)glad_hook_real[289])(list); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) { GLAD_HOOK_BEGIN(290) call.args[0] = glad_arg_f(left); call.args[1] = glad_arg_f(right); call.args[2] = glad_arg_f(bottom); call.args[3] = glad_arg_f(top); call.args[4] = glad_arg_f(zNear); call.args[5] = glad_arg_f(zFar); GLAD_HOOK_PRE ((PFNGLFRUSTUMPROC)glad_hook_real[290])(left, right, bottom, top, zNear, zFar); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLoadIdentity(void) { GLAD_HOOK_BEGIN(291) GLAD_HOOK_PRE ((PFNGLLOADIDENTITYPROC)glad_hook_real[291])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLoadMatrixf(const GLfloat *m) { GLAD_HOOK_BEGIN(292) call.args[0] = glad_arg_p(m); GLAD_HOOK_PRE ((PFNGLLOADMATRIXFPROC)glad_hook_real[292])(m); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLoadMatrixd(const GLdouble *m) { GLAD_HOOK_BEGIN(293) call.args[0] = glad_arg_p(m); GLAD_HOOK_PRE ((PFNGLLOADMATRIXDPROC)glad_hook_real[293])(m); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMatrixMode(GLenum mode) { GLAD_HOOK_BEGIN(294) call.args[0] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLMATRIXMODEPROC)glad_hook_real[294])(mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultMatrixf(const GLfloat *m) { GLAD_HOOK_BEGIN(295) call.args[0] = glad_arg_p(m); GLAD_HOOK_PRE ((PFNGLMULTMATRIXFPROC)glad_hook_real[295])(m); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultMatrixd(const GLdouble *m) { GLAD_HOOK_BEGIN(296) call.args[0] = glad_arg_p(m); GLAD_HOOK_PRE ((PFNGLMULTMATRIXDPROC)glad_hook_real[296])(m); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) { GLAD_HOOK_BEGIN(297) call.args[0] = glad_arg_f(left); call.args[1] = glad_arg_f(right); call.args[2] = glad_arg_f(bottom); call.args[3] = glad_arg_f(top); call.args[4] = glad_arg_f(zNear); call.args[5] = glad_arg_f(zFar); GLAD_HOOK_PRE ((PFNGLORTHOPROC)glad_hook_real[297])(left, right, bottom, top, zNear, zFar); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPopMatrix(void) { GLAD_HOOK_BEGIN(298) GLAD_HOOK_PRE ((PFNGLPOPMATRIXPROC)glad_hook_real[298])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPushMatrix(void) { GLAD_HOOK_BEGIN(299) GLAD_HOOK_PRE ((PFNGLPUSHMATRIXPROC)glad_hook_real[299])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) { GLAD_HOOK_BEGIN(300) call.args[0] = glad_arg_f(angle); call.args[1] = glad_arg_f(x); call.args[2] = glad_arg_f(y); call.args[3] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLROTATEDPROC)glad_hook_real[300])(angle, x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) { GLAD_HOOK_BEGIN(301) call.args[0] = glad_arg_f(angle); call.args[1] = glad_arg_f(x); call.args[2] = glad_arg_f(y); call.args[3] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLROTATEFPROC)glad_hook_real[301])(angle, x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glScaled(GLdouble x, GLdouble y, GLdouble z) { GLAD_HOOK_BEGIN(302) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLSCALEDPROC)glad_hook_real[302])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glScalef(GLfloat x, GLfloat y, GLfloat z) { GLAD_HOOK_BEGIN(303) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLSCALEFPROC)glad_hook_real[303])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTranslated(GLdouble x, GLdouble y, GLdouble z) { GLAD_HOOK_BEGIN(304) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLTRANSLATEDPROC)glad_hook_real[304])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTranslatef(GLfloat x, GLfloat y, GLfloat z) { GLAD_HOOK_BEGIN(305) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLTRANSLATEFPROC)glad_hook_real[305])(x, y, z); GLAD_HOOK_POST }
+#endif
+static void APIENTRY glad_hook_glDrawArrays(GLenum mode, GLint first, GLsizei count) { GLAD_HOOK_BEGIN(306) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_i(first); call.args[2] = glad_arg_i(count); GLAD_HOOK_PRE ((PFNGLDRAWARRAYSPROC)glad_hook_real[306])(mode, first, count); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { GLAD_HOOK_BEGIN(307) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(type); call.args[3] = glad_arg_p(indices); GLAD_HOOK_PRE ((PFNGLDRAWELEMENTSPROC)glad_hook_real[307])(mode, count, type, indices); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetPointerv(GLenum pname, void **params) { GLAD_HOOK_BEGIN(308) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETPOINTERVPROC)glad_hook_real[308])(pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPolygonOffset(GLfloat factor, GLfloat units) { GLAD_HOOK_BEGIN(309) call.args[0] = glad_arg_f(factor); call.args[1] = glad_arg_f(units); GLAD_HOOK_PRE ((PFNGLPOLYGONOFFSETPROC)glad_hook_real[309])(factor, units); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { GLAD_HOOK_BEGIN(310) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_u(internalformat); call.args[3] = glad_arg_i(x); call.args[4] = glad_arg_i(y); call.args[5] = glad_arg_i(width); call.args[6] = glad_arg_i(border); GLAD_HOOK_PRE ((PFNGLCOPYTEXIMAGE1DPROC)glad_hook_real[310])(target, level, internalformat, x, y, width, border); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { GLAD_HOOK_BEGIN(311) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_u(internalformat); call.args[3] = glad_arg_i(x); call.args[4] = glad_arg_i(y); call.args[5] = glad_arg_i(width); call.args[6] = glad_arg_i(height); call.args[7] = glad_arg_i(border); GLAD_HOOK_PRE ((PFNGLCOPYTEXIMAGE2DPROC)glad_hook_real[311])(target, level, internalformat, x, y, width, height, border); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { GLAD_HOOK_BEGIN(312) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(xoffset); call.args[3] = glad_arg_i(x); call.args[4] = glad_arg_i(y); call.args[5] = glad_arg_i(width); GLAD_HOOK_PRE ((PFNGLCOPYTEXSUBIMAGE1DPROC)glad_hook_real[312])(target, level, xoffset, x, y, width); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { GLAD_HOOK_BEGIN(313) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(xoffset); call.args[3] = glad_arg_i(yoffset); call.args[4] = glad_arg_i(x); call.args[5] = glad_arg_i(y); call.args[6] = glad_arg_i(width); call.args[7] = glad_arg_i(height); GLAD_HOOK_PRE ((PFNGLCOPYTEXSUBIMAGE2DPROC)glad_hook_real[313])(target, level, xoffset, yoffset, x, y, width, height); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { GLAD_HOOK_BEGIN(314) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(xoffset); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_u(format); call.args[5] = glad_arg_u(type); call.args[6] = glad_arg_p(pixels); GLAD_HOOK_PRE ((PFNGLTEXSUBIMAGE1DPROC)glad_hook_real[314])(target, level, xoffset, width, format, type, pixels); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { GLAD_HOOK_BEGIN(315) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(xoffset); call.args[3] = glad_arg_i(yoffset); call.args[4] = glad_arg_i(width); call.args[5] = glad_arg_i(height); call.args[6] = glad_arg_u(format); call.args[7] = glad_arg_u(type); call.args[8] = glad_arg_p(pixels); GLAD_HOOK_PRE ((PFNGLTEXSUBIMAGE2DPROC)glad_hook_real[315])(target, level, xoffset, yoffset, width, height, format, type, pixels); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBindTexture(GLenum target, GLuint texture) { GLAD_HOOK_BEGIN(316) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(texture); GLAD_HOOK_PRE ((PFNGLBINDTEXTUREPROC)glad_hook_real[316])(target, texture); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDeleteTextures(GLsizei n, const GLuint *textures) { GLAD_HOOK_BEGIN(317) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(textures); GLAD_HOOK_PRE ((PFNGLDELETETEXTURESPROC)glad_hook_real[317])(n, textures); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGenTextures(GLsizei n, GLuint *textures) { GLAD_HOOK_BEGIN(318) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(textures); GLAD_HOOK_PRE ((PFNGLGENTEXTURESPROC)glad_hook_real[318])(n, textures); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glIsTexture(GLuint texture) { GLboolean result; GLAD_HOOK_BEGIN(319) call.args[0] = glad_arg_u(texture); GLAD_HOOK_PRE result = ((PFNGLISTEXTUREPROC)glad_hook_real[319])(texture); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+#ifndef GLAD_CORE_ONLY
+static void APIENTRY glad_hook_glArrayElement(GLint i) { GLAD_HOOK_BEGIN(320) call.args[0] = glad_arg_i(i); GLAD_HOOK_PRE ((PFNGLARRAYELEMENTPROC)glad_hook_real[320])(i); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(321) call.args[0] = glad_arg_i(size); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_i(stride); call.args[3] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLCOLORPOINTERPROC)glad_hook_real[321])(size, type, stride, pointer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDisableClientState(GLenum array) { GLAD_HOOK_BEGIN(322) call.args[0] = glad_arg_u(array); GLAD_HOOK_PRE ((PFNGLDISABLECLIENTSTATEPROC)glad_hook_real[322])(array); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEdgeFlagPointer(GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(323) call.args[0] = glad_arg_i(stride); call.args[1] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLEDGEFLAGPOINTERPROC)glad_hook_real[323])(stride, pointer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEnableClientState(GLenum array) { GLAD_HOOK_BEGIN(324) call.args[0] = glad_arg_u(array); GLAD_HOOK_PRE ((PFNGLENABLECLIENTSTATEPROC)glad_hook_real[324])(array); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(325) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_i(stride); call.args[2] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLINDEXPOINTERPROC)glad_hook_real[325])(type, stride, pointer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(326) call.args[0] = glad_arg_u(format); call.args[1] = glad_arg_i(stride); call.args[2] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLINTERLEAVEDARRAYSPROC)glad_hook_real[326])(format, stride, pointer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(327) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_i(stride); call.args[2] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLNORMALPOINTERPROC)glad_hook_real[327])(type, stride, pointer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(328) call.args[0] = glad_arg_i(size); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_i(stride); call.args[3] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLTEXCOORDPOINTERPROC)glad_hook_real[328])(size, type, stride, pointer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(329) call.args[0] = glad_arg_i(size); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_i(stride); call.args[3] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLVERTEXPOINTERPROC)glad_hook_real[329])(size, type, stride, pointer); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) { GLboolean result; GLAD_HOOK_BEGIN(330) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(textures); call.args[2] = glad_arg_p(residences); GLAD_HOOK_PRE result = ((PFNGLARETEXTURESRESIDENTPROC)glad_hook_real[330])(n, textures, residences); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) { GLAD_HOOK_BEGIN(331) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(textures); call.args[2] = glad_arg_p(priorities); GLAD_HOOK_PRE ((PFNGLPRIORITIZETEXTURESPROC)glad_hook_real[331])(n, textures, priorities); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexub(GLubyte c) { GLAD_HOOK_BEGIN(332) call.args[0] = glad_arg_u(c); GLAD_HOOK_PRE ((PFNGLINDEXUBPROC)glad_hook_real[332])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glIndexubv(const GLubyte *c) { GLAD_HOOK_BEGIN(333) call.args[0] = glad_arg_p(c); GLAD_HOOK_PRE ((PFNGLINDEXUBVPROC)glad_hook_real[333])(c); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPopClientAttrib(void) { GLAD_HOOK_BEGIN(334) GLAD_HOOK_PRE ((PFNGLPOPCLIENTATTRIBPROC)glad_hook_real[334])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPushClientAttrib(GLbitfield mask) { GLAD_HOOK_BEGIN(335) call.args[0] = glad_arg_u(mask); GLAD_HOOK_PRE ((PFNGLPUSHCLIENTATTRIBPROC)glad_hook_real[335])(mask); GLAD_HOOK_POST }
+#endif
+static void APIENTRY glad_hook_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) { GLAD_HOOK_BEGIN(336) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_u(start); call.args[2] = glad_arg_u(end); call.args[3] = glad_arg_i(count); call.args[4] = glad_arg_u(type); call.args[5] = glad_arg_p(indices); GLAD_HOOK_PRE ((PFNGLDRAWRANGEELEMENTSPROC)glad_hook_real[336])(mode, start, end, count, type, indices); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { GLAD_HOOK_BEGIN(337) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(internalformat); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_i(height); call.args[5] = glad_arg_i(depth); call.args[6] = glad_arg_i(border); call.args[7] = glad_arg_u(format); call.args[8] = glad_arg_u(type); call.args[9] = glad_arg_p(pixels); GLAD_HOOK_PRE ((PFNGLTEXIMAGE3DPROC)glad_hook_real[337])(target, level, internalformat, width, height, depth, border, format, type, pixels); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { GLAD_HOOK_BEGIN(338) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(xoffset); call.args[3] = glad_arg_i(yoffset); call.args[4] = glad_arg_i(zoffset); call.args[5] = glad_arg_i(width); call.args[6] = glad_arg_i(height); call.args[7] = glad_arg_i(depth); call.args[8] = glad_arg_u(format); call.args[9] = glad_arg_u(type); call.args[10] = glad_arg_p(pixels); GLAD_HOOK_PRE ((PFNGLTEXSUBIMAGE3DPROC)glad_hook_real[338])(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { GLAD_HOOK_BEGIN(339) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(xoffset); call.args[3] = glad_arg_i(yoffset); call.args[4] = glad_arg_i(zoffset); call.args[5] = glad_arg_i(x); call.args[6] = glad_arg_i(y); call.args[7] = glad_arg_i(width); call.args[8] = glad_arg_i(height); GLAD_HOOK_PRE ((PFNGLCOPYTEXSUBIMAGE3DPROC)glad_hook_real[339])(target, level, xoffset, yoffset, zoffset, x, y, width, height); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glActiveTexture(GLenum texture) { GLAD_HOOK_BEGIN(340) call.args[0] = glad_arg_u(texture); GLAD_HOOK_PRE ((PFNGLACTIVETEXTUREPROC)glad_hook_real[340])(texture); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSampleCoverage(GLfloat value, GLboolean invert) { GLAD_HOOK_BEGIN(341) call.args[0] = glad_arg_f(value); call.args[1] = glad_arg_u(invert); GLAD_HOOK_PRE ((PFNGLSAMPLECOVERAGEPROC)glad_hook_real[341])(value, invert); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) { GLAD_HOOK_BEGIN(342) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_u(internalformat); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_i(height); call.args[5] = glad_arg_i(depth); call.args[6] = glad_arg_i(border); call.args[7] = glad_arg_i(imageSize); call.args[8] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_hook_real[342])(target, level, internalformat, width, height, depth, border, imageSize, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { GLAD_HOOK_BEGIN(343) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_u(internalformat); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_i(height); call.args[5] = glad_arg_i(border); call.args[6] = glad_arg_i(imageSize); call.args[7] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_hook_real[343])(target, level, internalformat, width, height, border, imageSize, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) { GLAD_HOOK_BEGIN(344) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_u(internalformat); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_i(border); call.args[5] = glad_arg_i(imageSize); call.args[6] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_hook_real[344])(target, level, internalformat, width, border, imageSize, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { GLAD_HOOK_BEGIN(345) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(xoffset); call.args[3] = glad_arg_i(yoffset); call.args[4] = glad_arg_i(zoffset); call.args[5] = glad_arg_i(width); call.args[6] = glad_arg_i(height); call.args[7] = glad_arg_i(depth); call.args[8] = glad_arg_u(format); call.args[9] = glad_arg_i(imageSize); call.args[10] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_hook_real[345])(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { GLAD_HOOK_BEGIN(346) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(xoffset); call.args[3] = glad_arg_i(yoffset); call.args[4] = glad_arg_i(width); call.args[5] = glad_arg_i(height); call.args[6] = glad_arg_u(format); call.args[7] = glad_arg_i(imageSize); call.args[8] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_hook_real[346])(target, level, xoffset, yoffset, width, height, format, imageSize, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { GLAD_HOOK_BEGIN(347) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_i(xoffset); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_u(format); call.args[5] = glad_arg_i(imageSize); call.args[6] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_hook_real[347])(target, level, xoffset, width, format, imageSize, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetCompressedTexImage(GLenum target, GLint level, void *img) { GLAD_HOOK_BEGIN(348) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(level); call.args[2] = glad_arg_p(img); GLAD_HOOK_PRE ((PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_hook_real[348])(target, level, img); GLAD_HOOK_POST }
+#ifndef GLAD_CORE_ONLY
+static void APIENTRY glad_hook_glClientActiveTexture(GLenum texture) { GLAD_HOOK_BEGIN(349) call.args[0] = glad_arg_u(texture); GLAD_HOOK_PRE ((PFNGLCLIENTACTIVETEXTUREPROC)glad_hook_real[349])(texture); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord1d(GLenum target, GLdouble s) { GLAD_HOOK_BEGIN(350) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(s); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD1DPROC)glad_hook_real[350])(target, s); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord1dv(GLenum target, const GLdouble *v) { GLAD_HOOK_BEGIN(351) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD1DVPROC)glad_hook_real[351])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord1f(GLenum target, GLfloat s) { GLAD_HOOK_BEGIN(352) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(s); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD1FPROC)glad_hook_real[352])(target, s); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord1fv(GLenum target, const GLfloat *v) { GLAD_HOOK_BEGIN(353) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD1FVPROC)glad_hook_real[353])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord1i(GLenum target, GLint s) { GLAD_HOOK_BEGIN(354) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(s); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD1IPROC)glad_hook_real[354])(target, s); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord1iv(GLenum target, const GLint *v) { GLAD_HOOK_BEGIN(355) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD1IVPROC)glad_hook_real[355])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord1s(GLenum target, GLshort s) { GLAD_HOOK_BEGIN(356) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(s); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD1SPROC)glad_hook_real[356])(target, s); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord1sv(GLenum target, const GLshort *v) { GLAD_HOOK_BEGIN(357) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD1SVPROC)glad_hook_real[357])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) { GLAD_HOOK_BEGIN(358) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(s); call.args[2] = glad_arg_f(t); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD2DPROC)glad_hook_real[358])(target, s, t); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord2dv(GLenum target, const GLdouble *v) { GLAD_HOOK_BEGIN(359) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD2DVPROC)glad_hook_real[359])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) { GLAD_HOOK_BEGIN(360) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(s); call.args[2] = glad_arg_f(t); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD2FPROC)glad_hook_real[360])(target, s, t); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord2fv(GLenum target, const GLfloat *v) { GLAD_HOOK_BEGIN(361) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD2FVPROC)glad_hook_real[361])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord2i(GLenum target, GLint s, GLint t) { GLAD_HOOK_BEGIN(362) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(s); call.args[2] = glad_arg_i(t); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD2IPROC)glad_hook_real[362])(target, s, t); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord2iv(GLenum target, const GLint *v) { GLAD_HOOK_BEGIN(363) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD2IVPROC)glad_hook_real[363])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) { GLAD_HOOK_BEGIN(364) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(s); call.args[2] = glad_arg_i(t); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD2SPROC)glad_hook_real[364])(target, s, t); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord2sv(GLenum target, const GLshort *v) { GLAD_HOOK_BEGIN(365) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD2SVPROC)glad_hook_real[365])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) { GLAD_HOOK_BEGIN(366) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(s); call.args[2] = glad_arg_f(t); call.args[3] = glad_arg_f(r); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD3DPROC)glad_hook_real[366])(target, s, t, r); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord3dv(GLenum target, const GLdouble *v) { GLAD_HOOK_BEGIN(367) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD3DVPROC)glad_hook_real[367])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) { GLAD_HOOK_BEGIN(368) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(s); call.args[2] = glad_arg_f(t); call.args[3] = glad_arg_f(r); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD3FPROC)glad_hook_real[368])(target, s, t, r); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord3fv(GLenum target, const GLfloat *v) { GLAD_HOOK_BEGIN(369) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD3FVPROC)glad_hook_real[369])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) { GLAD_HOOK_BEGIN(370) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(s); call.args[2] = glad_arg_i(t); call.args[3] = glad_arg_i(r); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD3IPROC)glad_hook_real[370])(target, s, t, r); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord3iv(GLenum target, const GLint *v) { GLAD_HOOK_BEGIN(371) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD3IVPROC)glad_hook_real[371])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) { GLAD_HOOK_BEGIN(372) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(s); call.args[2] = glad_arg_i(t); call.args[3] = glad_arg_i(r); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD3SPROC)glad_hook_real[372])(target, s, t, r); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord3sv(GLenum target, const GLshort *v) { GLAD_HOOK_BEGIN(373) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD3SVPROC)glad_hook_real[373])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) { GLAD_HOOK_BEGIN(374) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(s); call.args[2] = glad_arg_f(t); call.args[3] = glad_arg_f(r); call.args[4] = glad_arg_f(q); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD4DPROC)glad_hook_real[374])(target, s, t, r, q); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord4dv(GLenum target, const GLdouble *v) { GLAD_HOOK_BEGIN(375) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD4DVPROC)glad_hook_real[375])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) { GLAD_HOOK_BEGIN(376) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_f(s); call.args[2] = glad_arg_f(t); call.args[3] = glad_arg_f(r); call.args[4] = glad_arg_f(q); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD4FPROC)glad_hook_real[376])(target, s, t, r, q); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord4fv(GLenum target, const GLfloat *v) { GLAD_HOOK_BEGIN(377) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD4FVPROC)glad_hook_real[377])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) { GLAD_HOOK_BEGIN(378) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(s); call.args[2] = glad_arg_i(t); call.args[3] = glad_arg_i(r); call.args[4] = glad_arg_i(q); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD4IPROC)glad_hook_real[378])(target, s, t, r, q); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord4iv(GLenum target, const GLint *v) { GLAD_HOOK_BEGIN(379) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD4IVPROC)glad_hook_real[379])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) { GLAD_HOOK_BEGIN(380) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(s); call.args[2] = glad_arg_i(t); call.args[3] = glad_arg_i(r); call.args[4] = glad_arg_i(q); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD4SPROC)glad_hook_real[380])(target, s, t, r, q); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoord4sv(GLenum target, const GLshort *v) { GLAD_HOOK_BEGIN(381) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORD4SVPROC)glad_hook_real[381])(target, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLoadTransposeMatrixf(const GLfloat *m) { GLAD_HOOK_BEGIN(382) call.args[0] = glad_arg_p(m); GLAD_HOOK_PRE ((PFNGLLOADTRANSPOSEMATRIXFPROC)glad_hook_real[382])(m); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glLoadTransposeMatrixd(const GLdouble *m) { GLAD_HOOK_BEGIN(383) call.args[0] = glad_arg_p(m); GLAD_HOOK_PRE ((PFNGLLOADTRANSPOSEMATRIXDPROC)glad_hook_real[383])(m); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultTransposeMatrixf(const GLfloat *m) { GLAD_HOOK_BEGIN(384) call.args[0] = glad_arg_p(m); GLAD_HOOK_PRE ((PFNGLMULTTRANSPOSEMATRIXFPROC)glad_hook_real[384])(m); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultTransposeMatrixd(const GLdouble *m) { GLAD_HOOK_BEGIN(385) call.args[0] = glad_arg_p(m); GLAD_HOOK_PRE ((PFNGLMULTTRANSPOSEMATRIXDPROC)glad_hook_real[385])(m); GLAD_HOOK_POST }
+#endif
+static void APIENTRY glad_hook_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { GLAD_HOOK_BEGIN(386) call.args[0] = glad_arg_u(sfactorRGB); call.args[1] = glad_arg_u(dfactorRGB); call.args[2] = glad_arg_u(sfactorAlpha); call.args[3] = glad_arg_u(dfactorAlpha); GLAD_HOOK_PRE ((PFNGLBLENDFUNCSEPARATEPROC)glad_hook_real[386])(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) { GLAD_HOOK_BEGIN(387) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_p(first); call.args[2] = glad_arg_p(count); call.args[3] = glad_arg_i(drawcount); GLAD_HOOK_PRE ((PFNGLMULTIDRAWARRAYSPROC)glad_hook_real[387])(mode, first, count, drawcount); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) { GLAD_HOOK_BEGIN(388) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_p(count); call.args[2] = glad_arg_u(type); call.args[3] = glad_arg_p(indices); call.args[4] = glad_arg_i(drawcount); GLAD_HOOK_PRE ((PFNGLMULTIDRAWELEMENTSPROC)glad_hook_real[388])(mode, count, type, indices, drawcount); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPointParameterf(GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(389) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLPOINTPARAMETERFPROC)glad_hook_real[389])(pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPointParameterfv(GLenum pname, const GLfloat *params) { GLAD_HOOK_BEGIN(390) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLPOINTPARAMETERFVPROC)glad_hook_real[390])(pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPointParameteri(GLenum pname, GLint param) { GLAD_HOOK_BEGIN(391) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLPOINTPARAMETERIPROC)glad_hook_real[391])(pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPointParameteriv(GLenum pname, const GLint *params) { GLAD_HOOK_BEGIN(392) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLPOINTPARAMETERIVPROC)glad_hook_real[392])(pname, params); GLAD_HOOK_POST }
+#ifndef GLAD_CORE_ONLY
+static void APIENTRY glad_hook_glFogCoordf(GLfloat coord) { GLAD_HOOK_BEGIN(393) call.args[0] = glad_arg_f(coord); GLAD_HOOK_PRE ((PFNGLFOGCOORDFPROC)glad_hook_real[393])(coord); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFogCoordfv(const GLfloat *coord) { GLAD_HOOK_BEGIN(394) call.args[0] = glad_arg_p(coord); GLAD_HOOK_PRE ((PFNGLFOGCOORDFVPROC)glad_hook_real[394])(coord); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFogCoordd(GLdouble coord) { GLAD_HOOK_BEGIN(395) call.args[0] = glad_arg_f(coord); GLAD_HOOK_PRE ((PFNGLFOGCOORDDPROC)glad_hook_real[395])(coord); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFogCoorddv(const GLdouble *coord) { GLAD_HOOK_BEGIN(396) call.args[0] = glad_arg_p(coord); GLAD_HOOK_PRE ((PFNGLFOGCOORDDVPROC)glad_hook_real[396])(coord); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(397) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_i(stride); call.args[2] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLFOGCOORDPOINTERPROC)glad_hook_real[397])(type, stride, pointer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) { GLAD_HOOK_BEGIN(398) call.args[0] = glad_arg_i(red); call.args[1] = glad_arg_i(green); call.args[2] = glad_arg_i(blue); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3BPROC)glad_hook_real[398])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3bv(const GLbyte *v) { GLAD_HOOK_BEGIN(399) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3BVPROC)glad_hook_real[399])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) { GLAD_HOOK_BEGIN(400) call.args[0] = glad_arg_f(red); call.args[1] = glad_arg_f(green); call.args[2] = glad_arg_f(blue); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3DPROC)glad_hook_real[400])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3dv(const GLdouble *v) { GLAD_HOOK_BEGIN(401) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3DVPROC)glad_hook_real[401])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) { GLAD_HOOK_BEGIN(402) call.args[0] = glad_arg_f(red); call.args[1] = glad_arg_f(green); call.args[2] = glad_arg_f(blue); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3FPROC)glad_hook_real[402])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3fv(const GLfloat *v) { GLAD_HOOK_BEGIN(403) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3FVPROC)glad_hook_real[403])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3i(GLint red, GLint green, GLint blue) { GLAD_HOOK_BEGIN(404) call.args[0] = glad_arg_i(red); call.args[1] = glad_arg_i(green); call.args[2] = glad_arg_i(blue); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3IPROC)glad_hook_real[404])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3iv(const GLint *v) { GLAD_HOOK_BEGIN(405) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3IVPROC)glad_hook_real[405])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) { GLAD_HOOK_BEGIN(406) call.args[0] = glad_arg_i(red); call.args[1] = glad_arg_i(green); call.args[2] = glad_arg_i(blue); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3SPROC)glad_hook_real[406])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3sv(const GLshort *v) { GLAD_HOOK_BEGIN(407) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3SVPROC)glad_hook_real[407])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) { GLAD_HOOK_BEGIN(408) call.args[0] = glad_arg_u(red); call.args[1] = glad_arg_u(green); call.args[2] = glad_arg_u(blue); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3UBPROC)glad_hook_real[408])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3ubv(const GLubyte *v) { GLAD_HOOK_BEGIN(409) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3UBVPROC)glad_hook_real[409])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) { GLAD_HOOK_BEGIN(410) call.args[0] = glad_arg_u(red); call.args[1] = glad_arg_u(green); call.args[2] = glad_arg_u(blue); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3UIPROC)glad_hook_real[410])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3uiv(const GLuint *v) { GLAD_HOOK_BEGIN(411) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3UIVPROC)glad_hook_real[411])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) { GLAD_HOOK_BEGIN(412) call.args[0] = glad_arg_u(red); call.args[1] = glad_arg_u(green); call.args[2] = glad_arg_u(blue); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3USPROC)glad_hook_real[412])(red, green, blue); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColor3usv(const GLushort *v) { GLAD_HOOK_BEGIN(413) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLOR3USVPROC)glad_hook_real[413])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(414) call.args[0] = glad_arg_i(size); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_i(stride); call.args[3] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLORPOINTERPROC)glad_hook_real[414])(size, type, stride, pointer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos2d(GLdouble x, GLdouble y) { GLAD_HOOK_BEGIN(415) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); GLAD_HOOK_PRE ((PFNGLWINDOWPOS2DPROC)glad_hook_real[415])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos2dv(const GLdouble *v) { GLAD_HOOK_BEGIN(416) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLWINDOWPOS2DVPROC)glad_hook_real[416])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos2f(GLfloat x, GLfloat y) { GLAD_HOOK_BEGIN(417) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); GLAD_HOOK_PRE ((PFNGLWINDOWPOS2FPROC)glad_hook_real[417])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos2fv(const GLfloat *v) { GLAD_HOOK_BEGIN(418) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLWINDOWPOS2FVPROC)glad_hook_real[418])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos2i(GLint x, GLint y) { GLAD_HOOK_BEGIN(419) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); GLAD_HOOK_PRE ((PFNGLWINDOWPOS2IPROC)glad_hook_real[419])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos2iv(const GLint *v) { GLAD_HOOK_BEGIN(420) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLWINDOWPOS2IVPROC)glad_hook_real[420])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos2s(GLshort x, GLshort y) { GLAD_HOOK_BEGIN(421) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); GLAD_HOOK_PRE ((PFNGLWINDOWPOS2SPROC)glad_hook_real[421])(x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos2sv(const GLshort *v) { GLAD_HOOK_BEGIN(422) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLWINDOWPOS2SVPROC)glad_hook_real[422])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) { GLAD_HOOK_BEGIN(423) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLWINDOWPOS3DPROC)glad_hook_real[423])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos3dv(const GLdouble *v) { GLAD_HOOK_BEGIN(424) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLWINDOWPOS3DVPROC)glad_hook_real[424])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) { GLAD_HOOK_BEGIN(425) call.args[0] = glad_arg_f(x); call.args[1] = glad_arg_f(y); call.args[2] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLWINDOWPOS3FPROC)glad_hook_real[425])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos3fv(const GLfloat *v) { GLAD_HOOK_BEGIN(426) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLWINDOWPOS3FVPROC)glad_hook_real[426])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos3i(GLint x, GLint y, GLint z) { GLAD_HOOK_BEGIN(427) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(z); GLAD_HOOK_PRE ((PFNGLWINDOWPOS3IPROC)glad_hook_real[427])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos3iv(const GLint *v) { GLAD_HOOK_BEGIN(428) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLWINDOWPOS3IVPROC)glad_hook_real[428])(v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos3s(GLshort x, GLshort y, GLshort z) { GLAD_HOOK_BEGIN(429) call.args[0] = glad_arg_i(x); call.args[1] = glad_arg_i(y); call.args[2] = glad_arg_i(z); GLAD_HOOK_PRE ((PFNGLWINDOWPOS3SPROC)glad_hook_real[429])(x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glWindowPos3sv(const GLshort *v) { GLAD_HOOK_BEGIN(430) call.args[0] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLWINDOWPOS3SVPROC)glad_hook_real[430])(v); GLAD_HOOK_POST }
+#endif
+static void APIENTRY glad_hook_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { GLAD_HOOK_BEGIN(431) call.args[0] = glad_arg_f(red); call.args[1] = glad_arg_f(green); call.args[2] = glad_arg_f(blue); call.args[3] = glad_arg_f(alpha); GLAD_HOOK_PRE ((PFNGLBLENDCOLORPROC)glad_hook_real[431])(red, green, blue, alpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBlendEquation(GLenum mode) { GLAD_HOOK_BEGIN(432) call.args[0] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLBLENDEQUATIONPROC)glad_hook_real[432])(mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGenQueries(GLsizei n, GLuint *ids) { GLAD_HOOK_BEGIN(433) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(ids); GLAD_HOOK_PRE ((PFNGLGENQUERIESPROC)glad_hook_real[433])(n, ids); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDeleteQueries(GLsizei n, const GLuint *ids) { GLAD_HOOK_BEGIN(434) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(ids); GLAD_HOOK_PRE ((PFNGLDELETEQUERIESPROC)glad_hook_real[434])(n, ids); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glIsQuery(GLuint id) { GLboolean result; GLAD_HOOK_BEGIN(435) call.args[0] = glad_arg_u(id); GLAD_HOOK_PRE result = ((PFNGLISQUERYPROC)glad_hook_real[435])(id); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glBeginQuery(GLenum target, GLuint id) { GLAD_HOOK_BEGIN(436) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(id); GLAD_HOOK_PRE ((PFNGLBEGINQUERYPROC)glad_hook_real[436])(target, id); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEndQuery(GLenum target) { GLAD_HOOK_BEGIN(437) call.args[0] = glad_arg_u(target); GLAD_HOOK_PRE ((PFNGLENDQUERYPROC)glad_hook_real[437])(target); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetQueryiv(GLenum target, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(438) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETQUERYIVPROC)glad_hook_real[438])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(439) call.args[0] = glad_arg_u(id); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETQUERYOBJECTIVPROC)glad_hook_real[439])(id, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) { GLAD_HOOK_BEGIN(440) call.args[0] = glad_arg_u(id); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETQUERYOBJECTUIVPROC)glad_hook_real[440])(id, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBindBuffer(GLenum target, GLuint buffer) { GLAD_HOOK_BEGIN(441) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(buffer); GLAD_HOOK_PRE ((PFNGLBINDBUFFERPROC)glad_hook_real[441])(target, buffer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDeleteBuffers(GLsizei n, const GLuint *buffers) { GLAD_HOOK_BEGIN(442) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(buffers); GLAD_HOOK_PRE ((PFNGLDELETEBUFFERSPROC)glad_hook_real[442])(n, buffers); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGenBuffers(GLsizei n, GLuint *buffers) { GLAD_HOOK_BEGIN(443) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(buffers); GLAD_HOOK_PRE ((PFNGLGENBUFFERSPROC)glad_hook_real[443])(n, buffers); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glIsBuffer(GLuint buffer) { GLboolean result; GLAD_HOOK_BEGIN(444) call.args[0] = glad_arg_u(buffer); GLAD_HOOK_PRE result = ((PFNGLISBUFFERPROC)glad_hook_real[444])(buffer); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { GLAD_HOOK_BEGIN(445) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(size); call.args[2] = glad_arg_p(data); call.args[3] = glad_arg_u(usage); GLAD_HOOK_PRE ((PFNGLBUFFERDATAPROC)glad_hook_real[445])(target, size, data, usage); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { GLAD_HOOK_BEGIN(446) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(offset); call.args[2] = glad_arg_i(size); call.args[3] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLBUFFERSUBDATAPROC)glad_hook_real[446])(target, offset, size, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { GLAD_HOOK_BEGIN(447) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(offset); call.args[2] = glad_arg_i(size); call.args[3] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLGETBUFFERSUBDATAPROC)glad_hook_real[447])(target, offset, size, data); GLAD_HOOK_POST }
+static void *APIENTRY glad_hook_glMapBuffer(GLenum target, GLenum access) { void *result; GLAD_HOOK_BEGIN(448) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(access); GLAD_HOOK_PRE result = ((PFNGLMAPBUFFERPROC)glad_hook_real[448])(target, access); call.result = glad_arg_p(result); GLAD_HOOK_POST return result; }
+static GLboolean APIENTRY glad_hook_glUnmapBuffer(GLenum target) { GLboolean result; GLAD_HOOK_BEGIN(449) call.args[0] = glad_arg_u(target); GLAD_HOOK_PRE result = ((PFNGLUNMAPBUFFERPROC)glad_hook_real[449])(target); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(450) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETBUFFERPARAMETERIVPROC)glad_hook_real[450])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetBufferPointerv(GLenum target, GLenum pname, void **params) { GLAD_HOOK_BEGIN(451) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETBUFFERPOINTERVPROC)glad_hook_real[451])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { GLAD_HOOK_BEGIN(452) call.args[0] = glad_arg_u(modeRGB); call.args[1] = glad_arg_u(modeAlpha); GLAD_HOOK_PRE ((PFNGLBLENDEQUATIONSEPARATEPROC)glad_hook_real[452])(modeRGB, modeAlpha); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDrawBuffers(GLsizei n, const GLenum *bufs) { GLAD_HOOK_BEGIN(453) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(bufs); GLAD_HOOK_PRE ((PFNGLDRAWBUFFERSPROC)glad_hook_real[453])(n, bufs); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) { GLAD_HOOK_BEGIN(454) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(sfail); call.args[2] = glad_arg_u(dpfail); call.args[3] = glad_arg_u(dppass); GLAD_HOOK_PRE ((PFNGLSTENCILOPSEPARATEPROC)glad_hook_real[454])(face, sfail, dpfail, dppass); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) { GLAD_HOOK_BEGIN(455) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(func); call.args[2] = glad_arg_i(ref); call.args[3] = glad_arg_u(mask); GLAD_HOOK_PRE ((PFNGLSTENCILFUNCSEPARATEPROC)glad_hook_real[455])(face, func, ref, mask); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glStencilMaskSeparate(GLenum face, GLuint mask) { GLAD_HOOK_BEGIN(456) call.args[0] = glad_arg_u(face); call.args[1] = glad_arg_u(mask); GLAD_HOOK_PRE ((PFNGLSTENCILMASKSEPARATEPROC)glad_hook_real[456])(face, mask); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glAttachShader(GLuint program, GLuint shader) { GLAD_HOOK_BEGIN(457) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(shader); GLAD_HOOK_PRE ((PFNGLATTACHSHADERPROC)glad_hook_real[457])(program, shader); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { GLAD_HOOK_BEGIN(458) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(index); call.args[2] = glad_arg_p(name); GLAD_HOOK_PRE ((PFNGLBINDATTRIBLOCATIONPROC)glad_hook_real[458])(program, index, name); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCompileShader(GLuint shader) { GLAD_HOOK_BEGIN(459) call.args[0] = glad_arg_u(shader); GLAD_HOOK_PRE ((PFNGLCOMPILESHADERPROC)glad_hook_real[459])(shader); GLAD_HOOK_POST }
+static GLuint APIENTRY glad_hook_glCreateProgram(void) { GLuint result; GLAD_HOOK_BEGIN(460) GLAD_HOOK_PRE result = ((PFNGLCREATEPROGRAMPROC)glad_hook_real[460])(); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static GLuint APIENTRY glad_hook_glCreateShader(GLenum type) { GLuint result; GLAD_HOOK_BEGIN(461) call.args[0] = glad_arg_u(type); GLAD_HOOK_PRE result = ((PFNGLCREATESHADERPROC)glad_hook_real[461])(type); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glDeleteProgram(GLuint program) { GLAD_HOOK_BEGIN(462) call.args[0] = glad_arg_u(program); GLAD_HOOK_PRE ((PFNGLDELETEPROGRAMPROC)glad_hook_real[462])(program); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDeleteShader(GLuint shader) { GLAD_HOOK_BEGIN(463) call.args[0] = glad_arg_u(shader); GLAD_HOOK_PRE ((PFNGLDELETESHADERPROC)glad_hook_real[463])(shader); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDetachShader(GLuint program, GLuint shader) { GLAD_HOOK_BEGIN(464) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(shader); GLAD_HOOK_PRE ((PFNGLDETACHSHADERPROC)glad_hook_real[464])(program, shader); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDisableVertexAttribArray(GLuint index) { GLAD_HOOK_BEGIN(465) call.args[0] = glad_arg_u(index); GLAD_HOOK_PRE ((PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_hook_real[465])(index); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEnableVertexAttribArray(GLuint index) { GLAD_HOOK_BEGIN(466) call.args[0] = glad_arg_u(index); GLAD_HOOK_PRE ((PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_hook_real[466])(index); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { GLAD_HOOK_BEGIN(467) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(index); call.args[2] = glad_arg_i(bufSize); call.args[3] = glad_arg_p(length); call.args[4] = glad_arg_p(size); call.args[5] = glad_arg_p(type); call.args[6] = glad_arg_p(name); GLAD_HOOK_PRE ((PFNGLGETACTIVEATTRIBPROC)glad_hook_real[467])(program, index, bufSize, length, size, type, name); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { GLAD_HOOK_BEGIN(468) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(index); call.args[2] = glad_arg_i(bufSize); call.args[3] = glad_arg_p(length); call.args[4] = glad_arg_p(size); call.args[5] = glad_arg_p(type); call.args[6] = glad_arg_p(name); GLAD_HOOK_PRE ((PFNGLGETACTIVEUNIFORMPROC)glad_hook_real[468])(program, index, bufSize, length, size, type, name); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { GLAD_HOOK_BEGIN(469) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_i(maxCount); call.args[2] = glad_arg_p(count); call.args[3] = glad_arg_p(shaders); GLAD_HOOK_PRE ((PFNGLGETATTACHEDSHADERSPROC)glad_hook_real[469])(program, maxCount, count, shaders); GLAD_HOOK_POST }
+static GLint APIENTRY glad_hook_glGetAttribLocation(GLuint program, const GLchar *name) { GLint result; GLAD_HOOK_BEGIN(470) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_p(name); GLAD_HOOK_PRE result = ((PFNGLGETATTRIBLOCATIONPROC)glad_hook_real[470])(program, name); call.result = glad_arg_i(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glGetProgramiv(GLuint program, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(471) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETPROGRAMIVPROC)glad_hook_real[471])(program, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { GLAD_HOOK_BEGIN(472) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_i(bufSize); call.args[2] = glad_arg_p(length); call.args[3] = glad_arg_p(infoLog); GLAD_HOOK_PRE ((PFNGLGETPROGRAMINFOLOGPROC)glad_hook_real[472])(program, bufSize, length, infoLog); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(473) call.args[0] = glad_arg_u(shader); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETSHADERIVPROC)glad_hook_real[473])(shader, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { GLAD_HOOK_BEGIN(474) call.args[0] = glad_arg_u(shader); call.args[1] = glad_arg_i(bufSize); call.args[2] = glad_arg_p(length); call.args[3] = glad_arg_p(infoLog); GLAD_HOOK_PRE ((PFNGLGETSHADERINFOLOGPROC)glad_hook_real[474])(shader, bufSize, length, infoLog); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) { GLAD_HOOK_BEGIN(475) call.args[0] = glad_arg_u(shader); call.args[1] = glad_arg_i(bufSize); call.args[2] = glad_arg_p(length); call.args[3] = glad_arg_p(source); GLAD_HOOK_PRE ((PFNGLGETSHADERSOURCEPROC)glad_hook_real[475])(shader, bufSize, length, source); GLAD_HOOK_POST }
+static GLint APIENTRY glad_hook_glGetUniformLocation(GLuint program, const GLchar *name) { GLint result; GLAD_HOOK_BEGIN(476) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_p(name); GLAD_HOOK_PRE result = ((PFNGLGETUNIFORMLOCATIONPROC)glad_hook_real[476])(program, name); call.result = glad_arg_i(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glGetUniformfv(GLuint program, GLint location, GLfloat *params) { GLAD_HOOK_BEGIN(477) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_i(location); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETUNIFORMFVPROC)glad_hook_real[477])(program, location, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetUniformiv(GLuint program, GLint location, GLint *params) { GLAD_HOOK_BEGIN(478) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_i(location); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETUNIFORMIVPROC)glad_hook_real[478])(program, location, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) { GLAD_HOOK_BEGIN(479) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETVERTEXATTRIBDVPROC)glad_hook_real[479])(index, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) { GLAD_HOOK_BEGIN(480) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETVERTEXATTRIBFVPROC)glad_hook_real[480])(index, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(481) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETVERTEXATTRIBIVPROC)glad_hook_real[481])(index, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) { GLAD_HOOK_BEGIN(482) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_hook_real[482])(index, pname, pointer); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glIsProgram(GLuint program) { GLboolean result; GLAD_HOOK_BEGIN(483) call.args[0] = glad_arg_u(program); GLAD_HOOK_PRE result = ((PFNGLISPROGRAMPROC)glad_hook_real[483])(program); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static GLboolean APIENTRY glad_hook_glIsShader(GLuint shader) { GLboolean result; GLAD_HOOK_BEGIN(484) call.args[0] = glad_arg_u(shader); GLAD_HOOK_PRE result = ((PFNGLISSHADERPROC)glad_hook_real[484])(shader); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glLinkProgram(GLuint program) { GLAD_HOOK_BEGIN(485) call.args[0] = glad_arg_u(program); GLAD_HOOK_PRE ((PFNGLLINKPROGRAMPROC)glad_hook_real[485])(program); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) { GLAD_HOOK_BEGIN(486) call.args[0] = glad_arg_u(shader); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(string); call.args[3] = glad_arg_p(length); GLAD_HOOK_PRE ((PFNGLSHADERSOURCEPROC)glad_hook_real[486])(shader, count, string, length); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUseProgram(GLuint program) { GLAD_HOOK_BEGIN(487) call.args[0] = glad_arg_u(program); GLAD_HOOK_PRE ((PFNGLUSEPROGRAMPROC)glad_hook_real[487])(program); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform1f(GLint location, GLfloat v0) { GLAD_HOOK_BEGIN(488) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_f(v0); GLAD_HOOK_PRE ((PFNGLUNIFORM1FPROC)glad_hook_real[488])(location, v0); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform2f(GLint location, GLfloat v0, GLfloat v1) { GLAD_HOOK_BEGIN(489) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_f(v0); call.args[2] = glad_arg_f(v1); GLAD_HOOK_PRE ((PFNGLUNIFORM2FPROC)glad_hook_real[489])(location, v0, v1); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { GLAD_HOOK_BEGIN(490) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_f(v0); call.args[2] = glad_arg_f(v1); call.args[3] = glad_arg_f(v2); GLAD_HOOK_PRE ((PFNGLUNIFORM3FPROC)glad_hook_real[490])(location, v0, v1, v2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { GLAD_HOOK_BEGIN(491) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_f(v0); call.args[2] = glad_arg_f(v1); call.args[3] = glad_arg_f(v2); call.args[4] = glad_arg_f(v3); GLAD_HOOK_PRE ((PFNGLUNIFORM4FPROC)glad_hook_real[491])(location, v0, v1, v2, v3); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform1i(GLint location, GLint v0) { GLAD_HOOK_BEGIN(492) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(v0); GLAD_HOOK_PRE ((PFNGLUNIFORM1IPROC)glad_hook_real[492])(location, v0); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform2i(GLint location, GLint v0, GLint v1) { GLAD_HOOK_BEGIN(493) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(v0); call.args[2] = glad_arg_i(v1); GLAD_HOOK_PRE ((PFNGLUNIFORM2IPROC)glad_hook_real[493])(location, v0, v1); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) { GLAD_HOOK_BEGIN(494) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(v0); call.args[2] = glad_arg_i(v1); call.args[3] = glad_arg_i(v2); GLAD_HOOK_PRE ((PFNGLUNIFORM3IPROC)glad_hook_real[494])(location, v0, v1, v2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { GLAD_HOOK_BEGIN(495) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(v0); call.args[2] = glad_arg_i(v1); call.args[3] = glad_arg_i(v2); call.args[4] = glad_arg_i(v3); GLAD_HOOK_PRE ((PFNGLUNIFORM4IPROC)glad_hook_real[495])(location, v0, v1, v2, v3); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { GLAD_HOOK_BEGIN(496) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM1FVPROC)glad_hook_real[496])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { GLAD_HOOK_BEGIN(497) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM2FVPROC)glad_hook_real[497])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { GLAD_HOOK_BEGIN(498) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM3FVPROC)glad_hook_real[498])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { GLAD_HOOK_BEGIN(499) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM4FVPROC)glad_hook_real[499])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform1iv(GLint location, GLsizei count, const GLint *value) { GLAD_HOOK_BEGIN(500) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM1IVPROC)glad_hook_real[500])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform2iv(GLint location, GLsizei count, const GLint *value) { GLAD_HOOK_BEGIN(501) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM2IVPROC)glad_hook_real[501])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform3iv(GLint location, GLsizei count, const GLint *value) { GLAD_HOOK_BEGIN(502) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM3IVPROC)glad_hook_real[502])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform4iv(GLint location, GLsizei count, const GLint *value) { GLAD_HOOK_BEGIN(503) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM4IVPROC)glad_hook_real[503])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_HOOK_BEGIN(504) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(transpose); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORMMATRIX2FVPROC)glad_hook_real[504])(location, count, transpose, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_HOOK_BEGIN(505) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(transpose); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORMMATRIX3FVPROC)glad_hook_real[505])(location, count, transpose, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_HOOK_BEGIN(506) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(transpose); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORMMATRIX4FVPROC)glad_hook_real[506])(location, count, transpose, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glValidateProgram(GLuint program) { GLAD_HOOK_BEGIN(507) call.args[0] = glad_arg_u(program); GLAD_HOOK_PRE ((PFNGLVALIDATEPROGRAMPROC)glad_hook_real[507])(program); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib1d(GLuint index, GLdouble x) { GLAD_HOOK_BEGIN(508) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_f(x); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB1DPROC)glad_hook_real[508])(index, x); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib1dv(GLuint index, const GLdouble *v) { GLAD_HOOK_BEGIN(509) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB1DVPROC)glad_hook_real[509])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib1f(GLuint index, GLfloat x) { GLAD_HOOK_BEGIN(510) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_f(x); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB1FPROC)glad_hook_real[510])(index, x); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib1fv(GLuint index, const GLfloat *v) { GLAD_HOOK_BEGIN(511) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB1FVPROC)glad_hook_real[511])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib1s(GLuint index, GLshort x) { GLAD_HOOK_BEGIN(512) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_i(x); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB1SPROC)glad_hook_real[512])(index, x); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib1sv(GLuint index, const GLshort *v) { GLAD_HOOK_BEGIN(513) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB1SVPROC)glad_hook_real[513])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) { GLAD_HOOK_BEGIN(514) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_f(x); call.args[2] = glad_arg_f(y); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB2DPROC)glad_hook_real[514])(index, x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib2dv(GLuint index, const GLdouble *v) { GLAD_HOOK_BEGIN(515) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB2DVPROC)glad_hook_real[515])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) { GLAD_HOOK_BEGIN(516) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_f(x); call.args[2] = glad_arg_f(y); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB2FPROC)glad_hook_real[516])(index, x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib2fv(GLuint index, const GLfloat *v) { GLAD_HOOK_BEGIN(517) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB2FVPROC)glad_hook_real[517])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) { GLAD_HOOK_BEGIN(518) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_i(x); call.args[2] = glad_arg_i(y); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB2SPROC)glad_hook_real[518])(index, x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib2sv(GLuint index, const GLshort *v) { GLAD_HOOK_BEGIN(519) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB2SVPROC)glad_hook_real[519])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { GLAD_HOOK_BEGIN(520) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_f(x); call.args[2] = glad_arg_f(y); call.args[3] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB3DPROC)glad_hook_real[520])(index, x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib3dv(GLuint index, const GLdouble *v) { GLAD_HOOK_BEGIN(521) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB3DVPROC)glad_hook_real[521])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) { GLAD_HOOK_BEGIN(522) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_f(x); call.args[2] = glad_arg_f(y); call.args[3] = glad_arg_f(z); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB3FPROC)glad_hook_real[522])(index, x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib3fv(GLuint index, const GLfloat *v) { GLAD_HOOK_BEGIN(523) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB3FVPROC)glad_hook_real[523])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) { GLAD_HOOK_BEGIN(524) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_i(x); call.args[2] = glad_arg_i(y); call.args[3] = glad_arg_i(z); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB3SPROC)glad_hook_real[524])(index, x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib3sv(GLuint index, const GLshort *v) { GLAD_HOOK_BEGIN(525) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB3SVPROC)glad_hook_real[525])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) { GLAD_HOOK_BEGIN(526) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4NBVPROC)glad_hook_real[526])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4Niv(GLuint index, const GLint *v) { GLAD_HOOK_BEGIN(527) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4NIVPROC)glad_hook_real[527])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4Nsv(GLuint index, const GLshort *v) { GLAD_HOOK_BEGIN(528) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4NSVPROC)glad_hook_real[528])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) { GLAD_HOOK_BEGIN(529) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(x); call.args[2] = glad_arg_u(y); call.args[3] = glad_arg_u(z); call.args[4] = glad_arg_u(w); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4NUBPROC)glad_hook_real[529])(index, x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) { GLAD_HOOK_BEGIN(530) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4NUBVPROC)glad_hook_real[530])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) { GLAD_HOOK_BEGIN(531) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4NUIVPROC)glad_hook_real[531])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4Nusv(GLuint index, const GLushort *v) { GLAD_HOOK_BEGIN(532) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4NUSVPROC)glad_hook_real[532])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4bv(GLuint index, const GLbyte *v) { GLAD_HOOK_BEGIN(533) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4BVPROC)glad_hook_real[533])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { GLAD_HOOK_BEGIN(534) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_f(x); call.args[2] = glad_arg_f(y); call.args[3] = glad_arg_f(z); call.args[4] = glad_arg_f(w); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4DPROC)glad_hook_real[534])(index, x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4dv(GLuint index, const GLdouble *v) { GLAD_HOOK_BEGIN(535) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4DVPROC)glad_hook_real[535])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { GLAD_HOOK_BEGIN(536) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_f(x); call.args[2] = glad_arg_f(y); call.args[3] = glad_arg_f(z); call.args[4] = glad_arg_f(w); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4FPROC)glad_hook_real[536])(index, x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4fv(GLuint index, const GLfloat *v) { GLAD_HOOK_BEGIN(537) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4FVPROC)glad_hook_real[537])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4iv(GLuint index, const GLint *v) { GLAD_HOOK_BEGIN(538) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4IVPROC)glad_hook_real[538])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) { GLAD_HOOK_BEGIN(539) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_i(x); call.args[2] = glad_arg_i(y); call.args[3] = glad_arg_i(z); call.args[4] = glad_arg_i(w); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4SPROC)glad_hook_real[539])(index, x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4sv(GLuint index, const GLshort *v) { GLAD_HOOK_BEGIN(540) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4SVPROC)glad_hook_real[540])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4ubv(GLuint index, const GLubyte *v) { GLAD_HOOK_BEGIN(541) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4UBVPROC)glad_hook_real[541])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4uiv(GLuint index, const GLuint *v) { GLAD_HOOK_BEGIN(542) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4UIVPROC)glad_hook_real[542])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttrib4usv(GLuint index, const GLushort *v) { GLAD_HOOK_BEGIN(543) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIB4USVPROC)glad_hook_real[543])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(544) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_i(size); call.args[2] = glad_arg_u(type); call.args[3] = glad_arg_u(normalized); call.args[4] = glad_arg_i(stride); call.args[5] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBPOINTERPROC)glad_hook_real[544])(index, size, type, normalized, stride, pointer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_HOOK_BEGIN(545) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(transpose); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORMMATRIX2X3FVPROC)glad_hook_real[545])(location, count, transpose, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_HOOK_BEGIN(546) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(transpose); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORMMATRIX3X2FVPROC)glad_hook_real[546])(location, count, transpose, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_HOOK_BEGIN(547) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(transpose); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORMMATRIX2X4FVPROC)glad_hook_real[547])(location, count, transpose, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_HOOK_BEGIN(548) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(transpose); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORMMATRIX4X2FVPROC)glad_hook_real[548])(location, count, transpose, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_HOOK_BEGIN(549) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(transpose); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORMMATRIX3X4FVPROC)glad_hook_real[549])(location, count, transpose, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { GLAD_HOOK_BEGIN(550) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(transpose); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORMMATRIX4X3FVPROC)glad_hook_real[550])(location, count, transpose, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) { GLAD_HOOK_BEGIN(551) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(r); call.args[2] = glad_arg_u(g); call.args[3] = glad_arg_u(b); call.args[4] = glad_arg_u(a); GLAD_HOOK_PRE ((PFNGLCOLORMASKIPROC)glad_hook_real[551])(index, r, g, b, a); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) { GLAD_HOOK_BEGIN(552) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(index); call.args[2] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLGETBOOLEANI_VPROC)glad_hook_real[552])(target, index, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) { GLAD_HOOK_BEGIN(553) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(index); call.args[2] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLGETINTEGERI_VPROC)glad_hook_real[553])(target, index, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEnablei(GLenum target, GLuint index) { GLAD_HOOK_BEGIN(554) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(index); GLAD_HOOK_PRE ((PFNGLENABLEIPROC)glad_hook_real[554])(target, index); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDisablei(GLenum target, GLuint index) { GLAD_HOOK_BEGIN(555) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(index); GLAD_HOOK_PRE ((PFNGLDISABLEIPROC)glad_hook_real[555])(target, index); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glIsEnabledi(GLenum target, GLuint index) { GLboolean result; GLAD_HOOK_BEGIN(556) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(index); GLAD_HOOK_PRE result = ((PFNGLISENABLEDIPROC)glad_hook_real[556])(target, index); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glBeginTransformFeedback(GLenum primitiveMode) { GLAD_HOOK_BEGIN(557) call.args[0] = glad_arg_u(primitiveMode); GLAD_HOOK_PRE ((PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_hook_real[557])(primitiveMode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEndTransformFeedback(void) { GLAD_HOOK_BEGIN(558) GLAD_HOOK_PRE ((PFNGLENDTRANSFORMFEEDBACKPROC)glad_hook_real[558])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { GLAD_HOOK_BEGIN(559) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(index); call.args[2] = glad_arg_u(buffer); call.args[3] = glad_arg_i(offset); call.args[4] = glad_arg_i(size); GLAD_HOOK_PRE ((PFNGLBINDBUFFERRANGEPROC)glad_hook_real[559])(target, index, buffer, offset, size); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) { GLAD_HOOK_BEGIN(560) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(index); call.args[2] = glad_arg_u(buffer); GLAD_HOOK_PRE ((PFNGLBINDBUFFERBASEPROC)glad_hook_real[560])(target, index, buffer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) { GLAD_HOOK_BEGIN(561) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(varyings); call.args[3] = glad_arg_u(bufferMode); GLAD_HOOK_PRE ((PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_hook_real[561])(program, count, varyings, bufferMode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) { GLAD_HOOK_BEGIN(562) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(index); call.args[2] = glad_arg_i(bufSize); call.args[3] = glad_arg_p(length); call.args[4] = glad_arg_p(size); call.args[5] = glad_arg_p(type); call.args[6] = glad_arg_p(name); GLAD_HOOK_PRE ((PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_hook_real[562])(program, index, bufSize, length, size, type, name); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClampColor(GLenum target, GLenum clamp) { GLAD_HOOK_BEGIN(563) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(clamp); GLAD_HOOK_PRE ((PFNGLCLAMPCOLORPROC)glad_hook_real[563])(target, clamp); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBeginConditionalRender(GLuint id, GLenum mode) { GLAD_HOOK_BEGIN(564) call.args[0] = glad_arg_u(id); call.args[1] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLBEGINCONDITIONALRENDERPROC)glad_hook_real[564])(id, mode); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glEndConditionalRender(void) { GLAD_HOOK_BEGIN(565) GLAD_HOOK_PRE ((PFNGLENDCONDITIONALRENDERPROC)glad_hook_real[565])(); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { GLAD_HOOK_BEGIN(566) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_i(size); call.args[2] = glad_arg_u(type); call.args[3] = glad_arg_i(stride); call.args[4] = glad_arg_p(pointer); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBIPOINTERPROC)glad_hook_real[566])(index, size, type, stride, pointer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(567) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETVERTEXATTRIBIIVPROC)glad_hook_real[567])(index, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) { GLAD_HOOK_BEGIN(568) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETVERTEXATTRIBIUIVPROC)glad_hook_real[568])(index, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI1i(GLuint index, GLint x) { GLAD_HOOK_BEGIN(569) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_i(x); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI1IPROC)glad_hook_real[569])(index, x); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI2i(GLuint index, GLint x, GLint y) { GLAD_HOOK_BEGIN(570) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_i(x); call.args[2] = glad_arg_i(y); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI2IPROC)glad_hook_real[570])(index, x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) { GLAD_HOOK_BEGIN(571) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_i(x); call.args[2] = glad_arg_i(y); call.args[3] = glad_arg_i(z); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI3IPROC)glad_hook_real[571])(index, x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) { GLAD_HOOK_BEGIN(572) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_i(x); call.args[2] = glad_arg_i(y); call.args[3] = glad_arg_i(z); call.args[4] = glad_arg_i(w); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI4IPROC)glad_hook_real[572])(index, x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI1ui(GLuint index, GLuint x) { GLAD_HOOK_BEGIN(573) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(x); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI1UIPROC)glad_hook_real[573])(index, x); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) { GLAD_HOOK_BEGIN(574) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(x); call.args[2] = glad_arg_u(y); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI2UIPROC)glad_hook_real[574])(index, x, y); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) { GLAD_HOOK_BEGIN(575) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(x); call.args[2] = glad_arg_u(y); call.args[3] = glad_arg_u(z); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI3UIPROC)glad_hook_real[575])(index, x, y, z); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { GLAD_HOOK_BEGIN(576) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(x); call.args[2] = glad_arg_u(y); call.args[3] = glad_arg_u(z); call.args[4] = glad_arg_u(w); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI4UIPROC)glad_hook_real[576])(index, x, y, z, w); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI1iv(GLuint index, const GLint *v) { GLAD_HOOK_BEGIN(577) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI1IVPROC)glad_hook_real[577])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI2iv(GLuint index, const GLint *v) { GLAD_HOOK_BEGIN(578) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI2IVPROC)glad_hook_real[578])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI3iv(GLuint index, const GLint *v) { GLAD_HOOK_BEGIN(579) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI3IVPROC)glad_hook_real[579])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI4iv(GLuint index, const GLint *v) { GLAD_HOOK_BEGIN(580) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI4IVPROC)glad_hook_real[580])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI1uiv(GLuint index, const GLuint *v) { GLAD_HOOK_BEGIN(581) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI1UIVPROC)glad_hook_real[581])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI2uiv(GLuint index, const GLuint *v) { GLAD_HOOK_BEGIN(582) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI2UIVPROC)glad_hook_real[582])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI3uiv(GLuint index, const GLuint *v) { GLAD_HOOK_BEGIN(583) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI3UIVPROC)glad_hook_real[583])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI4uiv(GLuint index, const GLuint *v) { GLAD_HOOK_BEGIN(584) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI4UIVPROC)glad_hook_real[584])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI4bv(GLuint index, const GLbyte *v) { GLAD_HOOK_BEGIN(585) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI4BVPROC)glad_hook_real[585])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI4sv(GLuint index, const GLshort *v) { GLAD_HOOK_BEGIN(586) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI4SVPROC)glad_hook_real[586])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI4ubv(GLuint index, const GLubyte *v) { GLAD_HOOK_BEGIN(587) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI4UBVPROC)glad_hook_real[587])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribI4usv(GLuint index, const GLushort *v) { GLAD_HOOK_BEGIN(588) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_p(v); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBI4USVPROC)glad_hook_real[588])(index, v); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetUniformuiv(GLuint program, GLint location, GLuint *params) { GLAD_HOOK_BEGIN(589) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_i(location); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETUNIFORMUIVPROC)glad_hook_real[589])(program, location, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) { GLAD_HOOK_BEGIN(590) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(color); call.args[2] = glad_arg_p(name); GLAD_HOOK_PRE ((PFNGLBINDFRAGDATALOCATIONPROC)glad_hook_real[590])(program, color, name); GLAD_HOOK_POST }
+static GLint APIENTRY glad_hook_glGetFragDataLocation(GLuint program, const GLchar *name) { GLint result; GLAD_HOOK_BEGIN(591) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_p(name); GLAD_HOOK_PRE result = ((PFNGLGETFRAGDATALOCATIONPROC)glad_hook_real[591])(program, name); call.result = glad_arg_i(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glUniform1ui(GLint location, GLuint v0) { GLAD_HOOK_BEGIN(592) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_u(v0); GLAD_HOOK_PRE ((PFNGLUNIFORM1UIPROC)glad_hook_real[592])(location, v0); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform2ui(GLint location, GLuint v0, GLuint v1) { GLAD_HOOK_BEGIN(593) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_u(v0); call.args[2] = glad_arg_u(v1); GLAD_HOOK_PRE ((PFNGLUNIFORM2UIPROC)glad_hook_real[593])(location, v0, v1); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) { GLAD_HOOK_BEGIN(594) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_u(v0); call.args[2] = glad_arg_u(v1); call.args[3] = glad_arg_u(v2); GLAD_HOOK_PRE ((PFNGLUNIFORM3UIPROC)glad_hook_real[594])(location, v0, v1, v2); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { GLAD_HOOK_BEGIN(595) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_u(v0); call.args[2] = glad_arg_u(v1); call.args[3] = glad_arg_u(v2); call.args[4] = glad_arg_u(v3); GLAD_HOOK_PRE ((PFNGLUNIFORM4UIPROC)glad_hook_real[595])(location, v0, v1, v2, v3); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) { GLAD_HOOK_BEGIN(596) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM1UIVPROC)glad_hook_real[596])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) { GLAD_HOOK_BEGIN(597) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM2UIVPROC)glad_hook_real[597])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) { GLAD_HOOK_BEGIN(598) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM3UIVPROC)glad_hook_real[598])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) { GLAD_HOOK_BEGIN(599) call.args[0] = glad_arg_i(location); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLUNIFORM4UIVPROC)glad_hook_real[599])(location, count, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) { GLAD_HOOK_BEGIN(600) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLTEXPARAMETERIIVPROC)glad_hook_real[600])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) { GLAD_HOOK_BEGIN(601) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLTEXPARAMETERIUIVPROC)glad_hook_real[601])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(602) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXPARAMETERIIVPROC)glad_hook_real[602])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) { GLAD_HOOK_BEGIN(603) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETTEXPARAMETERIUIVPROC)glad_hook_real[603])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) { GLAD_HOOK_BEGIN(604) call.args[0] = glad_arg_u(buffer); call.args[1] = glad_arg_i(drawbuffer); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLCLEARBUFFERIVPROC)glad_hook_real[604])(buffer, drawbuffer, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) { GLAD_HOOK_BEGIN(605) call.args[0] = glad_arg_u(buffer); call.args[1] = glad_arg_i(drawbuffer); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLCLEARBUFFERUIVPROC)glad_hook_real[605])(buffer, drawbuffer, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) { GLAD_HOOK_BEGIN(606) call.args[0] = glad_arg_u(buffer); call.args[1] = glad_arg_i(drawbuffer); call.args[2] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLCLEARBUFFERFVPROC)glad_hook_real[606])(buffer, drawbuffer, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { GLAD_HOOK_BEGIN(607) call.args[0] = glad_arg_u(buffer); call.args[1] = glad_arg_i(drawbuffer); call.args[2] = glad_arg_f(depth); call.args[3] = glad_arg_i(stencil); GLAD_HOOK_PRE ((PFNGLCLEARBUFFERFIPROC)glad_hook_real[607])(buffer, drawbuffer, depth, stencil); GLAD_HOOK_POST }
+static const GLubyte *APIENTRY glad_hook_glGetStringi(GLenum name, GLuint index) { const GLubyte *result; GLAD_HOOK_BEGIN(608) call.args[0] = glad_arg_u(name); call.args[1] = glad_arg_u(index); GLAD_HOOK_PRE result = ((PFNGLGETSTRINGIPROC)glad_hook_real[608])(name, index); call.result = glad_arg_p(result); GLAD_HOOK_POST return result; }
+static GLboolean APIENTRY glad_hook_glIsRenderbuffer(GLuint renderbuffer) { GLboolean result; GLAD_HOOK_BEGIN(609) call.args[0] = glad_arg_u(renderbuffer); GLAD_HOOK_PRE result = ((PFNGLISRENDERBUFFERPROC)glad_hook_real[609])(renderbuffer); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glBindRenderbuffer(GLenum target, GLuint renderbuffer) { GLAD_HOOK_BEGIN(610) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(renderbuffer); GLAD_HOOK_PRE ((PFNGLBINDRENDERBUFFERPROC)glad_hook_real[610])(target, renderbuffer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { GLAD_HOOK_BEGIN(611) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(renderbuffers); GLAD_HOOK_PRE ((PFNGLDELETERENDERBUFFERSPROC)glad_hook_real[611])(n, renderbuffers); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { GLAD_HOOK_BEGIN(612) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(renderbuffers); GLAD_HOOK_PRE ((PFNGLGENRENDERBUFFERSPROC)glad_hook_real[612])(n, renderbuffers); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { GLAD_HOOK_BEGIN(613) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(internalformat); call.args[2] = glad_arg_i(width); call.args[3] = glad_arg_i(height); GLAD_HOOK_PRE ((PFNGLRENDERBUFFERSTORAGEPROC)glad_hook_real[613])(target, internalformat, width, height); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(614) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_hook_real[614])(target, pname, params); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glIsFramebuffer(GLuint framebuffer) { GLboolean result; GLAD_HOOK_BEGIN(615) call.args[0] = glad_arg_u(framebuffer); GLAD_HOOK_PRE result = ((PFNGLISFRAMEBUFFERPROC)glad_hook_real[615])(framebuffer); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glBindFramebuffer(GLenum target, GLuint framebuffer) { GLAD_HOOK_BEGIN(616) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(framebuffer); GLAD_HOOK_PRE ((PFNGLBINDFRAMEBUFFERPROC)glad_hook_real[616])(target, framebuffer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { GLAD_HOOK_BEGIN(617) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(framebuffers); GLAD_HOOK_PRE ((PFNGLDELETEFRAMEBUFFERSPROC)glad_hook_real[617])(n, framebuffers); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGenFramebuffers(GLsizei n, GLuint *framebuffers) { GLAD_HOOK_BEGIN(618) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(framebuffers); GLAD_HOOK_PRE ((PFNGLGENFRAMEBUFFERSPROC)glad_hook_real[618])(n, framebuffers); GLAD_HOOK_POST }
+static GLenum APIENTRY glad_hook_glCheckFramebufferStatus(GLenum target) { GLenum result; GLAD_HOOK_BEGIN(619) call.args[0] = glad_arg_u(target); GLAD_HOOK_PRE result = ((PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_hook_real[619])(target); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { GLAD_HOOK_BEGIN(620) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(attachment); call.args[2] = glad_arg_u(textarget); call.args[3] = glad_arg_u(texture); call.args[4] = glad_arg_i(level); GLAD_HOOK_PRE ((PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_hook_real[620])(target, attachment, textarget, texture, level); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { GLAD_HOOK_BEGIN(621) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(attachment); call.args[2] = glad_arg_u(textarget); call.args[3] = glad_arg_u(texture); call.args[4] = glad_arg_i(level); GLAD_HOOK_PRE ((PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_hook_real[621])(target, attachment, textarget, texture, level); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { GLAD_HOOK_BEGIN(622) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(attachment); call.args[2] = glad_arg_u(textarget); call.args[3] = glad_arg_u(texture); call.args[4] = glad_arg_i(level); call.args[5] = glad_arg_i(zoffset); GLAD_HOOK_PRE ((PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_hook_real[622])(target, attachment, textarget, texture, level, zoffset); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { GLAD_HOOK_BEGIN(623) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(attachment); call.args[2] = glad_arg_u(renderbuffertarget); call.args[3] = glad_arg_u(renderbuffer); GLAD_HOOK_PRE ((PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_hook_real[623])(target, attachment, renderbuffertarget, renderbuffer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(624) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(attachment); call.args[2] = glad_arg_u(pname); call.args[3] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_hook_real[624])(target, attachment, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGenerateMipmap(GLenum target) { GLAD_HOOK_BEGIN(625) call.args[0] = glad_arg_u(target); GLAD_HOOK_PRE ((PFNGLGENERATEMIPMAPPROC)glad_hook_real[625])(target); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { GLAD_HOOK_BEGIN(626) call.args[0] = glad_arg_i(srcX0); call.args[1] = glad_arg_i(srcY0); call.args[2] = glad_arg_i(srcX1); call.args[3] = glad_arg_i(srcY1); call.args[4] = glad_arg_i(dstX0); call.args[5] = glad_arg_i(dstY0); call.args[6] = glad_arg_i(dstX1); call.args[7] = glad_arg_i(dstY1); call.args[8] = glad_arg_u(mask); call.args[9] = glad_arg_u(filter); GLAD_HOOK_PRE ((PFNGLBLITFRAMEBUFFERPROC)glad_hook_real[626])(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { GLAD_HOOK_BEGIN(627) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(samples); call.args[2] = glad_arg_u(internalformat); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_i(height); GLAD_HOOK_PRE ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_hook_real[627])(target, samples, internalformat, width, height); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { GLAD_HOOK_BEGIN(628) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(attachment); call.args[2] = glad_arg_u(texture); call.args[3] = glad_arg_i(level); call.args[4] = glad_arg_i(layer); GLAD_HOOK_PRE ((PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_hook_real[628])(target, attachment, texture, level, layer); GLAD_HOOK_POST }
+static void *APIENTRY glad_hook_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { void *result; GLAD_HOOK_BEGIN(629) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(offset); call.args[2] = glad_arg_i(length); call.args[3] = glad_arg_u(access); GLAD_HOOK_PRE result = ((PFNGLMAPBUFFERRANGEPROC)glad_hook_real[629])(target, offset, length, access); call.result = glad_arg_p(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) { GLAD_HOOK_BEGIN(630) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(offset); call.args[2] = glad_arg_i(length); GLAD_HOOK_PRE ((PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_hook_real[630])(target, offset, length); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBindVertexArray(GLuint array) { GLAD_HOOK_BEGIN(631) call.args[0] = glad_arg_u(array); GLAD_HOOK_PRE ((PFNGLBINDVERTEXARRAYPROC)glad_hook_real[631])(array); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) { GLAD_HOOK_BEGIN(632) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(arrays); GLAD_HOOK_PRE ((PFNGLDELETEVERTEXARRAYSPROC)glad_hook_real[632])(n, arrays); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGenVertexArrays(GLsizei n, GLuint *arrays) { GLAD_HOOK_BEGIN(633) call.args[0] = glad_arg_i(n); call.args[1] = glad_arg_p(arrays); GLAD_HOOK_PRE ((PFNGLGENVERTEXARRAYSPROC)glad_hook_real[633])(n, arrays); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glIsVertexArray(GLuint array) { GLboolean result; GLAD_HOOK_BEGIN(634) call.args[0] = glad_arg_u(array); GLAD_HOOK_PRE result = ((PFNGLISVERTEXARRAYPROC)glad_hook_real[634])(array); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { GLAD_HOOK_BEGIN(635) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_i(first); call.args[2] = glad_arg_i(count); call.args[3] = glad_arg_i(instancecount); GLAD_HOOK_PRE ((PFNGLDRAWARRAYSINSTANCEDPROC)glad_hook_real[635])(mode, first, count, instancecount); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { GLAD_HOOK_BEGIN(636) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(type); call.args[3] = glad_arg_p(indices); call.args[4] = glad_arg_i(instancecount); GLAD_HOOK_PRE ((PFNGLDRAWELEMENTSINSTANCEDPROC)glad_hook_real[636])(mode, count, type, indices, instancecount); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) { GLAD_HOOK_BEGIN(637) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(internalformat); call.args[2] = glad_arg_u(buffer); GLAD_HOOK_PRE ((PFNGLTEXBUFFERPROC)glad_hook_real[637])(target, internalformat, buffer); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glPrimitiveRestartIndex(GLuint index) { GLAD_HOOK_BEGIN(638) call.args[0] = glad_arg_u(index); GLAD_HOOK_PRE ((PFNGLPRIMITIVERESTARTINDEXPROC)glad_hook_real[638])(index); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { GLAD_HOOK_BEGIN(639) call.args[0] = glad_arg_u(readTarget); call.args[1] = glad_arg_u(writeTarget); call.args[2] = glad_arg_i(readOffset); call.args[3] = glad_arg_i(writeOffset); call.args[4] = glad_arg_i(size); GLAD_HOOK_PRE ((PFNGLCOPYBUFFERSUBDATAPROC)glad_hook_real[639])(readTarget, writeTarget, readOffset, writeOffset, size); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) { GLAD_HOOK_BEGIN(640) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_i(uniformCount); call.args[2] = glad_arg_p(uniformNames); call.args[3] = glad_arg_p(uniformIndices); GLAD_HOOK_PRE ((PFNGLGETUNIFORMINDICESPROC)glad_hook_real[640])(program, uniformCount, uniformNames, uniformIndices); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(641) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_i(uniformCount); call.args[2] = glad_arg_p(uniformIndices); call.args[3] = glad_arg_u(pname); call.args[4] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETACTIVEUNIFORMSIVPROC)glad_hook_real[641])(program, uniformCount, uniformIndices, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) { GLAD_HOOK_BEGIN(642) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(uniformIndex); call.args[2] = glad_arg_i(bufSize); call.args[3] = glad_arg_p(length); call.args[4] = glad_arg_p(uniformName); GLAD_HOOK_PRE ((PFNGLGETACTIVEUNIFORMNAMEPROC)glad_hook_real[642])(program, uniformIndex, bufSize, length, uniformName); GLAD_HOOK_POST }
+static GLuint APIENTRY glad_hook_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) { GLuint result; GLAD_HOOK_BEGIN(643) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_p(uniformBlockName); GLAD_HOOK_PRE result = ((PFNGLGETUNIFORMBLOCKINDEXPROC)glad_hook_real[643])(program, uniformBlockName); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(644) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(uniformBlockIndex); call.args[2] = glad_arg_u(pname); call.args[3] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_hook_real[644])(program, uniformBlockIndex, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) { GLAD_HOOK_BEGIN(645) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(uniformBlockIndex); call.args[2] = glad_arg_i(bufSize); call.args[3] = glad_arg_p(length); call.args[4] = glad_arg_p(uniformBlockName); GLAD_HOOK_PRE ((PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_hook_real[645])(program, uniformBlockIndex, bufSize, length, uniformBlockName); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { GLAD_HOOK_BEGIN(646) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(uniformBlockIndex); call.args[2] = glad_arg_u(uniformBlockBinding); GLAD_HOOK_PRE ((PFNGLUNIFORMBLOCKBINDINGPROC)glad_hook_real[646])(program, uniformBlockIndex, uniformBlockBinding); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { GLAD_HOOK_BEGIN(647) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(type); call.args[3] = glad_arg_p(indices); call.args[4] = glad_arg_i(basevertex); GLAD_HOOK_PRE ((PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_hook_real[647])(mode, count, type, indices, basevertex); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) { GLAD_HOOK_BEGIN(648) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_u(start); call.args[2] = glad_arg_u(end); call.args[3] = glad_arg_i(count); call.args[4] = glad_arg_u(type); call.args[5] = glad_arg_p(indices); call.args[6] = glad_arg_i(basevertex); GLAD_HOOK_PRE ((PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_hook_real[648])(mode, start, end, count, type, indices, basevertex); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) { GLAD_HOOK_BEGIN(649) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_i(count); call.args[2] = glad_arg_u(type); call.args[3] = glad_arg_p(indices); call.args[4] = glad_arg_i(instancecount); call.args[5] = glad_arg_i(basevertex); GLAD_HOOK_PRE ((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_hook_real[649])(mode, count, type, indices, instancecount, basevertex); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) { GLAD_HOOK_BEGIN(650) call.args[0] = glad_arg_u(mode); call.args[1] = glad_arg_p(count); call.args[2] = glad_arg_u(type); call.args[3] = glad_arg_p(indices); call.args[4] = glad_arg_i(drawcount); call.args[5] = glad_arg_p(basevertex); GLAD_HOOK_PRE ((PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_hook_real[650])(mode, count, type, indices, drawcount, basevertex); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glProvokingVertex(GLenum mode) { GLAD_HOOK_BEGIN(651) call.args[0] = glad_arg_u(mode); GLAD_HOOK_PRE ((PFNGLPROVOKINGVERTEXPROC)glad_hook_real[651])(mode); GLAD_HOOK_POST }
+static GLsync APIENTRY glad_hook_glFenceSync(GLenum condition, GLbitfield flags) { GLsync result; GLAD_HOOK_BEGIN(652) call.args[0] = glad_arg_u(condition); call.args[1] = glad_arg_u(flags); GLAD_HOOK_PRE result = ((PFNGLFENCESYNCPROC)glad_hook_real[652])(condition, flags); call.result = glad_arg_p(result); GLAD_HOOK_POST return result; }
+static GLboolean APIENTRY glad_hook_glIsSync(GLsync sync) { GLboolean result; GLAD_HOOK_BEGIN(653) call.args[0] = glad_arg_p(sync); GLAD_HOOK_PRE result = ((PFNGLISSYNCPROC)glad_hook_real[653])(sync); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glDeleteSync(GLsync sync) { GLAD_HOOK_BEGIN(654) call.args[0] = glad_arg_p(sync); GLAD_HOOK_PRE ((PFNGLDELETESYNCPROC)glad_hook_real[654])(sync); GLAD_HOOK_POST }
+static GLenum APIENTRY glad_hook_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { GLenum result; GLAD_HOOK_BEGIN(655) call.args[0] = glad_arg_p(sync); call.args[1] = glad_arg_u(flags); call.args[2] = glad_arg_u(timeout); GLAD_HOOK_PRE result = ((PFNGLCLIENTWAITSYNCPROC)glad_hook_real[655])(sync, flags, timeout); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { GLAD_HOOK_BEGIN(656) call.args[0] = glad_arg_p(sync); call.args[1] = glad_arg_u(flags); call.args[2] = glad_arg_u(timeout); GLAD_HOOK_PRE ((PFNGLWAITSYNCPROC)glad_hook_real[656])(sync, flags, timeout); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetInteger64v(GLenum pname, GLint64 *data) { GLAD_HOOK_BEGIN(657) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLGETINTEGER64VPROC)glad_hook_real[657])(pname, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) { GLAD_HOOK_BEGIN(658) call.args[0] = glad_arg_p(sync); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_i(count); call.args[3] = glad_arg_p(length); call.args[4] = glad_arg_p(values); GLAD_HOOK_PRE ((PFNGLGETSYNCIVPROC)glad_hook_real[658])(sync, pname, count, length, values); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) { GLAD_HOOK_BEGIN(659) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(index); call.args[2] = glad_arg_p(data); GLAD_HOOK_PRE ((PFNGLGETINTEGER64I_VPROC)glad_hook_real[659])(target, index, data); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) { GLAD_HOOK_BEGIN(660) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETBUFFERPARAMETERI64VPROC)glad_hook_real[660])(target, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) { GLAD_HOOK_BEGIN(661) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_u(attachment); call.args[2] = glad_arg_u(texture); call.args[3] = glad_arg_i(level); GLAD_HOOK_PRE ((PFNGLFRAMEBUFFERTEXTUREPROC)glad_hook_real[661])(target, attachment, texture, level); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { GLAD_HOOK_BEGIN(662) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(samples); call.args[2] = glad_arg_u(internalformat); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_i(height); call.args[5] = glad_arg_u(fixedsamplelocations); GLAD_HOOK_PRE ((PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_hook_real[662])(target, samples, internalformat, width, height, fixedsamplelocations); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { GLAD_HOOK_BEGIN(663) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(samples); call.args[2] = glad_arg_u(internalformat); call.args[3] = glad_arg_i(width); call.args[4] = glad_arg_i(height); call.args[5] = glad_arg_i(depth); call.args[6] = glad_arg_u(fixedsamplelocations); GLAD_HOOK_PRE ((PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_hook_real[663])(target, samples, internalformat, width, height, depth, fixedsamplelocations); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) { GLAD_HOOK_BEGIN(664) call.args[0] = glad_arg_u(pname); call.args[1] = glad_arg_u(index); call.args[2] = glad_arg_p(val); GLAD_HOOK_PRE ((PFNGLGETMULTISAMPLEFVPROC)glad_hook_real[664])(pname, index, val); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSampleMaski(GLuint maskNumber, GLbitfield mask) { GLAD_HOOK_BEGIN(665) call.args[0] = glad_arg_u(maskNumber); call.args[1] = glad_arg_u(mask); GLAD_HOOK_PRE ((PFNGLSAMPLEMASKIPROC)glad_hook_real[665])(maskNumber, mask); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) { GLAD_HOOK_BEGIN(666) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(colorNumber); call.args[2] = glad_arg_u(index); call.args[3] = glad_arg_p(name); GLAD_HOOK_PRE ((PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_hook_real[666])(program, colorNumber, index, name); GLAD_HOOK_POST }
+static GLint APIENTRY glad_hook_glGetFragDataIndex(GLuint program, const GLchar *name) { GLint result; GLAD_HOOK_BEGIN(667) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_p(name); GLAD_HOOK_PRE result = ((PFNGLGETFRAGDATAINDEXPROC)glad_hook_real[667])(program, name); call.result = glad_arg_i(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glGenSamplers(GLsizei count, GLuint *samplers) { GLAD_HOOK_BEGIN(668) call.args[0] = glad_arg_i(count); call.args[1] = glad_arg_p(samplers); GLAD_HOOK_PRE ((PFNGLGENSAMPLERSPROC)glad_hook_real[668])(count, samplers); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glDeleteSamplers(GLsizei count, const GLuint *samplers) { GLAD_HOOK_BEGIN(669) call.args[0] = glad_arg_i(count); call.args[1] = glad_arg_p(samplers); GLAD_HOOK_PRE ((PFNGLDELETESAMPLERSPROC)glad_hook_real[669])(count, samplers); GLAD_HOOK_POST }
+static GLboolean APIENTRY glad_hook_glIsSampler(GLuint sampler) { GLboolean result; GLAD_HOOK_BEGIN(670) call.args[0] = glad_arg_u(sampler); GLAD_HOOK_PRE result = ((PFNGLISSAMPLERPROC)glad_hook_real[670])(sampler); call.result = glad_arg_u(result); GLAD_HOOK_POST return result; }
+static void APIENTRY glad_hook_glBindSampler(GLuint unit, GLuint sampler) { GLAD_HOOK_BEGIN(671) call.args[0] = glad_arg_u(unit); call.args[1] = glad_arg_u(sampler); GLAD_HOOK_PRE ((PFNGLBINDSAMPLERPROC)glad_hook_real[671])(unit, sampler); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) { GLAD_HOOK_BEGIN(672) call.args[0] = glad_arg_u(sampler); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_i(param); GLAD_HOOK_PRE ((PFNGLSAMPLERPARAMETERIPROC)glad_hook_real[672])(sampler, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) { GLAD_HOOK_BEGIN(673) call.args[0] = glad_arg_u(sampler); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(param); GLAD_HOOK_PRE ((PFNGLSAMPLERPARAMETERIVPROC)glad_hook_real[673])(sampler, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) { GLAD_HOOK_BEGIN(674) call.args[0] = glad_arg_u(sampler); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_f(param); GLAD_HOOK_PRE ((PFNGLSAMPLERPARAMETERFPROC)glad_hook_real[674])(sampler, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) { GLAD_HOOK_BEGIN(675) call.args[0] = glad_arg_u(sampler); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(param); GLAD_HOOK_PRE ((PFNGLSAMPLERPARAMETERFVPROC)glad_hook_real[675])(sampler, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) { GLAD_HOOK_BEGIN(676) call.args[0] = glad_arg_u(sampler); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(param); GLAD_HOOK_PRE ((PFNGLSAMPLERPARAMETERIIVPROC)glad_hook_real[676])(sampler, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) { GLAD_HOOK_BEGIN(677) call.args[0] = glad_arg_u(sampler); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(param); GLAD_HOOK_PRE ((PFNGLSAMPLERPARAMETERIUIVPROC)glad_hook_real[677])(sampler, pname, param); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(678) call.args[0] = glad_arg_u(sampler); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETSAMPLERPARAMETERIVPROC)glad_hook_real[678])(sampler, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) { GLAD_HOOK_BEGIN(679) call.args[0] = glad_arg_u(sampler); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETSAMPLERPARAMETERIIVPROC)glad_hook_real[679])(sampler, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) { GLAD_HOOK_BEGIN(680) call.args[0] = glad_arg_u(sampler); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETSAMPLERPARAMETERFVPROC)glad_hook_real[680])(sampler, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) { GLAD_HOOK_BEGIN(681) call.args[0] = glad_arg_u(sampler); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_hook_real[681])(sampler, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glQueryCounter(GLuint id, GLenum target) { GLAD_HOOK_BEGIN(682) call.args[0] = glad_arg_u(id); call.args[1] = glad_arg_u(target); GLAD_HOOK_PRE ((PFNGLQUERYCOUNTERPROC)glad_hook_real[682])(id, target); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) { GLAD_HOOK_BEGIN(683) call.args[0] = glad_arg_u(id); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETQUERYOBJECTI64VPROC)glad_hook_real[683])(id, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) { GLAD_HOOK_BEGIN(684) call.args[0] = glad_arg_u(id); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_p(params); GLAD_HOOK_PRE ((PFNGLGETQUERYOBJECTUI64VPROC)glad_hook_real[684])(id, pname, params); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribDivisor(GLuint index, GLuint divisor) { GLAD_HOOK_BEGIN(685) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(divisor); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBDIVISORPROC)glad_hook_real[685])(index, divisor); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { GLAD_HOOK_BEGIN(686) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(normalized); call.args[3] = glad_arg_u(value); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBP1UIPROC)glad_hook_real[686])(index, type, normalized, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { GLAD_HOOK_BEGIN(687) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(normalized); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBP1UIVPROC)glad_hook_real[687])(index, type, normalized, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { GLAD_HOOK_BEGIN(688) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(normalized); call.args[3] = glad_arg_u(value); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBP2UIPROC)glad_hook_real[688])(index, type, normalized, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { GLAD_HOOK_BEGIN(689) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(normalized); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBP2UIVPROC)glad_hook_real[689])(index, type, normalized, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { GLAD_HOOK_BEGIN(690) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(normalized); call.args[3] = glad_arg_u(value); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBP3UIPROC)glad_hook_real[690])(index, type, normalized, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { GLAD_HOOK_BEGIN(691) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(normalized); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBP3UIVPROC)glad_hook_real[691])(index, type, normalized, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { GLAD_HOOK_BEGIN(692) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(normalized); call.args[3] = glad_arg_u(value); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBP4UIPROC)glad_hook_real[692])(index, type, normalized, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { GLAD_HOOK_BEGIN(693) call.args[0] = glad_arg_u(index); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(normalized); call.args[3] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLVERTEXATTRIBP4UIVPROC)glad_hook_real[693])(index, type, normalized, value); GLAD_HOOK_POST }
+#ifndef GLAD_CORE_ONLY
+static void APIENTRY glad_hook_glVertexP2ui(GLenum type, GLuint value) { GLAD_HOOK_BEGIN(694) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(value); GLAD_HOOK_PRE ((PFNGLVERTEXP2UIPROC)glad_hook_real[694])(type, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexP2uiv(GLenum type, const GLuint *value) { GLAD_HOOK_BEGIN(695) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLVERTEXP2UIVPROC)glad_hook_real[695])(type, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexP3ui(GLenum type, GLuint value) { GLAD_HOOK_BEGIN(696) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(value); GLAD_HOOK_PRE ((PFNGLVERTEXP3UIPROC)glad_hook_real[696])(type, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexP3uiv(GLenum type, const GLuint *value) { GLAD_HOOK_BEGIN(697) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLVERTEXP3UIVPROC)glad_hook_real[697])(type, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexP4ui(GLenum type, GLuint value) { GLAD_HOOK_BEGIN(698) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(value); GLAD_HOOK_PRE ((PFNGLVERTEXP4UIPROC)glad_hook_real[698])(type, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glVertexP4uiv(GLenum type, const GLuint *value) { GLAD_HOOK_BEGIN(699) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(value); GLAD_HOOK_PRE ((PFNGLVERTEXP4UIVPROC)glad_hook_real[699])(type, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoordP1ui(GLenum type, GLuint coords) { GLAD_HOOK_BEGIN(700) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(coords); GLAD_HOOK_PRE ((PFNGLTEXCOORDP1UIPROC)glad_hook_real[700])(type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoordP1uiv(GLenum type, const GLuint *coords) { GLAD_HOOK_BEGIN(701) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(coords); GLAD_HOOK_PRE ((PFNGLTEXCOORDP1UIVPROC)glad_hook_real[701])(type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoordP2ui(GLenum type, GLuint coords) { GLAD_HOOK_BEGIN(702) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(coords); GLAD_HOOK_PRE ((PFNGLTEXCOORDP2UIPROC)glad_hook_real[702])(type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoordP2uiv(GLenum type, const GLuint *coords) { GLAD_HOOK_BEGIN(703) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(coords); GLAD_HOOK_PRE ((PFNGLTEXCOORDP2UIVPROC)glad_hook_real[703])(type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoordP3ui(GLenum type, GLuint coords) { GLAD_HOOK_BEGIN(704) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(coords); GLAD_HOOK_PRE ((PFNGLTEXCOORDP3UIPROC)glad_hook_real[704])(type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoordP3uiv(GLenum type, const GLuint *coords) { GLAD_HOOK_BEGIN(705) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(coords); GLAD_HOOK_PRE ((PFNGLTEXCOORDP3UIVPROC)glad_hook_real[705])(type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoordP4ui(GLenum type, GLuint coords) { GLAD_HOOK_BEGIN(706) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(coords); GLAD_HOOK_PRE ((PFNGLTEXCOORDP4UIPROC)glad_hook_real[706])(type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glTexCoordP4uiv(GLenum type, const GLuint *coords) { GLAD_HOOK_BEGIN(707) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(coords); GLAD_HOOK_PRE ((PFNGLTEXCOORDP4UIVPROC)glad_hook_real[707])(type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) { GLAD_HOOK_BEGIN(708) call.args[0] = glad_arg_u(texture); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(coords); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORDP1UIPROC)glad_hook_real[708])(texture, type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) { GLAD_HOOK_BEGIN(709) call.args[0] = glad_arg_u(texture); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_p(coords); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORDP1UIVPROC)glad_hook_real[709])(texture, type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) { GLAD_HOOK_BEGIN(710) call.args[0] = glad_arg_u(texture); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(coords); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORDP2UIPROC)glad_hook_real[710])(texture, type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) { GLAD_HOOK_BEGIN(711) call.args[0] = glad_arg_u(texture); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_p(coords); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORDP2UIVPROC)glad_hook_real[711])(texture, type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) { GLAD_HOOK_BEGIN(712) call.args[0] = glad_arg_u(texture); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(coords); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORDP3UIPROC)glad_hook_real[712])(texture, type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) { GLAD_HOOK_BEGIN(713) call.args[0] = glad_arg_u(texture); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_p(coords); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORDP3UIVPROC)glad_hook_real[713])(texture, type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) { GLAD_HOOK_BEGIN(714) call.args[0] = glad_arg_u(texture); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_u(coords); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORDP4UIPROC)glad_hook_real[714])(texture, type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) { GLAD_HOOK_BEGIN(715) call.args[0] = glad_arg_u(texture); call.args[1] = glad_arg_u(type); call.args[2] = glad_arg_p(coords); GLAD_HOOK_PRE ((PFNGLMULTITEXCOORDP4UIVPROC)glad_hook_real[715])(texture, type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormalP3ui(GLenum type, GLuint coords) { GLAD_HOOK_BEGIN(716) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(coords); GLAD_HOOK_PRE ((PFNGLNORMALP3UIPROC)glad_hook_real[716])(type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glNormalP3uiv(GLenum type, const GLuint *coords) { GLAD_HOOK_BEGIN(717) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(coords); GLAD_HOOK_PRE ((PFNGLNORMALP3UIVPROC)glad_hook_real[717])(type, coords); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColorP3ui(GLenum type, GLuint color) { GLAD_HOOK_BEGIN(718) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(color); GLAD_HOOK_PRE ((PFNGLCOLORP3UIPROC)glad_hook_real[718])(type, color); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColorP3uiv(GLenum type, const GLuint *color) { GLAD_HOOK_BEGIN(719) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(color); GLAD_HOOK_PRE ((PFNGLCOLORP3UIVPROC)glad_hook_real[719])(type, color); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColorP4ui(GLenum type, GLuint color) { GLAD_HOOK_BEGIN(720) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(color); GLAD_HOOK_PRE ((PFNGLCOLORP4UIPROC)glad_hook_real[720])(type, color); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glColorP4uiv(GLenum type, const GLuint *color) { GLAD_HOOK_BEGIN(721) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(color); GLAD_HOOK_PRE ((PFNGLCOLORP4UIVPROC)glad_hook_real[721])(type, color); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColorP3ui(GLenum type, GLuint color) { GLAD_HOOK_BEGIN(722) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_u(color); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLORP3UIPROC)glad_hook_real[722])(type, color); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glSecondaryColorP3uiv(GLenum type, const GLuint *color) { GLAD_HOOK_BEGIN(723) call.args[0] = glad_arg_u(type); call.args[1] = glad_arg_p(color); GLAD_HOOK_PRE ((PFNGLSECONDARYCOLORP3UIVPROC)glad_hook_real[723])(type, color); GLAD_HOOK_POST }
+#endif
+static void APIENTRY glad_hook_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) { GLAD_HOOK_BEGIN(724) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_i(bufSize); call.args[2] = glad_arg_p(length); call.args[3] = glad_arg_p(binaryFormat); call.args[4] = glad_arg_p(binary); GLAD_HOOK_PRE ((PFNGLGETPROGRAMBINARYPROC)glad_hook_real[724])(program, bufSize, length, binaryFormat, binary); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) { GLAD_HOOK_BEGIN(725) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(binaryFormat); call.args[2] = glad_arg_p(binary); call.args[3] = glad_arg_i(length); GLAD_HOOK_PRE ((PFNGLPROGRAMBINARYPROC)glad_hook_real[725])(program, binaryFormat, binary, length); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glProgramParameteri(GLuint program, GLenum pname, GLint value) { GLAD_HOOK_BEGIN(726) call.args[0] = glad_arg_u(program); call.args[1] = glad_arg_u(pname); call.args[2] = glad_arg_i(value); GLAD_HOOK_PRE ((PFNGLPROGRAMPARAMETERIPROC)glad_hook_real[726])(program, pname, value); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glMaxShaderCompilerThreadsKHR(GLuint count) { GLAD_HOOK_BEGIN(727) call.args[0] = glad_arg_u(count); GLAD_HOOK_PRE ((PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glad_hook_real[727])(count); GLAD_HOOK_POST }
+static void APIENTRY glad_hook_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) { GLAD_HOOK_BEGIN(728) call.args[0] = glad_arg_u(target); call.args[1] = glad_arg_i(size); call.args[2] = glad_arg_p(data); call.args[3] = glad_arg_u(flags); GLAD_HOOK_PRE ((PFNGLBUFFERSTORAGEPROC)glad_hook_real[728])(target, size, data, flags); GLAD_HOOK_POST }
+
+#define GLAD_HOOK_SWAP(hookIndex, hookName, pfn) \
+	if(install) { \
+		if(glad_##hookName != NULL && glad_##hookName != glad_hook_##hookName) { \
+			glad_hook_real[hookIndex] = (void*)glad_##hookName; \
+			glad_##hookName = glad_hook_##hookName; \
+		} \
+	} else if(glad_##hookName == glad_hook_##hookName) { \
+		glad_##hookName = (pfn)glad_hook_real[hookIndex]; \
+	}
+
+static void swap_hooks(int install) {
+	GLAD_HOOK_SWAP(0, glCullFace, PFNGLCULLFACEPROC)
+	GLAD_HOOK_SWAP(1, glFrontFace, PFNGLFRONTFACEPROC)
+	GLAD_HOOK_SWAP(2, glHint, PFNGLHINTPROC)
+	GLAD_HOOK_SWAP(3, glLineWidth, PFNGLLINEWIDTHPROC)
+	GLAD_HOOK_SWAP(4, glPointSize, PFNGLPOINTSIZEPROC)
+	GLAD_HOOK_SWAP(5, glPolygonMode, PFNGLPOLYGONMODEPROC)
+	GLAD_HOOK_SWAP(6, glScissor, PFNGLSCISSORPROC)
+	GLAD_HOOK_SWAP(7, glTexParameterf, PFNGLTEXPARAMETERFPROC)
+	GLAD_HOOK_SWAP(8, glTexParameterfv, PFNGLTEXPARAMETERFVPROC)
+	GLAD_HOOK_SWAP(9, glTexParameteri, PFNGLTEXPARAMETERIPROC)
+	GLAD_HOOK_SWAP(10, glTexParameteriv, PFNGLTEXPARAMETERIVPROC)
+	GLAD_HOOK_SWAP(11, glTexImage1D, PFNGLTEXIMAGE1DPROC)
+	GLAD_HOOK_SWAP(12, glTexImage2D, PFNGLTEXIMAGE2DPROC)
+	GLAD_HOOK_SWAP(13, glDrawBuffer, PFNGLDRAWBUFFERPROC)
+	GLAD_HOOK_SWAP(14, glClear, PFNGLCLEARPROC)
+	GLAD_HOOK_SWAP(15, glClearColor, PFNGLCLEARCOLORPROC)
+	GLAD_HOOK_SWAP(16, glClearStencil, PFNGLCLEARSTENCILPROC)
+	GLAD_HOOK_SWAP(17, glClearDepth, PFNGLCLEARDEPTHPROC)
+	GLAD_HOOK_SWAP(18, glStencilMask, PFNGLSTENCILMASKPROC)
+	GLAD_HOOK_SWAP(19, glColorMask, PFNGLCOLORMASKPROC)
+	GLAD_HOOK_SWAP(20, glDepthMask, PFNGLDEPTHMASKPROC)
+	GLAD_HOOK_SWAP(21, glDisable, PFNGLDISABLEPROC)
+	GLAD_HOOK_SWAP(22, glEnable, PFNGLENABLEPROC)
+	GLAD_HOOK_SWAP(23, glFinish, PFNGLFINISHPROC)
+	GLAD_HOOK_SWAP(24, glFlush, PFNGLFLUSHPROC)
+	GLAD_HOOK_SWAP(25, glBlendFunc, PFNGLBLENDFUNCPROC)
+	GLAD_HOOK_SWAP(26, glLogicOp, PFNGLLOGICOPPROC)
+	GLAD_HOOK_SWAP(27, glStencilFunc, PFNGLSTENCILFUNCPROC)
+	GLAD_HOOK_SWAP(28, glStencilOp, PFNGLSTENCILOPPROC)
+	GLAD_HOOK_SWAP(29, glDepthFunc, PFNGLDEPTHFUNCPROC)
+	GLAD_HOOK_SWAP(30, glPixelStoref, PFNGLPIXELSTOREFPROC)
+	GLAD_HOOK_SWAP(31, glPixelStorei, PFNGLPIXELSTOREIPROC)
+	GLAD_HOOK_SWAP(32, glReadBuffer, PFNGLREADBUFFERPROC)
+	GLAD_HOOK_SWAP(33, glReadPixels, PFNGLREADPIXELSPROC)
+	GLAD_HOOK_SWAP(34, glGetBooleanv, PFNGLGETBOOLEANVPROC)
+	GLAD_HOOK_SWAP(35, glGetDoublev, PFNGLGETDOUBLEVPROC)
+	GLAD_HOOK_SWAP(36, glGetError, PFNGLGETERRORPROC)
+	GLAD_HOOK_SWAP(37, glGetFloatv, PFNGLGETFLOATVPROC)
+	GLAD_HOOK_SWAP(38, glGetIntegerv, PFNGLGETINTEGERVPROC)
+	GLAD_HOOK_SWAP(39, glGetString, PFNGLGETSTRINGPROC)
+	GLAD_HOOK_SWAP(40, glGetTexImage, PFNGLGETTEXIMAGEPROC)
+	GLAD_HOOK_SWAP(41, glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC)
+	GLAD_HOOK_SWAP(42, glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC)
+	GLAD_HOOK_SWAP(43, glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC)
+	GLAD_HOOK_SWAP(44, glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC)
+	GLAD_HOOK_SWAP(45, glIsEnabled, PFNGLISENABLEDPROC)
+	GLAD_HOOK_SWAP(46, glDepthRange, PFNGLDEPTHRANGEPROC)
+	GLAD_HOOK_SWAP(47, glViewport, PFNGLVIEWPORTPROC)
+#ifndef GLAD_CORE_ONLY
+	GLAD_HOOK_SWAP(48, glNewList, PFNGLNEWLISTPROC)
+	GLAD_HOOK_SWAP(49, glEndList, PFNGLENDLISTPROC)
+	GLAD_HOOK_SWAP(50, glCallList, PFNGLCALLLISTPROC)
+	GLAD_HOOK_SWAP(51, glCallLists, PFNGLCALLLISTSPROC)
+	GLAD_HOOK_SWAP(52, glDeleteLists, PFNGLDELETELISTSPROC)
+	GLAD_HOOK_SWAP(53, glGenLists, PFNGLGENLISTSPROC)
+	GLAD_HOOK_SWAP(54, glListBase, PFNGLLISTBASEPROC)
+	GLAD_HOOK_SWAP(55, glBegin, PFNGLBEGINPROC)
+	GLAD_HOOK_SWAP(56, glBitmap, PFNGLBITMAPPROC)
+	GLAD_HOOK_SWAP(57, glColor3b, PFNGLCOLOR3BPROC)
+	GLAD_HOOK_SWAP(58, glColor3bv, PFNGLCOLOR3BVPROC)
+	GLAD_HOOK_SWAP(59, glColor3d, PFNGLCOLOR3DPROC)
+	GLAD_HOOK_SWAP(60, glColor3dv, PFNGLCOLOR3DVPROC)
+	GLAD_HOOK_SWAP(61, glColor3f, PFNGLCOLOR3FPROC)
+	GLAD_HOOK_SWAP(62, glColor3fv, PFNGLCOLOR3FVPROC)
+	GLAD_HOOK_SWAP(63, glColor3i, PFNGLCOLOR3IPROC)
+	GLAD_HOOK_SWAP(64, glColor3iv, PFNGLCOLOR3IVPROC)
+	GLAD_HOOK_SWAP(65, glColor3s, PFNGLCOLOR3SPROC)
+	GLAD_HOOK_SWAP(66, glColor3sv, PFNGLCOLOR3SVPROC)
+	GLAD_HOOK_SWAP(67, glColor3ub, PFNGLCOLOR3UBPROC)
+	GLAD_HOOK_SWAP(68, glColor3ubv, PFNGLCOLOR3UBVPROC)
+	GLAD_HOOK_SWAP(69, glColor3ui, PFNGLCOLOR3UIPROC)
+	GLAD_HOOK_SWAP(70, glColor3uiv, PFNGLCOLOR3UIVPROC)
+	GLAD_HOOK_SWAP(71, glColor3us, PFNGLCOLOR3USPROC)
+	GLAD_HOOK_SWAP(72, glColor3usv, PFNGLCOLOR3USVPROC)
+	GLAD_HOOK_SWAP(73, glColor4b, PFNGLCOLOR4BPROC)
+	GLAD_HOOK_SWAP(74, glColor4bv, PFNGLCOLOR4BVPROC)
+	GLAD_HOOK_SWAP(75, glColor4d, PFNGLCOLOR4DPROC)
+	GLAD_HOOK_SWAP(76, glColor4dv, PFNGLCOLOR4DVPROC)
+	GLAD_HOOK_SWAP(77, glColor4f, PFNGLCOLOR4FPROC)
+	GLAD_HOOK_SWAP(78, glColor4fv, PFNGLCOLOR4FVPROC)
+	GLAD_HOOK_SWAP(79, glColor4i, PFNGLCOLOR4IPROC)
+	GLAD_HOOK_SWAP(80, glColor4iv, PFNGLCOLOR4IVPROC)
+	GLAD_HOOK_SWAP(81, glColor4s, PFNGLCOLOR4SPROC)
+	GLAD_HOOK_SWAP(82, glColor4sv, PFNGLCOLOR4SVPROC)
+	GLAD_HOOK_SWAP(83, glColor4ub, PFNGLCOLOR4UBPROC)
+	GLAD_HOOK_SWAP(84, glColor4ubv, PFNGLCOLOR4UBVPROC)
+	GLAD_HOOK_SWAP(85, glColor4ui, PFNGLCOLOR4UIPROC)
+	GLAD_HOOK_SWAP(86, glColor4uiv, PFNGLCOLOR4UIVPROC)
+	GLAD_HOOK_SWAP(87, glColor4us, PFNGLCOLOR4USPROC)
+	GLAD_HOOK_SWAP(88, glColor4usv, PFNGLCOLOR4USVPROC)
+	GLAD_HOOK_SWAP(89, glEdgeFlag, PFNGLEDGEFLAGPROC)
+	GLAD_HOOK_SWAP(90, glEdgeFlagv, PFNGLEDGEFLAGVPROC)
+	GLAD_HOOK_SWAP(91, glEnd, PFNGLENDPROC)
+	GLAD_HOOK_SWAP(92, glIndexd, PFNGLINDEXDPROC)
+	GLAD_HOOK_SWAP(93, glIndexdv, PFNGLINDEXDVPROC)
+	GLAD_HOOK_SWAP(94, glIndexf, PFNGLINDEXFPROC)
+	GLAD_HOOK_SWAP(95, glIndexfv, PFNGLINDEXFVPROC)
+	GLAD_HOOK_SWAP(96, glIndexi, PFNGLINDEXIPROC)
+	GLAD_HOOK_SWAP(97, glIndexiv, PFNGLINDEXIVPROC)
+	GLAD_HOOK_SWAP(98, glIndexs, PFNGLINDEXSPROC)
+	GLAD_HOOK_SWAP(99, glIndexsv, PFNGLINDEXSVPROC)
+	GLAD_HOOK_SWAP(100, glNormal3b, PFNGLNORMAL3BPROC)
+	GLAD_HOOK_SWAP(101, glNormal3bv, PFNGLNORMAL3BVPROC)
+	GLAD_HOOK_SWAP(102, glNormal3d, PFNGLNORMAL3DPROC)
+	GLAD_HOOK_SWAP(103, glNormal3dv, PFNGLNORMAL3DVPROC)
+	GLAD_HOOK_SWAP(104, glNormal3f, PFNGLNORMAL3FPROC)
+	GLAD_HOOK_SWAP(105, glNormal3fv, PFNGLNORMAL3FVPROC)
+	GLAD_HOOK_SWAP(106, glNormal3i, PFNGLNORMAL3IPROC)
+	GLAD_HOOK_SWAP(107, glNormal3iv, PFNGLNORMAL3IVPROC)
+	GLAD_HOOK_SWAP(108, glNormal3s, PFNGLNORMAL3SPROC)
+	GLAD_HOOK_SWAP(109, glNormal3sv, PFNGLNORMAL3SVPROC)
+	GLAD_HOOK_SWAP(110, glRasterPos2d, PFNGLRASTERPOS2DPROC)
+	GLAD_HOOK_SWAP(111, glRasterPos2dv, PFNGLRASTERPOS2DVPROC)
+	GLAD_HOOK_SWAP(112, glRasterPos2f, PFNGLRASTERPOS2FPROC)
+	GLAD_HOOK_SWAP(113, glRasterPos2fv, PFNGLRASTERPOS2FVPROC)
+	GLAD_HOOK_SWAP(114, glRasterPos2i, PFNGLRASTERPOS2IPROC)
+	GLAD_HOOK_SWAP(115, glRasterPos2iv, PFNGLRASTERPOS2IVPROC)
+	GLAD_HOOK_SWAP(116, glRasterPos2s, PFNGLRASTERPOS2SPROC)
+	GLAD_HOOK_SWAP(117, glRasterPos2sv, PFNGLRASTERPOS2SVPROC)
+	GLAD_HOOK_SWAP(118, glRasterPos3d, PFNGLRASTERPOS3DPROC)
+	GLAD_HOOK_SWAP(119, glRasterPos3dv, PFNGLRASTERPOS3DVPROC)
+	GLAD_HOOK_SWAP(120, glRasterPos3f, PFNGLRASTERPOS3FPROC)
+	GLAD_HOOK_SWAP(121, glRasterPos3fv, PFNGLRASTERPOS3FVPROC)
+	GLAD_HOOK_SWAP(122, glRasterPos3i, PFNGLRASTERPOS3IPROC)
+	GLAD_HOOK_SWAP(123, glRasterPos3iv, PFNGLRASTERPOS3IVPROC)
+	GLAD_HOOK_SWAP(124, glRasterPos3s, PFNGLRASTERPOS3SPROC)
+	GLAD_HOOK_SWAP(125, glRasterPos3sv, PFNGLRASTERPOS3SVPROC)
+	GLAD_HOOK_SWAP(126, glRasterPos4d, PFNGLRASTERPOS4DPROC)
+	GLAD_HOOK_SWAP(127, glRasterPos4dv, PFNGLRASTERPOS4DVPROC)
+	GLAD_HOOK_SWAP(128, glRasterPos4f, PFNGLRASTERPOS4FPROC)
+	GLAD_HOOK_SWAP(129, glRasterPos4fv, PFNGLRASTERPOS4FVPROC)
+	GLAD_HOOK_SWAP(130, glRasterPos4i, PFNGLRASTERPOS4IPROC)
+	GLAD_HOOK_SWAP(131, glRasterPos4iv, PFNGLRASTERPOS4IVPROC)
+	GLAD_HOOK_SWAP(132, glRasterPos4s, PFNGLRASTERPOS4SPROC)
+	GLAD_HOOK_SWAP(133, glRasterPos4sv, PFNGLRASTERPOS4SVPROC)
+	GLAD_HOOK_SWAP(134, glRectd, PFNGLRECTDPROC)
+	GLAD_HOOK_SWAP(135, glRectdv, PFNGLRECTDVPROC)
+	GLAD_HOOK_SWAP(136, glRectf, PFNGLRECTFPROC)
+	GLAD_HOOK_SWAP(137, glRectfv, PFNGLRECTFVPROC)
+	GLAD_HOOK_SWAP(138, glRecti, PFNGLRECTIPROC)
+	GLAD_HOOK_SWAP(139, glRectiv, PFNGLRECTIVPROC)
+	GLAD_HOOK_SWAP(140, glRects, PFNGLRECTSPROC)
+	GLAD_HOOK_SWAP(141, glRectsv, PFNGLRECTSVPROC)
+	GLAD_HOOK_SWAP(142, glTexCoord1d, PFNGLTEXCOORD1DPROC)
+	GLAD_HOOK_SWAP(143, glTexCoord1dv, PFNGLTEXCOORD1DVPROC)
+	GLAD_HOOK_SWAP(144, glTexCoord1f, PFNGLTEXCOORD1FPROC)
+	GLAD_HOOK_SWAP(145, glTexCoord1fv, PFNGLTEXCOORD1FVPROC)
+	GLAD_HOOK_SWAP(146, glTexCoord1i, PFNGLTEXCOORD1IPROC)
+	GLAD_HOOK_SWAP(147, glTexCoord1iv, PFNGLTEXCOORD1IVPROC)
+	GLAD_HOOK_SWAP(148, glTexCoord1s, PFNGLTEXCOORD1SPROC)
+	GLAD_HOOK_SWAP(149, glTexCoord1sv, PFNGLTEXCOORD1SVPROC)
+	GLAD_HOOK_SWAP(150, glTexCoord2d, PFNGLTEXCOORD2DPROC)
+	GLAD_HOOK_SWAP(151, glTexCoord2dv, PFNGLTEXCOORD2DVPROC)
+	GLAD_HOOK_SWAP(152, glTexCoord2f, PFNGLTEXCOORD2FPROC)
+	GLAD_HOOK_SWAP(153, glTexCoord2fv, PFNGLTEXCOORD2FVPROC)
+	GLAD_HOOK_SWAP(154, glTexCoord2i, PFNGLTEXCOORD2IPROC)
+	GLAD_HOOK_SWAP(155, glTexCoord2iv, PFNGLTEXCOORD2IVPROC)
+	GLAD_HOOK_SWAP(156, glTexCoord2s, PFNGLTEXCOORD2SPROC)
+	GLAD_HOOK_SWAP(157, glTexCoord2sv, PFNGLTEXCOORD2SVPROC)
+	GLAD_HOOK_SWAP(158, glTexCoord3d, PFNGLTEXCOORD3DPROC)
+	GLAD_HOOK_SWAP(159, glTexCoord3dv, PFNGLTEXCOORD3DVPROC)
+	GLAD_HOOK_SWAP(160, glTexCoord3f, PFNGLTEXCOORD3FPROC)
+	GLAD_HOOK_SWAP(161, glTexCoord3fv, PFNGLTEXCOORD3FVPROC)
+	GLAD_HOOK_SWAP(162, glTexCoord3i, PFNGLTEXCOORD3IPROC)
+	GLAD_HOOK_SWAP(163, glTexCoord3iv, PFNGLTEXCOORD3IVPROC)
+	GLAD_HOOK_SWAP(164, glTexCoord3s, PFNGLTEXCOORD3SPROC)
+	GLAD_HOOK_SWAP(165, glTexCoord3sv, PFNGLTEXCOORD3SVPROC)
+	GLAD_HOOK_SWAP(166, glTexCoord4d, PFNGLTEXCOORD4DPROC)
+	GLAD_HOOK_SWAP(167, glTexCoord4dv, PFNGLTEXCOORD4DVPROC)
+	GLAD_HOOK_SWAP(168, glTexCoord4f, PFNGLTEXCOORD4FPROC)
+	GLAD_HOOK_SWAP(169, glTexCoord4fv, PFNGLTEXCOORD4FVPROC)
+	GLAD_HOOK_SWAP(170, glTexCoord4i, PFNGLTEXCOORD4IPROC)
+	GLAD_HOOK_SWAP(171, glTexCoord4iv, PFNGLTEXCOORD4IVPROC)
+	GLAD_HOOK_SWAP(172, glTexCoord4s, PFNGLTEXCOORD4SPROC)
+	GLAD_HOOK_SWAP(173, glTexCoord4sv, PFNGLTEXCOORD4SVPROC)
+	GLAD_HOOK_SWAP(174, glVertex2d, PFNGLVERTEX2DPROC)
+	GLAD_HOOK_SWAP(175, glVertex2dv, PFNGLVERTEX2DVPROC)
+	GLAD_HOOK_SWAP(176, glVertex2f, PFNGLVERTEX2FPROC)
+	GLAD_HOOK_SWAP(177, glVertex2fv, PFNGLVERTEX2FVPROC)
+	GLAD_HOOK_SWAP(178, glVertex2i, PFNGLVERTEX2IPROC)
+	GLAD_HOOK_SWAP(179, glVertex2iv, PFNGLVERTEX2IVPROC)
+	GLAD_HOOK_SWAP(180, glVertex2s, PFNGLVERTEX2SPROC)
+	GLAD_HOOK_SWAP(181, glVertex2sv, PFNGLVERTEX2SVPROC)
+	GLAD_HOOK_SWAP(182, glVertex3d, PFNGLVERTEX3DPROC)
+	GLAD_HOOK_SWAP(183, glVertex3dv, PFNGLVERTEX3DVPROC)
+	GLAD_HOOK_SWAP(184, glVertex3f, PFNGLVERTEX3FPROC)
+	GLAD_HOOK_SWAP(185, glVertex3fv, PFNGLVERTEX3FVPROC)
+	GLAD_HOOK_SWAP(186, glVertex3i, PFNGLVERTEX3IPROC)
+	GLAD_HOOK_SWAP(187, glVertex3iv, PFNGLVERTEX3IVPROC)
+	GLAD_HOOK_SWAP(188, glVertex3s, PFNGLVERTEX3SPROC)
+	GLAD_HOOK_SWAP(189, glVertex3sv, PFNGLVERTEX3SVPROC)
+	GLAD_HOOK_SWAP(190, glVertex4d, PFNGLVERTEX4DPROC)
+	GLAD_HOOK_SWAP(191, glVertex4dv, PFNGLVERTEX4DVPROC)
+	GLAD_HOOK_SWAP(192, glVertex4f, PFNGLVERTEX4FPROC)
+	GLAD_HOOK_SWAP(193, glVertex4fv, PFNGLVERTEX4FVPROC)
+	GLAD_HOOK_SWAP(194, glVertex4i, PFNGLVERTEX4IPROC)
+	GLAD_HOOK_SWAP(195, glVertex4iv, PFNGLVERTEX4IVPROC)
+	GLAD_HOOK_SWAP(196, glVertex4s, PFNGLVERTEX4SPROC)
+	GLAD_HOOK_SWAP(197, glVertex4sv, PFNGLVERTEX4SVPROC)
+	GLAD_HOOK_SWAP(198, glClipPlane, PFNGLCLIPPLANEPROC)
+	GLAD_HOOK_SWAP(199, glColorMaterial, PFNGLCOLORMATERIALPROC)
+	GLAD_HOOK_SWAP(200, glFogf, PFNGLFOGFPROC)
+	GLAD_HOOK_SWAP(201, glFogfv, PFNGLFOGFVPROC)
+	GLAD_HOOK_SWAP(202, glFogi, PFNGLFOGIPROC)
+	GLAD_HOOK_SWAP(203, glFogiv, PFNGLFOGIVPROC)
+	GLAD_HOOK_SWAP(204, glLightf, PFNGLLIGHTFPROC)
+	GLAD_HOOK_SWAP(205, glLightfv, PFNGLLIGHTFVPROC)
+	GLAD_HOOK_SWAP(206, glLighti, PFNGLLIGHTIPROC)
+	GLAD_HOOK_SWAP(207, glLightiv, PFNGLLIGHTIVPROC)
+	GLAD_HOOK_SWAP(208, glLightModelf, PFNGLLIGHTMODELFPROC)
+	GLAD_HOOK_SWAP(209, glLightModelfv, PFNGLLIGHTMODELFVPROC)
+	GLAD_HOOK_SWAP(210, glLightModeli, PFNGLLIGHTMODELIPROC)
+	GLAD_HOOK_SWAP(211, glLightModeliv, PFNGLLIGHTMODELIVPROC)
+	GLAD_HOOK_SWAP(212, glLineStipple, PFNGLLINESTIPPLEPROC)
+	GLAD_HOOK_SWAP(213, glMaterialf, PFNGLMATERIALFPROC)
+	GLAD_HOOK_SWAP(214, glMaterialfv, PFNGLMATERIALFVPROC)
+	GLAD_HOOK_SWAP(215, glMateriali, PFNGLMATERIALIPROC)
+	GLAD_HOOK_SWAP(216, glMaterialiv, PFNGLMATERIALIVPROC)
+	GLAD_HOOK_SWAP(217, glPolygonStipple, PFNGLPOLYGONSTIPPLEPROC)
+	GLAD_HOOK_SWAP(218, glShadeModel, PFNGLSHADEMODELPROC)
+	GLAD_HOOK_SWAP(219, glTexEnvf, PFNGLTEXENVFPROC)
+	GLAD_HOOK_SWAP(220, glTexEnvfv, PFNGLTEXENVFVPROC)
+	GLAD_HOOK_SWAP(221, glTexEnvi, PFNGLTEXENVIPROC)
+	GLAD_HOOK_SWAP(222, glTexEnviv, PFNGLTEXENVIVPROC)
+	GLAD_HOOK_SWAP(223, glTexGend, PFNGLTEXGENDPROC)
+	GLAD_HOOK_SWAP(224, glTexGendv, PFNGLTEXGENDVPROC)
+	GLAD_HOOK_SWAP(225, glTexGenf, PFNGLTEXGENFPROC)
+	GLAD_HOOK_SWAP(226, glTexGenfv, PFNGLTEXGENFVPROC)
+	GLAD_HOOK_SWAP(227, glTexGeni, PFNGLTEXGENIPROC)
+	GLAD_HOOK_SWAP(228, glTexGeniv, PFNGLTEXGENIVPROC)
+	GLAD_HOOK_SWAP(229, glFeedbackBuffer, PFNGLFEEDBACKBUFFERPROC)
+	GLAD_HOOK_SWAP(230, glSelectBuffer, PFNGLSELECTBUFFERPROC)
+	GLAD_HOOK_SWAP(231, glRenderMode, PFNGLRENDERMODEPROC)
+	GLAD_HOOK_SWAP(232, glInitNames, PFNGLINITNAMESPROC)
+	GLAD_HOOK_SWAP(233, glLoadName, PFNGLLOADNAMEPROC)
+	GLAD_HOOK_SWAP(234, glPassThrough, PFNGLPASSTHROUGHPROC)
+	GLAD_HOOK_SWAP(235, glPopName, PFNGLPOPNAMEPROC)
+	GLAD_HOOK_SWAP(236, glPushName, PFNGLPUSHNAMEPROC)
+	GLAD_HOOK_SWAP(237, glClearAccum, PFNGLCLEARACCUMPROC)
+	GLAD_HOOK_SWAP(238, glClearIndex, PFNGLCLEARINDEXPROC)
+	GLAD_HOOK_SWAP(239, glIndexMask, PFNGLINDEXMASKPROC)
+	GLAD_HOOK_SWAP(240, glAccum, PFNGLACCUMPROC)
+	GLAD_HOOK_SWAP(241, glPopAttrib, PFNGLPOPATTRIBPROC)
+	GLAD_HOOK_SWAP(242, glPushAttrib, PFNGLPUSHATTRIBPROC)
+	GLAD_HOOK_SWAP(243, glMap1d, PFNGLMAP1DPROC)
+	GLAD_HOOK_SWAP(244, glMap1f, PFNGLMAP1FPROC)
+	GLAD_HOOK_SWAP(245, glMap2d, PFNGLMAP2DPROC)
+	GLAD_HOOK_SWAP(246, glMap2f, PFNGLMAP2FPROC)
+	GLAD_HOOK_SWAP(247, glMapGrid1d, PFNGLMAPGRID1DPROC)
+	GLAD_HOOK_SWAP(248, glMapGrid1f, PFNGLMAPGRID1FPROC)
+	GLAD_HOOK_SWAP(249, glMapGrid2d, PFNGLMAPGRID2DPROC)
+	GLAD_HOOK_SWAP(250, glMapGrid2f, PFNGLMAPGRID2FPROC)
+	GLAD_HOOK_SWAP(251, glEvalCoord1d, PFNGLEVALCOORD1DPROC)
+	GLAD_HOOK_SWAP(252, glEvalCoord1dv, PFNGLEVALCOORD1DVPROC)
+	GLAD_HOOK_SWAP(253, glEvalCoord1f, PFNGLEVALCOORD1FPROC)
+	GLAD_HOOK_SWAP(254, glEvalCoord1fv, PFNGLEVALCOORD1FVPROC)
+	GLAD_HOOK_SWAP(255, glEvalCoord2d, PFNGLEVALCOORD2DPROC)
+	GLAD_HOOK_SWAP(256, glEvalCoord2dv, PFNGLEVALCOORD2DVPROC)
+	GLAD_HOOK_SWAP(257, glEvalCoord2f, PFNGLEVALCOORD2FPROC)
+	GLAD_HOOK_SWAP(258, glEvalCoord2fv, PFNGLEVALCOORD2FVPROC)
+	GLAD_HOOK_SWAP(259, glEvalMesh1, PFNGLEVALMESH1PROC)
+	GLAD_HOOK_SWAP(260, glEvalPoint1, PFNGLEVALPOINT1PROC)
+	GLAD_HOOK_SWAP(261, glEvalMesh2, PFNGLEVALMESH2PROC)
+	GLAD_HOOK_SWAP(262, glEvalPoint2, PFNGLEVALPOINT2PROC)
+	GLAD_HOOK_SWAP(263, glAlphaFunc, PFNGLALPHAFUNCPROC)
+	GLAD_HOOK_SWAP(264, glPixelZoom, PFNGLPIXELZOOMPROC)
+	GLAD_HOOK_SWAP(265, glPixelTransferf, PFNGLPIXELTRANSFERFPROC)
+	GLAD_HOOK_SWAP(266, glPixelTransferi, PFNGLPIXELTRANSFERIPROC)
+	GLAD_HOOK_SWAP(267, glPixelMapfv, PFNGLPIXELMAPFVPROC)
+	GLAD_HOOK_SWAP(268, glPixelMapuiv, PFNGLPIXELMAPUIVPROC)
+	GLAD_HOOK_SWAP(269, glPixelMapusv, PFNGLPIXELMAPUSVPROC)
+	GLAD_HOOK_SWAP(270, glCopyPixels, PFNGLCOPYPIXELSPROC)
+	GLAD_HOOK_SWAP(271, glDrawPixels, PFNGLDRAWPIXELSPROC)
+	GLAD_HOOK_SWAP(272, glGetClipPlane, PFNGLGETCLIPPLANEPROC)
+	GLAD_HOOK_SWAP(273, glGetLightfv, PFNGLGETLIGHTFVPROC)
+	GLAD_HOOK_SWAP(274, glGetLightiv, PFNGLGETLIGHTIVPROC)
+	GLAD_HOOK_SWAP(275, glGetMapdv, PFNGLGETMAPDVPROC)
+	GLAD_HOOK_SWAP(276, glGetMapfv, PFNGLGETMAPFVPROC)
+	GLAD_HOOK_SWAP(277, glGetMapiv, PFNGLGETMAPIVPROC)
+	GLAD_HOOK_SWAP(278, glGetMaterialfv, PFNGLGETMATERIALFVPROC)
+	GLAD_HOOK_SWAP(279, glGetMaterialiv, PFNGLGETMATERIALIVPROC)
+	GLAD_HOOK_SWAP(280, glGetPixelMapfv, PFNGLGETPIXELMAPFVPROC)
+	GLAD_HOOK_SWAP(281, glGetPixelMapuiv, PFNGLGETPIXELMAPUIVPROC)
+	GLAD_HOOK_SWAP(282, glGetPixelMapusv, PFNGLGETPIXELMAPUSVPROC)
+	GLAD_HOOK_SWAP(283, glGetPolygonStipple, PFNGLGETPOLYGONSTIPPLEPROC)
+	GLAD_HOOK_SWAP(284, glGetTexEnvfv, PFNGLGETTEXENVFVPROC)
+	GLAD_HOOK_SWAP(285, glGetTexEnviv, PFNGLGETTEXENVIVPROC)
+	GLAD_HOOK_SWAP(286, glGetTexGendv, PFNGLGETTEXGENDVPROC)
+	GLAD_HOOK_SWAP(287, glGetTexGenfv, PFNGLGETTEXGENFVPROC)
+	GLAD_HOOK_SWAP(288, glGetTexGeniv, PFNGLGETTEXGENIVPROC)
+	GLAD_HOOK_SWAP(289, glIsList, PFNGLISLISTPROC)
+	GLAD_HOOK_SWAP(290, glFrustum, PFNGLFRUSTUMPROC)
+	GLAD_HOOK_SWAP(291, glLoadIdentity, PFNGLLOADIDENTITYPROC)
+	GLAD_HOOK_SWAP(292, glLoadMatrixf, PFNGLLOADMATRIXFPROC)
+	GLAD_HOOK_SWAP(293, glLoadMatrixd, PFNGLLOADMATRIXDPROC)
+	GLAD_HOOK_SWAP(294, glMatrixMode, PFNGLMATRIXMODEPROC)
+	GLAD_HOOK_SWAP(295, glMultMatrixf, PFNGLMULTMATRIXFPROC)
+	GLAD_HOOK_SWAP(296, glMultMatrixd, PFNGLMULTMATRIXDPROC)
+	GLAD_HOOK_SWAP(297, glOrtho, PFNGLORTHOPROC)
+	GLAD_HOOK_SWAP(298, glPopMatrix, PFNGLPOPMATRIXPROC)
+	GLAD_HOOK_SWAP(299, glPushMatrix, PFNGLPUSHMATRIXPROC)
+	GLAD_HOOK_SWAP(300, glRotated, PFNGLROTATEDPROC)
+	GLAD_HOOK_SWAP(301, glRotatef, PFNGLROTATEFPROC)
+	GLAD_HOOK_SWAP(302, glScaled, PFNGLSCALEDPROC)
+	GLAD_HOOK_SWAP(303, glScalef, PFNGLSCALEFPROC)
+	GLAD_HOOK_SWAP(304, glTranslated, PFNGLTRANSLATEDPROC)
+	GLAD_HOOK_SWAP(305, glTranslatef, PFNGLTRANSLATEFPROC)
+#endif
+	GLAD_HOOK_SWAP(306, glDrawArrays, PFNGLDRAWARRAYSPROC)
+	GLAD_HOOK_SWAP(307, glDrawElements, PFNGLDRAWELEMENTSPROC)
+	GLAD_HOOK_SWAP(308, glGetPointerv, PFNGLGETPOINTERVPROC)
+	GLAD_HOOK_SWAP(309, glPolygonOffset, PFNGLPOLYGONOFFSETPROC)
+	GLAD_HOOK_SWAP(310, glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC)
+	GLAD_HOOK_SWAP(311, glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC)
+	GLAD_HOOK_SWAP(312, glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC)
+	GLAD_HOOK_SWAP(313, glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC)
+	GLAD_HOOK_SWAP(314, glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC)
+	GLAD_HOOK_SWAP(315, glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC)
+	GLAD_HOOK_SWAP(316, glBindTexture, PFNGLBINDTEXTUREPROC)
+	GLAD_HOOK_SWAP(317, glDeleteTextures, PFNGLDELETETEXTURESPROC)
+	GLAD_HOOK_SWAP(318, glGenTextures, PFNGLGENTEXTURESPROC)
+	GLAD_HOOK_SWAP(319, glIsTexture, PFNGLISTEXTUREPROC)
+#ifndef GLAD_CORE_ONLY
+	GLAD_HOOK_SWAP(320, glArrayElement, PFNGLARRAYELEMENTPROC)
+	GLAD_HOOK_SWAP(321, glColorPointer, PFNGLCOLORPOINTERPROC)
+	GLAD_HOOK_SWAP(322, glDisableClientState, PFNGLDISABLECLIENTSTATEPROC)
+	GLAD_HOOK_SWAP(323, glEdgeFlagPointer, PFNGLEDGEFLAGPOINTERPROC)
+	GLAD_HOOK_SWAP(324, glEnableClientState, PFNGLENABLECLIENTSTATEPROC)
+	GLAD_HOOK_SWAP(325, glIndexPointer, PFNGLINDEXPOINTERPROC)
+	GLAD_HOOK_SWAP(326, glInterleavedArrays, PFNGLINTERLEAVEDARRAYSPROC)
+	GLAD_HOOK_SWAP(327, glNormalPointer, PFNGLNORMALPOINTERPROC)
+	GLAD_HOOK_SWAP(328, glTexCoordPointer, PFNGLTEXCOORDPOINTERPROC)
+	GLAD_HOOK_SWAP(329, glVertexPointer, PFNGLVERTEXPOINTERPROC)
+	GLAD_HOOK_SWAP(330, glAreTexturesResident, PFNGLARETEXTURESRESIDENTPROC)
+	GLAD_HOOK_SWAP(331, glPrioritizeTextures, PFNGLPRIORITIZETEXTURESPROC)
+	GLAD_HOOK_SWAP(332, glIndexub, PFNGLINDEXUBPROC)
+	GLAD_HOOK_SWAP(333, glIndexubv, PFNGLINDEXUBVPROC)
+	GLAD_HOOK_SWAP(334, glPopClientAttrib, PFNGLPOPCLIENTATTRIBPROC)
+	GLAD_HOOK_SWAP(335, glPushClientAttrib, PFNGLPUSHCLIENTATTRIBPROC)
+#endif
+	GLAD_HOOK_SWAP(336, glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC)
+	GLAD_HOOK_SWAP(337, glTexImage3D, PFNGLTEXIMAGE3DPROC)
+	GLAD_HOOK_SWAP(338, glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC)
+	GLAD_HOOK_SWAP(339, glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC)
+	GLAD_HOOK_SWAP(340, glActiveTexture, PFNGLACTIVETEXTUREPROC)
+	GLAD_HOOK_SWAP(341, glSampleCoverage, PFNGLSAMPLECOVERAGEPROC)
+	GLAD_HOOK_SWAP(342, glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC)
+	GLAD_HOOK_SWAP(343, glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+	GLAD_HOOK_SWAP(344, glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC)
+	GLAD_HOOK_SWAP(345, glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)
+	GLAD_HOOK_SWAP(346, glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)
+	GLAD_HOOK_SWAP(347, glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)
+	GLAD_HOOK_SWAP(348, glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC)
+#ifndef GLAD_CORE_ONLY
+	GLAD_HOOK_SWAP(349, glClientActiveTexture, PFNGLCLIENTACTIVETEXTUREPROC)
+	GLAD_HOOK_SWAP(350, glMultiTexCoord1d, PFNGLMULTITEXCOORD1DPROC)
+	GLAD_HOOK_SWAP(351, glMultiTexCoord1dv, PFNGLMULTITEXCOORD1DVPROC)
+	GLAD_HOOK_SWAP(352, glMultiTexCoord1f, PFNGLMULTITEXCOORD1FPROC)
+	GLAD_HOOK_SWAP(353, glMultiTexCoord1fv, PFNGLMULTITEXCOORD1FVPROC)
+	GLAD_HOOK_SWAP(354, glMultiTexCoord1i, PFNGLMULTITEXCOORD1IPROC)
+	GLAD_HOOK_SWAP(355, glMultiTexCoord1iv, PFNGLMULTITEXCOORD1IVPROC)
+	GLAD_HOOK_SWAP(356, glMultiTexCoord1s, PFNGLMULTITEXCOORD1SPROC)
+	GLAD_HOOK_SWAP(357, glMultiTexCoord1sv, PFNGLMULTITEXCOORD1SVPROC)
+	GLAD_HOOK_SWAP(358, glMultiTexCoord2d, PFNGLMULTITEXCOORD2DPROC)
+	GLAD_HOOK_SWAP(359, glMultiTexCoord2dv, PFNGLMULTITEXCOORD2DVPROC)
+	GLAD_HOOK_SWAP(360, glMultiTexCoord2f, PFNGLMULTITEXCOORD2FPROC)
+	GLAD_HOOK_SWAP(361, glMultiTexCoord2fv, PFNGLMULTITEXCOORD2FVPROC)
+	GLAD_HOOK_SWAP(362, glMultiTexCoord2i, PFNGLMULTITEXCOORD2IPROC)
+	GLAD_HOOK_SWAP(363, glMultiTexCoord2iv, PFNGLMULTITEXCOORD2IVPROC)
+	GLAD_HOOK_SWAP(364, glMultiTexCoord2s, PFNGLMULTITEXCOORD2SPROC)
+	GLAD_HOOK_SWAP(365, glMultiTexCoord2sv, PFNGLMULTITEXCOORD2SVPROC)
+	GLAD_HOOK_SWAP(366, glMultiTexCoord3d, PFNGLMULTITEXCOORD3DPROC)
+	GLAD_HOOK_SWAP(367, glMultiTexCoord3dv, PFNGLMULTITEXCOORD3DVPROC)
+	GLAD_HOOK_SWAP(368, glMultiTexCoord3f, PFNGLMULTITEXCOORD3FPROC)
+	GLAD_HOOK_SWAP(369, glMultiTexCoord3fv, PFNGLMULTITEXCOORD3FVPROC)
+	GLAD_HOOK_SWAP(370, glMultiTexCoord3i, PFNGLMULTITEXCOORD3IPROC)
+	GLAD_HOOK_SWAP(371, glMultiTexCoord3iv, PFNGLMULTITEXCOORD3IVPROC)
+	GLAD_HOOK_SWAP(372, glMultiTexCoord3s, PFNGLMULTITEXCOORD3SPROC)
+	GLAD_HOOK_SWAP(373, glMultiTexCoord3sv, PFNGLMULTITEXCOORD3SVPROC)
+	GLAD_HOOK_SWAP(374, glMultiTexCoord4d, PFNGLMULTITEXCOORD4DPROC)
+	GLAD_HOOK_SWAP(375, glMultiTexCoord4dv, PFNGLMULTITEXCOORD4DVPROC)
+	GLAD_HOOK_SWAP(376, glMultiTexCoord4f, PFNGLMULTITEXCOORD4FPROC)
+	GLAD_HOOK_SWAP(377, glMultiTexCoord4fv, PFNGLMULTITEXCOORD4FVPROC)
+	GLAD_HOOK_SWAP(378, glMultiTexCoord4i, PFNGLMULTITEXCOORD4IPROC)
+	GLAD_HOOK_SWAP(379, glMultiTexCoord4iv, PFNGLMULTITEXCOORD4IVPROC)
+	GLAD_HOOK_SWAP(380, glMultiTexCoord4s, PFNGLMULTITEXCOORD4SPROC)
+	GLAD_HOOK_SWAP(381, glMultiTexCoord4sv, PFNGLMULTITEXCOORD4SVPROC)
+	GLAD_HOOK_SWAP(382, glLoadTransposeMatrixf, PFNGLLOADTRANSPOSEMATRIXFPROC)
+	GLAD_HOOK_SWAP(383, glLoadTransposeMatrixd, PFNGLLOADTRANSPOSEMATRIXDPROC)
+	GLAD_HOOK_SWAP(384, glMultTransposeMatrixf, PFNGLMULTTRANSPOSEMATRIXFPROC)
+	GLAD_HOOK_SWAP(385, glMultTransposeMatrixd, PFNGLMULTTRANSPOSEMATRIXDPROC)
+#endif
+	GLAD_HOOK_SWAP(386, glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC)
+	GLAD_HOOK_SWAP(387, glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC)
+	GLAD_HOOK_SWAP(388, glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC)
+	GLAD_HOOK_SWAP(389, glPointParameterf, PFNGLPOINTPARAMETERFPROC)
+	GLAD_HOOK_SWAP(390, glPointParameterfv, PFNGLPOINTPARAMETERFVPROC)
+	GLAD_HOOK_SWAP(391, glPointParameteri, PFNGLPOINTPARAMETERIPROC)
+	GLAD_HOOK_SWAP(392, glPointParameteriv, PFNGLPOINTPARAMETERIVPROC)
+#ifndef GLAD_CORE_ONLY
+	GLAD_HOOK_SWAP(393, glFogCoordf, PFNGLFOGCOORDFPROC)
+	GLAD_HOOK_SWAP(394, glFogCoordfv, PFNGLFOGCOORDFVPROC)
+	GLAD_HOOK_SWAP(395, glFogCoordd, PFNGLFOGCOORDDPROC)
+	GLAD_HOOK_SWAP(396, glFogCoorddv, PFNGLFOGCOORDDVPROC)
+	GLAD_HOOK_SWAP(397, glFogCoordPointer, PFNGLFOGCOORDPOINTERPROC)
+	GLAD_HOOK_SWAP(398, glSecondaryColor3b, PFNGLSECONDARYCOLOR3BPROC)
+	GLAD_HOOK_SWAP(399, glSecondaryColor3bv, PFNGLSECONDARYCOLOR3BVPROC)
+	GLAD_HOOK_SWAP(400, glSecondaryColor3d, PFNGLSECONDARYCOLOR3DPROC)
+	GLAD_HOOK_SWAP(401, glSecondaryColor3dv, PFNGLSECONDARYCOLOR3DVPROC)
+	GLAD_HOOK_SWAP(402, glSecondaryColor3f, PFNGLSECONDARYCOLOR3FPROC)
+	GLAD_HOOK_SWAP(403, glSecondaryColor3fv, PFNGLSECONDARYCOLOR3FVPROC)
+	GLAD_HOOK_SWAP(404, glSecondaryColor3i, PFNGLSECONDARYCOLOR3IPROC)
+	GLAD_HOOK_SWAP(405, glSecondaryColor3iv, PFNGLSECONDARYCOLOR3IVPROC)
+	GLAD_HOOK_SWAP(406, glSecondaryColor3s, PFNGLSECONDARYCOLOR3SPROC)
+	GLAD_HOOK_SWAP(407, glSecondaryColor3sv, PFNGLSECONDARYCOLOR3SVPROC)
+	GLAD_HOOK_SWAP(408, glSecondaryColor3ub, PFNGLSECONDARYCOLOR3UBPROC)
+	GLAD_HOOK_SWAP(409, glSecondaryColor3ubv, PFNGLSECONDARYCOLOR3UBVPROC)
+	GLAD_HOOK_SWAP(410, glSecondaryColor3ui, PFNGLSECONDARYCOLOR3UIPROC)
+	GLAD_HOOK_SWAP(411, glSecondaryColor3uiv, PFNGLSECONDARYCOLOR3UIVPROC)
+	GLAD_HOOK_SWAP(412, glSecondaryColor3us, PFNGLSECONDARYCOLOR3USPROC)
+	GLAD_HOOK_SWAP(413, glSecondaryColor3usv, PFNGLSECONDARYCOLOR3USVPROC)
+	GLAD_HOOK_SWAP(414, glSecondaryColorPointer, PFNGLSECONDARYCOLORPOINTERPROC)
+	GLAD_HOOK_SWAP(415, glWindowPos2d, PFNGLWINDOWPOS2DPROC)
+	GLAD_HOOK_SWAP(416, glWindowPos2dv, PFNGLWINDOWPOS2DVPROC)
+	GLAD_HOOK_SWAP(417, glWindowPos2f, PFNGLWINDOWPOS2FPROC)
+	GLAD_HOOK_SWAP(418, glWindowPos2fv, PFNGLWINDOWPOS2FVPROC)
+	GLAD_HOOK_SWAP(419, glWindowPos2i, PFNGLWINDOWPOS2IPROC)
+	GLAD_HOOK_SWAP(420, glWindowPos2iv, PFNGLWINDOWPOS2IVPROC)
+	GLAD_HOOK_SWAP(421, glWindowPos2s, PFNGLWINDOWPOS2SPROC)
+	GLAD_HOOK_SWAP(422, glWindowPos2sv, PFNGLWINDOWPOS2SVPROC)
+	GLAD_HOOK_SWAP(423, glWindowPos3d, PFNGLWINDOWPOS3DPROC)
+	GLAD_HOOK_SWAP(424, glWindowPos3dv, PFNGLWINDOWPOS3DVPROC)
+	GLAD_HOOK_SWAP(425, glWindowPos3f, PFNGLWINDOWPOS3FPROC)
+	GLAD_HOOK_SWAP(426, glWindowPos3fv, PFNGLWINDOWPOS3FVPROC)
+	GLAD_HOOK_SWAP(427, glWindowPos3i, PFNGLWINDOWPOS3IPROC)
+	GLAD_HOOK_SWAP(428, glWindowPos3iv, PFNGLWINDOWPOS3IVPROC)
+	GLAD_HOOK_SWAP(429, glWindowPos3s, PFNGLWINDOWPOS3SPROC)
+	GLAD_HOOK_SWAP(430, glWindowPos3sv, PFNGLWINDOWPOS3SVPROC)
+#endif
+	GLAD_HOOK_SWAP(431, glBlendColor, PFNGLBLENDCOLORPROC)
+	GLAD_HOOK_SWAP(432, glBlendEquation, PFNGLBLENDEQUATIONPROC)
+	GLAD_HOOK_SWAP(433, glGenQueries, PFNGLGENQUERIESPROC)
+	GLAD_HOOK_SWAP(434, glDeleteQueries, PFNGLDELETEQUERIESPROC)
+	GLAD_HOOK_SWAP(435, glIsQuery, PFNGLISQUERYPROC)
+	GLAD_HOOK_SWAP(436, glBeginQuery, PFNGLBEGINQUERYPROC)
+	GLAD_HOOK_SWAP(437, glEndQuery, PFNGLENDQUERYPROC)
+	GLAD_HOOK_SWAP(438, glGetQueryiv, PFNGLGETQUERYIVPROC)
+	GLAD_HOOK_SWAP(439, glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC)
+	GLAD_HOOK_SWAP(440, glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC)
+	GLAD_HOOK_SWAP(441, glBindBuffer, PFNGLBINDBUFFERPROC)
+	GLAD_HOOK_SWAP(442, glDeleteBuffers, PFNGLDELETEBUFFERSPROC)
+	GLAD_HOOK_SWAP(443, glGenBuffers, PFNGLGENBUFFERSPROC)
+	GLAD_HOOK_SWAP(444, glIsBuffer, PFNGLISBUFFERPROC)
+	GLAD_HOOK_SWAP(445, glBufferData, PFNGLBUFFERDATAPROC)
+	GLAD_HOOK_SWAP(446, glBufferSubData, PFNGLBUFFERSUBDATAPROC)
+	GLAD_HOOK_SWAP(447, glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC)
+	GLAD_HOOK_SWAP(448, glMapBuffer, PFNGLMAPBUFFERPROC)
+	GLAD_HOOK_SWAP(449, glUnmapBuffer, PFNGLUNMAPBUFFERPROC)
+	GLAD_HOOK_SWAP(450, glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC)
+	GLAD_HOOK_SWAP(451, glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC)
+	GLAD_HOOK_SWAP(452, glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC)
+	GLAD_HOOK_SWAP(453, glDrawBuffers, PFNGLDRAWBUFFERSPROC)
+	GLAD_HOOK_SWAP(454, glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC)
+	GLAD_HOOK_SWAP(455, glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC)
+	GLAD_HOOK_SWAP(456, glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC)
+	GLAD_HOOK_SWAP(457, glAttachShader, PFNGLATTACHSHADERPROC)
+	GLAD_HOOK_SWAP(458, glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC)
+	GLAD_HOOK_SWAP(459, glCompileShader, PFNGLCOMPILESHADERPROC)
+	GLAD_HOOK_SWAP(460, glCreateProgram, PFNGLCREATEPROGRAMPROC)
+	GLAD_HOOK_SWAP(461, glCreateShader, PFNGLCREATESHADERPROC)
+	GLAD_HOOK_SWAP(462, glDeleteProgram, PFNGLDELETEPROGRAMPROC)
+	GLAD_HOOK_SWAP(463, glDeleteShader, PFNGLDELETESHADERPROC)
+	GLAD_HOOK_SWAP(464, glDetachShader, PFNGLDETACHSHADERPROC)
+	GLAD_HOOK_SWAP(465, glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC)
+	GLAD_HOOK_SWAP(466, glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC)
+	GLAD_HOOK_SWAP(467, glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC)
+	GLAD_HOOK_SWAP(468, glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC)
+	GLAD_HOOK_SWAP(469, glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC)
+	GLAD_HOOK_SWAP(470, glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC)
+	GLAD_HOOK_SWAP(471, glGetProgramiv, PFNGLGETPROGRAMIVPROC)
+	GLAD_HOOK_SWAP(472, glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC)
+	GLAD_HOOK_SWAP(473, glGetShaderiv, PFNGLGETSHADERIVPROC)
+	GLAD_HOOK_SWAP(474, glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC)
+	GLAD_HOOK_SWAP(475, glGetShaderSource, PFNGLGETSHADERSOURCEPROC)
+	GLAD_HOOK_SWAP(476, glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC)
+	GLAD_HOOK_SWAP(477, glGetUniformfv, PFNGLGETUNIFORMFVPROC)
+	GLAD_HOOK_SWAP(478, glGetUniformiv, PFNGLGETUNIFORMIVPROC)
+	GLAD_HOOK_SWAP(479, glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC)
+	GLAD_HOOK_SWAP(480, glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC)
+	GLAD_HOOK_SWAP(481, glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC)
+	GLAD_HOOK_SWAP(482, glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC)
+	GLAD_HOOK_SWAP(483, glIsProgram, PFNGLISPROGRAMPROC)
+	GLAD_HOOK_SWAP(484, glIsShader, PFNGLISSHADERPROC)
+	GLAD_HOOK_SWAP(485, glLinkProgram, PFNGLLINKPROGRAMPROC)
+	GLAD_HOOK_SWAP(486, glShaderSource, PFNGLSHADERSOURCEPROC)
+	GLAD_HOOK_SWAP(487, glUseProgram, PFNGLUSEPROGRAMPROC)
+	GLAD_HOOK_SWAP(488, glUniform1f, PFNGLUNIFORM1FPROC)
+	GLAD_HOOK_SWAP(489, glUniform2f, PFNGLUNIFORM2FPROC)
+	GLAD_HOOK_SWAP(490, glUniform3f, PFNGLUNIFORM3FPROC)
+	GLAD_HOOK_SWAP(491, glUniform4f, PFNGLUNIFORM4FPROC)
+	GLAD_HOOK_SWAP(492, glUniform1i, PFNGLUNIFORM1IPROC)
+	GLAD_HOOK_SWAP(493, glUniform2i, PFNGLUNIFORM2IPROC)
+	GLAD_HOOK_SWAP(494, glUniform3i, PFNGLUNIFORM3IPROC)
+	GLAD_HOOK_SWAP(495, glUniform4i, PFNGLUNIFORM4IPROC)
+	GLAD_HOOK_SWAP(496, glUniform1fv, PFNGLUNIFORM1FVPROC)
+	GLAD_HOOK_SWAP(497, glUniform2fv, PFNGLUNIFORM2FVPROC)
+	GLAD_HOOK_SWAP(498, glUniform3fv, PFNGLUNIFORM3FVPROC)
+	GLAD_HOOK_SWAP(499, glUniform4fv, PFNGLUNIFORM4FVPROC)
+	GLAD_HOOK_SWAP(500, glUniform1iv, PFNGLUNIFORM1IVPROC)
+	GLAD_HOOK_SWAP(501, glUniform2iv, PFNGLUNIFORM2IVPROC)
+	GLAD_HOOK_SWAP(502, glUniform3iv, PFNGLUNIFORM3IVPROC)
+	GLAD_HOOK_SWAP(503, glUniform4iv, PFNGLUNIFORM4IVPROC)
+	GLAD_HOOK_SWAP(504, glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC)
+	GLAD_HOOK_SWAP(505, glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC)
+	GLAD_HOOK_SWAP(506, glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC)
+	GLAD_HOOK_SWAP(507, glValidateProgram, PFNGLVALIDATEPROGRAMPROC)
+	GLAD_HOOK_SWAP(508, glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC)
+	GLAD_HOOK_SWAP(509, glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC)
+	GLAD_HOOK_SWAP(510, glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC)
+	GLAD_HOOK_SWAP(511, glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC)
+	GLAD_HOOK_SWAP(512, glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC)
+	GLAD_HOOK_SWAP(513, glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC)
+	GLAD_HOOK_SWAP(514, glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC)
+	GLAD_HOOK_SWAP(515, glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC)
+	GLAD_HOOK_SWAP(516, glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC)
+	GLAD_HOOK_SWAP(517, glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC)
+	GLAD_HOOK_SWAP(518, glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC)
+	GLAD_HOOK_SWAP(519, glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC)
+	GLAD_HOOK_SWAP(520, glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC)
+	GLAD_HOOK_SWAP(521, glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC)
+	GLAD_HOOK_SWAP(522, glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC)
+	GLAD_HOOK_SWAP(523, glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC)
+	GLAD_HOOK_SWAP(524, glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC)
+	GLAD_HOOK_SWAP(525, glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC)
+	GLAD_HOOK_SWAP(526, glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC)
+	GLAD_HOOK_SWAP(527, glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC)
+	GLAD_HOOK_SWAP(528, glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC)
+	GLAD_HOOK_SWAP(529, glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC)
+	GLAD_HOOK_SWAP(530, glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC)
+	GLAD_HOOK_SWAP(531, glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC)
+	GLAD_HOOK_SWAP(532, glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC)
+	GLAD_HOOK_SWAP(533, glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC)
+	GLAD_HOOK_SWAP(534, glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC)
+	GLAD_HOOK_SWAP(535, glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC)
+	GLAD_HOOK_SWAP(536, glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC)
+	GLAD_HOOK_SWAP(537, glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC)
+	GLAD_HOOK_SWAP(538, glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC)
+	GLAD_HOOK_SWAP(539, glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC)
+	GLAD_HOOK_SWAP(540, glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC)
+	GLAD_HOOK_SWAP(541, glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC)
+	GLAD_HOOK_SWAP(542, glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC)
+	GLAD_HOOK_SWAP(543, glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC)
+	GLAD_HOOK_SWAP(544, glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC)
+	GLAD_HOOK_SWAP(545, glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC)
+	GLAD_HOOK_SWAP(546, glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC)
+	GLAD_HOOK_SWAP(547, glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC)
+	GLAD_HOOK_SWAP(548, glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC)
+	GLAD_HOOK_SWAP(549, glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC)
+	GLAD_HOOK_SWAP(550, glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC)
+	GLAD_HOOK_SWAP(551, glColorMaski, PFNGLCOLORMASKIPROC)
+	GLAD_HOOK_SWAP(552, glGetBooleani_v, PFNGLGETBOOLEANI_VPROC)
+	GLAD_HOOK_SWAP(553, glGetIntegeri_v, PFNGLGETINTEGERI_VPROC)
+	GLAD_HOOK_SWAP(554, glEnablei, PFNGLENABLEIPROC)
+	GLAD_HOOK_SWAP(555, glDisablei, PFNGLDISABLEIPROC)
+	GLAD_HOOK_SWAP(556, glIsEnabledi, PFNGLISENABLEDIPROC)
+	GLAD_HOOK_SWAP(557, glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC)
+	GLAD_HOOK_SWAP(558, glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC)
+	GLAD_HOOK_SWAP(559, glBindBufferRange, PFNGLBINDBUFFERRANGEPROC)
+	GLAD_HOOK_SWAP(560, glBindBufferBase, PFNGLBINDBUFFERBASEPROC)
+	GLAD_HOOK_SWAP(561, glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC)
+	GLAD_HOOK_SWAP(562, glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)
+	GLAD_HOOK_SWAP(563, glClampColor, PFNGLCLAMPCOLORPROC)
+	GLAD_HOOK_SWAP(564, glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC)
+	GLAD_HOOK_SWAP(565, glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC)
+	GLAD_HOOK_SWAP(566, glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC)
+	GLAD_HOOK_SWAP(567, glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC)
+	GLAD_HOOK_SWAP(568, glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC)
+	GLAD_HOOK_SWAP(569, glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC)
+	GLAD_HOOK_SWAP(570, glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC)
+	GLAD_HOOK_SWAP(571, glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC)
+	GLAD_HOOK_SWAP(572, glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC)
+	GLAD_HOOK_SWAP(573, glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC)
+	GLAD_HOOK_SWAP(574, glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC)
+	GLAD_HOOK_SWAP(575, glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC)
+	GLAD_HOOK_SWAP(576, glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC)
+	GLAD_HOOK_SWAP(577, glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC)
+	GLAD_HOOK_SWAP(578, glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC)
+	GLAD_HOOK_SWAP(579, glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC)
+	GLAD_HOOK_SWAP(580, glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC)
+	GLAD_HOOK_SWAP(581, glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC)
+	GLAD_HOOK_SWAP(582, glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC)
+	GLAD_HOOK_SWAP(583, glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC)
+	GLAD_HOOK_SWAP(584, glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC)
+	GLAD_HOOK_SWAP(585, glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC)
+	GLAD_HOOK_SWAP(586, glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC)
+	GLAD_HOOK_SWAP(587, glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC)
+	GLAD_HOOK_SWAP(588, glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC)
+	GLAD_HOOK_SWAP(589, glGetUniformuiv, PFNGLGETUNIFORMUIVPROC)
+	GLAD_HOOK_SWAP(590, glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC)
+	GLAD_HOOK_SWAP(591, glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC)
+	GLAD_HOOK_SWAP(592, glUniform1ui, PFNGLUNIFORM1UIPROC)
+	GLAD_HOOK_SWAP(593, glUniform2ui, PFNGLUNIFORM2UIPROC)
+	GLAD_HOOK_SWAP(594, glUniform3ui, PFNGLUNIFORM3UIPROC)
+	GLAD_HOOK_SWAP(595, glUniform4ui, PFNGLUNIFORM4UIPROC)
+	GLAD_HOOK_SWAP(596, glUniform1uiv, PFNGLUNIFORM1UIVPROC)
+	GLAD_HOOK_SWAP(597, glUniform2uiv, PFNGLUNIFORM2UIVPROC)
+	GLAD_HOOK_SWAP(598, glUniform3uiv, PFNGLUNIFORM3UIVPROC)
+	GLAD_HOOK_SWAP(599, glUniform4uiv, PFNGLUNIFORM4UIVPROC)
+	GLAD_HOOK_SWAP(600, glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC)
+	GLAD_HOOK_SWAP(601, glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC)
+	GLAD_HOOK_SWAP(602, glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC)
+	GLAD_HOOK_SWAP(603, glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC)
+	GLAD_HOOK_SWAP(604, glClearBufferiv, PFNGLCLEARBUFFERIVPROC)
+	GLAD_HOOK_SWAP(605, glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC)
+	GLAD_HOOK_SWAP(606, glClearBufferfv, PFNGLCLEARBUFFERFVPROC)
+	GLAD_HOOK_SWAP(607, glClearBufferfi, PFNGLCLEARBUFFERFIPROC)
+	GLAD_HOOK_SWAP(608, glGetStringi, PFNGLGETSTRINGIPROC)
+	GLAD_HOOK_SWAP(609, glIsRenderbuffer, PFNGLISRENDERBUFFERPROC)
+	GLAD_HOOK_SWAP(610, glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC)
+	GLAD_HOOK_SWAP(611, glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC)
+	GLAD_HOOK_SWAP(612, glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC)
+	GLAD_HOOK_SWAP(613, glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC)
+	GLAD_HOOK_SWAP(614, glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC)
+	GLAD_HOOK_SWAP(615, glIsFramebuffer, PFNGLISFRAMEBUFFERPROC)
+	GLAD_HOOK_SWAP(616, glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC)
+	GLAD_HOOK_SWAP(617, glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC)
+	GLAD_HOOK_SWAP(618, glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC)
+	GLAD_HOOK_SWAP(619, glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC)
+	GLAD_HOOK_SWAP(620, glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC)
+	GLAD_HOOK_SWAP(621, glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC)
+	GLAD_HOOK_SWAP(622, glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC)
+	GLAD_HOOK_SWAP(623, glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC)
+	GLAD_HOOK_SWAP(624, glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)
+	GLAD_HOOK_SWAP(625, glGenerateMipmap, PFNGLGENERATEMIPMAPPROC)
+	GLAD_HOOK_SWAP(626, glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC)
+	GLAD_HOOK_SWAP(627, glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)
+	GLAD_HOOK_SWAP(628, glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC)
+	GLAD_HOOK_SWAP(629, glMapBufferRange, PFNGLMAPBUFFERRANGEPROC)
+	GLAD_HOOK_SWAP(630, glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC)
+	GLAD_HOOK_SWAP(631, glBindVertexArray, PFNGLBINDVERTEXARRAYPROC)
+	GLAD_HOOK_SWAP(632, glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC)
+	GLAD_HOOK_SWAP(633, glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC)
+	GLAD_HOOK_SWAP(634, glIsVertexArray, PFNGLISVERTEXARRAYPROC)
+	GLAD_HOOK_SWAP(635, glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC)
+	GLAD_HOOK_SWAP(636, glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC)
+	GLAD_HOOK_SWAP(637, glTexBuffer, PFNGLTEXBUFFERPROC)
+	GLAD_HOOK_SWAP(638, glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC)
+	GLAD_HOOK_SWAP(639, glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC)
+	GLAD_HOOK_SWAP(640, glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC)
+	GLAD_HOOK_SWAP(641, glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC)
+	GLAD_HOOK_SWAP(642, glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC)
+	GLAD_HOOK_SWAP(643, glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC)
+	GLAD_HOOK_SWAP(644, glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC)
+	GLAD_HOOK_SWAP(645, glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)
+	GLAD_HOOK_SWAP(646, glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC)
+	GLAD_HOOK_SWAP(647, glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC)
+	GLAD_HOOK_SWAP(648, glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)
+	GLAD_HOOK_SWAP(649, glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)
+	GLAD_HOOK_SWAP(650, glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)
+	GLAD_HOOK_SWAP(651, glProvokingVertex, PFNGLPROVOKINGVERTEXPROC)
+	GLAD_HOOK_SWAP(652, glFenceSync, PFNGLFENCESYNCPROC)
+	GLAD_HOOK_SWAP(653, glIsSync, PFNGLISSYNCPROC)
+	GLAD_HOOK_SWAP(654, glDeleteSync, PFNGLDELETESYNCPROC)
+	GLAD_HOOK_SWAP(655, glClientWaitSync, PFNGLCLIENTWAITSYNCPROC)
+	GLAD_HOOK_SWAP(656, glWaitSync, PFNGLWAITSYNCPROC)
+	GLAD_HOOK_SWAP(657, glGetInteger64v, PFNGLGETINTEGER64VPROC)
+	GLAD_HOOK_SWAP(658, glGetSynciv, PFNGLGETSYNCIVPROC)
+	GLAD_HOOK_SWAP(659, glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC)
+	GLAD_HOOK_SWAP(660, glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC)
+	GLAD_HOOK_SWAP(661, glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC)
+	GLAD_HOOK_SWAP(662, glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC)
+	GLAD_HOOK_SWAP(663, glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC)
+	GLAD_HOOK_SWAP(664, glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC)
+	GLAD_HOOK_SWAP(665, glSampleMaski, PFNGLSAMPLEMASKIPROC)
+	GLAD_HOOK_SWAP(666, glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)
+	GLAD_HOOK_SWAP(667, glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC)
+	GLAD_HOOK_SWAP(668, glGenSamplers, PFNGLGENSAMPLERSPROC)
+	GLAD_HOOK_SWAP(669, glDeleteSamplers, PFNGLDELETESAMPLERSPROC)
+	GLAD_HOOK_SWAP(670, glIsSampler, PFNGLISSAMPLERPROC)
+	GLAD_HOOK_SWAP(671, glBindSampler, PFNGLBINDSAMPLERPROC)
+	GLAD_HOOK_SWAP(672, glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC)
+	GLAD_HOOK_SWAP(673, glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC)
+	GLAD_HOOK_SWAP(674, glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC)
+	GLAD_HOOK_SWAP(675, glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC)
+	GLAD_HOOK_SWAP(676, glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC)
+	GLAD_HOOK_SWAP(677, glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC)
+	GLAD_HOOK_SWAP(678, glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC)
+	GLAD_HOOK_SWAP(679, glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC)
+	GLAD_HOOK_SWAP(680, glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC)
+	GLAD_HOOK_SWAP(681, glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC)
+	GLAD_HOOK_SWAP(682, glQueryCounter, PFNGLQUERYCOUNTERPROC)
+	GLAD_HOOK_SWAP(683, glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC)
+	GLAD_HOOK_SWAP(684, glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC)
+	GLAD_HOOK_SWAP(685, glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC)
+	GLAD_HOOK_SWAP(686, glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC)
+	GLAD_HOOK_SWAP(687, glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC)
+	GLAD_HOOK_SWAP(688, glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC)
+	GLAD_HOOK_SWAP(689, glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC)
+	GLAD_HOOK_SWAP(690, glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC)
+	GLAD_HOOK_SWAP(691, glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC)
+	GLAD_HOOK_SWAP(692, glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC)
+	GLAD_HOOK_SWAP(693, glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC)
+#ifndef GLAD_CORE_ONLY
+	GLAD_HOOK_SWAP(694, glVertexP2ui, PFNGLVERTEXP2UIPROC)
+	GLAD_HOOK_SWAP(695, glVertexP2uiv, PFNGLVERTEXP2UIVPROC)
+	GLAD_HOOK_SWAP(696, glVertexP3ui, PFNGLVERTEXP3UIPROC)
+	GLAD_HOOK_SWAP(697, glVertexP3uiv, PFNGLVERTEXP3UIVPROC)
+	GLAD_HOOK_SWAP(698, glVertexP4ui, PFNGLVERTEXP4UIPROC)
+	GLAD_HOOK_SWAP(699, glVertexP4uiv, PFNGLVERTEXP4UIVPROC)
+	GLAD_HOOK_SWAP(700, glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC)
+	GLAD_HOOK_SWAP(701, glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC)
+	GLAD_HOOK_SWAP(702, glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC)
+	GLAD_HOOK_SWAP(703, glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC)
+	GLAD_HOOK_SWAP(704, glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC)
+	GLAD_HOOK_SWAP(705, glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC)
+	GLAD_HOOK_SWAP(706, glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC)
+	GLAD_HOOK_SWAP(707, glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC)
+	GLAD_HOOK_SWAP(708, glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC)
+	GLAD_HOOK_SWAP(709, glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC)
+	GLAD_HOOK_SWAP(710, glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC)
+	GLAD_HOOK_SWAP(711, glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC)
+	GLAD_HOOK_SWAP(712, glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC)
+	GLAD_HOOK_SWAP(713, glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC)
+	GLAD_HOOK_SWAP(714, glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC)
+	GLAD_HOOK_SWAP(715, glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC)
+	GLAD_HOOK_SWAP(716, glNormalP3ui, PFNGLNORMALP3UIPROC)
+	GLAD_HOOK_SWAP(717, glNormalP3uiv, PFNGLNORMALP3UIVPROC)
+	GLAD_HOOK_SWAP(718, glColorP3ui, PFNGLCOLORP3UIPROC)
+	GLAD_HOOK_SWAP(719, glColorP3uiv, PFNGLCOLORP3UIVPROC)
+	GLAD_HOOK_SWAP(720, glColorP4ui, PFNGLCOLORP4UIPROC)
+	GLAD_HOOK_SWAP(721, glColorP4uiv, PFNGLCOLORP4UIVPROC)
+	GLAD_HOOK_SWAP(722, glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC)
+	GLAD_HOOK_SWAP(723, glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC)
+#endif
+	GLAD_HOOK_SWAP(724, glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC)
+	GLAD_HOOK_SWAP(725, glProgramBinary, PFNGLPROGRAMBINARYPROC)
+	GLAD_HOOK_SWAP(726, glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC)
+	GLAD_HOOK_SWAP(727, glMaxShaderCompilerThreadsKHR, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)
+	GLAD_HOOK_SWAP(728, glBufferStorage, PFNGLBUFFERSTORAGEPROC)
+}
+
+int gladInstallCallHooks(GLADcallhook pre, GLADcallhook post) {
+#ifdef GLAD_PER_CONTEXT
+	if(glad_gl_context == NULL) return 0;
+#endif
+	if(pre == NULL && post == NULL) return 0;
+	glad_hook_pre = pre;
+	glad_hook_post = post;
+	swap_hooks(1);
+	return 1;
+}
+
+void gladRemoveCallHooks(void) {
+#ifdef GLAD_PER_CONTEXT
+	if(glad_gl_context == NULL) return;
+#endif
+	swap_hooks(0);
+	glad_hook_pre = NULL;
+	glad_hook_post = NULL;
+}
+
+int gladFindFunction(const char *name) {
+	int index;
+	for(index = 0; index < GLAD_GL_FUNCTION_COUNT; index++) {
+		if(strcmp(glad_hook_info[index][0], name) == 0) return index;
+	}
+	return -1;
+}
+
+int gladDescribeCall(int index, struct gladGLcall *call) {
+	if(index < 0 || index >= GLAD_GL_FUNCTION_COUNT) return 0;
+	call->index = index;
+	call->name = glad_hook_info[index][0];
+	call->argTypes = glad_hook_info[index][1];
+	call->argNames = glad_hook_info[index][2];
+	call->resultType = glad_hook_results[index];
+	call->result = 0;
+	call->user = 0;
+	return 1;
+}
+
+/* Calls through the current pointer, so an installed hook or wrapper layer sees the call too */
+int gladInvokeCall(struct gladGLcall *call) {
+	const unsigned long long *a = call->args;
+#ifdef GLAD_PER_CONTEXT
+	if(glad_gl_context == NULL) return 0;
+#endif
+	switch(call->index) {
+	case 0: if(glad_glCullFace == NULL) return 0; glad_glCullFace((GLenum)a[0]); break;
+	case 1: if(glad_glFrontFace == NULL) return 0; glad_glFrontFace((GLenum)a[0]); break;
+	case 2: if(glad_glHint == NULL) return 0; glad_glHint((GLenum)a[0], (GLenum)a[1]); break;
+	case 3: if(glad_glLineWidth == NULL) return 0; glad_glLineWidth((GLfloat)glad_raw_f(a[0])); break;
+	case 4: if(glad_glPointSize == NULL) return 0; glad_glPointSize((GLfloat)glad_raw_f(a[0])); break;
+	case 5: if(glad_glPolygonMode == NULL) return 0; glad_glPolygonMode((GLenum)a[0], (GLenum)a[1]); break;
+	case 6: if(glad_glScissor == NULL) return 0; glad_glScissor((GLint)(long long)a[0], (GLint)(long long)a[1], (GLsizei)(long long)a[2], (GLsizei)(long long)a[3]); break;
+	case 7: if(glad_glTexParameterf == NULL) return 0; glad_glTexParameterf((GLenum)a[0], (GLenum)a[1], (GLfloat)glad_raw_f(a[2])); break;
+	case 8: if(glad_glTexParameterfv == NULL) return 0; glad_glTexParameterfv((GLenum)a[0], (GLenum)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 9: if(glad_glTexParameteri == NULL) return 0; glad_glTexParameteri((GLenum)a[0], (GLenum)a[1], (GLint)(long long)a[2]); break;
+	case 10: if(glad_glTexParameteriv == NULL) return 0; glad_glTexParameteriv((GLenum)a[0], (GLenum)a[1], (const GLint *)(size_t)a[2]); break;
+	case 11: if(glad_glTexImage1D == NULL) return 0; glad_glTexImage1D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLsizei)(long long)a[3], (GLint)(long long)a[4], (GLenum)a[5], (GLenum)a[6], (const void *)(size_t)a[7]); break;
+	case 12: if(glad_glTexImage2D == NULL) return 0; glad_glTexImage2D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLsizei)(long long)a[3], (GLsizei)(long long)a[4], (GLint)(long long)a[5], (GLenum)a[6], (GLenum)a[7], (const void *)(size_t)a[8]); break;
+	case 13: if(glad_glDrawBuffer == NULL) return 0; glad_glDrawBuffer((GLenum)a[0]); break;
+	case 14: if(glad_glClear == NULL) return 0; glad_glClear((GLbitfield)a[0]); break;
+	case 15: if(glad_glClearColor == NULL) return 0; glad_glClearColor((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 16: if(glad_glClearStencil == NULL) return 0; glad_glClearStencil((GLint)(long long)a[0]); break;
+	case 17: if(glad_glClearDepth == NULL) return 0; glad_glClearDepth((GLdouble)glad_raw_f(a[0])); break;
+	case 18: if(glad_glStencilMask == NULL) return 0; glad_glStencilMask((GLuint)a[0]); break;
+	case 19: if(glad_glColorMask == NULL) return 0; glad_glColorMask((GLboolean)a[0], (GLboolean)a[1], (GLboolean)a[2], (GLboolean)a[3]); break;
+	case 20: if(glad_glDepthMask == NULL) return 0; glad_glDepthMask((GLboolean)a[0]); break;
+	case 21: if(glad_glDisable == NULL) return 0; glad_glDisable((GLenum)a[0]); break;
+	case 22: if(glad_glEnable == NULL) return 0; glad_glEnable((GLenum)a[0]); break;
+	case 23: if(glad_glFinish == NULL) return 0; glad_glFinish(); break;
+	case 24: if(glad_glFlush == NULL) return 0; glad_glFlush(); break;
+	case 25: if(glad_glBlendFunc == NULL) return 0; glad_glBlendFunc((GLenum)a[0], (GLenum)a[1]); break;
+	case 26: if(glad_glLogicOp == NULL) return 0; glad_glLogicOp((GLenum)a[0]); break;
+	case 27: if(glad_glStencilFunc == NULL) return 0; glad_glStencilFunc((GLenum)a[0], (GLint)(long long)a[1], (GLuint)a[2]); break;
+	case 28: if(glad_glStencilOp == NULL) return 0; glad_glStencilOp((GLenum)a[0], (GLenum)a[1], (GLenum)a[2]); break;
+	case 29: if(glad_glDepthFunc == NULL) return 0; glad_glDepthFunc((GLenum)a[0]); break;
+	case 30: if(glad_glPixelStoref == NULL) return 0; glad_glPixelStoref((GLenum)a[0], (GLfloat)glad_raw_f(a[1])); break;
+	case 31: if(glad_glPixelStorei == NULL) return 0; glad_glPixelStorei((GLenum)a[0], (GLint)(long long)a[1]); break;
+	case 32: if(glad_glReadBuffer == NULL) return 0; glad_glReadBuffer((GLenum)a[0]); break;
+	case 33: if(glad_glReadPixels == NULL) return 0; glad_glReadPixels((GLint)(long long)a[0], (GLint)(long long)a[1], (GLsizei)(long long)a[2], (GLsizei)(long long)a[3], (GLenum)a[4], (GLenum)a[5], (void *)(size_t)a[6]); break;
+	case 34: if(glad_glGetBooleanv == NULL) return 0; glad_glGetBooleanv((GLenum)a[0], (GLboolean *)(size_t)a[1]); break;
+	case 35: if(glad_glGetDoublev == NULL) return 0; glad_glGetDoublev((GLenum)a[0], (GLdouble *)(size_t)a[1]); break;
+	case 36: if(glad_glGetError == NULL) return 0; call->result = glad_arg_u(glad_glGetError()); break;
+	case 37: if(glad_glGetFloatv == NULL) return 0; glad_glGetFloatv((GLenum)a[0], (GLfloat *)(size_t)a[1]); break;
+	case 38: if(glad_glGetIntegerv == NULL) return 0; glad_glGetIntegerv((GLenum)a[0], (GLint *)(size_t)a[1]); break;
+	case 39: if(glad_glGetString == NULL) return 0; call->result = glad_arg_p(glad_glGetString((GLenum)a[0])); break;
+	case 40: if(glad_glGetTexImage == NULL) return 0; glad_glGetTexImage((GLenum)a[0], (GLint)(long long)a[1], (GLenum)a[2], (GLenum)a[3], (void *)(size_t)a[4]); break;
+	case 41: if(glad_glGetTexParameterfv == NULL) return 0; glad_glGetTexParameterfv((GLenum)a[0], (GLenum)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 42: if(glad_glGetTexParameteriv == NULL) return 0; glad_glGetTexParameteriv((GLenum)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 43: if(glad_glGetTexLevelParameterfv == NULL) return 0; glad_glGetTexLevelParameterfv((GLenum)a[0], (GLint)(long long)a[1], (GLenum)a[2], (GLfloat *)(size_t)a[3]); break;
+	case 44: if(glad_glGetTexLevelParameteriv == NULL) return 0; glad_glGetTexLevelParameteriv((GLenum)a[0], (GLint)(long long)a[1], (GLenum)a[2], (GLint *)(size_t)a[3]); break;
+	case 45: if(glad_glIsEnabled == NULL) return 0; call->result = glad_arg_u(glad_glIsEnabled((GLenum)a[0])); break;
+	case 46: if(glad_glDepthRange == NULL) return 0; glad_glDepthRange((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1])); break;
+	case 47: if(glad_glViewport == NULL) return 0; glad_glViewport((GLint)(long long)a[0], (GLint)(long long)a[1], (GLsizei)(long long)a[2], (GLsizei)(long long)a[3]); break;
+#ifndef GLAD_CORE_ONLY
+	case 48: if(glad_glNewList == NULL) return 0; glad_glNewList((GLuint)a[0], (GLenum)a[1]); break;
+	case 49: if(glad_glEndList == NULL) return 0; glad_glEndList(); break;
+	case 50: if(glad_glCallList == NULL) return 0; glad_glCallList((GLuint)a[0]); break;
+	case 51: if(glad_glCallLists == NULL) return 0; glad_glCallLists((GLsizei)(long long)a[0], (GLenum)a[1], (const void *)(size_t)a[2]); break;
+	case 52: if(glad_glDeleteLists == NULL) return 0; glad_glDeleteLists((GLuint)a[0], (GLsizei)(long long)a[1]); break;
+	case 53: if(glad_glGenLists == NULL) return 0; call->result = glad_arg_u(glad_glGenLists((GLsizei)(long long)a[0])); break;
+	case 54: if(glad_glListBase == NULL) return 0; glad_glListBase((GLuint)a[0]); break;
+	case 55: if(glad_glBegin == NULL) return 0; glad_glBegin((GLenum)a[0]); break;
+	case 56: if(glad_glBitmap == NULL) return 0; glad_glBitmap((GLsizei)(long long)a[0], (GLsizei)(long long)a[1], (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3]), (GLfloat)glad_raw_f(a[4]), (GLfloat)glad_raw_f(a[5]), (const GLubyte *)(size_t)a[6]); break;
+	case 57: if(glad_glColor3b == NULL) return 0; glad_glColor3b((GLbyte)(long long)a[0], (GLbyte)(long long)a[1], (GLbyte)(long long)a[2]); break;
+	case 58: if(glad_glColor3bv == NULL) return 0; glad_glColor3bv((const GLbyte *)(size_t)a[0]); break;
+	case 59: if(glad_glColor3d == NULL) return 0; glad_glColor3d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 60: if(glad_glColor3dv == NULL) return 0; glad_glColor3dv((const GLdouble *)(size_t)a[0]); break;
+	case 61: if(glad_glColor3f == NULL) return 0; glad_glColor3f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 62: if(glad_glColor3fv == NULL) return 0; glad_glColor3fv((const GLfloat *)(size_t)a[0]); break;
+	case 63: if(glad_glColor3i == NULL) return 0; glad_glColor3i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 64: if(glad_glColor3iv == NULL) return 0; glad_glColor3iv((const GLint *)(size_t)a[0]); break;
+	case 65: if(glad_glColor3s == NULL) return 0; glad_glColor3s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2]); break;
+	case 66: if(glad_glColor3sv == NULL) return 0; glad_glColor3sv((const GLshort *)(size_t)a[0]); break;
+	case 67: if(glad_glColor3ub == NULL) return 0; glad_glColor3ub((GLubyte)a[0], (GLubyte)a[1], (GLubyte)a[2]); break;
+	case 68: if(glad_glColor3ubv == NULL) return 0; glad_glColor3ubv((const GLubyte *)(size_t)a[0]); break;
+	case 69: if(glad_glColor3ui == NULL) return 0; glad_glColor3ui((GLuint)a[0], (GLuint)a[1], (GLuint)a[2]); break;
+	case 70: if(glad_glColor3uiv == NULL) return 0; glad_glColor3uiv((const GLuint *)(size_t)a[0]); break;
+	case 71: if(glad_glColor3us == NULL) return 0; glad_glColor3us((GLushort)a[0], (GLushort)a[1], (GLushort)a[2]); break;
+	case 72: if(glad_glColor3usv == NULL) return 0; glad_glColor3usv((const GLushort *)(size_t)a[0]); break;
+	case 73: if(glad_glColor4b == NULL) return 0; glad_glColor4b((GLbyte)(long long)a[0], (GLbyte)(long long)a[1], (GLbyte)(long long)a[2], (GLbyte)(long long)a[3]); break;
+	case 74: if(glad_glColor4bv == NULL) return 0; glad_glColor4bv((const GLbyte *)(size_t)a[0]); break;
+	case 75: if(glad_glColor4d == NULL) return 0; glad_glColor4d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3])); break;
+	case 76: if(glad_glColor4dv == NULL) return 0; glad_glColor4dv((const GLdouble *)(size_t)a[0]); break;
+	case 77: if(glad_glColor4f == NULL) return 0; glad_glColor4f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 78: if(glad_glColor4fv == NULL) return 0; glad_glColor4fv((const GLfloat *)(size_t)a[0]); break;
+	case 79: if(glad_glColor4i == NULL) return 0; glad_glColor4i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3]); break;
+	case 80: if(glad_glColor4iv == NULL) return 0; glad_glColor4iv((const GLint *)(size_t)a[0]); break;
+	case 81: if(glad_glColor4s == NULL) return 0; glad_glColor4s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2], (GLshort)(long long)a[3]); break;
+	case 82: if(glad_glColor4sv == NULL) return 0; glad_glColor4sv((const GLshort *)(size_t)a[0]); break;
+	case 83: if(glad_glColor4ub == NULL) return 0; glad_glColor4ub((GLubyte)a[0], (GLubyte)a[1], (GLubyte)a[2], (GLubyte)a[3]); break;
+	case 84: if(glad_glColor4ubv == NULL) return 0; glad_glColor4ubv((const GLubyte *)(size_t)a[0]); break;
+	case 85: if(glad_glColor4ui == NULL) return 0; glad_glColor4ui((GLuint)a[0], (GLuint)a[1], (GLuint)a[2], (GLuint)a[3]); break;
+	case 86: if(glad_glColor4uiv == NULL) return 0; glad_glColor4uiv((const GLuint *)(size_t)a[0]); break;
+	case 87: if(glad_glColor4us == NULL) return 0; glad_glColor4us((GLushort)a[0], (GLushort)a[1], (GLushort)a[2], (GLushort)a[3]); break;
+	case 88: if(glad_glColor4usv == NULL) return 0; glad_glColor4usv((const GLushort *)(size_t)a[0]); break;
+	case 89: if(glad_glEdgeFlag == NULL) return 0; glad_glEdgeFlag((GLboolean)a[0]); break;
+	case 90: if(glad_glEdgeFlagv == NULL) return 0; glad_glEdgeFlagv((const GLboolean *)(size_t)a[0]); break;
+	case 91: if(glad_glEnd == NULL) return 0; glad_glEnd(); break;
+	case 92: if(glad_glIndexd == NULL) return 0; glad_glIndexd((GLdouble)glad_raw_f(a[0])); break;
+	case 93: if(glad_glIndexdv == NULL) return 0; glad_glIndexdv((const GLdouble *)(size_t)a[0]); break;
+	case 94: if(glad_glIndexf == NULL) return 0; glad_glIndexf((GLfloat)glad_raw_f(a[0])); break;
+	case 95: if(glad_glIndexfv == NULL) return 0; glad_glIndexfv((const GLfloat *)(size_t)a[0]); break;
+	case 96: if(glad_glIndexi == NULL) return 0; glad_glIndexi((GLint)(long long)a[0]); break;
+	case 97: if(glad_glIndexiv == NULL) return 0; glad_glIndexiv((const GLint *)(size_t)a[0]); break;
+	case 98: if(glad_glIndexs == NULL) return 0; glad_glIndexs((GLshort)(long long)a[0]); break;
+	case 99: if(glad_glIndexsv == NULL) return 0; glad_glIndexsv((const GLshort *)(size_t)a[0]); break;
+	case 100: if(glad_glNormal3b == NULL) return 0; glad_glNormal3b((GLbyte)(long long)a[0], (GLbyte)(long long)a[1], (GLbyte)(long long)a[2]); break;
+	case 101: if(glad_glNormal3bv == NULL) return 0; glad_glNormal3bv((const GLbyte *)(size_t)a[0]); break;
+	case 102: if(glad_glNormal3d == NULL) return 0; glad_glNormal3d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 103: if(glad_glNormal3dv == NULL) return 0; glad_glNormal3dv((const GLdouble *)(size_t)a[0]); break;
+	case 104: if(glad_glNormal3f == NULL) return 0; glad_glNormal3f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 105: if(glad_glNormal3fv == NULL) return 0; glad_glNormal3fv((const GLfloat *)(size_t)a[0]); break;
+	case 106: if(glad_glNormal3i == NULL) return 0; glad_glNormal3i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 107: if(glad_glNormal3iv == NULL) return 0; glad_glNormal3iv((const GLint *)(size_t)a[0]); break;
+	case 108: if(glad_glNormal3s == NULL) return 0; glad_glNormal3s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2]); break;
+	case 109: if(glad_glNormal3sv == NULL) return 0; glad_glNormal3sv((const GLshort *)(size_t)a[0]); break;
+	case 110: if(glad_glRasterPos2d == NULL) return 0; glad_glRasterPos2d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1])); break;
+	case 111: if(glad_glRasterPos2dv == NULL) return 0; glad_glRasterPos2dv((const GLdouble *)(size_t)a[0]); break;
+	case 112: if(glad_glRasterPos2f == NULL) return 0; glad_glRasterPos2f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1])); break;
+	case 113: if(glad_glRasterPos2fv == NULL) return 0; glad_glRasterPos2fv((const GLfloat *)(size_t)a[0]); break;
+	case 114: if(glad_glRasterPos2i == NULL) return 0; glad_glRasterPos2i((GLint)(long long)a[0], (GLint)(long long)a[1]); break;
+	case 115: if(glad_glRasterPos2iv == NULL) return 0; glad_glRasterPos2iv((const GLint *)(size_t)a[0]); break;
+	case 116: if(glad_glRasterPos2s == NULL) return 0; glad_glRasterPos2s((GLshort)(long long)a[0], (GLshort)(long long)a[1]); break;
+	case 117: if(glad_glRasterPos2sv == NULL) return 0; glad_glRasterPos2sv((const GLshort *)(size_t)a[0]); break;
+	case 118: if(glad_glRasterPos3d == NULL) return 0; glad_glRasterPos3d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 119: if(glad_glRasterPos3dv == NULL) return 0; glad_glRasterPos3dv((const GLdouble *)(size_t)a[0]); break;
+	case 120: if(glad_glRasterPos3f == NULL) return 0; glad_glRasterPos3f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 121: if(glad_glRasterPos3fv == NULL) return 0; glad_glRasterPos3fv((const GLfloat *)(size_t)a[0]); break;
+	case 122: if(glad_glRasterPos3i == NULL) return 0; glad_glRasterPos3i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 123: if(glad_glRasterPos3iv == NULL) return 0; glad_glRasterPos3iv((const GLint *)(size_t)a[0]); break;
+	case 124: if(glad_glRasterPos3s == NULL) return 0; glad_glRasterPos3s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2]); break;
+	case 125: if(glad_glRasterPos3sv == NULL) return 0; glad_glRasterPos3sv((const GLshort *)(size_t)a[0]); break;
+	case 126: if(glad_glRasterPos4d == NULL) return 0; glad_glRasterPos4d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3])); break;
+	case 127: if(glad_glRasterPos4dv == NULL) return 0; glad_glRasterPos4dv((const GLdouble *)(size_t)a[0]); break;
+	case 128: if(glad_glRasterPos4f == NULL) return 0; glad_glRasterPos4f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 129: if(glad_glRasterPos4fv == NULL) return 0; glad_glRasterPos4fv((const GLfloat *)(size_t)a[0]); break;
+	case 130: if(glad_glRasterPos4i == NULL) return 0; glad_glRasterPos4i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3]); break;
+	case 131: if(glad_glRasterPos4iv == NULL) return 0; glad_glRasterPos4iv((const GLint *)(size_t)a[0]); break;
+	case 132: if(glad_glRasterPos4s == NULL) return 0; glad_glRasterPos4s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2], (GLshort)(long long)a[3]); break;
+	case 133: if(glad_glRasterPos4sv == NULL) return 0; glad_glRasterPos4sv((const GLshort *)(size_t)a[0]); break;
+	case 134: if(glad_glRectd == NULL) return 0; glad_glRectd((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3])); break;
+	case 135: if(glad_glRectdv == NULL) return 0; glad_glRectdv((const GLdouble *)(size_t)a[0], (const GLdouble *)(size_t)a[1]); break;
+	case 136: if(glad_glRectf == NULL) return 0; glad_glRectf((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 137: if(glad_glRectfv == NULL) return 0; glad_glRectfv((const GLfloat *)(size_t)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 138: if(glad_glRecti == NULL) return 0; glad_glRecti((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3]); break;
+	case 139: if(glad_glRectiv == NULL) return 0; glad_glRectiv((const GLint *)(size_t)a[0], (const GLint *)(size_t)a[1]); break;
+	case 140: if(glad_glRects == NULL) return 0; glad_glRects((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2], (GLshort)(long long)a[3]); break;
+	case 141: if(glad_glRectsv == NULL) return 0; glad_glRectsv((const GLshort *)(size_t)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 142: if(glad_glTexCoord1d == NULL) return 0; glad_glTexCoord1d((GLdouble)glad_raw_f(a[0])); break;
+	case 143: if(glad_glTexCoord1dv == NULL) return 0; glad_glTexCoord1dv((const GLdouble *)(size_t)a[0]); break;
+	case 144: if(glad_glTexCoord1f == NULL) return 0; glad_glTexCoord1f((GLfloat)glad_raw_f(a[0])); break;
+	case 145: if(glad_glTexCoord1fv == NULL) return 0; glad_glTexCoord1fv((const GLfloat *)(size_t)a[0]); break;
+	case 146: if(glad_glTexCoord1i == NULL) return 0; glad_glTexCoord1i((GLint)(long long)a[0]); break;
+	case 147: if(glad_glTexCoord1iv == NULL) return 0; glad_glTexCoord1iv((const GLint *)(size_t)a[0]); break;
+	case 148: if(glad_glTexCoord1s == NULL) return 0; glad_glTexCoord1s((GLshort)(long long)a[0]); break;
+	case 149: if(glad_glTexCoord1sv == NULL) return 0; glad_glTexCoord1sv((const GLshort *)(size_t)a[0]); break;
+	case 150: if(glad_glTexCoord2d == NULL) return 0; glad_glTexCoord2d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1])); break;
+	case 151: if(glad_glTexCoord2dv == NULL) return 0; glad_glTexCoord2dv((const GLdouble *)(size_t)a[0]); break;
+	case 152: if(glad_glTexCoord2f == NULL) return 0; glad_glTexCoord2f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1])); break;
+	case 153: if(glad_glTexCoord2fv == NULL) return 0; glad_glTexCoord2fv((const GLfloat *)(size_t)a[0]); break;
+	case 154: if(glad_glTexCoord2i == NULL) return 0; glad_glTexCoord2i((GLint)(long long)a[0], (GLint)(long long)a[1]); break;
+	case 155: if(glad_glTexCoord2iv == NULL) return 0; glad_glTexCoord2iv((const GLint *)(size_t)a[0]); break;
+	case 156: if(glad_glTexCoord2s == NULL) return 0; glad_glTexCoord2s((GLshort)(long long)a[0], (GLshort)(long long)a[1]); break;
+	case 157: if(glad_glTexCoord2sv == NULL) return 0; glad_glTexCoord2sv((const GLshort *)(size_t)a[0]); break;
+	case 158: if(glad_glTexCoord3d == NULL) return 0; glad_glTexCoord3d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 159: if(glad_glTexCoord3dv == NULL) return 0; glad_glTexCoord3dv((const GLdouble *)(size_t)a[0]); break;
+	case 160: if(glad_glTexCoord3f == NULL) return 0; glad_glTexCoord3f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 161: if(glad_glTexCoord3fv == NULL) return 0; glad_glTexCoord3fv((const GLfloat *)(size_t)a[0]); break;
+	case 162: if(glad_glTexCoord3i == NULL) return 0; glad_glTexCoord3i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 163: if(glad_glTexCoord3iv == NULL) return 0; glad_glTexCoord3iv((const GLint *)(size_t)a[0]); break;
+	case 164: if(glad_glTexCoord3s == NULL) return 0; glad_glTexCoord3s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2]); break;
+	case 165: if(glad_glTexCoord3sv == NULL) return 0; glad_glTexCoord3sv((const GLshort *)(size_t)a[0]); break;
+	case 166: if(glad_glTexCoord4d == NULL) return 0; glad_glTexCoord4d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3])); break;
+	case 167: if(glad_glTexCoord4dv == NULL) return 0; glad_glTexCoord4dv((const GLdouble *)(size_t)a[0]); break;
+	case 168: if(glad_glTexCoord4f == NULL) return 0; glad_glTexCoord4f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 169: if(glad_glTexCoord4fv == NULL) return 0; glad_glTexCoord4fv((const GLfloat *)(size_t)a[0]); break;
+	case 170: if(glad_glTexCoord4i == NULL) return 0; glad_glTexCoord4i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3]); break;
+	case 171: if(glad_glTexCoord4iv == NULL) return 0; glad_glTexCoord4iv((const GLint *)(size_t)a[0]); break;
+	case 172: if(glad_glTexCoord4s == NULL) return 0; glad_glTexCoord4s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2], (GLshort)(long long)a[3]); break;
+	case 173: if(glad_glTexCoord4sv == NULL) return 0; glad_glTexCoord4sv((const GLshort *)(size_t)a[0]); break;
+	case 174: if(glad_glVertex2d == NULL) return 0; glad_glVertex2d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1])); break;
+	case 175: if(glad_glVertex2dv == NULL) return 0; glad_glVertex2dv((const GLdouble *)(size_t)a[0]); break;
+	case 176: if(glad_glVertex2f == NULL) return 0; glad_glVertex2f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1])); break;
+	case 177: if(glad_glVertex2fv == NULL) return 0; glad_glVertex2fv((const GLfloat *)(size_t)a[0]); break;
+	case 178: if(glad_glVertex2i == NULL) return 0; glad_glVertex2i((GLint)(long long)a[0], (GLint)(long long)a[1]); break;
+	case 179: if(glad_glVertex2iv == NULL) return 0; glad_glVertex2iv((const GLint *)(size_t)a[0]); break;
+	case 180: if(glad_glVertex2s == NULL) return 0; glad_glVertex2s((GLshort)(long long)a[0], (GLshort)(long long)a[1]); break;
+	case 181: if(glad_glVertex2sv == NULL) return 0; glad_glVertex2sv((const GLshort *)(size_t)a[0]); break;
+	case 182: if(glad_glVertex3d == NULL) return 0; glad_glVertex3d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 183: if(glad_glVertex3dv == NULL) return 0; glad_glVertex3dv((const GLdouble *)(size_t)a[0]); break;
+	case 184: if(glad_glVertex3f == NULL) return 0; glad_glVertex3f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 185: if(glad_glVertex3fv == NULL) return 0; glad_glVertex3fv((const GLfloat *)(size_t)a[0]); break;
+	case 186: if(glad_glVertex3i == NULL) return 0; glad_glVertex3i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 187: if(glad_glVertex3iv == NULL) return 0; glad_glVertex3iv((const GLint *)(size_t)a[0]); break;
+	case 188: if(glad_glVertex3s == NULL) return 0; glad_glVertex3s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2]); break;
+	case 189: if(glad_glVertex3sv == NULL) return 0; glad_glVertex3sv((const GLshort *)(size_t)a[0]); break;
+	case 190: if(glad_glVertex4d == NULL) return 0; glad_glVertex4d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3])); break;
+	case 191: if(glad_glVertex4dv == NULL) return 0; glad_glVertex4dv((const GLdouble *)(size_t)a[0]); break;
+	case 192: if(glad_glVertex4f == NULL) return 0; glad_glVertex4f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 193: if(glad_glVertex4fv == NULL) return 0; glad_glVertex4fv((const GLfloat *)(size_t)a[0]); break;
+	case 194: if(glad_glVertex4i == NULL) return 0; glad_glVertex4i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3]); break;
+	case 195: if(glad_glVertex4iv == NULL) return 0; glad_glVertex4iv((const GLint *)(size_t)a[0]); break;
+	case 196: if(glad_glVertex4s == NULL) return 0; glad_glVertex4s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2], (GLshort)(long long)a[3]); break;
+	case 197: if(glad_glVertex4sv == NULL) return 0; glad_glVertex4sv((const GLshort *)(size_t)a[0]); break;
+	case 198: if(glad_glClipPlane == NULL) return 0; glad_glClipPlane((GLenum)a[0], (const GLdouble *)(size_t)a[1]); break;
+	case 199: if(glad_glColorMaterial == NULL) return 0; glad_glColorMaterial((GLenum)a[0], (GLenum)a[1]); break;
+	case 200: if(glad_glFogf == NULL) return 0; glad_glFogf((GLenum)a[0], (GLfloat)glad_raw_f(a[1])); break;
+	case 201: if(glad_glFogfv == NULL) return 0; glad_glFogfv((GLenum)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 202: if(glad_glFogi == NULL) return 0; glad_glFogi((GLenum)a[0], (GLint)(long long)a[1]); break;
+	case 203: if(glad_glFogiv == NULL) return 0; glad_glFogiv((GLenum)a[0], (const GLint *)(size_t)a[1]); break;
+	case 204: if(glad_glLightf == NULL) return 0; glad_glLightf((GLenum)a[0], (GLenum)a[1], (GLfloat)glad_raw_f(a[2])); break;
+	case 205: if(glad_glLightfv == NULL) return 0; glad_glLightfv((GLenum)a[0], (GLenum)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 206: if(glad_glLighti == NULL) return 0; glad_glLighti((GLenum)a[0], (GLenum)a[1], (GLint)(long long)a[2]); break;
+	case 207: if(glad_glLightiv == NULL) return 0; glad_glLightiv((GLenum)a[0], (GLenum)a[1], (const GLint *)(size_t)a[2]); break;
+	case 208: if(glad_glLightModelf == NULL) return 0; glad_glLightModelf((GLenum)a[0], (GLfloat)glad_raw_f(a[1])); break;
+	case 209: if(glad_glLightModelfv == NULL) return 0; glad_glLightModelfv((GLenum)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 210: if(glad_glLightModeli == NULL) return 0; glad_glLightModeli((GLenum)a[0], (GLint)(long long)a[1]); break;
+	case 211: if(glad_glLightModeliv == NULL) return 0; glad_glLightModeliv((GLenum)a[0], (const GLint *)(size_t)a[1]); break;
+	case 212: if(glad_glLineStipple == NULL) return 0; glad_glLineStipple((GLint)(long long)a[0], (GLushort)a[1]); break;
+	case 213: if(glad_glMaterialf == NULL) return 0; glad_glMaterialf((GLenum)a[0], (GLenum)a[1], (GLfloat)glad_raw_f(a[2])); break;
+	case 214: if(glad_glMaterialfv == NULL) return 0; glad_glMaterialfv((GLenum)a[0], (GLenum)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 215: if(glad_glMateriali == NULL) return 0; glad_glMateriali((GLenum)a[0], (GLenum)a[1], (GLint)(long long)a[2]); break;
+	case 216: if(glad_glMaterialiv == NULL) return 0; glad_glMaterialiv((GLenum)a[0], (GLenum)a[1], (const GLint *)(size_t)a[2]); break;
+	case 217: if(glad_glPolygonStipple == NULL) return 0; glad_glPolygonStipple((const GLubyte *)(size_t)a[0]); break;
+	case 218: if(glad_glShadeModel == NULL) return 0; glad_glShadeModel((GLenum)a[0]); break;
+	case 219: if(glad_glTexEnvf == NULL) return 0; glad_glTexEnvf((GLenum)a[0], (GLenum)a[1], (GLfloat)glad_raw_f(a[2])); break;
+	case 220: if(glad_glTexEnvfv == NULL) return 0; glad_glTexEnvfv((GLenum)a[0], (GLenum)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 221: if(glad_glTexEnvi == NULL) return 0; glad_glTexEnvi((GLenum)a[0], (GLenum)a[1], (GLint)(long long)a[2]); break;
+	case 222: if(glad_glTexEnviv == NULL) return 0; glad_glTexEnviv((GLenum)a[0], (GLenum)a[1], (const GLint *)(size_t)a[2]); break;
+	case 223: if(glad_glTexGend == NULL) return 0; glad_glTexGend((GLenum)a[0], (GLenum)a[1], (GLdouble)glad_raw_f(a[2])); break;
+	case 224: if(glad_glTexGendv == NULL) return 0; glad_glTexGendv((GLenum)a[0], (GLenum)a[1], (const GLdouble *)(size_t)a[2]); break;
+	case 225: if(glad_glTexGenf == NULL) return 0; glad_glTexGenf((GLenum)a[0], (GLenum)a[1], (GLfloat)glad_raw_f(a[2])); break;
+	case 226: if(glad_glTexGenfv == NULL) return 0; glad_glTexGenfv((GLenum)a[0], (GLenum)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 227: if(glad_glTexGeni == NULL) return 0; glad_glTexGeni((GLenum)a[0], (GLenum)a[1], (GLint)(long long)a[2]); break;
+	case 228: if(glad_glTexGeniv == NULL) return 0; glad_glTexGeniv((GLenum)a[0], (GLenum)a[1], (const GLint *)(size_t)a[2]); break;
+	case 229: if(glad_glFeedbackBuffer == NULL) return 0; glad_glFeedbackBuffer((GLsizei)(long long)a[0], (GLenum)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 230: if(glad_glSelectBuffer == NULL) return 0; glad_glSelectBuffer((GLsizei)(long long)a[0], (GLuint *)(size_t)a[1]); break;
+	case 231: if(glad_glRenderMode == NULL) return 0; call->result = glad_arg_i(glad_glRenderMode((GLenum)a[0])); break;
+	case 232: if(glad_glInitNames == NULL) return 0; glad_glInitNames(); break;
+	case 233: if(glad_glLoadName == NULL) return 0; glad_glLoadName((GLuint)a[0]); break;
+	case 234: if(glad_glPassThrough == NULL) return 0; glad_glPassThrough((GLfloat)glad_raw_f(a[0])); break;
+	case 235: if(glad_glPopName == NULL) return 0; glad_glPopName(); break;
+	case 236: if(glad_glPushName == NULL) return 0; glad_glPushName((GLuint)a[0]); break;
+	case 237: if(glad_glClearAccum == NULL) return 0; glad_glClearAccum((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 238: if(glad_glClearIndex == NULL) return 0; glad_glClearIndex((GLfloat)glad_raw_f(a[0])); break;
+	case 239: if(glad_glIndexMask == NULL) return 0; glad_glIndexMask((GLuint)a[0]); break;
+	case 240: if(glad_glAccum == NULL) return 0; glad_glAccum((GLenum)a[0], (GLfloat)glad_raw_f(a[1])); break;
+	case 241: if(glad_glPopAttrib == NULL) return 0; glad_glPopAttrib(); break;
+	case 242: if(glad_glPushAttrib == NULL) return 0; glad_glPushAttrib((GLbitfield)a[0]); break;
+	case 243: if(glad_glMap1d == NULL) return 0; glad_glMap1d((GLenum)a[0], (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLint)(long long)a[3], (GLint)(long long)a[4], (const GLdouble *)(size_t)a[5]); break;
+	case 244: if(glad_glMap1f == NULL) return 0; glad_glMap1f((GLenum)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLint)(long long)a[3], (GLint)(long long)a[4], (const GLfloat *)(size_t)a[5]); break;
+	case 245: if(glad_glMap2d == NULL) return 0; glad_glMap2d((GLenum)a[0], (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLint)(long long)a[3], (GLint)(long long)a[4], (GLdouble)glad_raw_f(a[5]), (GLdouble)glad_raw_f(a[6]), (GLint)(long long)a[7], (GLint)(long long)a[8], (const GLdouble *)(size_t)a[9]); break;
+	case 246: if(glad_glMap2f == NULL) return 0; glad_glMap2f((GLenum)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLint)(long long)a[3], (GLint)(long long)a[4], (GLfloat)glad_raw_f(a[5]), (GLfloat)glad_raw_f(a[6]), (GLint)(long long)a[7], (GLint)(long long)a[8], (const GLfloat *)(size_t)a[9]); break;
+	case 247: if(glad_glMapGrid1d == NULL) return 0; glad_glMapGrid1d((GLint)(long long)a[0], (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 248: if(glad_glMapGrid1f == NULL) return 0; glad_glMapGrid1f((GLint)(long long)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 249: if(glad_glMapGrid2d == NULL) return 0; glad_glMapGrid2d((GLint)(long long)a[0], (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLint)(long long)a[3], (GLdouble)glad_raw_f(a[4]), (GLdouble)glad_raw_f(a[5])); break;
+	case 250: if(glad_glMapGrid2f == NULL) return 0; glad_glMapGrid2f((GLint)(long long)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLint)(long long)a[3], (GLfloat)glad_raw_f(a[4]), (GLfloat)glad_raw_f(a[5])); break;
+	case 251: if(glad_glEvalCoord1d == NULL) return 0; glad_glEvalCoord1d((GLdouble)glad_raw_f(a[0])); break;
+	case 252: if(glad_glEvalCoord1dv == NULL) return 0; glad_glEvalCoord1dv((const GLdouble *)(size_t)a[0]); break;
+	case 253: if(glad_glEvalCoord1f == NULL) return 0; glad_glEvalCoord1f((GLfloat)glad_raw_f(a[0])); break;
+	case 254: if(glad_glEvalCoord1fv == NULL) return 0; glad_glEvalCoord1fv((const GLfloat *)(size_t)a[0]); break;
+	case 255: if(glad_glEvalCoord2d == NULL) return 0; glad_glEvalCoord2d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1])); break;
+	case 256: if(glad_glEvalCoord2dv == NULL) return 0; glad_glEvalCoord2dv((const GLdouble *)(size_t)a[0]); break;
+	case 257: if(glad_glEvalCoord2f == NULL) return 0; glad_glEvalCoord2f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1])); break;
+	case 258: if(glad_glEvalCoord2fv == NULL) return 0; glad_glEvalCoord2fv((const GLfloat *)(size_t)a[0]); break;
+	case 259: if(glad_glEvalMesh1 == NULL) return 0; glad_glEvalMesh1((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 260: if(glad_glEvalPoint1 == NULL) return 0; glad_glEvalPoint1((GLint)(long long)a[0]); break;
+	case 261: if(glad_glEvalMesh2 == NULL) return 0; glad_glEvalMesh2((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4]); break;
+	case 262: if(glad_glEvalPoint2 == NULL) return 0; glad_glEvalPoint2((GLint)(long long)a[0], (GLint)(long long)a[1]); break;
+	case 263: if(glad_glAlphaFunc == NULL) return 0; glad_glAlphaFunc((GLenum)a[0], (GLfloat)glad_raw_f(a[1])); break;
+	case 264: if(glad_glPixelZoom == NULL) return 0; glad_glPixelZoom((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1])); break;
+	case 265: if(glad_glPixelTransferf == NULL) return 0; glad_glPixelTransferf((GLenum)a[0], (GLfloat)glad_raw_f(a[1])); break;
+	case 266: if(glad_glPixelTransferi == NULL) return 0; glad_glPixelTransferi((GLenum)a[0], (GLint)(long long)a[1]); break;
+	case 267: if(glad_glPixelMapfv == NULL) return 0; glad_glPixelMapfv((GLenum)a[0], (GLsizei)(long long)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 268: if(glad_glPixelMapuiv == NULL) return 0; glad_glPixelMapuiv((GLenum)a[0], (GLsizei)(long long)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 269: if(glad_glPixelMapusv == NULL) return 0; glad_glPixelMapusv((GLenum)a[0], (GLsizei)(long long)a[1], (const GLushort *)(size_t)a[2]); break;
+	case 270: if(glad_glCopyPixels == NULL) return 0; glad_glCopyPixels((GLint)(long long)a[0], (GLint)(long long)a[1], (GLsizei)(long long)a[2], (GLsizei)(long long)a[3], (GLenum)a[4]); break;
+	case 271: if(glad_glDrawPixels == NULL) return 0; glad_glDrawPixels((GLsizei)(long long)a[0], (GLsizei)(long long)a[1], (GLenum)a[2], (GLenum)a[3], (const void *)(size_t)a[4]); break;
+	case 272: if(glad_glGetClipPlane == NULL) return 0; glad_glGetClipPlane((GLenum)a[0], (GLdouble *)(size_t)a[1]); break;
+	case 273: if(glad_glGetLightfv == NULL) return 0; glad_glGetLightfv((GLenum)a[0], (GLenum)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 274: if(glad_glGetLightiv == NULL) return 0; glad_glGetLightiv((GLenum)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 275: if(glad_glGetMapdv == NULL) return 0; glad_glGetMapdv((GLenum)a[0], (GLenum)a[1], (GLdouble *)(size_t)a[2]); break;
+	case 276: if(glad_glGetMapfv == NULL) return 0; glad_glGetMapfv((GLenum)a[0], (GLenum)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 277: if(glad_glGetMapiv == NULL) return 0; glad_glGetMapiv((GLenum)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 278: if(glad_glGetMaterialfv == NULL) return 0; glad_glGetMaterialfv((GLenum)a[0], (GLenum)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 279: if(glad_glGetMaterialiv == NULL) return 0; glad_glGetMaterialiv((GLenum)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 280: if(glad_glGetPixelMapfv == NULL) return 0; glad_glGetPixelMapfv((GLenum)a[0], (GLfloat *)(size_t)a[1]); break;
+	case 281: if(glad_glGetPixelMapuiv == NULL) return 0; glad_glGetPixelMapuiv((GLenum)a[0], (GLuint *)(size_t)a[1]); break;
+	case 282: if(glad_glGetPixelMapusv == NULL) return 0; glad_glGetPixelMapusv((GLenum)a[0], (GLushort *)(size_t)a[1]); break;
+	case 283: if(glad_glGetPolygonStipple == NULL) return 0; glad_glGetPolygonStipple((GLubyte *)(size_t)a[0]); break;
+	case 284: if(glad_glGetTexEnvfv == NULL) return 0; glad_glGetTexEnvfv((GLenum)a[0], (GLenum)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 285: if(glad_glGetTexEnviv == NULL) return 0; glad_glGetTexEnviv((GLenum)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 286: if(glad_glGetTexGendv == NULL) return 0; glad_glGetTexGendv((GLenum)a[0], (GLenum)a[1], (GLdouble *)(size_t)a[2]); break;
+	case 287: if(glad_glGetTexGenfv == NULL) return 0; glad_glGetTexGenfv((GLenum)a[0], (GLenum)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 288: if(glad_glGetTexGeniv == NULL) return 0; glad_glGetTexGeniv((GLenum)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 289: if(glad_glIsList == NULL) return 0; call->result = glad_arg_u(glad_glIsList((GLuint)a[0])); break;
+	case 290: if(glad_glFrustum == NULL) return 0; glad_glFrustum((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3]), (GLdouble)glad_raw_f(a[4]), (GLdouble)glad_raw_f(a[5])); break;
+	case 291: if(glad_glLoadIdentity == NULL) return 0; glad_glLoadIdentity(); break;
+	case 292: if(glad_glLoadMatrixf == NULL) return 0; glad_glLoadMatrixf((const GLfloat *)(size_t)a[0]); break;
+	case 293: if(glad_glLoadMatrixd == NULL) return 0; glad_glLoadMatrixd((const GLdouble *)(size_t)a[0]); break;
+	case 294: if(glad_glMatrixMode == NULL) return 0; glad_glMatrixMode((GLenum)a[0]); break;
+	case 295: if(glad_glMultMatrixf == NULL) return 0; glad_glMultMatrixf((const GLfloat *)(size_t)a[0]); break;
+	case 296: if(glad_glMultMatrixd == NULL) return 0; glad_glMultMatrixd((const GLdouble *)(size_t)a[0]); break;
+	case 297: if(glad_glOrtho == NULL) return 0; glad_glOrtho((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3]), (GLdouble)glad_raw_f(a[4]), (GLdouble)glad_raw_f(a[5])); break;
+	case 298: if(glad_glPopMatrix == NULL) return 0; glad_glPopMatrix(); break;
+	case 299: if(glad_glPushMatrix == NULL) return 0; glad_glPushMatrix(); break;
+	case 300: if(glad_glRotated == NULL) return 0; glad_glRotated((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3])); break;
+	case 301: if(glad_glRotatef == NULL) return 0; glad_glRotatef((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 302: if(glad_glScaled == NULL) return 0; glad_glScaled((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 303: if(glad_glScalef == NULL) return 0; glad_glScalef((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 304: if(glad_glTranslated == NULL) return 0; glad_glTranslated((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 305: if(glad_glTranslatef == NULL) return 0; glad_glTranslatef((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+#endif
+	case 306: if(glad_glDrawArrays == NULL) return 0; glad_glDrawArrays((GLenum)a[0], (GLint)(long long)a[1], (GLsizei)(long long)a[2]); break;
+	case 307: if(glad_glDrawElements == NULL) return 0; glad_glDrawElements((GLenum)a[0], (GLsizei)(long long)a[1], (GLenum)a[2], (const void *)(size_t)a[3]); break;
+	case 308: if(glad_glGetPointerv == NULL) return 0; glad_glGetPointerv((GLenum)a[0], (void **)(size_t)a[1]); break;
+	case 309: if(glad_glPolygonOffset == NULL) return 0; glad_glPolygonOffset((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1])); break;
+	case 310: if(glad_glCopyTexImage1D == NULL) return 0; glad_glCopyTexImage1D((GLenum)a[0], (GLint)(long long)a[1], (GLenum)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4], (GLsizei)(long long)a[5], (GLint)(long long)a[6]); break;
+	case 311: if(glad_glCopyTexImage2D == NULL) return 0; glad_glCopyTexImage2D((GLenum)a[0], (GLint)(long long)a[1], (GLenum)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4], (GLsizei)(long long)a[5], (GLsizei)(long long)a[6], (GLint)(long long)a[7]); break;
+	case 312: if(glad_glCopyTexSubImage1D == NULL) return 0; glad_glCopyTexSubImage1D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4], (GLsizei)(long long)a[5]); break;
+	case 313: if(glad_glCopyTexSubImage2D == NULL) return 0; glad_glCopyTexSubImage2D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4], (GLint)(long long)a[5], (GLsizei)(long long)a[6], (GLsizei)(long long)a[7]); break;
+	case 314: if(glad_glTexSubImage1D == NULL) return 0; glad_glTexSubImage1D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLsizei)(long long)a[3], (GLenum)a[4], (GLenum)a[5], (const void *)(size_t)a[6]); break;
+	case 315: if(glad_glTexSubImage2D == NULL) return 0; glad_glTexSubImage2D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLsizei)(long long)a[4], (GLsizei)(long long)a[5], (GLenum)a[6], (GLenum)a[7], (const void *)(size_t)a[8]); break;
+	case 316: if(glad_glBindTexture == NULL) return 0; glad_glBindTexture((GLenum)a[0], (GLuint)a[1]); break;
+	case 317: if(glad_glDeleteTextures == NULL) return 0; glad_glDeleteTextures((GLsizei)(long long)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 318: if(glad_glGenTextures == NULL) return 0; glad_glGenTextures((GLsizei)(long long)a[0], (GLuint *)(size_t)a[1]); break;
+	case 319: if(glad_glIsTexture == NULL) return 0; call->result = glad_arg_u(glad_glIsTexture((GLuint)a[0])); break;
+#ifndef GLAD_CORE_ONLY
+	case 320: if(glad_glArrayElement == NULL) return 0; glad_glArrayElement((GLint)(long long)a[0]); break;
+	case 321: if(glad_glColorPointer == NULL) return 0; glad_glColorPointer((GLint)(long long)a[0], (GLenum)a[1], (GLsizei)(long long)a[2], (const void *)(size_t)a[3]); break;
+	case 322: if(glad_glDisableClientState == NULL) return 0; glad_glDisableClientState((GLenum)a[0]); break;
+	case 323: if(glad_glEdgeFlagPointer == NULL) return 0; glad_glEdgeFlagPointer((GLsizei)(long long)a[0], (const void *)(size_t)a[1]); break;
+	case 324: if(glad_glEnableClientState == NULL) return 0; glad_glEnableClientState((GLenum)a[0]); break;
+	case 325: if(glad_glIndexPointer == NULL) return 0; glad_glIndexPointer((GLenum)a[0], (GLsizei)(long long)a[1], (const void *)(size_t)a[2]); break;
+	case 326: if(glad_glInterleavedArrays == NULL) return 0; glad_glInterleavedArrays((GLenum)a[0], (GLsizei)(long long)a[1], (const void *)(size_t)a[2]); break;
+	case 327: if(glad_glNormalPointer == NULL) return 0; glad_glNormalPointer((GLenum)a[0], (GLsizei)(long long)a[1], (const void *)(size_t)a[2]); break;
+	case 328: if(glad_glTexCoordPointer == NULL) return 0; glad_glTexCoordPointer((GLint)(long long)a[0], (GLenum)a[1], (GLsizei)(long long)a[2], (const void *)(size_t)a[3]); break;
+	case 329: if(glad_glVertexPointer == NULL) return 0; glad_glVertexPointer((GLint)(long long)a[0], (GLenum)a[1], (GLsizei)(long long)a[2], (const void *)(size_t)a[3]); break;
+	case 330: if(glad_glAreTexturesResident == NULL) return 0; call->result = glad_arg_u(glad_glAreTexturesResident((GLsizei)(long long)a[0], (const GLuint *)(size_t)a[1], (GLboolean *)(size_t)a[2])); break;
+	case 331: if(glad_glPrioritizeTextures == NULL) return 0; glad_glPrioritizeTextures((GLsizei)(long long)a[0], (const GLuint *)(size_t)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 332: if(glad_glIndexub == NULL) return 0; glad_glIndexub((GLubyte)a[0]); break;
+	case 333: if(glad_glIndexubv == NULL) return 0; glad_glIndexubv((const GLubyte *)(size_t)a[0]); break;
+	case 334: if(glad_glPopClientAttrib == NULL) return 0; glad_glPopClientAttrib(); break;
+	case 335: if(glad_glPushClientAttrib == NULL) return 0; glad_glPushClientAttrib((GLbitfield)a[0]); break;
+#endif
+	case 336: if(glad_glDrawRangeElements == NULL) return 0; glad_glDrawRangeElements((GLenum)a[0], (GLuint)a[1], (GLuint)a[2], (GLsizei)(long long)a[3], (GLenum)a[4], (const void *)(size_t)a[5]); break;
+	case 337: if(glad_glTexImage3D == NULL) return 0; glad_glTexImage3D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLsizei)(long long)a[3], (GLsizei)(long long)a[4], (GLsizei)(long long)a[5], (GLint)(long long)a[6], (GLenum)a[7], (GLenum)a[8], (const void *)(size_t)a[9]); break;
+	case 338: if(glad_glTexSubImage3D == NULL) return 0; glad_glTexSubImage3D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4], (GLsizei)(long long)a[5], (GLsizei)(long long)a[6], (GLsizei)(long long)a[7], (GLenum)a[8], (GLenum)a[9], (const void *)(size_t)a[10]); break;
+	case 339: if(glad_glCopyTexSubImage3D == NULL) return 0; glad_glCopyTexSubImage3D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4], (GLint)(long long)a[5], (GLint)(long long)a[6], (GLsizei)(long long)a[7], (GLsizei)(long long)a[8]); break;
+	case 340: if(glad_glActiveTexture == NULL) return 0; glad_glActiveTexture((GLenum)a[0]); break;
+	case 341: if(glad_glSampleCoverage == NULL) return 0; glad_glSampleCoverage((GLfloat)glad_raw_f(a[0]), (GLboolean)a[1]); break;
+	case 342: if(glad_glCompressedTexImage3D == NULL) return 0; glad_glCompressedTexImage3D((GLenum)a[0], (GLint)(long long)a[1], (GLenum)a[2], (GLsizei)(long long)a[3], (GLsizei)(long long)a[4], (GLsizei)(long long)a[5], (GLint)(long long)a[6], (GLsizei)(long long)a[7], (const void *)(size_t)a[8]); break;
+	case 343: if(glad_glCompressedTexImage2D == NULL) return 0; glad_glCompressedTexImage2D((GLenum)a[0], (GLint)(long long)a[1], (GLenum)a[2], (GLsizei)(long long)a[3], (GLsizei)(long long)a[4], (GLint)(long long)a[5], (GLsizei)(long long)a[6], (const void *)(size_t)a[7]); break;
+	case 344: if(glad_glCompressedTexImage1D == NULL) return 0; glad_glCompressedTexImage1D((GLenum)a[0], (GLint)(long long)a[1], (GLenum)a[2], (GLsizei)(long long)a[3], (GLint)(long long)a[4], (GLsizei)(long long)a[5], (const void *)(size_t)a[6]); break;
+	case 345: if(glad_glCompressedTexSubImage3D == NULL) return 0; glad_glCompressedTexSubImage3D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4], (GLsizei)(long long)a[5], (GLsizei)(long long)a[6], (GLsizei)(long long)a[7], (GLenum)a[8], (GLsizei)(long long)a[9], (const void *)(size_t)a[10]); break;
+	case 346: if(glad_glCompressedTexSubImage2D == NULL) return 0; glad_glCompressedTexSubImage2D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLsizei)(long long)a[4], (GLsizei)(long long)a[5], (GLenum)a[6], (GLsizei)(long long)a[7], (const void *)(size_t)a[8]); break;
+	case 347: if(glad_glCompressedTexSubImage1D == NULL) return 0; glad_glCompressedTexSubImage1D((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLsizei)(long long)a[3], (GLenum)a[4], (GLsizei)(long long)a[5], (const void *)(size_t)a[6]); break;
+	case 348: if(glad_glGetCompressedTexImage == NULL) return 0; glad_glGetCompressedTexImage((GLenum)a[0], (GLint)(long long)a[1], (void *)(size_t)a[2]); break;
+#ifndef GLAD_CORE_ONLY
+	case 349: if(glad_glClientActiveTexture == NULL) return 0; glad_glClientActiveTexture((GLenum)a[0]); break;
+	case 350: if(glad_glMultiTexCoord1d == NULL) return 0; glad_glMultiTexCoord1d((GLenum)a[0], (GLdouble)glad_raw_f(a[1])); break;
+	case 351: if(glad_glMultiTexCoord1dv == NULL) return 0; glad_glMultiTexCoord1dv((GLenum)a[0], (const GLdouble *)(size_t)a[1]); break;
+	case 352: if(glad_glMultiTexCoord1f == NULL) return 0; glad_glMultiTexCoord1f((GLenum)a[0], (GLfloat)glad_raw_f(a[1])); break;
+	case 353: if(glad_glMultiTexCoord1fv == NULL) return 0; glad_glMultiTexCoord1fv((GLenum)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 354: if(glad_glMultiTexCoord1i == NULL) return 0; glad_glMultiTexCoord1i((GLenum)a[0], (GLint)(long long)a[1]); break;
+	case 355: if(glad_glMultiTexCoord1iv == NULL) return 0; glad_glMultiTexCoord1iv((GLenum)a[0], (const GLint *)(size_t)a[1]); break;
+	case 356: if(glad_glMultiTexCoord1s == NULL) return 0; glad_glMultiTexCoord1s((GLenum)a[0], (GLshort)(long long)a[1]); break;
+	case 357: if(glad_glMultiTexCoord1sv == NULL) return 0; glad_glMultiTexCoord1sv((GLenum)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 358: if(glad_glMultiTexCoord2d == NULL) return 0; glad_glMultiTexCoord2d((GLenum)a[0], (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 359: if(glad_glMultiTexCoord2dv == NULL) return 0; glad_glMultiTexCoord2dv((GLenum)a[0], (const GLdouble *)(size_t)a[1]); break;
+	case 360: if(glad_glMultiTexCoord2f == NULL) return 0; glad_glMultiTexCoord2f((GLenum)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 361: if(glad_glMultiTexCoord2fv == NULL) return 0; glad_glMultiTexCoord2fv((GLenum)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 362: if(glad_glMultiTexCoord2i == NULL) return 0; glad_glMultiTexCoord2i((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 363: if(glad_glMultiTexCoord2iv == NULL) return 0; glad_glMultiTexCoord2iv((GLenum)a[0], (const GLint *)(size_t)a[1]); break;
+	case 364: if(glad_glMultiTexCoord2s == NULL) return 0; glad_glMultiTexCoord2s((GLenum)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2]); break;
+	case 365: if(glad_glMultiTexCoord2sv == NULL) return 0; glad_glMultiTexCoord2sv((GLenum)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 366: if(glad_glMultiTexCoord3d == NULL) return 0; glad_glMultiTexCoord3d((GLenum)a[0], (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3])); break;
+	case 367: if(glad_glMultiTexCoord3dv == NULL) return 0; glad_glMultiTexCoord3dv((GLenum)a[0], (const GLdouble *)(size_t)a[1]); break;
+	case 368: if(glad_glMultiTexCoord3f == NULL) return 0; glad_glMultiTexCoord3f((GLenum)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 369: if(glad_glMultiTexCoord3fv == NULL) return 0; glad_glMultiTexCoord3fv((GLenum)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 370: if(glad_glMultiTexCoord3i == NULL) return 0; glad_glMultiTexCoord3i((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3]); break;
+	case 371: if(glad_glMultiTexCoord3iv == NULL) return 0; glad_glMultiTexCoord3iv((GLenum)a[0], (const GLint *)(size_t)a[1]); break;
+	case 372: if(glad_glMultiTexCoord3s == NULL) return 0; glad_glMultiTexCoord3s((GLenum)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2], (GLshort)(long long)a[3]); break;
+	case 373: if(glad_glMultiTexCoord3sv == NULL) return 0; glad_glMultiTexCoord3sv((GLenum)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 374: if(glad_glMultiTexCoord4d == NULL) return 0; glad_glMultiTexCoord4d((GLenum)a[0], (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3]), (GLdouble)glad_raw_f(a[4])); break;
+	case 375: if(glad_glMultiTexCoord4dv == NULL) return 0; glad_glMultiTexCoord4dv((GLenum)a[0], (const GLdouble *)(size_t)a[1]); break;
+	case 376: if(glad_glMultiTexCoord4f == NULL) return 0; glad_glMultiTexCoord4f((GLenum)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3]), (GLfloat)glad_raw_f(a[4])); break;
+	case 377: if(glad_glMultiTexCoord4fv == NULL) return 0; glad_glMultiTexCoord4fv((GLenum)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 378: if(glad_glMultiTexCoord4i == NULL) return 0; glad_glMultiTexCoord4i((GLenum)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4]); break;
+	case 379: if(glad_glMultiTexCoord4iv == NULL) return 0; glad_glMultiTexCoord4iv((GLenum)a[0], (const GLint *)(size_t)a[1]); break;
+	case 380: if(glad_glMultiTexCoord4s == NULL) return 0; glad_glMultiTexCoord4s((GLenum)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2], (GLshort)(long long)a[3], (GLshort)(long long)a[4]); break;
+	case 381: if(glad_glMultiTexCoord4sv == NULL) return 0; glad_glMultiTexCoord4sv((GLenum)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 382: if(glad_glLoadTransposeMatrixf == NULL) return 0; glad_glLoadTransposeMatrixf((const GLfloat *)(size_t)a[0]); break;
+	case 383: if(glad_glLoadTransposeMatrixd == NULL) return 0; glad_glLoadTransposeMatrixd((const GLdouble *)(size_t)a[0]); break;
+	case 384: if(glad_glMultTransposeMatrixf == NULL) return 0; glad_glMultTransposeMatrixf((const GLfloat *)(size_t)a[0]); break;
+	case 385: if(glad_glMultTransposeMatrixd == NULL) return 0; glad_glMultTransposeMatrixd((const GLdouble *)(size_t)a[0]); break;
+#endif
+	case 386: if(glad_glBlendFuncSeparate == NULL) return 0; glad_glBlendFuncSeparate((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], (GLenum)a[3]); break;
+	case 387: if(glad_glMultiDrawArrays == NULL) return 0; glad_glMultiDrawArrays((GLenum)a[0], (const GLint *)(size_t)a[1], (const GLsizei *)(size_t)a[2], (GLsizei)(long long)a[3]); break;
+	case 388: if(glad_glMultiDrawElements == NULL) return 0; glad_glMultiDrawElements((GLenum)a[0], (const GLsizei *)(size_t)a[1], (GLenum)a[2], (const void *const*)(size_t)a[3], (GLsizei)(long long)a[4]); break;
+	case 389: if(glad_glPointParameterf == NULL) return 0; glad_glPointParameterf((GLenum)a[0], (GLfloat)glad_raw_f(a[1])); break;
+	case 390: if(glad_glPointParameterfv == NULL) return 0; glad_glPointParameterfv((GLenum)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 391: if(glad_glPointParameteri == NULL) return 0; glad_glPointParameteri((GLenum)a[0], (GLint)(long long)a[1]); break;
+	case 392: if(glad_glPointParameteriv == NULL) return 0; glad_glPointParameteriv((GLenum)a[0], (const GLint *)(size_t)a[1]); break;
+#ifndef GLAD_CORE_ONLY
+	case 393: if(glad_glFogCoordf == NULL) return 0; glad_glFogCoordf((GLfloat)glad_raw_f(a[0])); break;
+	case 394: if(glad_glFogCoordfv == NULL) return 0; glad_glFogCoordfv((const GLfloat *)(size_t)a[0]); break;
+	case 395: if(glad_glFogCoordd == NULL) return 0; glad_glFogCoordd((GLdouble)glad_raw_f(a[0])); break;
+	case 396: if(glad_glFogCoorddv == NULL) return 0; glad_glFogCoorddv((const GLdouble *)(size_t)a[0]); break;
+	case 397: if(glad_glFogCoordPointer == NULL) return 0; glad_glFogCoordPointer((GLenum)a[0], (GLsizei)(long long)a[1], (const void *)(size_t)a[2]); break;
+	case 398: if(glad_glSecondaryColor3b == NULL) return 0; glad_glSecondaryColor3b((GLbyte)(long long)a[0], (GLbyte)(long long)a[1], (GLbyte)(long long)a[2]); break;
+	case 399: if(glad_glSecondaryColor3bv == NULL) return 0; glad_glSecondaryColor3bv((const GLbyte *)(size_t)a[0]); break;
+	case 400: if(glad_glSecondaryColor3d == NULL) return 0; glad_glSecondaryColor3d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 401: if(glad_glSecondaryColor3dv == NULL) return 0; glad_glSecondaryColor3dv((const GLdouble *)(size_t)a[0]); break;
+	case 402: if(glad_glSecondaryColor3f == NULL) return 0; glad_glSecondaryColor3f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 403: if(glad_glSecondaryColor3fv == NULL) return 0; glad_glSecondaryColor3fv((const GLfloat *)(size_t)a[0]); break;
+	case 404: if(glad_glSecondaryColor3i == NULL) return 0; glad_glSecondaryColor3i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 405: if(glad_glSecondaryColor3iv == NULL) return 0; glad_glSecondaryColor3iv((const GLint *)(size_t)a[0]); break;
+	case 406: if(glad_glSecondaryColor3s == NULL) return 0; glad_glSecondaryColor3s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2]); break;
+	case 407: if(glad_glSecondaryColor3sv == NULL) return 0; glad_glSecondaryColor3sv((const GLshort *)(size_t)a[0]); break;
+	case 408: if(glad_glSecondaryColor3ub == NULL) return 0; glad_glSecondaryColor3ub((GLubyte)a[0], (GLubyte)a[1], (GLubyte)a[2]); break;
+	case 409: if(glad_glSecondaryColor3ubv == NULL) return 0; glad_glSecondaryColor3ubv((const GLubyte *)(size_t)a[0]); break;
+	case 410: if(glad_glSecondaryColor3ui == NULL) return 0; glad_glSecondaryColor3ui((GLuint)a[0], (GLuint)a[1], (GLuint)a[2]); break;
+	case 411: if(glad_glSecondaryColor3uiv == NULL) return 0; glad_glSecondaryColor3uiv((const GLuint *)(size_t)a[0]); break;
+	case 412: if(glad_glSecondaryColor3us == NULL) return 0; glad_glSecondaryColor3us((GLushort)a[0], (GLushort)a[1], (GLushort)a[2]); break;
+	case 413: if(glad_glSecondaryColor3usv == NULL) return 0; glad_glSecondaryColor3usv((const GLushort *)(size_t)a[0]); break;
+	case 414: if(glad_glSecondaryColorPointer == NULL) return 0; glad_glSecondaryColorPointer((GLint)(long long)a[0], (GLenum)a[1], (GLsizei)(long long)a[2], (const void *)(size_t)a[3]); break;
+	case 415: if(glad_glWindowPos2d == NULL) return 0; glad_glWindowPos2d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1])); break;
+	case 416: if(glad_glWindowPos2dv == NULL) return 0; glad_glWindowPos2dv((const GLdouble *)(size_t)a[0]); break;
+	case 417: if(glad_glWindowPos2f == NULL) return 0; glad_glWindowPos2f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1])); break;
+	case 418: if(glad_glWindowPos2fv == NULL) return 0; glad_glWindowPos2fv((const GLfloat *)(size_t)a[0]); break;
+	case 419: if(glad_glWindowPos2i == NULL) return 0; glad_glWindowPos2i((GLint)(long long)a[0], (GLint)(long long)a[1]); break;
+	case 420: if(glad_glWindowPos2iv == NULL) return 0; glad_glWindowPos2iv((const GLint *)(size_t)a[0]); break;
+	case 421: if(glad_glWindowPos2s == NULL) return 0; glad_glWindowPos2s((GLshort)(long long)a[0], (GLshort)(long long)a[1]); break;
+	case 422: if(glad_glWindowPos2sv == NULL) return 0; glad_glWindowPos2sv((const GLshort *)(size_t)a[0]); break;
+	case 423: if(glad_glWindowPos3d == NULL) return 0; glad_glWindowPos3d((GLdouble)glad_raw_f(a[0]), (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 424: if(glad_glWindowPos3dv == NULL) return 0; glad_glWindowPos3dv((const GLdouble *)(size_t)a[0]); break;
+	case 425: if(glad_glWindowPos3f == NULL) return 0; glad_glWindowPos3f((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 426: if(glad_glWindowPos3fv == NULL) return 0; glad_glWindowPos3fv((const GLfloat *)(size_t)a[0]); break;
+	case 427: if(glad_glWindowPos3i == NULL) return 0; glad_glWindowPos3i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 428: if(glad_glWindowPos3iv == NULL) return 0; glad_glWindowPos3iv((const GLint *)(size_t)a[0]); break;
+	case 429: if(glad_glWindowPos3s == NULL) return 0; glad_glWindowPos3s((GLshort)(long long)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2]); break;
+	case 430: if(glad_glWindowPos3sv == NULL) return 0; glad_glWindowPos3sv((const GLshort *)(size_t)a[0]); break;
+#endif
+	case 431: if(glad_glBlendColor == NULL) return 0; glad_glBlendColor((GLfloat)glad_raw_f(a[0]), (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 432: if(glad_glBlendEquation == NULL) return 0; glad_glBlendEquation((GLenum)a[0]); break;
+	case 433: if(glad_glGenQueries == NULL) return 0; glad_glGenQueries((GLsizei)(long long)a[0], (GLuint *)(size_t)a[1]); break;
+	case 434: if(glad_glDeleteQueries == NULL) return 0; glad_glDeleteQueries((GLsizei)(long long)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 435: if(glad_glIsQuery == NULL) return 0; call->result = glad_arg_u(glad_glIsQuery((GLuint)a[0])); break;
+	case 436: if(glad_glBeginQuery == NULL) return 0; glad_glBeginQuery((GLenum)a[0], (GLuint)a[1]); break;
+	case 437: if(glad_glEndQuery == NULL) return 0; glad_glEndQuery((GLenum)a[0]); break;
+	case 438: if(glad_glGetQueryiv == NULL) return 0; glad_glGetQueryiv((GLenum)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 439: if(glad_glGetQueryObjectiv == NULL) return 0; glad_glGetQueryObjectiv((GLuint)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 440: if(glad_glGetQueryObjectuiv == NULL) return 0; glad_glGetQueryObjectuiv((GLuint)a[0], (GLenum)a[1], (GLuint *)(size_t)a[2]); break;
+	case 441: if(glad_glBindBuffer == NULL) return 0; glad_glBindBuffer((GLenum)a[0], (GLuint)a[1]); break;
+	case 442: if(glad_glDeleteBuffers == NULL) return 0; glad_glDeleteBuffers((GLsizei)(long long)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 443: if(glad_glGenBuffers == NULL) return 0; glad_glGenBuffers((GLsizei)(long long)a[0], (GLuint *)(size_t)a[1]); break;
+	case 444: if(glad_glIsBuffer == NULL) return 0; call->result = glad_arg_u(glad_glIsBuffer((GLuint)a[0])); break;
+	case 445: if(glad_glBufferData == NULL) return 0; glad_glBufferData((GLenum)a[0], (GLsizeiptr)(long long)a[1], (const void *)(size_t)a[2], (GLenum)a[3]); break;
+	case 446: if(glad_glBufferSubData == NULL) return 0; glad_glBufferSubData((GLenum)a[0], (GLintptr)(long long)a[1], (GLsizeiptr)(long long)a[2], (const void *)(size_t)a[3]); break;
+	case 447: if(glad_glGetBufferSubData == NULL) return 0; glad_glGetBufferSubData((GLenum)a[0], (GLintptr)(long long)a[1], (GLsizeiptr)(long long)a[2], (void *)(size_t)a[3]); break;
+	case 448: if(glad_glMapBuffer == NULL) return 0; call->result = glad_arg_p(glad_glMapBuffer((GLenum)a[0], (GLenum)a[1])); break;
+	case 449: if(glad_glUnmapBuffer == NULL) return 0; call->result = glad_arg_u(glad_glUnmapBuffer((GLenum)a[0])); break;
+	case 450: if(glad_glGetBufferParameteriv == NULL) return 0; glad_glGetBufferParameteriv((GLenum)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 451: if(glad_glGetBufferPointerv == NULL) return 0; glad_glGetBufferPointerv((GLenum)a[0], (GLenum)a[1], (void **)(size_t)a[2]); break;
+	case 452: if(glad_glBlendEquationSeparate == NULL) return 0; glad_glBlendEquationSeparate((GLenum)a[0], (GLenum)a[1]); break;
+	case 453: if(glad_glDrawBuffers == NULL) return 0; glad_glDrawBuffers((GLsizei)(long long)a[0], (const GLenum *)(size_t)a[1]); break;
+	case 454: if(glad_glStencilOpSeparate == NULL) return 0; glad_glStencilOpSeparate((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], (GLenum)a[3]); break;
+	case 455: if(glad_glStencilFuncSeparate == NULL) return 0; glad_glStencilFuncSeparate((GLenum)a[0], (GLenum)a[1], (GLint)(long long)a[2], (GLuint)a[3]); break;
+	case 456: if(glad_glStencilMaskSeparate == NULL) return 0; glad_glStencilMaskSeparate((GLenum)a[0], (GLuint)a[1]); break;
+	case 457: if(glad_glAttachShader == NULL) return 0; glad_glAttachShader((GLuint)a[0], (GLuint)a[1]); break;
+	case 458: if(glad_glBindAttribLocation == NULL) return 0; glad_glBindAttribLocation((GLuint)a[0], (GLuint)a[1], (const GLchar *)(size_t)a[2]); break;
+	case 459: if(glad_glCompileShader == NULL) return 0; glad_glCompileShader((GLuint)a[0]); break;
+	case 460: if(glad_glCreateProgram == NULL) return 0; call->result = glad_arg_u(glad_glCreateProgram()); break;
+	case 461: if(glad_glCreateShader == NULL) return 0; call->result = glad_arg_u(glad_glCreateShader((GLenum)a[0])); break;
+	case 462: if(glad_glDeleteProgram == NULL) return 0; glad_glDeleteProgram((GLuint)a[0]); break;
+	case 463: if(glad_glDeleteShader == NULL) return 0; glad_glDeleteShader((GLuint)a[0]); break;
+	case 464: if(glad_glDetachShader == NULL) return 0; glad_glDetachShader((GLuint)a[0], (GLuint)a[1]); break;
+	case 465: if(glad_glDisableVertexAttribArray == NULL) return 0; glad_glDisableVertexAttribArray((GLuint)a[0]); break;
+	case 466: if(glad_glEnableVertexAttribArray == NULL) return 0; glad_glEnableVertexAttribArray((GLuint)a[0]); break;
+	case 467: if(glad_glGetActiveAttrib == NULL) return 0; glad_glGetActiveAttrib((GLuint)a[0], (GLuint)a[1], (GLsizei)(long long)a[2], (GLsizei *)(size_t)a[3], (GLint *)(size_t)a[4], (GLenum *)(size_t)a[5], (GLchar *)(size_t)a[6]); break;
+	case 468: if(glad_glGetActiveUniform == NULL) return 0; glad_glGetActiveUniform((GLuint)a[0], (GLuint)a[1], (GLsizei)(long long)a[2], (GLsizei *)(size_t)a[3], (GLint *)(size_t)a[4], (GLenum *)(size_t)a[5], (GLchar *)(size_t)a[6]); break;
+	case 469: if(glad_glGetAttachedShaders == NULL) return 0; glad_glGetAttachedShaders((GLuint)a[0], (GLsizei)(long long)a[1], (GLsizei *)(size_t)a[2], (GLuint *)(size_t)a[3]); break;
+	case 470: if(glad_glGetAttribLocation == NULL) return 0; call->result = glad_arg_i(glad_glGetAttribLocation((GLuint)a[0], (const GLchar *)(size_t)a[1])); break;
+	case 471: if(glad_glGetProgramiv == NULL) return 0; glad_glGetProgramiv((GLuint)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 472: if(glad_glGetProgramInfoLog == NULL) return 0; glad_glGetProgramInfoLog((GLuint)a[0], (GLsizei)(long long)a[1], (GLsizei *)(size_t)a[2], (GLchar *)(size_t)a[3]); break;
+	case 473: if(glad_glGetShaderiv == NULL) return 0; glad_glGetShaderiv((GLuint)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 474: if(glad_glGetShaderInfoLog == NULL) return 0; glad_glGetShaderInfoLog((GLuint)a[0], (GLsizei)(long long)a[1], (GLsizei *)(size_t)a[2], (GLchar *)(size_t)a[3]); break;
+	case 475: if(glad_glGetShaderSource == NULL) return 0; glad_glGetShaderSource((GLuint)a[0], (GLsizei)(long long)a[1], (GLsizei *)(size_t)a[2], (GLchar *)(size_t)a[3]); break;
+	case 476: if(glad_glGetUniformLocation == NULL) return 0; call->result = glad_arg_i(glad_glGetUniformLocation((GLuint)a[0], (const GLchar *)(size_t)a[1])); break;
+	case 477: if(glad_glGetUniformfv == NULL) return 0; glad_glGetUniformfv((GLuint)a[0], (GLint)(long long)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 478: if(glad_glGetUniformiv == NULL) return 0; glad_glGetUniformiv((GLuint)a[0], (GLint)(long long)a[1], (GLint *)(size_t)a[2]); break;
+	case 479: if(glad_glGetVertexAttribdv == NULL) return 0; glad_glGetVertexAttribdv((GLuint)a[0], (GLenum)a[1], (GLdouble *)(size_t)a[2]); break;
+	case 480: if(glad_glGetVertexAttribfv == NULL) return 0; glad_glGetVertexAttribfv((GLuint)a[0], (GLenum)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 481: if(glad_glGetVertexAttribiv == NULL) return 0; glad_glGetVertexAttribiv((GLuint)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 482: if(glad_glGetVertexAttribPointerv == NULL) return 0; glad_glGetVertexAttribPointerv((GLuint)a[0], (GLenum)a[1], (void **)(size_t)a[2]); break;
+	case 483: if(glad_glIsProgram == NULL) return 0; call->result = glad_arg_u(glad_glIsProgram((GLuint)a[0])); break;
+	case 484: if(glad_glIsShader == NULL) return 0; call->result = glad_arg_u(glad_glIsShader((GLuint)a[0])); break;
+	case 485: if(glad_glLinkProgram == NULL) return 0; glad_glLinkProgram((GLuint)a[0]); break;
+	case 486: if(glad_glShaderSource == NULL) return 0; glad_glShaderSource((GLuint)a[0], (GLsizei)(long long)a[1], (const GLchar *const*)(size_t)a[2], (const GLint *)(size_t)a[3]); break;
+	case 487: if(glad_glUseProgram == NULL) return 0; glad_glUseProgram((GLuint)a[0]); break;
+	case 488: if(glad_glUniform1f == NULL) return 0; glad_glUniform1f((GLint)(long long)a[0], (GLfloat)glad_raw_f(a[1])); break;
+	case 489: if(glad_glUniform2f == NULL) return 0; glad_glUniform2f((GLint)(long long)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 490: if(glad_glUniform3f == NULL) return 0; glad_glUniform3f((GLint)(long long)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 491: if(glad_glUniform4f == NULL) return 0; glad_glUniform4f((GLint)(long long)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3]), (GLfloat)glad_raw_f(a[4])); break;
+	case 492: if(glad_glUniform1i == NULL) return 0; glad_glUniform1i((GLint)(long long)a[0], (GLint)(long long)a[1]); break;
+	case 493: if(glad_glUniform2i == NULL) return 0; glad_glUniform2i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 494: if(glad_glUniform3i == NULL) return 0; glad_glUniform3i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3]); break;
+	case 495: if(glad_glUniform4i == NULL) return 0; glad_glUniform4i((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4]); break;
+	case 496: if(glad_glUniform1fv == NULL) return 0; glad_glUniform1fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 497: if(glad_glUniform2fv == NULL) return 0; glad_glUniform2fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 498: if(glad_glUniform3fv == NULL) return 0; glad_glUniform3fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 499: if(glad_glUniform4fv == NULL) return 0; glad_glUniform4fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 500: if(glad_glUniform1iv == NULL) return 0; glad_glUniform1iv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLint *)(size_t)a[2]); break;
+	case 501: if(glad_glUniform2iv == NULL) return 0; glad_glUniform2iv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLint *)(size_t)a[2]); break;
+	case 502: if(glad_glUniform3iv == NULL) return 0; glad_glUniform3iv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLint *)(size_t)a[2]); break;
+	case 503: if(glad_glUniform4iv == NULL) return 0; glad_glUniform4iv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLint *)(size_t)a[2]); break;
+	case 504: if(glad_glUniformMatrix2fv == NULL) return 0; glad_glUniformMatrix2fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (GLboolean)a[2], (const GLfloat *)(size_t)a[3]); break;
+	case 505: if(glad_glUniformMatrix3fv == NULL) return 0; glad_glUniformMatrix3fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (GLboolean)a[2], (const GLfloat *)(size_t)a[3]); break;
+	case 506: if(glad_glUniformMatrix4fv == NULL) return 0; glad_glUniformMatrix4fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (GLboolean)a[2], (const GLfloat *)(size_t)a[3]); break;
+	case 507: if(glad_glValidateProgram == NULL) return 0; glad_glValidateProgram((GLuint)a[0]); break;
+	case 508: if(glad_glVertexAttrib1d == NULL) return 0; glad_glVertexAttrib1d((GLuint)a[0], (GLdouble)glad_raw_f(a[1])); break;
+	case 509: if(glad_glVertexAttrib1dv == NULL) return 0; glad_glVertexAttrib1dv((GLuint)a[0], (const GLdouble *)(size_t)a[1]); break;
+	case 510: if(glad_glVertexAttrib1f == NULL) return 0; glad_glVertexAttrib1f((GLuint)a[0], (GLfloat)glad_raw_f(a[1])); break;
+	case 511: if(glad_glVertexAttrib1fv == NULL) return 0; glad_glVertexAttrib1fv((GLuint)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 512: if(glad_glVertexAttrib1s == NULL) return 0; glad_glVertexAttrib1s((GLuint)a[0], (GLshort)(long long)a[1]); break;
+	case 513: if(glad_glVertexAttrib1sv == NULL) return 0; glad_glVertexAttrib1sv((GLuint)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 514: if(glad_glVertexAttrib2d == NULL) return 0; glad_glVertexAttrib2d((GLuint)a[0], (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2])); break;
+	case 515: if(glad_glVertexAttrib2dv == NULL) return 0; glad_glVertexAttrib2dv((GLuint)a[0], (const GLdouble *)(size_t)a[1]); break;
+	case 516: if(glad_glVertexAttrib2f == NULL) return 0; glad_glVertexAttrib2f((GLuint)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2])); break;
+	case 517: if(glad_glVertexAttrib2fv == NULL) return 0; glad_glVertexAttrib2fv((GLuint)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 518: if(glad_glVertexAttrib2s == NULL) return 0; glad_glVertexAttrib2s((GLuint)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2]); break;
+	case 519: if(glad_glVertexAttrib2sv == NULL) return 0; glad_glVertexAttrib2sv((GLuint)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 520: if(glad_glVertexAttrib3d == NULL) return 0; glad_glVertexAttrib3d((GLuint)a[0], (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3])); break;
+	case 521: if(glad_glVertexAttrib3dv == NULL) return 0; glad_glVertexAttrib3dv((GLuint)a[0], (const GLdouble *)(size_t)a[1]); break;
+	case 522: if(glad_glVertexAttrib3f == NULL) return 0; glad_glVertexAttrib3f((GLuint)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3])); break;
+	case 523: if(glad_glVertexAttrib3fv == NULL) return 0; glad_glVertexAttrib3fv((GLuint)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 524: if(glad_glVertexAttrib3s == NULL) return 0; glad_glVertexAttrib3s((GLuint)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2], (GLshort)(long long)a[3]); break;
+	case 525: if(glad_glVertexAttrib3sv == NULL) return 0; glad_glVertexAttrib3sv((GLuint)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 526: if(glad_glVertexAttrib4Nbv == NULL) return 0; glad_glVertexAttrib4Nbv((GLuint)a[0], (const GLbyte *)(size_t)a[1]); break;
+	case 527: if(glad_glVertexAttrib4Niv == NULL) return 0; glad_glVertexAttrib4Niv((GLuint)a[0], (const GLint *)(size_t)a[1]); break;
+	case 528: if(glad_glVertexAttrib4Nsv == NULL) return 0; glad_glVertexAttrib4Nsv((GLuint)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 529: if(glad_glVertexAttrib4Nub == NULL) return 0; glad_glVertexAttrib4Nub((GLuint)a[0], (GLubyte)a[1], (GLubyte)a[2], (GLubyte)a[3], (GLubyte)a[4]); break;
+	case 530: if(glad_glVertexAttrib4Nubv == NULL) return 0; glad_glVertexAttrib4Nubv((GLuint)a[0], (const GLubyte *)(size_t)a[1]); break;
+	case 531: if(glad_glVertexAttrib4Nuiv == NULL) return 0; glad_glVertexAttrib4Nuiv((GLuint)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 532: if(glad_glVertexAttrib4Nusv == NULL) return 0; glad_glVertexAttrib4Nusv((GLuint)a[0], (const GLushort *)(size_t)a[1]); break;
+	case 533: if(glad_glVertexAttrib4bv == NULL) return 0; glad_glVertexAttrib4bv((GLuint)a[0], (const GLbyte *)(size_t)a[1]); break;
+	case 534: if(glad_glVertexAttrib4d == NULL) return 0; glad_glVertexAttrib4d((GLuint)a[0], (GLdouble)glad_raw_f(a[1]), (GLdouble)glad_raw_f(a[2]), (GLdouble)glad_raw_f(a[3]), (GLdouble)glad_raw_f(a[4])); break;
+	case 535: if(glad_glVertexAttrib4dv == NULL) return 0; glad_glVertexAttrib4dv((GLuint)a[0], (const GLdouble *)(size_t)a[1]); break;
+	case 536: if(glad_glVertexAttrib4f == NULL) return 0; glad_glVertexAttrib4f((GLuint)a[0], (GLfloat)glad_raw_f(a[1]), (GLfloat)glad_raw_f(a[2]), (GLfloat)glad_raw_f(a[3]), (GLfloat)glad_raw_f(a[4])); break;
+	case 537: if(glad_glVertexAttrib4fv == NULL) return 0; glad_glVertexAttrib4fv((GLuint)a[0], (const GLfloat *)(size_t)a[1]); break;
+	case 538: if(glad_glVertexAttrib4iv == NULL) return 0; glad_glVertexAttrib4iv((GLuint)a[0], (const GLint *)(size_t)a[1]); break;
+	case 539: if(glad_glVertexAttrib4s == NULL) return 0; glad_glVertexAttrib4s((GLuint)a[0], (GLshort)(long long)a[1], (GLshort)(long long)a[2], (GLshort)(long long)a[3], (GLshort)(long long)a[4]); break;
+	case 540: if(glad_glVertexAttrib4sv == NULL) return 0; glad_glVertexAttrib4sv((GLuint)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 541: if(glad_glVertexAttrib4ubv == NULL) return 0; glad_glVertexAttrib4ubv((GLuint)a[0], (const GLubyte *)(size_t)a[1]); break;
+	case 542: if(glad_glVertexAttrib4uiv == NULL) return 0; glad_glVertexAttrib4uiv((GLuint)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 543: if(glad_glVertexAttrib4usv == NULL) return 0; glad_glVertexAttrib4usv((GLuint)a[0], (const GLushort *)(size_t)a[1]); break;
+	case 544: if(glad_glVertexAttribPointer == NULL) return 0; glad_glVertexAttribPointer((GLuint)a[0], (GLint)(long long)a[1], (GLenum)a[2], (GLboolean)a[3], (GLsizei)(long long)a[4], (const void *)(size_t)a[5]); break;
+	case 545: if(glad_glUniformMatrix2x3fv == NULL) return 0; glad_glUniformMatrix2x3fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (GLboolean)a[2], (const GLfloat *)(size_t)a[3]); break;
+	case 546: if(glad_glUniformMatrix3x2fv == NULL) return 0; glad_glUniformMatrix3x2fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (GLboolean)a[2], (const GLfloat *)(size_t)a[3]); break;
+	case 547: if(glad_glUniformMatrix2x4fv == NULL) return 0; glad_glUniformMatrix2x4fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (GLboolean)a[2], (const GLfloat *)(size_t)a[3]); break;
+	case 548: if(glad_glUniformMatrix4x2fv == NULL) return 0; glad_glUniformMatrix4x2fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (GLboolean)a[2], (const GLfloat *)(size_t)a[3]); break;
+	case 549: if(glad_glUniformMatrix3x4fv == NULL) return 0; glad_glUniformMatrix3x4fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (GLboolean)a[2], (const GLfloat *)(size_t)a[3]); break;
+	case 550: if(glad_glUniformMatrix4x3fv == NULL) return 0; glad_glUniformMatrix4x3fv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (GLboolean)a[2], (const GLfloat *)(size_t)a[3]); break;
+	case 551: if(glad_glColorMaski == NULL) return 0; glad_glColorMaski((GLuint)a[0], (GLboolean)a[1], (GLboolean)a[2], (GLboolean)a[3], (GLboolean)a[4]); break;
+	case 552: if(glad_glGetBooleani_v == NULL) return 0; glad_glGetBooleani_v((GLenum)a[0], (GLuint)a[1], (GLboolean *)(size_t)a[2]); break;
+	case 553: if(glad_glGetIntegeri_v == NULL) return 0; glad_glGetIntegeri_v((GLenum)a[0], (GLuint)a[1], (GLint *)(size_t)a[2]); break;
+	case 554: if(glad_glEnablei == NULL) return 0; glad_glEnablei((GLenum)a[0], (GLuint)a[1]); break;
+	case 555: if(glad_glDisablei == NULL) return 0; glad_glDisablei((GLenum)a[0], (GLuint)a[1]); break;
+	case 556: if(glad_glIsEnabledi == NULL) return 0; call->result = glad_arg_u(glad_glIsEnabledi((GLenum)a[0], (GLuint)a[1])); break;
+	case 557: if(glad_glBeginTransformFeedback == NULL) return 0; glad_glBeginTransformFeedback((GLenum)a[0]); break;
+	case 558: if(glad_glEndTransformFeedback == NULL) return 0; glad_glEndTransformFeedback(); break;
+	case 559: if(glad_glBindBufferRange == NULL) return 0; glad_glBindBufferRange((GLenum)a[0], (GLuint)a[1], (GLuint)a[2], (GLintptr)(long long)a[3], (GLsizeiptr)(long long)a[4]); break;
+	case 560: if(glad_glBindBufferBase == NULL) return 0; glad_glBindBufferBase((GLenum)a[0], (GLuint)a[1], (GLuint)a[2]); break;
+	case 561: if(glad_glTransformFeedbackVaryings == NULL) return 0; glad_glTransformFeedbackVaryings((GLuint)a[0], (GLsizei)(long long)a[1], (const GLchar *const*)(size_t)a[2], (GLenum)a[3]); break;
+	case 562: if(glad_glGetTransformFeedbackVarying == NULL) return 0; glad_glGetTransformFeedbackVarying((GLuint)a[0], (GLuint)a[1], (GLsizei)(long long)a[2], (GLsizei *)(size_t)a[3], (GLsizei *)(size_t)a[4], (GLenum *)(size_t)a[5], (GLchar *)(size_t)a[6]); break;
+	case 563: if(glad_glClampColor == NULL) return 0; glad_glClampColor((GLenum)a[0], (GLenum)a[1]); break;
+	case 564: if(glad_glBeginConditionalRender == NULL) return 0; glad_glBeginConditionalRender((GLuint)a[0], (GLenum)a[1]); break;
+	case 565: if(glad_glEndConditionalRender == NULL) return 0; glad_glEndConditionalRender(); break;
+	case 566: if(glad_glVertexAttribIPointer == NULL) return 0; glad_glVertexAttribIPointer((GLuint)a[0], (GLint)(long long)a[1], (GLenum)a[2], (GLsizei)(long long)a[3], (const void *)(size_t)a[4]); break;
+	case 567: if(glad_glGetVertexAttribIiv == NULL) return 0; glad_glGetVertexAttribIiv((GLuint)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 568: if(glad_glGetVertexAttribIuiv == NULL) return 0; glad_glGetVertexAttribIuiv((GLuint)a[0], (GLenum)a[1], (GLuint *)(size_t)a[2]); break;
+	case 569: if(glad_glVertexAttribI1i == NULL) return 0; glad_glVertexAttribI1i((GLuint)a[0], (GLint)(long long)a[1]); break;
+	case 570: if(glad_glVertexAttribI2i == NULL) return 0; glad_glVertexAttribI2i((GLuint)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2]); break;
+	case 571: if(glad_glVertexAttribI3i == NULL) return 0; glad_glVertexAttribI3i((GLuint)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3]); break;
+	case 572: if(glad_glVertexAttribI4i == NULL) return 0; glad_glVertexAttribI4i((GLuint)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4]); break;
+	case 573: if(glad_glVertexAttribI1ui == NULL) return 0; glad_glVertexAttribI1ui((GLuint)a[0], (GLuint)a[1]); break;
+	case 574: if(glad_glVertexAttribI2ui == NULL) return 0; glad_glVertexAttribI2ui((GLuint)a[0], (GLuint)a[1], (GLuint)a[2]); break;
+	case 575: if(glad_glVertexAttribI3ui == NULL) return 0; glad_glVertexAttribI3ui((GLuint)a[0], (GLuint)a[1], (GLuint)a[2], (GLuint)a[3]); break;
+	case 576: if(glad_glVertexAttribI4ui == NULL) return 0; glad_glVertexAttribI4ui((GLuint)a[0], (GLuint)a[1], (GLuint)a[2], (GLuint)a[3], (GLuint)a[4]); break;
+	case 577: if(glad_glVertexAttribI1iv == NULL) return 0; glad_glVertexAttribI1iv((GLuint)a[0], (const GLint *)(size_t)a[1]); break;
+	case 578: if(glad_glVertexAttribI2iv == NULL) return 0; glad_glVertexAttribI2iv((GLuint)a[0], (const GLint *)(size_t)a[1]); break;
+	case 579: if(glad_glVertexAttribI3iv == NULL) return 0; glad_glVertexAttribI3iv((GLuint)a[0], (const GLint *)(size_t)a[1]); break;
+	case 580: if(glad_glVertexAttribI4iv == NULL) return 0; glad_glVertexAttribI4iv((GLuint)a[0], (const GLint *)(size_t)a[1]); break;
+	case 581: if(glad_glVertexAttribI1uiv == NULL) return 0; glad_glVertexAttribI1uiv((GLuint)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 582: if(glad_glVertexAttribI2uiv == NULL) return 0; glad_glVertexAttribI2uiv((GLuint)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 583: if(glad_glVertexAttribI3uiv == NULL) return 0; glad_glVertexAttribI3uiv((GLuint)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 584: if(glad_glVertexAttribI4uiv == NULL) return 0; glad_glVertexAttribI4uiv((GLuint)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 585: if(glad_glVertexAttribI4bv == NULL) return 0; glad_glVertexAttribI4bv((GLuint)a[0], (const GLbyte *)(size_t)a[1]); break;
+	case 586: if(glad_glVertexAttribI4sv == NULL) return 0; glad_glVertexAttribI4sv((GLuint)a[0], (const GLshort *)(size_t)a[1]); break;
+	case 587: if(glad_glVertexAttribI4ubv == NULL) return 0; glad_glVertexAttribI4ubv((GLuint)a[0], (const GLubyte *)(size_t)a[1]); break;
+	case 588: if(glad_glVertexAttribI4usv == NULL) return 0; glad_glVertexAttribI4usv((GLuint)a[0], (const GLushort *)(size_t)a[1]); break;
+	case 589: if(glad_glGetUniformuiv == NULL) return 0; glad_glGetUniformuiv((GLuint)a[0], (GLint)(long long)a[1], (GLuint *)(size_t)a[2]); break;
+	case 590: if(glad_glBindFragDataLocation == NULL) return 0; glad_glBindFragDataLocation((GLuint)a[0], (GLuint)a[1], (const GLchar *)(size_t)a[2]); break;
+	case 591: if(glad_glGetFragDataLocation == NULL) return 0; call->result = glad_arg_i(glad_glGetFragDataLocation((GLuint)a[0], (const GLchar *)(size_t)a[1])); break;
+	case 592: if(glad_glUniform1ui == NULL) return 0; glad_glUniform1ui((GLint)(long long)a[0], (GLuint)a[1]); break;
+	case 593: if(glad_glUniform2ui == NULL) return 0; glad_glUniform2ui((GLint)(long long)a[0], (GLuint)a[1], (GLuint)a[2]); break;
+	case 594: if(glad_glUniform3ui == NULL) return 0; glad_glUniform3ui((GLint)(long long)a[0], (GLuint)a[1], (GLuint)a[2], (GLuint)a[3]); break;
+	case 595: if(glad_glUniform4ui == NULL) return 0; glad_glUniform4ui((GLint)(long long)a[0], (GLuint)a[1], (GLuint)a[2], (GLuint)a[3], (GLuint)a[4]); break;
+	case 596: if(glad_glUniform1uiv == NULL) return 0; glad_glUniform1uiv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 597: if(glad_glUniform2uiv == NULL) return 0; glad_glUniform2uiv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 598: if(glad_glUniform3uiv == NULL) return 0; glad_glUniform3uiv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 599: if(glad_glUniform4uiv == NULL) return 0; glad_glUniform4uiv((GLint)(long long)a[0], (GLsizei)(long long)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 600: if(glad_glTexParameterIiv == NULL) return 0; glad_glTexParameterIiv((GLenum)a[0], (GLenum)a[1], (const GLint *)(size_t)a[2]); break;
+	case 601: if(glad_glTexParameterIuiv == NULL) return 0; glad_glTexParameterIuiv((GLenum)a[0], (GLenum)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 602: if(glad_glGetTexParameterIiv == NULL) return 0; glad_glGetTexParameterIiv((GLenum)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 603: if(glad_glGetTexParameterIuiv == NULL) return 0; glad_glGetTexParameterIuiv((GLenum)a[0], (GLenum)a[1], (GLuint *)(size_t)a[2]); break;
+	case 604: if(glad_glClearBufferiv == NULL) return 0; glad_glClearBufferiv((GLenum)a[0], (GLint)(long long)a[1], (const GLint *)(size_t)a[2]); break;
+	case 605: if(glad_glClearBufferuiv == NULL) return 0; glad_glClearBufferuiv((GLenum)a[0], (GLint)(long long)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 606: if(glad_glClearBufferfv == NULL) return 0; glad_glClearBufferfv((GLenum)a[0], (GLint)(long long)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 607: if(glad_glClearBufferfi == NULL) return 0; glad_glClearBufferfi((GLenum)a[0], (GLint)(long long)a[1], (GLfloat)glad_raw_f(a[2]), (GLint)(long long)a[3]); break;
+	case 608: if(glad_glGetStringi == NULL) return 0; call->result = glad_arg_p(glad_glGetStringi((GLenum)a[0], (GLuint)a[1])); break;
+	case 609: if(glad_glIsRenderbuffer == NULL) return 0; call->result = glad_arg_u(glad_glIsRenderbuffer((GLuint)a[0])); break;
+	case 610: if(glad_glBindRenderbuffer == NULL) return 0; glad_glBindRenderbuffer((GLenum)a[0], (GLuint)a[1]); break;
+	case 611: if(glad_glDeleteRenderbuffers == NULL) return 0; glad_glDeleteRenderbuffers((GLsizei)(long long)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 612: if(glad_glGenRenderbuffers == NULL) return 0; glad_glGenRenderbuffers((GLsizei)(long long)a[0], (GLuint *)(size_t)a[1]); break;
+	case 613: if(glad_glRenderbufferStorage == NULL) return 0; glad_glRenderbufferStorage((GLenum)a[0], (GLenum)a[1], (GLsizei)(long long)a[2], (GLsizei)(long long)a[3]); break;
+	case 614: if(glad_glGetRenderbufferParameteriv == NULL) return 0; glad_glGetRenderbufferParameteriv((GLenum)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 615: if(glad_glIsFramebuffer == NULL) return 0; call->result = glad_arg_u(glad_glIsFramebuffer((GLuint)a[0])); break;
+	case 616: if(glad_glBindFramebuffer == NULL) return 0; glad_glBindFramebuffer((GLenum)a[0], (GLuint)a[1]); break;
+	case 617: if(glad_glDeleteFramebuffers == NULL) return 0; glad_glDeleteFramebuffers((GLsizei)(long long)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 618: if(glad_glGenFramebuffers == NULL) return 0; glad_glGenFramebuffers((GLsizei)(long long)a[0], (GLuint *)(size_t)a[1]); break;
+	case 619: if(glad_glCheckFramebufferStatus == NULL) return 0; call->result = glad_arg_u(glad_glCheckFramebufferStatus((GLenum)a[0])); break;
+	case 620: if(glad_glFramebufferTexture1D == NULL) return 0; glad_glFramebufferTexture1D((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], (GLuint)a[3], (GLint)(long long)a[4]); break;
+	case 621: if(glad_glFramebufferTexture2D == NULL) return 0; glad_glFramebufferTexture2D((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], (GLuint)a[3], (GLint)(long long)a[4]); break;
+	case 622: if(glad_glFramebufferTexture3D == NULL) return 0; glad_glFramebufferTexture3D((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], (GLuint)a[3], (GLint)(long long)a[4], (GLint)(long long)a[5]); break;
+	case 623: if(glad_glFramebufferRenderbuffer == NULL) return 0; glad_glFramebufferRenderbuffer((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], (GLuint)a[3]); break;
+	case 624: if(glad_glGetFramebufferAttachmentParameteriv == NULL) return 0; glad_glGetFramebufferAttachmentParameteriv((GLenum)a[0], (GLenum)a[1], (GLenum)a[2], (GLint *)(size_t)a[3]); break;
+	case 625: if(glad_glGenerateMipmap == NULL) return 0; glad_glGenerateMipmap((GLenum)a[0]); break;
+	case 626: if(glad_glBlitFramebuffer == NULL) return 0; glad_glBlitFramebuffer((GLint)(long long)a[0], (GLint)(long long)a[1], (GLint)(long long)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4], (GLint)(long long)a[5], (GLint)(long long)a[6], (GLint)(long long)a[7], (GLbitfield)a[8], (GLenum)a[9]); break;
+	case 627: if(glad_glRenderbufferStorageMultisample == NULL) return 0; glad_glRenderbufferStorageMultisample((GLenum)a[0], (GLsizei)(long long)a[1], (GLenum)a[2], (GLsizei)(long long)a[3], (GLsizei)(long long)a[4]); break;
+	case 628: if(glad_glFramebufferTextureLayer == NULL) return 0; glad_glFramebufferTextureLayer((GLenum)a[0], (GLenum)a[1], (GLuint)a[2], (GLint)(long long)a[3], (GLint)(long long)a[4]); break;
+	case 629: if(glad_glMapBufferRange == NULL) return 0; call->result = glad_arg_p(glad_glMapBufferRange((GLenum)a[0], (GLintptr)(long long)a[1], (GLsizeiptr)(long long)a[2], (GLbitfield)a[3])); break;
+	case 630: if(glad_glFlushMappedBufferRange == NULL) return 0; glad_glFlushMappedBufferRange((GLenum)a[0], (GLintptr)(long long)a[1], (GLsizeiptr)(long long)a[2]); break;
+	case 631: if(glad_glBindVertexArray == NULL) return 0; glad_glBindVertexArray((GLuint)a[0]); break;
+	case 632: if(glad_glDeleteVertexArrays == NULL) return 0; glad_glDeleteVertexArrays((GLsizei)(long long)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 633: if(glad_glGenVertexArrays == NULL) return 0; glad_glGenVertexArrays((GLsizei)(long long)a[0], (GLuint *)(size_t)a[1]); break;
+	case 634: if(glad_glIsVertexArray == NULL) return 0; call->result = glad_arg_u(glad_glIsVertexArray((GLuint)a[0])); break;
+	case 635: if(glad_glDrawArraysInstanced == NULL) return 0; glad_glDrawArraysInstanced((GLenum)a[0], (GLint)(long long)a[1], (GLsizei)(long long)a[2], (GLsizei)(long long)a[3]); break;
+	case 636: if(glad_glDrawElementsInstanced == NULL) return 0; glad_glDrawElementsInstanced((GLenum)a[0], (GLsizei)(long long)a[1], (GLenum)a[2], (const void *)(size_t)a[3], (GLsizei)(long long)a[4]); break;
+	case 637: if(glad_glTexBuffer == NULL) return 0; glad_glTexBuffer((GLenum)a[0], (GLenum)a[1], (GLuint)a[2]); break;
+	case 638: if(glad_glPrimitiveRestartIndex == NULL) return 0; glad_glPrimitiveRestartIndex((GLuint)a[0]); break;
+	case 639: if(glad_glCopyBufferSubData == NULL) return 0; glad_glCopyBufferSubData((GLenum)a[0], (GLenum)a[1], (GLintptr)(long long)a[2], (GLintptr)(long long)a[3], (GLsizeiptr)(long long)a[4]); break;
+	case 640: if(glad_glGetUniformIndices == NULL) return 0; glad_glGetUniformIndices((GLuint)a[0], (GLsizei)(long long)a[1], (const GLchar *const*)(size_t)a[2], (GLuint *)(size_t)a[3]); break;
+	case 641: if(glad_glGetActiveUniformsiv == NULL) return 0; glad_glGetActiveUniformsiv((GLuint)a[0], (GLsizei)(long long)a[1], (const GLuint *)(size_t)a[2], (GLenum)a[3], (GLint *)(size_t)a[4]); break;
+	case 642: if(glad_glGetActiveUniformName == NULL) return 0; glad_glGetActiveUniformName((GLuint)a[0], (GLuint)a[1], (GLsizei)(long long)a[2], (GLsizei *)(size_t)a[3], (GLchar *)(size_t)a[4]); break;
+	case 643: if(glad_glGetUniformBlockIndex == NULL) return 0; call->result = glad_arg_u(glad_glGetUniformBlockIndex((GLuint)a[0], (const GLchar *)(size_t)a[1])); break;
+	case 644: if(glad_glGetActiveUniformBlockiv == NULL) return 0; glad_glGetActiveUniformBlockiv((GLuint)a[0], (GLuint)a[1], (GLenum)a[2], (GLint *)(size_t)a[3]); break;
+	case 645: if(glad_glGetActiveUniformBlockName == NULL) return 0; glad_glGetActiveUniformBlockName((GLuint)a[0], (GLuint)a[1], (GLsizei)(long long)a[2], (GLsizei *)(size_t)a[3], (GLchar *)(size_t)a[4]); break;
+	case 646: if(glad_glUniformBlockBinding == NULL) return 0; glad_glUniformBlockBinding((GLuint)a[0], (GLuint)a[1], (GLuint)a[2]); break;
+	case 647: if(glad_glDrawElementsBaseVertex == NULL) return 0; glad_glDrawElementsBaseVertex((GLenum)a[0], (GLsizei)(long long)a[1], (GLenum)a[2], (const void *)(size_t)a[3], (GLint)(long long)a[4]); break;
+	case 648: if(glad_glDrawRangeElementsBaseVertex == NULL) return 0; glad_glDrawRangeElementsBaseVertex((GLenum)a[0], (GLuint)a[1], (GLuint)a[2], (GLsizei)(long long)a[3], (GLenum)a[4], (const void *)(size_t)a[5], (GLint)(long long)a[6]); break;
+	case 649: if(glad_glDrawElementsInstancedBaseVertex == NULL) return 0; glad_glDrawElementsInstancedBaseVertex((GLenum)a[0], (GLsizei)(long long)a[1], (GLenum)a[2], (const void *)(size_t)a[3], (GLsizei)(long long)a[4], (GLint)(long long)a[5]); break;
+	case 650: if(glad_glMultiDrawElementsBaseVertex == NULL) return 0; glad_glMultiDrawElementsBaseVertex((GLenum)a[0], (const GLsizei *)(size_t)a[1], (GLenum)a[2], (const void *const*)(size_t)a[3], (GLsizei)(long long)a[4], (const GLint *)(size_t)a[5]); break;
+	case 651: if(glad_glProvokingVertex == NULL) return 0; glad_glProvokingVertex((GLenum)a[0]); break;
+	case 652: if(glad_glFenceSync == NULL) return 0; call->result = glad_arg_p(glad_glFenceSync((GLenum)a[0], (GLbitfield)a[1])); break;
+	case 653: if(glad_glIsSync == NULL) return 0; call->result = glad_arg_u(glad_glIsSync((GLsync)(size_t)a[0])); break;
+	case 654: if(glad_glDeleteSync == NULL) return 0; glad_glDeleteSync((GLsync)(size_t)a[0]); break;
+	case 655: if(glad_glClientWaitSync == NULL) return 0; call->result = glad_arg_u(glad_glClientWaitSync((GLsync)(size_t)a[0], (GLbitfield)a[1], (GLuint64)a[2])); break;
+	case 656: if(glad_glWaitSync == NULL) return 0; glad_glWaitSync((GLsync)(size_t)a[0], (GLbitfield)a[1], (GLuint64)a[2]); break;
+	case 657: if(glad_glGetInteger64v == NULL) return 0; glad_glGetInteger64v((GLenum)a[0], (GLint64 *)(size_t)a[1]); break;
+	case 658: if(glad_glGetSynciv == NULL) return 0; glad_glGetSynciv((GLsync)(size_t)a[0], (GLenum)a[1], (GLsizei)(long long)a[2], (GLsizei *)(size_t)a[3], (GLint *)(size_t)a[4]); break;
+	case 659: if(glad_glGetInteger64i_v == NULL) return 0; glad_glGetInteger64i_v((GLenum)a[0], (GLuint)a[1], (GLint64 *)(size_t)a[2]); break;
+	case 660: if(glad_glGetBufferParameteri64v == NULL) return 0; glad_glGetBufferParameteri64v((GLenum)a[0], (GLenum)a[1], (GLint64 *)(size_t)a[2]); break;
+	case 661: if(glad_glFramebufferTexture == NULL) return 0; glad_glFramebufferTexture((GLenum)a[0], (GLenum)a[1], (GLuint)a[2], (GLint)(long long)a[3]); break;
+	case 662: if(glad_glTexImage2DMultisample == NULL) return 0; glad_glTexImage2DMultisample((GLenum)a[0], (GLsizei)(long long)a[1], (GLenum)a[2], (GLsizei)(long long)a[3], (GLsizei)(long long)a[4], (GLboolean)a[5]); break;
+	case 663: if(glad_glTexImage3DMultisample == NULL) return 0; glad_glTexImage3DMultisample((GLenum)a[0], (GLsizei)(long long)a[1], (GLenum)a[2], (GLsizei)(long long)a[3], (GLsizei)(long long)a[4], (GLsizei)(long long)a[5], (GLboolean)a[6]); break;
+	case 664: if(glad_glGetMultisamplefv == NULL) return 0; glad_glGetMultisamplefv((GLenum)a[0], (GLuint)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 665: if(glad_glSampleMaski == NULL) return 0; glad_glSampleMaski((GLuint)a[0], (GLbitfield)a[1]); break;
+	case 666: if(glad_glBindFragDataLocationIndexed == NULL) return 0; glad_glBindFragDataLocationIndexed((GLuint)a[0], (GLuint)a[1], (GLuint)a[2], (const GLchar *)(size_t)a[3]); break;
+	case 667: if(glad_glGetFragDataIndex == NULL) return 0; call->result = glad_arg_i(glad_glGetFragDataIndex((GLuint)a[0], (const GLchar *)(size_t)a[1])); break;
+	case 668: if(glad_glGenSamplers == NULL) return 0; glad_glGenSamplers((GLsizei)(long long)a[0], (GLuint *)(size_t)a[1]); break;
+	case 669: if(glad_glDeleteSamplers == NULL) return 0; glad_glDeleteSamplers((GLsizei)(long long)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 670: if(glad_glIsSampler == NULL) return 0; call->result = glad_arg_u(glad_glIsSampler((GLuint)a[0])); break;
+	case 671: if(glad_glBindSampler == NULL) return 0; glad_glBindSampler((GLuint)a[0], (GLuint)a[1]); break;
+	case 672: if(glad_glSamplerParameteri == NULL) return 0; glad_glSamplerParameteri((GLuint)a[0], (GLenum)a[1], (GLint)(long long)a[2]); break;
+	case 673: if(glad_glSamplerParameteriv == NULL) return 0; glad_glSamplerParameteriv((GLuint)a[0], (GLenum)a[1], (const GLint *)(size_t)a[2]); break;
+	case 674: if(glad_glSamplerParameterf == NULL) return 0; glad_glSamplerParameterf((GLuint)a[0], (GLenum)a[1], (GLfloat)glad_raw_f(a[2])); break;
+	case 675: if(glad_glSamplerParameterfv == NULL) return 0; glad_glSamplerParameterfv((GLuint)a[0], (GLenum)a[1], (const GLfloat *)(size_t)a[2]); break;
+	case 676: if(glad_glSamplerParameterIiv == NULL) return 0; glad_glSamplerParameterIiv((GLuint)a[0], (GLenum)a[1], (const GLint *)(size_t)a[2]); break;
+	case 677: if(glad_glSamplerParameterIuiv == NULL) return 0; glad_glSamplerParameterIuiv((GLuint)a[0], (GLenum)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 678: if(glad_glGetSamplerParameteriv == NULL) return 0; glad_glGetSamplerParameteriv((GLuint)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 679: if(glad_glGetSamplerParameterIiv == NULL) return 0; glad_glGetSamplerParameterIiv((GLuint)a[0], (GLenum)a[1], (GLint *)(size_t)a[2]); break;
+	case 680: if(glad_glGetSamplerParameterfv == NULL) return 0; glad_glGetSamplerParameterfv((GLuint)a[0], (GLenum)a[1], (GLfloat *)(size_t)a[2]); break;
+	case 681: if(glad_glGetSamplerParameterIuiv == NULL) return 0; glad_glGetSamplerParameterIuiv((GLuint)a[0], (GLenum)a[1], (GLuint *)(size_t)a[2]); break;
+	case 682: if(glad_glQueryCounter == NULL) return 0; glad_glQueryCounter((GLuint)a[0], (GLenum)a[1]); break;
+	case 683: if(glad_glGetQueryObjecti64v == NULL) return 0; glad_glGetQueryObjecti64v((GLuint)a[0], (GLenum)a[1], (GLint64 *)(size_t)a[2]); break;
+	case 684: if(glad_glGetQueryObjectui64v == NULL) return 0; glad_glGetQueryObjectui64v((GLuint)a[0], (GLenum)a[1], (GLuint64 *)(size_t)a[2]); break;
+	case 685: if(glad_glVertexAttribDivisor == NULL) return 0; glad_glVertexAttribDivisor((GLuint)a[0], (GLuint)a[1]); break;
+	case 686: if(glad_glVertexAttribP1ui == NULL) return 0; glad_glVertexAttribP1ui((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (GLuint)a[3]); break;
+	case 687: if(glad_glVertexAttribP1uiv == NULL) return 0; glad_glVertexAttribP1uiv((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (const GLuint *)(size_t)a[3]); break;
+	case 688: if(glad_glVertexAttribP2ui == NULL) return 0; glad_glVertexAttribP2ui((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (GLuint)a[3]); break;
+	case 689: if(glad_glVertexAttribP2uiv == NULL) return 0; glad_glVertexAttribP2uiv((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (const GLuint *)(size_t)a[3]); break;
+	case 690: if(glad_glVertexAttribP3ui == NULL) return 0; glad_glVertexAttribP3ui((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (GLuint)a[3]); break;
+	case 691: if(glad_glVertexAttribP3uiv == NULL) return 0; glad_glVertexAttribP3uiv((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (const GLuint *)(size_t)a[3]); break;
+	case 692: if(glad_glVertexAttribP4ui == NULL) return 0; glad_glVertexAttribP4ui((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (GLuint)a[3]); break;
+	case 693: if(glad_glVertexAttribP4uiv == NULL) return 0; glad_glVertexAttribP4uiv((GLuint)a[0], (GLenum)a[1], (GLboolean)a[2], (const GLuint *)(size_t)a[3]); break;
+#ifndef GLAD_CORE_ONLY
+	case 694: if(glad_glVertexP2ui == NULL) return 0; glad_glVertexP2ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 695: if(glad_glVertexP2uiv == NULL) return 0; glad_glVertexP2uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 696: if(glad_glVertexP3ui == NULL) return 0; glad_glVertexP3ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 697: if(glad_glVertexP3uiv == NULL) return 0; glad_glVertexP3uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 698: if(glad_glVertexP4ui == NULL) return 0; glad_glVertexP4ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 699: if(glad_glVertexP4uiv == NULL) return 0; glad_glVertexP4uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 700: if(glad_glTexCoordP1ui == NULL) return 0; glad_glTexCoordP1ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 701: if(glad_glTexCoordP1uiv == NULL) return 0; glad_glTexCoordP1uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 702: if(glad_glTexCoordP2ui == NULL) return 0; glad_glTexCoordP2ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 703: if(glad_glTexCoordP2uiv == NULL) return 0; glad_glTexCoordP2uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 704: if(glad_glTexCoordP3ui == NULL) return 0; glad_glTexCoordP3ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 705: if(glad_glTexCoordP3uiv == NULL) return 0; glad_glTexCoordP3uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 706: if(glad_glTexCoordP4ui == NULL) return 0; glad_glTexCoordP4ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 707: if(glad_glTexCoordP4uiv == NULL) return 0; glad_glTexCoordP4uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 708: if(glad_glMultiTexCoordP1ui == NULL) return 0; glad_glMultiTexCoordP1ui((GLenum)a[0], (GLenum)a[1], (GLuint)a[2]); break;
+	case 709: if(glad_glMultiTexCoordP1uiv == NULL) return 0; glad_glMultiTexCoordP1uiv((GLenum)a[0], (GLenum)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 710: if(glad_glMultiTexCoordP2ui == NULL) return 0; glad_glMultiTexCoordP2ui((GLenum)a[0], (GLenum)a[1], (GLuint)a[2]); break;
+	case 711: if(glad_glMultiTexCoordP2uiv == NULL) return 0; glad_glMultiTexCoordP2uiv((GLenum)a[0], (GLenum)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 712: if(glad_glMultiTexCoordP3ui == NULL) return 0; glad_glMultiTexCoordP3ui((GLenum)a[0], (GLenum)a[1], (GLuint)a[2]); break;
+	case 713: if(glad_glMultiTexCoordP3uiv == NULL) return 0; glad_glMultiTexCoordP3uiv((GLenum)a[0], (GLenum)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 714: if(glad_glMultiTexCoordP4ui == NULL) return 0; glad_glMultiTexCoordP4ui((GLenum)a[0], (GLenum)a[1], (GLuint)a[2]); break;
+	case 715: if(glad_glMultiTexCoordP4uiv == NULL) return 0; glad_glMultiTexCoordP4uiv((GLenum)a[0], (GLenum)a[1], (const GLuint *)(size_t)a[2]); break;
+	case 716: if(glad_glNormalP3ui == NULL) return 0; glad_glNormalP3ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 717: if(glad_glNormalP3uiv == NULL) return 0; glad_glNormalP3uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 718: if(glad_glColorP3ui == NULL) return 0; glad_glColorP3ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 719: if(glad_glColorP3uiv == NULL) return 0; glad_glColorP3uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 720: if(glad_glColorP4ui == NULL) return 0; glad_glColorP4ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 721: if(glad_glColorP4uiv == NULL) return 0; glad_glColorP4uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+	case 722: if(glad_glSecondaryColorP3ui == NULL) return 0; glad_glSecondaryColorP3ui((GLenum)a[0], (GLuint)a[1]); break;
+	case 723: if(glad_glSecondaryColorP3uiv == NULL) return 0; glad_glSecondaryColorP3uiv((GLenum)a[0], (const GLuint *)(size_t)a[1]); break;
+#endif
+	case 724: if(glad_glGetProgramBinary == NULL) return 0; glad_glGetProgramBinary((GLuint)a[0], (GLsizei)(long long)a[1], (GLsizei *)(size_t)a[2], (GLenum *)(size_t)a[3], (void *)(size_t)a[4]); break;
+	case 725: if(glad_glProgramBinary == NULL) return 0; glad_glProgramBinary((GLuint)a[0], (GLenum)a[1], (const void *)(size_t)a[2], (GLsizei)(long long)a[3]); break;
+	case 726: if(glad_glProgramParameteri == NULL) return 0; glad_glProgramParameteri((GLuint)a[0], (GLenum)a[1], (GLint)(long long)a[2]); break;
+	case 727: if(glad_glMaxShaderCompilerThreadsKHR == NULL) return 0; glad_glMaxShaderCompilerThreadsKHR((GLuint)a[0]); break;
+	case 728: if(glad_glBufferStorage == NULL) return 0; glad_glBufferStorage((GLenum)a[0], (GLsizeiptr)(long long)a[1], (const void *)(size_t)a[2], (GLbitfield)a[3]); break;
+	default: return 0;
+	}
+	return 1;
+}
+#endif
@@ -0,0 +1,123 @@
+/*
+    Renders the main.cpp triangle with the software rasterizer: no window, no GPU.
+    Usage: headless [frames] [threads]
+*/
+
+#include <renderer/software_rasterizer.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace renderer;
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+// Vertex stage, same as vertexShaderSource in main.cpp
+void vertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    out.position = {in.attribs[0][0], in.attribs[0][1], in.attribs[0][2], 1.0f};
+    out.varyings[0] = in.attribs[1][0];
+    out.varyings[1] = in.attribs[1][1];
+    out.varyings[2] = in.attribs[1][2];
+}
+
+// Fragment stage, same as fragmentShaderSource in main.cpp
+void fragmentShader(const float *ourColor, float color[4], const void *uniforms)
+{
+    color[0] = ourColor[0];
+    color[1] = ourColor[1];
+    color[2] = ourColor[2];
+    color[3] = 1.0f;
+}
+
+// Fragment stage for 8 pixels at a time, used by the SIMD row kernels
+void fragmentShaderSpan(SwFragmentSpan &span, const void *uniforms)
+{
+    for (int lane = 0; lane < SW_SPAN_WIDTH; lane++) {
+        span.color[0][lane] = span.varyings[0][lane];
+        span.color[1][lane] = span.varyings[1][lane];
+        span.color[2][lane] = span.varyings[2][lane];
+        span.color[3][lane] = 1.0f;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 1000;
+    unsigned int threads = argc > 2 ? (unsigned int)atoi(argv[2]) : 0;
+
+    /* RASTERIZER STARTS HERE */
+
+    SoftwareRasterizer raster(SCR_WIDTH, SCR_HEIGHT, threads);
+
+    // Build the program out of the two stages (ourColor is the only varying)
+    unsigned int shaderProgram = raster.createProgram({vertexShader, fragmentShader, 3, fragmentShaderSpan});
+
+    /* RASTERIZER ENDS HERE */
+    /* TRIANGLE STARTS HERE */
+
+    // Specify the unique vertices (NDC)
+    float vertices[] = {
+        // positions        // colors
+        -0.5f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f, // Bottom Left
+         0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.0f, // Bottom right
+         0.0f,  0.5f, 0.0f, 0.0f, 0.0f, 1.0f  // Top
+    };
+
+    // Same VAO/VBO setup as main.cpp, issued against the rasterizer instead of the driver
+    unsigned int VBO, VAO;
+    raster.genVertexArrays(1, &VAO);
+    raster.genBuffers(1, &VBO);
+
+    raster.bindVertexArray(VAO);
+    raster.bindBuffer(GL_ARRAY_BUFFER, VBO);
+    raster.bufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    raster.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    raster.enableVertexAttribArray(0);
+    raster.vertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    raster.enableVertexAttribArray(1);
+
+    raster.bindBuffer(GL_ARRAY_BUFFER, 0);
+    raster.bindVertexArray(0);
+
+    /* TRIANGLE ENDS HERE */
+    /* RENDERING STARTS HERE */
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int frame = 0; frame < frames; frame++) {
+        raster.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        raster.clear(GL_COLOR_BUFFER_BIT);
+
+        raster.useProgram(shaderProgram);
+        raster.bindVertexArray(VAO);
+        raster.drawArrays(GL_TRIANGLES, 0, 3);
+
+        // Stands in for glfwSwapBuffers: the frame is complete after this
+        raster.finish();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /* RENDERING ENDS HERE */
+
+    // Checksum so runs with different thread counts can be compared
+    const uint32_t *pixels = raster.pixels();
+    unsigned long long checksum = 1469598103934665603ULL;
+    for (unsigned int i = 0; i < SCR_WIDTH * SCR_HEIGHT; i++) {
+        checksum = (checksum ^ pixels[i]) * 1099511628211ULL;
+    }
+
+    SwStats stats = raster.stats();
+    std::cout << frames << " frames on " << raster.threadCount() << " threads (" << simdLevelName(raster.activeSimdLevel()) << ") in " << seconds << " s ("
+              << frames / seconds << " fps), " << stats.pixels / frames << " pixels/frame, checksum "
+              << std::hex << checksum << std::dec << std::endl;
+
+    raster.deleteVertexArrays(1, &VAO);
+    raster.deleteBuffers(1, &VBO);
+    raster.deleteProgram(shaderProgram);
+    return 0;
+}
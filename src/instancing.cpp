@@ -0,0 +1,210 @@
+/*
+    The two triangles of triangles2.cpp as two instances of one triangle: a renderer::Mesh holds
+    the shape, its instance buffer a per-instance offset and colour (glVertexAttribDivisor),
+    and one drawInstanced() call (glDrawArraysInstanced) draws every copy.
+    Stress mode: "instancing 1000000" draws a million small instances per frame with vsync
+    off and prints the average frame time once a second.
+*/
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <renderer/mesh.h>
+#include <renderer/program_cache.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+
+void framebuffer_size_callback(GLFWwindow *window, int width, int height);
+void processInput(GLFWwindow *window);
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+// Vertex shader source code
+const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec2 aOffset;\n"
+    "layout (location = 2) in vec3 aColor;\n"
+    "uniform float scale;\n"
+    "out vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(aPos.xy * scale + aOffset, aPos.z, 1.0f);\n"
+    "    ourColor = aColor;\n"
+    "}\0";
+
+// Fragment shader source code
+const char *fragmentShaderSource = "#version 330 core\n"
+    "in vec3 ourColor;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(ourColor, 1.0f);\n"
+    "}\0";
+
+int main(int argc, char **argv)
+{
+    int instanceCount = argc > 1 ? atoi(argv[1]) : 2;
+    bool stress = instanceCount > 2;
+    if (instanceCount < 1) {
+        instanceCount = 1;
+    }
+
+    /* GLFW STARTS HERE */
+
+    // Initialize GLFW and set it up
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+    /* WINDOW STARTS HERE */
+    // Create window and make it the current context
+    GLFWwindow *window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
+    if (window == NULL) {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+
+    // Check for GLAD error
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+
+    // Set viewport and update it everytime the window is resized
+    glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+    // Measure the draw, not the display refresh
+    if (stress) {
+        glfwSwapInterval(0);
+    }
+
+    /* WINDOW ENDS HERE */
+    /* SHADERS START HERE */
+
+    renderer::ProgramCache programCache;
+    unsigned int shaderProgram = programCache.program(vertexShaderSource, fragmentShaderSource);
+    if (shaderProgram == 0) {
+        glfwTerminate();
+        return -1;
+    }
+    int scaleLocation = glGetUniformLocation(shaderProgram, "scale");
+
+    /* SHADERS END HERE */
+    /* TRIANGLES START HERE */
+
+    // The shape every instance shares (NDC, centered on the origin)
+    float triangle[] = {
+        -0.375f, -0.5f, 0.0f,  // left-corner
+         0.375f, -0.5f, 0.0f,  // right-corner
+         0.0f,    0.5f, 0.0f   // top
+    };
+
+    // Per-instance data: offset (x, y) and colour (r, g, b)
+    std::vector<float> instances;
+    float scale = 1.0f;
+    if (!stress) {
+        float pair[] = {
+            -0.375f, 0.0f, 1.0f, 0.5f, 0.2f,  // left triangle, orange
+             0.375f, 0.0f, 1.0f, 1.0f, 0.0f   // right triangle, yellow
+        };
+        instances.assign(pair, pair + 5 * instanceCount);
+    } else {
+        // A square grid covering the window, one small triangle per cell
+        int columns = 1;
+        while (columns * columns < instanceCount) {
+            columns++;
+        }
+        scale = 1.0f / columns;
+        instances.reserve((size_t)instanceCount * 5);
+        for (int i = 0; i < instanceCount; i++) {
+            int column = i % columns, row = i / columns;
+            instances.push_back(-1.0f + (2.0f * column + 1.0f) / columns);
+            instances.push_back(-1.0f + (2.0f * row + 1.0f) / columns);
+            instances.push_back((float)column / columns);
+            instances.push_back((float)row / columns);
+            instances.push_back(0.5f);
+        }
+    }
+
+    // The shape advances per vertex, offset and colour once per instance
+    renderer::Mesh triangleMesh(triangle, sizeof(triangle), 3 * sizeof(float), {{0, 3, GL_FLOAT, 0}});
+    triangleMesh.setInstances(instances.data(), instances.size() * sizeof(float), 5 * sizeof(float), {
+        {1, 2, GL_FLOAT, 0, GL_FALSE, 1},
+        {2, 3, GL_FLOAT, 2 * sizeof(float), GL_FALSE, 1}
+    });
+
+    /* TRIANGLES END HERE */
+    /* RENDERING STARTS HERE */
+
+    glUseProgram(shaderProgram);
+    glUniform1f(scaleLocation, scale);
+
+    int framesSinceReport = 0;
+    double lastReport = glfwGetTime();
+
+    // Render loop (each iteration is a frame)
+    while (!glfwWindowShouldClose(window)) {
+        // Process input
+        processInput(window);
+
+        // State-setting and state-using functions
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        // Every copy in one draw call
+        triangleMesh.drawInstanced(instanceCount);
+
+        // Swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+
+        framesSinceReport++;
+        double now = glfwGetTime();
+        if (stress && now - lastReport >= 1.0) {
+            double frameMilliseconds = (now - lastReport) * 1000.0 / framesSinceReport;
+            std::cout << instanceCount << " instanced triangles: " << frameMilliseconds << " ms/frame ("
+                      << 1000.0 / frameMilliseconds << " fps)" << std::endl;
+            framesSinceReport = 0;
+            lastReport = now;
+        }
+    }
+
+    /* RENDERING ENDS HERE */
+
+    // De-allocate all remaining resources
+    triangleMesh.reset();
+    glDeleteProgram(shaderProgram);
+
+    // Close GLFW
+    glfwTerminate();
+    return 0;
+
+    /* GLFW ENDS HERE */
+}
+
+// Updates viewport after resizing window
+void framebuffer_size_callback(GLFWwindow *window, int width, int height)
+{
+    glViewport(0, 0, width, height);
+}
+
+// Checks for escape and closes window
+void processInput(GLFWwindow *window)
+{
+    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+        glfwSetWindowShouldClose(window, true);
+    }
+}
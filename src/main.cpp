@@ -1,23 +1,42 @@
 /*
     Currently working on shaders.
+    "main trace" records every GL call (glad built with "make trace=1"), prints the most
+    expensive entry points on exit and writes gl_trace.json for chrome://tracing.
+    "main capture [frames]" records the GL calls of that many frames (600 by default) into
+    main.glcap and exits, for the replay tool (also needs "make trace=1").
+    "main offscreen [frames] [raw|png]" renders that many frames (300 by default) into a
+    framebuffer object behind a hidden window and streams them to main_frames.rgba, or
+    to main_frames_<frame>.png, reading them back through pixel pack buffers.
+    Frame times are always profiled and summarized on exit; "main profile" also writes
+    frame_profile.csv and frame_profile.json.
 */ 
 
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
-
+#include <renderer/frame_profiler.h>
+#include <renderer/frame_writer.h>
+#include <renderer/gl_capture.h>
+#include <renderer/gl_trace.h>
+#include <renderer/mesh.h>
+#include <renderer/offscreen.h>
+#include <renderer/program_reflection.h>
+#include <renderer/shader.h>
+#include <renderer/state_cache.h>
+#include <renderer/vertex_format.h>
+#include <renderer/window.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <math.h>
+#include <memory>
 
 
-void framebuffer_size_callback(GLFWwindow *window, int width, int height);
-void processInput(GLFWwindow *window);
-
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
 
 // Vertex shader source code
 const char *vertexShaderSource = "#version 330 core\n"
-    "layout (location = 0) in vec4 aPos;\n"
+    "layout (location = 0) in vec3 aPos;\n"
     "layout (location = 1) in vec3 aColor;\n"
     "out vec3 ourColor;\n"
     "void main()\n"
@@ -35,107 +54,53 @@ const char *fragmentShaderSource = "#version 330 core\n"
     "   FragColor = vec4(ourColor, 1.0);\n"
     "}\0";
 
-int main()
+int main(int argc, char **argv)
 {
-    /* GLFW STARTS HERE */
-
-    // Initialize GLFW and set it up
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-#endif
+    bool trace = argc > 1 && strcmp(argv[1], "trace") == 0;
+    bool capture = argc > 1 && strcmp(argv[1], "capture") == 0;
+    int captureFrames = capture && argc > 2 ? atoi(argv[2]) : 600;
+    bool offscreen = argc > 1 && strcmp(argv[1], "offscreen") == 0;
+    int offscreenFrames = offscreen && argc > 2 ? atoi(argv[2]) : 300;
+    renderer::FrameFormat frameFormat = offscreen && argc > 3 && strcmp(argv[3], "png") == 0 ? renderer::FRAME_PNG : renderer::FRAME_RAW;
+    bool profile = argc > 1 && strcmp(argv[1], "profile") == 0;
 
     /* WINDOW STARTS HERE */
-    // Create window and make it the current context
-    GLFWwindow *window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
-    if (window == NULL) {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
-        return -1;
-    }
-    glfwMakeContextCurrent(window);
 
-    // Check for GLAD error
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-        std::cout << "Failed to initialize GLAD" << std::endl;
+    // Create window and make it the current context; offscreen the window only carries the context
+    renderer::Window window(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", !offscreen);
+    if (!window.ok()) {
         return -1;
     }
 
-    // Set viewport and update it everytime the window is resized
-    glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
-
-    /* WINDOW ENDS HERE */
-    /* SHADERS START HERE */
-
-    /* VERTEX SHADER STARTS HERE */
-
-    // Create a new vertex shader object
-    unsigned int vertexShader;
-    vertexShader = glCreateShader(GL_VERTEX_SHADER);
-
-    // Attach the vertex shader source code to the shader object and compile it
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-
-    // Check for compilation errors
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+    // Tracing goes in first, so it sees only the calls that get past the state cache
+    if (trace) {
+        trace = renderer::GLTrace::install();
     }
 
-    /* VERTEX SHADER ENDS HERE */
-    /* FRAGMENT SHADER STARTS HERE */
-
-    // Create a new fragment shader object
-    unsigned int fragmentShader;
-    fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-
-    // Attach the fragment shader source code to the shader object and compile it
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-
-    // Check for compilation errors
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+    // The capture too: the file should hold what the driver was asked to do
+    if (capture) {
+        capture = renderer::GLCapture::begin("main.glcap", SCR_WIDTH, SCR_HEIGHT);
+        // The profiler's timer queries would only be skipped on replay
+        renderer::FrameProfiler::setGpuTiming(false);
     }
 
-    /* FRAGMENT SHADER ENDS HERE */
-    /* SHADER PROGRAM STARTS HERE */
-
-    // Create a shader program object
-    unsigned int shaderProgram;
-    shaderProgram = glCreateProgram();
-
-    // Attach and link shaders to the program object
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
+    // Route state changes through the shadow-state cache so redundant ones never reach the driver
+    renderer::StateCache::install();
 
-    // Check for compilation errors
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER_PROGRAM::COMPILATION_FAILED" << std::endl;
-    }
+    // Set the viewport again, now that the trace, the capture and the cache see it
+    glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
 
-    // Set program object as the current active shader
-    glUseProgram(shaderProgram);
+    /* WINDOW ENDS HERE */
+    /* SHADERS START HERE */
 
-    // De-allocate shader objects
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    renderer::ShaderProgram shaderProgram(vertexShaderSource, fragmentShaderSource);
+    shaderProgram.use();
 
-    /* SHADER PROGRAM ENDS HERE */
+    // Enumerate the program's uniforms once and resolve the handles used every frame.
+    // The shaders above don't declare "ourColor" as a uniform, so debug builds warn here
+    // and setting it costs nothing in the render loop
+    renderer::ProgramReflection reflection(shaderProgram.id());
+    renderer::UniformHandle vertexColorLocation = reflection.uniform("ourColor");
 
     /* SHADERS END HERE */
     /* TRIANGLE STARTS HERE */
@@ -148,86 +113,121 @@ int main()
          0.0f,  0.5f, 0.0f, 0.0f, 0.0f, 1.0f  // Top
     };
 
-    // Generate a new Vertex Buffer Object (VBO), Vertex Array Object (VAO) and Element Buffer Object (EBO)
-    unsigned int VBO, VAO;
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-
-    // Bind the Vertex Array Object first (VAO)
-    glBindVertexArray(VAO);
-
-    // Bind the newly created VBO to the GL_ARRAY_BUFFER target and upload vertex data to the gpu
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    // Specify the layout of the vertex data in the vertex buffer and enable the vertex attribute array at location 0 (position attribute)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    // Specify the layout of the vertex data in the vertex buffer and enable the vertex attribute array at location 1 (color attribute)
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-
-    // Unbind the GL_ARRAY_BUFFER and the VAO
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    // Position at location 0 as half floats, color at location 1 as normalized bytes:
+    // 12 bytes a vertex instead of 24
+    renderer::CompactVertices compact = renderer::compactVertices(vertices, sizeof(vertices), 6 * sizeof(float), {
+        {0, 3, 0, renderer::VERTEX_FORMAT_HALF},
+        {1, 3, 3 * sizeof(float), renderer::VERTEX_FORMAT_UNORM8}
+    });
+    renderer::Mesh triangle(compact.data.data(), compact.data.size(), compact.stride, compact.attributes);
 
     // Draw wireframe polygons
     // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
     /* TRIANGLE ENDS HERE */
+    /* OFFSCREEN TARGET STARTS HERE */
+
+    // Frames go into a framebuffer object and out through two pixel pack buffers,
+    // so each frame is written to disk while the next one renders
+    std::unique_ptr<renderer::OffscreenTarget> target;
+    std::unique_ptr<renderer::AsyncReadback> readback;
+    std::unique_ptr<renderer::FrameWriter> frameWriter;
+    if (offscreen) {
+        target.reset(new renderer::OffscreenTarget(SCR_WIDTH, SCR_HEIGHT));
+        readback.reset(new renderer::AsyncReadback(SCR_WIDTH, SCR_HEIGHT));
+        frameWriter.reset(new renderer::FrameWriter(frameFormat == renderer::FRAME_PNG ? "main_frames" : "main_frames.rgba", frameFormat, SCR_WIDTH, SCR_HEIGHT));
+        target->bind();
+    }
+    auto offscreenStart = std::chrono::steady_clock::now();
+    auto writeFrame = [&](const unsigned char *pixels, unsigned long long frame) {
+        frameWriter->write(pixels, frame);
+    };
+
+    /* OFFSCREEN TARGET ENDS HERE */
     /* RENDERING STARTS HERE */
 
     // Render loop (each iteration is a frame)
-    while (!glfwWindowShouldClose(window)) {
+    int frame = 0;
+    while (!window.shouldClose()) {
+        renderer::FrameProfiler::beginFrame(renderer::FRAME_STAGE_INPUT);
+
         // Process input
-        processInput(window);
-        
+        window.processInput();
+
+        // Animate the uniform color
+        renderer::FrameProfiler::stage(renderer::FRAME_STAGE_UPDATE);
+        float timeValue = window.time();
+        float greenValue = (sin(timeValue) / 2) + 0.5f;
+
         // State-setting and state-using functions
+        renderer::FrameProfiler::stage(renderer::FRAME_STAGE_SUBMIT);
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
         // Draw our triangle
-        glUseProgram(shaderProgram);
-        
-        // Update uniform color
-        float timeValue = glfwGetTime();
-        float greenValue = (sin(timeValue) / 2) + 0.5f;
-        int vertexColorLocation = glGetUniformLocation(shaderProgram, "ourColor");
-        glUniform4f(vertexColorLocation, 0.0f, greenValue, 0.0f, 1.0f);
-
-        glBindVertexArray(VAO);
-        glDrawArrays(GL_TRIANGLES, 0, 3);
+        shaderProgram.use();
+        reflection.set(vertexColorLocation, 0.0f, greenValue, 0.0f, 1.0f);
+        triangle.draw();
 
         // Swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        renderer::FrameProfiler::stage(renderer::FRAME_STAGE_SWAP);
+        if (offscreen) {
+            readback->readFrame(writeFrame);
+            if (readback->frames() >= (unsigned long long)offscreenFrames) {
+                window.close();
+            }
+        } else {
+            window.swapBuffers();
+        }
+        window.pollEvents();
+
+        renderer::FrameProfiler::endFrame();
+        renderer::StateCache::endFrame();
+
+        // A capture covers a fixed number of frames
+        if (capture) {
+            renderer::GLCapture::endFrame();
+            if (++frame >= captureFrames) {
+                window.close();
+            }
+        }
     }
 
     /* RENDERING ENDS HERE */
 
-    // De-allocate all remaining resources
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteProgram(shaderProgram);
+    if (offscreen) {
+        readback->drain(writeFrame);
+        double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - offscreenStart).count();
+        std::cout << "Offscreen: " << frameWriter->frames() << " frames written in " << milliseconds << " ms ("
+                  << frameWriter->frames() * 1000.0 / milliseconds << " fps), " << readback->stalls() << " readback stalls" << std::endl;
+        readback.reset();
+        target.reset();
+    }
 
-    // Close GLFW
-    glfwTerminate();
-    return 0;
+    renderer::FrameProfiler::release();
+    renderer::FrameProfiler::printSummary();
+    if (profile) {
+        renderer::FrameProfiler::writeCsv("frame_profile.csv");
+        renderer::FrameProfiler::writeJson("frame_profile.json");
+    }
 
-    /* GLFW ENDS HERE */
-}
+    // Undo the layers in reverse: the cache saved the tracer's wrappers as its originals
+    renderer::StateCache::printSummary();
+    renderer::StateCache::uninstall();
+    if (trace) {
+        renderer::GLTrace::uninstall();
+        renderer::GLTrace::printSummary();
+        renderer::GLTrace::writeChromeTrace("gl_trace.json");
+    }
 
-// Updates viewport after resizing window
-void framebuffer_size_callback(GLFWwindow *window, int width, int height)
-{
-    glViewport(0, 0, width, height);
-}
+    // De-allocate all remaining resources
+    triangle.reset();
+    shaderProgram.reset();
 
-// Checks for escape and closes window
-void processInput(GLFWwindow *window)
-{
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
-        glfwSetWindowShouldClose(window, true);
+    // The deletes are part of the capture, so a replay can run it in a loop
+    if (capture) {
+        renderer::GLCapture::end();
     }
+
+    return 0;
 }
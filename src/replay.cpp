@@ -0,0 +1,174 @@
+/*
+    Replays a GL capture (written by "main capture" or "square capture") as fast as it can
+    and reports the throughput, plus a checksum of the final image for regression checks.
+    "gl" runs it on whatever driver a hidden GLFW window gets (Mesa llvmpipe, a GPU);
+    "software" runs it on the software rasterizer, with no window at all.
+    Usage: replay <file.glcap> [gl|software] [loops] [threads]
+    Needs glad built with call hooks: make f=replay trace=1
+*/
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <renderer/gl_replay.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+using namespace renderer;
+
+/* SOFTWARE PROGRAMS START HERE */
+
+// Shader sources as main.cpp uploads them; a program links to its stand-in when the sources match
+const char *mainVertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+    "out vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0f);\n"
+    "    ourColor = aColor;\n"
+    "}\0";
+
+const char *mainFragmentShaderSource = "#version 330 core\n"
+    "in vec3 ourColor;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(ourColor, 1.0);\n"
+    "}\0";
+
+// Shader sources as square.cpp uploads them
+const char *squareVertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0f);\n"
+    "}\0";
+
+const char *squareFragmentShaderSource = "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+    "}\0";
+
+// Vertex stage of both: position through, main.cpp also passes the color on
+void passthroughVertexShader(const SwVertexInput &in, SwVertexOutput &out, const void *uniforms)
+{
+    out.position = {in.attribs[0][0], in.attribs[0][1], in.attribs[0][2], 1.0f};
+    out.varyings[0] = in.attribs[1][0];
+    out.varyings[1] = in.attribs[1][1];
+    out.varyings[2] = in.attribs[1][2];
+}
+
+void mainFragmentShader(const float *ourColor, float color[4], const void *uniforms)
+{
+    color[0] = ourColor[0];
+    color[1] = ourColor[1];
+    color[2] = ourColor[2];
+    color[3] = 1.0f;
+}
+
+void squareFragmentShader(const float *varyings, float color[4], const void *uniforms)
+{
+    color[0] = 1.0f;
+    color[1] = 0.5f;
+    color[2] = 0.2f;
+    color[3] = 1.0f;
+}
+
+/* SOFTWARE PROGRAMS END HERE */
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        std::cout << "Usage: replay <file.glcap> [gl|software] [loops] [threads]" << std::endl;
+        return -1;
+    }
+    bool software = argc > 2 && strcmp(argv[2], "software") == 0;
+    int loops = argc > 3 ? atoi(argv[3]) : 10;
+    unsigned int threads = argc > 4 ? (unsigned int)atoi(argv[4]) : 0;
+    if (loops < 1) {
+        loops = 1;
+    }
+
+    GLReplay replay;
+    if (!replay.load(argv[1])) {
+        return -1;
+    }
+    std::cout << argv[1] << ": " << replay.width() << "x" << replay.height() << ", " << replay.frameCount() << " frames, "
+              << replay.callCount() << " calls" << std::endl;
+
+    /* BACKEND STARTS HERE */
+
+    GLFWwindow *window = NULL;
+    std::unique_ptr<ReplayBackend> backend;
+    if (software) {
+        std::unique_ptr<SoftwareReplayBackend> rasterizer(new SoftwareReplayBackend(replay.width(), replay.height(), threads));
+        rasterizer->addProgram({mainVertexShaderSource, mainFragmentShaderSource, {passthroughVertexShader, mainFragmentShader, 3, nullptr}, {}});
+        rasterizer->addProgram({squareVertexShaderSource, squareFragmentShaderSource, {passthroughVertexShader, squareFragmentShader, 0, nullptr}, {}});
+        backend = std::move(rasterizer);
+    } else {
+        // The window only carries the context; the replay draws into a framebuffer object
+        glfwInit();
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+        window = glfwCreateWindow(replay.width(), replay.height(), "LearnOpenGL", NULL, NULL);
+        if (window == NULL) {
+            std::cout << "Failed to create GLFW window" << std::endl;
+            glfwTerminate();
+            return -1;
+        }
+        glfwMakeContextCurrent(window);
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+            std::cout << "Failed to initialize GLAD" << std::endl;
+            return -1;
+        }
+        backend.reset(new GLReplayBackend(replay.width(), replay.height()));
+    }
+
+    /* BACKEND ENDS HERE */
+    /* REPLAY STARTS HERE */
+
+    // The first loop warms up caches and the driver's shader compiler; it's reported but not averaged
+    double totalMilliseconds = 0.0;
+    unsigned long long totalCalls = 0, totalFrames = 0;
+    uint64_t checksum = 0;
+    for (int loop = 0; loop <= loops; loop++) {
+        GLReplayStats stats = replay.run(*backend);
+        if (loop == 0) {
+            checksum = stats.checksum;
+            std::cout << "warm-up: " << stats.milliseconds << " ms, " << stats.calls << " calls run, " << stats.skipped
+                      << " skipped by the " << backend->name() << " backend" << std::endl;
+            continue;
+        }
+        if (stats.checksum != checksum) {
+            std::cout << "ERROR::REPLAY::NOT_DETERMINISTIC loop " << loop << " checksum " << std::hex << stats.checksum << std::dec << std::endl;
+        }
+        totalMilliseconds += stats.milliseconds;
+        totalCalls += stats.calls;
+        totalFrames += stats.frames;
+    }
+
+    std::cout << backend->name() << ": " << loops << " loops in " << totalMilliseconds << " ms, "
+              << totalFrames * 1000.0 / totalMilliseconds << " frames/s, " << totalCalls * 1000.0 / totalMilliseconds
+              << " calls/s, checksum " << std::hex << checksum << std::dec << std::endl;
+
+    /* REPLAY ENDS HERE */
+
+    backend.reset();
+    if (window != NULL) {
+        glfwDestroyWindow(window);
+        glfwTerminate();
+    }
+    return 0;
+}
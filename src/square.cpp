@@ -1,16 +1,20 @@
 /*
     Draws a rectangle using indices (EBO).
+    "square capture [frames]" records the GL calls of that many frames (600 by default) into
+    square.glcap and exits, for the replay tool (needs glad built with "make trace=1").
+    Frame times are profiled and summarized on exit.
 */ 
 
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
+#include <renderer/frame_profiler.h>
+#include <renderer/gl_capture.h>
+#include <renderer/mesh.h>
+#include <renderer/shader.h>
+#include <renderer/window.h>
 
-#include <iostream>
+#include <cstdlib>
+#include <cstring>
 
 
-void framebuffer_size_callback(GLFWwindow *window, int width, int height);
-void processInput(GLFWwindow *window);
-
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
 
@@ -30,107 +34,31 @@ const char *fragmentShaderSource = "#version 330 core\n"
     "   FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
     "}\0";
 
-int main()
+int main(int argc, char **argv)
 {
-    /* GLFW STARTS HERE */
-
-    // Initialize GLFW and set it up
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-#endif
+    bool capture = argc > 1 && strcmp(argv[1], "capture") == 0;
+    int captureFrames = capture && argc > 2 ? atoi(argv[2]) : 600;
 
     /* WINDOW STARTS HERE */
+
     // Create window and make it the current context
-    GLFWwindow *window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
-    if (window == NULL) {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
+    renderer::Window window(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL");
+    if (!window.ok()) {
         return -1;
     }
-    glfwMakeContextCurrent(window);
 
-    // Check for GLAD error
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-        std::cout << "Failed to initialize GLAD" << std::endl;
-        return -1;
+    // Record every GL call from here on, starting with the viewport
+    if (capture) {
+        capture = renderer::GLCapture::begin("square.glcap", SCR_WIDTH, SCR_HEIGHT);
+        // The profiler's timer queries would only be skipped on replay
+        renderer::FrameProfiler::setGpuTiming(false);
+        glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
     }
 
-    // Set viewport and update it everytime the window is resized
-    glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
-
     /* WINDOW ENDS HERE */
     /* SHADERS START HERE */
 
-    /* VERTEX SHADER STARTS HERE */
-
-    // Create a new vertex shader object
-    unsigned int vertexShader;
-    vertexShader = glCreateShader(GL_VERTEX_SHADER);
-
-    // Attach the vertex shader source code to the shader object and compile it
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-
-    // Check for compilation errors
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-
-    /* VERTEX SHADER ENDS HERE */
-    /* FRAGMENT SHADER STARTS HERE */
-
-    // Create a new fragment shader object
-    unsigned int fragmentShader;
-    fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-
-    // Attach the fragment shader source code to the shader object and compile it
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-
-    // Check for compilation errors
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-
-    /* FRAGMENT SHADER ENDS HERE */
-    /* SHADER PROGRAM STARTS HERE */
-
-    // Create a shader program object
-    unsigned int shaderProgram;
-    shaderProgram = glCreateProgram();
-
-    // Attach and link shaders to the program object
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-
-    // Check for compilation errors
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER_PROGRAM::COMPILATION_FAILED" << std::endl;
-    }
-
-    // Set program object as the current active shader
-    glUseProgram(shaderProgram);
-
-    // De-allocate shader objects
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    /* SHADER PROGRAM ENDS HERE */
+    renderer::ShaderProgram shaderProgram(vertexShaderSource, fragmentShaderSource);
 
     /* SHADERS END HERE */
     /* SQUARE STARTS HERE */
@@ -149,30 +77,8 @@ int main()
         1, 2, 3
     };
 
-    // Generate a new Vertex Buffer Object (VBO), Vertex Array Object (VAO) and Element Buffer Object (EBO)
-    unsigned int VBO, VAO, EBO;
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-
-    // Bind the Vertex Array Object first (VAO)
-    glBindVertexArray(VAO);
-
-    // Bind the newly created VBO to the GL_ARRAY_BUFFER target and upload vertex data to the gpu
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    // Bind the newly created EBO to the GL_ELEMENT_ARRAY_BUFFER target and upload vertex data to the gpu
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-    // Specify the layout of the vertex data in the vertex buffer and enable the vertex attribute array at location 0
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    // Unbind the GL_ARRAY_BUFFER and the VAO
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    // VAO, VBO and EBO in one, position at location 0
+    renderer::Mesh square(vertices, sizeof(vertices), 3 * sizeof(float), {{0, 3, GL_FLOAT, 0}}, indices, sizeof(indices));
 
     // Draw wireframe polygons
     // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
@@ -181,49 +87,50 @@ int main()
     /* RENDERING STARTS HERE */
 
     // Render loop (each iteration is a frame)
-    while (!glfwWindowShouldClose(window)) {
+    int frame = 0;
+    while (!window.shouldClose()) {
+        renderer::FrameProfiler::beginFrame(renderer::FRAME_STAGE_INPUT);
+
         // Process input
-        processInput(window);
-        
+        window.processInput();
+
         // State-setting and state-using functions
+        renderer::FrameProfiler::stage(renderer::FRAME_STAGE_SUBMIT);
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
         // Draw our square
-        glUseProgram(shaderProgram);
-        glBindVertexArray(VAO);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        shaderProgram.use();
+        square.draw();
 
         // Swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        renderer::FrameProfiler::stage(renderer::FRAME_STAGE_SWAP);
+        window.swapBuffers();
+        window.pollEvents();
+        renderer::FrameProfiler::endFrame();
+
+        // A capture covers a fixed number of frames
+        if (capture) {
+            renderer::GLCapture::endFrame();
+            if (++frame >= captureFrames) {
+                window.close();
+            }
+        }
     }
 
     /* RENDERING ENDS HERE */
 
-    // De-allocate all remaining resources
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteBuffers(1, &EBO);
-    glDeleteProgram(shaderProgram);
-
-    // Close GLFW
-    glfwTerminate();
-    return 0;
+    renderer::FrameProfiler::release();
+    renderer::FrameProfiler::printSummary();
 
-    /* GLFW ENDS HERE */
-}
-
-// Updates viewport after resizing window
-void framebuffer_size_callback(GLFWwindow *window, int width, int height)
-{
-    glViewport(0, 0, width, height);
-}
+    // De-allocate all remaining resources
+    square.reset();
+    shaderProgram.reset();
 
-// Checks for escape and closes window
-void processInput(GLFWwindow *window)
-{
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
-        glfwSetWindowShouldClose(window, true);
+    // The deletes are part of the capture, so a replay can run it in a loop
+    if (capture) {
+        renderer::GLCapture::end();
     }
+
+    return 0;
 }
@@ -0,0 +1,250 @@
+/*
+    Geometry that changes every frame: a field of small triangles riding a wave, rebuilt on
+    the CPU each frame and streamed through a triple-buffered StreamRingBuffer.
+    Usage: streaming [triangles] [orphan]
+    "orphan" uploads the same data with the glBufferData(NULL) + glBufferSubData idiom
+    instead, for comparison. Frame time and ring statistics are printed once a second.
+*/
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <renderer/program_cache.h>
+#include <renderer/ring_buffer.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+
+void framebuffer_size_callback(GLFWwindow *window, int width, int height);
+void processInput(GLFWwindow *window);
+void buildWave(float *vertices, int triangleCount, float time);
+
+const unsigned int SCR_WIDTH = 800;
+const unsigned int SCR_HEIGHT = 600;
+
+// Vertex shader source code
+const char *vertexShaderSource = "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "layout (location = 1) in vec3 aColor;\n"
+    "out vec3 ourColor;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0f);\n"
+    "    ourColor = aColor;\n"
+    "}\0";
+
+// Fragment shader source code
+const char *fragmentShaderSource = "#version 330 core\n"
+    "in vec3 ourColor;\n"
+    "out vec4 FragColor;\n"
+    "void main()\n"
+    "{\n"
+    "   FragColor = vec4(ourColor, 1.0f);\n"
+    "}\0";
+
+int main(int argc, char **argv)
+{
+    int triangleCount = argc > 1 ? atoi(argv[1]) : 20000;
+    bool orphan = argc > 2 && strcmp(argv[2], "orphan") == 0;
+    if (triangleCount < 1) {
+        triangleCount = 1;
+    }
+
+    /* GLFW STARTS HERE */
+
+    // Initialize GLFW and set it up
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+    /* WINDOW STARTS HERE */
+    // Create window and make it the current context
+    GLFWwindow *window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
+    if (window == NULL) {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+
+    // Check for GLAD error
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+
+    // Set viewport and update it everytime the window is resized
+    glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+    // Measure the uploads, not the display refresh
+    glfwSwapInterval(0);
+
+    /* WINDOW ENDS HERE */
+    /* SHADERS START HERE */
+
+    renderer::ProgramCache programCache;
+    unsigned int shaderProgram = programCache.program(vertexShaderSource, fragmentShaderSource);
+    if (shaderProgram == 0) {
+        glfwTerminate();
+        return -1;
+    }
+
+    /* SHADERS END HERE */
+    /* BUFFERS START HERE */
+
+    // position + colour per vertex
+    const int stride = 6 * sizeof(float);
+    size_t frameBytes = (size_t)triangleCount * 3 * stride;
+
+    // The ring lives until the cleanup below; the orphaning path uses a plain VBO and a staging copy
+    std::unique_ptr<renderer::StreamRingBuffer> ring;
+    unsigned int orphanVBO = 0;
+    std::vector<float> staging;
+    if (orphan) {
+        glGenBuffers(1, &orphanVBO);
+        staging.resize(frameBytes / sizeof(float));
+    } else {
+        ring.reset(new renderer::StreamRingBuffer(GL_ARRAY_BUFFER, frameBytes));
+    }
+
+    // The attribute pointers never change: each frame picks its slice of the ring with the first vertex
+    unsigned int VAO;
+    glGenVertexArrays(1, &VAO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, orphan ? orphanVBO : ring->buffer());
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    std::cout << triangleCount << " triangles, " << frameBytes / 1024 << " KiB per frame, "
+              << (orphan ? "orphaning glBufferData" : ring->persistent() ? "persistent-mapped ring" : "unsynchronized-mapped ring") << std::endl;
+
+    /* BUFFERS END HERE */
+    /* RENDERING STARTS HERE */
+
+    int framesSinceReport = 0;
+    double lastReport = glfwGetTime();
+
+    // Render loop (each iteration is a frame)
+    while (!glfwWindowShouldClose(window)) {
+        // Process input
+        processInput(window);
+
+        // State-setting and state-using functions
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glUseProgram(shaderProgram);
+        glBindVertexArray(VAO);
+
+        float time = (float)glfwGetTime();
+        if (orphan) {
+            // Hand the old storage back to the driver and upload a fresh copy
+            buildWave(staging.data(), triangleCount, time);
+            glBindBuffer(GL_ARRAY_BUFFER, orphanVBO);
+            glBufferData(GL_ARRAY_BUFFER, frameBytes, NULL, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, frameBytes, staging.data());
+            glDrawArrays(GL_TRIANGLES, 0, triangleCount * 3);
+        } else {
+            // Write the vertices straight into the mapped ring, then let GL read them
+            ring->beginFrame();
+            renderer::RingAllocation vertices = ring->allocate(frameBytes, stride);
+            if (vertices.data != nullptr) {
+                buildWave((float *)vertices.data, triangleCount, time);
+            }
+            ring->finishWrites();
+            if (vertices.data != nullptr) {
+                glDrawArrays(GL_TRIANGLES, (int)(vertices.offset / stride), triangleCount * 3);
+            }
+            ring->endFrame();
+        }
+
+        // Swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+
+        framesSinceReport++;
+        double now = glfwGetTime();
+        if (now - lastReport >= 1.0) {
+            double frameMilliseconds = (now - lastReport) * 1000.0 / framesSinceReport;
+            std::cout << frameMilliseconds << " ms/frame";
+            if (!orphan) {
+                const renderer::RingBufferStats &stats = ring->statistics();
+                std::cout << ", ring waits: " << stats.waits << " (" << stats.waitMilliseconds << " ms), overflows: " << stats.overflows;
+            }
+            std::cout << std::endl;
+            framesSinceReport = 0;
+            lastReport = now;
+        }
+    }
+
+    /* RENDERING ENDS HERE */
+
+    // De-allocate all remaining resources
+    glDeleteVertexArrays(1, &VAO);
+    if (orphan) {
+        glDeleteBuffers(1, &orphanVBO);
+    }
+    glDeleteProgram(shaderProgram);
+    ring.reset();
+
+    // Close GLFW
+    glfwTerminate();
+    return 0;
+
+    /* GLFW ENDS HERE */
+}
+
+// Fills triangleCount triangles (18 floats each) laid out in a grid, bobbing on a sine wave
+void buildWave(float *vertices, int triangleCount, float time)
+{
+    int columns = (int)ceil(sqrt((double)triangleCount));
+    float cell = 2.0f / columns;
+
+    for (int i = 0; i < triangleCount; i++) {
+        float x = -1.0f + (i % columns + 0.5f) * cell;
+        float y = -1.0f + (i / columns + 0.5f) * cell;
+        float wave = sinf(x * 4.0f + time * 3.0f) * cosf(y * 3.0f + time * 2.0f);
+        float size = cell * (0.3f + 0.2f * wave);
+        y += wave * cell;
+
+        float corners[3][2] = {{x - size, y - size}, {x + size, y - size}, {x, y + size}};
+        for (int v = 0; v < 3; v++) {
+            float *out = vertices + (i * 3 + v) * 6;
+            out[0] = corners[v][0];
+            out[1] = corners[v][1];
+            out[2] = 0.0f;
+            out[3] = 0.5f + 0.5f * wave;
+            out[4] = 0.3f;
+            out[5] = 0.5f - 0.5f * wave;
+        }
+    }
+}
+
+// Updates viewport after resizing window
+void framebuffer_size_callback(GLFWwindow *window, int width, int height)
+{
+    glViewport(0, 0, width, height);
+}
+
+// Checks for escape and closes window
+void processInput(GLFWwindow *window)
+{
+    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+        glfwSetWindowShouldClose(window, true);
+    }
+}
@@ -2,15 +2,17 @@
     Now create the same 2 triangles using two different VAOs and VBOs for their data.
 */
 
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
-
+#include <renderer/command_buffer.h>
+#include <renderer/mesh.h>
+#include <renderer/program_cache.h>
+#include <renderer/shader.h>
+#include <renderer/shader_builder.h>
+#include <renderer/window.h>
+
+#include <chrono>
 #include <iostream>
 
 
-void framebuffer_size_callback(GLFWwindow *window, int width, int height);
-void processInput(GLFWwindow *window);
-
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
 
@@ -40,119 +42,31 @@ const char *fragmentShader2Source = "#version 330 core\n"
 
 int main()
 {
-    /* GLFW STARTS HERE */
-
-    // Initialize GLFW and set it up
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-#endif
+    auto startupBegin = std::chrono::steady_clock::now();
 
     /* WINDOW STARTS HERE */
-    // Create window and make it the current context
-    GLFWwindow *window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
-    if (window == NULL) {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
-        return -1;
-    }
-    glfwMakeContextCurrent(window);
 
-    // Check for GLAD error
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-        std::cout << "Failed to initialize GLAD" << std::endl;
+    // Create window and make it the current context
+    renderer::Window window(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL");
+    if (!window.ok()) {
         return -1;
     }
 
-    // Set viewport and update it everytime the window is resized
-    glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
-
     /* WINDOW ENDS HERE */
     /* SHADERS START HERE */
 
-    /* VERTEX SHADER STARTS HERE */
-
-    // Create a new vertex shader object
-    unsigned int vertexShader;
-    vertexShader = glCreateShader(GL_VERTEX_SHADER);
-
-    // Attach the vertex shader source code to the shader object and compile it
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-
-    // Check for compilation errors
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-
-    /* VERTEX SHADER ENDS HERE */
-    /* FRAGMENT SHADER STARTS HERE */
-
-    // Create new fragment shader objects
-    unsigned int fragmentShaderOrange = glCreateShader(GL_FRAGMENT_SHADER);
-    unsigned int fragmentShaderYellow = glCreateShader(GL_FRAGMENT_SHADER);
-
-    // Attach the fragment shader source code to the shader object and compile it
-    glShaderSource(fragmentShaderOrange, 1, &fragmentShader1Source, NULL);
-    glCompileShader(fragmentShaderOrange);
-
-    // Check for compilation errors
-    glGetShaderiv(fragmentShaderOrange, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(fragmentShaderOrange, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-
-    // Attach the yellow fragment shader source code to the shader object and compile it
-    glShaderSource(fragmentShaderYellow, 1, &fragmentShader2Source, NULL);
-    glCompileShader(fragmentShaderYellow);
-
-    // Check for compilation errors
-    glGetShaderiv(fragmentShaderYellow, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(fragmentShaderYellow, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-
-    /* FRAGMENT SHADER ENDS HERE */
-    /* SHADER PROGRAM STARTS HERE */
-
-    // Create shader program objects
-    unsigned int shaderProgramOrange = glCreateProgram();
-    unsigned int shaderProgramYellow = glCreateProgram();
+    // Queue both programs and hand them to the driver in one go. The on-disk cache serves the
+    // ones it already has, so a warm start never calls glCompileShader/glLinkProgram, and the
+    // status checks are deferred to the render loop
+    renderer::ProgramCache programCache("shader_cache");
+    renderer::ShaderBuilder shaderBuilder(&programCache);
+    int orangeProgramHandle = shaderBuilder.add(vertexShaderSource, fragmentShader1Source);
+    int yellowProgramHandle = shaderBuilder.add(vertexShaderSource, fragmentShader2Source);
+    shaderBuilder.submit();
 
-    // Attach and link shaders to shaderProgram
-    glAttachShader(shaderProgramOrange, vertexShader);
-    glAttachShader(shaderProgramOrange, fragmentShaderOrange);
-    glLinkProgram(shaderProgramOrange);
-
-    // Check for compilation errors
-    glGetProgramiv(shaderProgramOrange, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgramOrange, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER_PROGRAM::COMPILATION_FAILED" << std::endl;
-    }
-
-    // Attach and link shaders to shaderProgramYellow
-    glAttachShader(shaderProgramYellow, vertexShader);
-    glAttachShader(shaderProgramYellow, fragmentShaderYellow);
-    glLinkProgram(shaderProgramYellow);
-
-    // De-allocate shader objects
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShaderOrange);
-    glDeleteShader(fragmentShaderYellow);
-
-    /* SHADER PROGRAM ENDS HERE */
+    // Each program is adopted as soon as it is ready, so it is deleted however the loop ends
+    renderer::ShaderProgram shaderProgramOrange;
+    renderer::ShaderProgram shaderProgramYellow;
 
     /* SHADERS END HERE */
     /* TRIANGLES START HERE */
@@ -169,36 +83,9 @@ int main()
         0.350f, 0.5f, 0.0f,   // top
     };
 
-    // Generate new Vertex Buffer (VBO) and Vertex Array (VAO) objects
-    unsigned int VBOs[2], VAOs[2];
-    glGenVertexArrays(2, VAOs);
-    glGenBuffers(2, VBOs);
-
-    // Bind the Vertex Array Object of the first triangle (VAO)
-    glBindVertexArray(VAOs[0]);
-
-    // Bind the the first triangle's VBO to the GL_ARRAY_BUFFER target and upload vertex data to the gpu
-    glBindBuffer(GL_ARRAY_BUFFER, VBOs[0]);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(firstTriangle), firstTriangle, GL_STATIC_DRAW);
-
-    // Specify the layout of the vertex data in the vertex buffer and enable the vertex attribute array at location 0 for the first triangle
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(float) * 3, (void*)0);
-    glEnableVertexAttribArray(0);
-    
-    // Bind the Vertex Array Object of the second triangle (VAO)
-    glBindVertexArray(VAOs[1]);
-
-    // Bind the the second triangle's VBO to the GL_ARRAY_BUFFER target and upload vertex data to the gpu
-    glBindBuffer(GL_ARRAY_BUFFER, VBOs[1]);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(secondTriangle), secondTriangle, GL_STATIC_DRAW);
-
-    // Specify the layout of the vertex data in the vertex buffer and enable the vertex attribute array at location 0 for the second triangle
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(float) * 3, (void*)0);
-    glEnableVertexAttribArray(0);
-
-    // Unbind the GL_ARRAY_BUFFER and the VAO
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    // A VAO and VBO per triangle, position at location 0
+    renderer::Mesh leftTriangle(firstTriangle, sizeof(firstTriangle), 3 * sizeof(float), {{0, 3, GL_FLOAT, 0}});
+    renderer::Mesh rightTriangle(secondTriangle, sizeof(secondTriangle), 3 * sizeof(float), {{0, 3, GL_FLOAT, 0}});
 
     // Draw wireframe polygons
     // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
@@ -206,55 +93,54 @@ int main()
     /* TRIANGLES END HERE */
     /* RENDERING STARTS HERE */
 
+    bool programsReported = false;
+
+    renderer::CommandBuffer commands;
+    renderer::GLCommandBackend glBackend;
+
     // Render loop (each iteration is a frame)
-    while (!glfwWindowShouldClose(window)) {
+    while (!window.shouldClose()) {
         // Process input
-        processInput(window);
+        window.processInput();
         
         // State-setting and state-using functions
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        // Draw first triangle (orange)
-        glUseProgram(shaderProgramOrange);
-        glBindVertexArray(VAOs[0]);
-        glDrawArrays(GL_TRIANGLES, 0, 3);
-
-        // Draw second triangle (yellow)
-        glUseProgram(shaderProgramYellow);
-        glBindVertexArray(VAOs[1]);
-        glDrawArrays(GL_TRIANGLES, 0, 3);
+        // Record both triangles, each as soon as its program has finished building
+        commands.clear();
+        if (!shaderProgramOrange.ok()) {
+            shaderProgramOrange = renderer::ShaderProgram(shaderBuilder.ready(orangeProgramHandle));
+        }
+        if (shaderProgramOrange.ok()) {
+            commands.drawArrays(shaderProgramOrange.id(), leftTriangle.id(), GL_TRIANGLES, 0, 3);
+        }
+        if (!shaderProgramYellow.ok()) {
+            shaderProgramYellow = renderer::ShaderProgram(shaderBuilder.ready(yellowProgramHandle));
+        }
+        if (shaderProgramYellow.ok()) {
+            commands.drawArrays(shaderProgramYellow.id(), rightTriangle.id(), GL_TRIANGLES, 0, 3);
+        }
+
+        // Sort by program and VAO and draw, changing state only between groups
+        commands.sort();
+        commands.submit(glBackend);
+
+        // Cold (empty cache) vs warm startup: time until every program was usable
+        if (!programsReported && shaderBuilder.poll() == 0) {
+            double startupMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startupBegin).count();
+            std::cout << "Startup: all programs ready after " << startupMilliseconds << " ms" << std::endl;
+            programCache.printStatistics();
+            programsReported = true;
+        }
 
         // Swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        window.swapBuffers();
+        window.pollEvents();
     }
 
     /* RENDERING ENDS HERE */
 
-    // De-allocate all remaining resources
-    glDeleteVertexArrays(sizeof(VAOs), VAOs);
-    glDeleteBuffers(sizeof(VBOs), VBOs);
-    glDeleteProgram(shaderProgramOrange);
-    glDeleteProgram(shaderProgramYellow);
-
-    // Close GLFW
-    glfwTerminate();
+    // The programs, the builder (with anything still building) and the meshes go before the window closes GLFW
     return 0;
-
-    /* GLFW ENDS HERE */
-}
-
-// Updates viewport after resizing window
-void framebuffer_size_callback(GLFWwindow *window, int width, int height)
-{
-    glViewport(0, 0, width, height);
-}
-
-// Checks for escape and closes window
-void processInput(GLFWwindow *window)
-{
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
-        glfwSetWindowShouldClose(window, true);
-    }
 }